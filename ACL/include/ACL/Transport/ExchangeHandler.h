@@ -17,6 +17,9 @@
 #define ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_EXCHANGEHANDLER_H_
 
 #include <memory>
+#include <mutex>
+
+#include <AVSCommon/Utils/HTTP2/HTTP2RequestInterface.h>
 
 #include "ACL/Transport/ExchangeHandlerContextInterface.h"
 
@@ -44,6 +47,20 @@ public:
     virtual ~ExchangeHandler() = default;
 
 protected:
+    /**
+     * Set the request sent for this exchange, so that @c resumeRequest() can resume it.
+     *
+     * @param request The request sent for this exchange.
+     */
+    void setRequest(std::shared_ptr<avsCommon::utils::http2::HTTP2RequestInterface> request);
+
+    /**
+     * Resume transfers on the request sent for this exchange, because its source has data to send or its sink has
+     * space for data to receive after returning @c PAUSE.  If the request has not been set yet, it is resumed when
+     * it is.  This may be called from any thread.
+     */
+    void resumeRequest();
+
     /// The @c HTTP2Transport instance for which this exchange is to be performed.
     std::shared_ptr<ExchangeHandlerContextInterface> m_context;
 
@@ -52,6 +69,16 @@ protected:
 
     /// The AVS authorization header to send in the request.
     const std::string m_authHeader;
+
+private:
+    /// Serializes access to @c m_request and @c m_isResumePending.
+    std::mutex m_requestMutex;
+
+    /// The request sent for this exchange.  The request owns this handler, so it is not owned here.
+    std::weak_ptr<avsCommon::utils::http2::HTTP2RequestInterface> m_request;
+
+    /// Whether @c resumeRequest() was called before @c setRequest().
+    bool m_isResumePending;
 };
 
 }  // namespace acl
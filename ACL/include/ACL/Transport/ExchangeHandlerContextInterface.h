@@ -19,6 +19,7 @@
 #include <memory>
 #include <string>
 
+#include <AVSCommon/AVS/MessageRequest.h>
 #include <AVSCommon/Utils/HTTP2/HTTP2RequestConfig.h>
 #include <AVSCommon/Utils/HTTP2/HTTP2RequestInterface.h>
 
@@ -58,8 +59,10 @@ public:
     /**
      * Notification that sending a @c MessageRequest has failed or been acknowledged by AVS
      * (this is used to indicate it is okay to send the next message).
+     *
+     * @param request The @c MessageRequest that was acknowledged.
      */
-    virtual void onMessageRequestAcknowledged() = 0;
+    virtual void onMessageRequestAcknowledged(std::shared_ptr<avsCommon::avs::MessageRequest> request) = 0;
 
     /**
      * Notification tht a message request has finished it's exchange with AVS.
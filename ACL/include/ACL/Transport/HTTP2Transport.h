@@ -25,6 +25,8 @@
 #include <string>
 #include <thread>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include <AVSCommon/AVS/Attachment/AttachmentManager.h>
 #include <AVSCommon/Utils/HTTP2/HTTP2ConnectionInterface.h>
@@ -35,6 +37,7 @@
 #include "ACL/Transport/PostConnectFactoryInterface.h"
 #include "ACL/Transport/PostConnectObserverInterface.h"
 #include "ACL/Transport/PostConnectSendMessageInterface.h"
+#include "ACL/Transport/TransportStatistics.h"
 #include "ACL/Transport/TransportInterface.h"
 #include "ACL/Transport/TransportObserverInterface.h"
 
@@ -63,6 +66,19 @@ public:
 
         /// The elapsed time without any activity before sending out a ping.
         std::chrono::seconds inactivityTimeout;
+
+        /**
+         * Whether to send a @c MessageRequest before earlier ones it does not depend on have been acknowledged.
+         * If @c false, each @c MessageRequest waits until AVS has acknowledged the previous one.  If @c true, a
+         * @c MessageRequest only waits for earlier ones with the same @c dialogRequestId (requests without a
+         * @c dialogRequestId wait for earlier requests without one), so events are not held back by a slow
+         * @c Recognize.
+         */
+        bool pipelineMessageRequests;
+
+        /// The maximum number of @c MessageRequests to have in flight at once.  At most 8, as AVS allows 10
+        /// concurrent streams, and one each is needed for the downchannel and pings.
+        int maxConcurrentMessageRequests;
     };
 
     /**
@@ -109,6 +125,13 @@ public:
      */
     std::shared_ptr<avsCommon::utils::http2::HTTP2ConnectionInterface> getHTTP2Connection();
 
+    /**
+     * Get totals for the streams this transport has opened, to monitor the health of the connection.
+     *
+     * @return The totals so far.
+     */
+    TransportStatistics getStatistics() const;
+
     /// @name TransportInterface methods.
     /// @{
     bool connect() override;
@@ -145,7 +168,7 @@ public:
     void onDownchannelFinished() override;
     void onMessageRequestSent() override;
     void onMessageRequestTimeout() override;
-    void onMessageRequestAcknowledged() override;
+    void onMessageRequestAcknowledged(std::shared_ptr<avsCommon::avs::MessageRequest> request) override;
     void onMessageRequestFinished() override;
     void onPingRequestAcknowledged(bool success) override;
     void onPingTimeout() override;
@@ -291,6 +314,26 @@ private:
      */
     State sendMessagesAndPings(State whileState);
 
+    /**
+     * Get the key used to order a @c MessageRequest relative to others.  If pipelining is enabled this is the
+     * @c dialogRequestId of the request (if any), otherwise it is the same for all requests.
+     *
+     * @param request The @c MessageRequest to get the key for.
+     * @return The ordering key of the @c MessageRequest.
+     */
+    std::string getOrderingKey(std::shared_ptr<avsCommon::avs::MessageRequest> request);
+
+    /**
+     * Find the first queued @c MessageRequest that may be sent now, that is, whose ordering key is not shared by
+     * a request still awaiting acknowledgement.
+     *
+     * @note Must be called while @c m_mutex is held by the calling thread.
+     *
+     * @return An iterator to the request in @c m_requestQueue, or @c m_requestQueue.end() if none may be sent.
+     */
+    std::deque<std::pair<std::shared_ptr<avsCommon::avs::MessageRequest>, std::string>>::iterator
+    findSendableRequestLocked();
+
     /**
      * Set the state to a new state.
      *
@@ -334,6 +377,13 @@ private:
      */
     void notifyObserversOnServerSideDisconnect();
 
+    /**
+     * Get the deadline for sending a ping if there is no more activity.
+     *
+     * @return The time when the connection will have been inactive for @c Configuration::inactivityTimeout.
+     */
+    std::chrono::steady_clock::time_point getPingDeadline() const;
+
     /**
      * Get m_state in a thread-safe manner.
      *
@@ -380,14 +430,14 @@ private:
     /// PostConnect object is used to perform activities required once a connection is established.
     std::shared_ptr<PostConnectInterface> m_postConnect;
 
-    /// Queue of @c MessageRequest instances to send. Serialized by @c m_mutex.
-    std::deque<std::shared_ptr<avsCommon::avs::MessageRequest>> m_requestQueue;
+    /// Queue of @c MessageRequest instances to send, with their ordering keys. Serialized by @c m_mutex.
+    std::deque<std::pair<std::shared_ptr<avsCommon::avs::MessageRequest>, std::string>> m_requestQueue;
 
     /// Number of times connecting has been retried.
     int m_connectRetryCount;
 
-    /// Is a message handler awaiting a response?
-    bool m_isMessageHandlerAwaitingResponse;
+    /// The @c MessageRequests that have been sent but not yet acknowledged, with their ordering keys.
+    std::vector<std::pair<std::shared_ptr<avsCommon::avs::MessageRequest>, std::string>> m_requestsAwaitingResponse;
 
     /// The number of message handlers that are not finished with their request.
     int m_countOfUnfinishedMessageHandlers;
@@ -395,8 +445,13 @@ private:
     /// The current ping handler (if any).
     std::shared_ptr<PingHandler> m_pingHandler;
 
-    /// Time last activity on the connection was observed.
-    std::chrono::time_point<std::chrono::steady_clock> m_timeOfLastActivity;
+    /**
+     * Time last activity on the connection was observed, in milliseconds since the @c std::chrono::steady_clock
+     * epoch.  This is atomic so that @c onActivity(), which is called for every chunk received, need not take
+     * @c m_mutex.  Millisecond resolution is plenty for a timeout in seconds, and means that a burst of activity
+     * mostly reads the value rather than writing it.
+     */
+    std::atomic<int64_t> m_lastActivityMs;
 
     /// A bool to specify whether a post connect message was already received
     std::atomic<bool> m_postConnected;
@@ -404,6 +459,12 @@ private:
     /// The runtime HTTP2/2 connection settings.
     const Configuration m_configuration;
 
+    /// @c Configuration::maxConcurrentMessageRequests, limited to the streams available for @c MessageRequests.
+    const int m_maxConcurrentMessageRequests;
+
+    /// Totals for the streams this transport has opened.
+    std::shared_ptr<TransportStatisticsRecorder> m_statistics;
+
     /// The reason for disconnecting.
     avsCommon::sdkInterfaces::ConnectionStatusObserverInterface::ChangedReason m_disconnectReason;
 };
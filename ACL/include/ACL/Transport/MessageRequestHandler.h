@@ -94,6 +94,7 @@ private:
     /// @{
     void onActivity() override;
     bool onReceiveResponseCode(long responseCode) override;
+    void onReadyToReceiveData() override;
     void onResponseFinished(avsCommon::utils::http2::HTTP2ResponseFinishedStatus status, const std::string& nonMimeBody)
         override;
     /// @}
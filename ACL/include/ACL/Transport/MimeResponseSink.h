@@ -43,12 +43,15 @@ public:
      * @param messageConsumer Object to send decoded messages to.
      * @param attachmentManager Object with which to get attachments to write to.
      * @param attachmentContextId Id added to content IDs to assure global uniqueness.
+     * @param traceId The id with which @c LatencyTracer events for this response are recorded: the hashed
+     *     dialogRequestId (or messageId) of the request it responds to, or zero if there is none.
      */
     MimeResponseSink(
         std::shared_ptr<MimeResponseStatusHandlerInterface> handler,
         std::shared_ptr<MessageConsumerInterface> messageConsumer,
         std::shared_ptr<avsCommon::avs::attachment::AttachmentManager> attachmentManager,
-        std::string attachmentContextId);
+        std::string attachmentContextId,
+        uint64_t traceId = 0);
 
     /**
      * Destructor.
@@ -101,6 +104,9 @@ private:
     /// The contextId, needed for creating attachments.
     std::string m_attachmentContextId;
 
+    /// The id with which @c LatencyTracer events for this response are recorded.
+    const uint64_t m_traceId;
+
     /**
      * The directive message being received from AVS by this stream.  It may be built up over several calls if either
      * the write quantums are small, or if the message is long.
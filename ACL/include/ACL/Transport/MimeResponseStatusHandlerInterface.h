@@ -50,6 +50,14 @@ public:
      */
     virtual bool onReceiveResponseCode(long responseCode) = 0;
 
+    /**
+     * Notification that the response, which was paused because the attachment it was being written to was full, can
+     * be received again.
+     *
+     * @note This may be called from any thread, so it should return quickly.
+     */
+    virtual void onReadyToReceiveData() = 0;
+
     /**
      * Notification that the request/response cycle has finished and no further notifications will be provided.
      *
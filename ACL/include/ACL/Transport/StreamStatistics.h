@@ -0,0 +1,118 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_STREAMSTATISTICS_H_
+#define ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_STREAMSTATISTICS_H_
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <AVSCommon/Utils/HTTP2/HTTP2RequestSourceInterface.h>
+#include <AVSCommon/Utils/HTTP2/HTTP2ResponseSinkInterface.h>
+
+#include "ACL/Transport/TransportStatistics.h"
+
+namespace alexaClientSDK {
+namespace acl {
+
+/**
+ * Counts the bytes and chunks sent and received on one stream, and its time to first byte.  It is placed between
+ * the HTTP/2 connection and a stream's request source and response sink, passes everything through to them, and adds
+ * what it counts to a @c TransportStatisticsRecorder.  The stream's totals are logged when it finishes.
+ */
+class StreamStatistics
+        : public avsCommon::utils::http2::HTTP2RequestSourceInterface
+        , public avsCommon::utils::http2::HTTP2ResponseSinkInterface {
+public:
+    /**
+     * Create a @c StreamStatistics.
+     *
+     * @param recorder The object to add the counts to.
+     * @param streamId The id of the stream, for logging.
+     * @param source The stream's request source, or @c nullptr if it has none.
+     * @param sink The stream's response sink, or @c nullptr if it has none.
+     * @return The new @c StreamStatistics, or @c nullptr if @c recorder is @c nullptr.
+     */
+    static std::shared_ptr<StreamStatistics> create(
+        std::shared_ptr<TransportStatisticsRecorder> recorder,
+        const std::string& streamId,
+        std::shared_ptr<avsCommon::utils::http2::HTTP2RequestSourceInterface> source,
+        std::shared_ptr<avsCommon::utils::http2::HTTP2ResponseSinkInterface> sink);
+
+    /// @name HTTP2RequestSourceInterface methods.
+    /// @{
+    std::vector<std::string> getRequestHeaderLines() override;
+    avsCommon::utils::http2::HTTP2SendDataResult onSendData(char* bytes, size_t size) override;
+    /// @}
+
+    /// @name HTTP2ResponseSinkInterface methods.
+    /// @{
+    bool onReceiveResponseCode(long responseCode) override;
+    bool onReceiveHeaderLine(const std::string& line) override;
+    avsCommon::utils::http2::HTTP2ReceiveDataStatus onReceiveData(const char* bytes, size_t size) override;
+    void onResponseFinished(avsCommon::utils::http2::HTTP2ResponseFinishedStatus status) override;
+    /// @}
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param recorder The object to add the counts to.
+     * @param streamId The id of the stream, for logging.
+     * @param source The stream's request source, or @c nullptr if it has none.
+     * @param sink The stream's response sink, or @c nullptr if it has none.
+     */
+    StreamStatistics(
+        std::shared_ptr<TransportStatisticsRecorder> recorder,
+        const std::string& streamId,
+        std::shared_ptr<avsCommon::utils::http2::HTTP2RequestSourceInterface> source,
+        std::shared_ptr<avsCommon::utils::http2::HTTP2ResponseSinkInterface> sink);
+
+    /// The object to add the counts to.
+    std::shared_ptr<TransportStatisticsRecorder> m_recorder;
+
+    /// The id of the stream.
+    const std::string m_streamId;
+
+    /// The stream's request source.
+    std::shared_ptr<avsCommon::utils::http2::HTTP2RequestSourceInterface> m_source;
+
+    /// The stream's response sink.
+    std::shared_ptr<avsCommon::utils::http2::HTTP2ResponseSinkInterface> m_sink;
+
+    /// When the stream was opened.
+    const std::chrono::steady_clock::time_point m_openTime;
+
+    /// Whether the response code has been received.
+    bool m_firstByteReceived;
+
+    /// The number of request body bytes sent on this stream.
+    uint64_t m_bytesSent;
+
+    /// The number of chunks of request body sent on this stream.
+    uint64_t m_chunksSent;
+
+    /// The number of response body bytes received on this stream.
+    uint64_t m_bytesReceived;
+
+    /// The number of chunks of response body received on this stream.
+    uint64_t m_chunksReceived;
+};
+
+}  // namespace acl
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_STREAMSTATISTICS_H_
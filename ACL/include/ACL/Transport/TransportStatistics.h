@@ -0,0 +1,138 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_TRANSPORTSTATISTICS_H_
+#define ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_TRANSPORTSTATISTICS_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace alexaClientSDK {
+namespace acl {
+
+/**
+ * Totals for the streams of a transport, for monitoring the health of the connection to AVS.
+ */
+struct TransportStatistics {
+    /**
+     * Constructor. Initializes all the totals to zero.
+     */
+    TransportStatistics();
+
+    /// The number of request body bytes sent.
+    uint64_t bytesSent;
+
+    /// The number of chunks in which the request body bytes were sent.
+    uint64_t chunksSent;
+
+    /// The number of response body bytes received.
+    uint64_t bytesReceived;
+
+    /// The number of chunks in which the response body bytes were received.
+    uint64_t chunksReceived;
+
+    /// The number of streams opened, including the downchannel and pings.
+    uint64_t streamsOpened;
+
+    /// The number of pings sent.
+    uint64_t pingsSent;
+
+    /// The number of streams which received a response.
+    uint64_t responsesReceived;
+
+    /// The average time from opening a stream to receiving its response code.
+    std::chrono::microseconds averageTimeToFirstByte;
+};
+
+/**
+ * Collects @c TransportStatistics.  All methods may be called from any thread, and none of them block.
+ */
+class TransportStatisticsRecorder {
+public:
+    /**
+     * Constructor.
+     */
+    TransportStatisticsRecorder();
+
+    /**
+     * Count a stream that was opened.
+     */
+    void onStreamOpened();
+
+    /**
+     * Count a ping that was sent.
+     */
+    void onPingSent();
+
+    /**
+     * Count a chunk of request body that was sent.
+     *
+     * @param size The size of the chunk.
+     */
+    void onDataSent(size_t size);
+
+    /**
+     * Count a chunk of response body that was received.
+     *
+     * @param size The size of the chunk.
+     */
+    void onDataReceived(size_t size);
+
+    /**
+     * Count a stream which received its response code.
+     *
+     * @param timeToFirstByte The time from opening the stream to receiving the response code.
+     */
+    void onFirstByteReceived(std::chrono::steady_clock::duration timeToFirstByte);
+
+    /**
+     * Get the totals so far.  Each total is read atomically, but they are not read together, so they may be slightly
+     * inconsistent with each other while streams are active.
+     *
+     * @return The totals so far.
+     */
+    TransportStatistics getStatistics() const;
+
+private:
+    /// @c TransportStatistics::bytesSent.
+    std::atomic<uint64_t> m_bytesSent;
+
+    /// @c TransportStatistics::chunksSent.
+    std::atomic<uint64_t> m_chunksSent;
+
+    /// @c TransportStatistics::bytesReceived.
+    std::atomic<uint64_t> m_bytesReceived;
+
+    /// @c TransportStatistics::chunksReceived.
+    std::atomic<uint64_t> m_chunksReceived;
+
+    /// @c TransportStatistics::streamsOpened.
+    std::atomic<uint64_t> m_streamsOpened;
+
+    /// @c TransportStatistics::pingsSent.
+    std::atomic<uint64_t> m_pingsSent;
+
+    /// @c TransportStatistics::responsesReceived.
+    std::atomic<uint64_t> m_responsesReceived;
+
+    /// The total time to first byte of the responses received, in microseconds.
+    std::atomic<uint64_t> m_totalTimeToFirstByte;
+};
+
+}  // namespace acl
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_TRANSPORTSTATISTICS_H_
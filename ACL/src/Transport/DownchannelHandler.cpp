@@ -78,6 +78,7 @@ std::shared_ptr<DownchannelHandler> DownchannelHandler::create(
         ACSDK_ERROR(LX("createFailed").d("reason", "createAndSendRequestFailed"));
         return nullptr;
     }
+    handler->setRequest(request);
 
     return handler;
 }
@@ -123,6 +124,10 @@ bool DownchannelHandler::onReceiveResponseCode(long responseCode) {
     return true;
 }
 
+void DownchannelHandler::onReadyToReceiveData() {
+    resumeRequest();
+}
+
 void DownchannelHandler::onResponseFinished(HTTP2ResponseFinishedStatus status, const std::string& nonMimeBody) {
     ACSDK_DEBUG5(LX(__func__).d("status", status).d("nonMimeBody", nonMimeBody));
     m_context->onDownchannelFinished();
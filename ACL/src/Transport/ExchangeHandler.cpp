@@ -41,12 +41,38 @@ ExchangeHandler::ExchangeHandler(
     const std::string& authToken) :
         m_context{context},
         m_authToken{authToken},
-        m_authHeader{AUTHORIZATION_HEADER + authToken} {
+        m_authHeader{AUTHORIZATION_HEADER + authToken},
+        m_isResumePending{false} {
     ACSDK_DEBUG5(LX(__func__).d("context", context.get()).sensitive("authToken", authToken));
     if (m_authToken.empty()) {
         ACSDK_ERROR(LX(__func__).m("emptyAuthToken"));
     }
 }
 
+void ExchangeHandler::setRequest(std::shared_ptr<avsCommon::utils::http2::HTTP2RequestInterface> request) {
+    bool isResumePending = false;
+    {
+        std::lock_guard<std::mutex> lock(m_requestMutex);
+        m_request = request;
+        std::swap(isResumePending, m_isResumePending);
+    }
+    if (isResumePending && request) {
+        request->resume();
+    }
+}
+
+void ExchangeHandler::resumeRequest() {
+    std::shared_ptr<avsCommon::utils::http2::HTTP2RequestInterface> request;
+    {
+        std::lock_guard<std::mutex> lock(m_requestMutex);
+        request = m_request.lock();
+        if (!request) {
+            m_isResumePending = true;
+            return;
+        }
+    }
+    request->resume();
+}
+
 }  // namespace acl
 }  // namespace alexaClientSDK
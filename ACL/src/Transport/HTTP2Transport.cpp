@@ -13,10 +13,14 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
 #include <chrono>
 #include <functional>
+#include <limits>
 #include <random>
 
+#include <rapidjson/document.h>
+
 #include <AVSCommon/Utils/HTTP2/HTTP2MimeRequestEncoder.h>
 #include <AVSCommon/Utils/HTTP2/HTTP2MimeResponseDecoder.h>
 #include <AVSCommon/Utils/LibcurlUtils/HttpResponseCodes.h>
@@ -28,6 +32,7 @@
 #include "ACL/Transport/HTTP2Transport.h"
 #include "ACL/Transport/MessageRequestHandler.h"
 #include "ACL/Transport/PingHandler.h"
+#include "ACL/Transport/StreamStatistics.h"
 #include "ACL/Transport/TransportDefines.h"
 
 namespace alexaClientSDK {
@@ -59,6 +64,28 @@ static const int MAX_MESSAGE_HANDLERS = MAX_STREAMS - 2;
 /// Timeout to send a ping to AVS if there has not been any other acitivity on the connection.
 static std::chrono::minutes INACTIVITY_TIMEOUT{5};
 
+/// Value of @c m_lastActivityMs which makes a ping due immediately.
+static const int64_t ACTIVITY_LONG_AGO = std::numeric_limits<int64_t>::min();
+
+/// Key for the event object in the JSON content of a @c MessageRequest.
+static const char EVENT_KEY[] = "event";
+
+/// Key for the header object in the event.
+static const char HEADER_KEY[] = "header";
+
+/// Key for the dialogRequestId in the event header.
+static const char DIALOG_REQUEST_ID_KEY[] = "dialogRequestId";
+
+/**
+ * Get the current time, at the resolution of @c HTTP2Transport::m_lastActivityMs.
+ *
+ * @return Milliseconds since the @c std::chrono::steady_clock epoch.
+ */
+static int64_t millisecondsNow() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
 /**
  * Write a @c HTTP2Transport::State value to an @c ostream as a string.
  *
@@ -90,7 +117,10 @@ std::ostream& operator<<(std::ostream& stream, HTTP2Transport::State state) {
     return stream << "";
 }
 
-HTTP2Transport::Configuration::Configuration() : inactivityTimeout{INACTIVITY_TIMEOUT} {
+HTTP2Transport::Configuration::Configuration() :
+        inactivityTimeout{INACTIVITY_TIMEOUT},
+        pipelineMessageRequests{false},
+        maxConcurrentMessageRequests{MAX_MESSAGE_HANDLERS} {
 }
 
 std::shared_ptr<HTTP2Transport> HTTP2Transport::create(
@@ -171,10 +201,13 @@ HTTP2Transport::HTTP2Transport(
         m_attachmentManager{attachmentManager},
         m_postConnectFactory{postConnectFactory},
         m_connectRetryCount{0},
-        m_isMessageHandlerAwaitingResponse{false},
         m_countOfUnfinishedMessageHandlers{0},
+        m_lastActivityMs{millisecondsNow()},
         m_postConnected{false},
         m_configuration{configuration},
+        m_maxConcurrentMessageRequests{
+            std::max(1, std::min(configuration.maxConcurrentMessageRequests, MAX_MESSAGE_HANDLERS))},
+        m_statistics{std::make_shared<TransportStatisticsRecorder>()},
         m_disconnectReason{ConnectionStatusObserverInterface::ChangedReason::NONE} {
     ACSDK_DEBUG5(LX(__func__)
                      .d("authDelegate", authDelegate.get())
@@ -183,7 +216,9 @@ HTTP2Transport::HTTP2Transport(
                      .d("messageConsumer", messageConsumer.get())
                      .d("attachmentManager", attachmentManager.get())
                      .d("transportObserver", transportObserver.get())
-                     .d("postConnectFactory", postConnectFactory.get()));
+                     .d("postConnectFactory", postConnectFactory.get())
+                     .d("pipelineMessageRequests", configuration.pipelineMessageRequests)
+                     .d("maxConcurrentMessageRequests", m_maxConcurrentMessageRequests));
     m_observers.insert(transportObserver);
 }
 
@@ -215,6 +250,10 @@ std::shared_ptr<HTTP2ConnectionInterface> HTTP2Transport::getHTTP2Connection() {
     return m_http2Connection;
 }
 
+TransportStatistics HTTP2Transport::getStatistics() const {
+    return m_statistics->getStatistics();
+}
+
 bool HTTP2Transport::connect() {
     ACSDK_DEBUG5(LX(__func__));
 
@@ -369,7 +408,6 @@ void HTTP2Transport::onDownchannelFinished() {
 
 void HTTP2Transport::onMessageRequestSent() {
     std::lock_guard<std::mutex> lock(m_mutex);
-    m_isMessageHandlerAwaitingResponse = true;
     m_countOfUnfinishedMessageHandlers++;
     ACSDK_DEBUG5(LX(__func__).d("countOfUnfinishedMessageHandlers", m_countOfUnfinishedMessageHandlers));
 }
@@ -378,15 +416,20 @@ void HTTP2Transport::onMessageRequestTimeout() {
     // If a message request times out, trigger a ping to test connectivity to AVS.
     std::lock_guard<std::mutex> lock(m_mutex);
     if (!m_pingHandler) {
-        m_timeOfLastActivity = m_timeOfLastActivity.min();
+        m_lastActivityMs = ACTIVITY_LONG_AGO;
         m_wakeEvent.notify_all();
     }
 }
 
-void HTTP2Transport::onMessageRequestAcknowledged() {
+void HTTP2Transport::onMessageRequestAcknowledged(std::shared_ptr<MessageRequest> request) {
     ACSDK_DEBUG5(LX(__func__));
     std::lock_guard<std::mutex> lock(m_mutex);
-    m_isMessageHandlerAwaitingResponse = false;
+    for (auto it = m_requestsAwaitingResponse.begin(); it != m_requestsAwaitingResponse.end(); ++it) {
+        if (it->first == request) {
+            m_requestsAwaitingResponse.erase(it);
+            break;
+        }
+    }
     m_wakeEvent.notify_all();
 }
 
@@ -418,8 +461,11 @@ void HTTP2Transport::onPingTimeout() {
 
 void HTTP2Transport::onActivity() {
     ACSDK_DEBUG5(LX(__func__));
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_timeOfLastActivity = std::chrono::steady_clock::now();
+    // Only write when the time has moved on, so that a burst of activity does not keep taking the cache line.
+    auto now = millisecondsNow();
+    if (m_lastActivityMs.load(std::memory_order_relaxed) != now) {
+        m_lastActivityMs.store(now, std::memory_order_relaxed);
+    }
 }
 
 void HTTP2Transport::onForbidden(const std::string& authToken) {
@@ -429,7 +475,24 @@ void HTTP2Transport::onForbidden(const std::string& authToken) {
 
 std::shared_ptr<HTTP2RequestInterface> HTTP2Transport::createAndSendRequest(const HTTP2RequestConfig& cfg) {
     ACSDK_DEBUG5(LX(__func__).d("type", cfg.getRequestType()).d("url", cfg.getUrl()));
-    return m_http2Connection->createAndSendRequest(cfg);
+
+    // Count what passes through the stream's source and sink.
+    HTTP2RequestConfig countedCfg{cfg};
+    auto streamStatistics = StreamStatistics::create(m_statistics, cfg.getId(), cfg.getSource(), cfg.getSink());
+    if (streamStatistics) {
+        if (cfg.getSource()) {
+            countedCfg.setRequestSource(streamStatistics);
+        }
+        if (cfg.getSink()) {
+            countedCfg.setResponseSink(streamStatistics);
+        }
+    }
+
+    auto request = m_http2Connection->createAndSendRequest(countedCfg);
+    if (request) {
+        m_statistics->onStreamOpened();
+    }
+    return request;
 }
 
 std::string HTTP2Transport::getEndpoint() {
@@ -446,7 +509,7 @@ void HTTP2Transport::mainLoop() {
         setStateLocked(State::SHUTDOWN, ConnectionStatusObserverInterface::ChangedReason::INTERNAL_ERROR);
     }
 
-    m_timeOfLastActivity = std::chrono::steady_clock::now();
+    m_lastActivityMs = millisecondsNow();
     State nextState = getState();
 
     while (nextState != State::SHUTDOWN) {
@@ -588,8 +651,8 @@ HTTP2Transport::State HTTP2Transport::handleShutdown() {
 
     {
         std::lock_guard<std::mutex> lock(m_mutex);
-        for (auto request : m_requestQueue) {
-            request->sendCompleted(MessageRequestObserverInterface::Status::NOT_CONNECTED);
+        for (auto entry : m_requestQueue) {
+            entry.first->sendCompleted(MessageRequestObserverInterface::Status::NOT_CONNECTED);
         }
         m_requestQueue.clear();
     }
@@ -607,6 +670,7 @@ void HTTP2Transport::enqueueRequest(std::shared_ptr<avsCommon::avs::MessageReque
     if (!request) {
         ACSDK_ERROR(LX("enqueueRequestFailed").d("reason", "nullRequest"));
     }
+    auto orderingKey = getOrderingKey(request);
     std::unique_lock<std::mutex> lock(m_mutex);
     bool allowed = false;
     switch (m_state) {
@@ -628,7 +692,7 @@ void HTTP2Transport::enqueueRequest(std::shared_ptr<avsCommon::avs::MessageReque
     }
 
     if (allowed) {
-        m_requestQueue.push_back(request);
+        m_requestQueue.emplace_back(request, std::move(orderingKey));
         m_wakeEvent.notify_all();
     } else {
         lock.unlock();
@@ -644,13 +708,13 @@ HTTP2Transport::State HTTP2Transport::sendMessagesAndPings(alexaClientSDK::acl::
 
     auto canSendMessage = [this] {
         return (
-            !m_isMessageHandlerAwaitingResponse && !m_requestQueue.empty() &&
-            (m_countOfUnfinishedMessageHandlers < MAX_MESSAGE_HANDLERS));
+            m_countOfUnfinishedMessageHandlers < m_maxConcurrentMessageRequests &&
+            findSendableRequestLocked() != m_requestQueue.end());
     };
 
     auto wakePredicate = [this, whileState, canSendMessage] {
         return whileState != m_state || canSendMessage() ||
-               (std::chrono::steady_clock::now() > m_timeOfLastActivity + m_configuration.inactivityTimeout);
+               std::chrono::steady_clock::now() > getPingDeadline();
     };
 
     auto pingWakePredicate = [this, whileState, canSendMessage] {
@@ -661,7 +725,7 @@ HTTP2Transport::State HTTP2Transport::sendMessagesAndPings(alexaClientSDK::acl::
         if (m_pingHandler) {
             m_wakeEvent.wait(lock, pingWakePredicate);
         } else {
-            m_wakeEvent.wait_until(lock, m_timeOfLastActivity + m_configuration.inactivityTimeout, wakePredicate);
+            m_wakeEvent.wait_until(lock, getPingDeadline(), wakePredicate);
         }
 
         if (m_state != whileState) {
@@ -669,16 +733,22 @@ HTTP2Transport::State HTTP2Transport::sendMessagesAndPings(alexaClientSDK::acl::
         }
 
         if (canSendMessage()) {
-            auto messageRequest = m_requestQueue.front();
-            m_requestQueue.pop_front();
+            auto entry = findSendableRequestLocked();
+            auto messageRequest = entry->first;
+            // Requests with the same ordering key are held until this one is acknowledged.
+            m_requestsAwaitingResponse.push_back(std::move(*entry));
+            m_requestQueue.erase(entry);
 
             lock.unlock();
 
+            bool sent = false;
             auto authToken = m_authDelegate->getAuthToken();
             if (!authToken.empty()) {
                 auto handler = MessageRequestHandler::create(
                     shared_from_this(), authToken, messageRequest, m_messageConsumer, m_attachmentManager);
-                if (!handler) {
+                if (handler) {
+                    sent = true;
+                } else {
                     messageRequest->sendCompleted(MessageRequestObserverInterface::Status::INTERNAL_ERROR);
                 }
             } else {
@@ -686,9 +756,13 @@ HTTP2Transport::State HTTP2Transport::sendMessagesAndPings(alexaClientSDK::acl::
                 messageRequest->sendCompleted(MessageRequestObserverInterface::Status::INVALID_AUTH);
             }
 
+            if (!sent) {
+                onMessageRequestAcknowledged(messageRequest);
+            }
+
             lock.lock();
 
-        } else if (std::chrono::steady_clock::now() > m_timeOfLastActivity + m_configuration.inactivityTimeout) {
+        } else if (std::chrono::steady_clock::now() > getPingDeadline()) {
             if (!m_pingHandler) {
                 lock.unlock();
 
@@ -698,7 +772,9 @@ HTTP2Transport::State HTTP2Transport::sendMessagesAndPings(alexaClientSDK::acl::
                 } else {
                     ACSDK_ERROR(LX("failedToCreatePingHandler").d("reason", "invalidAuth"));
                 }
-                if (!m_pingHandler) {
+                if (m_pingHandler) {
+                    m_statistics->onPingSent();
+                } else {
                     ACSDK_ERROR(LX("shutDown").d("reason", "failedToCreatePingHandler"));
                     setState(State::SHUTDOWN, ConnectionStatusObserverInterface::ChangedReason::PING_TIMEDOUT);
                 }
@@ -713,6 +789,59 @@ HTTP2Transport::State HTTP2Transport::sendMessagesAndPings(alexaClientSDK::acl::
     return m_state;
 }
 
+std::string HTTP2Transport::getOrderingKey(std::shared_ptr<MessageRequest> request) {
+    if (!m_configuration.pipelineMessageRequests || !request) {
+        return "";
+    }
+
+    // Look up the dialogRequestId directly, as it is absent from most events.
+    rapidjson::Document document;
+    document.Parse(request->getJsonContent().c_str());
+    if (document.HasParseError() || !document.IsObject()) {
+        return "";
+    }
+    auto event = document.FindMember(EVENT_KEY);
+    if (event == document.MemberEnd() || !event->value.IsObject()) {
+        return "";
+    }
+    auto header = event->value.FindMember(HEADER_KEY);
+    if (header == event->value.MemberEnd() || !header->value.IsObject()) {
+        return "";
+    }
+    auto dialogRequestId = header->value.FindMember(DIALOG_REQUEST_ID_KEY);
+    if (dialogRequestId == header->value.MemberEnd() || !dialogRequestId->value.IsString()) {
+        return "";
+    }
+    return dialogRequestId->value.GetString();
+}
+
+std::deque<std::pair<std::shared_ptr<MessageRequest>, std::string>>::iterator HTTP2Transport::
+    findSendableRequestLocked() {
+    auto entry = m_requestQueue.begin();
+    for (; entry != m_requestQueue.end(); ++entry) {
+        bool blocked = false;
+        for (const auto& awaiting : m_requestsAwaitingResponse) {
+            if (awaiting.second == entry->second) {
+                blocked = true;
+                break;
+            }
+        }
+        if (!blocked) {
+            break;
+        }
+    }
+    return entry;
+}
+
+std::chrono::steady_clock::time_point HTTP2Transport::getPingDeadline() const {
+    auto lastActivityMs = m_lastActivityMs.load(std::memory_order_relaxed);
+    if (ACTIVITY_LONG_AGO == lastActivityMs) {
+        return std::chrono::steady_clock::time_point::min();
+    }
+    return std::chrono::steady_clock::time_point(std::chrono::milliseconds(lastActivityMs)) +
+           m_configuration.inactivityTimeout;
+}
+
 bool HTTP2Transport::setState(State newState, ConnectionStatusObserverInterface::ChangedReason changedReason) {
     std::lock_guard<std::mutex> lock(m_mutex);
     return setStateLocked(newState, changedReason);
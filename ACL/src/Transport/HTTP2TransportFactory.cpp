@@ -33,6 +33,10 @@ static const std::string ACL_CONFIG_KEY = "acl";
 static const std::string ENDPOINT_KEY = "endpoint";
 /// Default @c AVS endpoint to connect to.
 static const std::string DEFAULT_AVS_ENDPOINT = "https://avs-alexa-na.amazon.com";
+/// Key for the 'pipelineMessageRequests' value under the @c ACL_CONFIG_KEY configuration node.
+static const std::string PIPELINE_MESSAGE_REQUESTS_KEY = "pipelineMessageRequests";
+/// Key for the 'maxConcurrentMessageRequests' value under the @c ACL_CONFIG_KEY configuration node.
+static const std::string MAX_CONCURRENT_MESSAGE_REQUESTS_KEY = "maxConcurrentMessageRequests";
 
 std::shared_ptr<TransportInterface> HTTP2TransportFactory::createTransport(
     std::shared_ptr<AuthDelegateInterface> authDelegate,
@@ -45,11 +49,20 @@ std::shared_ptr<TransportInterface> HTTP2TransportFactory::createTransport(
         return nullptr;
     }
 
+    auto aclConfig = alexaClientSDK::avsCommon::utils::configuration::ConfigurationNode::getRoot()[ACL_CONFIG_KEY];
     std::string configuredEndpoint = avsEndpoint;
     if (configuredEndpoint.empty()) {
-        alexaClientSDK::avsCommon::utils::configuration::ConfigurationNode::getRoot()[ACL_CONFIG_KEY].getString(
-            ENDPOINT_KEY, &configuredEndpoint, DEFAULT_AVS_ENDPOINT);
+        aclConfig.getString(ENDPOINT_KEY, &configuredEndpoint, DEFAULT_AVS_ENDPOINT);
     }
+
+    HTTP2Transport::Configuration configuration;
+    aclConfig.getBool(
+        PIPELINE_MESSAGE_REQUESTS_KEY, &configuration.pipelineMessageRequests, configuration.pipelineMessageRequests);
+    aclConfig.getInt(
+        MAX_CONCURRENT_MESSAGE_REQUESTS_KEY,
+        &configuration.maxConcurrentMessageRequests,
+        configuration.maxConcurrentMessageRequests);
+
     return HTTP2Transport::create(
         authDelegate,
         configuredEndpoint,
@@ -57,7 +70,8 @@ std::shared_ptr<TransportInterface> HTTP2TransportFactory::createTransport(
         messageConsumerInterface,
         attachmentManager,
         transportObserverInterface,
-        m_postConnectFactory);
+        m_postConnectFactory,
+        configuration);
 }
 
 HTTP2TransportFactory::HTTP2TransportFactory(
@@ -19,8 +19,10 @@
 
 #include <AVSCommon/Utils/HTTP2/HTTP2MimeRequestEncoder.h>
 #include <AVSCommon/Utils/HTTP2/HTTP2MimeResponseDecoder.h>
+#include <AVSCommon/Utils/JSON/JSONUtils.h>
 #include <AVSCommon/Utils/LibcurlUtils/HttpResponseCodes.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Metrics/LatencyTracer.h>
 
 #include "ACL/Transport/HTTP2Transport.h"
 #include "ACL/Transport/MimeResponseSink.h"
@@ -32,6 +34,8 @@ namespace acl {
 using namespace avsCommon::avs::attachment;
 using namespace avsCommon::sdkInterfaces;
 using namespace avsCommon::utils::http2;
+using namespace avsCommon::utils::json;
+using namespace avsCommon::utils::metrics;
 
 /// URL to send events to
 const static std::string AVS_EVENT_URL_PATH_EXTENSION = "/v20160207/events";
@@ -59,6 +63,18 @@ static const std::string ATTACHMENT_CONTENT_TYPE = "Content-Type: application/oc
 /// Prefix for the ID of message requests.
 static const std::string MESSAGEREQUEST_ID_PREFIX = "AVSEvent-";
 
+/// JSON key of the event in a message request.
+static const std::string JSON_EVENT_KEY = "event";
+
+/// JSON key of the header of an event.
+static const std::string JSON_HEADER_KEY = "header";
+
+/// JSON key of the messageId in an event header.
+static const std::string JSON_MESSAGE_ID_KEY = "messageId";
+
+/// JSON key of the dialogRequestId in an event header.
+static const std::string JSON_DIALOG_REQUEST_ID_KEY = "dialogRequestId";
+
 /// String to identify log entries originating from this file.
 static const std::string TAG("MessageRequestHandler");
 
@@ -69,6 +85,32 @@ static const std::string TAG("MessageRequestHandler");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+/**
+ * Gets the id with which @c LatencyTracer events for a message request are recorded.  This matches the id used by
+ * @c Metrics::trace() for the same event, so that the request's trace events can be joined.
+ *
+ * @param json The JSON content of the message request.
+ * @return The hashed dialogRequestId of the event if it has one, otherwise its hashed messageId, or zero if neither
+ *     can be found or tracing is disabled.
+ */
+static uint64_t getTraceId(const std::string& json) {
+    if (!LatencyTracer::isEnabled()) {
+        return 0;
+    }
+    rapidjson::Document document;
+    rapidjson::Value::ConstMemberIterator event;
+    rapidjson::Value::ConstMemberIterator header;
+    if (!jsonUtils::parseJSON(json, &document) || !jsonUtils::findNode(document, JSON_EVENT_KEY, &event) ||
+        !jsonUtils::findNode(event->value, JSON_HEADER_KEY, &header)) {
+        return 0;
+    }
+    std::string id;
+    if (!jsonUtils::retrieveValue(header->value, JSON_DIALOG_REQUEST_ID_KEY, &id) || id.empty()) {
+        jsonUtils::retrieveValue(header->value, JSON_MESSAGE_ID_KEY, &id);
+    }
+    return LatencyTracer::hashId(id);
+}
+
 MessageRequestHandler::~MessageRequestHandler() {
     reportMessageRequestAcknowledged();
     reportMessageRequestFinished();
@@ -103,10 +145,11 @@ std::shared_ptr<MessageRequestHandler> MessageRequestHandler::create(
         url += messageRequest->getUriPathExtension();
     }
 
+    auto traceId = getTraceId(handler->m_json);
     HTTP2RequestConfig cfg{HTTP2RequestType::POST, url, MESSAGEREQUEST_ID_PREFIX};
     cfg.setRequestSource(std::make_shared<HTTP2MimeRequestEncoder>(MIME_BOUNDARY, handler));
     cfg.setResponseSink(std::make_shared<HTTP2MimeResponseDecoder>(
-        std::make_shared<MimeResponseSink>(handler, messageConsumer, attachmentManager, cfg.getId())));
+        std::make_shared<MimeResponseSink>(handler, messageConsumer, attachmentManager, cfg.getId(), traceId)));
     cfg.setActivityTimeout(STREAM_PROGRESS_TIMEOUT);
 
     context->onMessageRequestSent();
@@ -118,6 +161,8 @@ std::shared_ptr<MessageRequestHandler> MessageRequestHandler::create(
         ACSDK_ERROR(LX("MessageRequestHandlerCreateFailed").d("reason", "createAndSendRequestFailed"));
         return nullptr;
     }
+    handler->setRequest(request);
+    LatencyTracer::record(TracePoint::MESSAGE_STREAM_OPENED, traceId);
 
     return handler;
 }
@@ -142,7 +187,7 @@ void MessageRequestHandler::reportMessageRequestAcknowledged() {
     ACSDK_DEBUG5(LX(__func__));
     if (!m_wasMessageRequestAcknowledgeReported) {
         m_wasMessageRequestAcknowledgeReported = true;
-        m_context->onMessageRequestAcknowledged();
+        m_context->onMessageRequestAcknowledged(m_messageRequest);
     }
 }
 
@@ -172,6 +217,13 @@ HTTP2GetMimeHeadersResult MessageRequestHandler::getMimePartHeaderLines() {
     } else if (static_cast<int>(m_countOfPartsSent) <= m_messageRequest->attachmentReadersCount()) {
         m_namedReader = m_messageRequest->getAttachmentReader(m_countOfPartsSent - 1);
         if (m_namedReader) {
+            // Resume sending as soon as the attachment has data again, rather than waiting to be retried.
+            std::weak_ptr<MessageRequestHandler> weakThis = shared_from_this();
+            m_namedReader->reader->setDataAvailableCallback([weakThis] {
+                if (auto handler = weakThis.lock()) {
+                    handler->resumeRequest();
+                }
+            });
             return HTTP2GetMimeHeadersResult(
                 {CONTENT_DISPOSITION_PREFIX + m_namedReader->name + CONTENT_DISPOSITION_SUFFIX,
                  ATTACHMENT_CONTENT_TYPE});
@@ -216,6 +268,7 @@ HTTP2SendDataResult MessageRequestHandler::onSendMimePartData(char* bytes, size_
 
             case AttachmentReader::ReadStatus::CLOSED:
                 // Stream consumed.  Move on to next part.
+                m_namedReader->reader->setDataAvailableCallback(nullptr);
                 m_namedReader.reset();
                 m_countOfPartsSent++;
                 return HTTP2SendDataResult::COMPLETE;
@@ -254,6 +307,10 @@ bool MessageRequestHandler::onReceiveResponseCode(long responseCode) {
     return true;
 }
 
+void MessageRequestHandler::onReadyToReceiveData() {
+    resumeRequest();
+}
+
 void MessageRequestHandler::onResponseFinished(HTTP2ResponseFinishedStatus status, const std::string& nonMimeBody) {
     ACSDK_DEBUG5(LX(__func__).d("status", status).d("responseCode", m_responseCode));
 
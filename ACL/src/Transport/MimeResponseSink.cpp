@@ -14,6 +14,7 @@
  */
 
 #include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Metrics/LatencyTracer.h>
 
 #include "ACL/Transport/MimeResponseSink.h"
 
@@ -22,6 +23,7 @@ namespace acl {
 
 using namespace avsCommon::avs::attachment;
 using namespace avsCommon::utils::http2;
+using namespace avsCommon::utils::metrics;
 
 #ifdef DEBUG
 /// Carriage return
@@ -83,16 +85,19 @@ MimeResponseSink::MimeResponseSink(
     std::shared_ptr<MimeResponseStatusHandlerInterface> handler,
     std::shared_ptr<MessageConsumerInterface> messageConsumer,
     std::shared_ptr<avsCommon::avs::attachment::AttachmentManager> attachmentManager,
-    std::string attachmentContextId) :
+    std::string attachmentContextId,
+    uint64_t traceId) :
         m_handler{handler},
         m_messageConsumer{messageConsumer},
         m_attachmentManager{attachmentManager},
-        m_attachmentContextId{std::move(attachmentContextId)} {
+        m_attachmentContextId{std::move(attachmentContextId)},
+        m_traceId{traceId} {
     ACSDK_DEBUG5(LX(__func__).d("handler", handler.get()));
 }
 
 bool MimeResponseSink::onReceiveResponseCode(long responseCode) {
     ACSDK_DEBUG5(LX(__func__).d("responseCode", responseCode));
+    LatencyTracer::record(TracePoint::FIRST_RESPONSE_BYTE, m_traceId);
 
     if (m_handler) {
         m_handler->onActivity();
@@ -119,6 +124,7 @@ bool MimeResponseSink::onReceiveHeaderLine(const std::string& line) {
 
 bool MimeResponseSink::onBeginMimePart(const std::multimap<std::string, std::string>& headers) {
     ACSDK_DEBUG5(LX(__func__));
+    LatencyTracer::record(TracePoint::MIME_PART_BEGIN, m_traceId);
 
     if (m_handler) {
         m_handler->onActivity();
@@ -147,6 +153,13 @@ bool MimeResponseSink::onBeginMimePart(const std::multimap<std::string, std::str
                     LX("onBeginMimePartFailed").d("reason", "createWriterFailed").d("attachmentId", attachmentId));
                 return false;
             }
+            // Resume receiving as soon as the attachment has space again, rather than waiting to be retried.
+            std::weak_ptr<MimeResponseStatusHandlerInterface> weakHandler = m_handler;
+            m_attachmentWriter->setSpaceAvailableCallback([weakHandler] {
+                if (auto handler = weakHandler.lock()) {
+                    handler->onReadyToReceiveData();
+                }
+            });
             ACSDK_DEBUG9(LX("attachmentContentDetected").d("contentId", contentId));
         }
         m_contentType = ContentType::ATTACHMENT;
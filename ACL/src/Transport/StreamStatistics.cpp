@@ -0,0 +1,125 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+#include "ACL/Transport/StreamStatistics.h"
+
+namespace alexaClientSDK {
+namespace acl {
+
+using namespace avsCommon::utils::http2;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("StreamStatistics");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+std::shared_ptr<StreamStatistics> StreamStatistics::create(
+    std::shared_ptr<TransportStatisticsRecorder> recorder,
+    const std::string& streamId,
+    std::shared_ptr<HTTP2RequestSourceInterface> source,
+    std::shared_ptr<HTTP2ResponseSinkInterface> sink) {
+    if (!recorder) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullRecorder"));
+        return nullptr;
+    }
+    return std::shared_ptr<StreamStatistics>(
+        new StreamStatistics(std::move(recorder), streamId, std::move(source), std::move(sink)));
+}
+
+StreamStatistics::StreamStatistics(
+    std::shared_ptr<TransportStatisticsRecorder> recorder,
+    const std::string& streamId,
+    std::shared_ptr<HTTP2RequestSourceInterface> source,
+    std::shared_ptr<HTTP2ResponseSinkInterface> sink) :
+        m_recorder{std::move(recorder)},
+        m_streamId{streamId},
+        m_source{std::move(source)},
+        m_sink{std::move(sink)},
+        m_openTime{std::chrono::steady_clock::now()},
+        m_firstByteReceived{false},
+        m_bytesSent{0},
+        m_chunksSent{0},
+        m_bytesReceived{0},
+        m_chunksReceived{0} {
+}
+
+std::vector<std::string> StreamStatistics::getRequestHeaderLines() {
+    if (!m_source) {
+        return {};
+    }
+    return m_source->getRequestHeaderLines();
+}
+
+HTTP2SendDataResult StreamStatistics::onSendData(char* bytes, size_t size) {
+    if (!m_source) {
+        return HTTP2SendDataResult::COMPLETE;
+    }
+    auto result = m_source->onSendData(bytes, size);
+    if (result.size > 0) {
+        m_bytesSent += result.size;
+        m_chunksSent++;
+        m_recorder->onDataSent(result.size);
+    }
+    return result;
+}
+
+bool StreamStatistics::onReceiveResponseCode(long responseCode) {
+    if (!m_firstByteReceived) {
+        m_firstByteReceived = true;
+        m_recorder->onFirstByteReceived(std::chrono::steady_clock::now() - m_openTime);
+    }
+    return m_sink && m_sink->onReceiveResponseCode(responseCode);
+}
+
+bool StreamStatistics::onReceiveHeaderLine(const std::string& line) {
+    return m_sink && m_sink->onReceiveHeaderLine(line);
+}
+
+HTTP2ReceiveDataStatus StreamStatistics::onReceiveData(const char* bytes, size_t size) {
+    if (!m_sink) {
+        return HTTP2ReceiveDataStatus::ABORT;
+    }
+    auto status = m_sink->onReceiveData(bytes, size);
+    // Paused data is delivered again, so it is counted then.
+    if (HTTP2ReceiveDataStatus::SUCCESS == status) {
+        m_bytesReceived += size;
+        m_chunksReceived++;
+        m_recorder->onDataReceived(size);
+    }
+    return status;
+}
+
+void StreamStatistics::onResponseFinished(HTTP2ResponseFinishedStatus status) {
+    ACSDK_DEBUG5(LX(__func__)
+                     .d("streamId", m_streamId)
+                     .d("status", status)
+                     .d("bytesSent", m_bytesSent)
+                     .d("chunksSent", m_chunksSent)
+                     .d("bytesReceived", m_bytesReceived)
+                     .d("chunksReceived", m_chunksReceived));
+    if (m_sink) {
+        m_sink->onResponseFinished(status);
+    }
+}
+
+}  // namespace acl
+}  // namespace alexaClientSDK
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "ACL/Transport/TransportStatistics.h"
+
+namespace alexaClientSDK {
+namespace acl {
+
+TransportStatistics::TransportStatistics() :
+        bytesSent{0},
+        chunksSent{0},
+        bytesReceived{0},
+        chunksReceived{0},
+        streamsOpened{0},
+        pingsSent{0},
+        responsesReceived{0},
+        averageTimeToFirstByte{0} {
+}
+
+TransportStatisticsRecorder::TransportStatisticsRecorder() :
+        m_bytesSent{0},
+        m_chunksSent{0},
+        m_bytesReceived{0},
+        m_chunksReceived{0},
+        m_streamsOpened{0},
+        m_pingsSent{0},
+        m_responsesReceived{0},
+        m_totalTimeToFirstByte{0} {
+}
+
+void TransportStatisticsRecorder::onStreamOpened() {
+    m_streamsOpened.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TransportStatisticsRecorder::onPingSent() {
+    m_pingsSent.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TransportStatisticsRecorder::onDataSent(size_t size) {
+    m_bytesSent.fetch_add(size, std::memory_order_relaxed);
+    m_chunksSent.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TransportStatisticsRecorder::onDataReceived(size_t size) {
+    m_bytesReceived.fetch_add(size, std::memory_order_relaxed);
+    m_chunksReceived.fetch_add(1, std::memory_order_relaxed);
+}
+
+void TransportStatisticsRecorder::onFirstByteReceived(std::chrono::steady_clock::duration timeToFirstByte) {
+    m_totalTimeToFirstByte.fetch_add(
+        std::chrono::duration_cast<std::chrono::microseconds>(timeToFirstByte).count(), std::memory_order_relaxed);
+    m_responsesReceived.fetch_add(1, std::memory_order_relaxed);
+}
+
+TransportStatistics TransportStatisticsRecorder::getStatistics() const {
+    TransportStatistics statistics;
+    statistics.bytesSent = m_bytesSent.load(std::memory_order_relaxed);
+    statistics.chunksSent = m_chunksSent.load(std::memory_order_relaxed);
+    statistics.bytesReceived = m_bytesReceived.load(std::memory_order_relaxed);
+    statistics.chunksReceived = m_chunksReceived.load(std::memory_order_relaxed);
+    statistics.streamsOpened = m_streamsOpened.load(std::memory_order_relaxed);
+    statistics.pingsSent = m_pingsSent.load(std::memory_order_relaxed);
+    statistics.responsesReceived = m_responsesReceived.load(std::memory_order_relaxed);
+    if (statistics.responsesReceived > 0) {
+        statistics.averageTimeToFirstByte = std::chrono::microseconds(
+            m_totalTimeToFirstByte.load(std::memory_order_relaxed) / statistics.responsesReceived);
+    }
+    return statistics;
+}
+
+}  // namespace acl
+}  // namespace alexaClientSDK
@@ -13,10 +13,13 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+#include <atomic>
 #include <future>
 #include <iterator>
 #include <memory>
 #include <sstream>
+#include <thread>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -30,6 +33,7 @@
 #include <AVSCommon/Utils/PromiseFuturePair.h>
 #include <AVSCommon/Utils/HTTP2/HTTP2RequestConfig.h>
 #include <AVSCommon/Utils/LibcurlUtils/HttpResponseCodes.h>
+#include <AVSCommon/Utils/Metrics/LatencyTracer.h>
 
 #include "MockAuthDelegate.h"
 #include "MockHTTP2Connection.h"
@@ -51,6 +55,7 @@ using namespace avsCommon::sdkInterfaces;
 using namespace avsCommon::utils;
 using namespace avsCommon::utils::http2;
 using namespace avsCommon::utils::http2::test;
+using namespace avsCommon::utils::metrics;
 using namespace ::testing;
 
 /// Test endpoint.
@@ -129,6 +134,21 @@ static const std::string MIME_BODY_DIRECTIVE1 = "--" + MIME_BOUNDARY + "\r\nCont
 static const std::string MIME_BODY_DIRECTIVE2 = "--" + MIME_BOUNDARY + "\r\nContent-Type: application/json" +
                                                 "\r\n\r\n" + DIRECTIVE2 + "\r\n--" + MIME_BOUNDARY + "\r\n";
 
+// Content-ID of the attachment in MIME_BODY_ATTACHMENT_HEADER.
+static const std::string TEST_CONTENT_ID = "testContentId";
+
+// MIME encoded DIRECTIVE1, followed by the start of an attachment part without its data.
+static const std::string MIME_BODY_ATTACHMENT_HEADER = "--" + MIME_BOUNDARY + "\r\nContent-Type: application/json" +
+                                                       "\r\n\r\n" + DIRECTIVE1 + "\r\n--" + MIME_BOUNDARY +
+                                                       "\r\nContent-ID: <" + TEST_CONTENT_ID + ">" +
+                                                       "\r\nContent-Type: application/octet-stream\r\n\r\n";
+
+// The size of each chunk of attachment data received in tests.
+static const size_t ATTACHMENT_CHUNK_SIZE = 0x4000;
+
+// The maximum number of chunks received before the attachment is expected to fill up.
+static const size_t MAX_ATTACHMENT_CHUNKS = 0x100;
+
 // HTTP header to specify MIME boundary and content type.
 static const std::string HTTP_BOUNDARY_HEADER =
     "Content-Type: multipart/related; boundary=" + MIME_BOUNDARY + "; type=application/json";
@@ -145,6 +165,30 @@ static const unsigned MAX_AVS_STREAMS = 10;
 // Maximum allowed of POST streams
 static const unsigned MAX_POST_STREAMS = MAX_AVS_STREAMS - MAX_DOWNCHANNEL_STREAMS - MAX_PING_STREAMS;
 
+/// A dialogRequestId for events in the pipelining tests.
+static const std::string DIALOG_REQUEST_ID = "4ee4b3b7-9e7c-4b1a-9d2e-59e2c0b3e2a1";
+
+/// Number of independent events sent behind a slow @c Recognize in the latency benchmarks.
+static const unsigned BENCHMARK_EVENT_COUNT = 5;
+
+/// How long the server takes to acknowledge the @c Recognize in the latency benchmarks.
+static const auto SLOW_RESPONSE_DELAY = std::chrono::milliseconds(300);
+
+/**
+ * Build the JSON content of an event.
+ *
+ * @param name The name of the event.
+ * @param dialogRequestId The dialogRequestId of the event, or an empty string for none.
+ * @return The JSON content of the event.
+ */
+static std::string buildEvent(const std::string& name, const std::string& dialogRequestId = "") {
+    std::string json = "{\"event\":{\"header\":{\"namespace\":\"Test\",\"name\":\"" + name + "\"";
+    if (!dialogRequestId.empty()) {
+        json += ",\"dialogRequestId\":\"" + dialogRequestId + "\"";
+    }
+    return json + "},\"payload\":{}}}";
+}
+
 /// Test harness for @c HTTP2Transport class.
 class HTTP2TransportTest : public Test {
 public:
@@ -177,6 +221,22 @@ protected:
      */
     void authorizeAndConnect();
 
+    /**
+     * Helper function to replace @c m_http2Transport with one created with the given configuration.
+     *
+     * @param configuration The configuration for the new @c HTTP2Transport.
+     */
+    void createTransport(const HTTP2Transport::Configuration& configuration);
+
+    /**
+     * Helper function to measure how long events take to be sent and completed when queued behind a @c Recognize
+     * which AVS is slow to acknowledge.
+     *
+     * @param pipelineMessageRequests Whether the @c HTTP2Transport pipelines message requests.
+     * @return The mean time from sending each event until it completed.
+     */
+    std::chrono::microseconds measureEventLatencyBehindSlowRecognize(bool pipelineMessageRequests);
+
     /// The HTTP2Transport instance to be tested.
     std::shared_ptr<HTTP2Transport> m_http2Transport;
 
@@ -351,6 +411,85 @@ void HTTP2TransportTest::authorizeAndConnect() {
     ASSERT_TRUE(m_transportConnected.waitFor(LONG_RESPONSE_TIMEOUT));
 }
 
+void HTTP2TransportTest::createTransport(const HTTP2Transport::Configuration& configuration) {
+    m_http2Transport = HTTP2Transport::create(
+        m_mockAuthDelegate,
+        TEST_AVS_ENDPOINT_STRING,
+        m_mockHttp2Connection,
+        m_mockMessageConsumer,
+        m_attachmentManager,
+        m_mockTransportObserver,
+        m_mockPostConnectFactory,
+        configuration);
+    ASSERT_NE(m_http2Transport, nullptr);
+}
+
+/**
+ * A @c MessageRequestObserverInterface which records when its request completed.
+ */
+class TimingMessageRequestObserver : public avsCommon::sdkInterfaces::MessageRequestObserverInterface {
+public:
+    void onSendCompleted(MessageRequestObserverInterface::Status status) override {
+        m_completed.setValue(std::chrono::steady_clock::now());
+    }
+
+    void onExceptionReceived(const std::string& exceptionMessage) override {
+    }
+
+    /// A promise of the time at which @c MessageRequestObserverInterface::onSendCompleted() was called.
+    PromiseFuturePair<std::chrono::steady_clock::time_point> m_completed;
+};
+
+std::chrono::microseconds HTTP2TransportTest::measureEventLatencyBehindSlowRecognize(bool pipelineMessageRequests) {
+    HTTP2Transport::Configuration cfg;
+    cfg.pipelineMessageRequests = pipelineMessageRequests;
+    createTransport(cfg);
+    authorizeAndConnect();
+
+    // The server is slow to acknowledge the Recognize (the first request) and acknowledges other events immediately.
+    std::thread recognizeResponder;
+    std::thread server([this, &recognizeResponder] {
+        for (unsigned count = 0; count < BENCHMARK_EVENT_COUNT + 1; ++count) {
+            auto request = m_mockHttp2Connection->dequePostRequest(LONG_RESPONSE_TIMEOUT);
+            if (!request) {
+                return;
+            }
+            if (0 == count) {
+                recognizeResponder = std::thread([request] {
+                    std::this_thread::sleep_for(SLOW_RESPONSE_DELAY);
+                    request->getSink()->onReceiveResponseCode(HTTPResponseCode::SUCCESS_NO_CONTENT);
+                    request->getSink()->onResponseFinished(HTTP2ResponseFinishedStatus::COMPLETE);
+                });
+            } else {
+                request->getSink()->onReceiveResponseCode(HTTPResponseCode::SUCCESS_NO_CONTENT);
+                request->getSink()->onResponseFinished(HTTP2ResponseFinishedStatus::COMPLETE);
+            }
+        }
+    });
+
+    m_http2Transport->send(std::make_shared<MessageRequest>(buildEvent("Recognize", DIALOG_REQUEST_ID), ""));
+    std::vector<std::shared_ptr<TimingMessageRequestObserver>> observers;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < BENCHMARK_EVENT_COUNT; ++i) {
+        auto request = std::make_shared<MessageRequest>(buildEvent("PlaybackStarted"), "");
+        auto observer = std::make_shared<TimingMessageRequestObserver>();
+        request->addObserver(observer);
+        observers.push_back(observer);
+        m_http2Transport->send(request);
+    }
+
+    std::chrono::microseconds total{0};
+    for (auto& observer : observers) {
+        EXPECT_TRUE(observer->m_completed.waitFor(LONG_RESPONSE_TIMEOUT));
+        total += std::chrono::duration_cast<std::chrono::microseconds>(observer->m_completed.getValue() - start);
+    }
+    server.join();
+    if (recognizeResponder.joinable()) {
+        recognizeResponder.join();
+    }
+    return total / BENCHMARK_EVENT_COUNT;
+}
+
 /**
  * Test non-authorization on empty auth token.
  */
@@ -635,6 +774,112 @@ TEST_F(HTTP2TransportTest, pauseSendWhenSDSEmpty) {
     writerThread.join();
 }
 
+/**
+ * Test that a message paused because its attachment is empty is resumed as soon as data is written to the attachment,
+ * rather than waiting to be retried.
+ */
+TEST_F(HTTP2TransportTest, resumeSendWhenSDSWritten) {
+    authorizeAndConnect();
+
+    // Send a message with an attachment which has no data yet.
+    std::shared_ptr<MessageRequest> messageReq = std::make_shared<MessageRequest>(TEST_MESSAGE, "");
+    AttachmentManager attMgr(AttachmentManager::AttachmentType::IN_PROCESS);
+    std::shared_ptr<AttachmentReader> attachmentReader =
+        attMgr.createReader(TEST_ATTACHMENT_ID_STRING_ONE, avsCommon::utils::sds::ReaderPolicy::NONBLOCKING);
+    ASSERT_NE(attachmentReader, nullptr);
+    auto writer = attMgr.createWriter(TEST_ATTACHMENT_ID_STRING_ONE);
+    ASSERT_NE(writer, nullptr);
+    messageReq->addAttachmentReader(TEST_ATTACHMENT_FIELD, attachmentReader);
+    m_http2Transport->send(messageReq);
+
+    // Take the request without letting the mock connection send it.
+    std::shared_ptr<MockHTTP2Request> postRequest;
+    auto deadline = std::chrono::steady_clock::now() + RESPONSE_TIMEOUT;
+    while (!(postRequest = m_mockHttp2Connection->dequePostRequest()) && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(TEN_MILLISECOND_DELAY);
+    }
+    ASSERT_NE(postRequest, nullptr);
+
+    std::atomic<int> resumeCount{0};
+    PromiseFuturePair<void> resumed;
+    EXPECT_CALL(*postRequest, resume()).WillRepeatedly(Invoke([&resumeCount, &resumed] {
+        if (1 == ++resumeCount) {
+            resumed.setValue();
+        }
+    }));
+
+    // Send until the request pauses for want of attachment data.
+    std::vector<char> buf(ATTACHMENT_CHUNK_SIZE);
+    auto result = HTTP2SendDataResult::COMPLETE;
+    for (int i = 0; i < 10 && result.status != HTTP2SendStatus::PAUSE; ++i) {
+        result = postRequest->getSource()->onSendData(buf.data(), buf.size());
+    }
+    ASSERT_EQ(result.status, HTTP2SendStatus::PAUSE);
+    EXPECT_EQ(resumeCount, 0);
+
+    // Verify that writing to the attachment resumes the request, and that the data can then be sent.
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    writer->write(TEST_ATTACHMENT_MESSAGE.data(), TEST_ATTACHMENT_MESSAGE.size(), &writeStatus);
+    ASSERT_EQ(writeStatus, AttachmentWriter::WriteStatus::OK);
+    ASSERT_TRUE(resumed.waitFor(RESPONSE_TIMEOUT));
+    result = postRequest->getSource()->onSendData(buf.data(), buf.size());
+    ASSERT_EQ(result.status, HTTP2SendStatus::CONTINUE);
+    ASSERT_EQ(result.size, TEST_ATTACHMENT_MESSAGE.size());
+    writer->close();
+}
+
+/**
+ * Test that a response paused because its attachment is full is resumed as soon as data is read from the attachment,
+ * rather than waiting to be retried.
+ */
+TEST_F(HTTP2TransportTest, resumeReceiveWhenAttachmentRead) {
+    authorizeAndConnect();
+
+    // Capture the context of the directive, which the attachment ID is generated from.
+    PromiseFuturePair<std::string> directiveContextId;
+    EXPECT_CALL(*m_mockMessageConsumer, consumeMessage(_, _))
+        .WillOnce(Invoke([&directiveContextId](const std::string& contextId, const std::string& message) {
+            directiveContextId.setValue(contextId);
+        }));
+
+    // Send a message.
+    std::shared_ptr<MessageRequest> messageReq = std::make_shared<MessageRequest>(TEST_MESSAGE, "");
+    m_http2Transport->send(messageReq);
+    auto eventStream = m_mockHttp2Connection->waitForPostRequest(RESPONSE_TIMEOUT);
+    ASSERT_NE(eventStream, nullptr);
+
+    std::atomic<int> resumeCount{0};
+    PromiseFuturePair<void> resumed;
+    EXPECT_CALL(*eventStream, resume()).WillRepeatedly(Invoke([&resumeCount, &resumed] {
+        if (1 == ++resumeCount) {
+            resumed.setValue();
+        }
+    }));
+
+    // Receive a directive and attachment data until the attachment is full.
+    eventStream->getSink()->onReceiveResponseCode(HTTPResponseCode::SUCCESS_OK);
+    eventStream->getSink()->onReceiveHeaderLine(HTTP_BOUNDARY_HEADER);
+    ASSERT_EQ(
+        eventStream->getSink()->onReceiveData(MIME_BODY_ATTACHMENT_HEADER.c_str(), MIME_BODY_ATTACHMENT_HEADER.size()),
+        HTTP2ReceiveDataStatus::SUCCESS);
+    std::vector<char> chunk(ATTACHMENT_CHUNK_SIZE, 'a');
+    auto status = HTTP2ReceiveDataStatus::SUCCESS;
+    for (size_t i = 0; i < MAX_ATTACHMENT_CHUNKS && HTTP2ReceiveDataStatus::SUCCESS == status; ++i) {
+        status = eventStream->getSink()->onReceiveData(chunk.data(), chunk.size());
+    }
+    ASSERT_EQ(status, HTTP2ReceiveDataStatus::PAUSE);
+    EXPECT_EQ(resumeCount, 0);
+
+    // Verify that reading from the attachment resumes the response.
+    ASSERT_TRUE(directiveContextId.waitFor(RESPONSE_TIMEOUT));
+    auto attachmentId = m_attachmentManager->generateAttachmentId(directiveContextId.getValue(), TEST_CONTENT_ID);
+    auto reader = m_attachmentManager->createReader(attachmentId, avsCommon::utils::sds::ReaderPolicy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+    auto readStatus = AttachmentReader::ReadStatus::OK;
+    ASSERT_EQ(reader->read(chunk.data(), chunk.size(), &readStatus), chunk.size());
+    ASSERT_TRUE(resumed.waitFor(RESPONSE_TIMEOUT));
+}
+
 /**
  * Test queuing MessageRequests until a response code has been received for any outstanding MessageRequest
  */
@@ -893,6 +1138,45 @@ TEST_F(HTTP2TransportTest, messageConsumerReceiveDirective) {
     ASSERT_EQ(messages[1], DIRECTIVE2);
 }
 
+/**
+ * Test that the trace events for a message request and its response are all recorded with the event's
+ * dialogRequestId, so that they can be joined.
+ */
+TEST_F(HTTP2TransportTest, traceEventsUseDialogRequestId) {
+    authorizeAndConnect();
+    LatencyTracer::clear();
+
+    m_http2Transport->send(std::make_shared<MessageRequest>(buildEvent("Recognize", DIALOG_REQUEST_ID), ""));
+    auto eventStream = m_mockHttp2Connection->waitForPostRequest(RESPONSE_TIMEOUT);
+    ASSERT_NE(eventStream, nullptr);
+    eventStream->getSink()->onReceiveResponseCode(HTTPResponseCode::SUCCESS_OK);
+    eventStream->getSink()->onReceiveHeaderLine(HTTP_BOUNDARY_HEADER);
+    eventStream->getSink()->onReceiveData(MIME_BODY_DIRECTIVE1.c_str(), MIME_BODY_DIRECTIVE1.size());
+    eventStream->getSink()->onResponseFinished(HTTP2ResponseFinishedStatus::COMPLETE);
+
+    // MESSAGE_STREAM_OPENED is recorded on the transport's thread once the request has been sent.
+    const std::vector<TracePoint> expectedPoints = {
+        TracePoint::MESSAGE_STREAM_OPENED, TracePoint::FIRST_RESPONSE_BYTE, TracePoint::MIME_PART_BEGIN};
+    auto traceId = LatencyTracer::hashId(DIALOG_REQUEST_ID);
+    auto deadline = std::chrono::steady_clock::now() + RESPONSE_TIMEOUT;
+    std::vector<TracePoint> points;
+    while (true) {
+        points.clear();
+        for (const auto& event : LatencyTracer::snapshot()) {
+            if (event.id == traceId) {
+                points.push_back(event.point);
+            }
+        }
+        if (points.size() >= expectedPoints.size() || std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+        std::this_thread::yield();
+    }
+    for (auto point : expectedPoints) {
+        EXPECT_NE(std::find(points.begin(), points.end(), point), points.end()) << tracePointToString(point);
+    }
+}
+
 /**
  * Test broadcast onServerSideDisconnect() upon closure of successfully opened downchannel.
  */
@@ -1135,6 +1419,199 @@ TEST_F(HTTP2TransportTest, avsStreamsLimit) {
     ASSERT_EQ(m_mockHttp2Connection->getMaxPostRequestsEnqueud(), MAX_POST_STREAMS);
 }
 
+/**
+ * Test that with pipelining enabled, events are not held back by an unacknowledged request with a different
+ * dialogRequestId, while requests with the same dialogRequestId (or without one) are still sent one at a time.
+ */
+TEST_F(HTTP2TransportTest, pipelinedMessageRequestsOrderedByDialogRequestId) {
+    HTTP2Transport::Configuration cfg;
+    cfg.pipelineMessageRequests = true;
+    createTransport(cfg);
+    authorizeAndConnect();
+
+    m_http2Transport->send(std::make_shared<MessageRequest>(buildEvent("Recognize", DIALOG_REQUEST_ID), ""));
+    m_http2Transport->send(std::make_shared<MessageRequest>(buildEvent("ExpectSpeechTimedOut", DIALOG_REQUEST_ID), ""));
+    m_http2Transport->send(std::make_shared<MessageRequest>(buildEvent("SpeechStarted"), ""));
+    m_http2Transport->send(std::make_shared<MessageRequest>(buildEvent("SpeechFinished"), ""));
+
+    // Give m_http2Transport a chance to misbehave and send more requests than it should.
+    std::this_thread::sleep_for(SHORT_DELAY);
+
+    // Only the Recognize and SpeechStarted have been sent.
+    ASSERT_EQ(m_mockHttp2Connection->getPostRequestsNum(), 2u);
+    auto recognize = m_mockHttp2Connection->dequePostRequest();
+    auto speechStarted = m_mockHttp2Connection->dequePostRequest();
+    ASSERT_NE(recognize, nullptr);
+    ASSERT_NE(speechStarted, nullptr);
+
+    // Acknowledging SpeechStarted releases SpeechFinished, but not the request waiting for the Recognize.
+    speechStarted->getSink()->onReceiveResponseCode(HTTPResponseCode::SUCCESS_NO_CONTENT);
+    auto speechFinished = m_mockHttp2Connection->dequePostRequest(RESPONSE_TIMEOUT);
+    ASSERT_NE(speechFinished, nullptr);
+    std::this_thread::sleep_for(ONE_HUNDRED_MILLISECOND_DELAY);
+    ASSERT_EQ(m_mockHttp2Connection->getPostRequestsNum(), 0u);
+
+    // Acknowledging the Recognize releases the other request with its dialogRequestId.
+    recognize->getSink()->onReceiveResponseCode(HTTPResponseCode::SUCCESS_NO_CONTENT);
+    auto expectSpeechTimedOut = m_mockHttp2Connection->dequePostRequest(RESPONSE_TIMEOUT);
+    ASSERT_NE(expectSpeechTimedOut, nullptr);
+
+    for (auto request : {recognize, speechStarted, speechFinished, expectSpeechTimedOut}) {
+        request->getSink()->onResponseFinished(HTTP2ResponseFinishedStatus::COMPLETE);
+    }
+}
+
+/**
+ * Test that the number of message requests in flight is limited by @c maxConcurrentMessageRequests.
+ */
+TEST_F(HTTP2TransportTest, pipelinedMessageRequestsLimitedByStreamBudget) {
+    static const int maxConcurrentMessageRequests = 2;
+    static const unsigned messagesCount = 4;
+
+    HTTP2Transport::Configuration cfg;
+    cfg.pipelineMessageRequests = true;
+    cfg.maxConcurrentMessageRequests = maxConcurrentMessageRequests;
+    createTransport(cfg);
+    authorizeAndConnect();
+
+    // Each request has its own dialogRequestId, so only the stream budget holds them back.
+    for (unsigned messageNum = 0; messageNum < messagesCount; messageNum++) {
+        auto event = buildEvent("Recognize", DIALOG_REQUEST_ID + std::to_string(messageNum));
+        m_http2Transport->send(std::make_shared<MessageRequest>(event, ""));
+    }
+
+    std::this_thread::sleep_for(SHORT_DELAY);
+    ASSERT_EQ(m_mockHttp2Connection->getPostRequestsNum(), static_cast<size_t>(maxConcurrentMessageRequests));
+
+    unsigned completed = 0;
+    std::shared_ptr<MockHTTP2Request> request;
+    while (completed < messagesCount &&
+           (request = m_mockHttp2Connection->dequePostRequest(RESPONSE_TIMEOUT)) != nullptr) {
+        request->getSink()->onResponseFinished(HTTP2ResponseFinishedStatus::COMPLETE);
+        completed++;
+        std::this_thread::sleep_for(TEN_MILLISECOND_DELAY);
+    }
+    ASSERT_EQ(completed, messagesCount);
+    ASSERT_EQ(m_mockHttp2Connection->getMaxPostRequestsEnqueud(), static_cast<size_t>(maxConcurrentMessageRequests));
+}
+
+/**
+ * Test that with pipelining enabled, an event sent after a @c Recognize completes while AVS has still not acknowledged
+ * the @c Recognize.
+ */
+TEST_F(HTTP2TransportTest, pipelinedEventCompletesBeforeSlowRecognize) {
+    HTTP2Transport::Configuration cfg;
+    cfg.pipelineMessageRequests = true;
+    createTransport(cfg);
+    authorizeAndConnect();
+
+    auto recognizeObserver = std::make_shared<TimingMessageRequestObserver>();
+    auto recognizeRequest = std::make_shared<MessageRequest>(buildEvent("Recognize", DIALOG_REQUEST_ID), "");
+    recognizeRequest->addObserver(recognizeObserver);
+    m_http2Transport->send(recognizeRequest);
+    auto eventObserver = std::make_shared<TimingMessageRequestObserver>();
+    auto eventRequest = std::make_shared<MessageRequest>(buildEvent("PlaybackStarted"), "");
+    eventRequest->addObserver(eventObserver);
+    m_http2Transport->send(eventRequest);
+
+    auto recognize = m_mockHttp2Connection->dequePostRequest(RESPONSE_TIMEOUT);
+    auto event = m_mockHttp2Connection->dequePostRequest(RESPONSE_TIMEOUT);
+    ASSERT_NE(recognize, nullptr);
+    ASSERT_NE(event, nullptr);
+
+    // Acknowledge the event while the Recognize is still waiting for its response.
+    event->getSink()->onReceiveResponseCode(HTTPResponseCode::SUCCESS_NO_CONTENT);
+    event->getSink()->onResponseFinished(HTTP2ResponseFinishedStatus::COMPLETE);
+    ASSERT_TRUE(eventObserver->m_completed.waitFor(RESPONSE_TIMEOUT));
+    EXPECT_FALSE(recognizeObserver->m_completed.waitFor(std::chrono::milliseconds(0)));
+
+    // Only now release the Recognize.
+    recognize->getSink()->onReceiveResponseCode(HTTPResponseCode::SUCCESS_NO_CONTENT);
+    recognize->getSink()->onResponseFinished(HTTP2ResponseFinishedStatus::COMPLETE);
+    ASSERT_TRUE(recognizeObserver->m_completed.waitFor(RESPONSE_TIMEOUT));
+    EXPECT_LE(eventObserver->m_completed.getValue(), recognizeObserver->m_completed.getValue());
+}
+
+/**
+ * Benchmark the latency of events queued behind a slow @c Recognize when message requests are sent one at a time.
+ * The mean latency is recorded as a test property.  Disabled by default; run with --gtest_also_run_disabled_tests.
+ */
+TEST_F(HTTP2TransportTest, DISABLED_benchmarkEventLatencySerialized) {
+    auto latency = measureEventLatencyBehindSlowRecognize(false);
+    RecordProperty("serializedEventLatencyUs", std::to_string(latency.count()));
+}
+
+/**
+ * Benchmark the latency of events queued behind a slow @c Recognize when message requests are pipelined.  Like the
+ * serialized benchmark above, it is disabled by default and records the mean latency as a test property.
+ */
+TEST_F(HTTP2TransportTest, DISABLED_benchmarkEventLatencyPipelined) {
+    auto latency = measureEventLatencyBehindSlowRecognize(true);
+    RecordProperty("pipelinedEventLatencyUs", std::to_string(latency.count()));
+}
+
+/**
+ * Test that @c getStatistics() counts the streams opened and the data sent and received on them.
+ */
+TEST_F(HTTP2TransportTest, statisticsCountStreamsAndData) {
+    authorizeAndConnect();
+    auto initial = m_http2Transport->getStatistics();
+    EXPECT_GE(initial.streamsOpened, 1u);
+
+    std::shared_ptr<MessageRequest> messageReq = std::make_shared<MessageRequest>(TEST_MESSAGE, "");
+    m_http2Transport->send(messageReq);
+    auto eventStream = m_mockHttp2Connection->waitForPostRequest(RESPONSE_TIMEOUT);
+    ASSERT_NE(eventStream, nullptr);
+    eventStream->getSink()->onReceiveResponseCode(HTTPResponseCode::SUCCESS_OK);
+    eventStream->getSink()->onReceiveHeaderLine(HTTP_BOUNDARY_HEADER);
+    eventStream->getSink()->onReceiveData(MIME_BODY_DIRECTIVE1.c_str(), MIME_BODY_DIRECTIVE1.size());
+    eventStream->getSink()->onResponseFinished(HTTP2ResponseFinishedStatus::COMPLETE);
+
+    // The stream is counted once the connection has returned it, which may be after the test has received it.
+    auto statistics = m_http2Transport->getStatistics();
+    auto deadline = std::chrono::steady_clock::now() + RESPONSE_TIMEOUT;
+    while (statistics.streamsOpened == initial.streamsOpened && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(TEN_MILLISECOND_DELAY);
+        statistics = m_http2Transport->getStatistics();
+    }
+    EXPECT_EQ(initial.streamsOpened + 1, statistics.streamsOpened);
+    EXPECT_GT(statistics.bytesSent, initial.bytesSent);
+    EXPECT_GT(statistics.chunksSent, initial.chunksSent);
+    EXPECT_EQ(initial.bytesReceived + MIME_BODY_DIRECTIVE1.size(), statistics.bytesReceived);
+    EXPECT_EQ(initial.chunksReceived + 1, statistics.chunksReceived);
+    EXPECT_EQ(initial.responsesReceived + 1, statistics.responsesReceived);
+}
+
+/**
+ * Measure the cost of @c onActivity(), which is called for every chunk received, while other threads also report
+ * activity and a message is queued for every chunk.  Disabled by default; the time per call is recorded as a test
+ * property.
+ */
+TEST_F(HTTP2TransportTest, DISABLED_benchmarkOnActivity) {
+    static const int CALLS_PER_THREAD = 200000;
+    static const int THREADS = 4;
+
+    authorizeAndConnect();
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < THREADS; ++thread) {
+        threads.push_back(std::thread([this] {
+            for (int i = 0; i < CALLS_PER_THREAD; ++i) {
+                m_http2Transport->onActivity();
+            }
+        }));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    RecordProperty(
+        "onActivityNsPerCall",
+        std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / CALLS_PER_THREAD));
+}
+
 }  // namespace test
 }  // namespace transport
 }  // namespace acl
@@ -41,6 +41,7 @@ class MockHTTP2Request : public HTTP2RequestInterface {
 public:
     MockHTTP2Request(const alexaClientSDK::avsCommon::utils::http2::HTTP2RequestConfig& config);
     MOCK_METHOD0(cancel, bool());
+    MOCK_METHOD0(resume, void());
     MOCK_CONST_METHOD0(getId, std::string());
 
     /**
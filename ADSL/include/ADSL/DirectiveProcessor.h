@@ -16,8 +16,10 @@
 #ifndef ALEXA_CLIENT_SDK_ADSL_INCLUDE_ADSL_DIRECTIVEPROCESSOR_H_
 #define ALEXA_CLIENT_SDK_ADSL_INCLUDE_ADSL_DIRECTIVEPROCESSOR_H_
 
+#include <array>
 #include <condition_variable>
 #include <deque>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -50,12 +52,12 @@ namespace adsl {
  * @par
  * Once an @c AVSDirective has been successfully forwarded for preHandling, it is enqueued awaiting its turn to be
  * handled. Handling is accomplished by forwarding the @c AVSDirective to the @c handleDirective() method of
- * whichever @c DirectiveHandler is registered to handle the @c AVSDirective. The handling of an @c AVSDirective can
- * be configured as @c BLOCKING or @c NON_BLOCKING. If the directive at the head of the handling queue is configured
- * for @c BLOCKING, the handling of subsequent @c AVSDirectives is held up until the @c DirectiveHandler for the
- * @c BLOCKING @c AVSDirective indicates that handling has completed or failed. Otherwise handleDirective() is
- * invoked, the @c AVSDirective is popped from the front of the queue, and processing of queued @c AVSDirective's
- * continues.
+ * whichever @c DirectiveHandler is registered to handle the @c AVSDirective. The @c BlockingPolicy of an
+ * @c AVSDirective names the mediums (audio, visual) its handling uses, and whether it blocks them. Each medium is a
+ * lane: an @c AVSDirective is handled once every @c AVSDirective queued before it that uses one of its mediums has
+ * been handled, and no blocking @c AVSDirective using one of its mediums is still being handled. A blocking
+ * @c AVSDirective holds its lanes until its @c DirectiveHandler indicates that handling has completed or failed.
+ * @c AVSDirectives that use no medium are never held up.
  */
 class DirectiveProcessor {
 public:
@@ -150,6 +152,15 @@ private:
         std::shared_ptr<avsCommon::avs::AVSDirective> m_directive;
     };
 
+    /// An @c AVSDirective queued for handling, with the @c BlockingPolicy which decides its lanes.
+    struct DirectiveAndPolicy {
+        /// The @c AVSDirective.
+        std::shared_ptr<avsCommon::avs::AVSDirective> directive;
+
+        /// The @c BlockingPolicy configured for @c directive when it was queued.
+        avsCommon::avs::BlockingPolicy policy;
+    };
+
     /**
      * Receive notification that the handling of an @c AVSDirective has completed.
      *
@@ -189,7 +200,7 @@ private:
     bool processCancelingQueueLocked(std::unique_lock<std::mutex>& lock);
 
     /**
-     * Process (handle) the next @c AVSDirective in @c m_handlingQueue.
+     * Process (handle) the first @c AVSDirective in @c m_handlingQueue whose lanes are not blocked.
      * @note This method must only be called by threads that have acquired @c m_mutex.
      *
      * @param lock A @c unique_lock on m_mutex from the callers context, allowing this method to release
@@ -198,6 +209,35 @@ private:
      */
     bool handleDirectiveLocked(std::unique_lock<std::mutex>& lock);
 
+    /**
+     * Find the first @c AVSDirective in @c m_handlingQueue that can be handled: none of its mediums is held by a
+     * blocking @c AVSDirective being handled, or used by an @c AVSDirective queued before it.
+     * @note This method must only be called by threads that have acquired @c m_mutex.
+     *
+     * @return An iterator to the @c AVSDirective, or @c m_handlingQueue.end() if every lane is blocked.
+     */
+    std::deque<DirectiveAndPolicy>::iterator getNextUnblockedDirectiveLocked();
+
+    /**
+     * Release the lanes held by an @c AVSDirective.
+     * @note This method must only be called by threads that have acquired @c m_mutex.
+     *
+     * @param directive The @c AVSDirective whose lanes to release.
+     * @return Whether any lane was held by @c directive.
+     */
+    bool clearDirectiveBeingHandledLocked(std::shared_ptr<avsCommon::avs::AVSDirective> directive);
+
+    /**
+     * Move the blocking @c AVSDirectives being handled which satisfy a predicate to @c m_cancelingQueue, releasing
+     * their lanes.
+     * @note This method must only be called by threads that have acquired @c m_mutex.
+     *
+     * @param shouldCancel The predicate.
+     * @return Whether any @c AVSDirective was moved.
+     */
+    bool cancelDirectivesBeingHandledLocked(
+        std::function<bool(std::shared_ptr<avsCommon::avs::AVSDirective>)> shouldCancel);
+
     /**
      * Set the current @c dialogRequestId. This cancels the processing of any @c AVSDirectives with a non-empty
      * dialogRequestId.
@@ -247,11 +287,15 @@ private:
     /// The directive (if any) for which a preHandleDirective() call is in progress.
     std::shared_ptr<avsCommon::avs::AVSDirective> m_directiveBeingPreHandled;
 
-    /// Queue of @c AVSDirectives waiting to be handled.
-    std::deque<std::shared_ptr<avsCommon::avs::AVSDirective>> m_handlingQueue;
+    /// Queue of @c AVSDirectives waiting to be handled, with the @c BlockingPolicy they were queued with.
+    std::deque<DirectiveAndPolicy> m_handlingQueue;
 
-    /// Whether @c handleDirective() has been called for the directive at the @c front() of @c m_handlingQueue.
-    bool m_isHandlingDirective;
+    /**
+     * The blocking @c AVSDirective (if any) being handled in each lane, indexed by @c BlockingPolicy::Medium.  An
+     * @c AVSDirective which uses several mediums appears in each of their lanes.
+     */
+    std::array<std::shared_ptr<avsCommon::avs::AVSDirective>, avsCommon::avs::BlockingPolicy::Mediums().size()>
+        m_directivesBeingHandled;
 
     /// Condition variable used to wake @c processingLoop() when it is waiting.
     std::condition_variable m_wakeProcessingLoop;
@@ -97,6 +97,14 @@ public:
         std::shared_ptr<avsCommon::avs::AVSDirective> directive,
         avsCommon::avs::BlockingPolicy* policyOut);
 
+    /**
+     * Get the @c BlockingPolicy configured for the given @c AVSDirective.
+     *
+     * @param directive The directive whose policy to get.
+     * @return The configured @c BlockingPolicy, or @c BlockingPolicy::NONE if there is no registered handler.
+     */
+    avsCommon::avs::BlockingPolicy getPolicy(std::shared_ptr<avsCommon::avs::AVSDirective> directive);
+
     /**
      * Invoke cancelDirective() on the handler registered for the given @c AVSDirective.
      *
@@ -47,8 +47,7 @@ std::unordered_map<DirectiveProcessor::ProcessorHandle, DirectiveProcessor*> Dir
 DirectiveProcessor::DirectiveProcessor(DirectiveRouter* directiveRouter) :
         m_directiveRouter{directiveRouter},
         m_isShuttingDown{false},
-        m_isEnabled{true},
-        m_isHandlingDirective{false} {
+        m_isEnabled{true} {
     std::lock_guard<std::mutex> lock(m_handleMapMutex);
     m_handle = ++m_nextProcessorHandle;
     m_handleMap[m_handle] = this;
@@ -91,11 +90,17 @@ bool DirectiveProcessor::onDirective(std::shared_ptr<AVSDirective> directive) {
     lock.unlock();
     auto handled = m_directiveRouter->preHandleDirective(
         directive, alexaClientSDK::avsCommon::utils::memory::make_unique<DirectiveHandlerResult>(m_handle, directive));
+    auto policy = m_directiveRouter->getPolicy(directive);
+    if (!policy.isValid()) {
+        // The handler went away after preHandleDirective().  Keep the directive in order in every lane until
+        // handleDirective() fails for it.
+        policy = BlockingPolicy::NON_BLOCKING;
+    }
     lock.lock();
     if (m_directiveBeingPreHandled) {
         m_directiveBeingPreHandled.reset();
         if (handled) {
-            m_handlingQueue.push_back(directive);
+            m_handlingQueue.push_back({directive, policy});
             m_wakeProcessingLoop.notify_one();
         }
     }
@@ -192,13 +197,14 @@ void DirectiveProcessor::removeDirectiveLocked(std::shared_ptr<AVSDirective> dir
         m_directiveBeingPreHandled.reset();
     }
 
-    if (m_isHandlingDirective && !m_handlingQueue.empty() && matches(m_handlingQueue.front())) {
-        m_isHandlingDirective = false;
-        m_handlingQueue.pop_front();
-    }
+    clearDirectiveBeingHandledLocked(directive);
 
     m_handlingQueue.erase(
-        std::remove_if(m_handlingQueue.begin(), m_handlingQueue.end(), matches), m_handlingQueue.end());
+        std::remove_if(
+            m_handlingQueue.begin(),
+            m_handlingQueue.end(),
+            [directive](const DirectiveAndPolicy& item) { return item.directive == directive; }),
+        m_handlingQueue.end());
 
     if (!m_cancelingQueue.empty() || !m_handlingQueue.empty()) {
         m_wakeProcessingLoop.notify_one();
@@ -207,7 +213,8 @@ void DirectiveProcessor::removeDirectiveLocked(std::shared_ptr<AVSDirective> dir
 
 void DirectiveProcessor::processingLoop() {
     auto wake = [this]() {
-        return !m_cancelingQueue.empty() || (!m_handlingQueue.empty() && !m_isHandlingDirective) || m_isShuttingDown;
+        return !m_cancelingQueue.empty() || getNextUnblockedDirectiveLocked() != m_handlingQueue.end() ||
+               m_isShuttingDown;
     };
 
     while (true) {
@@ -233,28 +240,28 @@ bool DirectiveProcessor::processCancelingQueueLocked(std::unique_lock<std::mutex
 }
 
 bool DirectiveProcessor::handleDirectiveLocked(std::unique_lock<std::mutex>& lock) {
-    if (m_handlingQueue.empty()) {
+    auto it = getNextUnblockedDirectiveLocked();
+    if (m_handlingQueue.end() == it) {
         return false;
     }
-    if (m_isHandlingDirective) {
-        return true;
+    auto directive = it->directive;
+    auto queuedPolicy = it->policy;
+    m_handlingQueue.erase(it);
+    if (queuedPolicy.isBlocking()) {
+        // Hold the lanes while handleDirective() is in progress, to keep following directives out of them.
+        auto mediums = queuedPolicy.getMediums();
+        for (size_t medium = 0; medium < m_directivesBeingHandled.size(); ++medium) {
+            if (mediums.test(medium)) {
+                m_directivesBeingHandled[medium] = directive;
+            }
+        }
     }
-    auto directive = m_handlingQueue.front();
-    m_isHandlingDirective = true;
     lock.unlock();
     auto policy = BlockingPolicy::NONE;
     auto handled = m_directiveRouter->handleDirective(directive, &policy);
     lock.lock();
-    if (!handled || BlockingPolicy::BLOCKING != policy) {
-        m_isHandlingDirective = false;
-        if (!m_handlingQueue.empty() && m_handlingQueue.front() == directive) {
-            m_handlingQueue.pop_front();
-        } else if (!handled) {
-            ACSDK_ERROR(LX("handlingDirectiveLockedFailed")
-                            .d("expected", directive->getMessageId())
-                            .d("front", m_handlingQueue.empty() ? "(empty)" : m_handlingQueue.front()->getMessageId())
-                            .d("reason", "handlingQueueFrontChangedWithoutBeingHandled"));
-        }
+    if (!handled || !policy.isBlocking()) {
+        clearDirectiveBeingHandledLocked(directive);
     }
     if (!handled) {
         scrubDialogRequestIdLocked(directive->getDialogRequestId());
@@ -262,6 +269,54 @@ bool DirectiveProcessor::handleDirectiveLocked(std::unique_lock<std::mutex>& loc
     return true;
 }
 
+std::deque<DirectiveProcessor::DirectiveAndPolicy>::iterator DirectiveProcessor::getNextUnblockedDirectiveLocked() {
+    BlockingPolicy::Mediums blocked;
+    for (size_t medium = 0; medium < m_directivesBeingHandled.size(); ++medium) {
+        blocked[medium] = m_directivesBeingHandled[medium] != nullptr;
+    }
+    for (auto it = m_handlingQueue.begin(); it != m_handlingQueue.end(); ++it) {
+        auto mediums = it->policy.getMediums();
+        if ((mediums & blocked).none()) {
+            return it;
+        }
+        // Directives stay in order within a lane, so a directive waiting for a lane blocks it for the ones behind.
+        blocked |= mediums;
+    }
+    return m_handlingQueue.end();
+}
+
+bool DirectiveProcessor::clearDirectiveBeingHandledLocked(std::shared_ptr<AVSDirective> directive) {
+    bool cleared = false;
+    for (auto& directiveBeingHandled : m_directivesBeingHandled) {
+        if (directiveBeingHandled && directiveBeingHandled == directive) {
+            directiveBeingHandled.reset();
+            cleared = true;
+        }
+    }
+    if (cleared && !m_handlingQueue.empty()) {
+        m_wakeProcessingLoop.notify_one();
+    }
+    return cleared;
+}
+
+bool DirectiveProcessor::cancelDirectivesBeingHandledLocked(
+    std::function<bool(std::shared_ptr<avsCommon::avs::AVSDirective>)> shouldCancel) {
+    bool changed = false;
+    for (auto& directiveBeingHandled : m_directivesBeingHandled) {
+        if (!directiveBeingHandled || !shouldCancel(directiveBeingHandled)) {
+            continue;
+        }
+        // A directive which holds several lanes is only canceled once.
+        if (std::find(m_cancelingQueue.begin(), m_cancelingQueue.end(), directiveBeingHandled) ==
+            m_cancelingQueue.end()) {
+            m_cancelingQueue.push_back(directiveBeingHandled);
+        }
+        directiveBeingHandled.reset();
+        changed = true;
+    }
+    return changed;
+}
+
 void DirectiveProcessor::setDialogRequestIdLocked(const std::string& dialogRequestId) {
     if (dialogRequestId == m_dialogRequestId) {
         ACSDK_WARN(
@@ -294,26 +349,23 @@ void DirectiveProcessor::scrubDialogRequestIdLocked(const std::string& dialogReq
         }
     }
 
-    // If a mathcing directive in the midst of a handleDirective() call, reset m_isHandlingDirective
-    // so we won't block processing subsequent directives.  This directive is already in m_handlingQueue
-    // and will be moved to m_cancelingQueue, below.
-    if (m_isHandlingDirective && !m_handlingQueue.empty()) {
-        auto id = m_handlingQueue.front()->getDialogRequestId();
-        if (!id.empty() && id == dialogRequestId) {
-            m_isHandlingDirective = false;
-            changed = true;
-        }
+    // If matching directives are in the midst of a blocking handleDirective() call, release their lanes so we won't
+    // block processing subsequent directives, and queue them for canceling.
+    if (cancelDirectivesBeingHandledLocked([&dialogRequestId](std::shared_ptr<AVSDirective> directive) {
+            return directive->getDialogRequestId() == dialogRequestId;
+        })) {
+        changed = true;
     }
 
     // Filter matching directives from m_handlingQueue and put them in m_cancelingQueue.
-    std::deque<std::shared_ptr<AVSDirective>> temp;
-    for (auto directive : m_handlingQueue) {
-        auto id = directive->getDialogRequestId();
+    std::deque<DirectiveAndPolicy> temp;
+    for (auto item : m_handlingQueue) {
+        auto id = item.directive->getDialogRequestId();
         if (!id.empty() && id == dialogRequestId) {
-            m_cancelingQueue.push_back(directive);
+            m_cancelingQueue.push_back(item.directive);
             changed = true;
         } else {
-            temp.push_back(directive);
+            temp.push_back(item);
         }
     }
     std::swap(temp, m_handlingQueue);
@@ -331,16 +383,20 @@ void DirectiveProcessor::scrubDialogRequestIdLocked(const std::string& dialogReq
 
 void DirectiveProcessor::queueAllDirectivesForCancellationLocked() {
     m_dialogRequestId.clear();
+    auto changed = cancelDirectivesBeingHandledLocked([](std::shared_ptr<AVSDirective>) { return true; });
+    for (const auto& item : m_handlingQueue) {
+        m_cancelingQueue.push_back(item.directive);
+        changed = true;
+    }
+    m_handlingQueue.clear();
     if (m_directiveBeingPreHandled) {
-        m_handlingQueue.push_back(m_directiveBeingPreHandled);
+        m_cancelingQueue.push_back(m_directiveBeingPreHandled);
         m_directiveBeingPreHandled.reset();
+        changed = true;
     }
-    if (!m_handlingQueue.empty()) {
-        m_cancelingQueue.insert(m_cancelingQueue.end(), m_handlingQueue.begin(), m_handlingQueue.end());
-        m_handlingQueue.clear();
+    if (changed) {
         m_wakeProcessingLoop.notify_one();
     }
-    m_isHandlingDirective = false;
 }
 
 }  // namespace adsl
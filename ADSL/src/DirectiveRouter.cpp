@@ -57,7 +57,7 @@ bool DirectiveRouter::addDirectiveHandler(std::shared_ptr<DirectiveHandlerInterf
 
     auto configuration = handler->getConfiguration();
     for (auto item : configuration) {
-        if (BlockingPolicy::NONE == item.second) {
+        if (!item.second.isValid()) {
             ACSDK_ERROR(LX("addDirectiveHandlersFailed").d("reason", "nonePolicy"));
         }
         auto it = m_configuration.find(item.first);
@@ -166,7 +166,7 @@ bool DirectiveRouter::handleDirectiveWithPolicyHandleImmediately(
                        .d("reason", "noHandlerRegistered"));
         return false;
     }
-    if (BlockingPolicy::HANDLE_IMMEDIATELY != handlerAndPolicy.policy) {
+    if (!handlerAndPolicy.policy.isHandleImmediately()) {
         return false;
     }
     ACSDK_INFO(LX("handleDirectiveWithPolicyHandleImmediately")
@@ -223,6 +223,11 @@ bool DirectiveRouter::handleDirective(
     return result;
 }
 
+BlockingPolicy DirectiveRouter::getPolicy(std::shared_ptr<avsCommon::avs::AVSDirective> directive) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return getHandlerAndPolicyLocked(directive).policy;
+}
+
 bool DirectiveRouter::cancelDirective(std::shared_ptr<avsCommon::avs::AVSDirective> directive) {
     std::unique_lock<std::mutex> lock(m_mutex);
     auto handlerAndPolicy = getHandlerAndPolicyLocked(directive);
@@ -42,6 +42,12 @@ using namespace avsCommon::sdkInterfaces;
 /// Long amount of time for handling a directive to allow other things to happen (we should not reach this).
 static const std::chrono::milliseconds LONG_HANDLING_TIME_MS(30000);
 
+/// Amount of time a SpeechSynthesizer::Speak directive takes to handle in the benchmark.
+static const std::chrono::milliseconds BENCHMARK_SPEAK_TIME_MS(200);
+
+/// How long to wait to conclude that a directive is being held up.
+static const std::chrono::milliseconds HELD_UP_TIMEOUT_MS(100);
+
 /// Namespace for Test only directives.
 static const std::string NAMESPACE_TEST("Test");
 
@@ -54,6 +60,9 @@ static const std::string NAMESPACE_SPEECH_SYNTHESIZER("SpeechSynthesizer");
 /// Namespace for AudioPlayer directives.
 static const std::string NAMESPACE_AUDIO_PLAYER("AudioPlayer");
 
+/// Namespace for TemplateRuntime directives.
+static const std::string NAMESPACE_TEMPLATE_RUNTIME("TemplateRuntime");
+
 /// Name for Test directive used to terminate tests.
 static const std::string NAME_DONE("Done");
 
@@ -66,6 +75,9 @@ static const std::string NAME_SPEAK("Speak");
 /// Name for AudioPlayer::Play directives.
 static const std::string NAME_PLAY("Play");
 
+/// Name for TemplateRuntime::RenderTemplate directives.
+static const std::string NAME_RENDER_TEMPLATE("RenderTemplate");
+
 /// Name for Test::Blocking directives
 static const std::string NAME_BLOCKING("Blocking");
 
@@ -107,6 +119,18 @@ static const std::string DIALOG_REQUEST_ID_2("DialogRequestId_2");
 
 static const std::string TEST_ATTACHMENT_CONTEXT_ID("TEST_ATTACHMENT_CONTEXT_ID");
 
+/// Policy of directives which use the audio lane and block it, e.g. SpeechSynthesizer::Speak.
+static const BlockingPolicy AUDIO_BLOCKING(BlockingPolicy::MEDIUM_AUDIO, true);
+
+/// Policy of directives which use the audio lane without blocking it, e.g. AudioPlayer::Play.
+static const BlockingPolicy AUDIO_NON_BLOCKING(BlockingPolicy::MEDIUM_AUDIO, false);
+
+/// Policy of directives which use the visual lane without blocking it, e.g. TemplateRuntime::RenderTemplate.
+static const BlockingPolicy VISUAL_NON_BLOCKING(BlockingPolicy::MEDIUM_VISUAL, false);
+
+/// Policy of directives which use no lane, e.g. Speaker::SetVolume.
+static const BlockingPolicy NONE_NON_BLOCKING(BlockingPolicy::MEDIUMS_NONE, false);
+
 /**
  * Mock ExceptionEncounteredSenderInterface implementation.
  */
@@ -891,6 +915,259 @@ TEST_F(DirectiveSequencerTest, testAddDirectiveAfterReEnabled) {
     ASSERT_TRUE(handler->waitUntilCompleted());
 }
 
+/**
+ * Send a Speak directive which blocks the audio lane, followed by a RenderTemplate directive in the visual lane and a
+ * SetVolume directive which uses no lane.  Expect the latter two to be handled while the Speak directive is still
+ * being handled.
+ */
+TEST_F(DirectiveSequencerTest, testAudioBlockingDoesNotBlockOtherLanes) {
+    auto avsMessageHeader0 =
+        std::make_shared<AVSMessageHeader>(NAMESPACE_SPEECH_SYNTHESIZER, NAME_SPEAK, MESSAGE_ID_0, DIALOG_REQUEST_ID_0);
+    std::shared_ptr<AVSDirective> directive0 = AVSDirective::create(
+        UNPARSED_DIRECTIVE, avsMessageHeader0, PAYLOAD_TEST, m_attachmentManager, TEST_ATTACHMENT_CONTEXT_ID);
+    auto avsMessageHeader1 = std::make_shared<AVSMessageHeader>(
+        NAMESPACE_TEMPLATE_RUNTIME, NAME_RENDER_TEMPLATE, MESSAGE_ID_1, DIALOG_REQUEST_ID_0);
+    std::shared_ptr<AVSDirective> directive1 = AVSDirective::create(
+        UNPARSED_DIRECTIVE, avsMessageHeader1, PAYLOAD_TEST, m_attachmentManager, TEST_ATTACHMENT_CONTEXT_ID);
+    auto avsMessageHeader2 =
+        std::make_shared<AVSMessageHeader>(NAMESPACE_SPEAKER, NAME_SET_VOLUME, MESSAGE_ID_2, DIALOG_REQUEST_ID_0);
+    std::shared_ptr<AVSDirective> directive2 = AVSDirective::create(
+        UNPARSED_DIRECTIVE, avsMessageHeader2, PAYLOAD_TEST, m_attachmentManager, TEST_ATTACHMENT_CONTEXT_ID);
+
+    DirectiveHandlerConfiguration handler0Config;
+    handler0Config[{NAMESPACE_SPEECH_SYNTHESIZER, NAME_SPEAK}] = AUDIO_BLOCKING;
+    auto handler0 = MockDirectiveHandler::create(handler0Config, LONG_HANDLING_TIME_MS);
+
+    DirectiveHandlerConfiguration handler1Config;
+    handler1Config[{NAMESPACE_TEMPLATE_RUNTIME, NAME_RENDER_TEMPLATE}] = VISUAL_NON_BLOCKING;
+    auto handler1 = MockDirectiveHandler::create(handler1Config);
+
+    DirectiveHandlerConfiguration handler2Config;
+    handler2Config[{NAMESPACE_SPEAKER, NAME_SET_VOLUME}] = NONE_NON_BLOCKING;
+    auto handler2 = MockDirectiveHandler::create(handler2Config);
+
+    ASSERT_TRUE(m_sequencer->addDirectiveHandler(handler0));
+    ASSERT_TRUE(m_sequencer->addDirectiveHandler(handler1));
+    ASSERT_TRUE(m_sequencer->addDirectiveHandler(handler2));
+
+    EXPECT_CALL(*(handler0.get()), handleDirective(MESSAGE_ID_0)).Times(1);
+    EXPECT_CALL(*(handler0.get()), cancelDirective(_)).Times(0);
+    EXPECT_CALL(*(handler1.get()), handleDirective(MESSAGE_ID_1)).Times(1);
+    EXPECT_CALL(*(handler1.get()), cancelDirective(_)).Times(0);
+    EXPECT_CALL(*(handler2.get()), handleDirective(MESSAGE_ID_2)).Times(1);
+    EXPECT_CALL(*(handler2.get()), cancelDirective(_)).Times(0);
+
+    m_sequencer->setDialogRequestId(DIALOG_REQUEST_ID_0);
+    m_sequencer->onDirective(directive0);
+    m_sequencer->onDirective(directive1);
+    m_sequencer->onDirective(directive2);
+    ASSERT_TRUE(handler0->waitUntilHandling());
+    ASSERT_TRUE(handler1->waitUntilCompleted());
+    ASSERT_TRUE(handler2->waitUntilCompleted());
+    ASSERT_FALSE(handler0->waitUntilCompleted(std::chrono::milliseconds::zero()));
+    handler0->doHandlingCompleted();
+    ASSERT_TRUE(handler0->waitUntilCompleted());
+}
+
+/**
+ * Send a Speak directive which blocks the audio lane, followed by a Play directive in the audio lane.  Expect the
+ * Play directive to be handled only once the Speak directive has completed.
+ */
+TEST_F(DirectiveSequencerTest, testSameLaneKeepsOrder) {
+    auto avsMessageHeader0 =
+        std::make_shared<AVSMessageHeader>(NAMESPACE_SPEECH_SYNTHESIZER, NAME_SPEAK, MESSAGE_ID_0, DIALOG_REQUEST_ID_0);
+    std::shared_ptr<AVSDirective> directive0 = AVSDirective::create(
+        UNPARSED_DIRECTIVE, avsMessageHeader0, PAYLOAD_TEST, m_attachmentManager, TEST_ATTACHMENT_CONTEXT_ID);
+    auto avsMessageHeader1 =
+        std::make_shared<AVSMessageHeader>(NAMESPACE_AUDIO_PLAYER, NAME_PLAY, MESSAGE_ID_1, DIALOG_REQUEST_ID_0);
+    std::shared_ptr<AVSDirective> directive1 = AVSDirective::create(
+        UNPARSED_DIRECTIVE, avsMessageHeader1, PAYLOAD_TEST, m_attachmentManager, TEST_ATTACHMENT_CONTEXT_ID);
+
+    DirectiveHandlerConfiguration handler0Config;
+    handler0Config[{NAMESPACE_SPEECH_SYNTHESIZER, NAME_SPEAK}] = AUDIO_BLOCKING;
+    auto handler0 = MockDirectiveHandler::create(handler0Config, LONG_HANDLING_TIME_MS);
+
+    DirectiveHandlerConfiguration handler1Config;
+    handler1Config[{NAMESPACE_AUDIO_PLAYER, NAME_PLAY}] = AUDIO_NON_BLOCKING;
+    auto handler1 = MockDirectiveHandler::create(handler1Config);
+
+    ASSERT_TRUE(m_sequencer->addDirectiveHandler(handler0));
+    ASSERT_TRUE(m_sequencer->addDirectiveHandler(handler1));
+
+    EXPECT_CALL(*(handler0.get()), handleDirective(MESSAGE_ID_0)).Times(1);
+    EXPECT_CALL(*(handler1.get()), handleDirective(MESSAGE_ID_1)).Times(1);
+
+    m_sequencer->setDialogRequestId(DIALOG_REQUEST_ID_0);
+    m_sequencer->onDirective(directive0);
+    m_sequencer->onDirective(directive1);
+    ASSERT_TRUE(handler0->waitUntilHandling());
+    ASSERT_TRUE(handler1->waitUntilPreHandling());
+    ASSERT_FALSE(handler1->waitUntilHandling(HELD_UP_TIMEOUT_MS));
+    handler0->doHandlingCompleted();
+    ASSERT_TRUE(handler1->waitUntilCompleted());
+}
+
+/**
+ * Send a Speak directive which blocks the audio lane, followed by a Play directive in the audio lane and a
+ * RenderTemplate directive in both lanes.  Expect the RenderTemplate directive to wait behind the queued Play
+ * directive, even though the visual lane is free.
+ */
+TEST_F(DirectiveSequencerTest, testQueuedDirectiveHoldsItsLanes) {
+    auto avsMessageHeader0 =
+        std::make_shared<AVSMessageHeader>(NAMESPACE_SPEECH_SYNTHESIZER, NAME_SPEAK, MESSAGE_ID_0, DIALOG_REQUEST_ID_0);
+    std::shared_ptr<AVSDirective> directive0 = AVSDirective::create(
+        UNPARSED_DIRECTIVE, avsMessageHeader0, PAYLOAD_TEST, m_attachmentManager, TEST_ATTACHMENT_CONTEXT_ID);
+    auto avsMessageHeader1 =
+        std::make_shared<AVSMessageHeader>(NAMESPACE_AUDIO_PLAYER, NAME_PLAY, MESSAGE_ID_1, DIALOG_REQUEST_ID_0);
+    std::shared_ptr<AVSDirective> directive1 = AVSDirective::create(
+        UNPARSED_DIRECTIVE, avsMessageHeader1, PAYLOAD_TEST, m_attachmentManager, TEST_ATTACHMENT_CONTEXT_ID);
+    auto avsMessageHeader2 = std::make_shared<AVSMessageHeader>(
+        NAMESPACE_TEMPLATE_RUNTIME, NAME_RENDER_TEMPLATE, MESSAGE_ID_2, DIALOG_REQUEST_ID_0);
+    std::shared_ptr<AVSDirective> directive2 = AVSDirective::create(
+        UNPARSED_DIRECTIVE, avsMessageHeader2, PAYLOAD_TEST, m_attachmentManager, TEST_ATTACHMENT_CONTEXT_ID);
+
+    DirectiveHandlerConfiguration handler0Config;
+    handler0Config[{NAMESPACE_SPEECH_SYNTHESIZER, NAME_SPEAK}] = AUDIO_BLOCKING;
+    auto handler0 = MockDirectiveHandler::create(handler0Config, LONG_HANDLING_TIME_MS);
+
+    DirectiveHandlerConfiguration handler1Config;
+    handler1Config[{NAMESPACE_AUDIO_PLAYER, NAME_PLAY}] = AUDIO_NON_BLOCKING;
+    auto handler1 = MockDirectiveHandler::create(handler1Config);
+
+    DirectiveHandlerConfiguration handler2Config;
+    handler2Config[{NAMESPACE_TEMPLATE_RUNTIME, NAME_RENDER_TEMPLATE}] = BlockingPolicy::NON_BLOCKING;
+    auto handler2 = MockDirectiveHandler::create(handler2Config);
+
+    ASSERT_TRUE(m_sequencer->addDirectiveHandler(handler0));
+    ASSERT_TRUE(m_sequencer->addDirectiveHandler(handler1));
+    ASSERT_TRUE(m_sequencer->addDirectiveHandler(handler2));
+
+    m_sequencer->setDialogRequestId(DIALOG_REQUEST_ID_0);
+    m_sequencer->onDirective(directive0);
+    m_sequencer->onDirective(directive1);
+    m_sequencer->onDirective(directive2);
+    ASSERT_TRUE(handler0->waitUntilHandling());
+    ASSERT_TRUE(handler2->waitUntilPreHandling());
+    ASSERT_FALSE(handler2->waitUntilHandling(HELD_UP_TIMEOUT_MS));
+    ASSERT_FALSE(handler1->waitUntilHandling(std::chrono::milliseconds::zero()));
+    handler0->doHandlingCompleted();
+    ASSERT_TRUE(handler1->waitUntilCompleted());
+    ASSERT_TRUE(handler2->waitUntilCompleted());
+}
+
+/**
+ * Send a Speak directive which blocks the audio lane while it is being handled, then change the dialogRequestId.
+ * Expect the Speak directive to be canceled, and the audio lane to be released for the next dialog.
+ */
+TEST_F(DirectiveSequencerTest, testCancelReleasesLane) {
+    auto avsMessageHeader0 =
+        std::make_shared<AVSMessageHeader>(NAMESPACE_SPEECH_SYNTHESIZER, NAME_SPEAK, MESSAGE_ID_0, DIALOG_REQUEST_ID_0);
+    std::shared_ptr<AVSDirective> directive0 = AVSDirective::create(
+        UNPARSED_DIRECTIVE, avsMessageHeader0, PAYLOAD_TEST, m_attachmentManager, TEST_ATTACHMENT_CONTEXT_ID);
+    auto avsMessageHeader1 =
+        std::make_shared<AVSMessageHeader>(NAMESPACE_AUDIO_PLAYER, NAME_PLAY, MESSAGE_ID_1, DIALOG_REQUEST_ID_1);
+    std::shared_ptr<AVSDirective> directive1 = AVSDirective::create(
+        UNPARSED_DIRECTIVE, avsMessageHeader1, PAYLOAD_TEST, m_attachmentManager, TEST_ATTACHMENT_CONTEXT_ID);
+
+    DirectiveHandlerConfiguration handler0Config;
+    handler0Config[{NAMESPACE_SPEECH_SYNTHESIZER, NAME_SPEAK}] = AUDIO_BLOCKING;
+    auto handler0 = MockDirectiveHandler::create(handler0Config, LONG_HANDLING_TIME_MS);
+
+    DirectiveHandlerConfiguration handler1Config;
+    handler1Config[{NAMESPACE_AUDIO_PLAYER, NAME_PLAY}] = AUDIO_NON_BLOCKING;
+    auto handler1 = MockDirectiveHandler::create(handler1Config);
+
+    ASSERT_TRUE(m_sequencer->addDirectiveHandler(handler0));
+    ASSERT_TRUE(m_sequencer->addDirectiveHandler(handler1));
+
+    EXPECT_CALL(*(handler0.get()), handleDirective(MESSAGE_ID_0)).Times(1);
+    EXPECT_CALL(*(handler0.get()), cancelDirective(MESSAGE_ID_0)).Times(1);
+    EXPECT_CALL(*(handler1.get()), handleDirective(MESSAGE_ID_1)).Times(1);
+
+    m_sequencer->setDialogRequestId(DIALOG_REQUEST_ID_0);
+    m_sequencer->onDirective(directive0);
+    ASSERT_TRUE(handler0->waitUntilHandling());
+    m_sequencer->setDialogRequestId(DIALOG_REQUEST_ID_1);
+    ASSERT_TRUE(handler0->waitUntilCanceling());
+    m_sequencer->onDirective(directive1);
+    ASSERT_TRUE(handler1->waitUntilCompleted());
+}
+
+/**
+ * Measure how long the RenderTemplate directive of a dialog of Speak, RenderTemplate and SetVolume directives waits
+ * to be handled.
+ *
+ * @param exceptionSender The @c ExceptionEncounteredSenderInterface for the @c DirectiveSequencer.
+ * @param attachmentManager The @c AttachmentManager with which to create directives.
+ * @param speakPolicy The policy of the Speak directive.
+ * @param renderPolicy The policy of the RenderTemplate directive.
+ * @param volumePolicy The policy of the SetVolume directive.
+ * @return How long the RenderTemplate directive waited, or @c LONG_HANDLING_TIME_MS if it was not handled.
+ */
+static std::chrono::milliseconds measureRenderTemplateLatency(
+    std::shared_ptr<ExceptionEncounteredSenderInterface> exceptionSender,
+    std::shared_ptr<AttachmentManager> attachmentManager,
+    const BlockingPolicy& speakPolicy,
+    const BlockingPolicy& renderPolicy,
+    const BlockingPolicy& volumePolicy) {
+    auto sequencer = DirectiveSequencer::create(exceptionSender);
+    DirectiveHandlerConfiguration speakConfig;
+    speakConfig[{NAMESPACE_SPEECH_SYNTHESIZER, NAME_SPEAK}] = speakPolicy;
+    auto speakHandler = MockDirectiveHandler::create(speakConfig, BENCHMARK_SPEAK_TIME_MS);
+    DirectiveHandlerConfiguration renderConfig;
+    renderConfig[{NAMESPACE_TEMPLATE_RUNTIME, NAME_RENDER_TEMPLATE}] = renderPolicy;
+    auto renderHandler = MockDirectiveHandler::create(renderConfig);
+    DirectiveHandlerConfiguration volumeConfig;
+    volumeConfig[{NAMESPACE_SPEAKER, NAME_SET_VOLUME}] = volumePolicy;
+    auto volumeHandler = MockDirectiveHandler::create(volumeConfig);
+    if (!sequencer || !sequencer->addDirectiveHandler(speakHandler) || !sequencer->addDirectiveHandler(renderHandler) ||
+        !sequencer->addDirectiveHandler(volumeHandler)) {
+        return LONG_HANDLING_TIME_MS;
+    }
+
+    auto createDirective = [attachmentManager](const std::string& nameSpace, const std::string& name,
+                                               const std::string& messageId) {
+        return AVSDirective::create(
+            UNPARSED_DIRECTIVE,
+            std::make_shared<AVSMessageHeader>(nameSpace, name, messageId, DIALOG_REQUEST_ID_0),
+            PAYLOAD_TEST,
+            attachmentManager,
+            TEST_ATTACHMENT_CONTEXT_ID);
+    };
+    sequencer->setDialogRequestId(DIALOG_REQUEST_ID_0);
+    auto start = std::chrono::steady_clock::now();
+    sequencer->onDirective(createDirective(NAMESPACE_SPEECH_SYNTHESIZER, NAME_SPEAK, MESSAGE_ID_0));
+    sequencer->onDirective(createDirective(NAMESPACE_TEMPLATE_RUNTIME, NAME_RENDER_TEMPLATE, MESSAGE_ID_1));
+    sequencer->onDirective(createDirective(NAMESPACE_SPEAKER, NAME_SET_VOLUME, MESSAGE_ID_2));
+    auto latency = LONG_HANDLING_TIME_MS;
+    if (renderHandler->waitUntilHandling()) {
+        latency =
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    }
+    volumeHandler->waitUntilCompleted();
+    speakHandler->waitUntilCompleted();
+    sequencer->shutdown();
+    return latency;
+}
+
+/**
+ * Compare how long a card waits behind speech in a Speak, RenderTemplate, SetVolume dialog, when all directives are
+ * processed in a single lane and when each uses its own.  Both latencies are recorded as test properties; the ordering
+ * itself is verified by @c testAudioBlockingDoesNotBlockOtherLanes.  Disabled by default.
+ */
+TEST_F(DirectiveSequencerTest, DISABLED_benchmarkMixedDialogLatency) {
+    auto singleLaneLatency = measureRenderTemplateLatency(
+        m_exceptionEncounteredSender,
+        m_attachmentManager,
+        BlockingPolicy::BLOCKING,
+        BlockingPolicy::NON_BLOCKING,
+        BlockingPolicy::NON_BLOCKING);
+    auto multiLaneLatency = measureRenderTemplateLatency(
+        m_exceptionEncounteredSender, m_attachmentManager, AUDIO_BLOCKING, VISUAL_NON_BLOCKING, NONE_NON_BLOCKING);
+    RecordProperty("singleLaneRenderTemplateMs", std::to_string(singleLaneLatency.count()));
+    RecordProperty("multiLaneRenderTemplateMs", std::to_string(multiLaneLatency.count()));
+}
+
 }  // namespace test
 }  // namespace adsl
 }  // namespace alexaClientSDK
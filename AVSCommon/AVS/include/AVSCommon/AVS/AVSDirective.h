@@ -18,9 +18,12 @@
 
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 
+#include <rapidjson/document.h>
+
 #include "Attachment/AttachmentManagerInterface.h"
 #include "AVSMessage.h"
 
@@ -109,6 +112,15 @@ public:
      */
     std::string getUnparsedDirective() const;
 
+    /**
+     * Returns the payload of this directive as parsed JSON, so that handlers need not parse @c getPayload() again.
+     * The payload is parsed on the first call, and later calls share the result.  The returned handle keeps the
+     * parsed document alive, and may be read from any thread.
+     *
+     * @return The parsed payload, or @c nullptr if the payload is not valid JSON.
+     */
+    std::shared_ptr<const rapidjson::Value> getParsedPayload() const;
+
 private:
     /**
      * Constructor.
@@ -128,6 +140,12 @@ private:
 
     /// The unparsed directive JSON string from AVS.
     const std::string m_unparsedDirective;
+    /// Mutex to serialize the parse of the payload in @c getParsedPayload.
+    mutable std::mutex m_parsedPayloadMutex;
+    /// Whether @c m_parsedPayload has been set.
+    mutable bool m_isPayloadParsed;
+    /// The parsed payload, or @c nullptr if the payload is not valid JSON.
+    mutable std::shared_ptr<const rapidjson::Value> m_parsedPayload;
     /// The attachmentManager.
     std::shared_ptr<avsCommon::avs::attachment::AttachmentManagerInterface> m_attachmentManager;
     /// The contextId needed to acquire the right attachment from the attachmentManager.
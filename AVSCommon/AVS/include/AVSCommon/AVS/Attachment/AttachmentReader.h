@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <cstddef>
+#include <functional>
 #include <ostream>
 
 #include "AVSCommon/Utils/SDS/ReaderPolicy.h"
@@ -107,6 +108,18 @@ public:
      * @param closePoint The point at which the reader should stop reading from the attachment.
      */
     virtual void close(ClosePoint closePoint = ClosePoint::AFTER_DRAINING_CURRENT_BUFFER) = 0;
+
+    /**
+     * Set a function to call when a non-blocking @c read() which returned @c ReadStatus::OK_WOULDBLOCK could return
+     * more data, because data has been written to the @c Attachment or its writer has closed.  Implementations which
+     * cannot tell when that happens ignore the function, so callers must still retry their reads from time to time.
+     *
+     * @param callback The function to call once after each @c ReadStatus::OK_WOULDBLOCK, or an empty function to stop
+     *     calling the previous one.  It may be called from the writer's thread, so it should return quickly, and it
+     *     must not call back into this reader.
+     */
+    virtual void setDataAvailableCallback(std::function<void()> callback) {
+    }
 };
 
 /**
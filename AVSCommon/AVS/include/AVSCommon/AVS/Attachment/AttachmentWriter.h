@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <cstddef>
+#include <functional>
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -75,6 +76,18 @@ public:
      * needs to use an attachment.
      */
     virtual void close() = 0;
+
+    /**
+     * Set a function to call when a @c write() which returned @c WriteStatus::OK_BUFFER_FULL could write more data,
+     * because data has been read from the @c Attachment.  Implementations which cannot tell when that happens ignore
+     * the function, so callers must still retry their writes from time to time.
+     *
+     * @param callback The function to call once after each @c WriteStatus::OK_BUFFER_FULL, or an empty function to
+     *     stop calling the previous one.  It may be called from a reader's thread, so it should return quickly, and it
+     *     must not call back into this writer.
+     */
+    virtual void setSpaceAvailableCallback(std::function<void()> callback) {
+    }
 };
 
 }  // namespace attachment
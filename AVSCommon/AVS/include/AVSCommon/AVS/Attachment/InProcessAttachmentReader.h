@@ -30,17 +30,21 @@ namespace attachment {
  * A class that provides functionality to read data from an @c Attachment following an in-process memory management
  * model.
  *
+ * @tparam StreamType The type of @c SharedDataStream the attachment data is read from.  Implementations are provided
+ *     for @c InProcessSDS and (where supported) @c SharedMemorySDS.
+ *
  * @note This class is not thread-safe beyond the thread-safety provided by the underlying SharedDataStream object.
  */
-class InProcessAttachmentReader : public AttachmentReader {
+template <typename StreamType>
+class SharedDataStreamAttachmentReader : public AttachmentReader {
 public:
     /// Type aliases for convenience.
-    using SDSType = avsCommon::utils::sds::InProcessSDS;
-    using SDSTypeIndex = avsCommon::utils::sds::InProcessSDS::Index;
-    using SDSTypeReader = SDSType::Reader;
+    using SDSType = StreamType;
+    using SDSTypeIndex = typename SDSType::Index;
+    using SDSTypeReader = typename SDSType::Reader;
 
     /**
-     * Create an InProcessAttachmentReader.
+     * Create a SharedDataStreamAttachmentReader.
      *
      * @param policy The policy this reader should adhere to.
      * @param sds The underlying @c SharedDataStream which this object will use.
@@ -49,20 +53,20 @@ public:
      *     no offset from the specified reference.
      * @param resetOnOverrun If overrun is detected on @c read, whether to close the attachment (default behavior) or
      *     to reset the read position to where current write position is (and skip all the bytes in between).
-     * @return Returns a new InProcessAttachmentReader, or nullptr if the operation failed.  This parameter defaults
-     *     to @c ABSOLUTE, indicating offset is relative to the very beginning of the Attachment.
+     * @return Returns a new SharedDataStreamAttachmentReader, or nullptr if the operation failed.  This parameter
+     *     defaults to @c ABSOLUTE, indicating offset is relative to the very beginning of the Attachment.
      */
-    static std::unique_ptr<InProcessAttachmentReader> create(
-        SDSTypeReader::Policy policy,
+    static std::unique_ptr<SharedDataStreamAttachmentReader> create(
+        typename SDSTypeReader::Policy policy,
         std::shared_ptr<SDSType> sds,
         SDSTypeIndex offset = 0,
-        SDSTypeReader::Reference reference = SDSTypeReader::Reference::ABSOLUTE,
+        typename SDSTypeReader::Reference reference = SDSTypeReader::Reference::ABSOLUTE,
         bool resetOnOverrun = false);
 
     /**
      * Destructor.
      */
-    ~InProcessAttachmentReader();
+    ~SharedDataStreamAttachmentReader();
 
     std::size_t read(
         void* buf,
@@ -76,6 +80,8 @@ public:
 
     uint64_t getNumUnreadBytes() override;
 
+    void setDataAvailableCallback(std::function<void()> callback) override;
+
 private:
     /**
      * Constructor.
@@ -85,7 +91,10 @@ private:
      * @param resetOnOverrun If overrun is detected on @c read, whether to close the attachment (default behavior) or
      *     to reset the read position to where current write position is (and skip all the bytes in between).
      */
-    InProcessAttachmentReader(SDSTypeReader::Policy policy, std::shared_ptr<SDSType> sds, bool resetOnOverrun);
+    SharedDataStreamAttachmentReader(
+        typename SDSTypeReader::Policy policy,
+        std::shared_ptr<SDSType> sds,
+        bool resetOnOverrun);
 
     /// The underlying @c SharedDataStream reader.
     std::shared_ptr<SDSTypeReader> m_reader;
@@ -94,6 +103,9 @@ private:
     bool m_resetOnOverrun;
 };
 
+/// An attachment reader for an @c InProcessSDS.
+using InProcessAttachmentReader = SharedDataStreamAttachmentReader<avsCommon::utils::sds::InProcessSDS>;
+
 }  // namespace attachment
 }  // namespace avs
 }  // namespace avsCommon
@@ -61,6 +61,8 @@ public:
 
     void close() override;
 
+    void setSpaceAvailableCallback(std::function<void()> callback) override;
+
 protected:
     /**
      * Constructor.
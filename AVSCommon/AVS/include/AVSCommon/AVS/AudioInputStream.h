@@ -16,14 +16,23 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_AUDIOINPUTSTREAM_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_AUDIOINPUTSTREAM_H_
 
+#ifdef SHARED_MEMORY_AUDIO_INPUT_STREAM
+#include "AVSCommon/Utils/SDS/SharedMemorySDS.h"
+#else
 #include "AVSCommon/Utils/SDS/InProcessSDS.h"
+#endif
 
 namespace alexaClientSDK {
 namespace avsCommon {
 namespace avs {
 
+#ifdef SHARED_MEMORY_AUDIO_INPUT_STREAM
+/// The type used store and stream binary data.  This stream can be shared with other processes.
+using AudioInputStream = utils::sds::SharedMemorySDS;
+#else
 /// The type used store and stream binary data.
 using AudioInputStream = utils::sds::InProcessSDS;
+#endif
 
 }  // namespace avs
 }  // namespace avsCommon
@@ -0,0 +1,78 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_AUDIOINPUTSTREAMFACTORY_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_AUDIOINPUTSTREAMFACTORY_H_
+
+#include <memory>
+#include <string>
+
+#include "AVSCommon/AVS/AudioInputStream.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+
+/**
+ * A collection of functions to create @c AudioInputStreams.
+ *
+ * When the SDK is built with @c SHARED_MEMORY_AUDIO_INPUT_STREAM, an @c AudioInputStream is a @c SharedMemorySDS,
+ * and @c createNamed() and @c attach() allow the stream read by @c AudioInputProcessor and the keyword detectors to be
+ * written by another process (for example an audio front-end running in isolation).  Otherwise only @c create() is
+ * supported.
+ */
+class AudioInputStreamFactory {
+public:
+    /**
+     * Creates a new @c AudioInputStream which is private to this process (and any children it forks).
+     *
+     * @param nWords The number of words the stream can hold.
+     * @param wordSize The size (in bytes) of words in the stream.
+     * @param maxReaders The maximum number of readers the stream will support.
+     * @return The new stream, or @c nullptr if it could not be created.
+     */
+    static std::shared_ptr<AudioInputStream> create(size_t nWords, size_t wordSize, size_t maxReaders);
+
+    /**
+     * Creates a new @c AudioInputStream which other processes can @c attach() to by name.  The name is released when
+     * the returned stream (and all @c Readers and @c Writers created from it) are destroyed.
+     *
+     * @param name The name of the stream.  This must start with a '/' and contain no other '/'s.
+     * @param nWords The number of words the stream can hold.
+     * @param wordSize The size (in bytes) of words in the stream.
+     * @param maxReaders The maximum number of readers the stream will support.
+     * @return The new stream, or @c nullptr if it could not be created or shared streams are not supported.
+     */
+    static std::shared_ptr<AudioInputStream> createNamed(
+        const std::string& name,
+        size_t nWords,
+        size_t wordSize,
+        size_t maxReaders);
+
+    /**
+     * Attaches to an @c AudioInputStream which was created by another process.
+     *
+     * @param name The name of the stream.
+     * @return The stream, or @c nullptr if it does not exist (or has not finished initializing), is incompatible,
+     *     or shared streams are not supported.
+     */
+    static std::shared_ptr<AudioInputStream> attach(const std::string& name);
+};
+
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_AUDIOINPUTSTREAMFACTORY_H_
@@ -16,36 +16,168 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_BLOCKINGPOLICY_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_BLOCKINGPOLICY_H_
 
+#include <bitset>
 #include <iostream>
 
 namespace alexaClientSDK {
 namespace avsCommon {
 namespace avs {
 
-/// Enumeration of 'blocking policy' values to be associated with @c AVSDirectives.
-enum class BlockingPolicy {
+/**
+ * The 'blocking policy' to be associated with @c AVSDirectives.
+ *
+ * A policy names the mediums (audio, visual) which the handling of a directive uses, and whether the handling of the
+ * directive blocks those mediums until it completes.  Each medium is an independent lane of directive processing:
+ * a directive that uses a medium is handled only after every directive before it with the same @c DialogRequestId
+ * that uses the medium has been handled, and only once no blocking directive using the medium is still being
+ * handled.  Directives which use no medium are never held up.
+ *
+ * The legacy policies @c BLOCKING and @c NON_BLOCKING use all mediums, so directives configured with them are
+ * processed strictly in order, as they always were.
+ */
+class BlockingPolicy {
+public:
+    /// A set of mediums, indexed by @c Medium.
+    using Mediums = std::bitset<2>;
+
+    /// The mediums that the handling of a directive may use.
+    enum Medium {
+        /// The audio channel (e.g. speech or music output).
+        AUDIO = 0,
+        /// The visual channel (e.g. cards on a screen).
+        VISUAL = 1
+    };
+
+    /// The audio medium only.
+    static const Mediums MEDIUM_AUDIO;
+
+    /// The visual medium only.
+    static const Mediums MEDIUM_VISUAL;
+
+    /// Both the audio and the visual medium.
+    static const Mediums MEDIUMS_AUDIO_AND_VISUAL;
+
+    /// No medium.
+    static const Mediums MEDIUMS_NONE;
+
     /**
      * Handling of an @c AVSDirective with this @c BlockingPolicy does NOT block the handling of
-     * subsequent @c AVSDirectives.
+     * subsequent @c AVSDirectives.  It uses all mediums, so it is handled after all preceding @c AVSDirectives.
      */
-    NON_BLOCKING,
+    static const BlockingPolicy NON_BLOCKING;
 
     /**
      * Handling of an @c AVSDirective with this @c BlockingPolicy blocks the handling of subsequent @c AVSDirectives
-     * that have the same @c DialogRequestId.
+     * that have the same @c DialogRequestId.  It uses all mediums, so it blocks every lane.
      */
-    BLOCKING,
+    static const BlockingPolicy BLOCKING;
 
     /**
      * Handling of an @c AVSDirective with this @c BlockingPolicy is done immediately and does NOT block the handling of
      * subsequent @c AVSDirectives.
      */
-    HANDLE_IMMEDIATELY,
+    static const BlockingPolicy HANDLE_IMMEDIATELY;
 
     /**
      * BlockingPolicy not specified.
      */
-    NONE
+    static const BlockingPolicy NONE;
+
+    /**
+     * Constructor of a policy which is not specified, equal to @c NONE.
+     */
+    constexpr BlockingPolicy() : BlockingPolicy{Type::NONE, Mediums{}, false} {
+    }
+
+    /**
+     * Constructor of a policy for directives which are processed in order within the lanes of their mediums.
+     *
+     * @param mediums The mediums which the handling of the directive uses.
+     * @param isBlocking Whether the handling of the directive blocks its mediums until it completes.
+     */
+    constexpr BlockingPolicy(const Mediums& mediums, bool isBlocking) :
+            BlockingPolicy{Type::QUEUED, mediums, isBlocking} {
+    }
+
+    /**
+     * Whether this policy is specified, i.e. is not @c NONE.
+     *
+     * @return Whether this policy is specified.
+     */
+    bool isValid() const;
+
+    /**
+     * Whether the handling of directives with this policy blocks their mediums until it completes.
+     *
+     * @return Whether the handling of directives with this policy blocks their mediums.
+     */
+    bool isBlocking() const;
+
+    /**
+     * Whether directives with this policy are handled as soon as they arrive, bypassing the lanes.
+     *
+     * @return Whether this policy is @c HANDLE_IMMEDIATELY.
+     */
+    bool isHandleImmediately() const;
+
+    /**
+     * Get the mediums which the handling of directives with this policy uses.
+     *
+     * @return The mediums.
+     */
+    Mediums getMediums() const;
+
+    /**
+     * == operator.
+     *
+     * @param rhs The policy to compare with.
+     * @return Whether the policies are equal.
+     */
+    bool operator==(const BlockingPolicy& rhs) const;
+
+    /**
+     * != operator.
+     *
+     * @param rhs The policy to compare with.
+     * @return Whether the policies differ.
+     */
+    bool operator!=(const BlockingPolicy& rhs) const;
+
+private:
+    /// How directives with a policy are processed.
+    enum class Type {
+        /// Not specified.
+        NONE,
+        /// In order, within the lanes of their mediums.
+        QUEUED,
+        /// As soon as they arrive.
+        HANDLE_IMMEDIATELY
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param type How directives with this policy are processed.
+     * @param mediums The mediums which the handling of the directive uses.
+     * @param isBlocking Whether the handling of the directive blocks its mediums until it completes.
+     */
+    constexpr BlockingPolicy(Type type, const Mediums& mediums, bool isBlocking) :
+            m_type{type},
+            m_mediums{mediums},
+            m_isBlocking{isBlocking} {
+    }
+
+    /// How directives with this policy are processed.
+    Type m_type;
+
+    /// The mediums which the handling of directives with this policy uses.
+    Mediums m_mediums;
+
+    /// Whether the handling of directives with this policy blocks their mediums.
+    bool m_isBlocking;
+
+    /// Allow @c operator<< to distinguish the legacy policies.
+    friend std::ostream& operator<<(std::ostream& stream, const BlockingPolicy& policy);
 };
 
 /**
@@ -55,21 +187,23 @@ enum class BlockingPolicy {
  * @param policy The policy value to write to the @c ostream as a string.
  * @return The @c ostream that was passed in and written to.
  */
-inline std::ostream& operator<<(std::ostream& stream, BlockingPolicy policy) {
-    switch (policy) {
-        case BlockingPolicy::NON_BLOCKING:
-            stream << "NON_BLOCKING";
-            break;
-        case BlockingPolicy::BLOCKING:
-            stream << "BLOCKING";
-            break;
-        case BlockingPolicy::HANDLE_IMMEDIATELY:
-            stream << "HANDLE_IMMEDIATELY";
-            break;
-        case BlockingPolicy::NONE:
-            stream << "NONE";
+inline std::ostream& operator<<(std::ostream& stream, const BlockingPolicy& policy) {
+    switch (policy.m_type) {
+        case BlockingPolicy::Type::NONE:
+            return stream << "NONE";
+        case BlockingPolicy::Type::HANDLE_IMMEDIATELY:
+            return stream << "HANDLE_IMMEDIATELY";
+        case BlockingPolicy::Type::QUEUED:
             break;
     }
+    stream << (policy.m_isBlocking ? "BLOCKING" : "NON_BLOCKING");
+    if (policy.m_mediums == BlockingPolicy::MEDIUMS_NONE) {
+        stream << "(NONE)";
+    } else if (policy.m_mediums == BlockingPolicy::MEDIUM_AUDIO) {
+        stream << "(AUDIO)";
+    } else if (policy.m_mediums == BlockingPolicy::MEDIUM_VISUAL) {
+        stream << "(VISUAL)";
+    }
     return stream;
 }
 
@@ -18,6 +18,7 @@
 #include "AVSCommon/Utils/Logger/Logger.h"
 
 #include <rapidjson/document.h>
+#include <rapidjson/error/en.h>
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -55,24 +56,17 @@ static const std::string TAG("AvsDirective");
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
 /**
- * Utility function to attempt a JSON parse of the passed in string, and inform the caller if this succeeded or failed.
+ * Utility function to parse a payload string.
  *
- * @param unparsedDirective The unparsed JSON string which should represent an AVS Directive.
- * @param[out] document The rapidjson Document which will be set to the parsed structure if the parse succeeds.
- * @return Whether the parse was successful.
+ * @param payload The payload string.
+ * @return The parsed payload, or @c nullptr if it is not a JSON object.
  */
-static bool parseDocument(const std::string& unparsedDirective, Document* document) {
-    if (!document) {
-        ACSDK_ERROR(LX("parseDocumentFailed").m("nullptr document"));
-        return false;
-    }
-
-    if (!parseJSON(unparsedDirective, document)) {
-        ACSDK_ERROR(LX("parseDocumentFailed").d("uparsedDirective", unparsedDirective));
-        return false;
+static std::shared_ptr<const Value> parsePayloadString(const std::string& payload) {
+    auto document = std::make_shared<Document>();
+    if (document->Parse(payload).HasParseError() || !document->IsObject()) {
+        return nullptr;
     }
-
-    return true;
+    return document;
 }
 
 /**
@@ -170,8 +164,13 @@ std::pair<std::unique_ptr<AVSDirective>, AVSDirective::ParseStatus> AVSDirective
     result.second = ParseStatus::SUCCESS;
 
     Document document;
-    if (!parseDocument(unparsedDirective, &document)) {
-        ACSDK_ERROR(LX("createFailed").m("failed to parse JSON"));
+    ParseResult parseResult = document.Parse(unparsedDirective);
+    if (!parseResult) {
+        ACSDK_ERROR(LX("createFailed")
+                        .m("failed to parse JSON")
+                        .d("reason", GetParseError_En(parseResult.Code()))
+                        .d("offset", parseResult.Offset())
+                        .sensitive("unparsedDirective", unparsedDirective));
         result.second = ParseStatus::ERROR_INVALID_JSON;
         return result;
     }
@@ -227,6 +226,7 @@ AVSDirective::AVSDirective(
     const std::string& attachmentContextId) :
         AVSMessage{avsMessageHeader, payload},
         m_unparsedDirective{unparsedDirective},
+        m_isPayloadParsed{false},
         m_attachmentManager{attachmentManager},
         m_attachmentContextId{attachmentContextId} {
 }
@@ -235,6 +235,16 @@ std::string AVSDirective::getUnparsedDirective() const {
     return m_unparsedDirective;
 }
 
+std::shared_ptr<const Value> AVSDirective::getParsedPayload() const {
+    std::lock_guard<std::mutex> lock(m_parsedPayloadMutex);
+    if (!m_isPayloadParsed) {
+        // Most directives are only parsed by the handler which handles them, so only parse the payload on request.
+        m_parsedPayload = parsePayloadString(getPayload());
+        m_isPayloadParsed = true;
+    }
+    return m_parsedPayload;
+}
+
 }  // namespace avs
 }  // namespace avsCommon
 }  // namespace alexaClientSDK
@@ -16,6 +16,10 @@
 #include "AVSCommon/AVS/Attachment/InProcessAttachmentReader.h"
 #include "AVSCommon/Utils/Logger/Logger.h"
 
+#ifdef SHARED_MEMORY_SDS_SUPPORTED
+#include "AVSCommon/Utils/SDS/SharedMemorySDS.h"
+#endif
+
 using namespace alexaClientSDK::avsCommon::utils;
 
 namespace alexaClientSDK {
@@ -33,14 +37,15 @@ static const std::string TAG("InProcessAttachmentReader");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
-std::unique_ptr<InProcessAttachmentReader> InProcessAttachmentReader::create(
-    SDSTypeReader::Policy policy,
+template <typename StreamType>
+std::unique_ptr<SharedDataStreamAttachmentReader<StreamType>> SharedDataStreamAttachmentReader<StreamType>::create(
+    typename SDSTypeReader::Policy policy,
     std::shared_ptr<SDSType> sds,
     SDSTypeIndex offset,
-    SDSTypeReader::Reference reference,
+    typename SDSTypeReader::Reference reference,
     bool resetOnOverrun) {
-    auto reader =
-        std::unique_ptr<InProcessAttachmentReader>(new InProcessAttachmentReader(policy, sds, resetOnOverrun));
+    auto reader = std::unique_ptr<SharedDataStreamAttachmentReader>(
+        new SharedDataStreamAttachmentReader(policy, sds, resetOnOverrun));
 
     if (!reader->m_reader) {
         ACSDK_ERROR(LX("createFailed").d("reason", "object not fully created"));
@@ -55,8 +60,9 @@ std::unique_ptr<InProcessAttachmentReader> InProcessAttachmentReader::create(
     return reader;
 }
 
-InProcessAttachmentReader::InProcessAttachmentReader(
-    SDSTypeReader::Policy policy,
+template <typename StreamType>
+SharedDataStreamAttachmentReader<StreamType>::SharedDataStreamAttachmentReader(
+    typename SDSTypeReader::Policy policy,
     std::shared_ptr<SDSType> sds,
     bool resetOnOverrun) :
         m_resetOnOverrun{resetOnOverrun} {
@@ -73,11 +79,13 @@ InProcessAttachmentReader::InProcessAttachmentReader(
     }
 }
 
-InProcessAttachmentReader::~InProcessAttachmentReader() {
+template <typename StreamType>
+SharedDataStreamAttachmentReader<StreamType>::~SharedDataStreamAttachmentReader() {
     close();
 }
 
-std::size_t InProcessAttachmentReader::read(
+template <typename StreamType>
+std::size_t SharedDataStreamAttachmentReader<StreamType>::read(
     void* buf,
     std::size_t numBytes,
     ReadStatus* readStatus,
@@ -170,7 +178,8 @@ std::size_t InProcessAttachmentReader::read(
     return bytesRead;
 }
 
-void InProcessAttachmentReader::close(ClosePoint closePoint) {
+template <typename StreamType>
+void SharedDataStreamAttachmentReader<StreamType>::close(ClosePoint closePoint) {
     if (m_reader) {
         switch (closePoint) {
             case ClosePoint::IMMEDIATELY:
@@ -183,22 +192,36 @@ void InProcessAttachmentReader::close(ClosePoint closePoint) {
     }
 }
 
-bool InProcessAttachmentReader::seek(uint64_t offset) {
+template <typename StreamType>
+bool SharedDataStreamAttachmentReader<StreamType>::seek(uint64_t offset) {
     if (m_reader) {
         return m_reader->seek(offset);
     }
     return false;
 }
 
-uint64_t InProcessAttachmentReader::getNumUnreadBytes() {
+template <typename StreamType>
+uint64_t SharedDataStreamAttachmentReader<StreamType>::getNumUnreadBytes() {
     if (m_reader) {
-        return m_reader->tell(utils::sds::InProcessSDS::Reader::Reference::BEFORE_WRITER);
+        return m_reader->tell(SDSTypeReader::Reference::BEFORE_WRITER);
     }
 
     ACSDK_ERROR(LX("getNumUnreadBytesFailed").d("reason", "noReader"));
     return 0;
 }
 
+template <typename StreamType>
+void SharedDataStreamAttachmentReader<StreamType>::setDataAvailableCallback(std::function<void()> callback) {
+    if (m_reader) {
+        m_reader->setDataAvailableCallback(std::move(callback));
+    }
+}
+
+template class SharedDataStreamAttachmentReader<utils::sds::InProcessSDS>;
+#ifdef SHARED_MEMORY_SDS_SUPPORTED
+template class SharedDataStreamAttachmentReader<utils::sds::SharedMemorySDS>;
+#endif
+
 }  // namespace attachment
 }  // namespace avs
 }  // namespace avsCommon
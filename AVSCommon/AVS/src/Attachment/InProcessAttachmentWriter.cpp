@@ -143,6 +143,12 @@ void InProcessAttachmentWriter::close() {
     }
 }
 
+void InProcessAttachmentWriter::setSpaceAvailableCallback(std::function<void()> callback) {
+    if (m_writer) {
+        m_writer->setSpaceAvailableCallback(std::move(callback));
+    }
+}
+
 }  // namespace attachment
 }  // namespace avs
 }  // namespace avsCommon
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/AVS/AudioInputStreamFactory.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("AudioInputStreamFactory");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+std::shared_ptr<AudioInputStream> AudioInputStreamFactory::create(size_t nWords, size_t wordSize, size_t maxReaders) {
+    auto bufferSize = AudioInputStream::calculateBufferSize(nWords, wordSize, maxReaders);
+    if (0 == bufferSize) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "invalidSize"));
+        return nullptr;
+    }
+    auto buffer = std::make_shared<AudioInputStream::Buffer>(bufferSize);
+    std::shared_ptr<AudioInputStream> stream = AudioInputStream::create(buffer, wordSize, maxReaders);
+    if (!stream) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "createStreamFailed"));
+    }
+    return stream;
+}
+
+#ifdef SHARED_MEMORY_AUDIO_INPUT_STREAM
+
+std::shared_ptr<AudioInputStream> AudioInputStreamFactory::createNamed(
+    const std::string& name,
+    size_t nWords,
+    size_t wordSize,
+    size_t maxReaders) {
+    auto bufferSize = AudioInputStream::calculateBufferSize(nWords, wordSize, maxReaders);
+    if (0 == bufferSize) {
+        ACSDK_ERROR(LX("createNamedFailed").d("reason", "invalidSize").d("name", name));
+        return nullptr;
+    }
+    auto buffer = AudioInputStream::Buffer::create(name, bufferSize);
+    if (!buffer) {
+        ACSDK_ERROR(LX("createNamedFailed").d("reason", "createBufferFailed").d("name", name));
+        return nullptr;
+    }
+    std::shared_ptr<AudioInputStream> stream = AudioInputStream::create(buffer, wordSize, maxReaders);
+    if (!stream) {
+        ACSDK_ERROR(LX("createNamedFailed").d("reason", "createStreamFailed").d("name", name));
+    }
+    return stream;
+}
+
+std::shared_ptr<AudioInputStream> AudioInputStreamFactory::attach(const std::string& name) {
+    auto buffer = AudioInputStream::Buffer::open(name);
+    if (!buffer) {
+        ACSDK_ERROR(LX("attachFailed").d("reason", "openBufferFailed").d("name", name));
+        return nullptr;
+    }
+    std::shared_ptr<AudioInputStream> stream = AudioInputStream::open(buffer);
+    if (!stream) {
+        ACSDK_ERROR(LX("attachFailed").d("reason", "openStreamFailed").d("name", name));
+    }
+    return stream;
+}
+
+#else
+
+std::shared_ptr<AudioInputStream> AudioInputStreamFactory::createNamed(
+    const std::string& name,
+    size_t nWords,
+    size_t wordSize,
+    size_t maxReaders) {
+    ACSDK_ERROR(LX("createNamedFailed").d("reason", "sharedMemoryAudioInputStreamDisabled").d("name", name));
+    return nullptr;
+}
+
+std::shared_ptr<AudioInputStream> AudioInputStreamFactory::attach(const std::string& name) {
+    ACSDK_ERROR(LX("attachFailed").d("reason", "sharedMemoryAudioInputStreamDisabled").d("name", name));
+    return nullptr;
+}
+
+#endif  // SHARED_MEMORY_AUDIO_INPUT_STREAM
+
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
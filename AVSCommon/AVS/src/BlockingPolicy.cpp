@@ -0,0 +1,69 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/AVS/BlockingPolicy.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+
+/*
+ * The constants below are initialized from literals only, so that they are constant-initialized and safe to use
+ * from the static initializers of other translation units.
+ */
+
+/// Bit of @c BlockingPolicy::AUDIO in @c BlockingPolicy::Mediums.
+static constexpr unsigned long long AUDIO_BIT = 1ULL << BlockingPolicy::AUDIO;
+
+/// Bit of @c BlockingPolicy::VISUAL in @c BlockingPolicy::Mediums.
+static constexpr unsigned long long VISUAL_BIT = 1ULL << BlockingPolicy::VISUAL;
+
+const BlockingPolicy::Mediums BlockingPolicy::MEDIUM_AUDIO{AUDIO_BIT};
+const BlockingPolicy::Mediums BlockingPolicy::MEDIUM_VISUAL{VISUAL_BIT};
+const BlockingPolicy::Mediums BlockingPolicy::MEDIUMS_AUDIO_AND_VISUAL{AUDIO_BIT | VISUAL_BIT};
+const BlockingPolicy::Mediums BlockingPolicy::MEDIUMS_NONE{0};
+
+const BlockingPolicy BlockingPolicy::NON_BLOCKING{Mediums{AUDIO_BIT | VISUAL_BIT}, false};
+const BlockingPolicy BlockingPolicy::BLOCKING{Mediums{AUDIO_BIT | VISUAL_BIT}, true};
+const BlockingPolicy BlockingPolicy::HANDLE_IMMEDIATELY{Type::HANDLE_IMMEDIATELY, Mediums{0}, false};
+const BlockingPolicy BlockingPolicy::NONE{};
+
+bool BlockingPolicy::isValid() const {
+    return m_type != Type::NONE;
+}
+
+bool BlockingPolicy::isBlocking() const {
+    return Type::QUEUED == m_type && m_isBlocking;
+}
+
+bool BlockingPolicy::isHandleImmediately() const {
+    return Type::HANDLE_IMMEDIATELY == m_type;
+}
+
+BlockingPolicy::Mediums BlockingPolicy::getMediums() const {
+    return m_mediums;
+}
+
+bool BlockingPolicy::operator==(const BlockingPolicy& rhs) const {
+    return m_type == rhs.m_type && m_mediums == rhs.m_mediums && m_isBlocking == rhs.m_isBlocking;
+}
+
+bool BlockingPolicy::operator!=(const BlockingPolicy& rhs) const {
+    return !(*this == rhs);
+}
+
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,282 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+
+#include "AVSCommon/AVS/AVSDirective.h"
+#include "AVSCommon/AVS/Attachment/AttachmentManager.h"
+#include "AVSCommon/Utils/JSON/JSONUtils.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace test {
+
+using namespace avsCommon::avs::attachment;
+using namespace avsCommon::utils::json;
+
+/// The attachment context id of the test directives.
+static const std::string CONTEXT_ID = "contextId";
+
+/// A directive whose payload holds escaped strings, which in-situ parsing unescapes within its own buffer.
+// clang-format off
+static const std::string ESCAPED_DIRECTIVE =
+    "{"
+        "\"directive\":{"
+            "\"header\":{"
+                "\"namespace\":\"AudioPlayer\","
+                "\"name\":\"Play\","
+                "\"messageId\":\"messageId\","
+                "\"dialogRequestId\":\"dialogRequestId\""
+            "},"
+            "\"payload\":{"
+                "\"playBehavior\":\"ENQUEUE\","
+                "\"title\":\"\\\"quoted\\\" \\u00e9\\n\","
+                "\"offsetInMilliseconds\":1500"
+            "}"
+        "}"
+    "}";
+// clang-format on
+
+/// The number of times each benchmark handles its directive.
+static const int BENCHMARK_ITERATIONS = 200;
+
+/// The number of list items in the large @c RenderTemplate directive.
+static const int RENDER_TEMPLATE_LIST_ITEMS = 200;
+
+/// The number of bytes of opaque progress report data in the large @c Play directive.
+static const size_t PLAY_OPAQUE_DATA_SIZE = 16 * 1024;
+
+/**
+ * Wrap a header and payload into a directive.
+ *
+ * @param avsNamespace The namespace of the directive.
+ * @param name The name of the directive.
+ * @param payload The payload of the directive.
+ * @return The unparsed directive.
+ */
+static std::string buildDirective(
+    const std::string& avsNamespace,
+    const std::string& name,
+    const std::string& payload) {
+    return "{\"directive\":{\"header\":{\"namespace\":\"" + avsNamespace + "\",\"name\":\"" + name +
+           "\",\"messageId\":\"messageId\",\"dialogRequestId\":\"dialogRequestId\"},\"payload\":" + payload + "}}";
+}
+
+/**
+ * Build a large @c AudioPlayer.Play directive, standing in for a stream with long opaque tokens.
+ *
+ * @return The unparsed directive.
+ */
+static std::string buildLargePlayDirective() {
+    std::string token(PLAY_OPAQUE_DATA_SIZE, 'a');
+    return buildDirective(
+        "AudioPlayer",
+        "Play",
+        "{\"playBehavior\":\"REPLACE_ALL\",\"audioItem\":{\"audioItemId\":\"" + token +
+            "\",\"stream\":{\"url\":\"https://example.com/stream.mp3\",\"streamFormat\":\"AUDIO_MPEG\","
+            "\"offsetInMilliseconds\":0,\"expiryTime\":\"2018-01-01T00:00:00+0000\",\"token\":\"" +
+            token + "\",\"expectedPreviousToken\":\"" + token +
+            "\",\"progressReport\":{\"progressReportDelayInMilliseconds\":1000,"
+            "\"progressReportIntervalInMilliseconds\":1000}}}}");
+}
+
+/**
+ * Build a large @c TemplateRuntime.RenderTemplate directive, standing in for a long list card.
+ *
+ * @return The unparsed directive.
+ */
+static std::string buildLargeRenderTemplateDirective() {
+    std::string items;
+    for (int i = 0; i < RENDER_TEMPLATE_LIST_ITEMS; ++i) {
+        items += (i ? "," : "") + std::string("{\"leftTextField\":\"") + std::to_string(i) +
+                 ".\",\"rightTextField\":\"An item with a \\\"quoted\\\" title and a longer description\"," +
+                 "\"image\":{\"sources\":[{\"url\":\"https://example.com/image" + std::to_string(i) +
+                 ".png\",\"size\":\"SMALL\",\"widthPixels\":96,\"heightPixels\":96}]}}";
+    }
+    return buildDirective(
+        "TemplateRuntime",
+        "RenderTemplate",
+        "{\"token\":\"token\",\"type\":\"ListTemplate1\",\"title\":{\"mainTitle\":\"Shopping list\","
+        "\"subTitle\":\"Today\"},\"listItems\":[" +
+            items + "]}");
+}
+
+class AVSDirectiveTest : public ::testing::Test {
+public:
+    void SetUp() override;
+
+    /**
+     * Record how long it takes to handle a directive from its unparsed string, by reading the directive's parsed
+     * payload against parsing its payload string again as handlers used to.  The times are recorded as test
+     * properties.
+     *
+     * @param unparsedDirective The unparsed directive.
+     * @param key A key of the payload which a handler reads.
+     */
+    void benchmark(const std::string& unparsedDirective, const std::string& key);
+
+    /// The attachment manager of the directives.
+    std::shared_ptr<AttachmentManager> m_attachmentManager;
+};
+
+void AVSDirectiveTest::SetUp() {
+    m_attachmentManager = std::make_shared<AttachmentManager>(AttachmentManager::AttachmentType::IN_PROCESS);
+}
+
+void AVSDirectiveTest::benchmark(const std::string& unparsedDirective, const std::string& key) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCHMARK_ITERATIONS; ++i) {
+        auto directive = AVSDirective::create(unparsedDirective, m_attachmentManager, CONTEXT_ID).first;
+        ASSERT_TRUE(directive);
+        rapidjson::Document payload;
+        ASSERT_FALSE(payload.Parse(directive->getPayload()).HasParseError());
+        ASSERT_TRUE(payload.HasMember(key));
+    }
+    auto reparsedElapsed = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCHMARK_ITERATIONS; ++i) {
+        auto directive = AVSDirective::create(unparsedDirective, m_attachmentManager, CONTEXT_ID).first;
+        ASSERT_TRUE(directive);
+        auto payload = directive->getParsedPayload();
+        ASSERT_TRUE(payload);
+        ASSERT_TRUE(payload->HasMember(key));
+    }
+    auto parsedElapsed = std::chrono::steady_clock::now() - start;
+
+    auto microseconds = [](std::chrono::steady_clock::duration elapsed) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+    };
+    RecordProperty("directiveBytes", std::to_string(unparsedDirective.size()));
+    RecordProperty("reparsedPayloadUs", std::to_string(microseconds(reparsedElapsed) / BENCHMARK_ITERATIONS));
+    RecordProperty("parsedPayloadUs", std::to_string(microseconds(parsedElapsed) / BENCHMARK_ITERATIONS));
+}
+
+/// Verify that a created directive exposes its payload both as a string and as the equivalent parsed JSON.
+TEST_F(AVSDirectiveTest, parsedPayloadMatchesPayload) {
+    auto result = AVSDirective::create(ESCAPED_DIRECTIVE, m_attachmentManager, CONTEXT_ID);
+    ASSERT_EQ(AVSDirective::ParseStatus::SUCCESS, result.second);
+    auto& directive = result.first;
+    ASSERT_TRUE(directive);
+    EXPECT_EQ(ESCAPED_DIRECTIVE, directive->getUnparsedDirective());
+    EXPECT_EQ("dialogRequestId", directive->getDialogRequestId());
+
+    auto payload = directive->getParsedPayload();
+    ASSERT_TRUE(payload);
+    ASSERT_TRUE(payload->IsObject());
+    std::string title;
+    EXPECT_TRUE(jsonUtils::retrieveValue(*payload, "title", &title));
+    EXPECT_EQ("\"quoted\" \xc3\xa9\n", title);
+    int64_t offset = 0;
+    EXPECT_TRUE(jsonUtils::retrieveValue(*payload, "offsetInMilliseconds", &offset));
+    EXPECT_EQ(1500, offset);
+
+    rapidjson::Document reparsed;
+    ASSERT_TRUE(jsonUtils::parseJSON(directive->getPayload(), &reparsed));
+    EXPECT_TRUE(reparsed == *payload);
+}
+
+/// Verify that the parsed payload stays valid after the directive it came from is destroyed.
+TEST_F(AVSDirectiveTest, parsedPayloadOutlivesDirective) {
+    auto directive = AVSDirective::create(ESCAPED_DIRECTIVE, m_attachmentManager, CONTEXT_ID).first;
+    ASSERT_TRUE(directive);
+    auto payload = directive->getParsedPayload();
+    directive.reset();
+
+    ASSERT_TRUE(payload);
+    std::string playBehavior;
+    EXPECT_TRUE(jsonUtils::retrieveValue(*payload, "playBehavior", &playBehavior));
+    EXPECT_EQ("ENQUEUE", playBehavior);
+}
+
+/// Verify that the payload is parsed once, and that every caller shares the parsed payload.
+TEST_F(AVSDirectiveTest, parsedPayloadIsShared) {
+    auto directive = AVSDirective::create(ESCAPED_DIRECTIVE, m_attachmentManager, CONTEXT_ID).first;
+    ASSERT_TRUE(directive);
+    auto payload = directive->getParsedPayload();
+    ASSERT_TRUE(payload);
+    EXPECT_EQ(payload, directive->getParsedPayload());
+}
+
+/// Verify that a directive created from a payload string parses it, and has no parsed payload if it is not JSON.
+TEST_F(AVSDirectiveTest, createFromPayloadString) {
+    auto header = std::make_shared<AVSMessageHeader>("Speaker", "SetVolume", "messageId");
+    auto directive = AVSDirective::create("", header, "{\"volume\":50}", m_attachmentManager, CONTEXT_ID);
+    ASSERT_TRUE(directive);
+    auto payload = directive->getParsedPayload();
+    ASSERT_TRUE(payload);
+    int64_t volume = 0;
+    EXPECT_TRUE(jsonUtils::retrieveValue(*payload, "volume", &volume));
+    EXPECT_EQ(50, volume);
+
+    directive = AVSDirective::create("", header, "not json", m_attachmentManager, CONTEXT_ID);
+    ASSERT_TRUE(directive);
+    EXPECT_EQ("not json", directive->getPayload());
+    EXPECT_FALSE(directive->getParsedPayload());
+}
+
+/**
+ * Verify that a payload sent as a JSON string is parsed from the string's contents, and that no parsed payload is
+ * given if those contents are not a JSON object.
+ */
+TEST_F(AVSDirectiveTest, stringPayloadIsParsed) {
+    auto result = AVSDirective::create(
+        buildDirective("Speaker", "SetVolume", "\"{\\\"volume\\\":50}\""), m_attachmentManager, CONTEXT_ID);
+    ASSERT_EQ(AVSDirective::ParseStatus::SUCCESS, result.second);
+    ASSERT_TRUE(result.first);
+    EXPECT_EQ("{\"volume\":50}", result.first->getPayload());
+    auto payload = result.first->getParsedPayload();
+    ASSERT_TRUE(payload);
+    ASSERT_TRUE(payload->IsObject());
+    int64_t volume = 0;
+    EXPECT_TRUE(jsonUtils::retrieveValue(*payload, "volume", &volume));
+    EXPECT_EQ(50, volume);
+
+    for (auto stringPayload : {"\"not json\"", "\"50\"", "\"[1,2]\""}) {
+        result = AVSDirective::create(
+            buildDirective("Speaker", "SetVolume", stringPayload), m_attachmentManager, CONTEXT_ID);
+        ASSERT_EQ(AVSDirective::ParseStatus::SUCCESS, result.second) << stringPayload;
+        ASSERT_TRUE(result.first);
+        EXPECT_FALSE(result.first->getParsedPayload()) << stringPayload;
+    }
+}
+
+/// Verify that invalid JSON is still rejected.
+TEST_F(AVSDirectiveTest, invalidJsonIsRejected) {
+    auto result = AVSDirective::create(ESCAPED_DIRECTIVE.substr(1), m_attachmentManager, CONTEXT_ID);
+    EXPECT_FALSE(result.first);
+    EXPECT_EQ(AVSDirective::ParseStatus::ERROR_INVALID_JSON, result.second);
+}
+
+/// Record the cost of handling a large @c AudioPlayer.Play directive.  Disabled by default.
+TEST_F(AVSDirectiveTest, DISABLED_benchmarkLargePlayDirective) {
+    benchmark(buildLargePlayDirective(), "audioItem");
+}
+
+/// Record the cost of handling a large @c TemplateRuntime.RenderTemplate directive.  Disabled by default.
+TEST_F(AVSDirectiveTest, DISABLED_benchmarkLargeRenderTemplateDirective) {
+    benchmark(buildLargeRenderTemplateDirective(), "listItems");
+}
+
+}  // namespace test
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <string>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/AVS/AudioInputStreamFactory.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace test {
+
+/// Word size used by the tests.
+static const size_t WORDSIZE = 2;
+
+/// Number of words in the streams used by the tests.
+static const size_t WORDCOUNT = 160;
+
+/// Maximum number of readers for the streams used by the tests.
+static const size_t MAXREADERS = 2;
+
+/// AudioInputStreamFactoryTest
+class AudioInputStreamFactoryTest : public ::testing::Test {};
+
+/// Verify that @c create() returns a usable stream and rejects invalid sizes.
+TEST_F(AudioInputStreamFactoryTest, testCreate) {
+    ASSERT_FALSE(AudioInputStreamFactory::create(0, WORDSIZE, MAXREADERS));
+
+    auto stream = AudioInputStreamFactory::create(WORDCOUNT, WORDSIZE, MAXREADERS);
+    ASSERT_TRUE(stream);
+    EXPECT_EQ(stream->getDataSize(), WORDCOUNT);
+    EXPECT_EQ(stream->getWordSize(), WORDSIZE);
+    EXPECT_EQ(stream->getMaxReaders(), MAXREADERS);
+}
+
+#ifdef SHARED_MEMORY_AUDIO_INPUT_STREAM
+/// Verify that a stream created with @c createNamed() can be attached to by name.
+TEST_F(AudioInputStreamFactoryTest, testCreateNamedAndAttach) {
+    auto name = "/AudioInputStreamFactoryTest-" + std::to_string(getpid());
+    ASSERT_FALSE(AudioInputStreamFactory::attach(name));
+
+    auto stream = AudioInputStreamFactory::createNamed(name, WORDCOUNT, WORDSIZE, MAXREADERS);
+    ASSERT_TRUE(stream);
+    auto attached = AudioInputStreamFactory::attach(name);
+    ASSERT_TRUE(attached);
+    EXPECT_EQ(attached->getDataSize(), WORDCOUNT);
+
+    auto writer = stream->createWriter(AudioInputStream::Writer::Policy::NONBLOCKABLE);
+    auto reader = attached->createReader(AudioInputStream::Reader::Policy::NONBLOCKING);
+    ASSERT_TRUE(writer);
+    ASSERT_TRUE(reader);
+    uint16_t word = 0x1234;
+    ASSERT_EQ(writer->write(&word, 1), 1);
+    word = 0;
+    ASSERT_EQ(reader->read(&word, 1), 1);
+    EXPECT_EQ(word, 0x1234);
+}
+#else
+/// Verify that named streams are rejected when @c AudioInputStream can't be shared between processes.
+TEST_F(AudioInputStreamFactoryTest, testNamedStreamsUnsupported) {
+    auto name = "/AudioInputStreamFactoryTest-" + std::to_string(getpid());
+    EXPECT_FALSE(AudioInputStreamFactory::createNamed(name, WORDCOUNT, WORDSIZE, MAXREADERS));
+    EXPECT_FALSE(AudioInputStreamFactory::attach(name));
+}
+#endif
+
+}  // namespace test
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_CRYPTO_SHA256_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_CRYPTO_SHA256_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace crypto {
+
+/**
+ * A SHA-256 hash, as specified by FIPS 180-4, computed incrementally.  It is meant for checking the integrity of data,
+ * such as cached files, and is not hardened against side channels.
+ */
+class SHA256 {
+public:
+    /// The length of a digest in hexadecimal.
+    static const size_t DIGEST_HEX_LENGTH = 64;
+
+    /// Constructor.
+    SHA256();
+
+    /**
+     * Hashes more data.
+     *
+     * @param data The data.
+     * @param size The size of the data.
+     */
+    void update(const void* data, size_t size);
+
+    /**
+     * Finishes the hash.  No more data may be hashed.
+     *
+     * @return The digest, in lowercase hexadecimal.
+     */
+    std::string finish();
+
+private:
+    /// Hashes the 64 byte block in @c m_block.
+    void transform();
+
+    /// The hash state.
+    uint32_t m_state[8];
+
+    /// The data which does not fill a block yet.
+    uint8_t m_block[64];
+
+    /// The number of bytes in @c m_block.
+    size_t m_blockSize;
+
+    /// The number of bytes hashed.
+    uint64_t m_length;
+};
+
+}  // namespace crypto
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_CRYPTO_SHA256_H_
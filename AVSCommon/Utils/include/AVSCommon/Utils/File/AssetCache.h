@@ -0,0 +1,266 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_FILE_ASSETCACHE_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_FILE_ASSETCACHE_H_
+
+#include <cstdint>
+#include <future>
+#include <istream>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterfaceFactoryInterface.h>
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
+#include <AVSCommon/Utils/Threading/Executor.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace file {
+
+/**
+ * An on-disk cache of audio assets, such as alert tones and notification sounds, so that they can be played when they
+ * are due without streaming them over the network, or when the network is down.
+ *
+ * Assets are fetched ahead of time with @c prefetch(), and read back with @c open().  Each asset is stored in a file
+ * named after the SHA-256 digest of its content, so that URLs which serve the same content share one file, and the
+ * content is verified against its name whenever it is opened.  The cache is bounded by size: when an asset would
+ * exceed the bound, the assets which were least recently opened or fetched are evicted first.  The index of URLs is
+ * kept in the cache directory, so that the cache survives restarts.
+ *
+ * The cache directory should only be used by the cache.  When the cache is created, it removes the files in it which
+ * are named like the cache's own files, but which the index does not refer to.  Other files are left alone.
+ *
+ * The cache is used when the @c directory of the @c assetCache root of the configuration is set, for example:
+ *
+ * @code{.json}
+ * "assetCache": {
+ *     "directory": "/home/ubuntu/Build/assetCache",
+ *     "maxSizeKB": 10240
+ * }
+ * @endcode
+ *
+ * This class is thread-safe.
+ */
+class AssetCache {
+public:
+    /// Counters of the use of the cache since it was created.
+    struct Statistics {
+        /// The number of assets which were opened from the cache.
+        uint64_t hits;
+        /// The number of assets which were not in the cache when they were opened.
+        uint64_t misses;
+        /// The number of assets which were fetched and stored.
+        uint64_t fetches;
+        /// The number of assets which could not be fetched.
+        uint64_t fetchFailures;
+        /// The number of cached assets which were found to be missing or corrupt, and were dropped.
+        uint64_t integrityFailures;
+        /// The number of assets which were evicted to keep the cache within its size.
+        uint64_t evictions;
+        /// The number of URLs in the cache.
+        size_t entryCount;
+        /// The number of bytes of content in the cache.
+        uint64_t sizeInBytes;
+    };
+
+    /**
+     * Creates a cache from the @c assetCache root of the configuration.
+     *
+     * @param configurationRoot The global config object.
+     * @param contentFetcherFactory Produces the fetchers of the assets.
+     * @return The cache, or @c nullptr if the configuration has no cache directory or the cache could not be created.
+     */
+    static std::shared_ptr<AssetCache> create(
+        const configuration::ConfigurationNode& configurationRoot,
+        std::shared_ptr<sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory);
+
+    /**
+     * Creates a cache.  The directory is created if it does not exist yet, and the assets already in it are loaded.
+     *
+     * @param directory The directory of the cache.  Its parent directory must exist.
+     * @param maxSizeInBytes The largest number of bytes of content the cache may hold.
+     * @param contentFetcherFactory Produces the fetchers of the assets.
+     * @return The cache, or @c nullptr if the directory could not be created or any parameter is invalid.
+     */
+    static std::shared_ptr<AssetCache> create(
+        const std::string& directory,
+        uint64_t maxSizeInBytes,
+        std::shared_ptr<sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory);
+
+    /**
+     * Destructor.  Fetches which have not started are abandoned, and the recency of the assets is saved.
+     */
+    ~AssetCache();
+
+    /**
+     * Fetches and stores assets in the background, skipping those which are already cached.  Only @c http and
+     * @c https URLs are fetched.
+     *
+     * @param urls The URLs of the assets.
+     * @return A future which is @c true when every asset is cached, and @c false if any of them could not be.
+     */
+    std::future<bool> prefetch(const std::vector<std::string>& urls);
+
+    /**
+     * Opens a cached asset.  Its content is read into memory and verified against its digest without blocking other
+     * users of the cache; an asset which is missing or corrupt is dropped from the cache, and fetched again in the
+     * background.
+     *
+     * @param url The URL of the asset.
+     * @return A stream of the content of the asset, or @c nullptr if it is not cached.
+     */
+    std::unique_ptr<std::istream> open(const std::string& url);
+
+    /**
+     * Removes every asset from the cache.
+     */
+    void clear();
+
+    /**
+     * Gets the counters of the use of the cache.
+     *
+     * @return The counters.
+     */
+    Statistics getStatistics() const;
+
+private:
+    /// An asset file, which may be shared by several URLs with the same content.
+    struct File {
+        /// The size of the content.
+        uint64_t size;
+        /// The number of URLs of this content.
+        int referenceCount;
+    };
+
+    /// The digest of the content of a URL, and its position in @c m_recency.
+    struct Entry {
+        /// The SHA-256 digest of the content, in hexadecimal.
+        std::string digest;
+        /// The position of the URL in @c m_recency.
+        std::list<std::string>::iterator recency;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param directory The directory of the cache.
+     * @param maxSizeInBytes The largest number of bytes of content the cache may hold.
+     * @param contentFetcherFactory Produces the fetchers of the assets.
+     */
+    AssetCache(
+        const std::string& directory,
+        uint64_t maxSizeInBytes,
+        std::shared_ptr<sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory);
+
+    /**
+     * Loads the index, dropping the URLs whose files are missing or have the wrong size, and removes the asset and
+     * temporary files which no URL refers to.
+     */
+    void load();
+
+    /**
+     * Fetches and stores an asset, unless it is already cached.  Called on @c m_executor.
+     *
+     * @param url The URL of the asset.
+     * @return Whether the asset is cached.
+     */
+    bool fetch(const std::string& url);
+
+    /**
+     * Downloads an asset to a temporary file.  Called on @c m_executor.
+     *
+     * @param url The URL of the asset.
+     * @param[out] digest The SHA-256 digest of the content, in hexadecimal.
+     * @param[out] size The size of the content.
+     * @return Whether the asset was downloaded.
+     */
+    bool download(const std::string& url, std::string* digest, uint64_t* size);
+
+    /**
+     * Adds a URL to the cache, and evicts the least recently used URLs until the cache is within its size.
+     * @c m_mutex must be locked.
+     *
+     * @param url The URL.
+     * @param digest The digest of its content, whose file is in the cache directory.
+     * @param size The size of its content.
+     */
+    void insertLocked(const std::string& url, const std::string& digest, uint64_t size);
+
+    /**
+     * Removes a URL from the cache, and its file if no other URL refers to it.  @c m_mutex must be locked.
+     *
+     * @param url The URL.
+     */
+    void eraseLocked(const std::string& url);
+
+    /**
+     * Writes the index, least recently used URL first.  @c m_mutex must be locked.
+     */
+    void saveLocked();
+
+    /**
+     * Gets the path of the file of some content.
+     *
+     * @param digest The digest of the content.
+     * @return The path of the file.
+     */
+    std::string getFilePath(const std::string& digest) const;
+
+    /// The directory of the cache, ending with a '/'.
+    const std::string m_directory;
+
+    /// The largest number of bytes of content the cache may hold.
+    const uint64_t m_maxSizeInBytes;
+
+    /// Produces the fetchers of the assets.
+    const std::shared_ptr<sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> m_contentFetcherFactory;
+
+    /// Serializes access to the members below.
+    mutable std::mutex m_mutex;
+
+    /// The entries of the URLs in the cache.
+    std::unordered_map<std::string, Entry> m_entries;
+
+    /// The asset files, by digest.
+    std::unordered_map<std::string, File> m_files;
+
+    /// The URLs in the cache, least recently used first.
+    std::list<std::string> m_recency;
+
+    /// The number of bytes of content in the cache.
+    uint64_t m_sizeInBytes;
+
+    /// Whether the recency of the URLs changed since the index was written.
+    bool m_isIndexStale;
+
+    /// The counters of the use of the cache.
+    Statistics m_statistics;
+
+    /// Fetches assets one at a time.  It is declared last so that it is shut down before the other members are freed.
+    threading::Executor m_executor;
+};
+
+}  // namespace file
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_FILE_ASSETCACHE_H_
@@ -16,9 +16,10 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_HTTP2_HTTP2MIMERESPONSEDECODER_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_HTTP2_HTTP2MIMERESPONSEDECODER_H_
 
+#include <array>
+#include <map>
 #include <memory>
-
-#include <MultipartParser/MultipartReader.h>
+#include <string>
 
 #include "AVSCommon/Utils/HTTP2/HTTP2MimeResponseSinkInterface.h"
 #include "AVSCommon/Utils/HTTP2/HTTP2ResponseSinkInterface.h"
@@ -31,6 +32,12 @@ namespace http2 {
 /**
  * Class that adapts between HTTPResponseSinkInterface and HTTP2MimeResponseSinkInterface providing
  * mime decoding services.
+ *
+ * The decoder is resumable: it never goes back over data it has already handled, so it keeps no copy of its state.
+ * When the sink returns @c PAUSE, the decoder remembers how many bytes of the current chunk it had consumed before
+ * the data that was refused.  The paused chunk is delivered again when the transfer resumes, and the decoder skips
+ * the consumed bytes.  Boundaries in part data are found with a Boyer-Moore-Horspool search, which on typical data
+ * looks at about one byte in every boundary length rather than at every byte.
  */
 class HTTP2MimeResponseDecoder : public HTTP2ResponseSinkInterface {
 public:
@@ -55,27 +62,119 @@ public:
     /// @}
 
 private:
-    /** We will also need to implements the callbacks for @class MultipartReader **/
-    static void partBeginCallback(const MultipartHeaders& headers, void* userData);
-    static void partDataCallback(const char* buffer, size_t size, void* userData);
-    static void partEndCallback(void* userData);
+    /// The states of the parser.
+    enum class State {
+        /// Expecting the first boundary, optionally preceded by a CRLF.
+        START,
+        /// After a boundary.  Expecting CRLF before the next part, or "--" at the end of the body.
+        AFTER_BOUNDARY,
+        /// After a boundary and a CR.  Expecting LF.
+        AFTER_BOUNDARY_CR,
+        /// After a boundary and a hyphen.  Expecting a second hyphen.
+        AFTER_BOUNDARY_HYPHEN,
+        /// Reading the header lines of a part.
+        HEADERS,
+        /// Read an empty line before any headers.  Checking whether a repeated boundary line follows.
+        HEADERS_AFTER_EMPTY_LINE,
+        /// Reading the data of a part.
+        DATA,
+        /// After the closing boundary.  Anything further is ignored.
+        END
+    };
+
+    /**
+     * Parse data until it is all consumed, or the sink pauses or aborts.
+     *
+     * @param bytes The data to parse.
+     * @param size The number of bytes to parse.
+     * @return The number of bytes consumed.  If this is less than @c size, @c m_lastStatus says why.
+     */
+    size_t parse(const char* bytes, size_t size);
+
+    /**
+     * Handle the next byte in states before the headers of a part.
+     *
+     * @param c The byte.
+     */
+    void parseBoundaryByte(char c);
+
+    /**
+     * Parse header lines.
+     *
+     * @param bytes The data to parse.
+     * @param position The offset in @c bytes to start at.
+     * @param size The size of @c bytes.
+     * @return The offset in @c bytes up to which data was consumed.
+     */
+    size_t parseHeaders(const char* bytes, size_t position, size_t size);
+
+    /**
+     * Check whether a repeated boundary line follows an empty line at the start of a part's headers.
+     *
+     * @param bytes The data to parse.
+     * @param position The offset in @c bytes to start at.
+     * @param size The size of @c bytes.
+     * @return The offset in @c bytes up to which data was consumed.
+     */
+    size_t parseAfterEmptyLine(const char* bytes, size_t position, size_t size);
+
+    /**
+     * Parse part data, passing it to the sink, up to and including the next boundary.
+     *
+     * @param bytes The data to parse.
+     * @param position The offset in @c bytes to start at.
+     * @param size The size of @c bytes.
+     * @return The offset in @c bytes up to which data was consumed.
+     */
+    size_t parseData(const char* bytes, size_t position, size_t size);
+
+    /**
+     * Start a part, passing its headers to the sink.
+     */
+    void beginPart();
+
+    /**
+     * Pass part data to the sink, updating @c m_lastStatus.
+     *
+     * @param bytes The data.
+     * @param size The number of bytes.
+     * @return Whether the sink accepted the data.
+     */
+    bool deliverData(const char* bytes, size_t size);
+
+    /**
+     * Stop parsing because the data is malformed.
+     *
+     * @param reason The reason to log.
+     */
+    void abortParse(const char* reason);
 
     /// MIMEResponseSinkInterface implementation to pass MIME data to
     std::shared_ptr<HTTP2MimeResponseSinkInterface> m_sink;
     /// Response code that has been received, or zero.
     long m_responseCode;
-    /// Instance of a multipart MIME reader.
-    MultipartReader m_multipartReader;
     /// Last parse status returned
     HTTP2ReceiveDataStatus m_lastStatus;
-    /// MIME part callbacks on current(or last in case of PAUSE) chunk
-    size_t m_index;
-    /// Number of characters left to check at the beginning of the stream for a leading CRLF sequence.
-    size_t m_leadingCRLFCharsLeftToRemove;
     /// needed to track if boundary has been set
     bool m_boundaryFound;
-    /// last successful MIME part callback on current chunk
-    size_t m_lastSuccessIndex;
+    /// The delimiter between parts: CRLF, two hyphens and the boundary.
+    std::string m_delimiter;
+    /// @c m_delimiter followed by CRLF: a whole boundary line, which is skipped if it is repeated.
+    std::string m_boundaryLine;
+    /// For each byte value, how far the Horspool search for @c m_delimiter may move when the last byte compared is it.
+    std::array<size_t, 256> m_delimiterSkip;
+    /// The current state of the parser.
+    State m_state;
+    /// The number of bytes matched so far of @c m_delimiter or @c m_boundaryLine, depending on @c m_state.
+    size_t m_matched;
+    /// In @c State::DATA, the number of bytes of a partly repeated boundary line to pass to the sink as data first.
+    size_t m_replayLength;
+    /// The header line being read.
+    std::string m_headerLine;
+    /// The headers of the part being read.
+    std::multimap<std::string, std::string> m_headers;
+    /// The number of bytes at the start of the next chunk that were consumed before the last @c PAUSE.
+    size_t m_resumeOffset;
 };
 
 }  // namespace http2
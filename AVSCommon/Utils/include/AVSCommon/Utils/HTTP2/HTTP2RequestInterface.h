@@ -43,6 +43,12 @@ public:
      */
     virtual bool cancel() = 0;
 
+    /**
+     * Resume transfers on this request after its source or sink returned @c PAUSE, because it now has data to send
+     * or space for data to receive.  Transfers which are not resumed this way are retried after a short interval.
+     */
+    virtual void resume() = 0;
+
     /**
      * Get an integer uniquely identifying this request.
      *
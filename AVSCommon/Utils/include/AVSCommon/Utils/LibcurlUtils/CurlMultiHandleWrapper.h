@@ -88,6 +88,40 @@ public:
      */
     CURLMcode wait(std::chrono::milliseconds timeout, int* countHandlesUpdated);
 
+    /**
+     * Whether @c poll() can be interrupted by @c wakeup().  This requires libcurl 7.68.0 or later.
+     *
+     * @return Whether @c poll() can be interrupted by @c wakeup().
+     */
+    static bool isWakeupSupported();
+
+    /**
+     * Like @c wait(), but may be interrupted by a call to @c wakeup() from another thread, if
+     * @c isWakeupSupported().  Otherwise this is the same as @c wait().
+     *
+     * @param timeout How long to wait for actions to perform.
+     * @param[out] countHandlesUpdated The number of handles for which actions are ready to be performed.
+     * @return @c libcurl code indicating the result of this operation.
+     */
+    CURLMcode poll(std::chrono::milliseconds timeout, int* countHandlesUpdated);
+
+    /**
+     * Make a current or the next call to @c poll() return immediately.  This may be called from any thread.  It does
+     * nothing unless @c isWakeupSupported().
+     *
+     * @return @c libcurl code indicating the result of this operation.
+     */
+    CURLMcode wakeup();
+
+    /**
+     * Get how long until @c libcurl needs @c perform() to be called to handle its timeouts, if no socket activity
+     * happens first.
+     *
+     * @param[out] timeout The time until @c perform() is needed, or a negative value if it has no timeout set.
+     * @return @c libcurl code indicating the result of this operation.
+     */
+    CURLMcode timeout(std::chrono::milliseconds* timeout);
+
     /**
      * Receive the next messages about the @c libcurl @c handles added to this @c libcurl @c multi @c handle.
      *
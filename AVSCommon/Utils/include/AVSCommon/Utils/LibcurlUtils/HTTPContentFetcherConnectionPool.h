@@ -0,0 +1,182 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_HTTPCONTENTFETCHERCONNECTIONPOOL_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_HTTPCONTENTFETCHERCONNECTIONPOOL_H_
+
+#include <chrono>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <curl/curl.h>
+
+#include <AVSCommon/Utils/LibcurlUtils/CurlMultiHandleWrapper.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+
+/**
+ * Keeps the connections used by @c LibCurlHttpContentFetcher alive between fetches, so that fetching the next
+ * playlist entry or media segment from the same server does not need a new TCP connection and TLS handshake.
+ *
+ * @c libcurl keeps open connections in the connection cache of the @c multi @c handle which performed the transfer.
+ * The pool keeps the @c multi @c handles of finished fetches, keyed by the scheme, host and port they fetched from,
+ * and hands them to later fetches from the same origin.  All fetches also share one @c libcurl @c share @c handle,
+ * which caches DNS lookups and TLS sessions, so a fetch which needs a new connection can still skip the DNS lookup
+ * and resume the TLS session.
+ *
+ * This class is thread-safe.
+ */
+class HTTPContentFetcherConnectionPool {
+public:
+    /// The default for the maximum number of idle @c multi @c handles kept per origin.
+    static const size_t DEFAULT_MAX_IDLE_PER_ORIGIN = 2;
+
+    /// The default for the maximum number of idle @c multi @c handles kept in total.
+    static const size_t DEFAULT_MAX_IDLE_TOTAL = 8;
+
+    /// The default for how long an idle @c multi @c handle is kept.
+    static const std::chrono::seconds DEFAULT_MAX_IDLE_TIME;
+
+    /**
+     * Create a HTTPContentFetcherConnectionPool.
+     *
+     * @param maxIdlePerOrigin The maximum number of idle @c multi @c handles kept per origin.
+     * @param maxIdleTotal The maximum number of idle @c multi @c handles kept in total.
+     * @param maxIdleTime How long an idle @c multi @c handle is kept before its connections are closed.
+     * @return The new HTTPContentFetcherConnectionPool, or @c nullptr if the operation fails.
+     */
+    static std::shared_ptr<HTTPContentFetcherConnectionPool> create(
+        size_t maxIdlePerOrigin = DEFAULT_MAX_IDLE_PER_ORIGIN,
+        size_t maxIdleTotal = DEFAULT_MAX_IDLE_TOTAL,
+        std::chrono::milliseconds maxIdleTime = DEFAULT_MAX_IDLE_TIME);
+
+    /**
+     * Destructor.  This must not be called while an easy handle still uses @c getShareHandle().
+     */
+    ~HTTPContentFetcherConnectionPool();
+
+    /**
+     * Get a @c multi @c handle to fetch @c url with, holding warm connections to its origin if possible.
+     *
+     * @param url The URL which will be fetched.
+     * @return A @c multi @c handle, or @c nullptr if the operation fails.
+     */
+    std::unique_ptr<CurlMultiHandleWrapper> acquire(const std::string& url);
+
+    /**
+     * Give back a @c multi @c handle after a fetch, so that its connections may be reused.  All easy handles must have
+     * been removed from it.
+     *
+     * @param url The URL passed to @c acquire().
+     * @param multi The @c multi @c handle returned by @c acquire().
+     */
+    void release(const std::string& url, std::unique_ptr<CurlMultiHandleWrapper> multi);
+
+    /**
+     * Get the @c libcurl @c share @c handle to set as @c CURLOPT_SHARE on the easy handles of fetches.
+     *
+     * @return The @c libcurl @c share @c handle.
+     */
+    CURLSH* getShareHandle();
+
+    /**
+     * Get the number of idle @c multi @c handles kept for the origin of a URL.
+     *
+     * @param url The URL.
+     * @return The number of idle @c multi @c handles kept for its origin.
+     */
+    size_t getIdleCount(const std::string& url);
+
+    /**
+     * Get the origin which a URL is pooled by: its lower-cased scheme, host and port, without user info.
+     *
+     * @param url The URL.
+     * @return The origin of the URL, or an empty string if it has no scheme.
+     */
+    static std::string getOrigin(const std::string& url);
+
+private:
+    /// A @c multi @c handle kept for reuse.
+    struct IdleEntry {
+        /// The @c multi @c handle.
+        std::unique_ptr<CurlMultiHandleWrapper> multi;
+        /// When it was released.
+        std::chrono::steady_clock::time_point releaseTime;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param share The @c libcurl @c share @c handle to use.
+     * @param maxIdlePerOrigin The maximum number of idle @c multi @c handles kept per origin.
+     * @param maxIdleTotal The maximum number of idle @c multi @c handles kept in total.
+     * @param maxIdleTime How long an idle @c multi @c handle is kept.
+     */
+    HTTPContentFetcherConnectionPool(
+        CURLSH* share,
+        size_t maxIdlePerOrigin,
+        size_t maxIdleTotal,
+        std::chrono::milliseconds maxIdleTime);
+
+    /**
+     * Remove entries which have been idle too long.  @c m_mutex must be held.
+     *
+     * @param now The current time.
+     */
+    void expireLocked(std::chrono::steady_clock::time_point now);
+
+    /// @c CURLSHOPT_LOCKFUNC for @c m_share.
+    static void lockShare(CURL* handle, curl_lock_data data, curl_lock_access access, void* userData);
+
+    /// @c CURLSHOPT_UNLOCKFUNC for @c m_share.
+    static void unlockShare(CURL* handle, curl_lock_data data, void* userData);
+
+    /// The shared DNS and TLS session caches.
+    CURLSH* m_share;
+
+    /// One mutex per kind of data in @c m_share.
+    std::mutex m_shareMutexes[CURL_LOCK_DATA_LAST];
+
+    /// The maximum number of idle @c multi @c handles kept per origin.
+    const size_t m_maxIdlePerOrigin;
+
+    /// The maximum number of idle @c multi @c handles kept in total.
+    const size_t m_maxIdleTotal;
+
+    /// How long an idle @c multi @c handle is kept.
+    const std::chrono::milliseconds m_maxIdleTime;
+
+    /// Serializes access to @c m_idle and @c m_idleTotal.
+    std::mutex m_mutex;
+
+    /// Idle @c multi @c handles by origin, most recently released last.
+    std::map<std::string, std::deque<IdleEntry>> m_idle;
+
+    /// The number of entries in @c m_idle.
+    size_t m_idleTotal;
+};
+
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_HTTPCONTENTFETCHERCONNECTIONPOOL_H_
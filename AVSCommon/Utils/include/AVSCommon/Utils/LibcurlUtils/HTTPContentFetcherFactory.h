@@ -21,6 +21,7 @@
 
 #include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterface.h>
 #include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterfaceFactoryInterface.h>
+#include <AVSCommon/Utils/LibcurlUtils/HTTPContentFetcherConnectionPool.h>
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -32,7 +33,17 @@ namespace libcurlUtils {
  */
 class HTTPContentFetcherFactory : public avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface {
 public:
+    /**
+     * Constructor.  The fetchers produced share a @c HTTPContentFetcherConnectionPool, so that consecutive fetches
+     * from the same server reuse its connection.
+     */
+    HTTPContentFetcherFactory();
+
     std::unique_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> create(const std::string& url) override;
+
+private:
+    /// The pool shared by the fetchers produced, or @c nullptr if it could not be created.
+    std::shared_ptr<HTTPContentFetcherConnectionPool> m_connectionPool;
 };
 
 }  // namespace libcurlUtils
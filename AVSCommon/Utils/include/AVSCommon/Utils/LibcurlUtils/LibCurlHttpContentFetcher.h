@@ -23,6 +23,7 @@
 
 #include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterface.h>
 #include <AVSCommon/Utils/LibcurlUtils/CurlEasyHandleWrapper.h>
+#include <AVSCommon/Utils/LibcurlUtils/HTTPContentFetcherConnectionPool.h>
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -37,6 +38,15 @@ class LibCurlHttpContentFetcher : public avsCommon::sdkInterfaces::HTTPContentFe
 public:
     LibCurlHttpContentFetcher(const std::string& url);
 
+    /**
+     * Constructor.
+     *
+     * @param url The URL to fetch from.
+     * @param pool The pool to take warm connections from and return them to after the fetch, or @c nullptr to use
+     * new connections.
+     */
+    LibCurlHttpContentFetcher(const std::string& url, std::shared_ptr<HTTPContentFetcherConnectionPool> pool);
+
     /**
      * @copydoc
      * In this implementation, the function may only be called once. Subsequent calls will return @c nullptr.
@@ -60,9 +70,27 @@ private:
     /// A no-op callback to not parse HTTP bodies.
     static size_t noopCallback(char* data, size_t size, size_t nmemb, void* userData);
 
+    /**
+     * Get the @c multi @c handle to perform the fetch with, from @c m_pool if there is one.
+     *
+     * @return The @c multi @c handle, or @c nullptr if the operation fails.
+     */
+    std::unique_ptr<CurlMultiHandleWrapper> acquireMultiHandle();
+
+    /**
+     * Finish with the @c multi @c handle of the fetch, returning it to @c m_pool if there is one.
+     *
+     * @param multi The @c multi @c handle, which must no longer have @c m_curlWrapper added.
+     * @param isReusable Whether the fetch ended without a @c libcurl error, so that its connections may be reused.
+     */
+    void releaseMultiHandle(std::unique_ptr<CurlMultiHandleWrapper> multi, bool isReusable);
+
     /// The URL to fetch from.
     std::string m_url;
 
+    /// The pool of warm connections, or @c nullptr.  Declared before @c m_curlWrapper, which may use its share handle.
+    std::shared_ptr<HTTPContentFetcherConnectionPool> m_pool;
+
     /// A libcurl wrapper.
     CurlEasyHandleWrapper m_curlWrapper;
 
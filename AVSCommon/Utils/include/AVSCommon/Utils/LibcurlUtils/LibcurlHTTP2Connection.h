@@ -16,6 +16,7 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_LIBCURLHTTP2CONNECTION_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_LIBCURLHTTP2CONNECTION_H_
 
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <map>
@@ -83,9 +84,23 @@ private:
 
     /**
      * Main network loop. Repeatedly call curl_multi_perform in order to transfer data on the incorporated streams.
+     * Between calls it sleeps until there is socket activity, a curl timeout or stream activity timeout is due, a
+     * request is added, resumed or cancelled, or a paused stream is due to be retried.
      */
     void networkLoop();
 
+    /**
+     * Wait until there is something for the network loop to do.
+     *
+     * @return @c libcurl code indicating the result of this operation.
+     */
+    CURLMcode waitForActivity();
+
+    /**
+     * Wake the network loop if it is waiting.  May be called from any thread.
+     */
+    void wakeNetworkLoop();
+
     /**
      * Find out whether or not the network loop is stopping.
      *
@@ -117,7 +132,7 @@ private:
     bool areStreamsPaused();
 
     /**
-     * UnPause all the active streams.
+     * Un-pause the paused streams which have been resumed, or have been paused for the retry interval.
      */
     void unPauseActiveStreams();
 
@@ -142,9 +157,9 @@ private:
     std::shared_ptr<LibcurlHTTP2Request> dequeueRequest();
 
     /**
-     * Dequeue next request and add it to the multi-handle
+     * Dequeue the queued requests and add them to the multi-handle.
      */
-    void processNextRequest();
+    void processQueuedRequests();
 
     /// Main thread for this class.
     std::thread m_networkThread;
@@ -168,6 +183,12 @@ private:
 
     /// Set to true when we want to exit the network loop.
     bool m_isStopping;
+
+    /// Wakes the network loop.  Shared with the requests, which may outlive this connection.
+    class NetworkLoopWakeup;
+
+    /// Wakes the network loop when requests are added, resumed or cancelled, or the loop is stopping.
+    std::shared_ptr<NetworkLoopWakeup> m_wakeup;
 };
 
 }  // namespace libcurlUtils
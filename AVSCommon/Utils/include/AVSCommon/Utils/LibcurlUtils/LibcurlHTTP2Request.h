@@ -18,6 +18,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <functional>
 #include <memory>
 
 #include <AVSCommon/Utils/HTTP2/HTTP2RequestConfig.h>
@@ -42,6 +43,7 @@ public:
     /// @name HTTP2RequestInterface methods.
     /// @{
     bool cancel() override;
+    void resume() override;
     std::string getId() const override;
     /// @}
 
@@ -73,6 +75,13 @@ public:
      */
     bool hasProgressTimedOut() const;
 
+    /**
+     * Get the time when @c hasProgressTimedOut() will become true if nothing is transferred before then.
+     *
+     * @return The time, or @c std::chrono::steady_clock::time_point::max() if there is no activity timeout.
+     */
+    std::chrono::steady_clock::time_point getProgressDeadline() const;
+
     /**
      * Whether this request expects that transfer will happen intermittently.
      *
@@ -97,6 +106,28 @@ public:
      */
     bool isPaused() const;
 
+    /**
+     * Get when this stream was last paused.  Only meaningful if @c isPaused().
+     *
+     * @return When this stream was last paused.
+     */
+    std::chrono::steady_clock::time_point getTimeOfPause() const;
+
+    /**
+     * Return whether @c resume() has been called since this stream was last un-paused.
+     *
+     * @return Whether @c resume() has been called since this stream was last un-paused.
+     */
+    bool isResumeRequested() const;
+
+    /**
+     * Set the function to call to wake the network loop when this request is resumed or cancelled.  Must be called
+     * before the request is shared with other threads.
+     *
+     * @param wakeNetworkLoop The function to call.
+     */
+    void setWakeNetworkLoopCallback(std::function<void()> wakeNetworkLoop);
+
     /**
      * Return whether this request has been cancelled.
      *
@@ -180,6 +211,15 @@ private:
     /// Whether this stream has any paused transfers.
     bool m_isPaused;
 
+    /// When this stream was last paused.
+    std::chrono::steady_clock::time_point m_timeOfPause;
+
+    /// Whether @c resume() has been called since this stream was last un-paused.
+    std::atomic_bool m_isResumeRequested;
+
+    /// Called to wake the network loop when this request is resumed or cancelled.
+    std::function<void()> m_wakeNetworkLoop;
+
     /// Whether this request has been cancelled.
     std::atomic_bool m_isCancelled;
 };
@@ -0,0 +1,248 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_ASYNCLOGGER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_ASYNCLOGGER_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Logger/LogStringFormatter.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/**
+ * A @c Logger which writes to a file descriptor (by default, standard output) on a background thread.
+ *
+ * @c emit() only copies the text and metadata of an entry into a fixed-size ring, without taking a lock, so logging
+ * from latency-sensitive threads (audio capture, network I/O) does not wait for formatting or output.  The background
+ * thread formats entries in batches and writes each batch with a single system call.
+ *
+ * When the ring is full, new entries are either dropped (and the number dropped is reported in the log) or the
+ * logging thread waits for space, according to the @c OverflowPolicy.
+ *
+ * Queued entries are written when the process exits normally, or on @c std::terminate().  A crash handler installed by
+ * the application can call @c flush() to write them before the process dies.
+ *
+ * To make this the sink for all SDK logs, run cmake with @c -DACSDK_ASYNC_LOG_SINK=ON.  The instance returned by
+ * @c getAsyncLogger() reads the following (optional) configuration:
+ *
+ * @code{.json}
+ *     "asyncLogger":{
+ *         "logLevel":"DEBUG9",
+ *         "capacity":1024,
+ *         "overflowPolicy":"DROP"
+ *     }
+ * @endcode
+ */
+class AsyncLogger : public Logger {
+public:
+    /// What @c emit() does when the ring is full.
+    enum class OverflowPolicy {
+        /// Drop the entry.  The number of dropped entries is logged once space is available.
+        DROP,
+        /// Wait until the background thread has made space.
+        BLOCK
+    };
+
+    /**
+     * Return the one and only @c AsyncLogger instance, which writes to standard output.
+     *
+     * @return The one and only @c AsyncLogger instance.
+     */
+    static std::shared_ptr<Logger> instance();
+
+    /**
+     * Creates an @c AsyncLogger.
+     *
+     * @param fileDescriptor The file descriptor to write to.  This is not closed by the @c AsyncLogger.
+     * @param capacity The number of entries the ring holds.  This is rounded up to a power of two.
+     * @param overflowPolicy What to do when the ring is full.
+     * @return The new @c AsyncLogger, or @c nullptr if the parameters are invalid.
+     */
+    static std::shared_ptr<AsyncLogger> create(int fileDescriptor, size_t capacity, OverflowPolicy overflowPolicy);
+
+    /// Destructor, which writes any queued entries and stops the background thread.
+    ~AsyncLogger();
+
+    void emit(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker, const char* text)
+        override;
+
+    /**
+     * Writes all queued entries before returning.  This may be called from a crash handler, but note that it is not
+     * async-signal-safe: it is a best-effort attempt to get the last entries out.
+     */
+    void flush();
+
+private:
+    /// An entry in the ring.
+    struct Entry {
+        /// Constructor.
+        Entry();
+
+        /**
+         * Used to hand the entry between producers and the consumer.  It equals the enqueue position at which the
+         * entry is free, or that position plus one once the entry has been filled.
+         */
+        std::atomic<size_t> sequence;
+
+        /// The severity of the log entry.
+        Level level;
+
+        /// The time the log entry was made.
+        std::chrono::system_clock::time_point time;
+
+        /// The moniker of the thread which made the log entry.
+        std::string threadMoniker;
+
+        /// The text of the log entry.  Capacity is reserved up front, so short entries are copied without allocating.
+        std::string text;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param fileDescriptor The file descriptor to write to.
+     * @param capacity The number of entries in the ring, which must be a power of two.
+     * @param overflowPolicy What to do when the ring is full.
+     */
+    AsyncLogger(int fileDescriptor, size_t capacity, OverflowPolicy overflowPolicy);
+
+    /// The main loop of the background thread.
+    void writerLoop();
+
+    /**
+     * Formats and writes queued entries.  @c m_drainMutex must be held.
+     *
+     * @param maxEntries The maximum number of entries to write.
+     * @return The number of entries written.
+     */
+    size_t drainLocked(size_t maxEntries);
+
+    /**
+     * Writes @c m_batch to the file descriptor.  @c m_drainMutex must be held.
+     *
+     * @param count The number of strings in @c m_batch to write.
+     */
+    void writeBatchLocked(size_t count);
+
+    /**
+     * Checks whether there is an entry ready to be written.  @c m_drainMutex must be held.
+     *
+     * @return Whether there is an entry ready to be written.
+     */
+    bool hasEntryLocked() const;
+
+    /// Waits for the background thread to make space in the ring.
+    void waitForSpace();
+
+    /// Stops the background thread, after writing all queued entries.  Entries emitted afterwards are written directly.
+    void stopWriter();
+
+    /// Stops the background thread of the @c instance() @c AsyncLogger.  This is registered with @c std::atexit().
+    static void stopInstanceAtExit();
+
+    /**
+     * Writes queued entries if no other thread is writing, without waiting.  This is safe to call from a terminate
+     * handler, including on the background thread.
+     */
+    void tryFlush();
+
+    /// Flushes the @c instance() @c AsyncLogger as far as possible, then calls the previous terminate handler.
+    static void flushInstanceOnTerminate();
+
+    /// The file descriptor to write to.
+    const int m_fileDescriptor;
+
+    /// What to do when the ring is full.
+    const OverflowPolicy m_overflowPolicy;
+
+    /// The ring of entries.
+    std::vector<Entry> m_entries;
+
+    /// Mask used to convert positions to indices in @c m_entries.
+    const size_t m_mask;
+
+    /// The position at which the next entry will be enqueued.
+    std::atomic<size_t> m_enqueuePos;
+
+    /// The number of entries dropped since the last report.
+    std::atomic<size_t> m_droppedCount;
+
+    /// The number of threads waiting in @c waitForSpace().
+    std::atomic<int> m_waitingProducers;
+
+    /// Whether the background thread is waiting for entries.
+    std::atomic<bool> m_writerSleeping;
+
+    /// Whether the background thread has stopped, so entries should be written directly.
+    std::atomic<bool> m_writerStopped;
+
+    /// Serializes the consumers of the ring: the background thread, @c flush() and direct writes.
+    std::mutex m_drainMutex;
+
+    /// The position of the next entry to write.  Guarded by @c m_drainMutex.
+    size_t m_dequeuePos;
+
+    /// Formats entries.  Guarded by @c m_drainMutex.
+    LogStringFormatter m_logFormatter;
+
+    /// Formatted lines waiting to be written.  Guarded by @c m_drainMutex.
+    std::vector<std::string> m_batch;
+
+    /// Protects sleeping and waking the background thread.
+    std::mutex m_wakeMutex;
+
+    /// Notified when entries are queued, or the background thread should stop.
+    std::condition_variable m_wakeCondition;
+
+    /// Whether the background thread should stop.  Guarded by @c m_wakeMutex.
+    bool m_shutdown;
+
+    /// Protects waiting for space in the ring.
+    std::mutex m_spaceMutex;
+
+    /// Notified when the background thread has made space in the ring.
+    std::condition_variable m_spaceAvailable;
+
+    /// The background thread.
+    std::thread m_writerThread;
+
+    /// The id of the background thread, which remains readable while @c m_writerThread is being joined.
+    std::thread::id m_writerThreadId;
+};
+
+/**
+ * Return the singleton instance of @c AsyncLogger.
+ *
+ * @return The singleton instance of @c AsyncLogger.
+ */
+std::shared_ptr<Logger> getAsyncLogger();
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_ASYNCLOGGER_H_
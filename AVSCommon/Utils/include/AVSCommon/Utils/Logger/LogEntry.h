@@ -18,6 +18,7 @@
 
 #include <sstream>
 #include <string>
+#include <utility>
 
 #include "AVSCommon/Utils/Logger/LogEntryStream.h"
 
@@ -26,6 +27,53 @@ namespace avsCommon {
 namespace utils {
 namespace logger {
 
+/**
+ * A log value which is only computed when it is added to the text of a @c LogEntry.  Create these with @c lazy().
+ *
+ * @tparam Producer The type of a callable which returns the value.
+ */
+template <typename Producer>
+class LazyLogValue {
+public:
+    /**
+     * Constructor.
+     *
+     * @param producer A callable which returns the value.
+     */
+    explicit LazyLogValue(const Producer& producer) : m_producer(producer) {
+    }
+
+    /**
+     * Computes the value.
+     *
+     * @return The value.
+     */
+    auto operator()() const -> decltype(std::declval<const Producer&>()()) {
+        return m_producer();
+    }
+
+private:
+    /// The callable which returns the value.
+    Producer m_producer;
+};
+
+/**
+ * Wraps a callable whose result is to be logged, so that the result is only computed if the log line is emitted.
+ * This is for values which are only needed by a log line, such as a serialized state, and would otherwise be computed
+ * before the @c ACSDK_<LEVEL> macro's level check:
+ *
+ *     ACSDK_DEBUG9(LX("updated").d("state", lazy([&] { return serialize(state); })));
+ *
+ * The callable typically captures by reference, so nothing is copied unless the line is emitted.
+ *
+ * @param producer A callable which returns the value to log.
+ * @return A @c LazyLogValue to pass to @c LogEntry::d().
+ */
+template <typename Producer>
+inline LazyLogValue<Producer> lazy(const Producer& producer) {
+    return LazyLogValue<Producer>(producer);
+}
+
 /// LogEntry is used to compile the log entry text to log via Logger.
 class LogEntry {
 public:
@@ -117,6 +165,17 @@ public:
     template <typename ValueType>
     inline LogEntry& d(const char* key, const ValueType& value);
 
+    /**
+     * Add data in the form of a @c key, @c value pair to the metadata of this log entry, where the value is computed
+     * now, when the entry is being built (which the @c ACSDK_<LEVEL> macros only do if it will be emitted).
+     *
+     * @param key The key identifying the value to add to this LogEntry.
+     * @param value The @c LazyLogValue which computes the value to add to this LogEntry.
+     * @return This instance to facilitate adding more information to this log entry.
+     */
+    template <typename Producer>
+    inline LogEntry& d(const char* key, const LazyLogValue<Producer>& value);
+
     /**
      * Add sensitive data in the form of a @c key, @c value pair to the metadata of this log entry.
      * Because the data is 'sensitive' it will only be emitted in DEBUG builds.
@@ -188,6 +247,11 @@ LogEntry& LogEntry::d(const char* key, const ValueType& value) {
     return *this;
 }
 
+template <typename Producer>
+LogEntry& LogEntry::d(const char* key, const LazyLogValue<Producer>& value) {
+    return d(key, value());
+}
+
 // Define ACSDK_EMIT_SENSITIVE_LOGS if you want to include sensitive data in log output.
 #ifdef ACSDK_EMIT_SENSITIVE_LOGS
 
@@ -113,7 +113,10 @@ namespace logger {
  * logs of severity @c DEBUG0 and above are included in @c DEBUG builds, and logs of severity
  * @c INFO and above are in included in non @c DEBUG builds.  These macros also perform an in-line @c logLevel
  * check before evaluating the @c LX() expression.  That allows much of the CPU overhead of compiled-in log
- * lines to be selectively bypassed at run-time if the @c Logger's log level is set to not emit them.
+ * lines to be selectively bypassed at run-time if the @c Logger's log level is set to not emit them.  Defining
+ * @c ACSDK_MIN_COMPILED_LOG_LEVEL to the name of a level (for example, with the CMake option
+ * @c -DACSDK_MIN_COMPILED_LOG_LEVEL=WARN) also eliminates the log lines of lower severity, so they cost nothing at
+ * run-time.
  *
  * Logging may also be configured on a per-module basis.  Modules are defined by defining
  * @c ACSDK_LOG_MODULE to a common name for all source files in a module.  This name specifies the name
@@ -570,4 +573,113 @@ inline Logger& ACSDK_GET_LOGGER_FUNCTION() {
  */
 #define ACSDK_CRITICAL(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::CRITICAL, entry)
 
+/**
+ * Compile out a log line.  Unlike an empty expansion, @c entry is still type-checked, so that variables only used in
+ * logs do not become unused, but no code is generated for it in optimized builds.
+ *
+ * @param level The log level to associate with the log line.
+ * @param entry The text (or builder of the text) for the log entry.
+ */
+#define ACSDK_LOG_COMPILED_OUT(level, entry) \
+    do {                                     \
+        if (false) {                         \
+            ACSDK_LOG(level, entry);         \
+        }                                    \
+    } while (false)
+
+// Values of each level, in the same order as @c Level, so that the preprocessor can compare them.
+#define ACSDK_LOG_LEVEL_VALUE_DEBUG9   0
+#define ACSDK_LOG_LEVEL_VALUE_DEBUG8   1
+#define ACSDK_LOG_LEVEL_VALUE_DEBUG7   2
+#define ACSDK_LOG_LEVEL_VALUE_DEBUG6   3
+#define ACSDK_LOG_LEVEL_VALUE_DEBUG5   4
+#define ACSDK_LOG_LEVEL_VALUE_DEBUG4   5
+#define ACSDK_LOG_LEVEL_VALUE_DEBUG3   6
+#define ACSDK_LOG_LEVEL_VALUE_DEBUG2   7
+#define ACSDK_LOG_LEVEL_VALUE_DEBUG1   8
+#define ACSDK_LOG_LEVEL_VALUE_DEBUG0   9
+#define ACSDK_LOG_LEVEL_VALUE_INFO     10
+#define ACSDK_LOG_LEVEL_VALUE_WARN     11
+#define ACSDK_LOG_LEVEL_VALUE_ERROR    12
+#define ACSDK_LOG_LEVEL_VALUE_CRITICAL 13
+
+#ifdef ACSDK_MIN_COMPILED_LOG_LEVEL
+
+/// The value of the lowest level of logs to compile in.
+#define ACSDK_MIN_COMPILED_LOG_LEVEL_VALUE ACSDK_CONCATENATE(ACSDK_LOG_LEVEL_VALUE_, ACSDK_MIN_COMPILED_LOG_LEVEL)
+
+#if defined(ACSDK_DEBUG_LOG_ENABLED) && ACSDK_MIN_COMPILED_LOG_LEVEL_VALUE > ACSDK_LOG_LEVEL_VALUE_DEBUG9
+#undef ACSDK_DEBUG9
+#define ACSDK_DEBUG9(entry) ACSDK_LOG_COMPILED_OUT(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG9, entry)
+#endif
+
+#if defined(ACSDK_DEBUG_LOG_ENABLED) && ACSDK_MIN_COMPILED_LOG_LEVEL_VALUE > ACSDK_LOG_LEVEL_VALUE_DEBUG8
+#undef ACSDK_DEBUG8
+#define ACSDK_DEBUG8(entry) ACSDK_LOG_COMPILED_OUT(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG8, entry)
+#endif
+
+#if defined(ACSDK_DEBUG_LOG_ENABLED) && ACSDK_MIN_COMPILED_LOG_LEVEL_VALUE > ACSDK_LOG_LEVEL_VALUE_DEBUG7
+#undef ACSDK_DEBUG7
+#define ACSDK_DEBUG7(entry) ACSDK_LOG_COMPILED_OUT(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG7, entry)
+#endif
+
+#if defined(ACSDK_DEBUG_LOG_ENABLED) && ACSDK_MIN_COMPILED_LOG_LEVEL_VALUE > ACSDK_LOG_LEVEL_VALUE_DEBUG6
+#undef ACSDK_DEBUG6
+#define ACSDK_DEBUG6(entry) ACSDK_LOG_COMPILED_OUT(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG6, entry)
+#endif
+
+#if defined(ACSDK_DEBUG_LOG_ENABLED) && ACSDK_MIN_COMPILED_LOG_LEVEL_VALUE > ACSDK_LOG_LEVEL_VALUE_DEBUG5
+#undef ACSDK_DEBUG5
+#define ACSDK_DEBUG5(entry) ACSDK_LOG_COMPILED_OUT(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG5, entry)
+#endif
+
+#if defined(ACSDK_DEBUG_LOG_ENABLED) && ACSDK_MIN_COMPILED_LOG_LEVEL_VALUE > ACSDK_LOG_LEVEL_VALUE_DEBUG4
+#undef ACSDK_DEBUG4
+#define ACSDK_DEBUG4(entry) ACSDK_LOG_COMPILED_OUT(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG4, entry)
+#endif
+
+#if defined(ACSDK_DEBUG_LOG_ENABLED) && ACSDK_MIN_COMPILED_LOG_LEVEL_VALUE > ACSDK_LOG_LEVEL_VALUE_DEBUG3
+#undef ACSDK_DEBUG3
+#define ACSDK_DEBUG3(entry) ACSDK_LOG_COMPILED_OUT(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG3, entry)
+#endif
+
+#if defined(ACSDK_DEBUG_LOG_ENABLED) && ACSDK_MIN_COMPILED_LOG_LEVEL_VALUE > ACSDK_LOG_LEVEL_VALUE_DEBUG2
+#undef ACSDK_DEBUG2
+#define ACSDK_DEBUG2(entry) ACSDK_LOG_COMPILED_OUT(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG2, entry)
+#endif
+
+#if defined(ACSDK_DEBUG_LOG_ENABLED) && ACSDK_MIN_COMPILED_LOG_LEVEL_VALUE > ACSDK_LOG_LEVEL_VALUE_DEBUG1
+#undef ACSDK_DEBUG1
+#define ACSDK_DEBUG1(entry) ACSDK_LOG_COMPILED_OUT(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG1, entry)
+#endif
+
+#if defined(ACSDK_DEBUG_LOG_ENABLED) && ACSDK_MIN_COMPILED_LOG_LEVEL_VALUE > ACSDK_LOG_LEVEL_VALUE_DEBUG0
+#undef ACSDK_DEBUG0
+#define ACSDK_DEBUG0(entry) ACSDK_LOG_COMPILED_OUT(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG0, entry)
+#undef ACSDK_DEBUG
+#define ACSDK_DEBUG(entry) ACSDK_DEBUG0(entry)
+#endif
+
+#if ACSDK_MIN_COMPILED_LOG_LEVEL_VALUE > ACSDK_LOG_LEVEL_VALUE_INFO
+#undef ACSDK_INFO
+#define ACSDK_INFO(entry) ACSDK_LOG_COMPILED_OUT(alexaClientSDK::avsCommon::utils::logger::Level::INFO, entry)
+#endif
+
+#if ACSDK_MIN_COMPILED_LOG_LEVEL_VALUE > ACSDK_LOG_LEVEL_VALUE_WARN
+#undef ACSDK_WARN
+#define ACSDK_WARN(entry) ACSDK_LOG_COMPILED_OUT(alexaClientSDK::avsCommon::utils::logger::Level::WARN, entry)
+#endif
+
+#if ACSDK_MIN_COMPILED_LOG_LEVEL_VALUE > ACSDK_LOG_LEVEL_VALUE_ERROR
+#undef ACSDK_ERROR
+#define ACSDK_ERROR(entry) ACSDK_LOG_COMPILED_OUT(alexaClientSDK::avsCommon::utils::logger::Level::ERROR, entry)
+#endif
+
+#if ACSDK_MIN_COMPILED_LOG_LEVEL_VALUE > ACSDK_LOG_LEVEL_VALUE_CRITICAL
+#undef ACSDK_CRITICAL
+#define ACSDK_CRITICAL(entry) ACSDK_LOG_COMPILED_OUT(alexaClientSDK::avsCommon::utils::logger::Level::CRITICAL, entry)
+#endif
+
+#endif  // ACSDK_MIN_COMPILED_LOG_LEVEL
+
 #endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGGER_H_
@@ -18,6 +18,7 @@
 
 #include <AVSCommon/Utils/Logger/LogEntry.h>
 #include <AVSCommon/AVS/AVSMessage.h>
+#include <AVSCommon/Utils/Metrics/LatencyTracer.h>
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -78,6 +79,24 @@ public:
         const std::shared_ptr<alexaClientSDK::avsCommon::avs::AVSMessage> msg,
         Location location);
 
+    /**
+     * Record a @c LatencyTracer event for a metric.  The event's id is the hash of @c dialogRequestId if there is one,
+     * otherwise of @c messageId.
+     *
+     * @param messageId The message ID.
+     * @param dialogRequestId The dialog request ID of the message
+     * @param location The location in which the metric was issued.
+     */
+    static void trace(const std::string& messageId, const std::string& dialogRequestId, Location location);
+
+    /**
+     * Record a @c LatencyTracer event for a metric.
+     *
+     * @param msg The @c AVSMessage related to this metric
+     * @param location The location in which the metric was issued.
+     */
+    static void trace(const std::shared_ptr<alexaClientSDK::avsCommon::avs::AVSMessage> msg, Location location);
+
 private:
     /**
      * Translate @c Location into a string representation.
@@ -111,6 +130,9 @@ private:
  */
 #define ACSDK_METRIC_IDS(TAG, name, messageId, dialogRequestId, location)                                   \
     do {                                                                                                    \
+        if (alexaClientSDK::avsCommon::utils::metrics::LatencyTracer::isEnabled()) {                        \
+            alexaClientSDK::avsCommon::utils::Metrics::trace(messageId, dialogRequestId, location);         \
+        }                                                                                                   \
         alexaClientSDK::avsCommon::utils::logger::LogEntry logEntry(                                        \
             TAG, __func__ + alexaClientSDK::avsCommon::utils::METRICS_TAG);                                 \
         alexaClientSDK::avsCommon::utils::Metrics::d(logEntry, name, messageId, dialogRequestId, location); \
@@ -124,18 +146,22 @@ private:
  * @param msg The text (or builder of the text) for the log entry.
  * @param location The location where this message was issued.
  */
-#define ACSDK_METRIC_MSG(TAG, msg, location)                                   \
-    do {                                                                       \
-        alexaClientSDK::avsCommon::utils::logger::LogEntry logEntry(           \
-            TAG, __func__ + alexaClientSDK::avsCommon::utils::METRICS_TAG);    \
-        alexaClientSDK::avsCommon::utils::Metrics::d(logEntry, msg, location); \
-        ACSDK_METRIC_WITH_ENTRY(logEntry);                                     \
+#define ACSDK_METRIC_MSG(TAG, msg, location)                                         \
+    do {                                                                             \
+        if (alexaClientSDK::avsCommon::utils::metrics::LatencyTracer::isEnabled()) { \
+            alexaClientSDK::avsCommon::utils::Metrics::trace(msg, location);         \
+        }                                                                            \
+        alexaClientSDK::avsCommon::utils::logger::LogEntry logEntry(                 \
+            TAG, __func__ + alexaClientSDK::avsCommon::utils::METRICS_TAG);          \
+        alexaClientSDK::avsCommon::utils::Metrics::d(logEntry, msg, location);       \
+        ACSDK_METRIC_WITH_ENTRY(logEntry);                                           \
     } while (false)
 
 #else  // ACSDK_LATENCY_LOG_ENABLED
 
 /**
- * Compile out a METRIC log line.
+ * Compile out a METRIC log line, but still record a trace event if tracing is enabled.  The arguments are not
+ * evaluated while tracing is disabled.
  *
  * @param TAG The name of the source of the log entry
  * @param name The Event \ Directive name.
@@ -143,16 +169,26 @@ private:
  * @param dialogRequestId The dialog request ID of the Event \ Directive
  * @param location The location where this message was issued.
  */
-#define ACSDK_METRIC_IDS(TAG, name, messageId, dialogRequestId, location)
+#define ACSDK_METRIC_IDS(TAG, name, messageId, dialogRequestId, location)                           \
+    do {                                                                                            \
+        if (alexaClientSDK::avsCommon::utils::metrics::LatencyTracer::isEnabled()) {                \
+            alexaClientSDK::avsCommon::utils::Metrics::trace(messageId, dialogRequestId, location); \
+        }                                                                                           \
+    } while (false)
 
 /**
- * Compile out a METRIC log line.
+ * Compile out a METRIC log line, but still record a trace event if tracing is enabled.
  *
  * @param TAG The name of the source of the log entry
  * @param msg The text (or builder of the text) for the log entry.
  * @param location The location where this message was issued.
  */
-#define ACSDK_METRIC_MSG(TAG, msg, location)
+#define ACSDK_METRIC_MSG(TAG, msg, location)                                         \
+    do {                                                                             \
+        if (alexaClientSDK::avsCommon::utils::metrics::LatencyTracer::isEnabled()) { \
+            alexaClientSDK::avsCommon::utils::Metrics::trace(msg, location);         \
+        }                                                                            \
+    } while (false)
 
 #endif  // ACSDK_LATENCY_LOG_ENABLED
 
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_CHROMETRACEEXPORTER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_CHROMETRACEEXPORTER_H_
+
+#include <memory>
+#include <ostream>
+
+#include "AVSCommon/Utils/Metrics/TraceExporterInterface.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace metrics {
+
+/**
+ * A @c TraceExporterInterface which writes events in the Chrome trace event JSON format, which can be loaded into
+ * chrome://tracing or the Perfetto UI.  Each event becomes an instant event named after its @c TracePoint, on a track
+ * per recording thread, with its id (in hex) as an argument, so that the events of one interaction can be found by id.
+ */
+class ChromeTraceExporter : public TraceExporterInterface {
+public:
+    /**
+     * Creates a @c ChromeTraceExporter.
+     *
+     * @param stream The stream to write to.
+     * @return The new @c ChromeTraceExporter, or @c nullptr if @c stream is @c nullptr.
+     */
+    static std::unique_ptr<ChromeTraceExporter> create(std::shared_ptr<std::ostream> stream);
+
+    /// @name TraceExporterInterface methods
+    /// @{
+    bool exportEvents(const std::vector<TraceEvent>& events) override;
+    /// @}
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param stream The stream to write to.
+     */
+    explicit ChromeTraceExporter(std::shared_ptr<std::ostream> stream);
+
+    /// The stream to write to.
+    std::shared_ptr<std::ostream> m_stream;
+};
+
+}  // namespace metrics
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_CHROMETRACEEXPORTER_H_
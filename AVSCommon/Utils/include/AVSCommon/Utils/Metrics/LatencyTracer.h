@@ -0,0 +1,179 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_LATENCYTRACER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_LATENCYTRACER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace metrics {
+
+class TraceExporterInterface;
+
+/**
+ * The points in the SDK at which trace events are recorded.  The first six match the locations of the text
+ * @c ACSDK_METRIC_IDS and @c ACSDK_METRIC_MSG logs (see @c Metrics::Location), which also record trace events.
+ */
+enum class TracePoint : uint32_t {
+    /// A directive was enqueued in ADSL.
+    ADSL_ENQUEUE,
+    /// A directive was dequeued in ADSL.
+    ADSL_DEQUEUE,
+    /// SpeechSynthesizer received a directive, or started or finished speaking.
+    SPEECH_SYNTHESIZER_RECEIVE,
+    /// AudioInputProcessor received a directive, or started recognizing.
+    AIP_RECEIVE,
+    /// AudioInputProcessor sent a Recognize event.
+    AIP_SEND,
+    /// An event was built.
+    BUILDING_MESSAGE,
+    /// A keyword detector detected the wake word.
+    KEYWORD_DETECTED,
+    /**
+     * A @c SharedDataStream reader consumed data for the first time.  Later reads are not recorded, so that streaming
+     * audio does not evict other events from the rings.  The id is the reader's id.
+     */
+    SDS_READ,
+    /// A stream carrying an event was opened to AVS.  The id is the hash of the event's dialogRequestId or messageId.
+    MESSAGE_STREAM_OPENED,
+    /**
+     * The response to a stream started to arrive.  The id is the hash of the event's dialogRequestId or messageId, or
+     * zero for the downchannel.
+     */
+    FIRST_RESPONSE_BYTE,
+    /**
+     * A MIME part of a response started.  The id is the hash of the event's dialogRequestId or messageId, or zero for
+     * the downchannel.
+     */
+    MIME_PART_BEGIN,
+    /// A @c MediaPlayer started playing.  The id is the @c SourceId.
+    MEDIA_PLAYER_PLAYING,
+    /// A @c MediaPlayer set a source.  The id is the @c SourceId.
+    MEDIA_PLAYER_SOURCE_SET
+};
+
+/**
+ * Returns the name of a @c TracePoint.
+ *
+ * @param point The @c TracePoint.
+ * @return The name of @c point.
+ */
+const char* tracePointToString(TracePoint point);
+
+/// A trace event, as returned by @c LatencyTracer::snapshot().
+struct TraceEvent {
+    /// When the event was recorded, in nanoseconds on @c std::chrono::steady_clock.
+    uint64_t timestamp;
+
+    /// The id the event relates to (usually the hash of a messageId or dialogRequestId), or zero.
+    uint64_t id;
+
+    /// Where the event was recorded.
+    TracePoint point;
+
+    /// Identifies the buffer, and so the thread, the event was recorded in.
+    uint32_t thread;
+};
+
+/**
+ * A process-wide, always-on trace of latency-critical points in the SDK, such as wake word detection, the first byte
+ * of a response and the start of playback.
+ *
+ * Each thread records fixed-size events into its own ring of @c EVENTS_PER_THREAD events, without locking or
+ * allocating, so that recording costs tens of nanoseconds.  When a ring is full the oldest events are overwritten.
+ * @c snapshot() collects the events from all rings, and @c exportTo() passes them to a @c TraceExporterInterface (for
+ * example, @c ChromeTraceExporter) for offline analysis.
+ *
+ * Rings are kept when their thread exits, and reused by threads started later, so the number of rings is bounded by
+ * the number of threads which record events concurrently.
+ */
+class LatencyTracer {
+public:
+    /// The number of events each thread's ring holds.
+    static const size_t EVENTS_PER_THREAD = 4096;
+
+    /**
+     * Records a trace event on the calling thread.
+     *
+     * @param point Where the event is recorded.
+     * @param id The id the event relates to, or zero.
+     */
+    static void record(TracePoint point, uint64_t id = 0);
+
+    /**
+     * Records a trace event on the calling thread.
+     *
+     * @param point Where the event is recorded.
+     * @param id The messageId, dialogRequestId or other string id the event relates to.  This is hashed with
+     *     @c hashId().
+     */
+    static void record(TracePoint point, const std::string& id);
+
+    /**
+     * Hashes a string id to the 64-bit value stored in a @c TraceEvent.
+     *
+     * @param id The string id.
+     * @return The 64-bit FNV-1a hash of @c id, or zero if @c id is empty.
+     */
+    static uint64_t hashId(const std::string& id);
+
+    /**
+     * Enables or disables recording.  Tracing is enabled by default.
+     *
+     * @param enabled Whether to record events.
+     */
+    static void setEnabled(bool enabled);
+
+    /**
+     * Returns whether recording is enabled.
+     *
+     * @return Whether recording is enabled.
+     */
+    static bool isEnabled();
+
+    /**
+     * Discards the events recorded so far from future snapshots.
+     */
+    static void clear();
+
+    /**
+     * Collects the events currently held in all threads' rings.  Events which are overwritten while being collected
+     * are left out.
+     *
+     * @return The events, ordered by timestamp.
+     */
+    static std::vector<TraceEvent> snapshot();
+
+    /**
+     * Passes a @c snapshot() to an exporter.
+     *
+     * @param exporter The exporter.
+     * @return Whether the exporter succeeded.
+     */
+    static bool exportTo(TraceExporterInterface& exporter);
+};
+
+}  // namespace metrics
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_LATENCYTRACER_H_
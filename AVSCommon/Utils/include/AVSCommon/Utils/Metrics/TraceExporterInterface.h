@@ -0,0 +1,52 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_TRACEEXPORTERINTERFACE_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_TRACEEXPORTERINTERFACE_H_
+
+#include <vector>
+
+#include "AVSCommon/Utils/Metrics/LatencyTracer.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace metrics {
+
+/**
+ * Interface for writing the events collected by @c LatencyTracer in some format for offline analysis.
+ */
+class TraceExporterInterface {
+public:
+    /**
+     * Destructor.
+     */
+    virtual ~TraceExporterInterface() = default;
+
+    /**
+     * Writes a set of trace events.
+     *
+     * @param events The events, ordered by timestamp.
+     * @return Whether the events were written.
+     */
+    virtual bool exportEvents(const std::vector<TraceEvent>& events) = 0;
+};
+
+}  // namespace metrics
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_TRACEEXPORTERINTERFACE_H_
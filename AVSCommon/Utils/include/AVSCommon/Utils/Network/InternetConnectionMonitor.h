@@ -26,6 +26,7 @@
 #include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterfaceFactoryInterface.h>
 #include <AVSCommon/SDKInterfaces/InternetConnectionMonitorInterface.h>
 #include <AVSCommon/SDKInterfaces/InternetConnectionObserverInterface.h>
+#include <AVSCommon/Utils/Threading/Executor.h>
 #include <AVSCommon/Utils/Timing/Timer.h>
 
 namespace alexaClientSDK {
@@ -111,7 +112,7 @@ private:
     /// The period (in seconds) after which the monitor should re-test internet connection.
     std::chrono::seconds m_period;
 
-    /// The timer that will call testConnection() every m_period seconds.
+    /// The timer that will queue testConnection() on @c m_executor every m_period seconds.
     avsCommon::utils::timing::Timer m_connectionTestTimer;
 
     /// The stream that will hold downloaded data.
@@ -122,6 +123,12 @@ private:
 
     /// Mutex to serialize access to m_connected and m_observers.
     std::mutex m_mutex;
+
+    /**
+     * The executor which runs testConnection().  The test blocks on network I/O, so it must not run on the shared
+     * timer thread.  This is declared last so that it is shut down before the members used by the test are destroyed.
+     */
+    avsCommon::utils::threading::Executor m_executor;
 };
 
 }  // namespace network
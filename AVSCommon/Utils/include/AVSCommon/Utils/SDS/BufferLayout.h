@@ -16,8 +16,12 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_BUFFERLAYOUT_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_BUFFERLAYOUT_H_
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstddef>
+#include <functional>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -43,7 +47,7 @@ public:
     static const uint32_t MAGIC_NUMBER = 0x53445348;
 
     /// Version of this header layout.
-    static const uint32_t VERSION = 2;
+    static const uint32_t VERSION = 3;
 
     /**
      * The constructor only initializes a shared pointer to the provided buffer.  Attaching and/or initializing is
@@ -56,6 +60,33 @@ public:
     /// The destructor ensures the BufferLayout is @c detach()es from the Buffer.
     ~BufferLayout();
 
+    /// The kinds of progress which a @c Reader or @c Writer can wait to be called back for.
+    enum class Progress {
+        /// A @c Writer has published data, or has closed.
+        DATA_AVAILABLE,
+        /// A @c Reader has consumed data, making space for a @c Writer.
+        SPACE_AVAILABLE
+    };
+
+    /**
+     * A function which a @c Reader or @c Writer has asked to be called once it can make progress again.  Unlike the
+     * @c Header, these are local to the process, so they are only called for progress made in this process.
+     */
+    struct ProgressCallback {
+        /**
+         * Constructor.
+         *
+         * @param callback The function to call.
+         */
+        ProgressCallback(std::function<void()> callback);
+
+        /// The function to call.
+        const std::function<void()> callback;
+
+        /// Whether @c callback is waiting to be called.
+        std::atomic<bool> isArmed;
+    };
+
     /**
      * This structure defines the header fields for the @c Buffer.  The header fields in the shared @c Buffer are the
      * mechanism by which SDS instances in different processes share state.  When initializing a new @c Buffer, this
@@ -101,6 +132,13 @@ public:
         /// This field contains the mutex used by @c dataAvailableConditionVariable.
         Mutex dataAvailableMutex;
 
+        /**
+         * This field counts the @c Readers which are currently blocked (or about to block) on
+         * @c dataAvailableConditionVariable.  It is only maintained when @c T::notifyBlockedReadersOnly is @c true,
+         * in which case @c Writers skip locking @c dataAvailableMutex and notifying while it is zero.
+         */
+        AtomicIndex blockedReaderCount;
+
         /**
          * This field contains the condition variable used to notify @c Writers that space is available.  Note that
          * this condition variable does not have a dedicated mutex; the condition is protected by backwardSeekMutex.
@@ -328,7 +366,67 @@ public:
      */
     void updateOldestUnconsumedCursorLocked();
 
+    /**
+     * This function adds a function to call when the specified @c Progress is made.  The function is not called until
+     * it is armed with @c armProgressCallback(), and it is called at most once each time it is armed.
+     *
+     * @param progress The @c Progress to call @c callback for.
+     * @param callback The function to call.  It may be called from any thread, so it should return quickly, and it
+     *     must not call back into this stream.
+     * @return The @c ProgressCallback to pass to @c armProgressCallback() and @c removeProgressCallback().
+     */
+    std::shared_ptr<ProgressCallback> addProgressCallback(Progress progress, std::function<void()> callback);
+
+    /**
+     * This function removes a function added with @c addProgressCallback().  The function will not be called after
+     * this returns.
+     *
+     * @param progress The @c Progress the function was added for.
+     * @param callback The @c ProgressCallback returned by @c addProgressCallback().
+     */
+    void removeProgressCallback(Progress progress, std::shared_ptr<ProgressCallback> callback);
+
+    /**
+     * This function arms a function added with @c addProgressCallback(), so that the next @c notifyProgress() calls
+     * it.  Progress made just before arming does not call it, so callers must check for progress again afterwards.
+     *
+     * @param progress The @c Progress the function was added for.
+     * @param callback The @c ProgressCallback returned by @c addProgressCallback().
+     */
+    void armProgressCallback(Progress progress, std::shared_ptr<ProgressCallback> callback);
+
+    /**
+     * This function calls, and disarms, the armed functions waiting for the specified @c Progress.  It only takes a
+     * lock when a function is armed.
+     *
+     * @param progress The @c Progress which has been made.
+     */
+    void notifyProgress(Progress progress);
+
 private:
+    /// The functions waiting for one kind of @c Progress.
+    struct ProgressCallbacks {
+        /// Constructor.
+        ProgressCallbacks();
+
+        /// Serializes changes to @c callbacks and calls to them.
+        std::mutex mutex;
+
+        /// The functions added with @c addProgressCallback().
+        std::vector<std::shared_ptr<ProgressCallback>> callbacks;
+
+        /// The number of @c callbacks which are armed, so that @c notifyProgress() can return early without locking.
+        std::atomic<size_t> armedCount;
+    };
+
+    /**
+     * This function returns the functions waiting for the specified @c Progress.
+     *
+     * @param progress The @c Progress to return the functions for.
+     * @return The functions waiting for @c progress.
+     */
+    ProgressCallbacks& getProgressCallbacks(Progress progress);
+
     /**
      * This function calculates a 32-bit stable hash of the provided string.  Note that this hash is just used for
      * basic verification, and does not need to meet stringent security requirements.
@@ -411,6 +509,12 @@ private:
 
     /// Precalculated pointer to the circular data.
     uint8_t* m_data;
+
+    /// The functions waiting for @c Progress::DATA_AVAILABLE.
+    ProgressCallbacks m_dataAvailableCallbacks;
+
+    /// The functions waiting for @c Progress::SPACE_AVAILABLE.
+    ProgressCallbacks m_spaceAvailableCallbacks;
 };
 
 template <typename T>
@@ -431,6 +535,16 @@ SharedDataStream<T>::BufferLayout::~BufferLayout() {
     detach();
 }
 
+template <typename T>
+SharedDataStream<T>::BufferLayout::ProgressCallback::ProgressCallback(std::function<void()> callback) :
+        callback{std::move(callback)},
+        isArmed{false} {
+}
+
+template <typename T>
+SharedDataStream<T>::BufferLayout::ProgressCallbacks::ProgressCallbacks() : armedCount{0} {
+}
+
 template <typename T>
 typename SharedDataStream<T>::BufferLayout::Header* SharedDataStream<T>::BufferLayout::getHeader() const {
     return reinterpret_cast<Header*>(m_buffer->data());
@@ -504,6 +618,7 @@ bool SharedDataStream<T>::BufferLayout::init(size_t wordSize, size_t maxReaders)
     header->writeStartCursor = 0;
     header->writeEndCursor = 0;
     header->oldestUnconsumedCursor = 0;
+    header->blockedReaderCount = 0;
     header->referenceCount = 1;
 
     // Reader arrays initialization.
@@ -604,7 +719,7 @@ void SharedDataStream<T>::BufferLayout::disableReaderLocked(size_t id) {
 
 template <typename T>
 typename SharedDataStream<T>::Index SharedDataStream<T>::BufferLayout::wordsUntilWrap(Index after) const {
-    return alignSizeTo(after, getDataSize()) - after;
+    return getDataSize() - (after % getDataSize());
 }
 
 template <typename T>
@@ -664,7 +779,62 @@ void SharedDataStream<T>::BufferLayout::updateOldestUnconsumedCursorLocked() {
         // Notify the writer(s).
         // Note: as an optimization, we could skip this if there are no blocking writers (ACSDK-251).
         header->spaceAvailableConditionVariable.notify_all();
+        notifyProgress(Progress::SPACE_AVAILABLE);
+    }
+}
+
+template <typename T>
+std::shared_ptr<typename SharedDataStream<T>::BufferLayout::ProgressCallback> SharedDataStream<T>::BufferLayout::
+    addProgressCallback(Progress progress, std::function<void()> callback) {
+    auto progressCallback = std::make_shared<ProgressCallback>(std::move(callback));
+    auto& callbacks = getProgressCallbacks(progress);
+    std::lock_guard<std::mutex> lock(callbacks.mutex);
+    callbacks.callbacks.push_back(progressCallback);
+    return progressCallback;
+}
+
+template <typename T>
+void SharedDataStream<T>::BufferLayout::removeProgressCallback(
+    Progress progress,
+    std::shared_ptr<ProgressCallback> callback) {
+    auto& callbacks = getProgressCallbacks(progress);
+    std::lock_guard<std::mutex> lock(callbacks.mutex);
+    if (callback->isArmed.exchange(false)) {
+        callbacks.armedCount -= 1;
     }
+    callbacks.callbacks.erase(
+        std::remove(callbacks.callbacks.begin(), callbacks.callbacks.end(), callback), callbacks.callbacks.end());
+}
+
+template <typename T>
+void SharedDataStream<T>::BufferLayout::armProgressCallback(
+    Progress progress,
+    std::shared_ptr<ProgressCallback> callback) {
+    // Note: isArmed is set before armedCount is incremented, so notifyProgress() never sees a count without the flag.
+    if (!callback->isArmed.exchange(true)) {
+        getProgressCallbacks(progress).armedCount += 1;
+    }
+}
+
+template <typename T>
+void SharedDataStream<T>::BufferLayout::notifyProgress(Progress progress) {
+    auto& callbacks = getProgressCallbacks(progress);
+    if (0 == callbacks.armedCount) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(callbacks.mutex);
+    for (auto& callback : callbacks.callbacks) {
+        if (callback->isArmed.exchange(false)) {
+            callbacks.armedCount -= 1;
+            callback->callback();
+        }
+    }
+}
+
+template <typename T>
+typename SharedDataStream<T>::BufferLayout::ProgressCallbacks& SharedDataStream<T>::BufferLayout::getProgressCallbacks(
+    Progress progress) {
+    return Progress::DATA_AVAILABLE == progress ? m_dataAvailableCallbacks : m_spaceAvailableCallbacks;
 }
 
 template <typename T>
@@ -0,0 +1,68 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_LOWLATENCYINPROCESSSDS_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_LOWLATENCYINPROCESSSDS_H_
+
+#include <cstddef>
+
+#include "InProcessSDS.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/**
+ * Structure for specifying the traits of a SharedDataStream which works between threads in a single process, and
+ * which avoids mutex and futex traffic on the data path.  The @c Writer publishes its cursor with a plain atomic store
+ * and only wakes @c Readers which are actually blocked, while @c BLOCKING @c Readers spin briefly before they sleep.
+ * This is intended for streams with one continuous @c Writer and several @c Readers (e.g. microphone audio).
+ */
+struct LowLatencyInProcessSDSTraits {
+    /// C++11 std::atomic is sufficient for in-process atomic variables, and its operations are sequentially consistent.
+    using AtomicIndex = InProcessSDSTraits::AtomicIndex;
+
+    /// C++11 std::atomic is sufficient for in-process atomic variables.
+    using AtomicBool = InProcessSDSTraits::AtomicBool;
+
+    /// A std::vector provides a simple container to hold a buffer for in-process usage.
+    using Buffer = InProcessSDSTraits::Buffer;
+
+    /// A std::mutex provides a lock which will work for in-process usage.
+    using Mutex = InProcessSDSTraits::Mutex;
+
+    /// A std::condition_variable provides a condition variable which will work for in-process usage.
+    using ConditionVariable = InProcessSDSTraits::ConditionVariable;
+
+    /// Only lock and notify @c dataAvailableConditionVariable when a @c Reader is blocked on it.
+    static constexpr bool notifyBlockedReadersOnly = true;
+
+    /// Number of times a @c BLOCKING @c Reader yields and re-checks for data before it sleeps.
+    static constexpr size_t blockingReadSpinCount = 64;
+
+    /// A unique identifier representing this combination of traits.
+    static constexpr const char* traitsName = "alexaClientSDK::avsCommon::utils::sds::LowLatencyInProcessSDSTraits";
+};
+
+/// Type alias for a low-latency SharedDataStream which works between threads in a single process.
+using LowLatencyInProcessSDS = SharedDataStream<LowLatencyInProcessSDSTraits>;
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_LOWLATENCYINPROCESSSDS_H_
@@ -0,0 +1,154 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_PROCESSSHAREDCONDITIONVARIABLE_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_PROCESSSHAREDCONDITIONVARIABLE_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include <pthread.h>
+
+#include "AVSCommon/Utils/SDS/ProcessSharedMutex.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/**
+ * A condition variable which can be placed in shared memory and used with a @c ProcessSharedMutex from multiple
+ * processes.  It provides the subset of the @c std::condition_variable interface used by @c SharedDataStream.
+ *
+ * Timed waits are measured against @c CLOCK_MONOTONIC, so they are not affected by changes to the system clock.
+ */
+class ProcessSharedConditionVariable {
+public:
+    /// Initializes the underlying @c pthread_cond_t as process-shared, using the monotonic clock.
+    ProcessSharedConditionVariable();
+
+    /// Destroys the underlying @c pthread_cond_t.
+    ~ProcessSharedConditionVariable();
+
+    /// Unblocks one thread (in any process) waiting on this condition variable.
+    void notify_one();
+
+    /// Unblocks all threads (in any process) waiting on this condition variable.
+    void notify_all();
+
+    /**
+     * Waits indefinitely to be notified.
+     *
+     * @param lock A lock on the @c ProcessSharedMutex protecting the condition.  It must be locked by the caller.
+     */
+    void wait(std::unique_lock<ProcessSharedMutex>& lock);
+
+    /**
+     * Waits indefinitely for @c predicate to be satisfied.
+     *
+     * @param lock A lock on the @c ProcessSharedMutex protecting the condition.  It must be locked by the caller.
+     * @param predicate The condition to wait for.
+     */
+    template <class Predicate>
+    void wait(std::unique_lock<ProcessSharedMutex>& lock, Predicate predicate);
+
+    /**
+     * Waits up to @c timeout to be notified.
+     *
+     * @param lock A lock on the @c ProcessSharedMutex protecting the condition.  It must be locked by the caller.
+     * @param timeout The maximum time to wait.
+     * @return @c std::cv_status::timeout if @c timeout expired, else @c std::cv_status::no_timeout.
+     */
+    template <class Rep, class Period>
+    std::cv_status wait_for(
+        std::unique_lock<ProcessSharedMutex>& lock,
+        const std::chrono::duration<Rep, Period>& timeout);
+
+    /**
+     * Waits up to @c timeout for @c predicate to be satisfied.
+     *
+     * @param lock A lock on the @c ProcessSharedMutex protecting the condition.  It must be locked by the caller.
+     * @param timeout The maximum time to wait.
+     * @param predicate The condition to wait for.
+     * @return The value of @c predicate when the wait completed.
+     */
+    template <class Rep, class Period, class Predicate>
+    bool wait_for(
+        std::unique_lock<ProcessSharedMutex>& lock,
+        const std::chrono::duration<Rep, Period>& timeout,
+        Predicate predicate);
+
+    /// Condition variables are not copyable.
+    ProcessSharedConditionVariable(const ProcessSharedConditionVariable&) = delete;
+    ProcessSharedConditionVariable& operator=(const ProcessSharedConditionVariable&) = delete;
+
+private:
+    /**
+     * Waits until the monotonic clock reaches @c deadline (or indefinitely if @c deadline is @c nullptr).
+     *
+     * @param lock A lock on the @c ProcessSharedMutex protecting the condition.  It must be locked by the caller.
+     * @param deadline The absolute @c CLOCK_MONOTONIC time to wait until, or @c nullptr to wait indefinitely.
+     * @return @c std::cv_status::timeout if @c deadline passed, else @c std::cv_status::no_timeout.
+     */
+    std::cv_status waitUntil(std::unique_lock<ProcessSharedMutex>& lock, const struct timespec* deadline);
+
+    /**
+     * Calculates the absolute @c CLOCK_MONOTONIC time @c timeout from now.
+     *
+     * @param timeout The relative timeout.
+     * @return The absolute deadline.
+     */
+    static struct timespec deadlineFromNow(std::chrono::nanoseconds timeout);
+
+    /// The underlying condition variable.
+    pthread_cond_t m_condition;
+};
+
+template <class Predicate>
+void ProcessSharedConditionVariable::wait(std::unique_lock<ProcessSharedMutex>& lock, Predicate predicate) {
+    while (!predicate()) {
+        wait(lock);
+    }
+}
+
+template <class Rep, class Period>
+std::cv_status ProcessSharedConditionVariable::wait_for(
+    std::unique_lock<ProcessSharedMutex>& lock,
+    const std::chrono::duration<Rep, Period>& timeout) {
+    auto deadline = deadlineFromNow(std::chrono::duration_cast<std::chrono::nanoseconds>(timeout));
+    return waitUntil(lock, &deadline);
+}
+
+template <class Rep, class Period, class Predicate>
+bool ProcessSharedConditionVariable::wait_for(
+    std::unique_lock<ProcessSharedMutex>& lock,
+    const std::chrono::duration<Rep, Period>& timeout,
+    Predicate predicate) {
+    auto deadline = deadlineFromNow(std::chrono::duration_cast<std::chrono::nanoseconds>(timeout));
+    while (!predicate()) {
+        if (std::cv_status::timeout == waitUntil(lock, &deadline)) {
+            return predicate();
+        }
+    }
+    return true;
+}
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_PROCESSSHAREDCONDITIONVARIABLE_H_
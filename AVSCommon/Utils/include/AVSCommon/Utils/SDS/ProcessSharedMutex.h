@@ -0,0 +1,85 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_PROCESSSHAREDMUTEX_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_PROCESSSHAREDMUTEX_H_
+
+#include <pthread.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/**
+ * A @c Mutex which can be placed in shared memory and locked from multiple processes.  It satisfies the C++
+ * @c Lockable requirements, so it can be used with @c std::lock_guard and @c std::unique_lock.
+ *
+ * The mutex is robust: if a process dies while holding it, the next @c lock() succeeds and marks the mutex consistent
+ * again rather than deadlocking.  The state @c SharedDataStream protects with its mutexes is either atomic or only
+ * read under the lock, so it is safe to carry on after such a recovery.
+ */
+class ProcessSharedMutex {
+public:
+    /// Initializes the underlying @c pthread_mutex_t as process-shared and robust.
+    ProcessSharedMutex();
+
+    /// Destroys the underlying @c pthread_mutex_t.
+    ~ProcessSharedMutex();
+
+    /// Waits indefinitely for the mutex to unlock and then locks it.
+    void lock();
+
+    /**
+     * Attempts to lock the mutex without waiting.
+     *
+     * @return @c true if the mutex was locked, else @c false.
+     */
+    bool try_lock();
+
+    /// Unlocks the mutex.
+    void unlock();
+
+    /**
+     * Provides access to the underlying mutex for use with @c pthread_cond_* functions.
+     *
+     * @return A pointer to the underlying @c pthread_mutex_t.
+     */
+    pthread_mutex_t* nativeHandle();
+
+    /**
+     * Handles the result of a @c pthread call which (re)acquired this mutex, making the mutex consistent again if its
+     * previous owner died while holding it.
+     *
+     * @param result The value returned from the @c pthread call.
+     * @return @c true if the mutex is now held by the caller, else @c false.
+     */
+    bool onAcquired(int result);
+
+    /// Mutexes are not copyable.
+    ProcessSharedMutex(const ProcessSharedMutex&) = delete;
+    ProcessSharedMutex& operator=(const ProcessSharedMutex&) = delete;
+
+private:
+    /// The underlying mutex.
+    pthread_mutex_t m_mutex;
+};
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_PROCESSSHAREDMUTEX_H_
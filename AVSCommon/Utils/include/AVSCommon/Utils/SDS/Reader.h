@@ -22,8 +22,11 @@
 #include <mutex>
 #include <limits>
 #include <cstring>
+#include <functional>
+#include <thread>
 
 #include "AVSCommon/Utils/Logger/LoggerUtils.h"
+#include "AVSCommon/Utils/Metrics/LatencyTracer.h"
 #include "SharedDataStream.h"
 #include "ReaderPolicy.h"
 
@@ -114,6 +117,39 @@ public:
      */
     ssize_t read(void* buf, size_t nWords, std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
 
+    /**
+     * This function provides direct access to data in the stream without copying it or consuming it.  The data is
+     * described by a @c Span which points into the stream's circular buffer, so it may be split into two regions if
+     * it wraps.  The data remains in the stream until it is consumed with @c commit(); calling @c peek() again
+     * without an intervening @c commit() returns the same data (plus any newly written data).  Blocking, close and
+     * error semantics are the same as for @c read().
+     *
+     * @param span The @c Span to fill in with the location of the available data.
+     * @param nWords The maximum number of @c wordSize words to peek at.
+     * @param timeout The maximum time to wait (if @c policy is @c BLOCKING) for data.  If this parameter is zero,
+     *     there is no timeout and blocking peeks will wait forever.  If @c policy is @c NONBLOCKING, this parameter
+     *     is ignored.
+     * @return The number of @c wordSize words described by @c span if data is available, or zero if the stream has
+     *     closed, or a negative @c Error code if the stream is still open, but no data is available.
+     *
+     * @warning Unless the @c Writer's policy prevents it from overwriting unconsumed data, a @c Writer can overwrite
+     *     the data described by @c span while it is being processed.  The subsequent @c commit() call will return
+     *     @c Error::OVERRUN if this happened, and the caller should then discard any results derived from @c span.
+     */
+    ssize_t peek(Span* span, size_t nWords, std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
+    /**
+     * This function consumes data which was previously returned by @c peek(), advancing the @c Reader past it.
+     *
+     * @param nWords The number of @c wordSize words to consume.  This must not exceed the number of words which were
+     *     returned by the previous @c peek().
+     *     Words beyond the @c Reader's close index (see @c close()) are not consumed.
+     * @return The number of words consumed, @c Error::OVERRUN if the data was overwritten before it was consumed,
+     *     @c Error::CLOSED if the @c Reader has reached its close index, or @c Error::INVALID if @c nWords exceeds the
+     *     data available to this @c Reader.
+     */
+    ssize_t commit(size_t nWords);
+
     /**
      * This function moves the @c Reader to the specified location in the stream.  If successful, subsequent calls to
      * @c read() will start from the new location.  For this function to succeed, the specified location *must* point
@@ -157,6 +193,19 @@ public:
      */
     void close(Index offset = 0, Reference reference = Reference::AFTER_READER);
 
+    /**
+     * This function sets a function to call when a @c NONBLOCKING @c read() or @c peek() which returned
+     * @c Error::WOULDBLOCK could make progress, because a @c Writer in this process has published data or closed.
+     * This lets a consumer which has to poll the @c Reader wait for data instead.
+     *
+     * @param callback The function to call once after each @c Error::WOULDBLOCK, or an empty function to stop calling
+     *     the previous one.  It may be called from the @c Writer's thread, so it should return quickly, and it must
+     *     not call back into this @c Reader.
+     *
+     * @note Data written by a @c Writer in another process does not call @c callback.
+     */
+    void setDataAvailableCallback(std::function<void()> callback);
+
     /**
      * This function returns the id assigned to this @c Reader.  If a @c Reader instance is not destroyed cleanly (e.g.
      * a @c Reader from another process that crashes), its id can be passed to @c SharedDataStream::reset() to free up
@@ -204,6 +253,12 @@ private:
 
     /// Pointer to this reader's close index in BufferLayout::getReaderCloseIndexArray().
     AtomicIndex* m_readerCloseIndex;
+
+    /// Whether a @c TracePoint::SDS_READ event has been recorded for this @c Reader.
+    bool m_hasTracedRead;
+
+    /// The function set by @c setDataAvailableCallback(), if any.
+    std::shared_ptr<typename BufferLayout::ProgressCallback> m_dataAvailableCallback;
 };
 
 template <typename T>
@@ -215,7 +270,8 @@ SharedDataStream<T>::Reader::Reader(Policy policy, std::shared_ptr<BufferLayout>
         m_bufferLayout{bufferLayout},
         m_id{id},
         m_readerCursor{&m_bufferLayout->getReaderCursorArray()[m_id]},
-        m_readerCloseIndex{&m_bufferLayout->getReaderCloseIndexArray()[m_id]} {
+        m_readerCloseIndex{&m_bufferLayout->getReaderCloseIndexArray()[m_id]},
+        m_hasTracedRead{false} {
     // Note - SharedDataStream::createReader() holds readerEnableMutex while calling this function.
     // Read new data only.
     // Note: It is important that new readers start with their cursor at the writer.  This allows
@@ -231,6 +287,8 @@ SharedDataStream<T>::Reader::Reader(Policy policy, std::shared_ptr<BufferLayout>
 
 template <typename T>
 SharedDataStream<T>::Reader::~Reader() {
+    setDataAvailableCallback(nullptr);
+
     // Note: We can't leave a reader with its cursor in the future; doing so can introduce a race condition in
     // updateOldestUnconsumedCursor().  See updateOldestUnconsumedCursor() comments for further explanation.
     seek(0, Reference::BEFORE_WRITER);
@@ -247,8 +305,31 @@ ssize_t SharedDataStream<T>::Reader::read(void* buf, size_t nWords, std::chrono:
         return Error::INVALID;
     }
 
+    Span span;
+    auto wordsAvailable = peek(&span, nWords, timeout);
+    if (wordsAvailable <= 0) {
+        return wordsAvailable;
+    }
+
+    // Copy the two segments.
+    auto buf8 = static_cast<uint8_t*>(buf);
+    memcpy(buf8, span.first, span.firstWords * getWordSize());
+    if (span.secondWords > 0) {
+        memcpy(buf8 + (span.firstWords * getWordSize()), span.second, span.secondWords * getWordSize());
+    }
+
+    return commit(wordsAvailable);
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Reader::peek(Span* span, size_t nWords, std::chrono::milliseconds timeout) {
+    if (nullptr == span) {
+        logger::acsdkError(logger::LogEntry(TAG, "peekFailed").d("reason", "nullSpan"));
+        return Error::INVALID;
+    }
+
     if (0 == nWords) {
-        logger::acsdkError(logger::LogEntry(TAG, "readFailed").d("reason", "invalidNumWords").d("numWords", nWords));
+        logger::acsdkError(logger::LogEntry(TAG, "peekFailed").d("reason", "invalidNumWords").d("numWords", nWords));
         return Error::INVALID;
     }
 
@@ -265,27 +346,61 @@ ssize_t SharedDataStream<T>::Reader::read(void* buf, size_t nWords, std::chrono:
         return Error::OVERRUN;
     }
 
+    // When the traits only notify blocked readers, we don't need the lock unless we actually have to sleep.
+    bool lockOnlyToWait = notifyBlockedReadersOnly<T>(nullptr);
     std::unique_lock<Mutex> lock(header->dataAvailableMutex, std::defer_lock);
-    if (Policy::BLOCKING == m_policy) {
+    if (Policy::BLOCKING == m_policy && !lockOnlyToWait) {
         lock.lock();
     }
 
     // Figure out how much we can actually copy.
     size_t wordsAvailable = tell(Reference::BEFORE_WRITER);
+    if (0 == wordsAvailable && Policy::BLOCKING == m_policy && lockOnlyToWait) {
+        // Data typically arrives shortly, so give the writer a chance to publish it before paying for a sleep.
+        for (size_t spin = 0; spin < blockingReadSpinCount<T>(nullptr) && 0 == wordsAvailable; ++spin) {
+            std::this_thread::yield();
+            wordsAvailable = tell(Reference::BEFORE_WRITER);
+        }
+    }
     if (0 == wordsAvailable) {
         if (header->writeEndCursor > 0 && !header->isWriterEnabled) {
             return Error::CLOSED;
         } else if (Policy::NONBLOCKING == m_policy) {
-            return Error::WOULDBLOCK;
+            if (!m_dataAvailableCallback) {
+                return Error::WOULDBLOCK;
+            }
+
+            // Note: the writer publishes data before it checks for armed callbacks, and we arm ours before checking
+            // for data again, so either we will see the new data here, or the writer will call our callback.
+            m_bufferLayout->armProgressCallback(BufferLayout::Progress::DATA_AVAILABLE, m_dataAvailableCallback);
+            if (0 == tell(Reference::BEFORE_WRITER) && (0 == header->writeEndCursor || header->isWriterEnabled)) {
+                return Error::WOULDBLOCK;
+            }
         } else if (Policy::BLOCKING == m_policy) {
             // Condition for returning from read: the Writer has been closed or there is data to read
             auto predicate = [this, header] {
                 return header->hasWriterBeenClosed || tell(Reference::BEFORE_WRITER) > 0;
             };
 
+            // Note: blockedReaderCount must be incremented before the predicate is checked under the lock; see the
+            // corresponding comment in Writer::endWrite().
+            if (lockOnlyToWait) {
+                header->blockedReaderCount += 1;
+                lock.lock();
+            }
+
+            bool dataAvailable = true;
             if (std::chrono::milliseconds::zero() == timeout) {
                 header->dataAvailableConditionVariable.wait(lock, predicate);
-            } else if (!header->dataAvailableConditionVariable.wait_for(lock, timeout, predicate)) {
+            } else {
+                dataAvailable = header->dataAvailableConditionVariable.wait_for(lock, timeout, predicate);
+            }
+
+            if (lockOnlyToWait) {
+                lock.unlock();
+                header->blockedReaderCount -= 1;
+            }
+            if (!dataAvailable) {
                 return Error::TIMEDOUT;
             }
         }
@@ -297,7 +412,7 @@ ssize_t SharedDataStream<T>::Reader::read(void* buf, size_t nWords, std::chrono:
         }
     }
 
-    if (Policy::BLOCKING == m_policy) {
+    if (lock.owns_lock()) {
         lock.unlock();
     }
     if (nWords > wordsAvailable) {
@@ -316,22 +431,41 @@ ssize_t SharedDataStream<T>::Reader::read(void* buf, size_t nWords, std::chrono:
     }
     size_t afterWrap = nWords - beforeWrap;
 
-    // Copy the two segments.
-    auto buf8 = static_cast<uint8_t*>(buf);
-    memcpy(buf8, m_bufferLayout->getData(*m_readerCursor), beforeWrap * getWordSize());
-    if (afterWrap > 0) {
-        memcpy(
-            buf8 + (beforeWrap * getWordSize()),
-            m_bufferLayout->getData(*m_readerCursor + beforeWrap),
-            afterWrap * getWordSize());
+    span->first = m_bufferLayout->getData(*m_readerCursor);
+    span->firstWords = beforeWrap;
+    span->second = afterWrap > 0 ? m_bufferLayout->getData(*m_readerCursor + beforeWrap) : nullptr;
+    span->secondWords = afterWrap;
+
+    return nWords;
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Reader::commit(size_t nWords) {
+    if (nWords > tell(Reference::BEFORE_WRITER)) {
+        logger::acsdkError(logger::LogEntry(TAG, "commitFailed")
+                               .d("reason", "beyondWriter")
+                               .d("numWords", nWords)
+                               .d("wordsAvailable", tell(Reference::BEFORE_WRITER)));
+        return Error::INVALID;
     }
 
-    // Advance the read cursor.
-    *m_readerCursor += nWords;
+    // Don't consume beyond our close index, which may have been moved back since peek().
+    auto readerCloseIndex = m_readerCloseIndex->load();
+    if (*m_readerCursor >= readerCloseIndex) {
+        return Error::CLOSED;
+    }
+    if ((*m_readerCursor + nWords) > readerCloseIndex) {
+        nWords = readerCloseIndex - *m_readerCursor;
+    }
 
-    // Final check for overrun (do this before the updateOldestUnconsumedCursor() call below for improved accuracy).
+    // Final check for overrun of the committed data, which may have been processed in place for some time since
+    // peek() (do this before the updateOldestUnconsumedCursor() call below for improved accuracy).
+    auto header = m_bufferLayout->getHeader();
     bool overrun = ((header->writeEndCursor - *m_readerCursor) > m_bufferLayout->getDataSize());
 
+    // Advance the read cursor.
+    *m_readerCursor += nWords;
+
     // Move the unconsumed cursor before returning.
     m_bufferLayout->updateOldestUnconsumedCursor();
 
@@ -340,6 +474,10 @@ ssize_t SharedDataStream<T>::Reader::read(void* buf, size_t nWords, std::chrono:
         return Error::OVERRUN;
     }
 
+    if (!m_hasTracedRead) {
+        m_hasTracedRead = true;
+        metrics::LatencyTracer::record(metrics::TracePoint::SDS_READ, m_id);
+    }
     return nWords;
 }
 
@@ -473,6 +611,18 @@ void SharedDataStream<T>::Reader::close(Index offset, Reference reference) {
     *m_readerCloseIndex = absolute;
 }
 
+template <typename T>
+void SharedDataStream<T>::Reader::setDataAvailableCallback(std::function<void()> callback) {
+    if (m_dataAvailableCallback) {
+        m_bufferLayout->removeProgressCallback(BufferLayout::Progress::DATA_AVAILABLE, m_dataAvailableCallback);
+        m_dataAvailableCallback.reset();
+    }
+    if (callback) {
+        m_dataAvailableCallback =
+            m_bufferLayout->addProgressCallback(BufferLayout::Progress::DATA_AVAILABLE, std::move(callback));
+    }
+}
+
 template <typename T>
 size_t SharedDataStream<T>::Reader::getId() const {
     return m_id;
@@ -89,6 +89,17 @@ namespace sds {
  * @tparam T::traitsName A unique string value which describes the collection of traits specified by T.  This string
  *     is used to ensure that a SharedDataStream attempting to open() a buffer is using the same set of traits that
  *     were originally used to create() the buffer.
+ *
+ * @tparam T::notifyBlockedReadersOnly An optional `static constexpr bool`.  When it is present and @c true, the
+ *     @c Writer publishes new data without taking @c dataAvailableMutex, and only locks it (and notifies
+ *     @c dataAvailableConditionVariable) when at least one @c BLOCKING @c Reader is actually waiting for data.
+ *     @c BLOCKING @c Readers in turn only take @c dataAvailableMutex when they need to sleep.  This requires
+ *     @c AtomicIndex operations to be sequentially consistent.  When absent, this defaults to @c false.
+ *
+ * @tparam T::blockingReadSpinCount An optional `static constexpr size_t` which is only used when
+ *     @c T::notifyBlockedReadersOnly is @c true.  It specifies how many times a @c BLOCKING @c Reader will yield and
+ *     re-check for data before it goes to sleep on @c dataAvailableConditionVariable.  When absent, this defaults to
+ *     zero.
  */
 template <typename T>
 class SharedDataStream {
@@ -119,6 +130,34 @@ public:
     /// A condition variable type which works with @c Mutex.
     using ConditionVariable = typename T::ConditionVariable;
 
+    /**
+     * A view of words stored directly in the circular data of a @c SharedDataStream, as returned by
+     * @c Reader::peek() and @c Writer::reserve().  Because the data is circular, a @c Span consists of up to two
+     * contiguous regions; the second region is only used when the @c Span wraps around the end of the buffer.
+     */
+    struct Span {
+        /// Pointer to the first contiguous region, or @c nullptr if the @c Span is empty.
+        uint8_t* first = nullptr;
+
+        /// The number of words in the first region.
+        size_t firstWords = 0;
+
+        /// Pointer to the region following the wrap, or @c nullptr if the @c Span does not wrap.
+        uint8_t* second = nullptr;
+
+        /// The number of words in the second region.
+        size_t secondWords = 0;
+
+        /**
+         * This function returns the total number of words in the @c Span.
+         *
+         * @return The total number of words in both regions.
+         */
+        size_t size() const {
+            return firstWords + secondWords;
+        }
+    };
+
     // Forward declare the nested @c Reader class (full declaration is in @c Reader.h).
     class Reader;
 
@@ -294,6 +333,46 @@ private:
         bool forceReplacement,
         std::unique_lock<Mutex>* lock);
 
+    /**
+     * This function reports the value of the optional @c T::notifyBlockedReadersOnly trait.
+     *
+     * @return The value of @c U::notifyBlockedReadersOnly.
+     */
+    template <typename U>
+    static constexpr bool notifyBlockedReadersOnly(decltype(U::notifyBlockedReadersOnly)*) {
+        return U::notifyBlockedReadersOnly;
+    }
+
+    /**
+     * Fallback for traits which do not declare @c notifyBlockedReadersOnly.
+     *
+     * @return @c false.
+     */
+    template <typename U>
+    static constexpr bool notifyBlockedReadersOnly(...) {
+        return false;
+    }
+
+    /**
+     * This function reports the value of the optional @c T::blockingReadSpinCount trait.
+     *
+     * @return The value of @c U::blockingReadSpinCount.
+     */
+    template <typename U>
+    static constexpr size_t blockingReadSpinCount(decltype(U::blockingReadSpinCount)*) {
+        return U::blockingReadSpinCount;
+    }
+
+    /**
+     * Fallback for traits which do not declare @c blockingReadSpinCount.
+     *
+     * @return Zero.
+     */
+    template <typename U>
+    static constexpr size_t blockingReadSpinCount(...) {
+        return 0;
+    }
+
     /**
      * The tag associated with log entries from this class.
      */
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDMEMORYBUFFER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDMEMORYBUFFER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/**
+ * A @c Buffer for @c SharedDataStream which is mapped from shared memory, so that a stream can be shared between
+ * processes.
+ *
+ * A @c SharedMemoryBuffer is either anonymous (constructed with a size), in which case it is shared with any child
+ * processes forked after it was created, or named (returned by @c create() or @c open()), in which case any process
+ * can map it by name.  A named buffer is unlinked when the @c SharedMemoryBuffer that created it is destroyed;
+ * processes which already have it mapped keep their mapping until they destroy their own @c SharedMemoryBuffer.
+ */
+class SharedMemoryBuffer {
+public:
+    /// The type of the elements in the buffer.
+    using value_type = uint8_t;
+
+    /// The type used for the size of the buffer.
+    using size_type = size_t;
+
+    /**
+     * Creates a new named shared memory buffer.
+     *
+     * @param name The name of the shared memory object.  This must start with a '/' and contain no other '/'s.
+     * @param size The size (in bytes) of the buffer.
+     * @return The new buffer, or @c nullptr if a shared memory object with this name already exists or the buffer could
+     *     not be created.
+     */
+    static std::shared_ptr<SharedMemoryBuffer> create(const std::string& name, size_t size);
+
+    /**
+     * Maps an existing named shared memory buffer which was created by @c create() (typically in another process).
+     *
+     * @param name The name which was passed to @c create().
+     * @return The buffer, or @c nullptr if it does not exist or could not be mapped.
+     */
+    static std::shared_ptr<SharedMemoryBuffer> open(const std::string& name);
+
+    /**
+     * Constructs an anonymous shared memory buffer.  If the mapping fails, the buffer will have a @c size() of zero
+     * (which @c SharedDataStream::create() will reject).
+     *
+     * @param size The size (in bytes) of the buffer.
+     */
+    explicit SharedMemoryBuffer(size_t size);
+
+    /// Unmaps the buffer, and unlinks its name if this instance created it.
+    ~SharedMemoryBuffer();
+
+    /**
+     * Provides access to the underlying storage.
+     *
+     * @return A pointer to the start of the buffer.
+     */
+    value_type* data();
+
+    /**
+     * Gets the size of the buffer.
+     *
+     * @return The size (in bytes) of the buffer.
+     */
+    size_type size() const;
+
+    /**
+     * Gets the name of the buffer.
+     *
+     * @return The name of the shared memory object, or an empty string if the buffer is anonymous.
+     */
+    std::string name() const;
+
+    /// Mappings are not copyable.
+    SharedMemoryBuffer(const SharedMemoryBuffer&) = delete;
+    SharedMemoryBuffer& operator=(const SharedMemoryBuffer&) = delete;
+
+private:
+    /**
+     * Constructor used by @c create() and @c open().
+     *
+     * @param name The name of the shared memory object.
+     * @param data The start of the mapping.
+     * @param size The size (in bytes) of the mapping.
+     * @param owner Whether this instance should unlink @c name when it is destroyed.
+     */
+    SharedMemoryBuffer(const std::string& name, void* data, size_t size, bool owner);
+
+    /**
+     * Maps @c size bytes of the shared memory object referred to by @c fd.
+     *
+     * @param fd The file descriptor of the shared memory object, or -1 for an anonymous mapping.
+     * @param size The size (in bytes) to map.
+     * @return The start of the mapping, or @c nullptr on failure.
+     */
+    static void* map(int fd, size_t size);
+
+    /// The name of the shared memory object, or an empty string for an anonymous buffer.
+    const std::string m_name;
+
+    /// The start of the mapping.
+    value_type* m_data;
+
+    /// The size (in bytes) of the mapping.
+    size_t m_size;
+
+    /// Whether this instance created @c m_name and should unlink it.
+    const bool m_owner;
+};
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDMEMORYBUFFER_H_
@@ -0,0 +1,70 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDMEMORYSDS_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDMEMORYSDS_H_
+
+#include <atomic>
+
+#include "SharedDataStream.h"
+#include "ProcessSharedConditionVariable.h"
+#include "ProcessSharedMutex.h"
+#include "SharedMemoryBuffer.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+// Atomics in shared memory must not fall back to a (per-process) lock.
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "SharedMemorySDS requires lock-free 64-bit atomics");
+static_assert(ATOMIC_BOOL_LOCK_FREE == 2, "SharedMemorySDS requires lock-free boolean atomics");
+
+/**
+ * Structure for specifying the traits of a SharedDataStream which works between processes, using POSIX shared memory
+ * and process-shared pthread synchronization primitives.
+ *
+ * A stream is created in one process with a named @c SharedMemoryBuffer, and then opened in other processes by passing
+ * @c SharedMemoryBuffer::open() of the same name to @c SharedDataStream::open().
+ */
+struct SharedMemorySDSTraits {
+    /// Lock-free std::atomic operations are address-free, so they work between processes.
+    using AtomicIndex = std::atomic<uint64_t>;
+
+    /// Lock-free std::atomic operations are address-free, so they work between processes.
+    using AtomicBool = std::atomic<bool>;
+
+    /// A buffer mapped from POSIX shared memory.
+    using Buffer = SharedMemoryBuffer;
+
+    /// A robust, process-shared pthread mutex.
+    using Mutex = ProcessSharedMutex;
+
+    /// A process-shared pthread condition variable.
+    using ConditionVariable = ProcessSharedConditionVariable;
+
+    /// A unique identifier representing this combination of traits.
+    static constexpr const char* traitsName = "alexaClientSDK::avsCommon::utils::sds::SharedMemorySDSTraits";
+};
+
+/// Type alias for a SharedDataStream which works between processes.
+using SharedMemorySDS = SharedDataStream<SharedMemorySDSTraits>;
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDMEMORYSDS_H_
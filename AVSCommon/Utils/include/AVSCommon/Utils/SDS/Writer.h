@@ -22,6 +22,7 @@
 #include <mutex>
 #include <limits>
 #include <cstring>
+#include <functional>
 
 #include "AVSCommon/Utils/Logger/LoggerUtils.h"
 
@@ -96,6 +97,36 @@ public:
      */
     ssize_t write(const void* buf, size_t nWords, std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
 
+    /**
+     * This function reserves space in the stream for the caller to write into directly, avoiding the copy made by
+     * @c write().  The reserved space is described by @c span, which holds two regions if the reservation wraps.  The
+     * data is not visible to @c Readers until it is made available with @c publish().  Blocking and overwrite
+     * behavior follows @c policy exactly as for @c write().
+     *
+     * @param[out] span Receives the location of the reserved space.
+     * @param nWords The maximum number of @c wordSize words to reserve.
+     * @param timeout The maximum time to wait (if @c policy is @c BLOCKING) for space to write into.  If this parameter
+     *     is zero, there is no timeout and blocking reservations will wait forever.  If @c policy is not
+     *     @c BLOCKING, this parameter is ignored.
+     * @return The number of @c wordSize words reserved, or zero if the stream has closed, or a negative @c Error code
+     *     if the stream is still open, but no space could be reserved.
+     *
+     * @note Every successful call to @c reserve() must be followed by a call to @c publish() before the next call to
+     *     @c write() or @c reserve().
+     */
+    ssize_t reserve(Span* span, size_t nWords, std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
+    /**
+     * This function makes data which was written into space returned by @c reserve() available to @c Readers.  Any
+     * part of the reservation beyond @c nWords is released.
+     *
+     * @param nWords The number of @c wordSize words to publish.  This must not exceed the number of words returned
+     *     by the previous @c reserve().
+     * @return The number of @c wordSize words published, or zero if the @c Writer has been closed, or
+     *     @c Error::INVALID if @c nWords exceeds the reservation.
+     */
+    ssize_t publish(size_t nWords);
+
     /**
      * This function reports the current position of the @c Writer in the stream.
      *
@@ -109,6 +140,19 @@ public:
      */
     void close();
 
+    /**
+     * This function sets a function to call when an @c ALL_OR_NOTHING @c write() or @c reserve() which returned
+     * @c Error::WOULDBLOCK could make progress, because a @c Reader in this process has consumed data.  This lets a
+     * producer which has to poll the @c Writer wait for space instead.
+     *
+     * @param callback The function to call once after each @c Error::WOULDBLOCK, or an empty function to stop calling
+     *     the previous one.  It may be called from a @c Reader's thread, so it should return quickly, and it must not
+     *     call back into this @c Writer.
+     *
+     * @note Data read by a @c Reader in another process does not call @c callback.
+     */
+    void setSpaceAvailableCallback(std::function<void()> callback);
+
     /**
      * This function returns the word size (in bytes).  All @c SharedDataStream operations that work with data or
      * position in the stream are quantified in words.
@@ -130,6 +174,19 @@ private:
      */
     static const std::string TAG;
 
+    /**
+     * This function waits (according to @c policy) for space to write @c nWords into, and claims it by advancing
+     * @c Header::writeEndCursor.
+     *
+     * @param nWords The maximum number of @c wordSize words to claim.
+     * @param timeout The maximum time to wait for space if @c policy is @c BLOCKING.
+     * @return The number of @c wordSize words claimed, or zero if the stream has closed, or a negative @c Error code.
+     */
+    ssize_t beginWrite(size_t nWords, std::chrono::milliseconds timeout);
+
+    /// This function publishes the words claimed by @c beginWrite() and wakes any @c Readers waiting for data.
+    void endWrite();
+
     /// The @c Policy to use for writing to the stream.
     Policy m_policy;
 
@@ -142,6 +199,9 @@ private:
      * @c Header::WriterEnabledMutex.
      */
     bool m_closed;
+
+    /// The function set by @c setSpaceAvailableCallback(), if any.
+    std::shared_ptr<typename BufferLayout::ProgressCallback> m_spaceAvailableCallback;
 };
 
 template <typename T>
@@ -160,6 +220,7 @@ SharedDataStream<T>::Writer::Writer(Policy policy, std::shared_ptr<BufferLayout>
 
 template <typename T>
 SharedDataStream<T>::Writer::~Writer() {
+    setSpaceAvailableCallback(nullptr);
     close();
 }
 
@@ -169,6 +230,108 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
         logger::acsdkError(logger::LogEntry(TAG, "writeFailed").d("reason", "nullBuffer"));
         return Error::INVALID;
     }
+
+    auto wordsToWrite = beginWrite(nWords, timeout);
+    if (wordsToWrite <= 0) {
+        return wordsToWrite;
+    }
+    nWords = wordsToWrite;
+
+    auto wordsToCopy = nWords;
+    auto buf8 = static_cast<const uint8_t*>(buf);
+    if (Policy::ALL_OR_NOTHING == m_policy) {
+        // If we have more data than the SDS can hold and we're not going to be overwriting oldestUnconsumedCursor, we
+        // can safely discard the initial data and just leave the trailing data in the buffer.
+        if (wordsToCopy > m_bufferLayout->getDataSize()) {
+            wordsToCopy = m_bufferLayout->getDataSize();
+            buf8 += (nWords - wordsToCopy) * getWordSize();
+        }
+    }
+
+    // Split it across the wrap.
+    auto header = m_bufferLayout->getHeader();
+    size_t beforeWrap = m_bufferLayout->wordsUntilWrap(header->writeStartCursor);
+    if (beforeWrap > wordsToCopy) {
+        beforeWrap = wordsToCopy;
+    }
+    size_t afterWrap = wordsToCopy - beforeWrap;
+
+    // Copy the two segments.
+    memcpy(m_bufferLayout->getData(header->writeStartCursor), buf8, beforeWrap * getWordSize());
+    if (afterWrap > 0) {
+        memcpy(
+            m_bufferLayout->getData(header->writeStartCursor + beforeWrap),
+            buf8 + beforeWrap * getWordSize(),
+            afterWrap * getWordSize());
+    }
+
+    endWrite();
+
+    return nWords;
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Writer::reserve(Span* span, size_t nWords, std::chrono::milliseconds timeout) {
+    if (nullptr == span) {
+        logger::acsdkError(logger::LogEntry(TAG, "reserveFailed").d("reason", "nullSpan"));
+        return Error::INVALID;
+    }
+    if (Policy::ALL_OR_NOTHING == m_policy && nWords > m_bufferLayout->getDataSize()) {
+        logger::acsdkError(logger::LogEntry(TAG, "reserveFailed")
+                               .d("reason", "reservationLargerThanBuffer")
+                               .d("numWords", nWords)
+                               .d("dataSize", m_bufferLayout->getDataSize()));
+        return Error::INVALID;
+    }
+
+    auto wordsReserved = beginWrite(nWords, timeout);
+    if (wordsReserved <= 0) {
+        return wordsReserved;
+    }
+
+    // Split it across the wrap.
+    auto header = m_bufferLayout->getHeader();
+    size_t beforeWrap = m_bufferLayout->wordsUntilWrap(header->writeStartCursor);
+    if (beforeWrap > static_cast<size_t>(wordsReserved)) {
+        beforeWrap = wordsReserved;
+    }
+    size_t afterWrap = wordsReserved - beforeWrap;
+
+    span->first = m_bufferLayout->getData(header->writeStartCursor);
+    span->firstWords = beforeWrap;
+    span->second = afterWrap > 0 ? m_bufferLayout->getData(header->writeStartCursor + beforeWrap) : nullptr;
+    span->secondWords = afterWrap;
+
+    return wordsReserved;
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Writer::publish(size_t nWords) {
+    auto header = m_bufferLayout->getHeader();
+    if (!header->isWriterEnabled) {
+        logger::acsdkError(logger::LogEntry(TAG, "publishFailed").d("reason", "writerDisabled"));
+        return Error::CLOSED;
+    }
+
+    Index writeStart = header->writeStartCursor;
+    if (nWords > header->writeEndCursor - writeStart) {
+        logger::acsdkError(logger::LogEntry(TAG, "publishFailed")
+                               .d("reason", "beyondReservation")
+                               .d("numWords", nWords)
+                               .d("wordsReserved", header->writeEndCursor - writeStart));
+        return Error::INVALID;
+    }
+
+    // Release any unused part of the reservation before publishing.
+    header->writeEndCursor = writeStart + nWords;
+
+    endWrite();
+
+    return nWords;
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Writer::beginWrite(size_t nWords, std::chrono::milliseconds timeout) {
     if (0 == nWords) {
         logger::acsdkError(logger::LogEntry(TAG, "writeFailed").d("reason", "zeroNumWords"));
         return Error::INVALID;
@@ -180,8 +343,6 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
         return Error::CLOSED;
     }
 
-    auto wordsToCopy = nWords;
-    auto buf8 = static_cast<const uint8_t*>(buf);
     std::unique_lock<Mutex> backwardSeekLock(header->backwardSeekMutex, std::defer_lock);
     Index writeEnd = header->writeStartCursor + nWords;
 
@@ -189,7 +350,7 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
         case Policy::NONBLOCKABLE:
             // For NONBLOCKABLE, we can truncate the write if it won't fit in the buffer.
             if (nWords > m_bufferLayout->getDataSize()) {
-                wordsToCopy = nWords = m_bufferLayout->getDataSize();
+                nWords = m_bufferLayout->getDataSize();
                 writeEnd = header->writeStartCursor + nWords;
             }
             break;
@@ -203,6 +364,12 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
             backwardSeekLock.lock();
             if ((writeEnd >= header->oldestUnconsumedCursor) &&
                 ((writeEnd - header->oldestUnconsumedCursor) > m_bufferLayout->getDataSize())) {
+                // Readers only move oldestUnconsumedCursor while holding backwardSeekMutex, so none can consume data
+                // between the check above and arming the callback.
+                if (m_spaceAvailableCallback) {
+                    m_bufferLayout->armProgressCallback(
+                        BufferLayout::Progress::SPACE_AVAILABLE, m_spaceAvailableCallback);
+                }
                 return Error::WOULDBLOCK;
             }
             break;
@@ -238,7 +405,7 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
 
             // For BLOCKING, we can truncate the write if it won't fit in the buffer.
             if (spaceAvailable < nWords) {
-                wordsToCopy = nWords = spaceAvailable;
+                nWords = spaceAvailable;
                 writeEnd = header->writeStartCursor + nWords;
             }
 
@@ -252,37 +419,31 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
         backwardSeekLock.unlock();
     }
 
-    if (Policy::ALL_OR_NOTHING == m_policy) {
-        // If we have more data than the SDS can hold and we're not going to be overwriting oldestUnconsumedCursor, we
-        // can safely discard the initial data and just leave the trailing data in the buffer.
-        if (wordsToCopy > m_bufferLayout->getDataSize()) {
-            wordsToCopy = m_bufferLayout->getDataSize();
-            buf8 += (nWords - wordsToCopy) * getWordSize();
-        }
-    }
-
-    // Split it across the wrap.
-    size_t beforeWrap = m_bufferLayout->wordsUntilWrap(header->writeStartCursor);
-    if (beforeWrap > wordsToCopy) {
-        beforeWrap = wordsToCopy;
-    }
-    size_t afterWrap = wordsToCopy - beforeWrap;
+    return nWords;
+}
 
-    // Copy the two segments.
-    memcpy(m_bufferLayout->getData(header->writeStartCursor), buf8, beforeWrap * getWordSize());
-    if (afterWrap > 0) {
-        memcpy(
-            m_bufferLayout->getData(header->writeStartCursor + beforeWrap),
-            buf8 + beforeWrap * getWordSize(),
-            afterWrap * getWordSize());
-    }
+template <typename T>
+void SharedDataStream<T>::Writer::endWrite() {
+    auto header = m_bufferLayout->getHeader();
 
     // Advance the write cursor.
     // Note: To prevent a race condition and ensure that readers which block on dataAvailableConditionVariable don't
     // miss a notify, we should always lock the dataAvailableConditionVariable mutex while moving writeStartCursor.  As
     // an optimization, we skip that lock for NONBLOCKABLE writers under the assumption that they will be writing
     // continuously, so a missed notification is not significant.
-    // Note: As a further optimization, the lock could be omitted if no blocking readers are in use (ACSDK-251).
+    if (notifyBlockedReadersOnly<T>(nullptr)) {
+        // Readers increment blockedReaderCount before re-checking for data under dataAvailableMutex, so either they
+        // will see the new writeStartCursor, or we will see them here and wake them up (ACSDK-251).
+        header->writeStartCursor = header->writeEndCursor.load();
+        if (header->blockedReaderCount > 0) {
+            std::unique_lock<Mutex> dataAvailableLock(header->dataAvailableMutex);
+            dataAvailableLock.unlock();
+            header->dataAvailableConditionVariable.notify_all();
+        }
+        m_bufferLayout->notifyProgress(BufferLayout::Progress::DATA_AVAILABLE);
+        return;
+    }
+
     std::unique_lock<Mutex> dataAvailableLock(header->dataAvailableMutex, std::defer_lock);
     if (Policy::NONBLOCKABLE != m_policy) {
         dataAvailableLock.lock();
@@ -293,10 +454,8 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
     }
 
     // Notify the reader(s).
-    // Note: as an optimization, we could skip this if there are no blocking readers (ACSDK-251).
     header->dataAvailableConditionVariable.notify_all();
-
-    return nWords;
+    m_bufferLayout->notifyProgress(BufferLayout::Progress::DATA_AVAILABLE);
 }
 
 template <typename T>
@@ -319,10 +478,24 @@ void SharedDataStream<T>::Writer::close() {
         header->hasWriterBeenClosed = true;
 
         header->dataAvailableConditionVariable.notify_all();
+        dataAvailableLock.unlock();
+        m_bufferLayout->notifyProgress(BufferLayout::Progress::DATA_AVAILABLE);
     }
     m_closed = true;
 }
 
+template <typename T>
+void SharedDataStream<T>::Writer::setSpaceAvailableCallback(std::function<void()> callback) {
+    if (m_spaceAvailableCallback) {
+        m_bufferLayout->removeProgressCallback(BufferLayout::Progress::SPACE_AVAILABLE, m_spaceAvailableCallback);
+        m_spaceAvailableCallback.reset();
+    }
+    if (callback) {
+        m_spaceAvailableCallback =
+            m_bufferLayout->addProgressCallback(BufferLayout::Progress::SPACE_AVAILABLE, std::move(callback));
+    }
+}
+
 template <typename T>
 size_t SharedDataStream<T>::Writer::getWordSize() const {
     return m_bufferLayout->getHeader()->wordSize;
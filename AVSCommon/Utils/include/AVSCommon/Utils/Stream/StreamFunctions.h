@@ -33,6 +33,17 @@ namespace stream {
  */
 std::unique_ptr<std::istream> streamFromData(const unsigned char* data, size_t length);
 
+/**
+ * Gets the byte array from which a stream created by @c streamFromData() reads.  This lets the consumers of such
+ * streams recognize the data behind them, for example to reuse what they derived from the same data before.
+ *
+ * @param stream The stream.
+ * @param[out] data The beginning of the byte array.
+ * @param[out] length The length of the byte array.
+ * @return @c true if @c stream was created by @c streamFromData(), else @c false.
+ */
+bool dataFromStream(const std::istream& stream, const unsigned char** data, size_t* length);
+
 }  // namespace stream
 }  // namespace utils
 }  // namespace avsCommon
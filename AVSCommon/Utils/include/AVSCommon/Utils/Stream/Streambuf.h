@@ -43,6 +43,20 @@ public:
         std::ios_base::openmode which = std::ios_base::in) override;
     std::streampos seekpos(std::streampos sp, std::ios_base::openmode which = std::ios_base::in) override;
 
+    /**
+     * Gets the byte array this streambuf reads from.
+     *
+     * @return The beginning of the byte array.
+     */
+    const unsigned char* getData() const;
+
+    /**
+     * Gets the size of the byte array this streambuf reads from.
+     *
+     * @return The size of the byte array.
+     */
+    size_t getLength() const;
+
 private:
     /// @name @c std::streambuf method overrides
     /// @{
@@ -19,6 +19,8 @@
 #include <future>
 #include <utility>
 
+#include "AVSCommon/Utils/Threading/ExecutorPool.h"
+#include "AVSCommon/Utils/Threading/Strand.h"
 #include "AVSCommon/Utils/Threading/TaskThread.h"
 #include "AVSCommon/Utils/Threading/TaskQueue.h"
 
@@ -28,15 +30,24 @@ namespace utils {
 namespace threading {
 
 /**
- * An Executor is used to run callable types asynchronously.
+ * An Executor is used to run callable types asynchronously.  Tasks run one at a time, in the order they are queued,
+ * either on a thread owned by the Executor or on a @c Strand of a shared @c ExecutorPool.
  */
 class Executor {
 public:
     /**
-     * Constructs an Executor.
+     * Constructs an Executor.  If an @c ExecutorPool::ScopedDefault is in effect on the calling thread, tasks run on
+     * that pool; otherwise the Executor runs tasks on its own thread.
      */
     Executor();
 
+    /**
+     * Constructs an Executor which runs tasks on a @c Strand of an @c ExecutorPool.
+     *
+     * @param pool The pool to run tasks on.  If this is @c nullptr, the Executor runs tasks on its own thread.
+     */
+    explicit Executor(std::shared_ptr<ExecutorPool> pool);
+
     /**
      * Destructs an Executor.
      */
@@ -65,6 +76,17 @@ public:
     template <typename Task, typename... Args>
     auto submitToFront(Task task, Args&&... args) -> std::future<decltype(task(args...))>;
 
+    /**
+     * Submits a callable type to be executed on an Executor thread without creating a future for its result.  This
+     * is cheaper than @c submit(), and callables which fit in @c TaskFunction::INLINE_SIZE bytes (such as lambdas
+     * capturing a few pointers) are queued without allocating memory once the Executor has warmed up.
+     *
+     * @param task A callable type representing a task.
+     * @returns Whether the task was queued.  Tasks submitted after @c shutdown() are dropped.
+     */
+    template <typename Task>
+    bool submitDetached(Task&& task);
+
     /**
      * Wait for any previously submitted tasks to complete.
      */
@@ -77,21 +99,41 @@ public:
     bool isShutdown();
 
 private:
+    /// Lets the @c Strand (if any) know that a task has been queued.
+    void notifyTaskQueued();
+
     /// The queue of tasks to execute.
     std::shared_ptr<TaskQueue> m_taskQueue;
 
-    /// The thread to execute tasks on. The thread must be declared last to be destructed first.
+    /// The @c Strand to execute tasks on, if the Executor is on an @c ExecutorPool.
+    std::shared_ptr<Strand> m_strand;
+
+    /// The thread to execute tasks on, if the Executor is not on an @c ExecutorPool. The thread must be declared last
+    /// to be destructed first.
     std::unique_ptr<TaskThread> m_taskThread;
 };
 
 template <typename Task, typename... Args>
 auto Executor::submit(Task task, Args&&... args) -> std::future<decltype(task(args...))> {
-    return m_taskQueue->push(task, std::forward<Args>(args)...);
+    auto future = m_taskQueue->push(task, std::forward<Args>(args)...);
+    notifyTaskQueued();
+    return future;
 }
 
 template <typename Task, typename... Args>
 auto Executor::submitToFront(Task task, Args&&... args) -> std::future<decltype(task(args...))> {
-    return m_taskQueue->pushToFront(task, std::forward<Args>(args)...);
+    auto future = m_taskQueue->pushToFront(task, std::forward<Args>(args)...);
+    notifyTaskQueued();
+    return future;
+}
+
+template <typename Task>
+bool Executor::submitDetached(Task&& task) {
+    if (!m_taskQueue->pushDetached(std::forward<Task>(task))) {
+        return false;
+    }
+    notifyTaskQueued();
+    return true;
 }
 
 }  // namespace threading
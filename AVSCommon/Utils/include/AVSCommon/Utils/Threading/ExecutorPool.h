@@ -0,0 +1,201 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_EXECUTORPOOL_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_EXECUTORPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+class Strand;
+
+/**
+ * An @c ExecutorPool runs the tasks of many @c Strands on a fixed number of shared worker threads.  Tasks submitted
+ * through a single @c Strand run one at a time in submission order, but different @c Strands run concurrently.
+ *
+ * Each worker has its own queue of runnable @c Strands.  A @c Strand made runnable by a worker goes to that worker's
+ * queue, other @c Strands are spread across the queues, and idle workers steal from the queues of busy ones.
+ *
+ * The usual way to use a pool is to construct @c Executors on it (see @c Executor::Executor(std::shared_ptr<
+ * ExecutorPool>) and @c ScopedDefault), so that objects which own an @c Executor share the pool's threads instead of
+ * each starting their own.
+ *
+ * @note Because the worker threads are shared, a task which blocks waiting for work on another @c Strand of the same
+ *     pool ties up a worker while it waits.  Pools should be sized with enough threads to cover such waits.
+ */
+class ExecutorPool {
+public:
+    /**
+     * Creates an @c ExecutorPool.
+     *
+     * @param numThreads The number of worker threads to run.
+     * @return The new pool, or @c nullptr if @c numThreads is zero.
+     */
+    static std::shared_ptr<ExecutorPool> create(size_t numThreads);
+
+    /**
+     * Makes @c Executors which are default-constructed on the calling thread run on a pool for the lifetime of this
+     * object.  This allows components which own an @c Executor to be moved onto a shared pool without changing their
+     * interfaces.  Instances may be nested; the previous default is restored on destruction.
+     *
+     * @note This applies to every @c Executor constructed on the thread, including those created by helpers of the
+     *     components, so the components created in the scope should be audited for tasks which block.
+     */
+    class ScopedDefault {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param pool The pool to use for default-constructed @c Executors, or @c nullptr to give them their own
+         *     threads.
+         */
+        explicit ScopedDefault(std::shared_ptr<ExecutorPool> pool);
+
+        /// Destructor, which restores the previous default.
+        ~ScopedDefault();
+
+    private:
+        /// The @c ExecutorPool class reads @c m_pool.
+        friend class ExecutorPool;
+
+        /// The pool to use for default-constructed @c Executors.
+        std::shared_ptr<ExecutorPool> m_pool;
+
+        /// The default which was in effect when this object was constructed.
+        ScopedDefault* m_previous;
+    };
+
+    /**
+     * Gets the pool which default-constructed @c Executors on the calling thread should use.
+     *
+     * @return The pool set by the innermost @c ScopedDefault on this thread, or @c nullptr if there is none.
+     */
+    static std::shared_ptr<ExecutorPool> getDefault();
+
+    /// Destructor, which stops and joins the worker threads.  Any @c Strands still queued are dropped.
+    ~ExecutorPool();
+
+    /**
+     * Gets the number of worker threads.
+     *
+     * @return The number of worker threads.
+     */
+    size_t getNumThreads() const;
+
+private:
+    /// A queue of runnable @c Strands owned by one worker.
+    struct WorkerQueue {
+        /// Protects @c strands.
+        std::mutex mutex;
+
+        /// The runnable @c Strands.
+        std::deque<std::shared_ptr<Strand>> strands;
+    };
+
+    /**
+     * The state shared by the pool and its workers.  This is kept separate from the pool so that a worker can release
+     * the last reference to the pool (for example by destroying the last @c Executor on it) and still exit cleanly.
+     */
+    struct State {
+        /**
+         * Constructor.
+         *
+         * @param numThreads The number of worker threads.
+         */
+        explicit State(size_t numThreads);
+
+        /**
+         * Makes @c strand runnable.
+         *
+         * @param strand The @c Strand to run.
+         */
+        void enqueue(std::shared_ptr<Strand> strand);
+
+        /**
+         * Takes a runnable @c Strand from the worker's own queue, or steals one from another worker.
+         *
+         * @param index The index of the calling worker.
+         * @return A @c Strand to run, or @c nullptr if there are none.
+         */
+        std::shared_ptr<Strand> dequeue(size_t index);
+
+        /// One queue per worker.
+        std::vector<std::unique_ptr<WorkerQueue>> queues;
+
+        /// The number of @c Strands in all the queues.  Increments are made with @c wakeMutex held so that a worker
+        /// which is about to sleep cannot miss them.
+        std::atomic<size_t> queuedCount;
+
+        /// Used to pick the queue for @c Strands made runnable by threads outside the pool.
+        std::atomic<size_t> nextQueue;
+
+        /// Protects sleeping and waking workers.
+        std::mutex wakeMutex;
+
+        /// Notified when a @c Strand is queued or the pool is shutting down.
+        std::condition_variable wakeCondition;
+
+        /// Whether the pool is shutting down.
+        bool shutdown;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param numThreads The number of worker threads to run.
+     */
+    explicit ExecutorPool(size_t numThreads);
+
+    /**
+     * Makes @c strand runnable.  This is called by @c Strand when it has tasks to run.
+     *
+     * @param strand The @c Strand to run.
+     */
+    void enqueue(std::shared_ptr<Strand> strand);
+
+    /**
+     * The main loop of a worker thread.
+     *
+     * @param state The state shared with the pool.
+     * @param index The index of the worker.
+     */
+    static void workerLoop(std::shared_ptr<State> state, size_t index);
+
+    /// The @c Strand class calls @c enqueue().
+    friend class Strand;
+
+    /// The state shared with the workers.
+    std::shared_ptr<State> m_state;
+
+    /// The worker threads.
+    std::vector<std::thread> m_threads;
+};
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_EXECUTORPOOL_H_
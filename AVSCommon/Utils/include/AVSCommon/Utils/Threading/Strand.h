@@ -0,0 +1,104 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_STRAND_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_STRAND_H_
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "AVSCommon/Utils/Threading/ExecutorPool.h"
+#include "AVSCommon/Utils/Threading/TaskQueue.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+/**
+ * A @c Strand runs the tasks from a @c TaskQueue on the threads of an @c ExecutorPool, one task at a time and in queue
+ * order.  It is the pool-based counterpart of a @c TaskThread.
+ */
+class Strand : public std::enable_shared_from_this<Strand> {
+public:
+    /**
+     * Creates a @c Strand.
+     *
+     * @param pool The pool to run tasks on.
+     * @param taskQueue The queue to take tasks from.
+     * @return The new @c Strand, or @c nullptr if either parameter is @c nullptr.
+     */
+    static std::shared_ptr<Strand> create(std::shared_ptr<ExecutorPool> pool, std::shared_ptr<TaskQueue> taskQueue);
+
+    /**
+     * Makes sure the @c Strand will run the tasks in its queue.  This must be called after each task is pushed onto
+     * the queue.
+     */
+    void notifyTaskQueued();
+
+    /**
+     * Stops running tasks.  If a task is running on another thread, this waits for it to complete.  This may safely
+     * be called from one of the @c Strand's own tasks.
+     */
+    void shutdown();
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param pool The pool to run tasks on.
+     * @param taskQueue The queue to take tasks from.
+     */
+    Strand(std::shared_ptr<ExecutorPool> pool, std::shared_ptr<TaskQueue> taskQueue);
+
+    /// Runs queued tasks.  This is called by an @c ExecutorPool worker.
+    void run();
+
+    /// The @c ExecutorPool class calls @c run().
+    friend class ExecutorPool;
+
+    /// The pool to run tasks on.  This keeps the pool alive for as long as it has work.
+    std::shared_ptr<ExecutorPool> m_pool;
+
+    /// The queue to take tasks from.
+    std::shared_ptr<TaskQueue> m_taskQueue;
+
+    /// Protects the members below.
+    std::mutex m_mutex;
+
+    /// Notified when a task finishes running.
+    std::condition_variable m_taskFinished;
+
+    /// Whether the @c Strand is queued in, or running on, the pool.
+    bool m_scheduled;
+
+    /// Whether a task is running.
+    bool m_running;
+
+    /// The thread which is running a task, if @c m_running.
+    std::thread::id m_runningThread;
+
+    /// Whether @c shutdown() has been called.
+    bool m_shutdown;
+};
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_STRAND_H_
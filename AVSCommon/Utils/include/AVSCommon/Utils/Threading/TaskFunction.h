@@ -0,0 +1,268 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_TASKFUNCTION_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_TASKFUNCTION_H_
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+/**
+ * A move-only wrapper for a callable with the signature @c void().  Unlike @c std::function, it does not require the
+ * callable to be copyable, and callables of up to @c INLINE_SIZE bytes (such as lambdas capturing a few pointers or
+ * @c std::shared_ptrs) are stored inside the object rather than on the heap.
+ */
+class TaskFunction {
+public:
+    /// The size of the storage for callables which are stored inline.
+    static const size_t INLINE_SIZE = 48;
+
+    /**
+     * Checks whether a callable type will be stored inline.
+     *
+     * @tparam Callable The type of callable.
+     * @return Whether a @c Callable will be stored inline.
+     */
+    template <typename Callable>
+    static constexpr bool isStoredInline();
+
+    /// Constructs an empty @c TaskFunction.
+    TaskFunction();
+
+    /**
+     * Constructs a @c TaskFunction which holds a callable.
+     *
+     * @param callable The callable to hold.
+     */
+    template <
+        typename Callable,
+        typename = typename std::enable_if<
+            !std::is_same<typename std::decay<Callable>::type, TaskFunction>::value>::type>
+    TaskFunction(Callable&& callable);
+
+    /**
+     * Move constructor.
+     *
+     * @param other The @c TaskFunction to move from, which is left empty.
+     */
+    TaskFunction(TaskFunction&& other);
+
+    /**
+     * Move assignment operator.
+     *
+     * @param other The @c TaskFunction to move from, which is left empty.
+     * @return This object.
+     */
+    TaskFunction& operator=(TaskFunction&& other);
+
+    /// Deleted copy constructor.
+    TaskFunction(const TaskFunction&) = delete;
+
+    /// Deleted copy assignment operator.
+    TaskFunction& operator=(const TaskFunction&) = delete;
+
+    /// Destructor.
+    ~TaskFunction();
+
+    /// Calls the callable.  The @c TaskFunction must not be empty.
+    void operator()();
+
+    /**
+     * Checks whether this @c TaskFunction holds a callable.
+     *
+     * @return Whether this @c TaskFunction holds a callable.
+     */
+    explicit operator bool() const;
+
+    /// Destroys the callable, leaving this @c TaskFunction empty.
+    void reset();
+
+private:
+    /// The functions used to manage a type of callable.
+    struct Operations {
+        /// Calls the callable in @c storage.
+        void (*invoke)(void* storage);
+
+        /// Moves the callable from @c from to @c to, and destroys the one in @c from.
+        void (*relocate)(void* from, void* to);
+
+        /// Destroys the callable in @c storage.
+        void (*destroy)(void* storage);
+    };
+
+    /**
+     * The @c Operations for a callable which is stored inline.
+     *
+     * @tparam Callable The type of callable.
+     */
+    template <typename Callable>
+    struct InlineOperations {
+        /// @copydoc Operations::invoke
+        static void invoke(void* storage) {
+            (*static_cast<Callable*>(storage))();
+        }
+
+        /// @copydoc Operations::relocate
+        static void relocate(void* from, void* to) {
+            new (to) Callable(std::move(*static_cast<Callable*>(from)));
+            static_cast<Callable*>(from)->~Callable();
+        }
+
+        /// @copydoc Operations::destroy
+        static void destroy(void* storage) {
+            static_cast<Callable*>(storage)->~Callable();
+        }
+
+        /// The @c Operations.
+        static const Operations operations;
+    };
+
+    /**
+     * The @c Operations for a callable which is stored on the heap.  The storage holds a pointer to the callable.
+     *
+     * @tparam Callable The type of callable.
+     */
+    template <typename Callable>
+    struct HeapOperations {
+        /// @copydoc Operations::invoke
+        static void invoke(void* storage) {
+            (**static_cast<Callable**>(storage))();
+        }
+
+        /// @copydoc Operations::relocate
+        static void relocate(void* from, void* to) {
+            *static_cast<Callable**>(to) = *static_cast<Callable**>(from);
+        }
+
+        /// @copydoc Operations::destroy
+        static void destroy(void* storage) {
+            delete *static_cast<Callable**>(storage);
+        }
+
+        /// The @c Operations.
+        static const Operations operations;
+    };
+
+    /**
+     * Stores a callable inline.
+     *
+     * @param callable The callable to store.
+     */
+    template <typename Callable>
+    void store(Callable&& callable, std::true_type);
+
+    /**
+     * Stores a callable on the heap.
+     *
+     * @param callable The callable to store.
+     */
+    template <typename Callable>
+    void store(Callable&& callable, std::false_type);
+
+    /// The @c Operations for the callable, or @c nullptr if this @c TaskFunction is empty.
+    const Operations* m_operations;
+
+    /// The storage for the callable, or for a pointer to it.
+    typename std::aligned_storage<INLINE_SIZE, alignof(std::max_align_t)>::type m_storage;
+};
+
+template <typename Callable>
+const TaskFunction::Operations TaskFunction::InlineOperations<Callable>::operations = {&invoke, &relocate, &destroy};
+
+template <typename Callable>
+const TaskFunction::Operations TaskFunction::HeapOperations<Callable>::operations = {&invoke, &relocate, &destroy};
+
+template <typename Callable>
+constexpr bool TaskFunction::isStoredInline() {
+    return sizeof(Callable) <= INLINE_SIZE && alignof(Callable) <= alignof(std::max_align_t) &&
+           std::is_nothrow_move_constructible<Callable>::value;
+}
+
+inline TaskFunction::TaskFunction() : m_operations{nullptr} {
+}
+
+template <typename Callable, typename>
+TaskFunction::TaskFunction(Callable&& callable) {
+    // Dispatch at compile time, so that the inline path is never instantiated for callables which don't fit.
+    store(
+        std::forward<Callable>(callable),
+        std::integral_constant<bool, isStoredInline<typename std::decay<Callable>::type>()>());
+}
+
+template <typename Callable>
+void TaskFunction::store(Callable&& callable, std::true_type) {
+    using CallableType = typename std::decay<Callable>::type;
+    new (&m_storage) CallableType(std::forward<Callable>(callable));
+    m_operations = &InlineOperations<CallableType>::operations;
+}
+
+template <typename Callable>
+void TaskFunction::store(Callable&& callable, std::false_type) {
+    using CallableType = typename std::decay<Callable>::type;
+    *reinterpret_cast<CallableType**>(&m_storage) = new CallableType(std::forward<Callable>(callable));
+    m_operations = &HeapOperations<CallableType>::operations;
+}
+
+inline TaskFunction::TaskFunction(TaskFunction&& other) : m_operations{other.m_operations} {
+    if (m_operations) {
+        m_operations->relocate(&other.m_storage, &m_storage);
+        other.m_operations = nullptr;
+    }
+}
+
+inline TaskFunction& TaskFunction::operator=(TaskFunction&& other) {
+    if (this != &other) {
+        reset();
+        if (other.m_operations) {
+            other.m_operations->relocate(&other.m_storage, &m_storage);
+            m_operations = other.m_operations;
+            other.m_operations = nullptr;
+        }
+    }
+    return *this;
+}
+
+inline TaskFunction::~TaskFunction() {
+    reset();
+}
+
+inline void TaskFunction::operator()() {
+    m_operations->invoke(&m_storage);
+}
+
+inline TaskFunction::operator bool() const {
+    return m_operations != nullptr;
+}
+
+inline void TaskFunction::reset() {
+    if (m_operations) {
+        m_operations->destroy(&m_storage);
+        m_operations = nullptr;
+    }
+}
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_TASKFUNCTION_H_
@@ -18,13 +18,14 @@
 
 #include <atomic>
 #include <condition_variable>
-#include <deque>
 #include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
 #include <utility>
 
+#include "AVSCommon/Utils/Threading/TaskFunction.h"
+
 namespace alexaClientSDK {
 namespace avsCommon {
 namespace utils {
@@ -35,11 +36,61 @@ namespace threading {
  */
 class TaskQueue {
 public:
+    /**
+     * A task which has been taken from a TaskQueue.  Tasks are held in nodes which are recycled by the queue, so once
+     * the queue has warmed up, queuing a task does not allocate a node.
+     */
+    class QueuedTask {
+    public:
+        /// Runs the task.
+        void operator()();
+
+    private:
+        /// The TaskQueue class manages the nodes.
+        friend class TaskQueue;
+
+        /// The next task in the queue (or in the list of free nodes).
+        QueuedTask* m_next;
+
+        /// The task.
+        TaskFunction m_function;
+    };
+
+    /// Deleter which returns a @c QueuedTask to the queue it came from.
+    class QueuedTaskRecycler {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param queue The queue to return tasks to, or @c nullptr to delete them.
+         */
+        QueuedTaskRecycler(TaskQueue* queue = nullptr);
+
+        /**
+         * Destroys the task and returns its node to the queue.
+         *
+         * @param task The task to recycle.
+         */
+        void operator()(QueuedTask* task) const;
+
+    private:
+        /// The queue to return tasks to.
+        TaskQueue* m_queue;
+    };
+
+    /// An owning pointer to a @c QueuedTask.  This must be destroyed before the TaskQueue it came from.
+    using QueuedTaskPtr = std::unique_ptr<QueuedTask, QueuedTaskRecycler>;
+
     /**
      * Constructs an empty TaskQueue.
      */
     TaskQueue();
 
+    /**
+     * Destructor.
+     */
+    ~TaskQueue();
+
     /**
      * Pushes a task on the back of the queue. If the queue is shutdown, the task will be dropped, and an invalid
      * future will be returned.
@@ -64,13 +115,31 @@ public:
     template <typename Task, typename... Args>
     auto pushToFront(Task task, Args&&... args) -> std::future<decltype(task(args...))>;
 
+    /**
+     * Pushes a task on the back of the queue without creating a future for its result.  This avoids the bookkeeping
+     * @c push() needs for its future, and tasks which fit in @c TaskFunction::INLINE_SIZE bytes are queued without
+     * allocating memory once the queue has warmed up.
+     *
+     * @param task A task to push to the back of the queue.
+     * @returns Whether the task was queued.  If the queue is shutdown, the task will be dropped.
+     */
+    template <typename Task>
+    bool pushDetached(Task&& task);
+
     /**
      * Returns and removes the task at the front of the queue. If there are no tasks, this call will block until there
      * is one. A @c nullptr will be returned if there are no more tasks expected.
      *
      * @returns A task which the caller assumes ownership of, or @c nullptr if the TaskQueue expects no more tasks.
      */
-    std::unique_ptr<std::function<void()>> pop();
+    QueuedTaskPtr pop();
+
+    /**
+     * Returns and removes the task at the front of the queue without blocking.
+     *
+     * @returns A task which the caller assumes ownership of, or @c nullptr if the queue is empty.
+     */
+    QueuedTaskPtr tryPop();
 
     /**
      * Clears the queue of outstanding tasks and refuses any additional tasks to be pushed onto the queue.
@@ -87,8 +156,6 @@ public:
     bool isShutdown();
 
 private:
-    /// The queue type to use for holding tasks.
-    using Queue = std::deque<std::unique_ptr<std::function<void()>>>;
 
     /**
      * Pushes a task on the the queue. If the queue is shutdown, the task will be dropped, and an invalid
@@ -103,13 +170,45 @@ private:
     template <typename Task, typename... Args>
     auto pushTo(bool front, Task task, Args&&... args) -> std::future<decltype(task(args...))>;
 
-    /// The queue of tasks
-    Queue m_queue;
+    /**
+     * Pushes a function on the queue.
+     *
+     * @param front If @c true, push to the front of the queue, else push to the back.
+     * @param function The function to push.
+     * @returns Whether the function was queued.  If the queue is shutdown, the function will be dropped.
+     */
+    bool pushFunction(bool front, TaskFunction&& function);
+
+    /**
+     * Removes the task at the front of the queue.  @c m_queueMutex must be held, and the queue must not be empty.
+     *
+     * @returns The task.
+     */
+    QueuedTaskPtr popFrontLocked();
+
+    /**
+     * Returns a task's node to the list of free nodes.
+     *
+     * @param task The task, which has already been destroyed.
+     */
+    void recycle(QueuedTask* task);
+
+    /// The first task in the queue.
+    QueuedTask* m_head;
+
+    /// The last task in the queue.
+    QueuedTask* m_tail;
+
+    /// Nodes available for reuse.
+    QueuedTask* m_freeTasks;
+
+    /// The number of nodes in @c m_freeTasks.
+    size_t m_freeTaskCount;
 
     /// A condition variable to wait for new tasks to be placed on the queue.
     std::condition_variable m_queueChanged;
 
-    /// A mutex to protect access to the tasks in m_queue.
+    /// A mutex to protect access to the tasks in the queue and the free nodes.
     std::mutex m_queueMutex;
 
     /// A flag for whether or not the queue is expecting more tasks.
@@ -122,6 +221,12 @@ auto TaskQueue::push(Task task, Args&&... args) -> std::future<decltype(task(arg
     return pushTo(!front, std::forward<Task>(task), std::forward<Args>(args)...);
 }
 
+template <typename Task>
+bool TaskQueue::pushDetached(Task&& task) {
+    bool front = true;
+    return pushFunction(!front, TaskFunction(std::forward<Task>(task)));
+}
+
 template <typename Task, typename... Args>
 auto TaskQueue::pushToFront(Task task, Args&&... args) -> std::future<decltype(task(args...))> {
     bool front = true;
@@ -192,17 +297,12 @@ auto TaskQueue::pushTo(bool front, Task task, Args&&... args) -> std::future<dec
     // Release our local reference to packaged task so that the only remaining reference is inside the lambda.
     packaged_task.reset();
 
-    {
-        std::lock_guard<std::mutex> queueLock{m_queueMutex};
-        if (!m_shutdown) {
-            m_queue.emplace(front ? m_queue.begin() : m_queue.end(), new std::function<void()>(translated_task));
-        } else {
-            using FutureType = decltype(task(args...));
-            return std::future<FutureType>();
-        }
+    // The lambda only captures two shared pointers, so it is stored inline in the TaskFunction.
+    if (!pushFunction(front, TaskFunction(std::move(translated_task)))) {
+        using FutureType = decltype(task(args...));
+        return std::future<FutureType>();
     }
 
-    m_queueChanged.notify_all();
     return cleanupFuture;
 }
 
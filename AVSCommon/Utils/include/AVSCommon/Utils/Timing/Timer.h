@@ -18,8 +18,10 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <functional>
 #include <future>
+#include <memory>
 #include <mutex>
 #include <thread>
 
@@ -32,6 +34,10 @@ namespace timing {
 
 /**
  * A @c Timer is used to schedule a callable type to run in the future.
+ *
+ * Tasks are called on the dispatch threads of the process-wide @c TimerService, which are shared by all @c Timers.  A
+ * task which blocks does not delay other @c Timers, but ties up a thread (and the service starts another), so work
+ * which may block for long should be handed off to an @c Executor from the task.
  */
 class Timer {
 public:
@@ -173,57 +179,44 @@ public:
     bool isActive() const;
 
 private:
-    /**
-     * Atomically activates this @c Timer (by setting @c m_running).
-     *
-     * @returns @c true if the @c Timer was previously inactive, else @c false.
-     */
-    bool activate();
+    /// The state of a @c Timer, which is shared with the callbacks it has scheduled.
+    struct State;
 
     /**
-     * Waits for the @c Timer @c period, then calls @c task.
-     *
-     * @tparam Rep A type for measuring 'ticks' in a generic @c std::chrono::duration.
-     * @tparam Period A type for representing the number of ticks per second in a generic @c std::chrono::duration.
+     * Starts the @c Timer on the @c TimerService.
      *
      * @param delay The non-negative time to wait before making the first @c task call.
      * @param period The non-negative time to wait between subsequent @c task calls.
      * @param periodType The type of period to use when making subsequent task calls.
      * @param maxCount The desired number of times to call task.  @c Timer::FOREVER means to call forever until
-     *     @c stop() is called.  Note that fewer than @c maxCount calls may occur if @c periodType is
-     *     @c PeriodType::ABSOLUTE and the task runtime exceeds @c period.
+     *     @c stop() is called.
      * @param task A callable type representing a task.
+     * @returns @c true if the timer started, else @c false.
      */
-    template <typename Rep, typename Period>
-    void callTask(
-        std::chrono::duration<Rep, Period> delay,
-        std::chrono::duration<Rep, Period> period,
+    bool startTimer(
+        std::chrono::nanoseconds delay,
+        std::chrono::nanoseconds period,
         PeriodType periodType,
         size_t maxCount,
         std::function<void()> task);
 
     /**
-     * The tag associated with log entries from this class.
+     * Calls the task for a @c Timer and schedules the next call.  This runs on a @c TimerService dispatch thread.
+     *
+     * @param state The state of the @c Timer.
+     * @param generation The value of @c State::generation when the call was scheduled.  Calls scheduled before the
+     *     most recent @c stop() are ignored.
+     * @param task The task to call.
      */
-    static const std::string TAG;
-
-    /// The condition variable used to wait for @c stop() or period timeouts.
-    std::condition_variable m_waitCondition;
-
-    /// The mutex for @c m_waitCondition.
-    std::mutex m_waitMutex;
-
-    /// The thread to execute tasks on.
-    std::thread m_thread;
-
-    /// Flag which indicates that a @c Timer is active.
-    std::atomic<bool> m_running;
+    static void callTask(std::shared_ptr<State> state, uint64_t generation, std::function<void()> task);
 
     /**
-     * Flag which requests that the active @c Timer be stopped.  @c m_waitMutex must be locked when modifying this
-     * variable.
+     * The tag associated with log entries from this class.
      */
-    bool m_stopping;
+    static const std::string TAG;
+
+    /// The state of this @c Timer.
+    std::shared_ptr<State> m_state;
 };
 
 template <typename Rep, typename Period, typename Task, typename... Args>
@@ -243,17 +236,6 @@ bool Timer::start(
         return false;
     }
 
-    // Can't start if already running.
-    if (!activate()) {
-        logger::acsdkError(logger::LogEntry(TAG, "startFailed").d("reason", "timerAlreadyActive"));
-        return false;
-    }
-
-    // Join old timer thread (if any).
-    if (m_thread.joinable()) {
-        m_thread.join();
-    }
-
     // Remove arguments from the task's type by binding the arguments to the task.
     using BoundTaskType = decltype(std::bind(std::forward<Task>(task), std::forward<Args>(args)...));
     auto boundTask = std::make_shared<BoundTaskType>(std::bind(std::forward<Task>(task), std::forward<Args>(args)...));
@@ -261,11 +243,12 @@ bool Timer::start(
     // Remove the return type from the task by wrapping it in a lambda with no return value.
     auto translatedTask = [boundTask]() { boundTask->operator()(); };
 
-    // Kick off the new timer thread.
-    m_thread = std::thread{
-        std::bind(&Timer::callTask<Rep, Period>, this, delay, period, periodType, maxCount, translatedTask)};
-
-    return true;
+    return startTimer(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(delay),
+        std::chrono::duration_cast<std::chrono::nanoseconds>(period),
+        periodType,
+        maxCount,
+        translatedTask);
 }
 
 template <typename Rep, typename Period, typename Task, typename... Args>
@@ -281,18 +264,12 @@ bool Timer::start(
 template <typename Rep, typename Period, typename Task, typename... Args>
 auto Timer::start(const std::chrono::duration<Rep, Period>& delay, Task task, Args&&... args)
     -> std::future<decltype(task(args...))> {
-    // Can't start if already running.
-    if (!activate()) {
-        logger::acsdkError(logger::LogEntry(TAG, "startFailed").d("reason", "timerAlreadyActive"));
-        using FutureType = decltype(task(args...));
+    using FutureType = decltype(task(args...));
+    if (delay < std::chrono::duration<Rep, Period>::zero()) {
+        logger::acsdkError(logger::LogEntry(TAG, "startFailed").d("reason", "negativeDelay"));
         return std::future<FutureType>();
     }
 
-    // Join old timer thread (if any).
-    if (m_thread.joinable()) {
-        m_thread.join();
-    }
-
     // Remove arguments from the task's type by binding the arguments to the task.
     auto boundTask = std::bind(std::forward<Task>(task), std::forward<Args>(args)...);
 
@@ -307,66 +284,13 @@ auto Timer::start(const std::chrono::duration<Rep, Period>& delay, Task task, Ar
     // Remove the return type from the task by wrapping it in a lambda with no return value.
     auto translatedTask = [packagedTask]() { packagedTask->operator()(); };
 
-    // Kick off the new timer thread.
+    auto future = packagedTask->get_future();
     static const size_t once = 1;
-    m_thread = std::thread{
-        std::bind(&Timer::callTask<Rep, Period>, this, delay, delay, PeriodType::ABSOLUTE, once, translatedTask)};
-
-    return packagedTask->get_future();
-}
-
-template <typename Rep, typename Period>
-void Timer::callTask(
-    std::chrono::duration<Rep, Period> delay,
-    std::chrono::duration<Rep, Period> period,
-    PeriodType periodType,
-    size_t maxCount,
-    std::function<void()> task) {
-    // Timepoint to measure delay/period against.
-    auto now = std::chrono::steady_clock::now();
-
-    // Flag indicating whether we've drifted off schedule.
-    bool offSchedule = false;
-
-    for (size_t count = 0; maxCount == FOREVER || count < maxCount; ++count) {
-        auto waitTime = (0 == count) ? delay : period;
-        {
-            std::unique_lock<std::mutex> lock(m_waitMutex);
-
-            // Wait for stop() or a delay/period to elapse.
-            if (m_waitCondition.wait_until(lock, now + waitTime, [this]() { return m_stopping; })) {
-                m_stopping = false;
-                m_running = false;
-                return;
-            }
-        }
-
-        switch (periodType) {
-            case PeriodType::ABSOLUTE:
-                // Update our estimate of where we should be after the delay.
-                now += waitTime;
-
-                // Run the task if we're still on schedule.
-                if (!offSchedule) {
-                    task();
-                }
-
-                // If the task runtime put us off schedule, skip the next task run.
-                if (now + period < std::chrono::steady_clock::now()) {
-                    offSchedule = true;
-                } else {
-                    offSchedule = false;
-                }
-                break;
-
-            case PeriodType::RELATIVE:
-                task();
-                now = std::chrono::steady_clock::now();
-                break;
-        }
+    auto nanosecondDelay = std::chrono::duration_cast<std::chrono::nanoseconds>(delay);
+    if (!startTimer(nanosecondDelay, nanosecondDelay, PeriodType::ABSOLUTE, once, translatedTask)) {
+        return std::future<FutureType>();
     }
-    m_stopping = false;
-    m_running = false;
+    return future;
 }
 
 }  // namespace timing
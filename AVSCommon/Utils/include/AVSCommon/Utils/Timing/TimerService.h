@@ -0,0 +1,384 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERSERVICE_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERSERVICE_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/**
+ * A @c TimerService runs callbacks at requested times on a small set of shared dispatch threads.  Pending callbacks
+ * are kept in a hierarchical timing wheel, so scheduling and cancelling a callback take constant time regardless of
+ * how many are pending, and the thread watching the wheel only wakes when a callback is due (or when pending callbacks
+ * need to be moved to a finer level of the wheel).
+ *
+ * Before running a callback, the thread watching the wheel hands the wheel to an idle dispatch thread.  If none is
+ * idle, it waits for one, and only starts a new thread if a running callback appears to be blocked, so that a callback
+ * which blocks delays the others by at most a few milliseconds.  A thread returning from a callback runs any which are
+ * already due before going idle.  Threads which stay idle for longer than the idle timeout exit while another thread
+ * is idle as well.  Usually this means two threads in all, however many callbacks are pending.  Callbacks scheduled on
+ * the same @c Handle never run concurrently.
+ *
+ * Most code should use @c Timer, which runs on the process-wide instance returned by @c getInstance().
+ */
+class TimerService {
+public:
+    /**
+     * A slot for one scheduled callback.  A @c Handle may be scheduled any number of times, but only holds one pending
+     * callback at a time.  Destroying a @c Handle cancels its pending callback.
+     */
+    class Handle {
+    public:
+        /// Destructor.
+        ~Handle();
+
+    private:
+        /// The @c TimerService class manages @c Handles.
+        friend class TimerService;
+
+        /**
+         * Constructor.
+         *
+         * @param service The service this @c Handle belongs to.
+         */
+        explicit Handle(TimerService* service);
+
+        /// The service this @c Handle belongs to.
+        TimerService* m_service;
+
+        /// The previous @c Handle in the list this one is on.
+        Handle* m_prev;
+
+        /// The next @c Handle in the list this one is on.
+        Handle* m_next;
+
+        /// The level of the wheel this @c Handle is on, or one of @c EXPIRED, @c DEFERRED, @c FAR_FUTURE or @c IDLE.
+        int m_level;
+
+        /// The slot (within @c m_level) this @c Handle is in.
+        int m_slot;
+
+        /// The tick at which the callback is due.
+        uint64_t m_expiry;
+
+        /// The number of @c cancel() calls waiting for this @c Handle's callback to return.
+        int m_cancelWaiters;
+
+        /// The pending callback.
+        std::function<void()> m_callback;
+    };
+
+    /**
+     * Creates a @c TimerService.
+     *
+     * @param tick The resolution of the service.  Callbacks are never run early, and usually run within one tick of
+     *     their deadline.
+     * @param idleThreadTimeout How long a surplus dispatch thread stays idle before it exits.
+     * @return The new @c TimerService.
+     */
+    static std::shared_ptr<TimerService> create(
+        std::chrono::nanoseconds tick = std::chrono::milliseconds(1),
+        std::chrono::milliseconds idleThreadTimeout = std::chrono::seconds(10));
+
+    /**
+     * Gets the process-wide @c TimerService.  It is created on first use and never destroyed.
+     *
+     * @return The process-wide @c TimerService.
+     */
+    static std::shared_ptr<TimerService> getInstance();
+
+    /**
+     * Destructor, which stops the dispatch threads, waiting for running callbacks to return.  Pending callbacks are
+     * dropped without running.  All @c Handles must be destroyed before the @c TimerService, and it must not be
+     * destroyed by one of its own callbacks.
+     */
+    ~TimerService();
+
+    /**
+     * Creates a @c Handle for scheduling callbacks on this service.
+     *
+     * @return The new @c Handle.
+     */
+    std::unique_ptr<Handle> createHandle();
+
+    /**
+     * Schedules a callback, replacing any callback already pending on @c handle.  If @c deadline has already passed,
+     * the callback runs as soon as possible.
+     *
+     * @param handle The @c Handle to schedule the callback on.
+     * @param deadline The time at which the callback should run.
+     * @param callback The callback to run.
+     */
+    void schedule(Handle* handle, std::chrono::steady_clock::time_point deadline, std::function<void()> callback);
+
+    /**
+     * Cancels the callback pending on @c handle, if any.  If the callback for @c handle is running and @c cancel() is
+     * called from another thread, this waits for the callback to return, and anything the callback schedules on
+     * @c handle in the meantime is dropped.
+     *
+     * @param handle The @c Handle to cancel.
+     * @return Whether a pending callback was cancelled.
+     */
+    bool cancel(Handle* handle);
+
+    /**
+     * Gets the number of pending callbacks.
+     *
+     * @return The number of pending callbacks.
+     */
+    size_t getPendingCount();
+
+    /**
+     * Gets the number of dispatch threads.
+     *
+     * @return The number of dispatch threads which have not exited.
+     */
+    size_t getThreadCount();
+
+private:
+    /// The number of bits of a tick number used to select a slot at each level.
+    static const int SLOT_BITS = 6;
+
+    /// The number of slots at each level.
+    static const int SLOTS_PER_LEVEL = 1 << SLOT_BITS;
+
+    /// The number of levels.  Each level covers @c SLOTS_PER_LEVEL times the span of the level below.
+    static const int LEVELS = 4;
+
+    /// Value of @c Handle::m_level for handles which are due to run.
+    static const int EXPIRED = -1;
+
+    /// Value of @c Handle::m_level for handles which are not pending.
+    static const int IDLE = -2;
+
+    /// Value of @c Handle::m_level for handles which are due beyond the span of the wheel.
+    static const int FAR_FUTURE = -3;
+
+    /// Value of @c Handle::m_level for handles which fell due while their previous callback was still running.
+    static const int DEFERRED = -4;
+
+    /// An intrusive list of @c Handles.
+    struct List {
+        /// The first @c Handle in the list.
+        Handle* head = nullptr;
+
+        /// The last @c Handle in the list.
+        Handle* tail = nullptr;
+    };
+
+    /// A callback which is running.
+    struct RunningCallback {
+        /// The @c Handle the callback was scheduled on.  This may have been destroyed by the callback.
+        Handle* handle;
+
+        /// The thread running the callback.
+        std::thread::id thread;
+
+        /// When the callback started.
+        std::chrono::steady_clock::time_point started;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param tick The resolution of the service.
+     * @param idleThreadTimeout How long a surplus dispatch thread stays idle before it exits.
+     */
+    TimerService(std::chrono::nanoseconds tick, std::chrono::milliseconds idleThreadTimeout);
+
+    /**
+     * Converts a time to the first tick at or after it.
+     *
+     * @param time The time to convert.
+     * @return The tick.
+     */
+    uint64_t toTickCeiling(std::chrono::steady_clock::time_point time) const;
+
+    /**
+     * Converts a time to the last tick at or before it.
+     *
+     * @param time The time to convert.
+     * @return The tick.
+     */
+    uint64_t toTickFloor(std::chrono::steady_clock::time_point time) const;
+
+    /**
+     * Adds a handle to the end of a list.
+     *
+     * @param list The list.
+     * @param handle The handle, which must not be on any list.
+     */
+    static void append(List* list, Handle* handle);
+
+    /**
+     * Adds a handle to the wheel.  @c m_mutex must be held.
+     *
+     * @param handle The handle, which must not be on any list.
+     */
+    void insertLocked(Handle* handle);
+
+    /**
+     * Removes a handle from whichever list it is on.  @c m_mutex must be held.
+     *
+     * @param handle The handle.
+     */
+    void unlinkLocked(Handle* handle);
+
+    /**
+     * Finds the next tick at which a slot in the wheel needs processing.  @c m_mutex must be held.
+     *
+     * @return The tick, or @c UINT64_MAX if the wheel is empty.
+     */
+    uint64_t nextEventTickLocked() const;
+
+    /**
+     * Processes the wheel up to and including @c tick, moving due handles to the expired list.  @c m_mutex must be
+     * held.
+     *
+     * @param tick The tick to process up to.
+     */
+    void advanceLocked(uint64_t tick);
+
+    /**
+     * Checks whether the callback for a handle is running on a thread other than the calling one.  @c m_mutex must be
+     * held.
+     *
+     * @param handle The handle.
+     * @return Whether the callback for @c handle is running on another thread.
+     */
+    bool isRunningElsewhereLocked(Handle* handle) const;
+
+    /**
+     * Checks whether the callback for a handle is running on the calling thread.  @c m_mutex must be held.
+     *
+     * @param handle The handle.
+     * @return Whether the callback for @c handle is running on the calling thread.
+     */
+    bool isRunningHereLocked(Handle* handle) const;
+
+    /**
+     * Runs the callback of a due handle on the calling thread.  @c m_mutex must be held, and is released while the
+     * callback runs.
+     *
+     * @param lock The lock on @c m_mutex.
+     * @param handle The handle, which must be on the expired list.
+     */
+    void runLocked(std::unique_lock<std::mutex>& lock, Handle* handle);
+
+    /**
+     * Starts a new dispatch thread, first joining any which have exited.  @c m_mutex must be held.
+     *
+     * @return Whether the thread was started.
+     */
+    bool startThreadLocked();
+
+    /**
+     * Releases a @c Handle which is being destroyed.
+     *
+     * @param handle The @c Handle.
+     */
+    void release(Handle* handle);
+
+    /// The main loop of the dispatch threads.
+    void dispatchLoop();
+
+    /// The resolution of the service.
+    const std::chrono::nanoseconds m_tick;
+
+    /// How long a surplus dispatch thread stays idle before it exits.
+    const std::chrono::milliseconds m_idleThreadTimeout;
+
+    /// The time of tick zero.
+    const std::chrono::steady_clock::time_point m_epoch;
+
+    /// Protects the members below.
+    std::mutex m_mutex;
+
+    /// Notified when the thread watching the wheel may need to wake earlier, or shut down.
+    std::condition_variable m_wakeCondition;
+
+    /// Notified when an idle dispatch thread should take over watching the wheel, or shut down.
+    std::condition_variable m_followerCondition;
+
+    /// Notified when a callback returns.
+    std::condition_variable m_callbackFinished;
+
+    /// The last tick which has been processed.
+    uint64_t m_currentTick;
+
+    /// The tick at which the thread watching the wheel plans to wake, or @c UINT64_MAX if it is waiting indefinitely.
+    uint64_t m_plannedWakeTick;
+
+    /// The slots of the wheel.
+    List m_slots[LEVELS][SLOTS_PER_LEVEL];
+
+    /// For each level, a bit mask of the slots which are not empty.
+    uint64_t m_occupied[LEVELS];
+
+    /// Handles which are due beyond the span of the wheel.  These are re-filed each time the wheel wraps.
+    List m_farFuture;
+
+    /// Handles which are due to run.
+    List m_expired;
+
+    /// Handles which are due to run once their previous callback returns.
+    List m_deferred;
+
+    /// The number of pending callbacks.
+    size_t m_pendingCount;
+
+    /// The callbacks which are running.
+    std::vector<RunningCallback> m_running;
+
+    /// Whether a dispatch thread is watching the wheel, or has been offered to.
+    bool m_hasLeader;
+
+    /// Whether the leader has handed over, and the next idle (or new) dispatch thread should take over.
+    bool m_leadershipOffered;
+
+    /// The number of dispatch threads waiting on @c m_followerCondition.
+    size_t m_idleFollowers;
+
+    /// Whether the thread watching the wheel is waiting for a dispatch thread to become idle.
+    bool m_waitingForFollower;
+
+    /// Whether the service is shutting down.
+    bool m_shutdown;
+
+    /// The dispatch threads.  Threads are added when the others are blocked in callbacks, and exit when surplus.
+    std::vector<std::thread> m_threads;
+
+    /// The dispatch threads which have exited, and are waiting to be joined.
+    std::vector<std::thread::id> m_exitedThreads;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERSERVICE_H_
@@ -0,0 +1,478 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/File/AssetCache.h"
+
+#include <dirent.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "AVSCommon/Utils/Crypto/SHA256.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/String/StringUtils.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace file {
+
+using namespace avsCommon::avs::attachment;
+using namespace avsCommon::sdkInterfaces;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("AssetCache");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The root key for the asset cache in the configuration.
+static const std::string ASSET_CACHE_CONFIGURATION_ROOT_KEY = "assetCache";
+
+/// The key for the cache directory in the configuration.
+static const std::string DIRECTORY_KEY = "directory";
+
+/// The key for the size of the cache, in kilobytes, in the configuration.
+static const std::string MAX_SIZE_KEY = "maxSizeKB";
+
+/// The size of the cache, in kilobytes, if the configuration does not set one.
+static const int DEFAULT_MAX_SIZE_KB = 10 * 1024;
+
+/// The name of the index file in the cache directory.
+static const std::string INDEX_FILE_NAME = "index";
+
+/// The suffix of the file the index is written to before it replaces the index.
+static const std::string TEMPORARY_FILE_SUFFIX = ".tmp";
+
+/// The name of the file an asset is downloaded to before it is named after its digest.
+static const std::string DOWNLOAD_FILE_NAME = "download.tmp";
+
+/// The size of the chunks in which assets are downloaded and read.
+static const size_t CHUNK_SIZE = 4096;
+
+/// The schemes of the URLs which are fetched.
+static const std::vector<std::string> FETCHED_SCHEMES = {"http://", "https://"};
+
+/// The length of a SHA-256 digest in hexadecimal.
+static const size_t DIGEST_LENGTH = crypto::SHA256::DIGEST_HEX_LENGTH;
+
+/**
+ * Gets the size of a file.
+ *
+ * @param path The path of the file.
+ * @param[out] size The size of the file.
+ * @return Whether the file exists.
+ */
+static bool getFileSize(const std::string& path, uint64_t* size) {
+    struct stat fileStatus;
+    if (stat(path.c_str(), &fileStatus) != 0 || !S_ISREG(fileStatus.st_mode)) {
+        return false;
+    }
+    *size = static_cast<uint64_t>(fileStatus.st_size);
+    return true;
+}
+
+/**
+ * Checks whether the name of a file in the cache directory is one the cache creates: the digest of an asset, or a
+ * download or index in progress.  Other files are never removed, in case the directory is shared.
+ *
+ * @param name The name of the file.
+ * @return Whether the file was created by the cache.
+ */
+static bool isCacheFileName(const std::string& name) {
+    if (DOWNLOAD_FILE_NAME == name || INDEX_FILE_NAME + TEMPORARY_FILE_SUFFIX == name) {
+        return true;
+    }
+    return DIGEST_LENGTH == name.length() &&
+           std::all_of(name.begin(), name.end(), [](char c) { return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f'); });
+}
+
+/**
+ * Checks whether a URL is fetched by the cache.
+ *
+ * @param url The URL.
+ * @return Whether the scheme of the URL is fetched.
+ */
+static bool isFetched(const std::string& url) {
+    auto lowerCaseUrl = string::stringToLowerCase(url);
+    for (auto& scheme : FETCHED_SCHEMES) {
+        if (0 == lowerCaseUrl.compare(0, scheme.length(), scheme)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::shared_ptr<AssetCache> AssetCache::create(
+    const configuration::ConfigurationNode& configurationRoot,
+    std::shared_ptr<HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory) {
+    auto configuration = configurationRoot[ASSET_CACHE_CONFIGURATION_ROOT_KEY];
+    std::string directory;
+    if (!configuration.getString(DIRECTORY_KEY, &directory) || directory.empty()) {
+        ACSDK_DEBUG5(LX("createSkipped").d("reason", "noDirectoryConfigured"));
+        return nullptr;
+    }
+    int maxSizeKB = DEFAULT_MAX_SIZE_KB;
+    configuration.getInt(MAX_SIZE_KEY, &maxSizeKB, DEFAULT_MAX_SIZE_KB);
+    if (maxSizeKB <= 0) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "invalidMaxSize").d("maxSizeKB", maxSizeKB));
+        return nullptr;
+    }
+    return create(directory, static_cast<uint64_t>(maxSizeKB) * 1024, contentFetcherFactory);
+}
+
+std::shared_ptr<AssetCache> AssetCache::create(
+    const std::string& directory,
+    uint64_t maxSizeInBytes,
+    std::shared_ptr<HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory) {
+    if (directory.empty()) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "emptyDirectory"));
+        return nullptr;
+    }
+    if (0 == maxSizeInBytes) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "zeroMaxSize"));
+        return nullptr;
+    }
+    if (!contentFetcherFactory) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullContentFetcherFactory"));
+        return nullptr;
+    }
+
+    if (mkdir(directory.c_str(), S_IRWXU) != 0 && errno != EEXIST) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "mkdirFailed").d("directory", directory).d("errno", errno));
+        return nullptr;
+    }
+    char absolutePath[PATH_MAX];
+    if (!realpath(directory.c_str(), absolutePath)) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "realpathFailed").d("directory", directory).d("errno", errno));
+        return nullptr;
+    }
+
+    std::shared_ptr<AssetCache> cache(
+        new AssetCache(std::string(absolutePath) + "/", maxSizeInBytes, contentFetcherFactory));
+    cache->load();
+    return cache;
+}
+
+AssetCache::AssetCache(
+    const std::string& directory,
+    uint64_t maxSizeInBytes,
+    std::shared_ptr<HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory) :
+        m_directory{directory},
+        m_maxSizeInBytes{maxSizeInBytes},
+        m_contentFetcherFactory{contentFetcherFactory},
+        m_sizeInBytes{0},
+        m_isIndexStale{false},
+        m_statistics{0, 0, 0, 0, 0, 0, 0, 0} {
+}
+
+AssetCache::~AssetCache() {
+    m_executor.shutdown();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_isIndexStale) {
+        saveLocked();
+    }
+}
+
+std::future<bool> AssetCache::prefetch(const std::vector<std::string>& urls) {
+    return m_executor.submit([this, urls]() {
+        bool allCached = true;
+        for (auto& url : urls) {
+            if (!fetch(url)) {
+                allCached = false;
+            }
+        }
+        return allCached;
+    });
+}
+
+std::unique_ptr<std::istream> AssetCache::open(const std::string& url) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(url);
+    if (it == m_entries.end()) {
+        ++m_statistics.misses;
+        ACSDK_DEBUG5(LX("openMiss").d("hits", m_statistics.hits).d("misses", m_statistics.misses));
+        return nullptr;
+    }
+    auto digest = it->second.digest;
+    m_recency.splice(m_recency.end(), m_recency, it->second.recency);
+    m_isIndexStale = true;
+    lock.unlock();
+
+    // The content is small, so it is verified in full before any of it is played.  It is read without the lock, so
+    // that other users of the cache do not wait for the file; if the URL is evicted meanwhile, the check fails.
+    std::ifstream file(getFilePath(digest), std::ios::binary);
+    std::string content{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    crypto::SHA256 hash;
+    hash.update(content.data(), content.size());
+    bool isValid = file && hash.finish() == digest;
+
+    lock.lock();
+    it = m_entries.find(url);
+    if (isValid) {
+        ++m_statistics.hits;
+        ACSDK_DEBUG5(LX("openHit").d("hits", m_statistics.hits).d("misses", m_statistics.misses));
+        return std::unique_ptr<std::istream>(new std::istringstream(content));
+    }
+    ++m_statistics.misses;
+    if (it == m_entries.end() || it->second.digest != digest) {
+        // The URL was evicted or replaced while its file was being read.
+        return nullptr;
+    }
+
+    ACSDK_WARN(LX("openFailed").d("reason", "integrityCheckFailed").sensitive("url", url));
+    ++m_statistics.integrityFailures;
+    eraseLocked(url);
+    saveLocked();
+    lock.unlock();
+
+    prefetch({url});
+    return nullptr;
+}
+
+void AssetCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    while (!m_recency.empty()) {
+        eraseLocked(m_recency.front());
+    }
+    saveLocked();
+}
+
+AssetCache::Statistics AssetCache::getStatistics() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto statistics = m_statistics;
+    statistics.entryCount = m_entries.size();
+    statistics.sizeInBytes = m_sizeInBytes;
+    return statistics;
+}
+
+void AssetCache::load() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Each line of the index is "<digest> <url>", least recently used first.
+    std::ifstream index(m_directory + INDEX_FILE_NAME);
+    std::string line;
+    bool isIndexValid = true;
+    while (std::getline(index, line)) {
+        if (line.length() <= DIGEST_LENGTH + 1 || line[DIGEST_LENGTH] != ' ') {
+            isIndexValid = false;
+            continue;
+        }
+        auto digest = line.substr(0, DIGEST_LENGTH);
+        auto url = line.substr(DIGEST_LENGTH + 1);
+        uint64_t size = 0;
+        auto file = m_files.find(digest);
+        if (file != m_files.end()) {
+            size = file->second.size;
+        } else if (!getFileSize(getFilePath(digest), &size)) {
+            isIndexValid = false;
+            continue;
+        }
+        if (m_entries.count(url)) {
+            isIndexValid = false;
+            continue;
+        }
+        insertLocked(url, digest, size);
+    }
+
+    // Remove the files left behind by an interrupted download, save or eviction.
+    auto directory = opendir(m_directory.c_str());
+    if (directory) {
+        std::vector<std::string> orphans;
+        while (auto entry = readdir(directory)) {
+            std::string name = entry->d_name;
+            if (isCacheFileName(name) && !m_files.count(name)) {
+                orphans.push_back(name);
+            }
+        }
+        closedir(directory);
+        for (auto& name : orphans) {
+            ACSDK_DEBUG5(LX("load").d("removingOrphan", name));
+            std::remove((m_directory + name).c_str());
+        }
+    }
+
+    if (!isIndexValid) {
+        ACSDK_WARN(LX("load").m("Dropped invalid index entries."));
+        saveLocked();
+    }
+    ACSDK_DEBUG5(LX("load").d("entries", m_entries.size()).d("sizeInBytes", m_sizeInBytes));
+}
+
+bool AssetCache::fetch(const std::string& url) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_entries.count(url)) {
+            return true;
+        }
+    }
+    if (!isFetched(url) || url.find('\n') != std::string::npos) {
+        ACSDK_DEBUG5(LX("fetchSkipped").d("reason", "unsupportedScheme").sensitive("url", url));
+        return false;
+    }
+
+    std::string digest;
+    uint64_t size = 0;
+    auto downloadPath = m_directory + DOWNLOAD_FILE_NAME;
+    if (!download(url, &digest, &size)) {
+        std::remove(downloadPath.c_str());
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_statistics.fetchFailures;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_files.count(digest)) {
+        std::remove(downloadPath.c_str());
+    } else if (std::rename(downloadPath.c_str(), getFilePath(digest).c_str()) != 0) {
+        ACSDK_ERROR(LX("fetchFailed").d("reason", "renameFailed").d("errno", errno));
+        std::remove(downloadPath.c_str());
+        ++m_statistics.fetchFailures;
+        return false;
+    }
+    ++m_statistics.fetches;
+    insertLocked(url, digest, size);
+    saveLocked();
+    ACSDK_DEBUG5(LX("fetched").d("digest", digest).d("size", size).sensitive("url", url));
+    return true;
+}
+
+bool AssetCache::download(const std::string& url, std::string* digest, uint64_t* size) {
+    auto fetcher = m_contentFetcherFactory->create(url);
+    if (!fetcher) {
+        ACSDK_ERROR(LX("downloadFailed").d("reason", "createFetcherFailed").sensitive("url", url));
+        return false;
+    }
+    auto content = fetcher->getContent(HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY);
+    if (!content || !content->isStatusCodeSuccess() || !content->getDataStream()) {
+        ACSDK_ERROR(LX("downloadFailed")
+                        .d("reason", "fetchFailed")
+                        .d("statusCode", content ? content->getStatusCode() : 0)
+                        .sensitive("url", url));
+        return false;
+    }
+    auto reader = content->getDataStream()->createReader(sds::ReaderPolicy::BLOCKING);
+    if (!reader) {
+        ACSDK_ERROR(LX("downloadFailed").d("reason", "createReaderFailed"));
+        return false;
+    }
+
+    std::ofstream file(m_directory + DOWNLOAD_FILE_NAME, std::ios::binary | std::ios::trunc);
+    crypto::SHA256 hash;
+    *size = 0;
+    std::vector<char> buffer(CHUNK_SIZE);
+    auto readStatus = AttachmentReader::ReadStatus::OK;
+    while (AttachmentReader::ReadStatus::CLOSED != readStatus) {
+        auto bytesRead = reader->read(buffer.data(), buffer.size(), &readStatus);
+        switch (readStatus) {
+            case AttachmentReader::ReadStatus::CLOSED:
+            case AttachmentReader::ReadStatus::OK:
+            case AttachmentReader::ReadStatus::OK_WOULDBLOCK:
+            case AttachmentReader::ReadStatus::OK_TIMEDOUT:
+                break;
+            case AttachmentReader::ReadStatus::OK_OVERRUN_RESET:
+            case AttachmentReader::ReadStatus::ERROR_OVERRUN:
+            case AttachmentReader::ReadStatus::ERROR_BYTES_LESS_THAN_WORD_SIZE:
+            case AttachmentReader::ReadStatus::ERROR_INTERNAL:
+                ACSDK_ERROR(LX("downloadFailed").d("reason", "readFailed").d("status", readStatus));
+                return false;
+        }
+        *size += bytesRead;
+        if (*size > m_maxSizeInBytes) {
+            ACSDK_ERROR(LX("downloadFailed").d("reason", "assetTooLarge").d("maxSizeInBytes", m_maxSizeInBytes));
+            return false;
+        }
+        hash.update(buffer.data(), bytesRead);
+        file.write(buffer.data(), bytesRead);
+    }
+    file.close();
+    if (!file) {
+        ACSDK_ERROR(LX("downloadFailed").d("reason", "writeFailed"));
+        return false;
+    }
+    if (0 == *size) {
+        ACSDK_ERROR(LX("downloadFailed").d("reason", "emptyAsset").sensitive("url", url));
+        return false;
+    }
+    *digest = hash.finish();
+    return true;
+}
+
+void AssetCache::insertLocked(const std::string& url, const std::string& digest, uint64_t size) {
+    auto& file = m_files[digest];
+    if (0 == file.referenceCount) {
+        file.size = size;
+        m_sizeInBytes += size;
+    }
+    ++file.referenceCount;
+    m_entries[url] = {digest, m_recency.insert(m_recency.end(), url)};
+
+    while (m_sizeInBytes > m_maxSizeInBytes && m_recency.front() != url) {
+        ACSDK_DEBUG5(LX("evict").sensitive("url", m_recency.front()));
+        ++m_statistics.evictions;
+        eraseLocked(m_recency.front());
+    }
+}
+
+void AssetCache::eraseLocked(const std::string& url) {
+    auto entry = m_entries.find(url);
+    if (entry == m_entries.end()) {
+        return;
+    }
+    auto file = m_files.find(entry->second.digest);
+    if (0 == --file->second.referenceCount) {
+        m_sizeInBytes -= file->second.size;
+        std::remove(getFilePath(file->first).c_str());
+        m_files.erase(file);
+    }
+    m_recency.erase(entry->second.recency);
+    m_entries.erase(entry);
+}
+
+void AssetCache::saveLocked() {
+    // The index is replaced atomically, so that a crash leaves either the old or the new one.
+    auto indexPath = m_directory + INDEX_FILE_NAME;
+    auto temporaryPath = indexPath + TEMPORARY_FILE_SUFFIX;
+    std::ofstream index(temporaryPath, std::ios::trunc);
+    for (auto& url : m_recency) {
+        index << m_entries[url].digest << ' ' << url << '\n';
+    }
+    index.close();
+    if (!index || std::rename(temporaryPath.c_str(), indexPath.c_str()) != 0) {
+        ACSDK_ERROR(LX("saveFailed").d("errno", errno));
+        std::remove(temporaryPath.c_str());
+        return;
+    }
+    m_isIndexStale = false;
+}
+
+std::string AssetCache::getFilePath(const std::string& digest) const {
+    return m_directory + digest;
+}
+
+}  // namespace file
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -21,10 +21,16 @@ namespace avsCommon {
 namespace utils {
 namespace threading {
 
-Executor::Executor() :
-        m_taskQueue{std::make_shared<TaskQueue>()},
-        m_taskThread{memory::make_unique<TaskThread>(m_taskQueue)} {
-    m_taskThread->start();
+Executor::Executor() : Executor(ExecutorPool::getDefault()) {
+}
+
+Executor::Executor(std::shared_ptr<ExecutorPool> pool) : m_taskQueue{std::make_shared<TaskQueue>()} {
+    if (pool) {
+        m_strand = Strand::create(pool, m_taskQueue);
+    } else {
+        m_taskThread = memory::make_unique<TaskThread>(m_taskQueue);
+        m_taskThread->start();
+    }
 }
 
 Executor::~Executor() {
@@ -41,9 +47,18 @@ void Executor::waitForSubmittedTasks() {
 
 void Executor::shutdown() {
     m_taskQueue->shutdown();
+    if (m_strand) {
+        m_strand->shutdown();
+    }
     m_taskThread.reset();
 }
 
+void Executor::notifyTaskQueued() {
+    if (m_strand) {
+        m_strand->notifyTaskQueued();
+    }
+}
+
 bool Executor::isShutdown() {
     return m_taskQueue->isShutdown();
 }
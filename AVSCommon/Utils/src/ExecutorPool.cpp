@@ -0,0 +1,166 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Memory/Memory.h"
+#include "AVSCommon/Utils/Threading/ExecutorPool.h"
+#include "AVSCommon/Utils/Threading/Strand.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("ExecutorPool");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The pool state of the worker running on this thread, or @c nullptr if this is not a pool thread.
+static thread_local const void* currentWorkerState = nullptr;
+
+/// The index of the worker running on this thread.
+static thread_local size_t currentWorkerIndex = 0;
+
+/// The innermost @c ScopedDefault on this thread.
+static thread_local ExecutorPool::ScopedDefault* currentDefault = nullptr;
+
+std::shared_ptr<ExecutorPool> ExecutorPool::create(size_t numThreads) {
+    if (0 == numThreads) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "zeroThreads"));
+        return nullptr;
+    }
+    return std::shared_ptr<ExecutorPool>(new ExecutorPool(numThreads));
+}
+
+ExecutorPool::ScopedDefault::ScopedDefault(std::shared_ptr<ExecutorPool> pool) :
+        m_pool{std::move(pool)},
+        m_previous{currentDefault} {
+    currentDefault = this;
+}
+
+ExecutorPool::ScopedDefault::~ScopedDefault() {
+    currentDefault = m_previous;
+}
+
+std::shared_ptr<ExecutorPool> ExecutorPool::getDefault() {
+    return currentDefault ? currentDefault->m_pool : nullptr;
+}
+
+ExecutorPool::ExecutorPool(size_t numThreads) : m_state{std::make_shared<State>(numThreads)} {
+    m_threads.reserve(numThreads);
+    for (size_t index = 0; index < numThreads; ++index) {
+        m_threads.emplace_back(&ExecutorPool::workerLoop, m_state, index);
+    }
+}
+
+ExecutorPool::~ExecutorPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_state->wakeMutex);
+        m_state->shutdown = true;
+    }
+    m_state->wakeCondition.notify_all();
+    for (auto& thread : m_threads) {
+        if (thread.get_id() == std::this_thread::get_id()) {
+            // The last reference was released by one of our own tasks.  The worker holds its own reference to the
+            // state, and will exit when the task returns.
+            thread.detach();
+        } else {
+            thread.join();
+        }
+    }
+    for (auto& queue : m_state->queues) {
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->strands.clear();
+    }
+}
+
+size_t ExecutorPool::getNumThreads() const {
+    return m_threads.size();
+}
+
+void ExecutorPool::enqueue(std::shared_ptr<Strand> strand) {
+    m_state->enqueue(std::move(strand));
+}
+
+ExecutorPool::State::State(size_t numThreads) : queuedCount{0}, nextQueue{0}, shutdown{false} {
+    queues.reserve(numThreads);
+    for (size_t index = 0; index < numThreads; ++index) {
+        queues.push_back(memory::make_unique<WorkerQueue>());
+    }
+}
+
+void ExecutorPool::State::enqueue(std::shared_ptr<Strand> strand) {
+    // Keep work made runnable by a worker on that worker, where its data is likely to still be in cache.
+    size_t index = (currentWorkerState == this) ? currentWorkerIndex : nextQueue++ % queues.size();
+    {
+        std::lock_guard<std::mutex> lock(queues[index]->mutex);
+        queues[index]->strands.push_back(std::move(strand));
+    }
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        ++queuedCount;
+    }
+    wakeCondition.notify_one();
+}
+
+std::shared_ptr<Strand> ExecutorPool::State::dequeue(size_t index) {
+    for (size_t offset = 0; offset < queues.size(); ++offset) {
+        auto& queue = *queues[(index + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.strands.empty()) {
+            continue;
+        }
+        std::shared_ptr<Strand> strand;
+        if (0 == offset) {
+            strand = std::move(queue.strands.front());
+            queue.strands.pop_front();
+        } else {
+            // Steal from the opposite end to the owner to reduce contention.
+            strand = std::move(queue.strands.back());
+            queue.strands.pop_back();
+        }
+        --queuedCount;
+        return strand;
+    }
+    return nullptr;
+}
+
+void ExecutorPool::workerLoop(std::shared_ptr<State> state, size_t index) {
+    currentWorkerState = state.get();
+    currentWorkerIndex = index;
+    while (true) {
+        auto strand = state->dequeue(index);
+        if (strand) {
+            strand->run();
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(state->wakeMutex);
+        state->wakeCondition.wait(lock, [&state] { return state->shutdown || state->queuedCount > 0; });
+        if (state->shutdown) {
+            return;
+        }
+    }
+}
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
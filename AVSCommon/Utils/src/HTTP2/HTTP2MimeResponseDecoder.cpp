@@ -13,6 +13,9 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+#include <cstring>
+
 #include <AVSCommon/Utils/Logger/Logger.h>
 
 #include "AVSCommon/Utils/HTTP2/HTTP2MimeResponseDecoder.h"
@@ -37,10 +40,18 @@ static const std::string TAG("HTTP2MimeResponseDecoder");
 static const char CARRIAGE_RETURN_ASCII = 13;
 /// ASCII value of LF
 static const char LINE_FEED_ASCII = 10;
+/// ASCII value of a hyphen.
+static const char HYPHEN_ASCII = '-';
+/// Separator between a MIME header name and its value.
+static const char HEADER_SEPARATOR = ':';
+/// Leading whitespace skipped in MIME header values.
+static const char HEADER_VALUE_WHITESPACE[] = " \t";
 /// CRLF sequence
-static const char CRLF_SEQUENCE[] = {CARRIAGE_RETURN_ASCII, LINE_FEED_ASCII};
+static const std::string CRLF_SEQUENCE = "\r\n";
 /// Size of CLRF in chars
-static const int LEADING_CRLF_CHAR_SIZE = sizeof(CRLF_SEQUENCE) / sizeof(*CRLF_SEQUENCE);
+static const size_t LEADING_CRLF_CHAR_SIZE = CRLF_SEQUENCE.size();
+/// The two hyphens which start a boundary line.
+static const std::string BOUNDARY_HYPHENS = "--";
 
 /// MIME boundary string prefix in HTTP header.
 static const std::string BOUNDARY_PREFIX = "boundary=";
@@ -53,14 +64,12 @@ HTTP2MimeResponseDecoder::HTTP2MimeResponseDecoder(std::shared_ptr<HTTP2MimeResp
         m_sink{sink},
         m_responseCode{0},
         m_lastStatus{HTTP2ReceiveDataStatus::SUCCESS},
-        m_index{0},
-        m_leadingCRLFCharsLeftToRemove{LEADING_CRLF_CHAR_SIZE},
         m_boundaryFound{false},
-        m_lastSuccessIndex{0} {
-    m_multipartReader.onPartBegin = HTTP2MimeResponseDecoder::partBeginCallback;
-    m_multipartReader.onPartData = HTTP2MimeResponseDecoder::partDataCallback;
-    m_multipartReader.onPartEnd = HTTP2MimeResponseDecoder::partEndCallback;
-    m_multipartReader.userData = this;
+        m_delimiterSkip(),
+        m_state{State::START},
+        m_matched{0},
+        m_replayLength{0},
+        m_resumeOffset{0} {
     ACSDK_DEBUG5(LX(__func__));
 }
 
@@ -88,7 +97,12 @@ bool HTTP2MimeResponseDecoder::onReceiveHeaderLine(const std::string& line) {
         if (line.find(BOUNDARY_PREFIX) != std::string::npos) {
             std::string boundary{line.substr(line.find(BOUNDARY_PREFIX))};
             boundary = boundary.substr(BOUNDARY_PREFIX_SIZE, boundary.find(BOUNDARY_DELIMITER) - BOUNDARY_PREFIX_SIZE);
-            m_multipartReader.setBoundary(boundary);
+            m_delimiter = CRLF_SEQUENCE + BOUNDARY_HYPHENS + boundary;
+            m_boundaryLine = m_delimiter + CRLF_SEQUENCE;
+            m_delimiterSkip.fill(m_delimiter.size());
+            for (size_t i = 0; i + 1 < m_delimiter.size(); ++i) {
+                m_delimiterSkip[static_cast<unsigned char>(m_delimiter[i])] = m_delimiter.size() - 1 - i;
+            }
             m_boundaryFound = true;
         }
     }
@@ -96,68 +110,6 @@ bool HTTP2MimeResponseDecoder::onReceiveHeaderLine(const std::string& line) {
     return m_sink->onReceiveHeaderLine(line);
 }
 
-void HTTP2MimeResponseDecoder::partBeginCallback(const MultipartHeaders& headers, void* userData) {
-    HTTP2MimeResponseDecoder* decoder = static_cast<HTTP2MimeResponseDecoder*>(userData);
-    if (!decoder) {
-        ACSDK_ERROR(LX("partBeginCallbackFailed").d("reason", "nullDecoder"));
-        return;
-    }
-    switch (decoder->m_lastStatus) {
-        case HTTP2ReceiveDataStatus::SUCCESS:
-            // Pass notification and headers through to our sink.
-            if (!decoder->m_sink->onBeginMimePart(headers)) {
-                // Sink doesn't want the next part? ABORT!
-                decoder->m_lastStatus = HTTP2ReceiveDataStatus::ABORT;
-            }
-        case HTTP2ReceiveDataStatus::PAUSE:
-            // PAUSE state will switch to SUCCESS when partDataCallback() consumes the previously paused
-            // part chunk.  So, ignore any previous parsed part-begin notifications or notifications
-            // that arrive after our sink switches to the PAUSED state.
-            break;
-        case HTTP2ReceiveDataStatus::ABORT:
-            // If in the ABORT state, ignore all notifications.
-            break;
-    }
-}
-
-void HTTP2MimeResponseDecoder::partDataCallback(const char* buffer, size_t size, void* userData) {
-    HTTP2MimeResponseDecoder* decoder = static_cast<HTTP2MimeResponseDecoder*>(userData);
-    if (!decoder) {
-        ACSDK_ERROR(LX("partDataCallbackFailed").d("reason", "nullDecoder"));
-        return;
-    }
-    if (!buffer) {
-        ACSDK_ERROR(LX("partDataCallbackFailed").d("reason", "nullBuffer"));
-        return;
-    }
-    // Increment the counter for partDataCallbacks.
-    decoder->m_index++;
-    // Check if we can resume callbacks to sink again.
-    if (decoder->m_lastStatus == HTTP2ReceiveDataStatus::PAUSE &&
-        decoder->m_index == (decoder->m_lastSuccessIndex + 1)) {
-        decoder->m_lastStatus = HTTP2ReceiveDataStatus::SUCCESS;
-    }
-    // Continue only if successful so far.
-    if (decoder->m_lastStatus == HTTP2ReceiveDataStatus::SUCCESS) {
-        decoder->m_lastStatus = decoder->m_sink->onReceiveMimeData(buffer, size);
-        // Update checkpoint.
-        if (decoder->m_lastStatus == HTTP2ReceiveDataStatus::SUCCESS) {
-            decoder->m_lastSuccessIndex = decoder->m_index;
-        }
-    }
-}
-
-void HTTP2MimeResponseDecoder::partEndCallback(void* userData) {
-    HTTP2MimeResponseDecoder* decoder = static_cast<HTTP2MimeResponseDecoder*>(userData);
-    if (!decoder) {
-        ACSDK_ERROR(LX("partEndCallbackFailed").d("reason", "nullDecoder"));
-        return;
-    }
-    if ((decoder->m_lastStatus == HTTP2ReceiveDataStatus::SUCCESS) && !decoder->m_sink->onEndMimePart()) {
-        decoder->m_lastStatus = HTTP2ReceiveDataStatus::ABORT;
-    }
-}
-
 HTTP2ReceiveDataStatus HTTP2MimeResponseDecoder::onReceiveData(const char* bytes, size_t size) {
     ACSDK_DEBUG5(LX(__func__).d("size", size));
     if (!bytes) {
@@ -174,8 +126,6 @@ HTTP2ReceiveDataStatus HTTP2MimeResponseDecoder::onReceiveData(const char* bytes
             }
         }
 
-        auto readerCheckpoint = m_multipartReader;
-        auto oldLeadingCRLFCharsLeftToRemove = m_leadingCRLFCharsLeftToRemove;
         /**
          * If no boundary found...
          */
@@ -184,57 +134,287 @@ HTTP2ReceiveDataStatus HTTP2MimeResponseDecoder::onReceiveData(const char* bytes
         }
 
         /**
-         * Our parser expects no leading CRLF in the data stream. Additionally downchannel streams
-         * include this CRLF but event streams do not. So ensure that a leading CRLF in the data stream is removed,
-         * if it exists.
+         * After a PAUSE, the same data is delivered again, so skip what was consumed before pausing.  The parser state
+         * is exactly as it was when the sink refused the data.
          */
-        if (m_leadingCRLFCharsLeftToRemove > 0) {
-            size_t posInCRLF = LEADING_CRLF_CHAR_SIZE - m_leadingCRLFCharsLeftToRemove;
-            while (m_leadingCRLFCharsLeftToRemove > 0 && size > 0) {
-                if (*bytes == CRLF_SEQUENCE[posInCRLF]) {
-                    bytes++;
-                    size--;
-                    m_leadingCRLFCharsLeftToRemove--;
-                    posInCRLF++;
-                } else {
-                    if (1 == m_leadingCRLFCharsLeftToRemove) {
-                        // Having only CR instead of CRLF indicates a broken stream, so we may safely report error here.
-                        return HTTP2ReceiveDataStatus::ABORT;
-                    }
-                    m_leadingCRLFCharsLeftToRemove = 0;
-                    break;
-                }
-            }
+        auto skip = std::min(m_resumeOffset, size);
+        m_resumeOffset = 0;
+        m_lastStatus = HTTP2ReceiveDataStatus::SUCCESS;
+        auto consumed = parse(bytes + skip, size - skip);
+        if (HTTP2ReceiveDataStatus::PAUSE == m_lastStatus) {
+            m_resumeOffset = skip + consumed;
+        }
+    }
+
+    return m_lastStatus;
+}
+
+size_t HTTP2MimeResponseDecoder::parse(const char* bytes, size_t size) {
+    size_t position = 0;
+    while (position < size && HTTP2ReceiveDataStatus::SUCCESS == m_lastStatus) {
+        switch (m_state) {
+            case State::START:
+            case State::AFTER_BOUNDARY:
+            case State::AFTER_BOUNDARY_CR:
+            case State::AFTER_BOUNDARY_HYPHEN:
+                parseBoundaryByte(bytes[position]);
+                position++;
+                break;
+            case State::HEADERS:
+                position = parseHeaders(bytes, position, size);
+                break;
+            case State::HEADERS_AFTER_EMPTY_LINE:
+                position = parseAfterEmptyLine(bytes, position, size);
+                break;
+            case State::DATA:
+                position = parseData(bytes, position, size);
+                break;
+            case State::END:
+                position = size;
+                break;
+        }
+    }
+    return position;
+}
 
-            if (0 == size) {
-                return HTTP2ReceiveDataStatus::SUCCESS;
+void HTTP2MimeResponseDecoder::parseBoundaryByte(char c) {
+    switch (m_state) {
+        case State::START:
+            /**
+             * Downchannel streams start with a CRLF before the first boundary but event streams do not, so skip the
+             * CRLF at the start of the delimiter if the data starts with the hyphens.
+             */
+            if (0 == m_matched && HYPHEN_ASCII == c) {
+                m_matched = LEADING_CRLF_CHAR_SIZE;
+            }
+            if (c != m_delimiter[m_matched]) {
+                abortParse("malformedFirstBoundary");
+                return;
+            }
+            if (++m_matched == m_delimiter.size()) {
+                m_matched = 0;
+                m_state = State::AFTER_BOUNDARY;
+            }
+            return;
+        case State::AFTER_BOUNDARY:
+            if (CARRIAGE_RETURN_ASCII == c) {
+                m_state = State::AFTER_BOUNDARY_CR;
+            } else if (HYPHEN_ASCII == c) {
+                m_state = State::AFTER_BOUNDARY_HYPHEN;
+            } else {
+                abortParse("malformedBoundaryEnding");
+            }
+            return;
+        case State::AFTER_BOUNDARY_CR:
+            if (LINE_FEED_ASCII != c) {
+                abortParse("missingLineFeedAfterBoundary");
+                return;
+            }
+            m_headerLine.clear();
+            m_headers.clear();
+            m_state = State::HEADERS;
+            return;
+        case State::AFTER_BOUNDARY_HYPHEN:
+            if (HYPHEN_ASCII != c) {
+                abortParse("malformedCloseBoundary");
+                return;
             }
+            m_state = State::END;
+            return;
+        case State::HEADERS:
+        case State::HEADERS_AFTER_EMPTY_LINE:
+        case State::DATA:
+        case State::END:
+            break;
+    }
+    ACSDK_ERROR(LX("parseBoundaryByteFailed").d("reason", "unexpectedState"));
+    m_lastStatus = HTTP2ReceiveDataStatus::ABORT;
+}
+
+size_t HTTP2MimeResponseDecoder::parseHeaders(const char* bytes, size_t position, size_t size) {
+    auto lineFeed = static_cast<const char*>(memchr(bytes + position, LINE_FEED_ASCII, size - position));
+    if (!lineFeed) {
+        m_headerLine.append(bytes + position, size - position);
+        return size;
+    }
+    m_headerLine.append(bytes + position, lineFeed - (bytes + position));
+    position = lineFeed - bytes + 1;
+
+    if (m_headerLine.empty() || m_headerLine.back() != CARRIAGE_RETURN_ASCII) {
+        abortParse("missingCarriageReturnInHeaders");
+        return position;
+    }
+    m_headerLine.pop_back();
+
+    if (m_headerLine.empty()) {
+        if (m_headers.empty()) {
+            // This may be a header-less part, or a CRLF before a repeated boundary line.
+            m_state = State::HEADERS_AFTER_EMPTY_LINE;
+            m_matched = 0;
+        } else {
+            beginPart();
         }
+        return position;
+    }
 
-        m_index = 0;
-        m_multipartReader.feed(bytes, size);
+    // Skip a repeated boundary line.
+    if (m_headers.empty() &&
+        0 == m_headerLine.compare(0, std::string::npos, m_delimiter, LEADING_CRLF_CHAR_SIZE, std::string::npos)) {
+        m_headerLine.clear();
+        return position;
+    }
 
-        if (m_multipartReader.hasError()) {
-            ACSDK_ERROR(LX("onReceiveDataFailed")
-                            .d("reason", "mimeParseError")
-                            .d("error", m_multipartReader.getErrorMessage()));
-            m_lastStatus = HTTP2ReceiveDataStatus::ABORT;
+    auto separator = m_headerLine.find(HEADER_SEPARATOR);
+    if (std::string::npos == separator || 0 == separator) {
+        abortParse("malformedHeader");
+        return position;
+    }
+    auto value = m_headerLine.find_first_not_of(HEADER_VALUE_WHITESPACE, separator + 1);
+    if (std::string::npos == value) {
+        value = m_headerLine.size();
+    }
+    m_headers.emplace(m_headerLine.substr(0, separator), m_headerLine.substr(value));
+    m_headerLine.clear();
+    return position;
+}
+
+size_t HTTP2MimeResponseDecoder::parseAfterEmptyLine(const char* bytes, size_t position, size_t size) {
+    // Compare with the boundary line after its leading CRLF, which was the empty line.
+    while (position < size) {
+        if (bytes[position] != m_boundaryLine[LEADING_CRLF_CHAR_SIZE + m_matched]) {
+            // A part without headers.  The bytes that matched so far are the start of its data.
+            m_replayLength = m_matched;
+            m_matched = 0;
+            beginPart();
+            return position;
         }
+        position++;
+        if (LEADING_CRLF_CHAR_SIZE + ++m_matched == m_boundaryLine.size()) {
+            m_matched = 0;
+            m_state = State::HEADERS;
+            return position;
+        }
+    }
+    return position;
+}
 
-        switch (m_lastStatus) {
-            case HTTP2ReceiveDataStatus::SUCCESS:
-                m_lastSuccessIndex = 0;
-                break;
-            case HTTP2ReceiveDataStatus::PAUSE:
-                m_multipartReader = readerCheckpoint;
-                m_leadingCRLFCharsLeftToRemove = oldLeadingCRLFCharsLeftToRemove;
+size_t HTTP2MimeResponseDecoder::parseData(const char* bytes, size_t position, size_t size) {
+    if (m_replayLength > 0) {
+        if (!deliverData(m_boundaryLine.data() + LEADING_CRLF_CHAR_SIZE, m_replayLength)) {
+            return position;
+        }
+        m_replayLength = 0;
+    }
+
+    /**
+     * Continue matching a delimiter that started at the end of the previous chunk.  As the only CR in the delimiter
+     * is its first byte, after a mismatch no later delimiter can start within the bytes matched so far, so they are
+     * all part data: the held back ones (which equal the start of the delimiter) and those in this chunk (which are
+     * scanned as data below).
+     */
+    if (m_matched > 0) {
+        auto matched = m_matched;
+        auto end = position;
+        while (end < size && matched < m_delimiter.size() && bytes[end] == m_delimiter[matched]) {
+            end++;
+            matched++;
+        }
+        if (matched == m_delimiter.size()) {
+            m_matched = 0;
+            if (!m_sink->onEndMimePart()) {
+                m_lastStatus = HTTP2ReceiveDataStatus::ABORT;
+            }
+            m_state = State::AFTER_BOUNDARY;
+            return end;
+        }
+        if (end == size) {
+            m_matched = matched;
+            return end;
+        }
+        if (!deliverData(m_delimiter.data(), m_matched)) {
+            return position;
+        }
+        m_matched = 0;
+    }
+
+    // Find the next delimiter.
+    auto start = position;
+    auto delimiter = m_delimiter.data();
+    auto delimiterSize = m_delimiter.size();
+    size_t dataEnd = size;
+    auto delimiterLast = static_cast<unsigned char>(delimiter[delimiterSize - 1]);
+    size_t matched = 0;
+    while (position + delimiterSize <= size) {
+        auto last = static_cast<unsigned char>(bytes[position + delimiterSize - 1]);
+        /**
+         * Most bytes do not occur in the delimiter, so the whole delimiter can be skipped.  Testing for that with a
+         * branch, rather than always adding the skip, lets the CPU run ahead without waiting for each table lookup.
+         */
+        if (m_delimiterSkip[last] == delimiterSize && last != delimiterLast) {
+            position += delimiterSize;
+            continue;
+        }
+        if (last == delimiterLast &&
+            0 == memcmp(bytes + position, delimiter, delimiterSize - 1)) {
+            dataEnd = position;
+            matched = delimiterSize;
+            break;
+        }
+        position += m_delimiterSkip[last];
+    }
+
+    // Otherwise look for the start of a delimiter at the end of the chunk.
+    if (matched < delimiterSize) {
+        position = std::max(start, size >= delimiterSize ? size - delimiterSize + 1 : 0);
+        while (position < size) {
+            auto carriageReturn =
+                static_cast<const char*>(memchr(bytes + position, CARRIAGE_RETURN_ASCII, size - position));
+            if (!carriageReturn) {
                 break;
-            case HTTP2ReceiveDataStatus::ABORT:
+            }
+            position = carriageReturn - bytes;
+            if (0 == memcmp(carriageReturn, delimiter, size - position)) {
+                dataEnd = position;
+                matched = size - position;
                 break;
+            }
+            position++;
         }
     }
 
-    return m_lastStatus;
+    if (dataEnd > start && !deliverData(bytes + start, dataEnd - start)) {
+        return start;
+    }
+    if (matched == delimiterSize) {
+        if (!m_sink->onEndMimePart()) {
+            m_lastStatus = HTTP2ReceiveDataStatus::ABORT;
+        }
+        m_state = State::AFTER_BOUNDARY;
+        return dataEnd + delimiterSize;
+    }
+    m_matched = matched;
+    return size;
+}
+
+void HTTP2MimeResponseDecoder::beginPart() {
+    m_state = State::DATA;
+    m_matched = 0;
+    if (!m_sink->onBeginMimePart(m_headers)) {
+        // Sink doesn't want the next part? ABORT!
+        m_lastStatus = HTTP2ReceiveDataStatus::ABORT;
+    }
+    m_headers.clear();
+    m_headerLine.clear();
+}
+
+bool HTTP2MimeResponseDecoder::deliverData(const char* bytes, size_t size) {
+    m_lastStatus = m_sink->onReceiveMimeData(bytes, size);
+    return HTTP2ReceiveDataStatus::SUCCESS == m_lastStatus;
+}
+
+void HTTP2MimeResponseDecoder::abortParse(const char* reason) {
+    ACSDK_ERROR(LX("onReceiveDataFailed").d("reason", "mimeParseError").d("error", reason));
+    m_lastStatus = HTTP2ReceiveDataStatus::ABORT;
 }
 
 void HTTP2MimeResponseDecoder::onResponseFinished(HTTP2ResponseFinishedStatus status) {
@@ -101,6 +101,53 @@ CURLMcode CurlMultiHandleWrapper::wait(std::chrono::milliseconds timeout, int* c
     return result;
 }
 
+/// The first version of libcurl with @c curl_multi_poll() and @c curl_multi_wakeup(), 7.68.0.
+#define ACSDK_CURL_VERSION_WITH_WAKEUP 0x074400
+
+bool CurlMultiHandleWrapper::isWakeupSupported() {
+#if LIBCURL_VERSION_NUM >= ACSDK_CURL_VERSION_WITH_WAKEUP
+    return true;
+#else
+    return false;
+#endif
+}
+
+CURLMcode CurlMultiHandleWrapper::poll(std::chrono::milliseconds timeout, int* countHandlesUpdated) {
+#if LIBCURL_VERSION_NUM >= ACSDK_CURL_VERSION_WITH_WAKEUP
+    auto result = curl_multi_poll(m_handle, NULL, 0, timeout.count(), countHandlesUpdated);
+    if (result != CURLM_OK) {
+        ACSDK_ERROR(LX("curlMultiPollFailed").d("error", curl_multi_strerror(result)));
+    }
+    return result;
+#else
+    return wait(timeout, countHandlesUpdated);
+#endif
+}
+
+CURLMcode CurlMultiHandleWrapper::wakeup() {
+#if LIBCURL_VERSION_NUM >= ACSDK_CURL_VERSION_WITH_WAKEUP
+    auto result = curl_multi_wakeup(m_handle);
+    if (result != CURLM_OK) {
+        ACSDK_ERROR(LX("curlMultiWakeupFailed").d("error", curl_multi_strerror(result)));
+    }
+    return result;
+#else
+    return CURLM_OK;
+#endif
+}
+
+CURLMcode CurlMultiHandleWrapper::timeout(std::chrono::milliseconds* timeout) {
+    long timeoutMs = -1;
+    auto result = curl_multi_timeout(m_handle, &timeoutMs);
+    if (result != CURLM_OK) {
+        ACSDK_ERROR(LX("curlMultiTimeoutFailed").d("error", curl_multi_strerror(result)));
+    }
+    if (timeout) {
+        *timeout = std::chrono::milliseconds(timeoutMs);
+    }
+    return result;
+}
+
 CURLMsg* CurlMultiHandleWrapper::infoRead(int* messagesInQueue) {
     return curl_multi_info_read(m_handle, messagesInQueue);
 }
@@ -0,0 +1,225 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+
+#include <AVSCommon/Utils/LibcurlUtils/HTTPContentFetcherConnectionPool.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("HTTPContentFetcherConnectionPool");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The separator between the scheme and the rest of a URL.
+static const std::string SCHEME_SEPARATOR = "://";
+
+const size_t HTTPContentFetcherConnectionPool::DEFAULT_MAX_IDLE_PER_ORIGIN;
+const size_t HTTPContentFetcherConnectionPool::DEFAULT_MAX_IDLE_TOTAL;
+const std::chrono::seconds HTTPContentFetcherConnectionPool::DEFAULT_MAX_IDLE_TIME(60);
+
+std::shared_ptr<HTTPContentFetcherConnectionPool> HTTPContentFetcherConnectionPool::create(
+    size_t maxIdlePerOrigin,
+    size_t maxIdleTotal,
+    std::chrono::milliseconds maxIdleTime) {
+    auto share = curl_share_init();
+    if (!share) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "curlShareInitFailed"));
+        return nullptr;
+    }
+    std::shared_ptr<HTTPContentFetcherConnectionPool> pool(
+        new HTTPContentFetcherConnectionPool(share, maxIdlePerOrigin, maxIdleTotal, maxIdleTime));
+
+    auto result = curl_share_setopt(share, CURLSHOPT_LOCKFUNC, lockShare);
+    if (CURLSHE_OK == result) {
+        result = curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, unlockShare);
+    }
+    if (CURLSHE_OK == result) {
+        result = curl_share_setopt(share, CURLSHOPT_USERDATA, pool.get());
+    }
+    if (CURLSHE_OK == result) {
+        result = curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    }
+    if (CURLSHE_OK == result) {
+        result = curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    }
+    if (result != CURLSHE_OK) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "curlShareSetoptFailed").d("error", curl_share_strerror(result)));
+        return nullptr;
+    }
+    return pool;
+}
+
+HTTPContentFetcherConnectionPool::HTTPContentFetcherConnectionPool(
+    CURLSH* share,
+    size_t maxIdlePerOrigin,
+    size_t maxIdleTotal,
+    std::chrono::milliseconds maxIdleTime) :
+        m_share{share},
+        m_maxIdlePerOrigin{maxIdlePerOrigin},
+        m_maxIdleTotal{maxIdleTotal},
+        m_maxIdleTime{maxIdleTime},
+        m_idleTotal{0} {
+}
+
+HTTPContentFetcherConnectionPool::~HTTPContentFetcherConnectionPool() {
+    // Close the idle connections before the caches they may refer to.
+    m_idle.clear();
+    auto result = curl_share_cleanup(m_share);
+    if (result != CURLSHE_OK) {
+        ACSDK_ERROR(LX("curlShareCleanupFailed").d("error", curl_share_strerror(result)));
+    }
+}
+
+std::unique_ptr<CurlMultiHandleWrapper> HTTPContentFetcherConnectionPool::acquire(const std::string& url) {
+    auto origin = getOrigin(url);
+    std::unique_ptr<CurlMultiHandleWrapper> multi;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        expireLocked(std::chrono::steady_clock::now());
+        auto it = m_idle.find(origin);
+        if (it != m_idle.end()) {
+            multi = std::move(it->second.back().multi);
+            it->second.pop_back();
+            --m_idleTotal;
+            if (it->second.empty()) {
+                m_idle.erase(it);
+            }
+        }
+    }
+    if (multi) {
+        ACSDK_DEBUG9(LX("acquire").d("reused", true).sensitive("origin", origin));
+        return multi;
+    }
+    ACSDK_DEBUG9(LX("acquire").d("reused", false).sensitive("origin", origin));
+    return CurlMultiHandleWrapper::create();
+}
+
+void HTTPContentFetcherConnectionPool::release(const std::string& url, std::unique_ptr<CurlMultiHandleWrapper> multi) {
+    auto origin = getOrigin(url);
+    if (!multi || origin.empty() || 0 == m_maxIdlePerOrigin || 0 == m_maxIdleTotal) {
+        return;
+    }
+    // Destroy any evicted handles outside the lock, since closing connections may block.
+    std::deque<IdleEntry> evicted;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto now = std::chrono::steady_clock::now();
+        expireLocked(now);
+        auto& entries = m_idle[origin];
+        if (entries.size() >= m_maxIdlePerOrigin) {
+            evicted.push_back(std::move(entries.front()));
+            entries.pop_front();
+            --m_idleTotal;
+        }
+        entries.push_back({std::move(multi), now});
+        ++m_idleTotal;
+
+        while (m_idleTotal > m_maxIdleTotal) {
+            auto oldest = m_idle.end();
+            for (auto it = m_idle.begin(); it != m_idle.end(); ++it) {
+                if (oldest == m_idle.end() || it->second.front().releaseTime < oldest->second.front().releaseTime) {
+                    oldest = it;
+                }
+            }
+            evicted.push_back(std::move(oldest->second.front()));
+            oldest->second.pop_front();
+            --m_idleTotal;
+            if (oldest->second.empty()) {
+                m_idle.erase(oldest);
+            }
+        }
+    }
+}
+
+CURLSH* HTTPContentFetcherConnectionPool::getShareHandle() {
+    return m_share;
+}
+
+size_t HTTPContentFetcherConnectionPool::getIdleCount(const std::string& url) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    expireLocked(std::chrono::steady_clock::now());
+    auto it = m_idle.find(getOrigin(url));
+    return it != m_idle.end() ? it->second.size() : 0;
+}
+
+std::string HTTPContentFetcherConnectionPool::getOrigin(const std::string& url) {
+    auto schemeEnd = url.find(SCHEME_SEPARATOR);
+    if (std::string::npos == schemeEnd || 0 == schemeEnd) {
+        return "";
+    }
+    auto authorityBegin = schemeEnd + SCHEME_SEPARATOR.size();
+    auto authorityEnd = url.find_first_of("/?#", authorityBegin);
+    if (std::string::npos == authorityEnd) {
+        authorityEnd = url.size();
+    }
+    auto userInfoEnd = url.rfind('@', authorityEnd);
+    if (std::string::npos != userInfoEnd && userInfoEnd >= authorityBegin) {
+        authorityBegin = userInfoEnd + 1;
+    }
+    auto origin =
+        url.substr(0, schemeEnd) + SCHEME_SEPARATOR + url.substr(authorityBegin, authorityEnd - authorityBegin);
+    std::transform(origin.begin(), origin.end(), origin.begin(), ::tolower);
+    return origin;
+}
+
+void HTTPContentFetcherConnectionPool::expireLocked(std::chrono::steady_clock::time_point now) {
+    auto it = m_idle.begin();
+    while (it != m_idle.end()) {
+        auto& entries = it->second;
+        while (!entries.empty() && now - entries.front().releaseTime >= m_maxIdleTime) {
+            entries.pop_front();
+            --m_idleTotal;
+        }
+        if (entries.empty()) {
+            it = m_idle.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void HTTPContentFetcherConnectionPool::lockShare(
+    CURL* handle,
+    curl_lock_data data,
+    curl_lock_access access,
+    void* userData) {
+    auto pool = static_cast<HTTPContentFetcherConnectionPool*>(userData);
+    if (pool && data >= 0 && data < CURL_LOCK_DATA_LAST) {
+        pool->m_shareMutexes[data].lock();
+    }
+}
+
+void HTTPContentFetcherConnectionPool::unlockShare(CURL* handle, curl_lock_data data, void* userData) {
+    auto pool = static_cast<HTTPContentFetcherConnectionPool*>(userData);
+    if (pool && data >= 0 && data < CURL_LOCK_DATA_LAST) {
+        pool->m_shareMutexes[data].unlock();
+    }
+}
+
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
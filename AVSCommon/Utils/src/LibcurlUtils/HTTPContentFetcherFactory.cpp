@@ -22,9 +22,13 @@ namespace avsCommon {
 namespace utils {
 namespace libcurlUtils {
 
+HTTPContentFetcherFactory::HTTPContentFetcherFactory() :
+        m_connectionPool{HTTPContentFetcherConnectionPool::create()} {
+}
+
 std::unique_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> HTTPContentFetcherFactory::create(
     const std::string& url) {
-    return avsCommon::utils::memory::make_unique<LibCurlHttpContentFetcher>(url);
+    return avsCommon::utils::memory::make_unique<LibCurlHttpContentFetcher>(url, m_connectionPool);
 }
 
 }  // namespace libcurlUtils
@@ -133,13 +133,33 @@ size_t LibCurlHttpContentFetcher::noopCallback(char* data, size_t size, size_t n
 }
 
 LibCurlHttpContentFetcher::LibCurlHttpContentFetcher(const std::string& url) :
+        LibCurlHttpContentFetcher(url, nullptr) {
+}
+
+LibCurlHttpContentFetcher::LibCurlHttpContentFetcher(
+    const std::string& url,
+    std::shared_ptr<HTTPContentFetcherConnectionPool> pool) :
         m_url{url},
+        m_pool{std::move(pool)},
         m_lastStatusCode{0},
         m_done{false},
         m_isShutdown{false} {
     m_hasObjectBeenUsed.clear();
 }
 
+std::unique_ptr<CurlMultiHandleWrapper> LibCurlHttpContentFetcher::acquireMultiHandle() {
+    if (m_pool) {
+        return m_pool->acquire(m_url);
+    }
+    return CurlMultiHandleWrapper::create();
+}
+
+void LibCurlHttpContentFetcher::releaseMultiHandle(std::unique_ptr<CurlMultiHandleWrapper> multi, bool isReusable) {
+    if (m_pool && isReusable) {
+        m_pool->release(m_url, std::move(multi));
+    }
+}
+
 std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getContent(
     FetchOptions fetchOption,
     std::shared_ptr<avsCommon::avs::attachment::AttachmentWriter> writer) {
@@ -173,6 +193,22 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
         ACSDK_ERROR(LX("getContentFailed").d("reason", "setConnectionTimeoutFailed"));
         return nullptr;
     }
+    if (m_pool) {
+        curlReturnValue = curl_easy_setopt(m_curlWrapper.getCurlHandle(), CURLOPT_SHARE, m_pool->getShareHandle());
+        if (curlReturnValue != CURLE_OK) {
+            ACSDK_ERROR(LX("getContentFailed").d("reason", "setShareHandleFailed").d("error", curlReturnValue));
+            return nullptr;
+        }
+#if LIBCURL_VERSION_NUM >= 0x072f00
+        // Negotiate HTTP/2 with servers which support it.  An HTTP/2 connection stays usable after a fetch is
+        // abandoned part way, since only its stream is reset.
+        curlReturnValue =
+            curl_easy_setopt(m_curlWrapper.getCurlHandle(), CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+        if (curlReturnValue != CURLE_OK) {
+            ACSDK_WARN(LX("getContent").d("reason", "preferHTTP2Failed").d("error", curlReturnValue));
+        }
+#endif
+    }
 
     curlReturnValue = curl_easy_setopt(
         m_curlWrapper.getCurlHandle(),
@@ -205,7 +241,7 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
             }
 
             m_thread = std::thread([this]() {
-                auto curlMultiHandle = avsCommon::utils::libcurlUtils::CurlMultiHandleWrapper::create();
+                auto curlMultiHandle = acquireMultiHandle();
                 if (!curlMultiHandle) {
                     ACSDK_ERROR(LX("getContentFailed").d("reason", "curlMultiHandleWrapperCreateFailed"));
                     // Set the promises because of errors.
@@ -218,6 +254,7 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
                 int numTransfersLeft = 1;
                 long finalResponseCode = 0;
                 char* contentType = nullptr;
+                bool isReusable = true;
 
                 while (numTransfersLeft && !m_isShutdown) {
                     auto result = curlMultiHandle->perform(&numTransfersLeft);
@@ -225,6 +262,7 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
                         continue;
                     } else if (CURLM_OK != result) {
                         ACSDK_ERROR(LX("getContentFailed").d("reason", "performFailed"));
+                        isReusable = false;
                         break;
                     }
 
@@ -255,6 +293,7 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
                         ACSDK_ERROR(LX("getContentFailed")
                                         .d("reason", "multiWaitFailed")
                                         .d("error", curl_multi_strerror(result)));
+                        isReusable = false;
                         break;
                     }
                 }
@@ -267,6 +306,7 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
 
                 // Abort any curl operation by removing the curl handle.
                 curlMultiHandle->removeHandle(m_curlWrapper.getCurlHandle());
+                releaseMultiHandle(std::move(curlMultiHandle), isReusable);
             });
             break;
         case FetchOptions::ENTIRE_BODY:
@@ -292,7 +332,7 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
                 return nullptr;
             }
             m_thread = std::thread([this, writerWasCreatedLocally]() {
-                auto curlMultiHandle = avsCommon::utils::libcurlUtils::CurlMultiHandleWrapper::create();
+                auto curlMultiHandle = acquireMultiHandle();
                 if (!curlMultiHandle) {
                     ACSDK_ERROR(LX("getContentFailed").d("reason", "curlMultiHandleWrapperCreateFailed"));
                     // Set the promises because of errors.
@@ -303,12 +343,14 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
                 curlMultiHandle->addHandle(m_curlWrapper.getCurlHandle());
 
                 int numTransfersLeft = 1;
+                bool isReusable = true;
                 while (numTransfersLeft && !m_isShutdown) {
                     auto result = curlMultiHandle->perform(&numTransfersLeft);
                     if (CURLM_CALL_MULTI_PERFORM == result) {
                         continue;
                     } else if (CURLM_OK != result) {
                         ACSDK_ERROR(LX("getContentFailed").d("reason", "performFailed"));
+                        isReusable = false;
                         break;
                     }
 
@@ -318,6 +360,7 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
                         ACSDK_ERROR(LX("getContentFailed")
                                         .d("reason", "multiWaitFailed")
                                         .d("error", curl_multi_strerror(result)));
+                        isReusable = false;
                         break;
                     }
                 }
@@ -341,6 +384,7 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
 
                 // Abort any curl operation by removing the curl handle.
                 curlMultiHandle->removeHandle(m_curlWrapper.getCurlHandle());
+                releaseMultiHandle(std::move(curlMultiHandle), isReusable);
             });
             break;
         default:
@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+
 #include <curl/multi.h>
 
 #include <AVSCommon/Utils/Logger/Logger.h>
@@ -38,10 +40,77 @@ static const std::string TAG("LibcurlHTTP2Connection");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
-/// Timeout for curl_multi_wait
+/// Longest wait for activity when @c libcurl can not be woken from curl_multi_poll.
 const static std::chrono::milliseconds WAIT_FOR_ACTIVITY_TIMEOUT(100);
-/// Timeout for curl_multi_wait while all non-intermittent HTTP/2 streams are paused.
-const static std::chrono::milliseconds WAIT_FOR_ACTIVITY_WHILE_STREAMS_PAUSED_TIMEOUT(10);
+/// Longest wait for activity when @c libcurl can be woken from curl_multi_poll.
+const static std::chrono::milliseconds WAKEABLE_WAIT_FOR_ACTIVITY_TIMEOUT(10000);
+/// How long a paused stream stays paused if it is not resumed.
+const static std::chrono::milliseconds PAUSED_STREAM_RETRY_INTERVAL(10);
+
+/**
+ * Wakes the network loop, whether it is waiting in curl_multi_poll or for a paused stream to be resumed.
+ */
+class LibcurlHTTP2Connection::NetworkLoopWakeup {
+public:
+    /**
+     * Constructor.
+     */
+    NetworkLoopWakeup() : m_isSignalled{false}, m_multi{nullptr} {
+    }
+
+    /**
+     * Set the multi handle whose curl_multi_poll to interrupt.
+     *
+     * @param multi The multi handle, or @c nullptr before it is destroyed.
+     */
+    void setMultiHandle(CurlMultiHandleWrapper* multi) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_multi = multi;
+    }
+
+    /**
+     * Wake the network loop, or make its next wait return immediately.
+     */
+    void signal() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isSignalled = true;
+        m_cv.notify_one();
+        if (m_multi) {
+            m_multi->wakeup();
+        }
+    }
+
+    /**
+     * Forget earlier signals.  Called by the network loop before it checks whether there is anything to do.
+     */
+    void clear() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isSignalled = false;
+    }
+
+    /**
+     * Wait until signalled or the deadline.
+     *
+     * @param deadline When to stop waiting.
+     */
+    void waitUntil(std::chrono::steady_clock::time_point deadline) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait_until(lock, deadline, [this] { return m_isSignalled; });
+    }
+
+private:
+    /// Serializes access to the members.
+    std::mutex m_mutex;
+
+    /// Notified when signalled.
+    std::condition_variable m_cv;
+
+    /// Whether @c signal() has been called since @c clear().
+    bool m_isSignalled;
+
+    /// The multi handle to wake from curl_multi_poll, if any.
+    CurlMultiHandleWrapper* m_multi;
+};
 
 #ifdef ACSDK_OPENSSL_MIN_VER_REQUIRED
 /**
@@ -115,7 +184,9 @@ static bool performCurlChecks() {
     return true;
 }
 
-LibcurlHTTP2Connection::LibcurlHTTP2Connection() : m_isStopping{false} {
+LibcurlHTTP2Connection::LibcurlHTTP2Connection() :
+        m_isStopping{false},
+        m_wakeup{std::make_shared<NetworkLoopWakeup>()} {
     m_networkThread = std::thread(&LibcurlHTTP2Connection::networkLoop, this);
 }
 
@@ -130,6 +201,7 @@ bool LibcurlHTTP2Connection::createMultiHandle() {
         ACSDK_ERROR(LX("initFailed").d("reason", "enableHTTP2PipeliningFailed"));
         return false;
     }
+    m_wakeup->setMultiHandle(m_multi.get());
 
     return true;
 }
@@ -152,9 +224,16 @@ bool LibcurlHTTP2Connection::isStopping() {
 }
 
 void LibcurlHTTP2Connection::setIsStopping() {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_isStopping = true;
-    m_cv.notify_one();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+        m_cv.notify_one();
+    }
+    wakeNetworkLoop();
+}
+
+void LibcurlHTTP2Connection::wakeNetworkLoop() {
+    m_wakeup->signal();
 }
 
 std::shared_ptr<LibcurlHTTP2Request> LibcurlHTTP2Connection::dequeueRequest() {
@@ -167,21 +246,70 @@ std::shared_ptr<LibcurlHTTP2Request> LibcurlHTTP2Connection::dequeueRequest() {
     return result;
 }
 
-void LibcurlHTTP2Connection::processNextRequest() {
-    auto stream = dequeueRequest();
-    if (!stream) {
-        return;
+void LibcurlHTTP2Connection::processQueuedRequests() {
+    while (auto stream = dequeueRequest()) {
+        stream->setTimeOfLastTransfer();
+        auto result = m_multi->addHandle(stream->getCurlHandle());
+        if (CURLM_OK == result) {
+            auto handle = stream->getCurlHandle();
+            ACSDK_DEBUG9(LX("insertActiveStream").d("handle", handle).d("streamId", stream->getId()));
+            m_activeStreams[handle] = stream;
+        } else {
+            ACSDK_ERROR(
+                LX("processQueuedRequests").d("reason", "addHandleFailed").d("error", curl_multi_strerror(result)));
+            stream->reportCompletion(HTTP2ResponseFinishedStatus::INTERNAL_ERROR);
+        }
     }
-    stream->setTimeOfLastTransfer();
-    auto result = m_multi->addHandle(stream->getCurlHandle());
-    if (CURLM_OK == result) {
-        auto handle = stream->getCurlHandle();
-        ACSDK_DEBUG9(LX("insertActiveStream").d("handle", handle).d("streamId", stream->getId()));
-        m_activeStreams[handle] = stream;
-    } else {
-        ACSDK_ERROR(LX("processNextRequest").d("reason", "addHandleFailed").d("error", curl_multi_strerror(result)));
-        stream->reportCompletion(HTTP2ResponseFinishedStatus::INTERNAL_ERROR);
+}
+
+CURLMcode LibcurlHTTP2Connection::waitForActivity() {
+    // Clear before checking for work, so that a signal sent after the checks is not lost.
+    m_wakeup->clear();
+
+    auto now = std::chrono::steady_clock::now();
+    auto deadline = now + (CurlMultiHandleWrapper::isWakeupSupported() ? WAKEABLE_WAIT_FOR_ACTIVITY_TIMEOUT
+                                                                        : WAIT_FOR_ACTIVITY_TIMEOUT);
+    for (const auto& entry : m_activeStreams) {
+        const auto& stream = entry.second;
+        if (stream->isCancelled() || (stream->isPaused() && stream->isResumeRequested())) {
+            return CURLM_OK;
+        }
+        deadline = std::min(deadline, stream->getProgressDeadline());
+        if (stream->isPaused()) {
+            deadline = std::min(deadline, stream->getTimeOfPause() + PAUSED_STREAM_RETRY_INTERVAL);
+        }
     }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_isStopping || !m_requestQueue.empty()) {
+            return CURLM_OK;
+        }
+    }
+
+    // @note curl_multi_poll will return immediately even if all streams are paused, because HTTP/2 streams are
+    // full-duplex - so activity may have occurred on the other side. Therefore, if our intent is to pause transfers
+    // to give the readers / writers time to catch up, we must wait for them to resume the streams instead.
+    if (areStreamsPaused()) {
+        m_wakeup->waitUntil(deadline);
+        return CURLM_OK;
+    }
+
+    std::chrono::milliseconds curlTimeout;
+    auto result = m_multi->timeout(&curlTimeout);
+    if (result != CURLM_OK) {
+        return result;
+    }
+    if (curlTimeout.count() >= 0) {
+        deadline = std::min(deadline, now + curlTimeout);
+    }
+    // Round up, so that we do not wake just before the deadline.
+    auto timeout = std::chrono::duration_cast<std::chrono::milliseconds>(
+        deadline - now + std::chrono::milliseconds(1) - std::chrono::nanoseconds(1));
+    if (timeout.count() <= 0) {
+        return CURLM_OK;
+    }
+    int numTransfersUpdated = 0;
+    return m_multi->poll(timeout, &numTransfersUpdated);
 }
 
 void LibcurlHTTP2Connection::networkLoop() {
@@ -201,11 +329,11 @@ void LibcurlHTTP2Connection::networkLoop() {
             }
         }
 
-        processNextRequest();
+        processQueuedRequests();
 
         int numTransfersLeft = 1;  // just dequeued the first request.
         // Call perform repeatedly to transfer data on active streams.
-        while (numTransfersLeft > 0 && !isStopping()) {
+        while ((numTransfersLeft > 0 || !m_activeStreams.empty()) && !isStopping()) {
             auto result = m_multi->perform(&numTransfersLeft);
             if (result == CURLM_CALL_MULTI_PERFORM) {
                 continue;
@@ -223,41 +351,21 @@ void LibcurlHTTP2Connection::networkLoop() {
                 break;
             }
 
-            processNextRequest();
+            processQueuedRequests();
 
-            auto before = std::chrono::time_point<std::chrono::steady_clock>::max();
-            auto multiWaitTimeout = WAIT_FOR_ACTIVITY_TIMEOUT;
-            bool paused = areStreamsPaused();
-            if (paused) {
-                multiWaitTimeout = WAIT_FOR_ACTIVITY_WHILE_STREAMS_PAUSED_TIMEOUT;
-                before = std::chrono::steady_clock::now();
-            }
-
-            int numTransfersUpdated = 0;
-            result = m_multi->wait(multiWaitTimeout, &numTransfersUpdated);
+            result = waitForActivity();
             if (result != CURLM_OK) {
-                ACSDK_ERROR(
-                    LX("networkLoopStopping").d("reason", "multiWaitFailed").d("error", curl_multi_strerror(result)));
+                ACSDK_ERROR(LX("networkLoopStopping")
+                                .d("reason", "waitForActivityFailed")
+                                .d("error", curl_multi_strerror(result)));
                 setIsStopping();
                 break;
             }
 
-            // @note curl_multi_wait will return immediately even if all streams are paused, because HTTP/2 streams
-            // are full-duplex - so activity may have occurred on the other side. Therefore, if our intent is to pause
-            // transfers to give the readers / writers time to catch up, we must perform a local sleep of our own.
-            if (paused) {
-                auto after = std::chrono::steady_clock::now();
-                auto elapsed = after - before;
-                auto remaining = multiWaitTimeout - elapsed;
-
-                // sanity check that remainingMs is valid before performing a sleep.
-                if (remaining.count() > 0 && remaining <= WAIT_FOR_ACTIVITY_WHILE_STREAMS_PAUSED_TIMEOUT) {
-                    std::this_thread::sleep_for(remaining);
-                }
-            }
             unPauseActiveStreams();
         }
         cancelAllStreams();
+        m_wakeup->setMultiHandle(nullptr);
         m_multi.reset();
     }
 
@@ -266,6 +374,8 @@ void LibcurlHTTP2Connection::networkLoop() {
 
 std::shared_ptr<HTTP2RequestInterface> LibcurlHTTP2Connection::createAndSendRequest(const HTTP2RequestConfig& config) {
     auto req = std::make_shared<LibcurlHTTP2Request>(config, config.getId());
+    auto wakeup = m_wakeup;
+    req->setWakeNetworkLoopCallback([wakeup] { wakeup->signal(); });
     addStream(req);
     return req;
 }
@@ -283,13 +393,16 @@ bool LibcurlHTTP2Connection::addStream(std::shared_ptr<LibcurlHTTP2Request> stre
         ACSDK_ERROR(LX("addStream").d("failed", "null stream"));
         return false;
     }
-    std::lock_guard<std::mutex> lock(m_mutex);
-    if (m_isStopping) {
-        ACSDK_ERROR(LX("addStream").d("failed", "network loop stopping"));
-        return false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_isStopping) {
+            ACSDK_ERROR(LX("addStream").d("failed", "network loop stopping"));
+            return false;
+        }
+        m_requestQueue.push_back(std::move(stream));
+        m_cv.notify_one();
     }
-    m_requestQueue.push_back(std::move(stream));
-    m_cv.notify_one();
+    wakeNetworkLoop();
     return true;
 }
 
@@ -351,8 +464,13 @@ bool LibcurlHTTP2Connection::areStreamsPaused() {
 }
 
 void LibcurlHTTP2Connection::unPauseActiveStreams() {
-    for (auto& stream : m_activeStreams) {
-        stream.second->unPause();
+    auto now = std::chrono::steady_clock::now();
+    for (auto& entry : m_activeStreams) {
+        auto& stream = entry.second;
+        if (stream->isPaused() &&
+            (stream->isResumeRequested() || now - stream->getTimeOfPause() >= PAUSED_STREAM_RETRY_INTERVAL)) {
+            stream->unPause();
+        }
     }
 }
 
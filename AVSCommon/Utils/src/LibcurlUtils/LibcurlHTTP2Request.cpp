@@ -57,6 +57,7 @@ size_t LibcurlHTTP2Request::writeCallback(char* data, size_t size, size_t nmemb,
                 return length;
             case HTTP2ReceiveDataStatus::PAUSE:
                 stream->m_isPaused = true;
+                stream->m_timeOfPause = steady_clock::now();
                 return CURL_WRITEFUNC_PAUSE;
             case HTTP2ReceiveDataStatus ::ABORT:
                 return 0;
@@ -106,6 +107,7 @@ size_t LibcurlHTTP2Request::readCallback(char* data, size_t size, size_t nmemb,
                 return result.size;
             case HTTP2SendStatus::PAUSE:
                 stream->m_isPaused = true;
+                stream->m_timeOfPause = steady_clock::now();
                 return CURL_READFUNC_PAUSE;
             case HTTP2SendStatus::COMPLETE:
                 return 0;
@@ -144,6 +146,7 @@ LibcurlHTTP2Request::LibcurlHTTP2Request(
         m_stream{std::move(id)},
         m_isIntermittentTransferExpected{config.isIntermittentTransferExpected()},
         m_isPaused{false},
+        m_isResumeRequested{false},
         m_isCancelled{false} {
     switch (config.getRequestType()) {
         case HTTP2RequestType::GET:
@@ -187,12 +190,21 @@ bool LibcurlHTTP2Request::hasProgressTimedOut() const {
     }
     return duration_cast<milliseconds>(steady_clock::now() - m_timeOfLastTransfer) > m_activityTimeout;
 }
+
+steady_clock::time_point LibcurlHTTP2Request::getProgressDeadline() const {
+    if (m_activityTimeout == milliseconds::zero()) {
+        return steady_clock::time_point::max();
+    }
+    return m_timeOfLastTransfer + m_activityTimeout;
+}
+
 bool LibcurlHTTP2Request::isIntermittentTransferExpected() const {
     return m_isIntermittentTransferExpected;
 }
 
 void LibcurlHTTP2Request::unPause() {
     m_isPaused = false;
+    m_isResumeRequested = false;
     m_stream.pause(CURLPAUSE_CONT);
 }
 
@@ -200,15 +212,37 @@ bool LibcurlHTTP2Request::isPaused() const {
     return m_isPaused;
 }
 
+steady_clock::time_point LibcurlHTTP2Request::getTimeOfPause() const {
+    return m_timeOfPause;
+}
+
+bool LibcurlHTTP2Request::isResumeRequested() const {
+    return m_isResumeRequested;
+}
+
+void LibcurlHTTP2Request::setWakeNetworkLoopCallback(std::function<void()> wakeNetworkLoop) {
+    m_wakeNetworkLoop = std::move(wakeNetworkLoop);
+}
+
 bool LibcurlHTTP2Request::isCancelled() const {
     return m_isCancelled;
 }
 
 bool LibcurlHTTP2Request::cancel() {
     m_isCancelled = true;
+    if (m_wakeNetworkLoop) {
+        m_wakeNetworkLoop();
+    }
     return true;
 }
 
+void LibcurlHTTP2Request::resume() {
+    m_isResumeRequested = true;
+    if (m_wakeNetworkLoop) {
+        m_wakeNetworkLoop();
+    }
+}
+
 std::string LibcurlHTTP2Request::getId() const {
     return m_stream.getId();
 }
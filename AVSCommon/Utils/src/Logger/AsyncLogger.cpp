@@ -0,0 +1,399 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include "AVSCommon/Utils/Configuration/ConfigurationNode.h"
+#include "AVSCommon/Utils/Logger/AsyncLogger.h"
+#include "AVSCommon/Utils/Logger/ThreadMoniker.h"
+#include "AVSCommon/Utils/SDKVersion.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/// Configuration key for AsyncLogger settings.
+static const std::string CONFIG_KEY_ASYNC_LOGGER = "asyncLogger";
+
+/// Configuration key for the number of entries in the ring.
+static const std::string CONFIG_KEY_CAPACITY = "capacity";
+
+/// Configuration key for the overflow policy.
+static const std::string CONFIG_KEY_OVERFLOW_POLICY = "overflowPolicy";
+
+/// Configuration value for @c OverflowPolicy::BLOCK.
+static const std::string OVERFLOW_POLICY_BLOCK = "BLOCK";
+
+/// File descriptor of standard output.
+static const int STANDARD_OUTPUT = 1;
+
+/// Default number of entries in the ring.
+static const int DEFAULT_CAPACITY = 1024;
+
+/// Number of bytes of text reserved in each entry.  Longer entries are still logged, but allocate when queued.
+static const size_t TEXT_RESERVE = 256;
+
+/// Number of bytes reserved for the thread moniker in each entry.
+static const size_t THREAD_MONIKER_RESERVE = 16;
+
+/// Maximum number of entries formatted and written together.
+static const size_t MAX_BATCH_SIZE = 64;
+
+/// How long a blocked producer waits before checking for space, in case a wakeup was missed.
+static const std::chrono::milliseconds BLOCKED_PRODUCER_WAKE_INTERVAL{10};
+
+/// The terminate handler that was installed before @c AsyncLogger's.
+static std::terminate_handler g_previousTerminateHandler = nullptr;
+
+/**
+ * The @c instance() @c AsyncLogger, for the exit and terminate hooks, or @c nullptr once it has been destroyed.  This
+ * is not looked up with @c instance(), which could wait forever if @c std::terminate() were called while the instance
+ * is being created, and whose result is already destroyed when the exit hook runs after the static destructors.
+ */
+static std::atomic<AsyncLogger*> g_hookedInstance{nullptr};
+
+/**
+ * Rounds a value up to a power of two.
+ *
+ * @param value The value.
+ * @return The smallest power of two which is not less than @c value.
+ */
+static size_t roundUpToPowerOfTwo(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+AsyncLogger::Entry::Entry() : sequence{0}, level{Level::UNKNOWN} {
+    threadMoniker.reserve(THREAD_MONIKER_RESERVE);
+    text.reserve(TEXT_RESERVE);
+}
+
+std::shared_ptr<Logger> AsyncLogger::instance() {
+    static std::shared_ptr<Logger> singleAsyncLogger = [] {
+        auto configuration = configuration::ConfigurationNode::getRoot()[CONFIG_KEY_ASYNC_LOGGER];
+        int capacity = DEFAULT_CAPACITY;
+        configuration.getInt(CONFIG_KEY_CAPACITY, &capacity, DEFAULT_CAPACITY);
+        std::string policyName;
+        configuration.getString(CONFIG_KEY_OVERFLOW_POLICY, &policyName);
+        auto policy = OVERFLOW_POLICY_BLOCK == policyName ? OverflowPolicy::BLOCK : OverflowPolicy::DROP;
+
+        auto logger = std::shared_ptr<AsyncLogger>(new AsyncLogger(
+            STANDARD_OUTPUT, roundUpToPowerOfTwo(capacity > 0 ? capacity : DEFAULT_CAPACITY), policy));
+#ifdef DEBUG
+        logger->setLevel(Level::DEBUG0);
+#else
+        logger->setLevel(Level::INFO);
+#endif  // DEBUG
+        logger->init(configuration);
+        std::atexit(stopInstanceAtExit);
+        g_hookedInstance = logger.get();
+        g_previousTerminateHandler = std::set_terminate(flushInstanceOnTerminate);
+
+        std::string currentVersionLogEntry("sdkVersion: " + avsCommon::utils::sdkVersion::getCurrentVersion());
+        logger->emit(
+            Level::INFO,
+            std::chrono::system_clock::now(),
+            ThreadMoniker::getThisThreadMoniker().c_str(),
+            currentVersionLogEntry.c_str());
+        return logger;
+    }();
+    return singleAsyncLogger;
+}
+
+std::shared_ptr<AsyncLogger> AsyncLogger::create(int fileDescriptor, size_t capacity, OverflowPolicy overflowPolicy) {
+    if (fileDescriptor < 0 || 0 == capacity) {
+        return nullptr;
+    }
+    return std::shared_ptr<AsyncLogger>(
+        new AsyncLogger(fileDescriptor, roundUpToPowerOfTwo(capacity), overflowPolicy));
+}
+
+AsyncLogger::AsyncLogger(int fileDescriptor, size_t capacity, OverflowPolicy overflowPolicy) :
+        Logger(Level::UNKNOWN),
+        m_fileDescriptor{fileDescriptor},
+        m_overflowPolicy{overflowPolicy},
+        m_entries(capacity),
+        m_mask{capacity - 1},
+        m_enqueuePos{0},
+        m_droppedCount{0},
+        m_waitingProducers{0},
+        m_writerSleeping{false},
+        m_writerStopped{false},
+        m_dequeuePos{0},
+        m_batch(MAX_BATCH_SIZE + 1),
+        m_shutdown{false} {
+    for (size_t i = 0; i < capacity; ++i) {
+        m_entries[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    m_writerThread = std::thread(&AsyncLogger::writerLoop, this);
+    m_writerThreadId = m_writerThread.get_id();
+}
+
+AsyncLogger::~AsyncLogger() {
+    AsyncLogger* self = this;
+    g_hookedInstance.compare_exchange_strong(self, nullptr);
+    stopWriter();
+}
+
+void AsyncLogger::emit(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text) {
+    if (m_writerStopped) {
+        // Late in shutdown there is no background thread, so write synchronously.
+        std::lock_guard<std::mutex> lock(m_drainMutex);
+        while (drainLocked(MAX_BATCH_SIZE) > 0) {
+        }
+        m_batch[0] = m_logFormatter.format(level, time, threadMoniker, text);
+        m_batch[0].push_back('\n');
+        writeBatchLocked(1);
+        return;
+    }
+
+    // Claim an entry.  This is the enqueue half of a bounded multi-producer queue (after Dmitry Vyukov's design).
+    Entry* entry = nullptr;
+    size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+    while (!entry) {
+        Entry& candidate = m_entries[pos & m_mask];
+        size_t sequence = candidate.sequence.load(std::memory_order_acquire);
+        auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+        if (0 == difference) {
+            if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                entry = &candidate;
+            }
+        } else if (difference < 0) {
+            // The ring is full.
+            if (OverflowPolicy::DROP == m_overflowPolicy || m_writerStopped) {
+                m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            waitForSpace();
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+        } else {
+            pos = m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    entry->level = level;
+    entry->time = time;
+    entry->threadMoniker.assign(threadMoniker);
+    entry->text.assign(text);
+    // Publishing and checking m_writerSleeping are both sequentially consistent, pairing with writerLoop(), so either
+    // the writer sees this entry before sleeping or this thread sees it sleeping.
+    entry->sequence.store(pos + 1);
+
+    if (m_writerSleeping.load()) {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_wakeCondition.notify_one();
+    }
+}
+
+void AsyncLogger::flush() {
+    std::lock_guard<std::mutex> lock(m_drainMutex);
+    while (drainLocked(MAX_BATCH_SIZE) > 0) {
+    }
+}
+
+void AsyncLogger::writerLoop() {
+    while (true) {
+        size_t written = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_drainMutex);
+            written = drainLocked(MAX_BATCH_SIZE);
+        }
+        if (written > 0) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        if (m_shutdown) {
+            return;
+        }
+        m_writerSleeping.store(true);
+        bool ready = false;
+        {
+            std::lock_guard<std::mutex> drainLock(m_drainMutex);
+            ready = hasEntryLocked();
+        }
+        if (!ready) {
+            // Producers notify under m_wakeMutex after publishing an entry if they see m_writerSleeping, so a wakeup
+            // can't be missed between the check above and this wait.
+            m_wakeCondition.wait(lock);
+        }
+        m_writerSleeping.store(false);
+    }
+}
+
+size_t AsyncLogger::drainLocked(size_t maxEntries) {
+    size_t count = 0;
+    while (count < maxEntries && hasEntryLocked()) {
+        Entry& entry = m_entries[m_dequeuePos & m_mask];
+        m_batch[count] =
+            m_logFormatter.format(entry.level, entry.time, entry.threadMoniker.c_str(), entry.text.c_str());
+        m_batch[count].push_back('\n');
+        entry.sequence.store(m_dequeuePos + m_mask + 1, std::memory_order_release);
+        ++m_dequeuePos;
+        ++count;
+    }
+
+    size_t dropped = m_droppedCount.exchange(0, std::memory_order_relaxed);
+    size_t lines = count;
+    if (dropped > 0) {
+        m_batch[lines++] = m_logFormatter.format(
+            Level::WARN,
+            std::chrono::system_clock::now(),
+            ThreadMoniker::getThisThreadMoniker().c_str(),
+            ("AsyncLogger:droppedEntries:count=" + std::to_string(dropped)).c_str());
+        m_batch[lines - 1].push_back('\n');
+    }
+    if (lines > 0) {
+        writeBatchLocked(lines);
+    }
+
+    if (count > 0 && m_waitingProducers.load() > 0) {
+        std::lock_guard<std::mutex> lock(m_spaceMutex);
+        m_spaceAvailable.notify_all();
+    }
+    return count;
+}
+
+void AsyncLogger::writeBatchLocked(size_t count) {
+#ifdef _WIN32
+    for (size_t i = 0; i < count; ++i) {
+        _write(m_fileDescriptor, m_batch[i].data(), static_cast<unsigned int>(m_batch[i].size()));
+    }
+#else
+    struct iovec iov[MAX_BATCH_SIZE + 1];
+    for (size_t i = 0; i < count; ++i) {
+        iov[i].iov_base = const_cast<char*>(m_batch[i].data());
+        iov[i].iov_len = m_batch[i].size();
+    }
+
+    struct iovec* next = iov;
+    int remaining = static_cast<int>(count);
+    while (remaining > 0) {
+        auto result = writev(m_fileDescriptor, next, remaining);
+        if (result < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            // There is nowhere to report the failure, so drop the batch.
+            return;
+        }
+        // Skip past whatever was written, which may end part way through a line.
+        auto written = static_cast<size_t>(result);
+        while (remaining > 0 && written >= next->iov_len) {
+            written -= next->iov_len;
+            ++next;
+            --remaining;
+        }
+        if (remaining > 0) {
+            next->iov_base = static_cast<char*>(next->iov_base) + written;
+            next->iov_len -= written;
+        }
+    }
+#endif
+}
+
+bool AsyncLogger::hasEntryLocked() const {
+    // Sequentially consistent, so that the check in writerLoop() pairs with the publication in emit().
+    return m_entries[m_dequeuePos & m_mask].sequence.load() == m_dequeuePos + 1;
+}
+
+void AsyncLogger::waitForSpace() {
+    ++m_waitingProducers;
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_wakeCondition.notify_one();
+    }
+    std::unique_lock<std::mutex> lock(m_spaceMutex);
+    m_spaceAvailable.wait_for(lock, BLOCKED_PRODUCER_WAKE_INTERVAL);
+    --m_waitingProducers;
+}
+
+void AsyncLogger::stopWriter() {
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        if (m_shutdown) {
+            return;
+        }
+        m_shutdown = true;
+        m_wakeCondition.notify_one();
+    }
+    if (m_writerThread.joinable()) {
+        m_writerThread.join();
+    }
+    m_writerStopped = true;
+    flush();
+}
+
+void AsyncLogger::stopInstanceAtExit() {
+    // This is registered while the instance is being created, so it runs after the static holding the instance has
+    // been destroyed.  The logger is still alive if something else shares it, and is otherwise already stopped.
+    auto logger = g_hookedInstance.load();
+    if (logger) {
+        logger->stopWriter();
+    }
+}
+
+void AsyncLogger::tryFlush() {
+    // The background thread may have terminated while holding m_drainMutex, so it never tries to take it again here.
+    if (std::this_thread::get_id() == m_writerThreadId) {
+        return;
+    }
+    // Another thread may hold m_drainMutex and never release it, so give up rather than wait.
+    std::unique_lock<std::mutex> lock(m_drainMutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return;
+    }
+    while (drainLocked(MAX_BATCH_SIZE) > 0) {
+    }
+}
+
+void AsyncLogger::flushInstanceOnTerminate() {
+    auto logger = g_hookedInstance.load();
+    if (logger) {
+        logger->tryFlush();
+    }
+    if (g_previousTerminateHandler) {
+        g_previousTerminateHandler();
+    }
+    std::abort();
+}
+
+std::shared_ptr<Logger> getAsyncLogger() {
+    return AsyncLogger::instance();
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -14,6 +14,7 @@
  */
 
 #include "AVSCommon/Utils/Metrics.h"
+#include "AVSCommon/Utils/Metrics/LatencyTracer.h"
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -42,6 +43,32 @@ const std::string Metrics::locationToString(Metrics::Location location) {
     return "unknown";
 }
 
+/**
+ * Translate @c Metrics::Location into the corresponding @c TracePoint.
+ *
+ * @param location A @c Metrics::Location to translate.
+ * @return The corresponding @c TracePoint.
+ */
+static metrics::TracePoint toTracePoint(Metrics::Location location) {
+    switch (location) {
+        case Metrics::ADSL_ENQUEUE:
+            return metrics::TracePoint::ADSL_ENQUEUE;
+        case Metrics::ADSL_DEQUEUE:
+            return metrics::TracePoint::ADSL_DEQUEUE;
+        case Metrics::SPEECH_SYNTHESIZER_RECEIVE:
+            return metrics::TracePoint::SPEECH_SYNTHESIZER_RECEIVE;
+        case Metrics::AIP_RECEIVE:
+            return metrics::TracePoint::AIP_RECEIVE;
+        case Metrics::AIP_SEND:
+            return metrics::TracePoint::AIP_SEND;
+        case Metrics::BUILDING_MESSAGE:
+            return metrics::TracePoint::BUILDING_MESSAGE;
+    }
+
+    // UNREACHABLE
+    return metrics::TracePoint::BUILDING_MESSAGE;
+}
+
 logger::LogEntry& Metrics::d(LogEntry& logEntry, const std::shared_ptr<AVSMessage> msg, Metrics::Location location) {
     return d(logEntry, msg->getName(), msg->getMessageId(), msg->getDialogRequestId(), location);
 }
@@ -61,6 +88,16 @@ logger::LogEntry& Metrics::d(
     return logEntry;
 }
 
+void Metrics::trace(const std::string& messageId, const std::string& dialogRequestId, Location location) {
+    metrics::LatencyTracer::record(toTracePoint(location), dialogRequestId.empty() ? messageId : dialogRequestId);
+}
+
+void Metrics::trace(const std::shared_ptr<AVSMessage> msg, Location location) {
+    if (msg) {
+        trace(msg->getMessageId(), msg->getDialogRequestId(), location);
+    }
+}
+
 }  // namespace utils
 }  // namespace avsCommon
 }  // namespace alexaClientSDK
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cinttypes>
+#include <cstdio>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Metrics/ChromeTraceExporter.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace metrics {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("ChromeTraceExporter");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// Nanoseconds per microsecond, the unit of timestamps in the Chrome trace event format.
+static const uint64_t NANOSECONDS_PER_MICROSECOND = 1000;
+
+/// Large enough for one formatted event.
+static const size_t EVENT_BUFFER_SIZE = 256;
+
+std::unique_ptr<ChromeTraceExporter> ChromeTraceExporter::create(std::shared_ptr<std::ostream> stream) {
+    if (!stream) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullStream"));
+        return nullptr;
+    }
+    return std::unique_ptr<ChromeTraceExporter>(new ChromeTraceExporter(std::move(stream)));
+}
+
+ChromeTraceExporter::ChromeTraceExporter(std::shared_ptr<std::ostream> stream) : m_stream{std::move(stream)} {
+}
+
+bool ChromeTraceExporter::exportEvents(const std::vector<TraceEvent>& events) {
+    *m_stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    char buffer[EVENT_BUFFER_SIZE];
+    const char* separator = "\n";
+    for (const auto& event : events) {
+        // Instant events, scoped to the thread, with the timestamp in microseconds.
+        snprintf(
+            buffer,
+            sizeof(buffer),
+            "%s{\"name\":\"%s\",\"cat\":\"latency\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%" PRIu32
+            ",\"ts\":%" PRIu64 ".%03" PRIu64 ",\"args\":{\"id\":\"%016" PRIx64 "\"}}",
+            separator,
+            tracePointToString(event.point),
+            event.thread,
+            event.timestamp / NANOSECONDS_PER_MICROSECOND,
+            event.timestamp % NANOSECONDS_PER_MICROSECOND,
+            event.id);
+        *m_stream << buffer;
+        separator = ",\n";
+    }
+    *m_stream << "\n]}\n";
+    m_stream->flush();
+    if (!*m_stream) {
+        ACSDK_ERROR(LX("exportEventsFailed").d("reason", "writeFailed"));
+        return false;
+    }
+    return true;
+}
+
+}  // namespace metrics
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
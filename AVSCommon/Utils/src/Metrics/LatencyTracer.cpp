@@ -0,0 +1,282 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+
+#include "AVSCommon/Utils/Metrics/LatencyTracer.h"
+#include "AVSCommon/Utils/Metrics/TraceExporterInterface.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace metrics {
+
+/// FNV-1a 64-bit offset basis.
+static const uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+
+/// FNV-1a 64-bit prime.
+static const uint64_t FNV_PRIME = 0x100000001b3ULL;
+
+/**
+ * One thread's ring of events.  Only the owning thread writes to it; @c snapshot() reads it concurrently, and uses
+ * @c startCount after reading to leave out events which were overwritten in the meantime.
+ */
+struct ThreadBuffer {
+    /// An event in the ring.  The fields are atomic only so that concurrent reads are well defined.
+    struct Slot {
+        /// @c TraceEvent::timestamp.
+        std::atomic<uint64_t> timestamp;
+        /// @c TraceEvent::id.
+        std::atomic<uint64_t> id;
+        /// @c TraceEvent::point.
+        std::atomic<uint32_t> point;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param index The value of @c TraceEvent::thread for events in this buffer.
+     */
+    explicit ThreadBuffer(uint32_t index) : index{index}, startCount{0}, writeCount{0}, inUse{true} {
+    }
+
+    /// The value of @c TraceEvent::thread for events in this buffer.
+    const uint32_t index;
+
+    /// The number of events whose writing has started.
+    std::atomic<uint64_t> startCount;
+
+    /// The number of events ever written.  Event @c n is in slot @c n % @c EVENTS_PER_THREAD.
+    std::atomic<uint64_t> writeCount;
+
+    /// Whether a thread owns this buffer.  Guarded by @c Registry::mutex.
+    bool inUse;
+
+    /// The ring.
+    Slot slots[LatencyTracer::EVENTS_PER_THREAD];
+};
+
+/// All the buffers ever created.
+struct Registry {
+    /// Serializes access to @c buffers.
+    std::mutex mutex;
+
+    /// The buffers.
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+};
+
+/**
+ * Returns the @c Registry.  It is never destroyed, so that threads which exit while the process is exiting can still
+ * release their buffers.
+ *
+ * @return The @c Registry.
+ */
+static Registry& getRegistry() {
+    static Registry* registry = new Registry;
+    return *registry;
+}
+
+/// Whether recording is enabled.
+static std::atomic<bool> enabled{true};
+
+/// Events recorded before this time are left out of snapshots.
+static std::atomic<uint64_t> clearedBefore{0};
+
+/// The buffer of the calling thread, or @c nullptr if it has not recorded an event yet.
+static thread_local ThreadBuffer* currentBuffer = nullptr;
+
+/// Releases the calling thread's buffer, if any, when the thread exits.
+struct BufferReleaser {
+    /// Destructor.
+    ~BufferReleaser() {
+        if (currentBuffer) {
+            auto& registry = getRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            currentBuffer->inUse = false;
+            currentBuffer = nullptr;
+        }
+    }
+};
+
+/// Releases the calling thread's buffer when it exits.  This is only touched when the thread first records an event.
+static thread_local BufferReleaser bufferReleaser;
+
+/**
+ * Returns the current time in nanoseconds on @c std::chrono::steady_clock.
+ *
+ * @return The current time in nanoseconds.
+ */
+static uint64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/**
+ * Gives the calling thread a buffer, reusing one released by an exited thread if possible.
+ *
+ * @return The calling thread's buffer.
+ */
+static ThreadBuffer* attachBuffer() {
+    auto& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    ThreadBuffer* buffer = nullptr;
+    for (auto& candidate : registry.buffers) {
+        if (!candidate->inUse) {
+            buffer = candidate.get();
+            buffer->inUse = true;
+            break;
+        }
+    }
+    if (!buffer) {
+        registry.buffers.emplace_back(new ThreadBuffer(static_cast<uint32_t>(registry.buffers.size())));
+        buffer = registry.buffers.back().get();
+    }
+    // Make sure the buffer is released when this thread exits.
+    (void)&bufferReleaser;
+    currentBuffer = buffer;
+    return buffer;
+}
+
+const size_t LatencyTracer::EVENTS_PER_THREAD;
+
+const char* tracePointToString(TracePoint point) {
+    switch (point) {
+        case TracePoint::ADSL_ENQUEUE:
+            return "ADSL_ENQUEUE";
+        case TracePoint::ADSL_DEQUEUE:
+            return "ADSL_DEQUEUE";
+        case TracePoint::SPEECH_SYNTHESIZER_RECEIVE:
+            return "SPEECH_SYNTHESIZER_RECEIVE";
+        case TracePoint::AIP_RECEIVE:
+            return "AIP_RECEIVE";
+        case TracePoint::AIP_SEND:
+            return "AIP_SEND";
+        case TracePoint::BUILDING_MESSAGE:
+            return "BUILDING_MESSAGE";
+        case TracePoint::KEYWORD_DETECTED:
+            return "KEYWORD_DETECTED";
+        case TracePoint::SDS_READ:
+            return "SDS_READ";
+        case TracePoint::MESSAGE_STREAM_OPENED:
+            return "MESSAGE_STREAM_OPENED";
+        case TracePoint::FIRST_RESPONSE_BYTE:
+            return "FIRST_RESPONSE_BYTE";
+        case TracePoint::MIME_PART_BEGIN:
+            return "MIME_PART_BEGIN";
+        case TracePoint::MEDIA_PLAYER_PLAYING:
+            return "MEDIA_PLAYER_PLAYING";
+        case TracePoint::MEDIA_PLAYER_SOURCE_SET:
+            return "MEDIA_PLAYER_SOURCE_SET";
+    }
+    return "UNKNOWN";
+}
+
+void LatencyTracer::record(TracePoint point, uint64_t id) {
+    if (!enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    ThreadBuffer* buffer = currentBuffer;
+    if (!buffer) {
+        buffer = attachBuffer();
+    }
+    auto count = buffer->writeCount.load(std::memory_order_relaxed);
+    buffer->startCount.store(count + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    auto& slot = buffer->slots[count % EVENTS_PER_THREAD];
+    slot.timestamp.store(now(), std::memory_order_relaxed);
+    slot.id.store(id, std::memory_order_relaxed);
+    slot.point.store(static_cast<uint32_t>(point), std::memory_order_relaxed);
+    buffer->writeCount.store(count + 1, std::memory_order_release);
+}
+
+void LatencyTracer::record(TracePoint point, const std::string& id) {
+    if (!enabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    record(point, hashId(id));
+}
+
+uint64_t LatencyTracer::hashId(const std::string& id) {
+    if (id.empty()) {
+        return 0;
+    }
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (auto c : id) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+void LatencyTracer::setEnabled(bool enable) {
+    enabled = enable;
+}
+
+bool LatencyTracer::isEnabled() {
+    return enabled;
+}
+
+void LatencyTracer::clear() {
+    clearedBefore = now();
+}
+
+std::vector<TraceEvent> LatencyTracer::snapshot() {
+    std::vector<TraceEvent> events;
+    auto cutoff = clearedBefore.load();
+    auto& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (auto& buffer : registry.buffers) {
+        auto end = buffer->writeCount.load(std::memory_order_acquire);
+        auto begin = end > EVENTS_PER_THREAD ? end - EVENTS_PER_THREAD : 0;
+        auto firstCopied = events.size();
+        for (auto n = begin; n < end; ++n) {
+            auto& slot = buffer->slots[n % EVENTS_PER_THREAD];
+            events.push_back(
+                {slot.timestamp.load(std::memory_order_relaxed),
+                 slot.id.load(std::memory_order_relaxed),
+                 static_cast<TracePoint>(slot.point.load(std::memory_order_relaxed)),
+                 buffer->index});
+        }
+
+        // The owner may have overwritten the oldest events while they were copied.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        auto startedAfterCopy = buffer->startCount.load(std::memory_order_relaxed);
+        if (startedAfterCopy > begin + EVENTS_PER_THREAD) {
+            auto overwritten = std::min(startedAfterCopy - EVENTS_PER_THREAD - begin, end - begin);
+            events.erase(events.begin() + firstCopied, events.begin() + firstCopied + overwritten);
+        }
+    }
+    events.erase(
+        std::remove_if(
+            events.begin(), events.end(), [cutoff](const TraceEvent& event) { return event.timestamp < cutoff; }),
+        events.end());
+    std::stable_sort(events.begin(), events.end(), [](const TraceEvent& lhs, const TraceEvent& rhs) {
+        return lhs.timestamp < rhs.timestamp;
+    });
+    return events;
+}
+
+bool LatencyTracer::exportTo(TraceExporterInterface& exporter) {
+    return exporter.exportEvents(snapshot());
+}
+
+}  // namespace metrics
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -108,7 +108,7 @@ void InternetConnectionMonitor::startMonitoring() {
         m_period,
         Timer::PeriodType::RELATIVE,
         Timer::FOREVER,
-        std::bind(&InternetConnectionMonitor::testConnection, this));
+        [this] { m_executor.submit([this] { testConnection(); }); });
 }
 
 void InternetConnectionMonitor::stopMonitoring() {
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cerrno>
+#include <ctime>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/SDS/ProcessSharedConditionVariable.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("ProcessSharedConditionVariable");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The number of nanoseconds in a second.
+static const long NANOSECONDS_PER_SECOND = 1000000000L;
+
+ProcessSharedConditionVariable::ProcessSharedConditionVariable() {
+    pthread_condattr_t attributes;
+    pthread_condattr_init(&attributes);
+    pthread_condattr_setpshared(&attributes, PTHREAD_PROCESS_SHARED);
+    pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+    int result = pthread_cond_init(&m_condition, &attributes);
+    pthread_condattr_destroy(&attributes);
+    if (result != 0) {
+        ACSDK_ERROR(LX("initFailed").d("reason", "pthread_cond_init").d("error", result));
+    }
+}
+
+ProcessSharedConditionVariable::~ProcessSharedConditionVariable() {
+    pthread_cond_destroy(&m_condition);
+}
+
+void ProcessSharedConditionVariable::notify_one() {
+    pthread_cond_signal(&m_condition);
+}
+
+void ProcessSharedConditionVariable::notify_all() {
+    pthread_cond_broadcast(&m_condition);
+}
+
+void ProcessSharedConditionVariable::wait(std::unique_lock<ProcessSharedMutex>& lock) {
+    waitUntil(lock, nullptr);
+}
+
+std::cv_status ProcessSharedConditionVariable::waitUntil(
+    std::unique_lock<ProcessSharedMutex>& lock,
+    const struct timespec* deadline) {
+    auto mutex = lock.mutex();
+    int result = deadline ? pthread_cond_timedwait(&m_condition, mutex->nativeHandle(), deadline)
+                          : pthread_cond_wait(&m_condition, mutex->nativeHandle());
+    if (ETIMEDOUT == result) {
+        return std::cv_status::timeout;
+    }
+    // The mutex is re-acquired on return, so recover it if its previous owner died.
+    mutex->onAcquired(result);
+    return std::cv_status::no_timeout;
+}
+
+struct timespec ProcessSharedConditionVariable::deadlineFromNow(std::chrono::nanoseconds timeout) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+    deadline.tv_sec += seconds.count();
+    deadline.tv_nsec += (timeout - seconds).count();
+    if (deadline.tv_nsec >= NANOSECONDS_PER_SECOND) {
+        deadline.tv_sec += 1;
+        deadline.tv_nsec -= NANOSECONDS_PER_SECOND;
+    }
+    return deadline;
+}
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
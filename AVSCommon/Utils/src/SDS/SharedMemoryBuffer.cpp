@@ -0,0 +1,145 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cerrno>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/SDS/SharedMemoryBuffer.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("SharedMemoryBuffer");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// Permissions for newly created shared memory objects (read/write for the owner only).
+static const mode_t SHARED_MEMORY_MODE = S_IRUSR | S_IWUSR;
+
+std::shared_ptr<SharedMemoryBuffer> SharedMemoryBuffer::create(const std::string& name, size_t size) {
+    if (0 == size) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "zeroSize").d("name", name));
+        return nullptr;
+    }
+    int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, SHARED_MEMORY_MODE);
+    if (fd < 0) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "shm_open").d("name", name).d("errno", errno));
+        return nullptr;
+    }
+    if (ftruncate(fd, size) != 0) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "ftruncate").d("name", name).d("errno", errno));
+        close(fd);
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+    auto data = map(fd, size);
+    close(fd);
+    if (!data) {
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+    return std::shared_ptr<SharedMemoryBuffer>(new SharedMemoryBuffer(name, data, size, true));
+}
+
+std::shared_ptr<SharedMemoryBuffer> SharedMemoryBuffer::open(const std::string& name) {
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        ACSDK_ERROR(LX("openFailed").d("reason", "shm_open").d("name", name).d("errno", errno));
+        return nullptr;
+    }
+    struct stat status;
+    if (fstat(fd, &status) != 0 || 0 == status.st_size) {
+        ACSDK_ERROR(LX("openFailed").d("reason", "invalidSize").d("name", name).d("errno", errno));
+        close(fd);
+        return nullptr;
+    }
+    size_t size = static_cast<size_t>(status.st_size);
+    auto data = map(fd, size);
+    close(fd);
+    if (!data) {
+        return nullptr;
+    }
+    return std::shared_ptr<SharedMemoryBuffer>(new SharedMemoryBuffer(name, data, size, false));
+}
+
+SharedMemoryBuffer::SharedMemoryBuffer(size_t size) : m_data{nullptr}, m_size{0}, m_owner{false} {
+    auto data = map(-1, size);
+    if (data) {
+        m_data = static_cast<value_type*>(data);
+        m_size = size;
+    }
+}
+
+SharedMemoryBuffer::SharedMemoryBuffer(const std::string& name, void* data, size_t size, bool owner) :
+        m_name{name},
+        m_data{static_cast<value_type*>(data)},
+        m_size{size},
+        m_owner{owner} {
+}
+
+SharedMemoryBuffer::~SharedMemoryBuffer() {
+    if (m_data) {
+        munmap(m_data, m_size);
+    }
+    if (m_owner) {
+        shm_unlink(m_name.c_str());
+    }
+}
+
+SharedMemoryBuffer::value_type* SharedMemoryBuffer::data() {
+    return m_data;
+}
+
+SharedMemoryBuffer::size_type SharedMemoryBuffer::size() const {
+    return m_size;
+}
+
+std::string SharedMemoryBuffer::name() const {
+    return m_name;
+}
+
+void* SharedMemoryBuffer::map(int fd, size_t size) {
+    if (0 == size) {
+        return nullptr;
+    }
+    int flags = MAP_SHARED;
+    if (fd < 0) {
+        flags |= MAP_ANONYMOUS;
+    }
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, fd, 0);
+    if (MAP_FAILED == data) {
+        ACSDK_ERROR(LX("mapFailed").d("size", size).d("errno", errno));
+        return nullptr;
+    }
+    return data;
+}
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
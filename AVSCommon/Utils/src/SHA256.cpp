@@ -0,0 +1,138 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Crypto/SHA256.h"
+
+#include <algorithm>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace crypto {
+
+const size_t SHA256::DIGEST_HEX_LENGTH;
+
+/// The round constants of SHA-256.
+static const uint32_t SHA256_K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2};
+
+/**
+ * Rotates a word right.
+ *
+ * @param value The word.
+ * @param count The number of bits to rotate by.
+ * @return The rotated word.
+ */
+static inline uint32_t rotateRight(uint32_t value, int count) {
+    return (value >> count) | (value << (32 - count));
+}
+
+SHA256::SHA256() :
+        m_state{0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19},
+        m_blockSize{0},
+        m_length{0} {
+}
+
+void SHA256::update(const void* data, size_t size) {
+    auto bytes = static_cast<const uint8_t*>(data);
+    m_length += size;
+    while (size > 0) {
+        auto count = std::min(size, sizeof(m_block) - m_blockSize);
+        std::copy(bytes, bytes + count, m_block + m_blockSize);
+        m_blockSize += count;
+        bytes += count;
+        size -= count;
+        if (sizeof(m_block) == m_blockSize) {
+            transform();
+            m_blockSize = 0;
+        }
+    }
+}
+
+std::string SHA256::finish() {
+    uint64_t lengthInBits = m_length * 8;
+    const uint8_t padding = 0x80;
+    update(&padding, 1);
+    const uint8_t zero = 0;
+    while (m_blockSize != sizeof(m_block) - sizeof(lengthInBits)) {
+        update(&zero, 1);
+    }
+    uint8_t length[sizeof(lengthInBits)];
+    for (size_t i = 0; i < sizeof(length); ++i) {
+        length[i] = static_cast<uint8_t>(lengthInBits >> (8 * (sizeof(length) - 1 - i)));
+    }
+    update(length, sizeof(length));
+
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+    std::string digest;
+    for (auto word : m_state) {
+        for (int shift = 28; shift >= 0; shift -= 4) {
+            digest.push_back(HEX_DIGITS[(word >> shift) & 0xf]);
+        }
+    }
+    return digest;
+}
+
+void SHA256::transform() {
+    uint32_t w[64];
+    for (int i = 0; i < 16; ++i) {
+        w[i] = (static_cast<uint32_t>(m_block[i * 4]) << 24) | (static_cast<uint32_t>(m_block[i * 4 + 1]) << 16) |
+               (static_cast<uint32_t>(m_block[i * 4 + 2]) << 8) | static_cast<uint32_t>(m_block[i * 4 + 3]);
+    }
+    for (int i = 16; i < 64; ++i) {
+        auto s0 = rotateRight(w[i - 15], 7) ^ rotateRight(w[i - 15], 18) ^ (w[i - 15] >> 3);
+        auto s1 = rotateRight(w[i - 2], 17) ^ rotateRight(w[i - 2], 19) ^ (w[i - 2] >> 10);
+        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+    }
+
+    uint32_t a = m_state[0], b = m_state[1], c = m_state[2], d = m_state[3];
+    uint32_t e = m_state[4], f = m_state[5], g = m_state[6], h = m_state[7];
+    for (int i = 0; i < 64; ++i) {
+        auto s1 = rotateRight(e, 6) ^ rotateRight(e, 11) ^ rotateRight(e, 25);
+        auto choice = (e & f) ^ (~e & g);
+        auto temp1 = h + s1 + choice + SHA256_K[i] + w[i];
+        auto s0 = rotateRight(a, 2) ^ rotateRight(a, 13) ^ rotateRight(a, 22);
+        auto majority = (a & b) ^ (a & c) ^ (b & c);
+        auto temp2 = s0 + majority;
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + temp2;
+    }
+    m_state[0] += a;
+    m_state[1] += b;
+    m_state[2] += c;
+    m_state[3] += d;
+    m_state[4] += e;
+    m_state[5] += f;
+    m_state[6] += g;
+    m_state[7] += h;
+}
+
+}  // namespace crypto
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
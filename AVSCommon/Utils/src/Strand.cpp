@@ -0,0 +1,110 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Threading/Strand.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("Strand");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The maximum number of tasks to run before giving other @c Strands on the pool a turn.
+static const size_t MAX_TASKS_PER_RUN = 16;
+
+std::shared_ptr<Strand> Strand::create(std::shared_ptr<ExecutorPool> pool, std::shared_ptr<TaskQueue> taskQueue) {
+    if (!pool) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullPool"));
+        return nullptr;
+    }
+    if (!taskQueue) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullTaskQueue"));
+        return nullptr;
+    }
+    return std::shared_ptr<Strand>(new Strand(std::move(pool), std::move(taskQueue)));
+}
+
+Strand::Strand(std::shared_ptr<ExecutorPool> pool, std::shared_ptr<TaskQueue> taskQueue) :
+        m_pool{std::move(pool)},
+        m_taskQueue{std::move(taskQueue)},
+        m_scheduled{false},
+        m_running{false},
+        m_shutdown{false} {
+}
+
+void Strand::notifyTaskQueued() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_scheduled || m_shutdown) {
+            return;
+        }
+        m_scheduled = true;
+    }
+    m_pool->enqueue(shared_from_this());
+}
+
+void Strand::shutdown() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_shutdown = true;
+    if (m_running && m_runningThread == std::this_thread::get_id()) {
+        return;
+    }
+    m_taskFinished.wait(lock, [this] { return !m_running; });
+}
+
+void Strand::run() {
+    for (size_t count = 0; count < MAX_TASKS_PER_RUN; ++count) {
+        TaskQueue::QueuedTaskPtr task;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            // Checking the queue with m_mutex held means a task pushed after this check will find m_scheduled false
+            // when it calls notifyTaskQueued(), and reschedule us.
+            if (!m_shutdown) {
+                task = m_taskQueue->tryPop();
+            }
+            if (!task) {
+                m_scheduled = false;
+                return;
+            }
+            m_running = true;
+            m_runningThread = std::this_thread::get_id();
+        }
+        (*task)();
+        // Release the task (and anything it captured) before reporting that it has finished.
+        task.reset();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_running = false;
+        }
+        m_taskFinished.notify_all();
+    }
+    // There may be more tasks, but let other Strands run first.
+    m_pool->enqueue(shared_from_this());
+}
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
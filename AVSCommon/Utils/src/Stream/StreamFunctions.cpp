@@ -42,6 +42,16 @@ std::unique_ptr<std::istream> streamFromData(const unsigned char* data, size_t l
     return std::unique_ptr<ResourceStream>(new ResourceStream(std::unique_ptr<Streambuf>(new Streambuf(data, length))));
 }
 
+bool dataFromStream(const std::istream& stream, const unsigned char** data, size_t* length) {
+    auto buf = dynamic_cast<const Streambuf*>(stream.rdbuf());
+    if (!buf || !data || !length) {
+        return false;
+    }
+    *data = buf->getData();
+    *length = buf->getLength();
+    return true;
+}
+
 }  // namespace stream
 }  // namespace utils
 }  // namespace avsCommon
@@ -54,6 +54,14 @@ std::streampos Streambuf::seekpos(std::streampos sp, std::ios_base::openmode whi
     return seekoff(sp - pos_type(off_type(0)), std::ios_base::beg, which);
 }
 
+const unsigned char* Streambuf::getData() const {
+    return reinterpret_cast<const unsigned char*>(m_begin);
+}
+
+size_t Streambuf::getLength() const {
+    return m_end - m_begin;
+}
+
 Streambuf::int_type Streambuf::underflow() {
     if (gptr() == m_end) {
         return Streambuf::traits_type::eof();
@@ -20,39 +20,150 @@ namespace avsCommon {
 namespace utils {
 namespace threading {
 
-TaskQueue::TaskQueue() : m_shutdown{false} {
+/// The maximum number of free nodes kept for reuse.  Nodes beyond this, left over from a burst of tasks, are deleted.
+static const size_t MAX_FREE_TASKS = 64;
+
+void TaskQueue::QueuedTask::operator()() {
+    m_function();
+}
+
+TaskQueue::QueuedTaskRecycler::QueuedTaskRecycler(TaskQueue* queue) : m_queue{queue} {
+}
+
+void TaskQueue::QueuedTaskRecycler::operator()(QueuedTask* task) const {
+    // Destroy the task (which may run arbitrary destructors) without holding the queue's lock.
+    task->m_function.reset();
+    if (m_queue) {
+        m_queue->recycle(task);
+    } else {
+        delete task;
+    }
+}
+
+TaskQueue::TaskQueue() :
+        m_head{nullptr},
+        m_tail{nullptr},
+        m_freeTasks{nullptr},
+        m_freeTaskCount{0},
+        m_shutdown{false} {
 }
 
-std::unique_ptr<std::function<void()>> TaskQueue::pop() {
+TaskQueue::~TaskQueue() {
+    while (m_head) {
+        auto next = m_head->m_next;
+        delete m_head;
+        m_head = next;
+    }
+    while (m_freeTasks) {
+        auto next = m_freeTasks->m_next;
+        delete m_freeTasks;
+        m_freeTasks = next;
+    }
+}
+
+TaskQueue::QueuedTaskPtr TaskQueue::pop() {
     std::unique_lock<std::mutex> queueLock{m_queueMutex};
 
-    auto shouldNotWait = [this]() { return m_shutdown || !m_queue.empty(); };
+    auto shouldNotWait = [this]() { return m_shutdown || m_head; };
 
     if (!shouldNotWait()) {
         m_queueChanged.wait(queueLock, shouldNotWait);
     }
 
-    if (!m_queue.empty()) {
-        auto task = std::move(m_queue.front());
-
-        m_queue.pop_front();
-        return task;
+    if (m_head) {
+        return popFrontLocked();
     }
 
     return nullptr;
 }
 
-void TaskQueue::shutdown() {
+TaskQueue::QueuedTaskPtr TaskQueue::tryPop() {
     std::lock_guard<std::mutex> queueLock{m_queueMutex};
-    m_queue.clear();
-    m_shutdown = true;
-    m_queueChanged.notify_all();
+    if (!m_head) {
+        return nullptr;
+    }
+    return popFrontLocked();
+}
+
+void TaskQueue::shutdown() {
+    QueuedTask* head = nullptr;
+    {
+        std::lock_guard<std::mutex> queueLock{m_queueMutex};
+        head = m_head;
+        m_head = nullptr;
+        m_tail = nullptr;
+        m_shutdown = true;
+        m_queueChanged.notify_all();
+    }
+    while (head) {
+        auto next = head->m_next;
+        delete head;
+        head = next;
+    }
 }
 
 bool TaskQueue::isShutdown() {
     return m_shutdown;
 }
 
+bool TaskQueue::pushFunction(bool front, TaskFunction&& function) {
+    {
+        std::lock_guard<std::mutex> queueLock{m_queueMutex};
+        if (m_shutdown) {
+            return false;
+        }
+        QueuedTask* task = m_freeTasks;
+        if (task) {
+            m_freeTasks = task->m_next;
+            --m_freeTaskCount;
+        } else {
+            task = new QueuedTask;
+        }
+        task->m_function = std::move(function);
+        if (front) {
+            task->m_next = m_head;
+            m_head = task;
+            if (!m_tail) {
+                m_tail = task;
+            }
+        } else {
+            task->m_next = nullptr;
+            if (m_tail) {
+                m_tail->m_next = task;
+            } else {
+                m_head = task;
+            }
+            m_tail = task;
+        }
+    }
+
+    // There is at most one thread popping tasks from the queue.
+    m_queueChanged.notify_one();
+    return true;
+}
+
+TaskQueue::QueuedTaskPtr TaskQueue::popFrontLocked() {
+    QueuedTask* task = m_head;
+    m_head = task->m_next;
+    if (!m_head) {
+        m_tail = nullptr;
+    }
+    return QueuedTaskPtr(task, QueuedTaskRecycler(this));
+}
+
+void TaskQueue::recycle(QueuedTask* task) {
+    {
+        std::lock_guard<std::mutex> queueLock{m_queueMutex};
+        if (m_freeTaskCount < MAX_FREE_TASKS) {
+            task->m_next = m_freeTasks;
+            m_freeTasks = task;
+            ++m_freeTaskCount;
+            return;
+        }
+    }
+    delete task;
+}
+
 }  // namespace threading
 }  // namespace utils
 }  // namespace avsCommon
@@ -13,7 +13,10 @@
  * permissions and limitations under the License.
  */
 
+#include <mutex>
+
 #include "AVSCommon/Utils/Timing/Timer.h"
+#include "AVSCommon/Utils/Timing/TimerService.h"
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -22,7 +25,65 @@ namespace timing {
 
 const std::string Timer::TAG = "Timer";
 
-Timer::Timer() : m_running(false), m_stopping(false) {
+struct Timer::State {
+    /**
+     * Constructor.
+     *
+     * @param service The service to schedule task calls on.
+     */
+    explicit State(std::shared_ptr<TimerService> service);
+
+    /// The service to schedule task calls on.
+    std::shared_ptr<TimerService> service;
+
+    /// The handle used to schedule task calls.
+    std::unique_ptr<TimerService::Handle> handle;
+
+    /// Protects the members below.
+    std::mutex mutex;
+
+    /// Whether the @c Timer is active.
+    bool running;
+
+    /// Incremented by each @c start() and @c stop(), so that stale task calls can be recognized.
+    uint64_t generation;
+
+    /// The time to wait before the first task call.
+    std::chrono::nanoseconds delay;
+
+    /// The time to wait between subsequent task calls.
+    std::chrono::nanoseconds period;
+
+    /// The type of period to use.
+    PeriodType periodType;
+
+    /// The number of task calls to make, or @c FOREVER.
+    size_t maxCount;
+
+    /// The number of task calls made, or skipped, so far.
+    size_t count;
+
+    /// The time to measure the next delay or period against.
+    std::chrono::steady_clock::time_point base;
+
+    /// Whether an @c ABSOLUTE timer has drifted off schedule, and should skip the next task call.
+    bool offSchedule;
+};
+
+Timer::State::State(std::shared_ptr<TimerService> service) :
+        service{service},
+        handle{service->createHandle()},
+        running{false},
+        generation{0},
+        delay{0},
+        period{0},
+        periodType{PeriodType::ABSOLUTE},
+        maxCount{0},
+        count{0},
+        offSchedule{false} {
+}
+
+Timer::Timer() : m_state{std::make_shared<State>(TimerService::getInstance())} {
 }
 
 Timer::~Timer() {
@@ -31,24 +92,98 @@ Timer::~Timer() {
 
 void Timer::stop() {
     {
-        std::lock_guard<std::mutex> lock(m_waitMutex);
-        if (m_running) {
-            m_stopping = true;
-        }
-        m_waitCondition.notify_all();
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        ++m_state->generation;
     }
 
-    if (std::this_thread::get_id() != m_thread.get_id() && m_thread.joinable()) {
-        m_thread.join();
-    }
+    // This waits for a task call in progress on another thread, unless it is being made from within the task.
+    m_state->service->cancel(m_state->handle.get());
+
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    m_state->running = false;
 }
 
 bool Timer::isActive() const {
-    return m_running;
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->running;
 }
 
-bool Timer::activate() {
-    return !m_running.exchange(true);
+bool Timer::startTimer(
+    std::chrono::nanoseconds delay,
+    std::chrono::nanoseconds period,
+    PeriodType periodType,
+    size_t maxCount,
+    std::function<void()> task) {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+
+    // Can't start if already running.
+    if (m_state->running) {
+        logger::acsdkError(logger::LogEntry(TAG, "startFailed").d("reason", "timerAlreadyActive"));
+        return false;
+    }
+
+    m_state->running = true;
+    auto generation = ++m_state->generation;
+    m_state->delay = delay;
+    m_state->period = period;
+    m_state->periodType = periodType;
+    m_state->maxCount = maxCount;
+    m_state->count = 0;
+    m_state->base = std::chrono::steady_clock::now();
+    m_state->offSchedule = false;
+
+    auto state = m_state;
+    m_state->service->schedule(m_state->handle.get(), m_state->base + delay, [state, generation, task]() {
+        callTask(state, generation, task);
+    });
+    return true;
+}
+
+void Timer::callTask(std::shared_ptr<State> state, uint64_t generation, std::function<void()> task) {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    if (state->generation != generation) {
+        return;
+    }
+
+    auto waitTime = (0 == state->count) ? state->delay : state->period;
+    switch (state->periodType) {
+        case PeriodType::ABSOLUTE: {
+            // Update our estimate of where we should be after the delay.
+            state->base += waitTime;
+
+            // Run the task if we're still on schedule.
+            if (!state->offSchedule) {
+                lock.unlock();
+                task();
+                lock.lock();
+            }
+
+            // If the task runtime put us off schedule, skip the next task run.
+            state->offSchedule = state->base + state->period < std::chrono::steady_clock::now();
+            break;
+        }
+        case PeriodType::RELATIVE:
+            lock.unlock();
+            task();
+            lock.lock();
+            state->base = std::chrono::steady_clock::now();
+            break;
+    }
+
+    // Give up if the task stopped (or restarted) the timer.
+    if (state->generation != generation) {
+        return;
+    }
+
+    ++state->count;
+    if (state->maxCount != FOREVER && state->count >= state->maxCount) {
+        state->running = false;
+        return;
+    }
+
+    state->service->schedule(state->handle.get(), state->base + state->period, [state, generation, task]() {
+        callTask(state, generation, task);
+    });
 }
 
 }  // namespace timing
@@ -0,0 +1,573 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <limits>
+#include <system_error>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Timing/TimerService.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("TimerService");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/**
+ * How long a callback may run before it is considered blocked, and a new dispatch thread is started if one is needed
+ * to run other callbacks.
+ */
+static const std::chrono::milliseconds BLOCKED_CALLBACK_THRESHOLD{5};
+
+/// Value used for "no tick".
+static const uint64_t NO_TICK = std::numeric_limits<uint64_t>::max();
+
+/// The number of bits of a tick number covered by the whole wheel.  Handles due further out wait on a separate list.
+static const int WHEEL_BITS = 24;
+
+/**
+ * Finds the lowest set bit of a non-zero value.
+ *
+ * @param value The value.
+ * @return The index of the lowest set bit.
+ */
+static int lowestSetBit(uint64_t value) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(value);
+#else
+    int index = 0;
+    while (!(value & 1)) {
+        value >>= 1;
+        ++index;
+    }
+    return index;
+#endif
+}
+
+TimerService::Handle::Handle(TimerService* service) :
+        m_service{service},
+        m_prev{nullptr},
+        m_next{nullptr},
+        m_level{IDLE},
+        m_slot{0},
+        m_expiry{0},
+        m_cancelWaiters{0} {
+}
+
+TimerService::Handle::~Handle() {
+    m_service->release(this);
+}
+
+std::shared_ptr<TimerService> TimerService::create(
+    std::chrono::nanoseconds tick,
+    std::chrono::milliseconds idleThreadTimeout) {
+    if (tick <= std::chrono::nanoseconds::zero()) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nonPositiveTick"));
+        return nullptr;
+    }
+    if (idleThreadTimeout <= std::chrono::milliseconds::zero()) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nonPositiveIdleThreadTimeout"));
+        return nullptr;
+    }
+    return std::shared_ptr<TimerService>(new TimerService(tick, idleThreadTimeout));
+}
+
+std::shared_ptr<TimerService> TimerService::getInstance() {
+    // Deliberately leaked, so that Timers in objects with static storage duration remain usable during exit.
+    static auto instance = new std::shared_ptr<TimerService>(create());
+    return *instance;
+}
+
+TimerService::TimerService(std::chrono::nanoseconds tick, std::chrono::milliseconds idleThreadTimeout) :
+        m_tick{tick},
+        m_idleThreadTimeout{idleThreadTimeout},
+        m_epoch{std::chrono::steady_clock::now()},
+        m_currentTick{0},
+        m_plannedWakeTick{0},
+        m_occupied{},
+        m_pendingCount{0},
+        m_hasLeader{false},
+        m_leadershipOffered{false},
+        m_idleFollowers{0},
+        m_waitingForFollower{false},
+        m_shutdown{false} {
+    m_threads.emplace_back(&TimerService::dispatchLoop, this);
+}
+
+TimerService::~TimerService() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_wakeCondition.notify_all();
+    m_followerCondition.notify_all();
+    // No threads are added or removed once m_shutdown is set.
+    for (auto& thread : m_threads) {
+        if (thread.get_id() == std::this_thread::get_id()) {
+            thread.detach();
+        } else if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+std::unique_ptr<TimerService::Handle> TimerService::createHandle() {
+    return std::unique_ptr<Handle>(new Handle(this));
+}
+
+void TimerService::schedule(
+    Handle* handle,
+    std::chrono::steady_clock::time_point deadline,
+    std::function<void()> callback) {
+    if (!handle || handle->m_service != this) {
+        ACSDK_ERROR(LX("scheduleFailed").d("reason", "invalidHandle"));
+        return;
+    }
+
+    std::function<void()> replaced;
+    bool wake = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (handle->m_level != IDLE) {
+            unlinkLocked(handle);
+            --m_pendingCount;
+        }
+        replaced = std::move(handle->m_callback);
+        if (handle->m_cancelWaiters > 0) {
+            // A callback is rescheduling itself while being cancelled.  It is dropped (outside the lock) on return.
+            return;
+        }
+        handle->m_callback = std::move(callback);
+        ++m_pendingCount;
+        if (deadline <= std::chrono::steady_clock::now()) {
+            // Already due, so skip the wheel rather than wait for the next tick.
+            handle->m_expiry = m_currentTick;
+            handle->m_level = EXPIRED;
+            append(&m_expired, handle);
+            // A callback rescheduling itself cannot run again until it returns, and this thread then picks it up,
+            // so there is no need to wake the leader.
+            wake = m_plannedWakeTick != 0 && !isRunningHereLocked(handle);
+        } else {
+            handle->m_expiry = std::max(m_currentTick + 1, toTickCeiling(deadline));
+            insertLocked(handle);
+            wake = handle->m_expiry < m_plannedWakeTick;
+        }
+    }
+    if (wake) {
+        m_wakeCondition.notify_one();
+    }
+}
+
+bool TimerService::cancel(Handle* handle) {
+    if (!handle || handle->m_service != this) {
+        ACSDK_ERROR(LX("cancelFailed").d("reason", "invalidHandle"));
+        return false;
+    }
+
+    bool cancelled = false;
+    std::function<void()> callback;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (handle->m_level != IDLE) {
+        unlinkLocked(handle);
+        --m_pendingCount;
+        cancelled = true;
+    }
+    callback = std::move(handle->m_callback);
+    handle->m_callback = nullptr;
+
+    if (isRunningElsewhereLocked(handle)) {
+        // Wait for the running callback, dropping anything it schedules on this handle in the meantime.
+        ++handle->m_cancelWaiters;
+        m_callbackFinished.wait(lock, [this, handle] { return !isRunningElsewhereLocked(handle); });
+        --handle->m_cancelWaiters;
+    }
+
+    // Destroy the callback outside the lock, since it may own objects which use this service.
+    lock.unlock();
+    return cancelled;
+}
+
+size_t TimerService::getPendingCount() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pendingCount;
+}
+
+size_t TimerService::getThreadCount() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_threads.size() - m_exitedThreads.size();
+}
+
+uint64_t TimerService::toTickCeiling(std::chrono::steady_clock::time_point time) const {
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(time - m_epoch).count();
+    if (elapsed <= 0) {
+        return 0;
+    }
+    return (static_cast<uint64_t>(elapsed) + m_tick.count() - 1) / m_tick.count();
+}
+
+uint64_t TimerService::toTickFloor(std::chrono::steady_clock::time_point time) const {
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(time - m_epoch).count();
+    if (elapsed <= 0) {
+        return 0;
+    }
+    return static_cast<uint64_t>(elapsed) / m_tick.count();
+}
+
+void TimerService::append(List* list, Handle* handle) {
+    handle->m_next = nullptr;
+    handle->m_prev = list->tail;
+    if (list->tail) {
+        list->tail->m_next = handle;
+    } else {
+        list->head = handle;
+    }
+    list->tail = handle;
+}
+
+void TimerService::insertLocked(Handle* handle) {
+    auto expiry = handle->m_expiry;
+    List* list = nullptr;
+
+    // A handle goes on the lowest level whose current block (the span covered by one slot of the level above)
+    // contains its expiry.  Its slot is then always ahead of the current position on that level.
+    if (expiry <= m_currentTick) {
+        handle->m_level = 0;
+        handle->m_slot = static_cast<int>(m_currentTick & (SLOTS_PER_LEVEL - 1));
+        list = &m_slots[0][handle->m_slot];
+    } else {
+        for (int level = 0; level < LEVELS; ++level) {
+            int blockShift = SLOT_BITS * (level + 1);
+            if ((expiry >> blockShift) == (m_currentTick >> blockShift)) {
+                handle->m_level = level;
+                handle->m_slot = static_cast<int>((expiry >> (SLOT_BITS * level)) & (SLOTS_PER_LEVEL - 1));
+                list = &m_slots[level][handle->m_slot];
+                break;
+            }
+        }
+    }
+
+    if (list) {
+        m_occupied[handle->m_level] |= uint64_t{1} << handle->m_slot;
+    } else {
+        handle->m_level = FAR_FUTURE;
+        handle->m_slot = 0;
+        list = &m_farFuture;
+    }
+    append(list, handle);
+}
+
+void TimerService::unlinkLocked(Handle* handle) {
+    List* list = nullptr;
+    switch (handle->m_level) {
+        case IDLE:
+            return;
+        case EXPIRED:
+            list = &m_expired;
+            break;
+        case FAR_FUTURE:
+            list = &m_farFuture;
+            break;
+        case DEFERRED:
+            list = &m_deferred;
+            break;
+        default:
+            list = &m_slots[handle->m_level][handle->m_slot];
+            break;
+    }
+
+    if (handle->m_prev) {
+        handle->m_prev->m_next = handle->m_next;
+    } else {
+        list->head = handle->m_next;
+    }
+    if (handle->m_next) {
+        handle->m_next->m_prev = handle->m_prev;
+    } else {
+        list->tail = handle->m_prev;
+    }
+    if (handle->m_level >= 0 && !list->head) {
+        m_occupied[handle->m_level] &= ~(uint64_t{1} << handle->m_slot);
+    }
+    handle->m_prev = nullptr;
+    handle->m_next = nullptr;
+    handle->m_level = IDLE;
+}
+
+uint64_t TimerService::nextEventTickLocked() const {
+    uint64_t next = NO_TICK;
+    for (int level = 0; level < LEVELS; ++level) {
+        if (m_occupied[level]) {
+            // Occupied slots are all ahead of the current position, so the lowest one is the next to process.
+            int blockShift = SLOT_BITS * (level + 1);
+            uint64_t blockStart = (m_currentTick >> blockShift) << blockShift;
+            uint64_t slot = static_cast<uint64_t>(lowestSetBit(m_occupied[level]));
+            next = std::min(next, blockStart + (slot << (SLOT_BITS * level)));
+        }
+    }
+    if (m_farFuture.head) {
+        next = std::min(next, ((m_currentTick >> WHEEL_BITS) + 1) << WHEEL_BITS);
+    }
+    return next;
+}
+
+void TimerService::advanceLocked(uint64_t tick) {
+    while (m_currentTick < tick) {
+        uint64_t next = nextEventTickLocked();
+        if (next > tick) {
+            // Nothing to do between here and tick, so jump straight to it.
+            m_currentTick = tick;
+            return;
+        }
+        m_currentTick = next;
+
+        // Re-file handles whose coarse slot has been reached, starting at the top so that they can cascade all the
+        // way down.
+        if ((next & ((uint64_t{1} << WHEEL_BITS) - 1)) == 0 && m_farFuture.head) {
+            List farFuture = m_farFuture;
+            m_farFuture = List();
+            for (Handle* handle = farFuture.head; handle;) {
+                Handle* nextHandle = handle->m_next;
+                insertLocked(handle);
+                handle = nextHandle;
+            }
+        }
+        for (int level = LEVELS - 1; level > 0; --level) {
+            int levelShift = SLOT_BITS * level;
+            if ((next & ((uint64_t{1} << levelShift) - 1)) != 0) {
+                continue;
+            }
+            int slot = static_cast<int>((next >> levelShift) & (SLOTS_PER_LEVEL - 1));
+            if (!(m_occupied[level] & (uint64_t{1} << slot))) {
+                continue;
+            }
+            List cascading = m_slots[level][slot];
+            m_slots[level][slot] = List();
+            m_occupied[level] &= ~(uint64_t{1} << slot);
+            for (Handle* handle = cascading.head; handle;) {
+                Handle* nextHandle = handle->m_next;
+                insertLocked(handle);
+                handle = nextHandle;
+            }
+        }
+
+        // Everything in the current level 0 slot is due.
+        int slot = static_cast<int>(next & (SLOTS_PER_LEVEL - 1));
+        List& due = m_slots[0][slot];
+        if (due.head) {
+            for (Handle* handle = due.head; handle; handle = handle->m_next) {
+                handle->m_level = EXPIRED;
+            }
+            if (m_expired.tail) {
+                m_expired.tail->m_next = due.head;
+                due.head->m_prev = m_expired.tail;
+            } else {
+                m_expired.head = due.head;
+            }
+            m_expired.tail = due.tail;
+            due = List();
+            m_occupied[0] &= ~(uint64_t{1} << slot);
+        }
+    }
+}
+
+bool TimerService::isRunningElsewhereLocked(Handle* handle) const {
+    auto self = std::this_thread::get_id();
+    for (const auto& running : m_running) {
+        if (running.handle == handle && running.thread != self) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool TimerService::isRunningHereLocked(Handle* handle) const {
+    auto self = std::this_thread::get_id();
+    for (const auto& running : m_running) {
+        if (running.handle == handle && running.thread == self) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void TimerService::release(Handle* handle) {
+    cancel(handle);
+}
+
+void TimerService::runLocked(std::unique_lock<std::mutex>& lock, Handle* handle) {
+    unlinkLocked(handle);
+    --m_pendingCount;
+    auto callback = std::move(handle->m_callback);
+    handle->m_callback = nullptr;
+    m_running.push_back({handle, std::this_thread::get_id(), std::chrono::steady_clock::now()});
+    lock.unlock();
+
+    // The handle may be destroyed from here on, so it is only compared, never dereferenced.
+    if (callback) {
+        callback();
+    }
+    callback = nullptr;
+
+    lock.lock();
+    for (auto it = m_running.begin(); it != m_running.end(); ++it) {
+        if (it->handle == handle && it->thread == std::this_thread::get_id()) {
+            m_running.erase(it);
+            break;
+        }
+    }
+    for (Handle* deferred = m_deferred.head; deferred; deferred = deferred->m_next) {
+        if (deferred == handle) {
+            unlinkLocked(handle);
+            handle->m_level = EXPIRED;
+            append(&m_expired, handle);
+            break;
+        }
+    }
+    if (m_waitingForFollower) {
+        // This thread is about to become idle, or take a due callback off the leader's hands.
+        m_wakeCondition.notify_one();
+    }
+    m_callbackFinished.notify_all();
+}
+
+bool TimerService::startThreadLocked() {
+    // Exited threads released m_mutex for the last time as they returned from dispatchLoop(), so joining them here
+    // does not wait on anything this thread holds.
+    for (auto id : m_exitedThreads) {
+        for (auto it = m_threads.begin(); it != m_threads.end(); ++it) {
+            if (it->get_id() == id) {
+                it->join();
+                m_threads.erase(it);
+                break;
+            }
+        }
+    }
+    m_exitedThreads.clear();
+
+    try {
+        m_threads.emplace_back(&TimerService::dispatchLoop, this);
+    } catch (const std::system_error& error) {
+        ACSDK_ERROR(LX("startThreadFailed").d("reason", error.what()));
+        return false;
+    }
+    return true;
+}
+
+void TimerService::dispatchLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    bool leading = false;
+    // Whether this thread has just started or been woken, rather than returned from a callback.
+    bool idle = true;
+    while (!m_shutdown) {
+        if (!leading) {
+            if (m_leadershipOffered && idle) {
+                m_leadershipOffered = false;
+                leading = true;
+            } else if (m_hasLeader && m_expired.head && !isRunningElsewhereLocked(m_expired.head)) {
+                // Run due callbacks directly while the leader watches the wheel.  This avoids a hand-off per
+                // callback when they are due in quick succession.
+                runLocked(lock, m_expired.head);
+                idle = false;
+                continue;
+            } else if (m_leadershipOffered) {
+                m_leadershipOffered = false;
+                leading = true;
+            } else if (m_hasLeader) {
+                // Another thread is watching the wheel, so wait to take over from it.
+                ++m_idleFollowers;
+                auto status = m_followerCondition.wait_for(lock, m_idleThreadTimeout);
+                --m_idleFollowers;
+                idle = true;
+                if (std::cv_status::timeout == status && !m_leadershipOffered && m_idleFollowers > 0 && !m_shutdown) {
+                    // Another thread is idle as well, so this one is surplus.
+                    m_exitedThreads.push_back(std::this_thread::get_id());
+                    return;
+                }
+                continue;
+            } else {
+                m_hasLeader = true;
+                leading = true;
+            }
+        }
+
+        advanceLocked(toTickFloor(std::chrono::steady_clock::now()));
+
+        if (m_expired.head) {
+            Handle* handle = m_expired.head;
+            if (isRunningElsewhereLocked(handle)) {
+                // The previous callback on this handle is still running.  This one runs when it returns.
+                unlinkLocked(handle);
+                handle->m_level = DEFERRED;
+                append(&m_deferred, handle);
+                continue;
+            }
+
+            // Another thread must watch the wheel while this one runs the callback.  Rather than start a thread
+            // whenever the others are busy, wait for one of them unless a running callback looks blocked.
+            if (0 == m_idleFollowers && !m_running.empty()) {
+                auto oldest = m_running.front().started;
+                for (const auto& running : m_running) {
+                    oldest = std::min(oldest, running.started);
+                }
+                if (std::chrono::steady_clock::now() - oldest < BLOCKED_CALLBACK_THRESHOLD) {
+                    m_waitingForFollower = true;
+                    m_wakeCondition.wait_until(lock, oldest + BLOCKED_CALLBACK_THRESHOLD);
+                    m_waitingForFollower = false;
+                    continue;
+                }
+            }
+
+            // Leadership stays taken until the other thread claims it, so that threads returning from callbacks
+            // keep running due ones rather than each starting another thread.
+            leading = false;
+            m_leadershipOffered = true;
+            if (m_idleFollowers > 0) {
+                m_followerCondition.notify_one();
+            } else if (!startThreadLocked()) {
+                m_hasLeader = false;
+                m_leadershipOffered = false;
+            }
+            runLocked(lock, handle);
+            idle = false;
+            continue;
+        }
+
+        m_plannedWakeTick = nextEventTickLocked();
+        if (NO_TICK == m_plannedWakeTick) {
+            m_wakeCondition.wait(lock);
+        } else {
+            auto wakeTime = m_epoch + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                          m_tick * static_cast<int64_t>(m_plannedWakeTick));
+            m_wakeCondition.wait_until(lock, wakeTime);
+        }
+        // While awake, the loop picks up any new schedules itself, so schedule() need not notify.
+        m_plannedWakeTick = 0;
+    }
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
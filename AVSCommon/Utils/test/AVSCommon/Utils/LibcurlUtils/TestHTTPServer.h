@@ -0,0 +1,143 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_TEST_AVSCOMMON_UTILS_LIBCURLUTILS_TESTHTTPSERVER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_TEST_AVSCOMMON_UTILS_LIBCURLUTILS_TESTHTTPSERVER_H_
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+namespace test {
+
+/**
+ * A minimal HTTP/1.1 server on the loopback interface for tests which need real connections.  It answers GET
+ * requests with the responses of a handler, optionally after a delay, and keeps connections open between requests.
+ */
+class TestHTTPServer {
+public:
+    /// A response to a request.
+    struct Response {
+        /// The HTTP status code.
+        long statusCode;
+        /// The value of the Content-Type header.
+        std::string contentType;
+        /// The body.
+        std::string body;
+        /// How long to wait before responding.
+        std::chrono::milliseconds delay;
+    };
+
+    /// Produces the response to a request, given the path of the request.  Called on the connection's thread.
+    using Handler = std::function<Response(const std::string& path)>;
+
+    /**
+     * Constructor.  Starts listening on an ephemeral port.
+     *
+     * @param handler Produces the responses.
+     */
+    explicit TestHTTPServer(Handler handler);
+
+    /**
+     * Destructor.  Stops serving and closes all connections.
+     */
+    ~TestHTTPServer();
+
+    /**
+     * Get the URL of a path on this server.
+     *
+     * @param path The path, starting with '/'.
+     * @return The URL, or an empty string if the server failed to start.
+     */
+    std::string getURL(const std::string& path) const;
+
+    /**
+     * Get the number of connections accepted.
+     *
+     * @return The number of connections accepted.
+     */
+    int getConnectionCount() const;
+
+    /**
+     * Get the number of requests received.
+     *
+     * @return The number of requests received.
+     */
+    int getRequestCount() const;
+
+    /**
+     * Get the largest number of requests which were being answered at the same time.
+     *
+     * @return The largest number of requests which were being answered at the same time.
+     */
+    int getMaxConcurrentRequests() const;
+
+private:
+    /// Accepts connections until stopping.
+    void acceptLoop();
+
+    /**
+     * Answers the requests on a connection until it is closed or the server is stopping.
+     *
+     * @param connection The connected socket.
+     */
+    void serve(int connection);
+
+    /// Produces the responses.
+    Handler m_handler;
+
+    /// The listening socket.
+    int m_listenSocket;
+
+    /// The port listened on, or zero if the server failed to start.
+    uint16_t m_port;
+
+    /// Whether the server is stopping.
+    std::atomic<bool> m_isStopping;
+
+    /// The number of connections accepted.
+    std::atomic<int> m_connectionCount;
+
+    /// The number of requests received.
+    std::atomic<int> m_requestCount;
+
+    /// The number of requests being answered.
+    std::atomic<int> m_concurrentRequests;
+
+    /// The largest value of @c m_concurrentRequests.
+    std::atomic<int> m_maxConcurrentRequests;
+
+    /// Accepts connections.
+    std::thread m_acceptThread;
+
+    /// A thread per connection.  Only touched by @c m_acceptThread until it is joined.
+    std::vector<std::thread> m_connectionThreads;
+};
+
+}  // namespace test
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_TEST_AVSCOMMON_UTILS_LIBCURLUTILS_TESTHTTPSERVER_H_
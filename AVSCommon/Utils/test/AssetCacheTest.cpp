@@ -0,0 +1,334 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <dirent.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/File/AssetCache.h"
+#include "AVSCommon/Utils/LibcurlUtils/HTTPContentFetcherFactory.h"
+#include "AVSCommon/Utils/LibcurlUtils/TestHTTPServer.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace file {
+namespace test {
+
+using namespace avsCommon::utils::libcurlUtils;
+using namespace avsCommon::utils::libcurlUtils::test;
+
+/// The prefix of the directory of the cache of each test, which is followed by the name of the test.
+static const std::string CACHE_DIRECTORY_PREFIX = "AssetCacheTest.";
+
+/// The body of the asset at @c TONE_PATH, "abc".
+static const std::string TONE_BODY = "abc";
+
+/// The SHA-256 digest of @c TONE_BODY.
+static const std::string TONE_DIGEST = "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad";
+
+/// The name of an asset file which no URL in the index refers to.
+static const std::string ORPHAN_DIGEST = "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef";
+
+/// The name of a file which the cache did not create.
+static const std::string UNRELATED_FILE_NAME = "notes.txt";
+
+/// The path of an asset on the test server.
+static const std::string TONE_PATH = "/tone.mp3";
+
+/// The path of an asset on the test server with the same content as @c TONE_PATH.
+static const std::string SAME_TONE_PATH = "/copy-of-tone.mp3";
+
+/// The path on the test server which is not found.
+static const std::string MISSING_PATH = "/missing.mp3";
+
+/// The size of the large assets on the test server.
+static const size_t LARGE_ASSET_SIZE = 1000;
+
+/// The size of the cache of the eviction test, which holds two large assets.
+static const uint64_t SMALL_CACHE_SIZE = 2 * LARGE_ASSET_SIZE + 500;
+
+/// The size of the cache of the other tests.
+static const uint64_t CACHE_SIZE = 1024 * 1024;
+
+/// How long to wait for prefetches.
+static const std::chrono::seconds PREFETCH_TIMEOUT{5};
+
+/// The number of times the benchmark opens an asset.
+static const int BENCHMARK_OPENS = 100;
+
+/// The size of the asset of the benchmark.
+static const size_t BENCHMARK_ASSET_SIZE = 64 * 1024;
+
+/// The path of the asset of the benchmark.
+static const std::string BENCHMARK_PATH = "/benchmark.mp3";
+
+/**
+ * Answers the requests of the tests.  Paths starting with "/large" have a body of @c LARGE_ASSET_SIZE bytes made of
+ * their last character.
+ *
+ * @param path The path of the request.
+ * @return The response.
+ */
+static TestHTTPServer::Response respond(const std::string& path) {
+    if (TONE_PATH == path || SAME_TONE_PATH == path) {
+        return {200, "audio/mpeg", TONE_BODY, std::chrono::milliseconds::zero()};
+    }
+    if (BENCHMARK_PATH == path) {
+        return {200, "audio/mpeg", std::string(BENCHMARK_ASSET_SIZE, 'b'), std::chrono::milliseconds::zero()};
+    }
+    if (0 == path.compare(0, 6, "/large")) {
+        return {200, "audio/mpeg", std::string(LARGE_ASSET_SIZE, path.back()), std::chrono::milliseconds::zero()};
+    }
+    return {404, "text/plain", "not found", std::chrono::milliseconds::zero()};
+}
+
+/**
+ * Reads the whole of a stream.
+ *
+ * @param stream The stream.
+ * @return The content of the stream.
+ */
+static std::string readAll(std::unique_ptr<std::istream> stream) {
+    std::ostringstream content;
+    content << stream->rdbuf();
+    return content.str();
+}
+
+/**
+ * Test harness for @c AssetCache class.
+ */
+class AssetCacheTest : public ::testing::Test {
+public:
+    AssetCacheTest();
+
+    void SetUp() override;
+
+    void TearDown() override;
+
+protected:
+    /**
+     * Prefetches assets and waits for them to be cached.
+     *
+     * @param cache The cache.
+     * @param urls The URLs of the assets.
+     * @return Whether every asset was cached.
+     */
+    bool prefetch(std::shared_ptr<AssetCache> cache, const std::vector<std::string>& urls);
+
+    /// Removes the cache directory of the tests.
+    void removeCacheDirectory();
+
+    /// The directory of the cache, which is distinct for each test so that tests can be run in parallel.
+    const std::string m_directory;
+
+    /// The server of the assets.
+    TestHTTPServer m_server;
+
+    /// Produces the fetchers of the cache.
+    std::shared_ptr<HTTPContentFetcherFactory> m_contentFetcherFactory;
+
+    /// The cache under test.
+    std::shared_ptr<AssetCache> m_cache;
+};
+
+AssetCacheTest::AssetCacheTest() :
+        m_directory{CACHE_DIRECTORY_PREFIX + ::testing::UnitTest::GetInstance()->current_test_info()->name()},
+        m_server{respond},
+        m_contentFetcherFactory{std::make_shared<HTTPContentFetcherFactory>()} {
+}
+
+void AssetCacheTest::SetUp() {
+    ASSERT_FALSE(m_server.getURL(TONE_PATH).empty());
+    removeCacheDirectory();
+    m_cache = AssetCache::create(m_directory, CACHE_SIZE, m_contentFetcherFactory);
+    ASSERT_TRUE(m_cache);
+}
+
+void AssetCacheTest::TearDown() {
+    m_cache.reset();
+    removeCacheDirectory();
+}
+
+bool AssetCacheTest::prefetch(std::shared_ptr<AssetCache> cache, const std::vector<std::string>& urls) {
+    auto future = cache->prefetch(urls);
+    return std::future_status::ready == future.wait_for(PREFETCH_TIMEOUT) && future.get();
+}
+
+void AssetCacheTest::removeCacheDirectory() {
+    auto directory = opendir(m_directory.c_str());
+    if (directory) {
+        while (auto entry = readdir(directory)) {
+            std::remove((m_directory + "/" + entry->d_name).c_str());
+        }
+        closedir(directory);
+    }
+    std::remove(m_directory.c_str());
+}
+
+/// Verify that creating a cache fails with invalid parameters, and is skipped when it is not configured.
+TEST_F(AssetCacheTest, createWithInvalidParameters) {
+    EXPECT_FALSE(AssetCache::create("", CACHE_SIZE, m_contentFetcherFactory));
+    EXPECT_FALSE(AssetCache::create(m_directory, 0, m_contentFetcherFactory));
+    EXPECT_FALSE(AssetCache::create(m_directory, CACHE_SIZE, nullptr));
+    EXPECT_FALSE(AssetCache::create("missingParent/cache", CACHE_SIZE, m_contentFetcherFactory));
+    EXPECT_FALSE(AssetCache::create(configuration::ConfigurationNode(), m_contentFetcherFactory));
+}
+
+/// Verify that a prefetched asset is opened from the cache, named after its digest, and counted as a hit.
+TEST_F(AssetCacheTest, prefetchThenOpen) {
+    auto url = m_server.getURL(TONE_PATH);
+    EXPECT_FALSE(m_cache->open(url));
+    ASSERT_TRUE(prefetch(m_cache, {url}));
+    EXPECT_EQ(1, m_server.getRequestCount());
+
+    auto stream = m_cache->open(url);
+    ASSERT_TRUE(stream);
+    EXPECT_EQ(TONE_BODY, readAll(std::move(stream)));
+    EXPECT_TRUE(std::ifstream(m_directory + "/" + TONE_DIGEST).good());
+
+    // A cached asset is not fetched again.
+    ASSERT_TRUE(prefetch(m_cache, {url}));
+    EXPECT_EQ(1, m_server.getRequestCount());
+
+    auto statistics = m_cache->getStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+    EXPECT_EQ(1u, statistics.fetches);
+    EXPECT_EQ(1u, statistics.entryCount);
+    EXPECT_EQ(TONE_BODY.size(), statistics.sizeInBytes);
+}
+
+/// Verify that assets which cannot be fetched, or are not on the network, are not cached.
+TEST_F(AssetCacheTest, failedFetchesAreNotCached) {
+    auto missingUrl = m_server.getURL(MISSING_PATH);
+    EXPECT_FALSE(prefetch(m_cache, {missingUrl, "file:///tmp/tone.mp3"}));
+    EXPECT_FALSE(m_cache->open(missingUrl));
+
+    auto statistics = m_cache->getStatistics();
+    EXPECT_EQ(1u, statistics.fetchFailures);
+    EXPECT_EQ(0u, statistics.entryCount);
+}
+
+/// Verify that URLs with the same content share one file.
+TEST_F(AssetCacheTest, sameContentIsStoredOnce) {
+    auto url = m_server.getURL(TONE_PATH);
+    auto sameUrl = m_server.getURL(SAME_TONE_PATH);
+    ASSERT_TRUE(prefetch(m_cache, {url, sameUrl}));
+
+    auto statistics = m_cache->getStatistics();
+    EXPECT_EQ(2u, statistics.entryCount);
+    EXPECT_EQ(TONE_BODY.size(), statistics.sizeInBytes);
+
+    EXPECT_EQ(TONE_BODY, readAll(m_cache->open(sameUrl)));
+    m_cache->clear();
+    EXPECT_FALSE(std::ifstream(m_directory + "/" + TONE_DIGEST).good());
+}
+
+/// Verify that the least recently used assets are evicted to keep the cache within its size.
+TEST_F(AssetCacheTest, evictsLeastRecentlyUsed) {
+    m_cache = AssetCache::create(m_directory, SMALL_CACHE_SIZE, m_contentFetcherFactory);
+    ASSERT_TRUE(m_cache);
+    auto urlA = m_server.getURL("/largeA");
+    auto urlB = m_server.getURL("/largeB");
+    auto urlC = m_server.getURL("/largeC");
+
+    ASSERT_TRUE(prefetch(m_cache, {urlA, urlB}));
+    ASSERT_TRUE(m_cache->open(urlA));
+    ASSERT_TRUE(prefetch(m_cache, {urlC}));
+
+    EXPECT_TRUE(m_cache->open(urlA));
+    EXPECT_FALSE(m_cache->open(urlB));
+    EXPECT_EQ(std::string(LARGE_ASSET_SIZE, 'C'), readAll(m_cache->open(urlC)));
+
+    auto statistics = m_cache->getStatistics();
+    EXPECT_EQ(1u, statistics.evictions);
+    EXPECT_EQ(2 * LARGE_ASSET_SIZE, statistics.sizeInBytes);
+}
+
+/// Verify that a corrupt asset is dropped when it is opened, and fetched again.
+TEST_F(AssetCacheTest, corruptAssetIsDropped) {
+    auto url = m_server.getURL(TONE_PATH);
+    ASSERT_TRUE(prefetch(m_cache, {url}));
+    std::ofstream(m_directory + "/" + TONE_DIGEST, std::ios::trunc) << "abd";
+
+    EXPECT_FALSE(m_cache->open(url));
+    EXPECT_EQ(1u, m_cache->getStatistics().integrityFailures);
+
+    ASSERT_TRUE(prefetch(m_cache, {url}));
+    EXPECT_EQ(TONE_BODY, readAll(m_cache->open(url)));
+}
+
+/// Verify that assets stay cached across restarts, so that they can be played when the network is down.
+TEST_F(AssetCacheTest, persistsAcrossRestarts) {
+    auto url = m_server.getURL(TONE_PATH);
+    ASSERT_TRUE(prefetch(m_cache, {url}));
+    auto orphanPath = m_directory + "/" + ORPHAN_DIGEST;
+    std::ofstream(orphanPath) << "left behind";
+
+    m_cache = AssetCache::create(m_directory, CACHE_SIZE, m_contentFetcherFactory);
+    ASSERT_TRUE(m_cache);
+    EXPECT_EQ(TONE_BODY, readAll(m_cache->open(url)));
+    EXPECT_EQ(1, m_server.getRequestCount());
+    EXPECT_FALSE(std::ifstream(orphanPath).good());
+}
+
+/// Verify that files in the cache directory which the cache did not create are left alone.
+TEST_F(AssetCacheTest, keepsUnrelatedFiles) {
+    m_cache.reset();
+    auto unrelatedPaths = {m_directory + "/" + UNRELATED_FILE_NAME, m_directory + "/" + ORPHAN_DIGEST + ".mp3"};
+    for (auto& path : unrelatedPaths) {
+        std::ofstream(path) << "user data";
+    }
+
+    m_cache = AssetCache::create(m_directory, CACHE_SIZE, m_contentFetcherFactory);
+    ASSERT_TRUE(m_cache);
+    for (auto& path : unrelatedPaths) {
+        EXPECT_TRUE(std::ifstream(path).good());
+    }
+}
+
+/// Compare the time to get an asset from the cache with the time to fetch it from a server on the loopback interface.
+/// Both are recorded as test properties.  Disabled by default.
+TEST_F(AssetCacheTest, DISABLED_benchmarkOpenAgainstFetch) {
+    auto url = m_server.getURL(BENCHMARK_PATH);
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(prefetch(m_cache, {url}));
+    auto fetchElapsed = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCHMARK_OPENS; ++i) {
+        ASSERT_TRUE(m_cache->open(url));
+    }
+    auto openElapsed = (std::chrono::steady_clock::now() - start) / BENCHMARK_OPENS;
+
+    RecordProperty(
+        "loopbackFetchUs", std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(fetchElapsed).count()));
+    RecordProperty(
+        "verifiedOpenUs", std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(openElapsed).count()));
+}
+
+}  // namespace test
+}  // namespace file
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
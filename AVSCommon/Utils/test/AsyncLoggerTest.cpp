@@ -0,0 +1,337 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Logger/AsyncLogger.h"
+#include "AVSCommon/Utils/Logger/LogStringFormatter.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+namespace test {
+
+/// Number of threads logging concurrently.
+static const int PRODUCER_THREADS = 4;
+
+/// Number of entries logged by each thread.
+static const int ENTRIES_PER_THREAD = 500;
+
+/// A small ring, so that producers catch up with the background thread.
+static const size_t SMALL_CAPACITY = 16;
+
+/// Number of entries logged while the output is blocked.
+static const int BLOCKED_ENTRIES = 200;
+
+/// How long output stays blocked.
+static const std::chrono::milliseconds BLOCKED_DURATION{100};
+
+/// Number of entries logged by the benchmark.
+static const int BENCHMARK_ENTRIES = 20000;
+
+/// Text of the entries logged by the benchmark, which is about the length of a typical SDK log line.
+static const std::string BENCHMARK_TEXT =
+    "DirectiveSequencer:onDirective:directive={namespace:SpeechSynthesizer,name:Speak,messageId:0123456789abcdef}";
+
+/// Marker logged when entries are dropped.
+static const std::string DROPPED_MARKER = "AsyncLogger:droppedEntries:count=";
+
+/// Test harness which captures what an @c AsyncLogger writes to a pipe.
+class AsyncLoggerTest : public ::testing::Test {
+protected:
+    void SetUp() override;
+    void TearDown() override;
+
+    /// Fills the pipe so that the background thread blocks writing to it.
+    void blockOutput();
+
+    /// Starts reading the pipe.
+    void startReading();
+
+    /**
+     * Destroys @c m_logger, closes the write end of the pipe and returns everything written.
+     *
+     * @return The text written by @c m_logger.
+     */
+    std::string finish();
+
+    /**
+     * Logs an entry.
+     *
+     * @param text The text of the entry.
+     */
+    void log(const std::string& text);
+
+    /// The read and write ends of the pipe.
+    int m_pipe[2];
+
+    /// Reads the pipe.
+    std::thread m_reader;
+
+    /// Everything read from the pipe.
+    std::string m_output;
+
+    /// The @c AsyncLogger under test.
+    std::shared_ptr<AsyncLogger> m_logger;
+};
+
+void AsyncLoggerTest::SetUp() {
+    ASSERT_EQ(0, pipe(m_pipe));
+}
+
+void AsyncLoggerTest::TearDown() {
+    if (m_reader.joinable()) {
+        finish();
+    }
+    close(m_pipe[0]);
+    if (m_pipe[1] >= 0) {
+        close(m_pipe[1]);
+    }
+}
+
+void AsyncLoggerTest::blockOutput() {
+    int flags = fcntl(m_pipe[1], F_GETFL);
+    fcntl(m_pipe[1], F_SETFL, flags | O_NONBLOCK);
+    std::string filler(4096, ' ');
+    while (write(m_pipe[1], filler.data(), filler.size()) > 0) {
+    }
+    // The last partial write may have left room for less than one page; fill that too.
+    while (write(m_pipe[1], filler.data(), 1) > 0) {
+    }
+    fcntl(m_pipe[1], F_SETFL, flags);
+}
+
+void AsyncLoggerTest::startReading() {
+    m_reader = std::thread([this] {
+        char buffer[4096];
+        ssize_t result;
+        while ((result = read(m_pipe[0], buffer, sizeof(buffer))) > 0) {
+            m_output.append(buffer, static_cast<size_t>(result));
+        }
+    });
+}
+
+std::string AsyncLoggerTest::finish() {
+    m_logger.reset();
+    close(m_pipe[1]);
+    m_pipe[1] = -1;
+    if (m_reader.joinable()) {
+        m_reader.join();
+    }
+    // Drop any filler written by blockOutput().
+    auto start = m_output.find_first_not_of(' ');
+    return std::string::npos == start ? std::string() : m_output.substr(start);
+}
+
+void AsyncLoggerTest::log(const std::string& text) {
+    m_logger->emit(Level::INFO, std::chrono::system_clock::now(), "test", text.c_str());
+}
+
+/**
+ * Verify that entries from several threads are all written, each on its own line, and in order for each thread.
+ */
+TEST_F(AsyncLoggerTest, writesAllEntriesInOrder) {
+    m_logger = AsyncLogger::create(m_pipe[1], SMALL_CAPACITY, AsyncLogger::OverflowPolicy::BLOCK);
+    ASSERT_TRUE(m_logger);
+    startReading();
+
+    std::vector<std::thread> producers;
+    for (int thread = 0; thread < PRODUCER_THREADS; ++thread) {
+        producers.push_back(std::thread([this, thread] {
+            for (int i = 0; i < ENTRIES_PER_THREAD; ++i) {
+                log("producer" + std::to_string(thread) + ":" + std::to_string(i));
+            }
+        }));
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    std::istringstream lines(finish());
+    std::vector<int> next(PRODUCER_THREADS, 0);
+    std::string line;
+    while (std::getline(lines, line)) {
+        auto position = line.find("producer");
+        ASSERT_NE(std::string::npos, position) << line;
+        int thread = 0;
+        int i = 0;
+        ASSERT_EQ(2, sscanf(line.c_str() + position, "producer%d:%d", &thread, &i)) << line;
+        ASSERT_GE(thread, 0);
+        ASSERT_LT(thread, PRODUCER_THREADS);
+        EXPECT_EQ(next[thread], i);
+        next[thread] = i + 1;
+    }
+    for (int thread = 0; thread < PRODUCER_THREADS; ++thread) {
+        EXPECT_EQ(ENTRIES_PER_THREAD, next[thread]);
+    }
+}
+
+/**
+ * Verify that with @c OverflowPolicy::DROP, logging does not wait for blocked output, and the number of entries
+ * dropped is logged.
+ */
+TEST_F(AsyncLoggerTest, dropPolicyReportsDroppedEntries) {
+    m_logger = AsyncLogger::create(m_pipe[1], SMALL_CAPACITY, AsyncLogger::OverflowPolicy::DROP);
+    ASSERT_TRUE(m_logger);
+    blockOutput();
+
+    for (int i = 0; i < BLOCKED_ENTRIES; ++i) {
+        log("entry" + std::to_string(i));
+    }
+    startReading();
+
+    std::istringstream lines(finish());
+    int written = 0;
+    int dropped = 0;
+    std::string line;
+    while (std::getline(lines, line)) {
+        auto position = line.find(DROPPED_MARKER);
+        if (std::string::npos == position) {
+            ++written;
+        } else {
+            dropped += std::stoi(line.substr(position + DROPPED_MARKER.size()));
+        }
+    }
+    EXPECT_GT(dropped, 0);
+    EXPECT_EQ(BLOCKED_ENTRIES, written + dropped);
+}
+
+/**
+ * Verify that with @c OverflowPolicy::BLOCK, logging waits for blocked output and nothing is dropped.
+ */
+TEST_F(AsyncLoggerTest, blockPolicyWritesEveryEntry) {
+    m_logger = AsyncLogger::create(m_pipe[1], SMALL_CAPACITY, AsyncLogger::OverflowPolicy::BLOCK);
+    ASSERT_TRUE(m_logger);
+    blockOutput();
+
+    std::thread producer([this] {
+        for (int i = 0; i < BLOCKED_ENTRIES; ++i) {
+            log("entry" + std::to_string(i));
+        }
+    });
+    std::this_thread::sleep_for(BLOCKED_DURATION);
+    startReading();
+    producer.join();
+
+    auto output = finish();
+    EXPECT_EQ(std::string::npos, output.find(DROPPED_MARKER));
+    EXPECT_EQ(BLOCKED_ENTRIES, std::count(output.begin(), output.end(), '\n'));
+}
+
+/**
+ * Verify that @c create() rejects invalid parameters.
+ */
+TEST_F(AsyncLoggerTest, createWithInvalidParameters) {
+    EXPECT_FALSE(AsyncLogger::create(-1, SMALL_CAPACITY, AsyncLogger::OverflowPolicy::DROP));
+    EXPECT_FALSE(AsyncLogger::create(m_pipe[1], 0, AsyncLogger::OverflowPolicy::DROP));
+}
+
+/**
+ * Verify that the @c instance() @c AsyncLogger is a single shared instance, and that everything it has been given is
+ * written when the process exits normally.
+ */
+TEST_F(AsyncLoggerTest, instanceWritesEverythingAtExit) {
+    ::testing::FLAGS_gtest_death_test_style = "fast";
+    startReading();
+    EXPECT_EXIT(
+        {
+            // The instance writes to standard output, so send that to the pipe.
+            dup2(m_pipe[1], STDOUT_FILENO);
+            auto logger = AsyncLogger::instance();
+            if (!logger || logger != AsyncLogger::instance() || !std::dynamic_pointer_cast<AsyncLogger>(logger)) {
+                std::exit(1);
+            }
+            for (int i = 0; i < ENTRIES_PER_THREAD; ++i) {
+                logger->emit(
+                    Level::INFO, std::chrono::system_clock::now(), "test", ("entry" + std::to_string(i)).c_str());
+            }
+            std::exit(0);
+        },
+        ::testing::ExitedWithCode(0),
+        "");
+
+    auto output = finish();
+    EXPECT_NE(std::string::npos, output.find("sdkVersion: "));
+    for (int i = 0; i < ENTRIES_PER_THREAD; ++i) {
+        EXPECT_NE(std::string::npos, output.find("entry" + std::to_string(i) + "\n")) << i;
+    }
+}
+
+/**
+ * Compare the time the logging thread spends in @c emit() when formatting and writing synchronously (as
+ * @c ConsoleLogger does) with @c AsyncLogger.  Both write to /dev/null.  The latencies are recorded as test
+ * properties.  This is disabled by default.
+ */
+TEST_F(AsyncLoggerTest, DISABLED_benchmarkEmitLatency) {
+    int devNull = open("/dev/null", O_WRONLY);
+    ASSERT_GE(devNull, 0);
+
+    auto report = [](const std::string& label, std::vector<std::chrono::nanoseconds>& samples) {
+        std::sort(samples.begin(), samples.end());
+        std::chrono::nanoseconds total{0};
+        for (auto sample : samples) {
+            total += sample;
+        }
+        RecordProperty(label + "MeanNs", std::to_string(total.count() / samples.size()));
+        RecordProperty(label + "P99Ns", std::to_string(samples[samples.size() * 99 / 100].count()));
+        RecordProperty(label + "MaxNs", std::to_string(samples.back().count()));
+    };
+    std::vector<std::chrono::nanoseconds> samples(BENCHMARK_ENTRIES);
+
+    LogStringFormatter formatter;
+    std::mutex mutex;
+    for (int i = 0; i < BENCHMARK_ENTRIES; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto line = formatter.format(Level::INFO, std::chrono::system_clock::now(), "test", BENCHMARK_TEXT.c_str());
+            line.push_back('\n');
+            EXPECT_GT(write(devNull, line.data(), line.size()), 0);
+        }
+        samples[i] = std::chrono::steady_clock::now() - start;
+    }
+    report("synchronous", samples);
+
+    m_logger = AsyncLogger::create(devNull, BENCHMARK_ENTRIES, AsyncLogger::OverflowPolicy::BLOCK);
+    ASSERT_TRUE(m_logger);
+    for (int i = 0; i < BENCHMARK_ENTRIES; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        m_logger->emit(Level::INFO, std::chrono::system_clock::now(), "test", BENCHMARK_TEXT.c_str());
+        samples[i] = std::chrono::steady_clock::now() - start;
+    }
+    report("AsyncLogger", samples);
+
+    m_logger.reset();
+    close(devNull);
+}
+
+}  // namespace test
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,167 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file TestHTTPServer.cpp
+
+#include "AVSCommon/Utils/LibcurlUtils/TestHTTPServer.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <sstream>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+namespace test {
+
+/// How long to wait for a socket before checking whether the server is stopping.
+static const std::chrono::milliseconds POLL_TIMEOUT(20);
+
+/// The end of the headers of a request.
+static const std::string END_OF_HEADERS = "\r\n\r\n";
+
+/**
+ * Sleep until a delay has passed or the server is stopping.
+ *
+ * @param delay How long to sleep.
+ * @param isStopping Whether the server is stopping.
+ */
+static void sleepUnlessStopping(std::chrono::milliseconds delay, const std::atomic<bool>& isStopping) {
+    auto deadline = std::chrono::steady_clock::now() + delay;
+    while (!isStopping && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::min(POLL_TIMEOUT, delay));
+    }
+}
+
+TestHTTPServer::TestHTTPServer(Handler handler) :
+        m_handler{std::move(handler)},
+        m_listenSocket{-1},
+        m_port{0},
+        m_isStopping{false},
+        m_connectionCount{0},
+        m_requestCount{0},
+        m_concurrentRequests{0},
+        m_maxConcurrentRequests{0} {
+    m_listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t length = sizeof(address);
+    if (m_listenSocket < 0 || bind(m_listenSocket, reinterpret_cast<sockaddr*>(&address), length) != 0 ||
+        listen(m_listenSocket, SOMAXCONN) != 0 ||
+        getsockname(m_listenSocket, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+        return;
+    }
+    m_port = ntohs(address.sin_port);
+    m_acceptThread = std::thread(&TestHTTPServer::acceptLoop, this);
+}
+
+TestHTTPServer::~TestHTTPServer() {
+    m_isStopping = true;
+    if (m_acceptThread.joinable()) {
+        m_acceptThread.join();
+    }
+    for (auto& thread : m_connectionThreads) {
+        thread.join();
+    }
+    if (m_listenSocket >= 0) {
+        close(m_listenSocket);
+    }
+}
+
+std::string TestHTTPServer::getURL(const std::string& path) const {
+    return m_port ? "http://127.0.0.1:" + std::to_string(m_port) + path : "";
+}
+
+int TestHTTPServer::getConnectionCount() const {
+    return m_connectionCount;
+}
+
+int TestHTTPServer::getRequestCount() const {
+    return m_requestCount;
+}
+
+int TestHTTPServer::getMaxConcurrentRequests() const {
+    return m_maxConcurrentRequests;
+}
+
+void TestHTTPServer::acceptLoop() {
+    while (!m_isStopping) {
+        pollfd listenPoll = {m_listenSocket, POLLIN, 0};
+        if (poll(&listenPoll, 1, POLL_TIMEOUT.count()) <= 0) {
+            continue;
+        }
+        int connection = accept(m_listenSocket, nullptr, nullptr);
+        if (connection < 0) {
+            continue;
+        }
+        ++m_connectionCount;
+        m_connectionThreads.push_back(std::thread(&TestHTTPServer::serve, this, connection));
+    }
+}
+
+void TestHTTPServer::serve(int connection) {
+    std::string received;
+    char buffer[4096];
+    bool isOpen = true;
+    while (isOpen && !m_isStopping) {
+        pollfd connectionPoll = {connection, POLLIN, 0};
+        if (poll(&connectionPoll, 1, POLL_TIMEOUT.count()) <= 0) {
+            continue;
+        }
+        auto count = recv(connection, buffer, sizeof(buffer), 0);
+        if (count <= 0) {
+            break;
+        }
+        received.append(buffer, count);
+        size_t headersEnd;
+        while (isOpen && (headersEnd = received.find(END_OF_HEADERS)) != std::string::npos) {
+            // The request line is "GET <path> HTTP/1.1".
+            std::istringstream requestLine(received.substr(0, received.find("\r\n")));
+            std::string method;
+            std::string path;
+            requestLine >> method >> path;
+            received.erase(0, headersEnd + END_OF_HEADERS.size());
+
+            ++m_requestCount;
+            auto concurrent = ++m_concurrentRequests;
+            auto max = m_maxConcurrentRequests.load();
+            while (concurrent > max && !m_maxConcurrentRequests.compare_exchange_weak(max, concurrent)) {
+            }
+            auto response = m_handler(path);
+            sleepUnlessStopping(response.delay, m_isStopping);
+            std::string message = "HTTP/1.1 " + std::to_string(response.statusCode) +
+                                  " Test\r\nContent-Type: " + response.contentType +
+                                  "\r\nContent-Length: " + std::to_string(response.body.size()) + "\r\n\r\n" +
+                                  response.body;
+            isOpen = send(connection, message.data(), message.size(), MSG_NOSIGNAL) ==
+                     static_cast<ssize_t>(message.size());
+            --m_concurrentRequests;
+        }
+    }
+    close(connection);
+}
+
+}  // namespace test
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,262 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <fstream>
+#include <limits>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ExecutorTestUtils.h"
+#include "AVSCommon/Utils/Memory/Memory.h"
+#include "AVSCommon/Utils/Threading/Executor.h"
+#include "AVSCommon/Utils/Threading/ExecutorPool.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+namespace test {
+
+/// Number of worker threads in the pool used by the tests.
+static const size_t NUM_THREADS = 4;
+
+/// Number of tasks submitted per @c Executor in the ordering tests.
+static const int TASKS_PER_EXECUTOR = 1000;
+
+/// Timeout used when waiting for things which are expected to happen.
+static const std::chrono::seconds LONG_TIMEOUT{5};
+
+/// Number of @c Executors created by the resource benchmark, roughly the number created by a @c DefaultClient.
+static const size_t BENCHMARK_EXECUTORS = 40;
+
+/**
+ * Reads a field from /proc/self/status.
+ *
+ * @param field The name of the field, including the trailing ':'.
+ * @return The numeric value of the field, or 0 if it is not available.
+ */
+static size_t readProcStatus(const std::string& field) {
+    std::ifstream status("/proc/self/status");
+    std::string name;
+    while (status >> name) {
+        if (name == field) {
+            size_t value = 0;
+            status >> value;
+            return value;
+        }
+        status.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    return 0;
+}
+
+/// The test harness for the tests below.
+class ExecutorPoolTest : public ::testing::Test {
+public:
+    /// Constructor.
+    ExecutorPoolTest() : pool{ExecutorPool::create(NUM_THREADS)} {
+    }
+
+    /// The pool under test.
+    std::shared_ptr<ExecutorPool> pool;
+};
+
+/// Verify that a pool can't be created without threads.
+TEST_F(ExecutorPoolTest, createWithoutThreadsFails) {
+    ASSERT_FALSE(ExecutorPool::create(0));
+    ASSERT_TRUE(pool);
+    ASSERT_EQ(pool->getNumThreads(), NUM_THREADS);
+}
+
+/// Verify that tasks submitted to each of several Executors on a pool run in order, and one at a time.
+TEST_F(ExecutorPoolTest, tasksRunInOrderPerExecutor) {
+    std::vector<std::unique_ptr<Executor>> executors;
+    std::vector<std::vector<int>> results(NUM_THREADS * 2);
+    std::vector<std::unique_ptr<std::atomic<int>>> running;
+    std::atomic<bool> overlapped(false);
+    for (size_t i = 0; i < results.size(); ++i) {
+        executors.push_back(memory::make_unique<Executor>(pool));
+        running.push_back(memory::make_unique<std::atomic<int>>(0));
+    }
+    for (int task = 0; task < TASKS_PER_EXECUTOR; ++task) {
+        for (size_t i = 0; i < executors.size(); ++i) {
+            auto& result = results[i];
+            auto& count = *running[i];
+            executors[i]->submit([&result, &count, &overlapped, task] {
+                if (++count != 1) {
+                    overlapped = true;
+                }
+                result.push_back(task);
+                --count;
+            });
+        }
+    }
+    for (auto& executor : executors) {
+        executor->waitForSubmittedTasks();
+    }
+    EXPECT_FALSE(overlapped);
+    for (auto& result : results) {
+        ASSERT_EQ(result.size(), static_cast<size_t>(TASKS_PER_EXECUTOR));
+        for (int task = 0; task < TASKS_PER_EXECUTOR; ++task) {
+            ASSERT_EQ(result[task], task);
+        }
+    }
+}
+
+/// Verify that tasks on different Executors run concurrently on the pool's threads.
+TEST_F(ExecutorPoolTest, executorsRunConcurrently) {
+    std::vector<std::unique_ptr<Executor>> executors;
+    std::atomic<size_t> arrived(0);
+    std::vector<std::future<bool>> results;
+    for (size_t i = 0; i < NUM_THREADS; ++i) {
+        executors.push_back(memory::make_unique<Executor>(pool));
+        results.push_back(executors.back()->submit([&arrived] {
+            // Every task waits for all the others, which only succeeds if they are all running at once.
+            ++arrived;
+            auto deadline = std::chrono::steady_clock::now() + LONG_TIMEOUT;
+            while (arrived < NUM_THREADS && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::yield();
+            }
+            return arrived == NUM_THREADS;
+        }));
+    }
+    for (auto& result : results) {
+        EXPECT_TRUE(result.get());
+    }
+}
+
+/// Verify that @c submitToFront() works on a pool.
+TEST_F(ExecutorPoolTest, submitToFront) {
+    Executor executor(pool);
+    std::atomic<bool> ready(false);
+    std::atomic<bool> blocked(false);
+    std::list<int> order;
+
+    executor.submit([&] {
+        blocked = true;
+        while (!ready) {
+            std::this_thread::yield();
+        }
+    });
+    while (!blocked) {
+        std::this_thread::yield();
+    }
+    executor.submit([&] { order.push_back(1); });
+    executor.submit([&] { order.push_back(2); });
+    executor.submitToFront([&] { order.push_back(3); });
+    ready = true;
+    executor.waitForSubmittedTasks();
+
+    ASSERT_EQ(order.size(), 3U);
+    ASSERT_EQ(order.front(), 3);
+    ASSERT_EQ(order.back(), 2);
+}
+
+/// Verify that shutting down an Executor on a pool waits for the running task and rejects new ones.
+TEST_F(ExecutorPoolTest, shutdownWaitsForRunningTask) {
+    Executor executor(pool);
+    std::atomic<bool> blocked(false);
+    std::atomic<bool> finished(false);
+
+    executor.submit([&] {
+        blocked = true;
+        std::this_thread::sleep_for(SHORT_TIMEOUT_MS);
+        finished = true;
+    });
+    while (!blocked) {
+        std::this_thread::yield();
+    }
+    executor.shutdown();
+    EXPECT_TRUE(finished);
+    EXPECT_TRUE(executor.isShutdown());
+    EXPECT_FALSE(executor.submit([] {}).valid());
+}
+
+/// Verify that an Executor on a pool can be shut down by one of its own tasks.
+TEST_F(ExecutorPoolTest, shutdownFromOwnTask) {
+    Executor executor(pool);
+    auto done = executor.submit([&executor] { executor.shutdown(); });
+    ASSERT_EQ(done.wait_for(LONG_TIMEOUT), std::future_status::ready);
+    EXPECT_TRUE(executor.isShutdown());
+}
+
+/// Verify that the pool survives having its last reference released by one of its own tasks.
+TEST_F(ExecutorPoolTest, lastReferenceReleasedByTask) {
+    auto executor = std::make_shared<Executor>(pool);
+    pool.reset();
+    std::promise<void> released;
+    auto releasedFuture = released.get_future();
+    // The task owns the only reference to the executor, which owns the only reference to the pool.
+    executor->submit([executor, &released] { released.set_value(); });
+    executor.reset();
+    ASSERT_EQ(releasedFuture.wait_for(LONG_TIMEOUT), std::future_status::ready);
+}
+
+/// Verify that default-constructed Executors use the pool set by @c ExecutorPool::ScopedDefault.
+TEST_F(ExecutorPoolTest, scopedDefault) {
+    EXPECT_FALSE(ExecutorPool::getDefault());
+    {
+        ExecutorPool::ScopedDefault scopedDefault(pool);
+        EXPECT_EQ(ExecutorPool::getDefault(), pool);
+        {
+            ExecutorPool::ScopedDefault nested(nullptr);
+            EXPECT_FALSE(ExecutorPool::getDefault());
+        }
+        EXPECT_EQ(ExecutorPool::getDefault(), pool);
+    }
+    EXPECT_FALSE(ExecutorPool::getDefault());
+}
+
+/**
+ * Compare the threads and memory used by @c BENCHMARK_EXECUTORS Executors with their own threads and the same number
+ * on a pool, and record them as test properties.  Disabled by default, since the numbers depend on the whole process.
+ */
+TEST_F(ExecutorPoolTest, DISABLED_benchmarkThreadsAndMemory) {
+    auto measure = [](std::shared_ptr<ExecutorPool> executorPool, const std::string& label) {
+        auto baseThreads = readProcStatus("Threads:");
+        auto baseRss = readProcStatus("VmRSS:");
+        {
+            std::vector<std::unique_ptr<Executor>> executors;
+            for (size_t i = 0; i < BENCHMARK_EXECUTORS; ++i) {
+                executors.push_back(memory::make_unique<Executor>(executorPool));
+                // Run a task so that every thread has touched its stack.
+                executors.back()->submit([] {
+                    volatile char scratch[4096];
+                    scratch[0] = 0;
+                    (void)scratch[0];
+                });
+            }
+            for (auto& executor : executors) {
+                executor->waitForSubmittedTasks();
+            }
+            RecordProperty(label + "ExtraThreads", std::to_string(readProcStatus("Threads:") - baseThreads));
+            RecordProperty(
+                label + "ExtraRssKb",
+                std::to_string(static_cast<long>(readProcStatus("VmRSS:")) - static_cast<long>(baseRss)));
+        }
+    };
+    RecordProperty("poolThreads", std::to_string(pool->getNumThreads()));
+    measure(nullptr, "dedicatedThreads");
+    measure(pool, "pool");
+}
+
+}  // namespace test
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -14,6 +14,7 @@
  */
 
 #include <list>
+#include <string>
 #include <gtest/gtest.h>
 
 #include "ExecutorTestUtils.h"
@@ -25,6 +26,9 @@ namespace utils {
 namespace threading {
 namespace test {
 
+/// Number of tasks run by the submission benchmarks.
+static const int BENCHMARK_TASKS = 200000;
+
 class ExecutorTest : public ::testing::Test {
 public:
     Executor executor;
@@ -247,6 +251,41 @@ TEST_F(ExecutorTest, shutdown) {
     ASSERT_FALSE(rejected.valid());
 }
 
+/// This test verifies that tasks submitted with submitDetached() run in order with other tasks.
+TEST_F(ExecutorTest, submitDetached) {
+    std::list<int> order;
+    ASSERT_TRUE(executor.submitDetached([&order] { order.push_back(1); }));
+    executor.submit([&order] { order.push_back(2); });
+    ASSERT_TRUE(executor.submitDetached([&order] { order.push_back(3); }));
+    executor.waitForSubmittedTasks();
+    ASSERT_EQ(order, std::list<int>({1, 2, 3}));
+
+    executor.shutdown();
+    ASSERT_FALSE(executor.submitDetached([] {}));
+}
+
+/**
+ * This test compares the rate at which tasks can be run with submit() and submitDetached(), and records the rates as
+ * test properties.  It is disabled by default.
+ */
+TEST_F(ExecutorTest, DISABLED_benchmarkSubmitVsSubmitDetached) {
+    auto measure = [](const std::string& label, std::function<void(Executor&, int&)> submitTask) {
+        Executor benchmarkExecutor;
+        int counter = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < BENCHMARK_TASKS; ++i) {
+            submitTask(benchmarkExecutor, counter);
+        }
+        benchmarkExecutor.waitForSubmittedTasks();
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        EXPECT_EQ(counter, BENCHMARK_TASKS);
+        RecordProperty(label + "TasksPerSecond", std::to_string(static_cast<long>(BENCHMARK_TASKS / elapsed)));
+    };
+    measure("submit", [](Executor& executor, int& counter) { executor.submit([&counter] { ++counter; }); });
+    measure(
+        "submitDetached", [](Executor& executor, int& counter) { executor.submitDetached([&counter] { ++counter; }); });
+}
+
 }  // namespace test
 }  // namespace threading
 }  // namespace utils
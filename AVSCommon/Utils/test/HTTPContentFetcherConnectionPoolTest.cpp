@@ -0,0 +1,193 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/LibcurlUtils/HTTPContentFetcherConnectionPool.h"
+#include "AVSCommon/Utils/LibcurlUtils/LibCurlHttpContentFetcher.h"
+#include "AVSCommon/Utils/LibcurlUtils/TestHTTPServer.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+namespace test {
+
+using namespace avsCommon::sdkInterfaces;
+
+/// A URL on the first test origin.
+static const std::string URL_A = "http://example.com/playlist.m3u8";
+
+/// Another URL on the first test origin.
+static const std::string URL_A_OTHER_PATH = "HTTP://Example.COM/segment1.ts";
+
+/// A URL on a second test origin.
+static const std::string URL_B = "https://example.com/playlist.m3u8";
+
+/// A URL on a third test origin.
+static const std::string URL_C = "http://example.com:8080/playlist.m3u8";
+
+/// The path of a media segment on the test server.
+static const std::string SEGMENT_PATH = "/segment.ts";
+
+/// The body of the media segment.
+static const std::string RESPONSE_BODY(1024, 'x');
+
+/// Number of fetches made by the benchmark.
+static const int BENCHMARK_FETCHES = 50;
+
+/**
+ * Answer every request with @c RESPONSE_BODY.
+ *
+ * @param path The path of the request.
+ * @return The response.
+ */
+static TestHTTPServer::Response respondWithBody(const std::string& path) {
+    return {200, "video/mp2t", RESPONSE_BODY, std::chrono::milliseconds::zero()};
+}
+
+/**
+ * Fetch the whole body of a URL and wait until the fetcher is finished with its connection.
+ *
+ * @param url The URL to fetch.
+ * @param pool The pool to use, or @c nullptr.
+ * @return The HTTP status code.
+ */
+static long fetch(const std::string& url, std::shared_ptr<HTTPContentFetcherConnectionPool> pool) {
+    LibCurlHttpContentFetcher fetcher(url, pool);
+    auto content = fetcher.getContent(HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY);
+    if (!content) {
+        return 0;
+    }
+    return content->getStatusCode();
+}
+
+/// Verify that URLs are pooled by their lower-cased scheme, host and port.
+TEST(HTTPContentFetcherConnectionPoolTest, getOrigin) {
+    EXPECT_EQ("http://example.com", HTTPContentFetcherConnectionPool::getOrigin(URL_A));
+    EXPECT_EQ("http://example.com", HTTPContentFetcherConnectionPool::getOrigin(URL_A_OTHER_PATH));
+    EXPECT_EQ("https://example.com", HTTPContentFetcherConnectionPool::getOrigin(URL_B));
+    EXPECT_EQ("http://example.com:8080", HTTPContentFetcherConnectionPool::getOrigin(URL_C));
+    EXPECT_EQ("http://example.com", HTTPContentFetcherConnectionPool::getOrigin("http://user:pw@example.com?a=b"));
+    EXPECT_EQ("http://example.com", HTTPContentFetcherConnectionPool::getOrigin("http://example.com"));
+    EXPECT_EQ("", HTTPContentFetcherConnectionPool::getOrigin("example.com/playlist.m3u8"));
+}
+
+/// Verify that a released multi handle is handed out again only for the same origin.
+TEST(HTTPContentFetcherConnectionPoolTest, reusesMultiHandlePerOrigin) {
+    auto pool = HTTPContentFetcherConnectionPool::create();
+    ASSERT_TRUE(pool);
+    ASSERT_NE(nullptr, pool->getShareHandle());
+
+    auto multi = pool->acquire(URL_A);
+    ASSERT_TRUE(multi);
+    auto released = multi.get();
+    pool->release(URL_A, std::move(multi));
+    EXPECT_EQ(1u, pool->getIdleCount(URL_A_OTHER_PATH));
+    EXPECT_EQ(0u, pool->getIdleCount(URL_B));
+
+    auto other = pool->acquire(URL_B);
+    ASSERT_TRUE(other);
+    EXPECT_NE(released, other.get());
+    EXPECT_EQ(1u, pool->getIdleCount(URL_A));
+
+    auto reused = pool->acquire(URL_A_OTHER_PATH);
+    EXPECT_EQ(released, reused.get());
+    EXPECT_EQ(0u, pool->getIdleCount(URL_A));
+}
+
+/// Verify that the per-origin and total limits evict the longest idle multi handles.
+TEST(HTTPContentFetcherConnectionPoolTest, limitsIdleMultiHandles) {
+    auto pool = HTTPContentFetcherConnectionPool::create(2, 3);
+    ASSERT_TRUE(pool);
+    for (int i = 0; i < 3; ++i) {
+        pool->release(URL_A, CurlMultiHandleWrapper::create());
+    }
+    EXPECT_EQ(2u, pool->getIdleCount(URL_A));
+
+    pool->release(URL_B, CurlMultiHandleWrapper::create());
+    pool->release(URL_C, CurlMultiHandleWrapper::create());
+    EXPECT_EQ(1u, pool->getIdleCount(URL_A));
+    EXPECT_EQ(1u, pool->getIdleCount(URL_B));
+    EXPECT_EQ(1u, pool->getIdleCount(URL_C));
+}
+
+/// Verify that multi handles idle for longer than the maximum idle time are dropped.
+TEST(HTTPContentFetcherConnectionPoolTest, expiresIdleMultiHandles) {
+    auto pool = HTTPContentFetcherConnectionPool::create(
+        HTTPContentFetcherConnectionPool::DEFAULT_MAX_IDLE_PER_ORIGIN,
+        HTTPContentFetcherConnectionPool::DEFAULT_MAX_IDLE_TOTAL,
+        std::chrono::milliseconds::zero());
+    ASSERT_TRUE(pool);
+    pool->release(URL_A, CurlMultiHandleWrapper::create());
+    EXPECT_EQ(0u, pool->getIdleCount(URL_A));
+}
+
+/// Verify that consecutive fetches from a server share one connection when pooled, and do not otherwise.
+TEST(HTTPContentFetcherConnectionPoolTest, pooledFetchesReuseConnection) {
+    TestHTTPServer server(respondWithBody);
+    auto url = server.getURL(SEGMENT_PATH);
+    ASSERT_FALSE(url.empty());
+
+    EXPECT_EQ(200, fetch(url, nullptr));
+    EXPECT_EQ(200, fetch(url, nullptr));
+    EXPECT_EQ(2, server.getConnectionCount());
+
+    auto pool = HTTPContentFetcherConnectionPool::create();
+    ASSERT_TRUE(pool);
+    EXPECT_EQ(200, fetch(url, pool));
+    EXPECT_EQ(1u, pool->getIdleCount(url));
+    EXPECT_EQ(200, fetch(url, pool));
+    EXPECT_EQ(200, fetch(url, pool));
+    EXPECT_EQ(3, server.getConnectionCount());
+}
+
+/// Compare the latency of consecutive segment fetches with and without the pool, recorded as test properties.
+/// Disabled by default.
+TEST(HTTPContentFetcherConnectionPoolTest, DISABLED_benchmarkSegmentFetchLatency) {
+    TestHTTPServer server(respondWithBody);
+    auto url = server.getURL(SEGMENT_PATH);
+    ASSERT_FALSE(url.empty());
+    auto pool = HTTPContentFetcherConnectionPool::create();
+    ASSERT_TRUE(pool);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCHMARK_FETCHES; ++i) {
+        ASSERT_EQ(200, fetch(url, nullptr));
+    }
+    auto unpooledElapsed = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCHMARK_FETCHES; ++i) {
+        ASSERT_EQ(200, fetch(url, pool));
+    }
+    auto pooledElapsed = std::chrono::steady_clock::now() - start;
+
+    auto microseconds = [](std::chrono::steady_clock::duration elapsed) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+    };
+    RecordProperty("newConnectionFetchUs", std::to_string(microseconds(unpooledElapsed) / BENCHMARK_FETCHES));
+    RecordProperty("pooledFetchUs", std::to_string(microseconds(pooledElapsed) / BENCHMARK_FETCHES));
+}
+
+}  // namespace test
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
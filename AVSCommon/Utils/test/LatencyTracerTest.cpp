@@ -0,0 +1,252 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <future>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <rapidjson/document.h>
+
+#include "AVSCommon/Utils/Logger/LogEntry.h"
+#include "AVSCommon/Utils/Metrics.h"
+#include "AVSCommon/Utils/Metrics/ChromeTraceExporter.h"
+#include "AVSCommon/Utils/Metrics/LatencyTracer.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace metrics {
+namespace test {
+
+/// Number of threads recording concurrently.
+static const uint32_t RECORDING_THREADS = 4;
+
+/// Number of events recorded by each thread.
+static const uint64_t EVENTS_PER_RECORDING_THREAD = 100;
+
+/// Number of events recorded by the benchmark.
+static const int BENCHMARK_EVENTS = 100000;
+
+/// A messageId like those in AVS directives.
+static const std::string MESSAGE_ID = "2ab5ec5a-8e3f-4a2b-b7b8-0bd7e5c5c4ef";
+
+/// A dialogRequestId like those in AVS events.
+static const std::string DIALOG_REQUEST_ID = "c0ffee00-1234-5678-9abc-def012345678";
+
+/// Test harness which starts each test with an empty, enabled trace.
+class LatencyTracerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        LatencyTracer::setEnabled(true);
+        LatencyTracer::clear();
+    }
+
+    void TearDown() override {
+        LatencyTracer::setEnabled(true);
+    }
+};
+
+/**
+ * Verify that events recorded on several threads are all collected, ordered by timestamp, with each thread's events
+ * in the order they were recorded.
+ */
+TEST_F(LatencyTracerTest, collectsEventsFromAllThreads) {
+    // Keep the threads alive until all have recorded, so that each has its own ring.
+    std::promise<void> finish;
+    std::shared_future<void> finished = finish.get_future();
+    std::vector<std::future<void>> recorded;
+    std::vector<std::thread> threads;
+    for (uint32_t thread = 0; thread < RECORDING_THREADS; ++thread) {
+        auto done = std::make_shared<std::promise<void>>();
+        recorded.push_back(done->get_future());
+        threads.push_back(std::thread([thread, done, finished] {
+            for (uint64_t i = 0; i < EVENTS_PER_RECORDING_THREAD; ++i) {
+                LatencyTracer::record(TracePoint::SDS_READ, thread * EVENTS_PER_RECORDING_THREAD + i);
+            }
+            done->set_value();
+            finished.wait();
+        }));
+    }
+    for (auto& done : recorded) {
+        done.wait();
+    }
+    finish.set_value();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto events = LatencyTracer::snapshot();
+    ASSERT_EQ(RECORDING_THREADS * EVENTS_PER_RECORDING_THREAD, events.size());
+    std::map<uint32_t, uint64_t> lastIdByThread;
+    for (size_t i = 0; i < events.size(); ++i) {
+        EXPECT_EQ(TracePoint::SDS_READ, events[i].point);
+        if (i > 0) {
+            EXPECT_LE(events[i - 1].timestamp, events[i].timestamp);
+        }
+        auto last = lastIdByThread.find(events[i].thread);
+        if (last != lastIdByThread.end()) {
+            EXPECT_EQ(last->second + 1, events[i].id);
+        }
+        lastIdByThread[events[i].thread] = events[i].id;
+    }
+    EXPECT_EQ(RECORDING_THREADS, lastIdByThread.size());
+}
+
+/**
+ * Verify that when a thread records more events than its ring holds, the most recent ones are kept.
+ */
+TEST_F(LatencyTracerTest, keepsMostRecentEvents) {
+    static const uint64_t EXTRA_EVENTS = 100;
+    std::thread([] {
+        for (uint64_t i = 0; i < LatencyTracer::EVENTS_PER_THREAD + EXTRA_EVENTS; ++i) {
+            LatencyTracer::record(TracePoint::MIME_PART_BEGIN, i);
+        }
+    }).join();
+
+    auto events = LatencyTracer::snapshot();
+    ASSERT_EQ(LatencyTracer::EVENTS_PER_THREAD, events.size());
+    EXPECT_EQ(EXTRA_EVENTS, events.front().id);
+    EXPECT_EQ(LatencyTracer::EVENTS_PER_THREAD + EXTRA_EVENTS - 1, events.back().id);
+}
+
+/**
+ * Verify that nothing is recorded while tracing is disabled, and that @c clear() discards earlier events.
+ */
+TEST_F(LatencyTracerTest, disableAndClear) {
+    LatencyTracer::setEnabled(false);
+    EXPECT_FALSE(LatencyTracer::isEnabled());
+    LatencyTracer::record(TracePoint::KEYWORD_DETECTED);
+    EXPECT_TRUE(LatencyTracer::snapshot().empty());
+
+    LatencyTracer::setEnabled(true);
+    LatencyTracer::record(TracePoint::KEYWORD_DETECTED);
+    EXPECT_EQ(1u, LatencyTracer::snapshot().size());
+
+    // Make sure the next event is recorded after the clear.
+    LatencyTracer::clear();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    EXPECT_TRUE(LatencyTracer::snapshot().empty());
+    LatencyTracer::record(TracePoint::AIP_SEND);
+    auto events = LatencyTracer::snapshot();
+    ASSERT_EQ(1u, events.size());
+    EXPECT_EQ(TracePoint::AIP_SEND, events[0].point);
+}
+
+/**
+ * Verify that string ids are hashed, and that the same id gives the same hash.
+ */
+TEST_F(LatencyTracerTest, hashesStringIds) {
+    EXPECT_EQ(0u, LatencyTracer::hashId(""));
+    EXPECT_NE(0u, LatencyTracer::hashId(MESSAGE_ID));
+    EXPECT_EQ(LatencyTracer::hashId(MESSAGE_ID), LatencyTracer::hashId(std::string(MESSAGE_ID)));
+    EXPECT_NE(LatencyTracer::hashId(MESSAGE_ID), LatencyTracer::hashId(DIALOG_REQUEST_ID));
+
+    LatencyTracer::record(TracePoint::FIRST_RESPONSE_BYTE, MESSAGE_ID);
+    auto events = LatencyTracer::snapshot();
+    ASSERT_EQ(1u, events.size());
+    EXPECT_EQ(LatencyTracer::hashId(MESSAGE_ID), events[0].id);
+}
+
+/**
+ * Verify that the metric macros record trace events, keyed by dialogRequestId when there is one.
+ */
+TEST_F(LatencyTracerTest, metricMacrosRecordEvents) {
+    static const std::string TAG("LatencyTracerTest");
+    ACSDK_METRIC_IDS(TAG, "Recognize", MESSAGE_ID, DIALOG_REQUEST_ID, Metrics::Location::AIP_SEND);
+    ACSDK_METRIC_IDS(TAG, "Speak", MESSAGE_ID, "", Metrics::Location::SPEECH_SYNTHESIZER_RECEIVE);
+
+    auto events = LatencyTracer::snapshot();
+    ASSERT_EQ(2u, events.size());
+    EXPECT_EQ(TracePoint::AIP_SEND, events[0].point);
+    EXPECT_EQ(LatencyTracer::hashId(DIALOG_REQUEST_ID), events[0].id);
+    EXPECT_EQ(TracePoint::SPEECH_SYNTHESIZER_RECEIVE, events[1].point);
+    EXPECT_EQ(LatencyTracer::hashId(MESSAGE_ID), events[1].id);
+}
+
+/**
+ * Verify that the metric macros do not record trace events while tracing is disabled.
+ */
+TEST_F(LatencyTracerTest, metricMacrosSkipDisabledTracer) {
+    static const std::string TAG("LatencyTracerTest");
+    LatencyTracer::setEnabled(false);
+    ACSDK_METRIC_IDS(TAG, "Recognize", MESSAGE_ID, DIALOG_REQUEST_ID, Metrics::Location::AIP_SEND);
+    EXPECT_TRUE(LatencyTracer::snapshot().empty());
+}
+
+/**
+ * Verify that @c ChromeTraceExporter writes valid JSON in the Chrome trace event format.
+ */
+TEST_F(LatencyTracerTest, chromeTraceExporterWritesTraceEvents) {
+    EXPECT_FALSE(ChromeTraceExporter::create(nullptr));
+
+    LatencyTracer::record(TracePoint::KEYWORD_DETECTED);
+    LatencyTracer::record(TracePoint::MEDIA_PLAYER_PLAYING, 0x1234);
+
+    auto stream = std::make_shared<std::stringstream>();
+    auto exporter = ChromeTraceExporter::create(stream);
+    ASSERT_TRUE(exporter);
+    ASSERT_TRUE(LatencyTracer::exportTo(*exporter));
+
+    rapidjson::Document document;
+    ASSERT_FALSE(document.Parse(stream->str().c_str()).HasParseError()) << stream->str();
+    ASSERT_TRUE(document.HasMember("traceEvents"));
+    auto& traceEvents = document["traceEvents"];
+    ASSERT_TRUE(traceEvents.IsArray());
+    ASSERT_EQ(2u, traceEvents.Size());
+    EXPECT_EQ(std::string("KEYWORD_DETECTED"), traceEvents[0]["name"].GetString());
+    EXPECT_EQ(std::string("i"), traceEvents[0]["ph"].GetString());
+    EXPECT_TRUE(traceEvents[0]["ts"].IsNumber());
+    EXPECT_LE(traceEvents[0]["ts"].GetDouble(), traceEvents[1]["ts"].GetDouble());
+    EXPECT_EQ(std::string("MEDIA_PLAYER_PLAYING"), traceEvents[1]["name"].GetString());
+    EXPECT_EQ(std::string("0000000000001234"), traceEvents[1]["args"]["id"].GetString());
+}
+
+/**
+ * Compare the cost of recording a trace event with building the text log entry for the same metric, and record both
+ * as test properties.  Disabled by default.
+ */
+TEST_F(LatencyTracerTest, DISABLED_benchmarkRecord) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCHMARK_EVENTS; ++i) {
+        LatencyTracer::record(TracePoint::ADSL_ENQUEUE, MESSAGE_ID);
+    }
+    auto traceElapsed = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCHMARK_EVENTS; ++i) {
+        logger::LogEntry logEntry("LatencyTracerTest", std::string(__func__) + METRICS_TAG);
+        Metrics::d(logEntry, "Speak", MESSAGE_ID, DIALOG_REQUEST_ID, Metrics::Location::ADSL_ENQUEUE);
+        EXPECT_NE(nullptr, logEntry.c_str());
+    }
+    auto logElapsed = std::chrono::steady_clock::now() - start;
+
+    RecordProperty(
+        "traceEventNs",
+        std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(traceElapsed).count() / BENCHMARK_EVENTS));
+    RecordProperty(
+        "metricsLogEntryNs",
+        std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(logElapsed).count() / BENCHMARK_EVENTS));
+}
+
+}  // namespace test
+}  // namespace metrics
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
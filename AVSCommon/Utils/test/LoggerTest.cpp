@@ -13,12 +13,16 @@
  * permissions and limitations under the License.
  */
 
+#include <chrono>
+#include <functional>
+#include <string>
 #include <thread>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include "AVSCommon/Utils/Logger/Logger.h"
 #include "AVSCommon/Utils/Logger/LoggerSinkManager.h"
+#include "AVSCommon/Utils/Logger/LoggerUtils.h"
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -666,6 +670,91 @@ TEST_F(LoggerTest, testChangeSinkLogger) {
     LoggerSinkManager::instance().initialize(getLoggerTestLogger());
 }
 
+/**
+ * Test that a lazy value is only computed when the log line is emitted.
+ */
+TEST_F(LoggerTest, testLazyValueOnlyComputedWhenEmitted) {
+    int computed = 0;
+    auto value = [&computed] {
+        ++computed;
+        return TEST_MESSAGE_STRING;
+    };
+
+    getLoggerTestLogger()->setLevel(Level::WARN);
+    ACSDK_INFO(LX(TEST_EVENT_STRING).d(METADATA_KEY, lazy(value)));
+    ASSERT_EQ(computed, 0);
+
+    getLoggerTestLogger()->setLevel(Level::INFO);
+    ACSDK_INFO(LX(TEST_EVENT_STRING).d(METADATA_KEY, lazy(value)));
+    ASSERT_EQ(computed, 1);
+    ASSERT_NE(g_log->m_lastText.find(METADATA_KEY KEY_VALUE_SEPARATOR), std::string::npos);
+    ASSERT_NE(g_log->m_lastText.find(TEST_MESSAGE_STRING), std::string::npos);
+}
+
+/**
+ * Test that a compiled out log line is neither evaluated nor emitted, even when its level is enabled.
+ */
+TEST_F(LoggerTest, testCompiledOutLogLine) {
+    getLoggerTestLogger()->setLevel(Level::DEBUG9);
+    EXPECT_CALL(*(g_log.get()), emit(_, _, _, _)).Times(0);
+    int evaluated = 0;
+    ACSDK_LOG_COMPILED_OUT(Level::CRITICAL, LX(TEST_EVENT_STRING).d(METADATA_KEY, ++evaluated));
+    ASSERT_EQ(evaluated, 0);
+}
+
+/**
+ * Measure the cost of log lines shaped like those on busy paths (@c ContextManager::updateStateLocked() and
+ * @c DirectiveProcessor::onDirective()) when they are disabled at run-time, compiled out, or built unconditionally
+ * (as passing a @c LogEntry to the @c acsdk<Level>() functions does).  The costs are recorded as test properties.
+ * This is disabled by default.
+ */
+TEST_F(LoggerTest, DISABLED_benchmarkDisabledLogLines) {
+    const int iterations = 100000;
+    const std::string nameSpace = "SpeechSynthesizer";
+    const std::string name = "SpeechState";
+    const std::string jsonState =
+        R"({"token":"0123456789abcdef","offsetInMilliseconds":1234,"playerActivity":"PLAYING"})";
+    getLoggerTestLogger()->setLevel(Level::NONE);
+
+    auto measure = [iterations](const std::string& label, const std::function<void()>& logLine) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i) {
+            logLine();
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        RecordProperty(label + "NsPerLogLine", std::to_string(elapsed.count() / iterations));
+    };
+
+    measure("disabledAtRunTime", [&] {
+        ACSDK_LOG(
+            Level::DEBUG9,
+            LX("updateStateLocked")
+                .d("action", "updatedState")
+                .d("state", jsonState)
+                .d("namespace", nameSpace)
+                .d("name", name));
+    });
+    measure("compiledOut", [&] {
+        ACSDK_LOG_COMPILED_OUT(
+            Level::DEBUG9,
+            LX("updateStateLocked")
+                .d("action", "updatedState")
+                .d("state", jsonState)
+                .d("namespace", nameSpace)
+                .d("name", name));
+    });
+    measure("builtUnconditionally", [&] {
+        logEntry(
+            Level::DEBUG9,
+            LX("updateStateLocked")
+                .d("action", "updatedState")
+                .d("state", jsonState)
+                .d("namespace", nameSpace)
+                .d("name", name));
+    });
+    EXPECT_CALL(*(g_log.get()), emit(_, _, _, _)).Times(0);
+}
+
 }  // namespace test
 }  // namespace logger
 }  // namespace utils
@@ -0,0 +1,222 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file LowLatencyInProcessSDSTest.cpp
+
+#include <chrono>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/SDS/InProcessSDS.h"
+#include "AVSCommon/Utils/SDS/LowLatencyInProcessSDS.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+namespace test {
+
+/// For brevity in the tests below, alias the SDS type under test.
+using Sds = LowLatencyInProcessSDS;
+
+/// Word size used by the tests (16-bit PCM samples).
+static const size_t WORDSIZE = 2;
+
+/// Number of words written per @c write() call by the benchmark (10ms of 16kHz audio).
+static const size_t WRITE_BLOCK_SIZE_WORDS = 160;
+
+/// Number of words the benchmark streams through each SDS.
+static const size_t BENCHMARK_WORDS = WRITE_BLOCK_SIZE_WORDS * 5000;
+
+/// Size of the SDS buffer used by the benchmark.
+static const size_t BENCHMARK_BUFFER_WORDS = WRITE_BLOCK_SIZE_WORDS * 100;
+
+/// Maximum number of readers the benchmark exercises.
+static const size_t BENCHMARK_MAX_READERS = 8;
+
+/// Timeout used when waiting for things which are expected to happen.
+static const std::chrono::seconds LONG_TIMEOUT{5};
+
+/// Timeout used when waiting for things which are not expected to happen.
+static const std::chrono::milliseconds SHORT_TIMEOUT{50};
+
+/**
+ * Streams @c BENCHMARK_WORDS through a @c BLOCKING @c Writer to @c numReaders @c BLOCKING @c Readers, verifying the
+ * data each reader receives.
+ *
+ * @tparam SdsType The @c SharedDataStream type to measure.
+ * @param numReaders The number of concurrent readers.
+ * @return The elapsed time for all readers to consume the stream.
+ */
+template <typename SdsType>
+static std::chrono::microseconds streamThroughReaders(size_t numReaders) {
+    auto buffer = std::make_shared<typename SdsType::Buffer>(
+        SdsType::calculateBufferSize(BENCHMARK_BUFFER_WORDS, WORDSIZE, numReaders));
+    auto sds = SdsType::create(buffer, WORDSIZE, numReaders);
+    EXPECT_TRUE(sds);
+    if (!sds) {
+        return std::chrono::microseconds::zero();
+    }
+    auto writer = sds->createWriter(SdsType::Writer::Policy::BLOCKING);
+    std::vector<std::shared_ptr<typename SdsType::Reader>> readers;
+    for (size_t i = 0; i < numReaders; ++i) {
+        readers.push_back(sds->createReader(SdsType::Reader::Policy::BLOCKING));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::future<bool>> results;
+    for (auto reader : readers) {
+        results.push_back(std::async(std::launch::async, [reader] {
+            std::vector<uint16_t> block(WRITE_BLOCK_SIZE_WORDS);
+            uint16_t expected = 0;
+            size_t total = 0;
+            while (total < BENCHMARK_WORDS) {
+                auto nWords = reader->read(block.data(), block.size(), LONG_TIMEOUT);
+                if (nWords <= 0) {
+                    return false;
+                }
+                for (ssize_t i = 0; i < nWords; ++i) {
+                    if (block[i] != expected++) {
+                        return false;
+                    }
+                }
+                total += nWords;
+            }
+            return true;
+        }));
+    }
+
+    std::vector<uint16_t> block(WRITE_BLOCK_SIZE_WORDS);
+    uint16_t counter = 0;
+    for (size_t written = 0; written < BENCHMARK_WORDS; written += block.size()) {
+        for (auto& word : block) {
+            word = counter++;
+        }
+        size_t offset = 0;
+        while (offset < block.size()) {
+            auto nWords = writer->write(block.data() + offset, block.size() - offset, LONG_TIMEOUT);
+            EXPECT_GT(nWords, 0);
+            if (nWords <= 0) {
+                writer->close();
+                break;
+            }
+            offset += nWords;
+        }
+    }
+
+    for (auto& result : results) {
+        EXPECT_TRUE(result.get());
+    }
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+}
+
+/// The test harness for the tests below.
+class LowLatencyInProcessSDSTest : public ::testing::Test {};
+
+/// Verify that a @c BLOCKING @c Reader waiting for data is woken up by a @c NONBLOCKABLE @c Writer.
+TEST_F(LowLatencyInProcessSDSTest, blockedReaderIsWokenByNonblockableWriter) {
+    static const size_t WORDCOUNT = 10;
+    auto buffer = std::make_shared<Sds::Buffer>(Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, 1));
+    auto sds = Sds::create(buffer, WORDSIZE, 1);
+    ASSERT_TRUE(sds);
+    auto writer = sds->createWriter(Sds::Writer::Policy::NONBLOCKABLE);
+    ASSERT_TRUE(writer);
+    auto reader = sds->createReader(Sds::Reader::Policy::BLOCKING);
+    ASSERT_TRUE(reader);
+
+    auto readResult = std::async(std::launch::async, [&reader] {
+        uint16_t word = 0;
+        auto nWords = reader->read(&word, 1, LONG_TIMEOUT);
+        return nWords == 1 ? word : 0;
+    });
+
+    // Give the reader time to exhaust its spin and block.
+    std::this_thread::sleep_for(SHORT_TIMEOUT);
+    uint16_t word = 0x1234;
+    ASSERT_EQ(writer->write(&word, 1), 1);
+    ASSERT_EQ(readResult.get(), word);
+}
+
+/// Verify that a @c BLOCKING @c Reader still times out, and that a later write is still readable.
+TEST_F(LowLatencyInProcessSDSTest, blockedReaderTimesOut) {
+    static const size_t WORDCOUNT = 10;
+    auto buffer = std::make_shared<Sds::Buffer>(Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, 1));
+    auto sds = Sds::create(buffer, WORDSIZE, 1);
+    ASSERT_TRUE(sds);
+    auto writer = sds->createWriter(Sds::Writer::Policy::ALL_OR_NOTHING);
+    ASSERT_TRUE(writer);
+    auto reader = sds->createReader(Sds::Reader::Policy::BLOCKING);
+    ASSERT_TRUE(reader);
+
+    uint16_t word = 0;
+    ASSERT_EQ(reader->read(&word, 1, SHORT_TIMEOUT), Sds::Reader::Error::TIMEDOUT);
+
+    word = 0x5678;
+    ASSERT_EQ(writer->write(&word, 1), 1);
+    word = 0;
+    ASSERT_EQ(reader->read(&word, 1, SHORT_TIMEOUT), 1);
+    ASSERT_EQ(word, 0x5678);
+}
+
+/// Verify that closing the @c Writer wakes up a @c BLOCKING @c Reader.
+TEST_F(LowLatencyInProcessSDSTest, writerCloseWakesBlockedReader) {
+    static const size_t WORDCOUNT = 10;
+    auto buffer = std::make_shared<Sds::Buffer>(Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, 1));
+    auto sds = Sds::create(buffer, WORDSIZE, 1);
+    ASSERT_TRUE(sds);
+    auto writer = sds->createWriter(Sds::Writer::Policy::NONBLOCKABLE);
+    ASSERT_TRUE(writer);
+    auto reader = sds->createReader(Sds::Reader::Policy::BLOCKING);
+    ASSERT_TRUE(reader);
+
+    auto readResult = std::async(std::launch::async, [&reader] {
+        uint16_t word = 0;
+        return reader->read(&word, 1, LONG_TIMEOUT);
+    });
+
+    std::this_thread::sleep_for(SHORT_TIMEOUT);
+    writer->close();
+    ASSERT_EQ(readResult.get(), Sds::Reader::Error::CLOSED);
+}
+
+/// Verify data integrity with @c BENCHMARK_MAX_READERS concurrent @c BLOCKING readers.
+TEST_F(LowLatencyInProcessSDSTest, concurrentReadersReceiveAllData) {
+    streamThroughReaders<Sds>(BENCHMARK_MAX_READERS);
+}
+
+/**
+ * Report throughput against @c InProcessSDS with one to @c BENCHMARK_MAX_READERS concurrent @c BLOCKING readers, as
+ * test properties.  This is disabled by default; run it with @c --gtest_also_run_disabled_tests.
+ */
+TEST_F(LowLatencyInProcessSDSTest, DISABLED_benchmarkAgainstInProcessSDS) {
+    for (size_t numReaders = 1; numReaders <= BENCHMARK_MAX_READERS; numReaders *= 2) {
+        auto baseline = streamThroughReaders<InProcessSDS>(numReaders);
+        auto lowLatency = streamThroughReaders<LowLatencyInProcessSDS>(numReaders);
+        auto readers = "readers" + std::to_string(numReaders);
+        RecordProperty(readers + "InProcessSDSUs", std::to_string(baseline.count()));
+        RecordProperty(readers + "LowLatencyInProcessSDSUs", std::to_string(lowLatency.count()));
+    }
+}
+
+}  // namespace test
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
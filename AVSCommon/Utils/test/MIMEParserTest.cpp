@@ -20,8 +20,11 @@
 #include <unordered_set>
 #include <random>
 #include <algorithm>
+#include <chrono>
+#include <map>
 
 #include <gmock/gmock.h>
+#include <MultipartParser/MultipartReader.h>
 
 #include "AVSCommon/Utils/Common/Common.h"
 #include "AVSCommon/Utils/HTTP2/HTTP2MimeRequestEncoder.h"
@@ -668,6 +671,230 @@ TEST_F(MIMEParserTest, testPrefixCases) {
     }
 }
 
+/**
+ * A binary safe sink which collects the data of each part, and optionally pauses on every other call with data.
+ */
+class CollectingSink : public HTTP2MimeResponseSinkInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param pause Whether to return @c PAUSE from every other call to @c onReceiveMimeData().
+     * @param keepData Whether to keep the data received, or only count it.
+     */
+    CollectingSink(bool pause, bool keepData) :
+            m_pause{pause},
+            m_keepData{keepData},
+            m_pauseNext{pause},
+            m_pauseCount{0},
+            m_byteCount{0} {
+    }
+
+    bool onReceiveResponseCode(long responseCode) override {
+        return true;
+    }
+
+    bool onReceiveHeaderLine(const std::string& line) override {
+        return true;
+    }
+
+    bool onBeginMimePart(const std::multimap<std::string, std::string>& headers) override {
+        m_headers.push_back(headers);
+        m_parts.push_back("");
+        return true;
+    }
+
+    HTTP2ReceiveDataStatus onReceiveMimeData(const char* bytes, size_t size) override {
+        if (m_pauseNext) {
+            m_pauseNext = false;
+            m_pauseCount++;
+            return HTTP2ReceiveDataStatus::PAUSE;
+        }
+        m_pauseNext = m_pause;
+        m_byteCount += size;
+        if (m_keepData) {
+            m_parts.back().append(bytes, size);
+        }
+        return HTTP2ReceiveDataStatus::SUCCESS;
+    }
+
+    bool onEndMimePart() override {
+        return true;
+    }
+
+    HTTP2ReceiveDataStatus onReceiveNonMimeData(const char* bytes, size_t size) override {
+        return HTTP2ReceiveDataStatus::ABORT;
+    }
+
+    void onResponseFinished(HTTP2ResponseFinishedStatus status) override {
+    }
+
+    /// Whether to return @c PAUSE from every other call to @c onReceiveMimeData().
+    const bool m_pause;
+    /// Whether to keep the data received.
+    const bool m_keepData;
+    /// Whether to return @c PAUSE from the next call to @c onReceiveMimeData().
+    bool m_pauseNext;
+    /// The number of times @c PAUSE was returned.
+    size_t m_pauseCount;
+    /// The number of bytes of part data received.
+    size_t m_byteCount;
+    /// The headers of each part.
+    std::vector<std::multimap<std::string, std::string>> m_headers;
+    /// The data of each part, if kept.
+    std::vector<std::string> m_parts;
+};
+
+/**
+ * Feed a response to a decoder in chunks of the given size, resending each chunk the decoder pauses on.
+ *
+ * @param decoder The decoder to feed.
+ * @param response The response body.
+ * @param chunkSize The size of each chunk.
+ * @return The status of the last call to @c onReceiveData().
+ */
+static HTTP2ReceiveDataStatus feedInChunks(
+    HTTP2MimeResponseDecoder& decoder,
+    const std::string& response,
+    size_t chunkSize) {
+    HTTP2ReceiveDataStatus status{HTTP2ReceiveDataStatus::SUCCESS};
+    size_t index{0};
+    while (index < response.size() && status != HTTP2ReceiveDataStatus::ABORT) {
+        auto size = std::min(chunkSize, response.size() - index);
+        status = decoder.onReceiveData(response.data() + index, size);
+        if (HTTP2ReceiveDataStatus::SUCCESS == status) {
+            index += size;
+        }
+    }
+    return status;
+}
+
+/**
+ * Build a response with a JSON part and a binary part.
+ *
+ * @param json The data of the JSON part.
+ * @param binary The data of the binary part.
+ * @return The response body.
+ */
+static std::string buildResponse(const std::string& json, const std::string& binary) {
+    return MIME_NEWLINE + BOUNDARY + MIME_NEWLINE + HEADER_LINE + MIME_NEWLINE + MIME_NEWLINE + json + BOUNDARY_LINE +
+           MIME_NEWLINE + "Content-Type: application/octet-stream" + MIME_NEWLINE + "Content-ID: <attachment>" +
+           MIME_NEWLINE + MIME_NEWLINE + binary + BOUNDARY_LINE + MIME_BOUNDARY_DASHES + MIME_NEWLINE;
+}
+
+/**
+ * Create random binary data.
+ *
+ * @param size The number of bytes to create.
+ * @return The data.
+ */
+static std::string createRandomBinaryString(size_t size) {
+    std::mt19937 generator(static_cast<unsigned>(size));
+    std::uniform_int_distribution<int> distribution(0, 255);
+    std::string data(size, '\0');
+    for (auto& c : data) {
+        c = static_cast<char>(distribution(generator));
+    }
+    return data;
+}
+
+/**
+ * Verify that binary data containing CRs, and strings that start like the boundary, is decoded exactly whatever the
+ * chunk size, and when the sink pauses on every other call.
+ */
+TEST_F(MIMEParserTest, binaryDataAtEveryChunkSize) {
+    const std::string binary = std::string("\r\r\n-\0\r\n--", 9) + MIME_TEST_BOUNDARY_STRING.substr(0, 10) + "\r\n" +
+                               BOUNDARY.substr(0, BOUNDARY.size() - 1) + "\r\r\n-" + BOUNDARY + "x\r\n\r";
+    const std::string response = buildResponse(TEST_MESSAGE, binary);
+
+    for (int pause = 0; pause < 2; ++pause) {
+        for (size_t chunkSize = 1; chunkSize <= response.size(); ++chunkSize) {
+            auto sink = std::make_shared<CollectingSink>(pause != 0, true);
+            HTTP2MimeResponseDecoder decoder{sink};
+            ASSERT_TRUE(decoder.onReceiveHeaderLine(BOUNDARY_HEADER_PREFIX + MIME_TEST_BOUNDARY_STRING));
+            ASSERT_TRUE(decoder.onReceiveResponseCode(HTTPResponseCode::SUCCESS_OK));
+
+            std::string message = "chunkSize=" + std::to_string(chunkSize) + ", pause=" + std::to_string(pause);
+            ASSERT_EQ(HTTP2ReceiveDataStatus::SUCCESS, feedInChunks(decoder, response, chunkSize)) << message;
+            ASSERT_EQ(2u, sink->m_parts.size()) << message;
+            EXPECT_EQ(TEST_MESSAGE, sink->m_parts[0]) << message;
+            EXPECT_EQ(binary, sink->m_parts[1]) << message;
+            ASSERT_EQ(2u, sink->m_headers[1].size()) << message;
+            EXPECT_EQ("<attachment>", sink->m_headers[1].find("Content-ID")->second) << message;
+            if (pause) {
+                EXPECT_GT(sink->m_pauseCount, 0u) << message;
+            }
+        }
+    }
+}
+
+/// Context for the @c MultipartReader callbacks of the baseline in @c DISABLED_benchmarkDecodeThroughput.
+struct ReaderCounter {
+    /// The number of parts begun.
+    size_t parts;
+    /// The number of bytes of part data received.
+    size_t bytes;
+};
+
+/**
+ * Measure decoding throughput for responses with attachments from 1 KB to 10 MB, fed in 16 KB chunks (the libcurl
+ * default).  For comparison, the baseline is a @c MultipartReader which is copied before each chunk is fed to it, as
+ * the decoder used to do so that it could roll back when its sink paused.  The throughput of both, in MB/s, is recorded
+ * as a test property per attachment size.  Disabled by default.
+ */
+TEST_F(MIMEParserTest, DISABLED_benchmarkDecodeThroughput) {
+    static const size_t CHUNK_SIZE = 16 * 1024;
+    static const size_t ATTACHMENT_SIZES[] = {1024, 64 * 1024, 1024 * 1024, 10 * 1024 * 1024};
+    static const size_t MIN_BYTES_DECODED = 64 * 1024 * 1024;
+
+    for (auto attachmentSize : ATTACHMENT_SIZES) {
+        const std::string response = buildResponse(TEST_MESSAGE, createRandomBinaryString(attachmentSize));
+        auto iterations = std::max<size_t>(1, MIN_BYTES_DECODED / response.size());
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            auto sink = std::make_shared<CollectingSink>(false, false);
+            HTTP2MimeResponseDecoder decoder{sink};
+            decoder.onReceiveHeaderLine(BOUNDARY_HEADER_PREFIX + MIME_TEST_BOUNDARY_STRING);
+            decoder.onReceiveResponseCode(HTTPResponseCode::SUCCESS_OK);
+            ASSERT_EQ(HTTP2ReceiveDataStatus::SUCCESS, feedInChunks(decoder, response, CHUNK_SIZE));
+            ASSERT_EQ(TEST_MESSAGE.size() + attachmentSize, sink->m_byteCount);
+        }
+        auto decoderElapsed = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i) {
+            ReaderCounter counter{0, 0};
+            MultipartReader reader;
+            reader.onPartBegin = [](const MultipartHeaders&, void* userData) {
+                static_cast<ReaderCounter*>(userData)->parts++;
+            };
+            reader.onPartData = [](const char*, size_t size, void* userData) {
+                static_cast<ReaderCounter*>(userData)->bytes += size;
+            };
+            reader.userData = &counter;
+            reader.setBoundary(MIME_TEST_BOUNDARY_STRING);
+            // MultipartReader does not accept the leading CRLF, which the decoder used to strip.
+            for (size_t index = MIME_NEWLINE.size(); index < response.size(); index += CHUNK_SIZE) {
+                auto checkpoint = reader;
+                reader.feed(response.data() + index, std::min(CHUNK_SIZE, response.size() - index));
+                ASSERT_FALSE(reader.hasError());
+                (void)checkpoint;
+            }
+            ASSERT_EQ(TEST_MESSAGE.size() + attachmentSize, counter.bytes);
+        }
+        auto readerElapsed = std::chrono::steady_clock::now() - start;
+
+        auto megabytes = static_cast<double>(response.size() * iterations) / (1024 * 1024);
+        auto seconds = [](std::chrono::steady_clock::duration elapsed) {
+            return std::max(std::chrono::duration<double>(elapsed).count(), 1e-9);
+        };
+        auto label = "attachment" + std::to_string(attachmentSize);
+        RecordProperty(label + "DecoderMBps", std::to_string(megabytes / seconds(decoderElapsed)));
+        RecordProperty(label + "CheckpointedReaderMBps", std::to_string(megabytes / seconds(readerElapsed)));
+    }
+}
+
 }  // namespace test
 }  // namespace avsCommon
 }  // namespace alexaClientSDK
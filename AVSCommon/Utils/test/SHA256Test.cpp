@@ -0,0 +1,92 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Crypto/SHA256.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace crypto {
+namespace test {
+
+/// The two-block message of the FIPS 180-2 SHA-256 examples.
+static const std::string TWO_BLOCK_MESSAGE = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+
+/// The number of 'a' characters in the long message of the FIPS 180-2 SHA-256 examples.
+static const size_t LONG_MESSAGE_LENGTH = 1000000;
+
+/**
+ * Hashes a message in one update.
+ *
+ * @param message The message.
+ * @return The digest of the message.
+ */
+static std::string hash(const std::string& message) {
+    SHA256 sha256;
+    sha256.update(message.data(), message.size());
+    return sha256.finish();
+}
+
+/// Verify the digest of the empty message.
+TEST(SHA256Test, emptyMessage) {
+    EXPECT_EQ("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855", hash(""));
+}
+
+/// Verify the digest of the one-block message of the FIPS 180-2 examples.
+TEST(SHA256Test, oneBlockMessage) {
+    EXPECT_EQ("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad", hash("abc"));
+}
+
+/// Verify the digest of the two-block message of the FIPS 180-2 examples, whose padding needs a block of its own.
+TEST(SHA256Test, twoBlockMessage) {
+    EXPECT_EQ("248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1", hash(TWO_BLOCK_MESSAGE));
+}
+
+/// Verify the digest of the long message of the FIPS 180-2 examples, hashed in updates which do not fill blocks.
+TEST(SHA256Test, longMessageInUnalignedUpdates) {
+    SHA256 sha256;
+    std::string chunk(7, 'a');
+    size_t hashed = 0;
+    while (hashed < LONG_MESSAGE_LENGTH) {
+        auto size = std::min(chunk.size(), LONG_MESSAGE_LENGTH - hashed);
+        sha256.update(chunk.data(), size);
+        hashed += size;
+    }
+    EXPECT_EQ("cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0", sha256.finish());
+}
+
+/// Verify that a message hashed one byte at a time has the same digest as when it is hashed at once.
+TEST(SHA256Test, incrementalUpdatesMatchOneUpdate) {
+    std::string message;
+    for (int i = 0; i < 200; ++i) {
+        message.push_back(static_cast<char>(i));
+    }
+    SHA256 sha256;
+    for (auto c : message) {
+        sha256.update(&c, 1);
+    }
+    EXPECT_EQ(hash(message), sha256.finish());
+}
+
+}  // namespace test
+}  // namespace crypto
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
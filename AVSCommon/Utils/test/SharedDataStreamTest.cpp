@@ -24,6 +24,7 @@
 
 #include <gtest/gtest.h>
 
+#include "AVSCommon/Utils/Metrics/LatencyTracer.h"
 #include "AVSCommon/Utils/Timing/Timer.h"
 #include "AVSCommon/Utils/SDS/InProcessSDS.h"
 
@@ -94,6 +95,11 @@ public:
         InProcessSDS::AtomicIndex::operator+=(rhs);
         return *this;
     }
+    /// Subtract and assign the atomic value.
+    AtomicIndex& operator-=(const InProcessSDS::Index& rhs) {
+        InProcessSDS::AtomicIndex::operator-=(rhs);
+        return *this;
+    }
 };
 
 /// An @c AtomicBool type with the minimum functionality required by SDS.
@@ -646,6 +652,102 @@ TEST_F(SharedDataStreamTest, readerRead) {
     ASSERT_EQ(numRead.get(), static_cast<ssize_t>(WORDCOUNT - indexesToSkip));
 }
 
+/// This tests @c SharedDataStream::Reader::peek() and @c SharedDataStream::Reader::commit().
+TEST_F(SharedDataStreamTest, readerPeekCommit) {
+    static const size_t WORDSIZE = 2;
+    static const size_t WORDCOUNT = 4;
+    static const size_t MAXREADERS = 1;
+    static const std::chrono::milliseconds TIMEOUT{10};
+
+    // Initialize an sds.
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+    auto reader = sds->createReader(Sds::Reader::Policy::BLOCKING);
+    ASSERT_NE(reader, nullptr);
+    auto writer = sds->createWriter(Sds::Writer::Policy::NONBLOCKABLE);
+    ASSERT_NE(writer, nullptr);
+
+    // Verify bad parameter handling and empty stream.
+    Sds::Span span;
+    ASSERT_EQ(reader->peek(nullptr, WORDCOUNT), Sds::Reader::Error::INVALID);
+    ASSERT_EQ(reader->peek(&span, 0), Sds::Reader::Error::INVALID);
+    ASSERT_EQ(reader->peek(&span, WORDCOUNT, TIMEOUT), Sds::Reader::Error::TIMEDOUT);
+
+    // Verify peek points at the data without consuming it.
+    uint16_t writeBuf[WORDCOUNT] = {1, 2, 3, 4};
+    ASSERT_EQ(writer->write(writeBuf, 3), 3);
+    ASSERT_EQ(reader->peek(&span, WORDCOUNT, TIMEOUT), 3);
+    ASSERT_EQ(span.size(), 3U);
+    ASSERT_EQ(span.secondWords, 0U);
+    ASSERT_EQ(reinterpret_cast<uint16_t*>(span.first)[0], 1);
+    ASSERT_EQ(reader->peek(&span, WORDCOUNT, TIMEOUT), 3);
+    ASSERT_EQ(reader->tell(), 0U);
+
+    // Verify commit consumes data, and can't consume more than has been written.
+    ASSERT_EQ(reader->commit(WORDCOUNT), Sds::Reader::Error::INVALID);
+    ASSERT_EQ(reader->commit(2), 2);
+    ASSERT_EQ(reader->tell(), 2U);
+
+    // Verify a span which wraps is split into two regions.
+    ASSERT_EQ(writer->write(writeBuf, 3), 3);
+    ASSERT_EQ(reader->peek(&span, WORDCOUNT, TIMEOUT), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(span.firstWords, 2U);
+    ASSERT_EQ(span.secondWords, 2U);
+    ASSERT_EQ(reinterpret_cast<uint16_t*>(span.first)[0], 3);
+    ASSERT_EQ(reinterpret_cast<uint16_t*>(span.first)[1], 1);
+    ASSERT_EQ(reinterpret_cast<uint16_t*>(span.second)[0], 2);
+    ASSERT_EQ(reinterpret_cast<uint16_t*>(span.second)[1], 3);
+
+    // Verify commit detects data which was overwritten while it was being processed.
+    ASSERT_EQ(writer->write(writeBuf, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(reader->commit(WORDCOUNT), Sds::Reader::Error::OVERRUN);
+
+    // Verify peek and commit honor the close index, even if it is moved after the data was peeked.
+    ASSERT_TRUE(reader->seek(0, Sds::Reader::Reference::BEFORE_WRITER));
+    ASSERT_EQ(writer->write(writeBuf, 2), 2);
+    ASSERT_EQ(reader->peek(&span, WORDCOUNT, TIMEOUT), 2);
+    reader->close(1, Sds::Reader::Reference::AFTER_READER);
+    ASSERT_EQ(reader->peek(&span, WORDCOUNT, TIMEOUT), 1);
+    ASSERT_EQ(reader->commit(2), 1);
+    ASSERT_EQ(reader->tell(Sds::Reader::Reference::BEFORE_WRITER), 1U);
+    ASSERT_EQ(reader->commit(1), Sds::Reader::Error::CLOSED);
+    ASSERT_EQ(reader->peek(&span, WORDCOUNT, TIMEOUT), Sds::Reader::Error::CLOSED);
+}
+
+/// This tests that a @c SharedDataStream::Reader only records a trace event for its first read.
+TEST_F(SharedDataStreamTest, readerTracesFirstReadOnly) {
+    static const size_t WORDSIZE = 2;
+    static const size_t WORDCOUNT = 4;
+    static const size_t MAXREADERS = 1;
+    static const size_t READS = 3;
+
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+    auto reader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+    auto writer = sds->createWriter(Sds::Writer::Policy::NONBLOCKABLE);
+    ASSERT_NE(writer, nullptr);
+
+    metrics::LatencyTracer::clear();
+    uint16_t buf[1] = {1};
+    for (size_t i = 0; i < READS; ++i) {
+        ASSERT_EQ(writer->write(buf, 1), 1);
+        ASSERT_EQ(reader->read(buf, 1), 1);
+    }
+
+    size_t tracedReads = 0;
+    for (const auto& event : metrics::LatencyTracer::snapshot()) {
+        if (metrics::TracePoint::SDS_READ == event.point && reader->getId() == event.id) {
+            ++tracedReads;
+        }
+    }
+    ASSERT_EQ(tracedReads, 1U);
+}
+
 /// This tests @c SharedDataStream::Reader::seek().
 TEST_F(SharedDataStreamTest, readerSeek) {
     static const size_t WORDSIZE = 2;
@@ -893,6 +995,57 @@ TEST_F(SharedDataStreamTest, readerClose) {
     ASSERT_EQ(reader->read(readBuf, readWords), Sds::Reader::Error::CLOSED);
 }
 
+/// This tests @c SharedDataStream::Reader::setDataAvailableCallback().
+TEST_F(SharedDataStreamTest, readerDataAvailableCallback) {
+    static const size_t WORDSIZE = 2;
+    static const size_t WORDCOUNT = 10;
+    static const size_t MAXREADERS = 2;
+
+    // Initialize an sds.
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+
+    // Create a reader which counts its callbacks, and a writer.
+    auto reader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+    size_t callbacks = 0;
+    reader->setDataAvailableCallback([&callbacks] { ++callbacks; });
+    auto writer = sds->createWriter(Sds::Writer::Policy::ALL_OR_NOTHING);
+    ASSERT_NE(writer, nullptr);
+
+    // Verify that writing data does not call the callback until a read has returned WOULDBLOCK.
+    uint8_t writeBuf[WORDSIZE * WORDCOUNT];
+    uint8_t readBuf[WORDSIZE * WORDCOUNT];
+    ASSERT_EQ(writer->write(writeBuf, 1), 1);
+    EXPECT_EQ(callbacks, 0U);
+    ASSERT_EQ(reader->read(readBuf, WORDCOUNT), 1);
+    ASSERT_EQ(reader->read(readBuf, WORDCOUNT), Sds::Reader::Error::WOULDBLOCK);
+    EXPECT_EQ(callbacks, 0U);
+
+    // Verify that the next write calls the callback once.
+    ASSERT_EQ(writer->write(writeBuf, 1), 1);
+    EXPECT_EQ(callbacks, 1U);
+    ASSERT_EQ(writer->write(writeBuf, 1), 1);
+    EXPECT_EQ(callbacks, 1U);
+
+    // Verify that a cleared callback is not called.
+    ASSERT_EQ(reader->read(readBuf, WORDCOUNT), 2);
+    ASSERT_EQ(reader->read(readBuf, WORDCOUNT), Sds::Reader::Error::WOULDBLOCK);
+    reader->setDataAvailableCallback(nullptr);
+    ASSERT_EQ(writer->write(writeBuf, 1), 1);
+    EXPECT_EQ(callbacks, 1U);
+
+    // Verify that closing the writer calls the callback.
+    reader->setDataAvailableCallback([&callbacks] { ++callbacks; });
+    ASSERT_EQ(reader->read(readBuf, WORDCOUNT), 1);
+    ASSERT_EQ(reader->read(readBuf, WORDCOUNT), Sds::Reader::Error::WOULDBLOCK);
+    writer->close();
+    EXPECT_EQ(callbacks, 2U);
+    ASSERT_EQ(reader->read(readBuf, WORDCOUNT), Sds::Reader::Error::CLOSED);
+}
+
 /// This tests @c SharedDataStream::Reader::getId().
 TEST_F(SharedDataStreamTest, readerGetId) {
     static const size_t WORDSIZE = 1;
@@ -1013,6 +1166,68 @@ TEST_F(SharedDataStreamTest, writerWrite) {
     ASSERT_EQ(allOrNothing->write(writeBuf, writeWords), static_cast<ssize_t>(writeWords));
 }
 
+/// This tests @c SharedDataStream::Writer::reserve() and @c SharedDataStream::Writer::publish().
+TEST_F(SharedDataStreamTest, writerReservePublish) {
+    static const size_t WORDSIZE = 2;
+    static const size_t WORDCOUNT = 4;
+    static const size_t MAXREADERS = 1;
+    static const std::chrono::milliseconds TIMEOUT{10};
+
+    // Initialize an sds.
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+    auto writer = sds->createWriter(Sds::Writer::Policy::BLOCKING);
+    ASSERT_NE(writer, nullptr);
+    auto reader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+
+    // Verify bad parameter handling.
+    Sds::Span span;
+    ASSERT_EQ(writer->reserve(nullptr, WORDCOUNT), Sds::Writer::Error::INVALID);
+    ASSERT_EQ(writer->reserve(&span, 0), Sds::Writer::Error::INVALID);
+
+    // Verify reserved space is not visible to readers until it is published.
+    uint16_t readBuf[WORDCOUNT];
+    ASSERT_EQ(writer->reserve(&span, 3), 3);
+    ASSERT_EQ(span.firstWords, 3U);
+    ASSERT_EQ(span.secondWords, 0U);
+    auto words = reinterpret_cast<uint16_t*>(span.first);
+    words[0] = 1;
+    words[1] = 2;
+    ASSERT_EQ(reader->read(readBuf, WORDCOUNT), Sds::Reader::Error::WOULDBLOCK);
+
+    // Verify a partial publish releases the rest of the reservation, and can't exceed the reservation.
+    ASSERT_EQ(writer->publish(WORDCOUNT), Sds::Writer::Error::INVALID);
+    ASSERT_EQ(writer->publish(2), 2);
+    ASSERT_EQ(writer->tell(), 2U);
+    ASSERT_EQ(reader->read(readBuf, WORDCOUNT), 2);
+    ASSERT_EQ(readBuf[0], 1);
+    ASSERT_EQ(readBuf[1], 2);
+
+    // Verify a reservation which wraps is split into two regions.
+    ASSERT_EQ(writer->reserve(&span, WORDCOUNT, TIMEOUT), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(span.firstWords, 2U);
+    ASSERT_EQ(span.secondWords, 2U);
+    reinterpret_cast<uint16_t*>(span.first)[0] = 3;
+    reinterpret_cast<uint16_t*>(span.second)[1] = 6;
+    ASSERT_EQ(writer->publish(WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(reader->read(readBuf, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(readBuf[0], 3);
+    ASSERT_EQ(readBuf[3], 6);
+
+    // Verify a blocking writer can't reserve space in a full buffer.
+    ASSERT_EQ(writer->write(readBuf, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(writer->reserve(&span, 1, TIMEOUT), Sds::Writer::Error::TIMEDOUT);
+
+    // Verify publishing after the writer closes fails.
+    ASSERT_EQ(reader->read(readBuf, 1), 1);
+    ASSERT_EQ(writer->reserve(&span, 1, TIMEOUT), 1);
+    writer->close();
+    ASSERT_EQ(writer->publish(1), Sds::Writer::Error::CLOSED);
+}
+
 /// This tests @c SharedDataStream::Writer::tell().
 TEST_F(SharedDataStreamTest, writerTell) {
     static const size_t WORDSIZE = 1;
@@ -1065,6 +1280,50 @@ TEST_F(SharedDataStreamTest, writerClose) {
     ASSERT_EQ(writer->write(writeBuf, WORDCOUNT), Sds::Writer::Error::CLOSED);
 }
 
+/// This tests @c SharedDataStream::Writer::setSpaceAvailableCallback().
+TEST_F(SharedDataStreamTest, writerSpaceAvailableCallback) {
+    static const size_t WORDSIZE = 1;
+    static const size_t WORDCOUNT = 4;
+    static const size_t MAXREADERS = 1;
+
+    // Initialize an sds.
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+
+    // Create a writer which counts its callbacks, and a reader.
+    auto writer = sds->createWriter(Sds::Writer::Policy::ALL_OR_NOTHING);
+    ASSERT_NE(writer, nullptr);
+    size_t callbacks = 0;
+    writer->setSpaceAvailableCallback([&callbacks] { ++callbacks; });
+    auto reader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+
+    // Verify that reading data does not call the callback until a write has returned WOULDBLOCK.
+    uint8_t writeBuf[WORDSIZE * WORDCOUNT];
+    uint8_t readBuf[WORDSIZE * WORDCOUNT];
+    ASSERT_EQ(writer->write(writeBuf, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(reader->read(readBuf, 1), 1);
+    EXPECT_EQ(callbacks, 0U);
+    ASSERT_EQ(writer->write(writeBuf, 1), 1);
+    ASSERT_EQ(writer->write(writeBuf, 1), Sds::Writer::Error::WOULDBLOCK);
+    EXPECT_EQ(callbacks, 0U);
+
+    // Verify that the next read calls the callback once.
+    ASSERT_EQ(reader->read(readBuf, 1), 1);
+    EXPECT_EQ(callbacks, 1U);
+    ASSERT_EQ(reader->read(readBuf, 1), 1);
+    EXPECT_EQ(callbacks, 1U);
+
+    // Verify that a cleared callback is not called.
+    ASSERT_EQ(writer->write(writeBuf, 2), 2);
+    ASSERT_EQ(writer->write(writeBuf, 1), Sds::Writer::Error::WOULDBLOCK);
+    writer->setSpaceAvailableCallback(nullptr);
+    ASSERT_EQ(reader->read(readBuf, 1), 1);
+    EXPECT_EQ(callbacks, 1U);
+}
+
 /// This tests @c SharedDataStream::Writer::getWordSize().
 TEST_F(SharedDataStreamTest, writerGetWordSize) {
     static const size_t MINWORDSIZE = 1;
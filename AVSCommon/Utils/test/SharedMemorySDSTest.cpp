@@ -0,0 +1,247 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file SharedMemorySDSTest.cpp
+
+#ifdef SHARED_MEMORY_SDS_SUPPORTED
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/SDS/SharedMemorySDS.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+namespace test {
+
+/// For brevity in the tests below, alias the SDS type under test.
+using Sds = SharedMemorySDS;
+
+/// Word size used by the tests (16-bit PCM samples).
+static const size_t WORDSIZE = 2;
+
+/// Number of words in the stream used by the tests.  This is deliberately smaller than @c STREAM_WORDS so that the
+/// writer has to wait for the reader.
+static const size_t BUFFER_WORDS = 1000;
+
+/// Number of words streamed between processes.
+static const size_t STREAM_WORDS = 100000;
+
+/// Number of words written per @c write() call.
+static const size_t WRITE_BLOCK_WORDS = 160;
+
+/// Timeout used when waiting for things which are expected to happen.
+static const std::chrono::seconds LONG_TIMEOUT{5};
+
+/// Timeout used when waiting for things which are not expected to happen.
+static const std::chrono::milliseconds SHORT_TIMEOUT{50};
+
+/// Exit code used by child processes to report success.
+static const int CHILD_SUCCESS = 0;
+
+/// Exit code used by child processes to report failure.
+static const int CHILD_FAILURE = 1;
+
+/**
+ * Generates a shared memory object name which is unique to this process.
+ *
+ * @param suffix A suffix to distinguish names within a test.
+ * @return The name.
+ */
+static std::string uniqueName(const std::string& suffix) {
+    return "/SharedMemorySDSTest-" + std::to_string(getpid()) + "-" + suffix;
+}
+
+/**
+ * Waits for a child process to exit.
+ *
+ * @param pid The child process.
+ * @return The exit code of the child, or -1 if it did not exit normally.
+ */
+static int waitForChild(pid_t pid) {
+    int status = 0;
+    if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status)) {
+        return -1;
+    }
+    return WEXITSTATUS(status);
+}
+
+/**
+ * Body of the child process in @c streamBetweenProcesses.  It attaches to the named stream and writes
+ * @c STREAM_WORDS incrementing words to it.
+ *
+ * @param name The name of the stream.
+ * @return The exit code for the child process.
+ */
+static int writeFromChild(const std::string& name) {
+    auto buffer = SharedMemoryBuffer::open(name);
+    if (!buffer) {
+        return CHILD_FAILURE;
+    }
+    auto sds = Sds::open(buffer);
+    if (!sds) {
+        return CHILD_FAILURE;
+    }
+    auto writer = sds->createWriter(Sds::Writer::Policy::BLOCKING);
+    if (!writer) {
+        return CHILD_FAILURE;
+    }
+    std::vector<uint16_t> block(WRITE_BLOCK_WORDS);
+    uint16_t counter = 0;
+    size_t written = 0;
+    while (written < STREAM_WORDS) {
+        auto blockWords = std::min(block.size(), STREAM_WORDS - written);
+        for (size_t i = 0; i < blockWords; ++i) {
+            block[i] = counter++;
+        }
+        size_t offset = 0;
+        while (offset < blockWords) {
+            auto nWords = writer->write(block.data() + offset, blockWords - offset, LONG_TIMEOUT);
+            if (nWords <= 0) {
+                return CHILD_FAILURE;
+            }
+            offset += nWords;
+        }
+        written += blockWords;
+    }
+    writer->close();
+    return CHILD_SUCCESS;
+}
+
+/// The test harness for the tests below.
+class SharedMemorySDSTest : public ::testing::Test {};
+
+/// Verify that named buffers can be opened by name, and that names are exclusive and released on destruction.
+TEST_F(SharedMemorySDSTest, namedBufferLifecycle) {
+    static const size_t SIZE = 4096;
+    auto name = uniqueName("lifecycle");
+    ASSERT_FALSE(SharedMemoryBuffer::open(name));
+
+    auto created = SharedMemoryBuffer::create(name, SIZE);
+    ASSERT_TRUE(created);
+    ASSERT_EQ(created->size(), SIZE);
+    ASSERT_EQ(created->name(), name);
+    ASSERT_FALSE(SharedMemoryBuffer::create(name, SIZE));
+
+    auto opened = SharedMemoryBuffer::open(name);
+    ASSERT_TRUE(opened);
+    ASSERT_EQ(opened->size(), SIZE);
+    created->data()[SIZE - 1] = 0x5a;
+    ASSERT_EQ(opened->data()[SIZE - 1], 0x5a);
+
+    created.reset();
+    ASSERT_FALSE(SharedMemoryBuffer::open(name));
+    ASSERT_EQ(opened->data()[SIZE - 1], 0x5a);
+}
+
+/// Verify that a @c SharedMemorySDS with an anonymous buffer works as a drop-in replacement for @c InProcessSDS.
+TEST_F(SharedMemorySDSTest, anonymousBufferInProcess) {
+    auto buffer = std::make_shared<Sds::Buffer>(Sds::calculateBufferSize(BUFFER_WORDS, WORDSIZE, 1));
+    auto sds = Sds::create(buffer, WORDSIZE, 1);
+    ASSERT_TRUE(sds);
+    auto writer = sds->createWriter(Sds::Writer::Policy::NONBLOCKABLE);
+    ASSERT_TRUE(writer);
+    auto reader = sds->createReader(Sds::Reader::Policy::BLOCKING);
+    ASSERT_TRUE(reader);
+
+    uint16_t word = 0;
+    ASSERT_EQ(reader->read(&word, 1, SHORT_TIMEOUT), Sds::Reader::Error::TIMEDOUT);
+
+    auto readResult = std::async(std::launch::async, [&reader] {
+        uint16_t word = 0;
+        auto nWords = reader->read(&word, 1, LONG_TIMEOUT);
+        return nWords == 1 ? word : 0;
+    });
+    std::this_thread::sleep_for(SHORT_TIMEOUT);
+    word = 0x1234;
+    ASSERT_EQ(writer->write(&word, 1), 1);
+    ASSERT_EQ(readResult.get(), word);
+}
+
+/// Verify that a stream written by one process can be read by another, with both sides blocking on each other.
+TEST_F(SharedMemorySDSTest, streamBetweenProcesses) {
+    auto name = uniqueName("stream");
+    auto buffer = SharedMemoryBuffer::create(name, Sds::calculateBufferSize(BUFFER_WORDS, WORDSIZE, 1));
+    ASSERT_TRUE(buffer);
+    auto sds = Sds::create(buffer, WORDSIZE, 1);
+    ASSERT_TRUE(sds);
+    auto reader = sds->createReader(Sds::Reader::Policy::BLOCKING);
+    ASSERT_TRUE(reader);
+
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    if (0 == pid) {
+        _exit(writeFromChild(name));
+    }
+
+    std::vector<uint16_t> block(WRITE_BLOCK_WORDS);
+    uint16_t expected = 0;
+    size_t total = 0;
+    bool dataValid = true;
+    ssize_t nWords = 0;
+    while ((nWords = reader->read(block.data(), block.size(), LONG_TIMEOUT)) > 0) {
+        for (ssize_t i = 0; i < nWords; ++i) {
+            dataValid = dataValid && (block[i] == expected++);
+        }
+        total += nWords;
+    }
+
+    ASSERT_EQ(waitForChild(pid), CHILD_SUCCESS);
+    EXPECT_EQ(nWords, Sds::Reader::Error::CLOSED);
+    EXPECT_EQ(total, STREAM_WORDS);
+    EXPECT_TRUE(dataValid);
+}
+
+/// Verify that a mutex held by a process which dies can still be locked by another process.
+TEST_F(SharedMemorySDSTest, mutexRecoversFromDeadOwner) {
+    auto buffer = std::make_shared<SharedMemoryBuffer>(sizeof(ProcessSharedMutex));
+    ASSERT_EQ(buffer->size(), sizeof(ProcessSharedMutex));
+    auto mutex = new (buffer->data()) ProcessSharedMutex;
+
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    if (0 == pid) {
+        // Exit while holding the lock.
+        mutex->lock();
+        _exit(CHILD_SUCCESS);
+    }
+    ASSERT_EQ(waitForChild(pid), CHILD_SUCCESS);
+
+    ASSERT_TRUE(mutex->try_lock());
+    mutex->unlock();
+    mutex->lock();
+    mutex->unlock();
+    mutex->~ProcessSharedMutex();
+}
+
+}  // namespace test
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // SHARED_MEMORY_SDS_SUPPORTED
@@ -172,6 +172,32 @@ TEST_F(StreamFunctionsTest, tellgAfterReading) {
     ASSERT_EQ(numberToRead, m_stream->tellg());
 }
 
+/**
+ * Verify that the data behind a stream is found, however far the stream has been read
+ */
+TEST_F(StreamFunctionsTest, dataFromStream) {
+    char c;
+    m_stream->get(c);
+
+    const unsigned char* data = nullptr;
+    size_t length = 0;
+    ASSERT_TRUE(stream::dataFromStream(*m_stream, &data, &length));
+    ASSERT_EQ(TEST_DATA, data);
+    ASSERT_EQ(sizeof(TEST_DATA), length);
+}
+
+/**
+ * Verify that no data is found behind a stream which was not created by streamFromData
+ */
+TEST_F(StreamFunctionsTest, dataFromOtherStream) {
+    std::istringstream stream("TEST_DATA");
+
+    const unsigned char* data = nullptr;
+    size_t length = 0;
+    ASSERT_FALSE(stream::dataFromStream(stream, &data, &length));
+    ASSERT_EQ(nullptr, data);
+}
+
 }  // namespace test
 }  // namespace utils
 }  // namespace avsCommon
@@ -0,0 +1,173 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Threading/TaskFunction.h"
+#include "AVSCommon/Utils/Threading/TaskQueue.h"
+
+/// Whether allocations are being counted.
+static std::atomic<bool> g_countAllocations(false);
+
+/// The number of allocations made while @c g_countAllocations was set.
+static std::atomic<size_t> g_allocationCount(0);
+
+/// Replacement global operator new which counts allocations.
+void* operator new(std::size_t size) {
+    if (g_countAllocations) {
+        ++g_allocationCount;
+    }
+    if (void* memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+/*
+ * Replacement global operator delete to match the replacement operator new.  GCC reports the call to free() as
+ * mismatched once this is inlined where the memory was allocated with new, although both replacements use malloc().
+ */
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+namespace test {
+
+/// Number of tasks pushed through the queue in the allocation test.
+static const int ALLOCATION_TEST_TASKS = 1000;
+
+/**
+ * Counts the allocations made by a function.
+ *
+ * @param function The function to call.
+ * @return The number of allocations made.
+ */
+template <typename Function>
+static size_t countAllocations(Function function) {
+    g_allocationCount = 0;
+    g_countAllocations = true;
+    function();
+    g_countAllocations = false;
+    return g_allocationCount;
+}
+
+/// A callable which can be moved but not copied.
+struct MoveOnlyIncrement {
+    /// The value to increment.
+    std::unique_ptr<int> value;
+
+    /// Increments the value.
+    void operator()() {
+        ++*value;
+    }
+};
+
+/// The test harness for the tests below.
+class TaskFunctionTest : public ::testing::Test {};
+
+/// Verify that small callables are stored inline, and large ones on the heap.
+TEST_F(TaskFunctionTest, storage) {
+    int value = 0;
+    auto small = [&value] { ++value; };
+    std::array<char, TaskFunction::INLINE_SIZE + 1> padding{};
+    auto large = [&value, padding] { value += padding.size(); };
+    EXPECT_TRUE(TaskFunction::isStoredInline<decltype(small)>());
+    EXPECT_FALSE(TaskFunction::isStoredInline<decltype(large)>());
+
+    auto smallAllocations = countAllocations([&] {
+        TaskFunction function(small);
+        function();
+    });
+    auto largeAllocations = countAllocations([&] {
+        TaskFunction function(large);
+        function();
+    });
+    EXPECT_EQ(smallAllocations, 0U);
+    EXPECT_EQ(largeAllocations, 1U);
+    EXPECT_EQ(value, static_cast<int>(1 + padding.size()));
+}
+
+/// Verify that move-only callables are supported, and that moving transfers the callable.
+TEST_F(TaskFunctionTest, moveOnlyCallable) {
+    std::unique_ptr<int> pointer(new int(0));
+    auto raw = pointer.get();
+    TaskFunction function(MoveOnlyIncrement{std::move(pointer)});
+    ASSERT_TRUE(static_cast<bool>(function));
+
+    TaskFunction moved(std::move(function));
+    EXPECT_FALSE(static_cast<bool>(function));
+    ASSERT_TRUE(static_cast<bool>(moved));
+    moved();
+    EXPECT_EQ(*raw, 1);
+
+    function = std::move(moved);
+    function();
+    EXPECT_EQ(*raw, 2);
+    function.reset();
+    EXPECT_FALSE(static_cast<bool>(function));
+}
+
+/// Verify that captured objects are destroyed with the @c TaskFunction.
+TEST_F(TaskFunctionTest, destroysCallable) {
+    auto shared = std::make_shared<int>(0);
+    {
+        TaskFunction function([shared] {});
+        EXPECT_EQ(shared.use_count(), 2);
+        TaskFunction moved(std::move(function));
+        EXPECT_EQ(shared.use_count(), 2);
+    }
+    EXPECT_EQ(shared.use_count(), 1);
+}
+
+/// Verify that once warmed up, a @c TaskQueue can queue and run detached tasks without allocating memory.
+TEST_F(TaskFunctionTest, detachedTasksDoNotAllocate) {
+    TaskQueue queue;
+    int counter = 0;
+    // Warm up the queue's pool of nodes.
+    ASSERT_TRUE(queue.pushDetached([&counter] { ++counter; }));
+    queue.pop()->operator()();
+
+    auto allocations = countAllocations([&] {
+        for (int i = 0; i < ALLOCATION_TEST_TASKS; ++i) {
+            queue.pushDetached([&counter, i] { counter += i; });
+            queue.pop()->operator()();
+        }
+    });
+    EXPECT_EQ(allocations, 0U);
+    EXPECT_EQ(counter, 1 + ALLOCATION_TEST_TASKS * (ALLOCATION_TEST_TASKS - 1) / 2);
+}
+
+}  // namespace test
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
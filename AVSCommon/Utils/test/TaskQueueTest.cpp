@@ -277,6 +277,21 @@ TEST_F(TaskQueueTest, pushFailsToEnqueueANewTaskOnAShutdownQueue) {
     ASSERT_EQ(retrievedTask, nullptr);
 }
 
+TEST_F(TaskQueueTest, tryPopReturnsTasksWithoutBlocking) {
+    // An empty queue returns immediately
+    ASSERT_EQ(queue.tryPop(), nullptr);
+
+    auto future = queue.push(TASK, VALUE);
+    auto task = queue.tryPop();
+    ASSERT_NE(task, nullptr);
+    ASSERT_EQ(queue.tryPop(), nullptr);
+
+    task->operator()();
+    auto future_status = future.wait_for(SHORT_TIMEOUT_MS);
+    ASSERT_EQ(future_status, std::future_status::ready);
+    ASSERT_EQ(future.get(), VALUE);
+}
+
 }  // namespace test
 }  // namespace threading
 }  // namespace utils
@@ -0,0 +1,408 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Memory/Memory.h"
+#include "AVSCommon/Utils/Timing/Timer.h"
+#include "AVSCommon/Utils/Timing/TimerService.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+namespace test {
+
+using namespace std::chrono;
+
+/// A fine tick, so that the tests exercise every level of the wheel within a fraction of a second.
+static const microseconds FINE_TICK{1};
+
+/// Timeout used when waiting for callbacks which should run.
+static const seconds LONG_TIMEOUT{5};
+
+/// A short idle timeout, so that surplus dispatch threads exit quickly.
+static const milliseconds IDLE_THREAD_TIMEOUT{20};
+
+/// Number of timers scheduled and cancelled by the benchmark.
+static const size_t BENCHMARK_TIMERS = 100000;
+
+/// Number of @c Timers used to measure threads, roughly the number kept alive by a @c DefaultClient.
+static const size_t BENCHMARK_THREAD_TIMERS = 20;
+
+/**
+ * Reads a field from /proc/self/status.
+ *
+ * @param field The name of the field, including the trailing ':'.
+ * @return The numeric value of the field, or 0 if it is not available.
+ */
+static size_t readProcStatus(const std::string& field) {
+    std::ifstream status("/proc/self/status");
+    std::string name;
+    while (status >> name) {
+        if (name == field) {
+            size_t value = 0;
+            status >> value;
+            return value;
+        }
+        status.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+    return 0;
+}
+
+/// The test harness for the tests below.
+class TimerServiceTest : public ::testing::Test {
+public:
+    /// Constructor.
+    TimerServiceTest() : service{TimerService::create(FINE_TICK)}, calls{0} {
+    }
+
+    /**
+     * Returns a callback which records @c index and the time it ran.
+     *
+     * @param index The value to record.
+     * @return The callback.
+     */
+    std::function<void()> record(size_t index) {
+        return [this, index] {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(index);
+            times.push_back(steady_clock::now());
+            ++calls;
+            wakeTrigger.notify_all();
+        };
+    }
+
+    /**
+     * Waits for a number of callbacks to have run.
+     *
+     * @param count The number of callbacks.
+     * @return Whether @c count callbacks ran before @c LONG_TIMEOUT.
+     */
+    bool waitForCalls(size_t count) {
+        std::unique_lock<std::mutex> lock(mutex);
+        return wakeTrigger.wait_for(lock, LONG_TIMEOUT, [this, count] { return calls >= count; });
+    }
+
+    /// The service under test.
+    std::shared_ptr<TimerService> service;
+
+    /// Protects the members below.
+    std::mutex mutex;
+
+    /// Notified when a callback runs.
+    std::condition_variable wakeTrigger;
+
+    /// The number of callbacks which have run.
+    size_t calls;
+
+    /// The indices recorded by callbacks, in the order they ran.
+    std::vector<size_t> order;
+
+    /// The times at which callbacks ran.
+    std::vector<steady_clock::time_point> times;
+};
+
+/// Verify that callbacks run in deadline order, and not before their deadlines.
+TEST_F(TimerServiceTest, runsInDeadlineOrder) {
+    // Deadlines from tens of microseconds to a few hundred milliseconds cover all four levels of the wheel.
+    std::vector<microseconds> delays = {microseconds(300000),
+                                        microseconds(50),
+                                        microseconds(70000),
+                                        microseconds(3000),
+                                        microseconds(5),
+                                        microseconds(262144),
+                                        microseconds(4096),
+                                        microseconds(200)};
+    std::vector<std::unique_ptr<TimerService::Handle>> handles;
+    std::vector<steady_clock::time_point> deadlines;
+    auto start = steady_clock::now();
+    for (size_t i = 0; i < delays.size(); ++i) {
+        handles.push_back(service->createHandle());
+        deadlines.push_back(start + delays[i]);
+        service->schedule(handles.back().get(), deadlines.back(), record(i));
+    }
+    ASSERT_TRUE(waitForCalls(delays.size()));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (size_t i = 0; i < order.size(); ++i) {
+        EXPECT_GE(times[i], deadlines[order[i]]);
+        if (i > 0) {
+            EXPECT_LE(delays[order[i - 1]], delays[order[i]]);
+        }
+    }
+    EXPECT_EQ(service->getPendingCount(), 0u);
+}
+
+/// Verify that many randomly timed callbacks all run, none of them early.
+TEST_F(TimerServiceTest, randomDeadlines) {
+    static const size_t count = 2000;
+    std::mt19937 random(1);
+    std::uniform_int_distribution<int> delayDistribution(0, 500000);
+    std::vector<std::unique_ptr<TimerService::Handle>> handles;
+    std::vector<steady_clock::time_point> deadlines;
+    auto start = steady_clock::now();
+    for (size_t i = 0; i < count; ++i) {
+        handles.push_back(service->createHandle());
+        deadlines.push_back(start + microseconds(delayDistribution(random)));
+        service->schedule(handles.back().get(), deadlines.back(), record(i));
+    }
+    ASSERT_TRUE(waitForCalls(count));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (size_t i = 0; i < order.size(); ++i) {
+        EXPECT_GE(times[i], deadlines[order[i]]);
+    }
+}
+
+/// Verify that a deadline beyond the span of the wheel is handled.
+TEST_F(TimerServiceTest, beyondWheelSpan) {
+    // With a 10ns tick the wheel spans about 168ms.
+    auto coarseService = TimerService::create(nanoseconds(10));
+    auto handle = coarseService->createHandle();
+    auto deadline = steady_clock::now() + milliseconds(400);
+    coarseService->schedule(handle.get(), deadline, record(0));
+    ASSERT_TRUE(waitForCalls(1));
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_GE(times[0], deadline);
+}
+
+/// Verify that a cancelled callback does not run, and that cancel() reports whether anything was pending.
+TEST_F(TimerServiceTest, cancel) {
+    auto cancelled = service->createHandle();
+    auto kept = service->createHandle();
+    service->schedule(cancelled.get(), steady_clock::now() + milliseconds(20), record(0));
+    service->schedule(kept.get(), steady_clock::now() + milliseconds(40), record(1));
+    EXPECT_TRUE(service->cancel(cancelled.get()));
+    EXPECT_FALSE(service->cancel(cancelled.get()));
+    ASSERT_TRUE(waitForCalls(1));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(order.size(), 1u);
+    EXPECT_EQ(order[0], 1u);
+}
+
+/// Verify that scheduling a pending handle replaces its callback.
+TEST_F(TimerServiceTest, rescheduleReplaces) {
+    auto handle = service->createHandle();
+    service->schedule(handle.get(), steady_clock::now() + milliseconds(20), record(0));
+    service->schedule(handle.get(), steady_clock::now() + milliseconds(10), record(1));
+    EXPECT_EQ(service->getPendingCount(), 1u);
+    ASSERT_TRUE(waitForCalls(1));
+    std::this_thread::sleep_for(milliseconds(40));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ASSERT_EQ(order.size(), 1u);
+    EXPECT_EQ(order[0], 1u);
+}
+
+/// Verify that a past deadline runs promptly, even when the dispatch thread is waiting for a later one.
+TEST_F(TimerServiceTest, pastDeadlineWakesDispatcher) {
+    auto later = service->createHandle();
+    auto now = service->createHandle();
+    service->schedule(later.get(), steady_clock::now() + seconds(10), record(0));
+    std::this_thread::sleep_for(milliseconds(10));
+    service->schedule(now.get(), steady_clock::now() - seconds(1), record(1));
+    ASSERT_TRUE(waitForCalls(1));
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_EQ(order[0], 1u);
+}
+
+/// Verify that cancel() waits for a running callback, including any schedule it makes on the same handle.
+TEST_F(TimerServiceTest, cancelWaitsForRunningCallback) {
+    auto handle = service->createHandle();
+    std::atomic<bool> running{false};
+    std::atomic<bool> finished{false};
+    std::atomic<int> rescheduledCalls{0};
+    service->schedule(handle.get(), steady_clock::now(), [&] {
+        running = true;
+        std::this_thread::sleep_for(milliseconds(50));
+        service->schedule(handle.get(), steady_clock::now(), [&] { ++rescheduledCalls; });
+        finished = true;
+    });
+    while (!running) {
+        std::this_thread::yield();
+    }
+    service->cancel(handle.get());
+    EXPECT_TRUE(finished);
+    std::this_thread::sleep_for(milliseconds(20));
+    EXPECT_EQ(rescheduledCalls, 0);
+}
+
+/// Verify that a callback may destroy its own handle.
+TEST_F(TimerServiceTest, callbackDestroysOwnHandle) {
+    auto handle = service->createHandle().release();
+    service->schedule(handle, steady_clock::now(), [this, handle] {
+        delete handle;
+        record(0)();
+    });
+    ASSERT_TRUE(waitForCalls(1));
+}
+
+/// Verify that destroying a handle cancels its callback.
+TEST_F(TimerServiceTest, destroyingHandleCancels) {
+    auto handle = service->createHandle();
+    service->schedule(handle.get(), steady_clock::now() + milliseconds(10), record(0));
+    handle.reset();
+    EXPECT_EQ(service->getPendingCount(), 0u);
+    std::this_thread::sleep_for(milliseconds(30));
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_TRUE(order.empty());
+}
+
+/// Measure the cost of scheduling and cancelling @c BENCHMARK_TIMERS timers.  Disabled by default.
+TEST_F(TimerServiceTest, DISABLED_benchmarkScheduleAndCancel) {
+    auto millisecondService = TimerService::create();
+    std::mt19937 random(1);
+    std::uniform_int_distribution<int> delayDistribution(1000, 3600000);
+    std::vector<std::unique_ptr<TimerService::Handle>> handles;
+    std::vector<steady_clock::time_point> deadlines;
+    handles.reserve(BENCHMARK_TIMERS);
+    deadlines.reserve(BENCHMARK_TIMERS);
+    auto now = steady_clock::now();
+    for (size_t i = 0; i < BENCHMARK_TIMERS; ++i) {
+        handles.push_back(millisecondService->createHandle());
+        deadlines.push_back(now + milliseconds(delayDistribution(random)));
+    }
+
+    auto start = steady_clock::now();
+    for (size_t i = 0; i < BENCHMARK_TIMERS; ++i) {
+        millisecondService->schedule(handles[i].get(), deadlines[i], [] {});
+    }
+    auto scheduled = steady_clock::now();
+    EXPECT_EQ(millisecondService->getPendingCount(), BENCHMARK_TIMERS);
+    for (size_t i = 0; i < BENCHMARK_TIMERS; ++i) {
+        millisecondService->cancel(handles[i].get());
+    }
+    auto cancelled = steady_clock::now();
+    EXPECT_EQ(millisecondService->getPendingCount(), 0u);
+
+    auto scheduleNs = duration_cast<nanoseconds>(scheduled - start).count();
+    auto cancelNs = duration_cast<nanoseconds>(cancelled - scheduled).count();
+    RecordProperty("scheduleNsEach", std::to_string(scheduleNs / static_cast<long>(BENCHMARK_TIMERS)));
+    RecordProperty("cancelNsEach", std::to_string(cancelNs / static_cast<long>(BENCHMARK_TIMERS)));
+}
+
+/**
+ * Measure the threads used by @c BENCHMARK_THREAD_TIMERS running @c Timers.  Disabled by default, since it counts the
+ * threads of the whole process.
+ */
+TEST_F(TimerServiceTest, DISABLED_benchmarkTimerThreads) {
+    // Make sure the shared service has run a callback, and so has its usual threads, before taking the baseline.
+    std::promise<void> ready;
+    Timer warmUp;
+    warmUp.start(milliseconds(0), [&ready] { ready.set_value(); });
+    ready.get_future().wait();
+    auto baseThreads = readProcStatus("Threads:");
+    {
+        std::vector<std::unique_ptr<Timer>> timers;
+        for (size_t i = 0; i < BENCHMARK_THREAD_TIMERS; ++i) {
+            timers.push_back(memory::make_unique<Timer>());
+            timers.back()->start(milliseconds(1), Timer::PeriodType::ABSOLUTE, Timer::FOREVER, [] {});
+        }
+        std::this_thread::sleep_for(milliseconds(100));
+        RecordProperty("extraThreads", std::to_string(readProcStatus("Threads:") - baseThreads));
+        EXPECT_EQ(readProcStatus("Threads:"), baseThreads);
+    }
+}
+
+/// Verify that a callback which blocks does not delay callbacks on other handles.
+TEST_F(TimerServiceTest, blockingCallbackDoesNotDelayOthers) {
+    auto blocking = service->createHandle();
+    auto other = service->createHandle();
+    std::promise<void> release;
+    auto released = release.get_future();
+    service->schedule(blocking.get(), steady_clock::now(), [&released] { released.wait(); });
+    service->schedule(other.get(), steady_clock::now() + milliseconds(5), record(0));
+    EXPECT_TRUE(waitForCalls(1));
+    release.set_value();
+    service->cancel(blocking.get());
+}
+
+/// Verify that dispatch threads started while callbacks were blocked exit once they have been idle for a while.
+TEST_F(TimerServiceTest, idleThreadsExit) {
+    static const size_t BLOCKING_CALLBACKS = 4;
+    auto shortIdleService = TimerService::create(FINE_TICK, IDLE_THREAD_TIMEOUT);
+    ASSERT_NE(shortIdleService, nullptr);
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::vector<std::unique_ptr<TimerService::Handle>> handles;
+    for (size_t i = 0; i < BLOCKING_CALLBACKS; ++i) {
+        handles.push_back(shortIdleService->createHandle());
+        shortIdleService->schedule(handles.back().get(), steady_clock::now(), [released, this] {
+            record(0)();
+            released.wait();
+        });
+    }
+    ASSERT_TRUE(waitForCalls(BLOCKING_CALLBACKS));
+    EXPECT_GT(shortIdleService->getThreadCount(), BLOCKING_CALLBACKS);
+    release.set_value();
+
+    // One thread watches the wheel and one stays idle; the rest should exit.
+    auto deadline = steady_clock::now() + LONG_TIMEOUT;
+    while (shortIdleService->getThreadCount() > 2 && steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(IDLE_THREAD_TIMEOUT);
+    }
+    EXPECT_EQ(shortIdleService->getThreadCount(), 2u);
+
+    // The remaining threads still run callbacks.
+    auto handle = shortIdleService->createHandle();
+    shortIdleService->schedule(handle.get(), steady_clock::now(), record(1));
+    EXPECT_TRUE(waitForCalls(BLOCKING_CALLBACKS + 1));
+    handles.clear();
+}
+
+/// Verify that a callback which falls due while the previous one on the same handle is running waits for it.
+TEST_F(TimerServiceTest, callbacksOnOneHandleDoNotOverlap) {
+    auto handle = service->createHandle();
+    std::atomic<int> running{0};
+    std::atomic<int> maxRunning{0};
+    std::atomic<int> runs{0};
+    std::function<void()> callback;
+    callback = [&] {
+        int now = ++running;
+        if (now > maxRunning) {
+            maxRunning = now;
+        }
+        // Reschedule while still running, so the next call falls due before this one returns.
+        if (++runs < 5) {
+            service->schedule(handle.get(), steady_clock::now(), callback);
+        }
+        std::this_thread::sleep_for(milliseconds(10));
+        --running;
+        record(0)();
+    };
+    service->schedule(handle.get(), steady_clock::now(), callback);
+    ASSERT_TRUE(waitForCalls(5));
+    EXPECT_EQ(maxRunning, 1);
+}
+
+}  // namespace test
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
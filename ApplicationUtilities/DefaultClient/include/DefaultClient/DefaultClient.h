@@ -49,6 +49,7 @@
 #include <AVSCommon/Utils/LibcurlUtils/HTTPContentFetcherFactory.h>
 #include <AVSCommon/Utils/MediaPlayer/MediaPlayerInterface.h>
 #include <AVSCommon/Utils/Network/InternetConnectionMonitor.h>
+#include <AVSCommon/Utils/Threading/ExecutorPool.h>
 #include <Bluetooth/Bluetooth.h>
 #include <Bluetooth/BluetoothStorageInterface.h>
 #include <CertifiedSender/CertifiedSender.h>
@@ -630,6 +631,10 @@ private:
         bool sendSoftwareInfoOnConnected,
         std::shared_ptr<avsCommon::sdkInterfaces::SoftwareInfoSenderObserverInterface> softwareInfoSenderObserver);
 
+    /// The pool of threads shared by the @c Executors of the components created by this client, or @c nullptr if
+    /// each component runs its own thread.
+    std::shared_ptr<avsCommon::utils::threading::ExecutorPool> m_executorPool;
+
     /// The directive sequencer.
     std::shared_ptr<avsCommon::sdkInterfaces::DirectiveSequencerInterface> m_directiveSequencer;
 
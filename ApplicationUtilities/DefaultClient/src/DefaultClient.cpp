@@ -18,6 +18,9 @@
 #include <AVSCommon/AVS/Attachment/AttachmentManager.h>
 #include <AVSCommon/AVS/ExceptionEncounteredSender.h>
 #include <AVSCommon/Utils/Bluetooth/BluetoothEventBus.h>
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
+#include <AVSCommon/Utils/File/AssetCache.h>
+#include <AVSCommon/Utils/LibcurlUtils/HTTPContentFetcherFactory.h>
 
 #ifdef ENABLE_COMMS
 #include <CallManager/CallManager.h>
@@ -56,6 +59,15 @@ static const std::string TAG("DefaultClient");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+/// Key for the root node of the executor pool configuration.
+static const std::string EXECUTOR_POOL_CONFIGURATION_ROOT_KEY = "executorPool";
+
+/// Key for the number of threads in the executor pool.
+static const std::string EXECUTOR_POOL_NUM_THREADS_KEY = "numThreads";
+
+/// The default number of threads in the executor pool.  Zero gives each component its own thread.
+static const int DEFAULT_EXECUTOR_POOL_THREADS = 0;
+
 std::unique_ptr<DefaultClient> DefaultClient::create(
     std::shared_ptr<avsCommon::utils::DeviceInfo> deviceInfo,
     std::shared_ptr<registrationManager::CustomerDataManager> customerDataManager,
@@ -237,6 +249,24 @@ bool DefaultClient::initialize(
         return false;
     }
 
+    /*
+     * Creating the executor pool - If configured, the components created below run their asynchronous work on a
+     * shared pool of threads rather than a thread each.  By default, each component keeps its own thread.
+     *
+     * The pool is installed as the default for every Executor constructed on this thread until initialize returns.
+     * A component whose executor tasks block (on media, the network, or a future of another component on the pool)
+     * must be created inside a ScopedDefault(nullptr) block below, since its waits would tie up pool workers and can
+     * deadlock a pool with few threads.
+     */
+    int numExecutorThreads = 0;
+    avsCommon::utils::configuration::ConfigurationNode::getRoot()[EXECUTOR_POOL_CONFIGURATION_ROOT_KEY].getInt(
+        EXECUTOR_POOL_NUM_THREADS_KEY, &numExecutorThreads, DEFAULT_EXECUTOR_POOL_THREADS);
+    if (numExecutorThreads > 0) {
+        m_executorPool = avsCommon::utils::threading::ExecutorPool::create(numExecutorThreads);
+    }
+    ACSDK_INFO(LX("initialize").d("executorPoolThreads", m_executorPool ? m_executorPool->getNumThreads() : 0));
+    avsCommon::utils::threading::ExecutorPool::ScopedDefault scopedExecutorPool(m_executorPool);
+
     m_dialogUXStateAggregator = std::make_shared<avsCommon::avs::DialogUXStateAggregator>();
 
     for (auto observer : alexaDialogStateObservers) {
@@ -371,15 +401,19 @@ bool DefaultClient::initialize(
 
     /*
      * Creating the Speech Synthesizer - This component is the Capability Agent that implements the SpeechSynthesizer
-     * interface of AVS.
+     * interface of AVS.  It blocks inside its executor tasks while waiting for media player state changes, so it
+     * keeps its own thread rather than tying up a worker of the executor pool.
      */
-    m_speechSynthesizer = capabilityAgents::speechSynthesizer::SpeechSynthesizer::create(
-        speakMediaPlayer,
-        m_connectionManager,
-        m_audioFocusManager,
-        contextManager,
-        m_exceptionSender,
-        m_dialogUXStateAggregator);
+    {
+        avsCommon::utils::threading::ExecutorPool::ScopedDefault dedicatedThreads(nullptr);
+        m_speechSynthesizer = capabilityAgents::speechSynthesizer::SpeechSynthesizer::create(
+            speakMediaPlayer,
+            m_connectionManager,
+            m_audioFocusManager,
+            contextManager,
+            m_exceptionSender,
+            m_dialogUXStateAggregator);
+    }
     if (!m_speechSynthesizer) {
         ACSDK_ERROR(LX("initializeFailed").d("reason", "unableToCreateSpeechSynthesizer"));
         return false;
@@ -410,15 +444,18 @@ bool DefaultClient::initialize(
 
     /*
      * Creating the Audio Player - This component is the Capability Agent that implements the AudioPlayer
-     * interface of AVS.
+     * interface of AVS.  Like the Speech Synthesizer, it blocks inside its executor tasks, so it keeps its own thread.
      */
-    m_audioPlayer = capabilityAgents::audioPlayer::AudioPlayer::create(
-        audioMediaPlayer,
-        m_connectionManager,
-        m_audioFocusManager,
-        contextManager,
-        m_exceptionSender,
-        m_playbackRouter);
+    {
+        avsCommon::utils::threading::ExecutorPool::ScopedDefault dedicatedThreads(nullptr);
+        m_audioPlayer = capabilityAgents::audioPlayer::AudioPlayer::create(
+            audioMediaPlayer,
+            m_connectionManager,
+            m_audioFocusManager,
+            contextManager,
+            m_exceptionSender,
+            m_playbackRouter);
+    }
     if (!m_audioPlayer) {
         ACSDK_ERROR(LX("initializeFailed").d("reason", "unableToCreateAudioPlayer"));
         return false;
@@ -430,15 +467,31 @@ bool DefaultClient::initialize(
 
     /*
      * Creating the SpeakerManager Capability Agent - This component is the Capability Agent that implements the
-     * Speaker interface of AVS.
+     * Speaker interface of AVS.  The Alerts Capability Agent waits for its results inside its own executor tasks, so
+     * it keeps its own thread; otherwise a small executor pool could be filled with tasks waiting for it.
      */
-    m_speakerManager = capabilityAgents::speakerManager::SpeakerManager::create(
-        allSpeakers, contextManager, m_connectionManager, m_exceptionSender);
+    {
+        avsCommon::utils::threading::ExecutorPool::ScopedDefault dedicatedThreads(nullptr);
+        m_speakerManager = capabilityAgents::speakerManager::SpeakerManager::create(
+            allSpeakers, contextManager, m_connectionManager, m_exceptionSender);
+    }
     if (!m_speakerManager) {
         ACSDK_ERROR(LX("initializeFailed").d("reason", "unableToCreateSpeakerManager"));
         return false;
     }
 
+    /*
+     * Creating the asset cache - If it is configured, the audio assets of alerts and notifications are fetched ahead
+     * of time and played from disk.  It downloads inside its executor tasks, so it keeps its own thread.
+     */
+    std::shared_ptr<avsCommon::utils::file::AssetCache> assetCache;
+    {
+        avsCommon::utils::threading::ExecutorPool::ScopedDefault dedicatedThreads(nullptr);
+        assetCache = avsCommon::utils::file::AssetCache::create(
+            avsCommon::utils::configuration::ConfigurationNode::getRoot(),
+            std::make_shared<avsCommon::utils::libcurlUtils::HTTPContentFetcherFactory>());
+    }
+
     /*
      * Creating the Alerts Capability Agent - This component is the Capability Agent that implements the Alerts
      * interface of AVS.
@@ -453,7 +506,7 @@ bool DefaultClient::initialize(
         m_exceptionSender,
         alertStorage,
         audioFactory->alerts(),
-        capabilityAgents::alerts::renderer::Renderer::create(alertsMediaPlayer),
+        capabilityAgents::alerts::renderer::Renderer::create(alertsMediaPlayer, assetCache),
         customerDataManager);
     if (!m_alertsCapabilityAgent) {
         ACSDK_ERROR(LX("initializeFailed").d("reason", "unableToCreateAlertsCapabilityAgent"));
@@ -468,7 +521,7 @@ bool DefaultClient::initialize(
      */
     m_notificationsCapabilityAgent = capabilityAgents::notifications::NotificationsCapabilityAgent::create(
         notificationsStorage,
-        capabilityAgents::notifications::NotificationRenderer::create(notificationsMediaPlayer),
+        capabilityAgents::notifications::NotificationRenderer::create(notificationsMediaPlayer, assetCache),
         contextManager,
         m_exceptionSender,
         audioFactory->notifications(),
@@ -707,19 +760,23 @@ bool DefaultClient::initialize(
 
     /*
      * Creating the Bluetooth Capability Agent - This component is responsible for handling directives from AVS
-     * regarding bluetooth functionality.
+     * regarding bluetooth functionality.  It waits on the host controller inside its executor tasks, so it keeps its
+     * own thread.
      */
-    m_bluetooth = capabilityAgents::bluetooth::Bluetooth::create(
-        contextManager,
-        m_audioFocusManager,
-        m_connectionManager,
-        m_exceptionSender,
-        std::move(bluetoothStorage),
-        std::move(bluetoothDeviceManager),
-        eventBus,
-        bluetoothMediaPlayer,
-        customerDataManager,
-        bluetoothAVRCPTransformer);
+    {
+        avsCommon::utils::threading::ExecutorPool::ScopedDefault dedicatedThreads(nullptr);
+        m_bluetooth = capabilityAgents::bluetooth::Bluetooth::create(
+            contextManager,
+            m_audioFocusManager,
+            m_connectionManager,
+            m_exceptionSender,
+            std::move(bluetoothStorage),
+            std::move(bluetoothDeviceManager),
+            eventBus,
+            bluetoothMediaPlayer,
+            customerDataManager,
+            bluetoothAVRCPTransformer);
+    }
 #endif
 
     /*
@@ -71,6 +71,10 @@ public:
     /// Alias to the @c AudioInputProcessorObserverInterface for brevity.
     using ObserverInterface = avsCommon::sdkInterfaces::AudioInputProcessorObserverInterface;
 
+    /// Alias to the type of attachment reader used to stream from an @c AudioInputStream for brevity.
+    using AudioInputStreamAttachmentReader =
+        avsCommon::avs::attachment::SharedDataStreamAttachmentReader<avsCommon::avs::AudioInputStream>;
+
     /// A reserved @c Index value which is considered invalid.
     static const auto INVALID_INDEX = std::numeric_limits<avsCommon::avs::AudioInputStream::Index>::max();
 
@@ -512,7 +516,7 @@ private:
      * valid during the @c RECOGNIZING state, and is retained by @c AudioInputProcessor so that it can close the
      * stream from @c executeStopCapture().
      */
-    std::shared_ptr<avsCommon::avs::attachment::InProcessAttachmentReader> m_reader;
+    std::shared_ptr<AudioInputStreamAttachmentReader> m_reader;
 
     /**
      * The attachment reader used for the wake word engine metadata. It's is populated by a call to @c
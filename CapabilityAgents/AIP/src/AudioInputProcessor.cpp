@@ -581,14 +581,14 @@ bool AudioInputProcessor::executeRecognize(
     // clang-format on
 
     // Set up an attachment reader for the event.
-    avsCommon::avs::attachment::InProcessAttachmentReader::SDSTypeIndex offset = 0;
-    avsCommon::avs::attachment::InProcessAttachmentReader::SDSTypeReader::Reference reference =
-        avsCommon::avs::attachment::InProcessAttachmentReader::SDSTypeReader::Reference::BEFORE_WRITER;
+    AudioInputStreamAttachmentReader::SDSTypeIndex offset = 0;
+    AudioInputStreamAttachmentReader::SDSTypeReader::Reference reference =
+        AudioInputStreamAttachmentReader::SDSTypeReader::Reference::BEFORE_WRITER;
     if (INVALID_INDEX != begin) {
         offset = begin;
-        reference = avsCommon::avs::attachment::InProcessAttachmentReader::SDSTypeReader::Reference::ABSOLUTE;
+        reference = AudioInputStreamAttachmentReader::SDSTypeReader::Reference::ABSOLUTE;
     }
-    m_reader = avsCommon::avs::attachment::InProcessAttachmentReader::create(
+    m_reader = AudioInputStreamAttachmentReader::create(
         sds::ReaderPolicy::NONBLOCKING, provider.stream, offset, reference);
     if (!m_reader) {
         ACSDK_ERROR(LX("executeRecognizeFailed").d("reason", "Failed to create attachment reader"));
@@ -24,6 +24,7 @@
 #include <set>
 #include <string>
 #include <list>
+#include <unordered_map>
 
 namespace alexaClientSDK {
 namespace capabilityAgents {
@@ -32,6 +33,9 @@ namespace alerts {
 /**
  * This class handles the management of AVS alerts.  This is essentially a time-ordered queue, where a timer is
  * set for the alert which must activate soonest.  As alerts are added or removed, this timer must be reset.
+ *
+ * The scheduled alerts are also indexed by token, so that the directives which refer to alerts by token do not scan
+ * the queue.
  */
 class AlertScheduler : public AlertObserverInterface {
 public:
@@ -227,6 +231,20 @@ private:
      */
     std::shared_ptr<Alert> getAlertLocked(const std::string& token) const;
 
+    /**
+     * A utility function to add an alert to the scheduled alerts.  This function requires @c m_mutex be locked.
+     *
+     * @param alert The alert to be scheduled.
+     */
+    void addScheduledAlertLocked(std::shared_ptr<Alert> alert);
+
+    /**
+     * A utility function to remove an alert from the scheduled alerts.  This function requires @c m_mutex be locked.
+     *
+     * @param alert The alert to be removed.
+     */
+    void removeScheduledAlertLocked(std::shared_ptr<Alert> alert);
+
     /**
      * A utility function to deactivate the currently active alert.  This function requires @c m_mutex be locked.
      *
@@ -260,6 +278,8 @@ private:
     std::shared_ptr<Alert> m_activeAlert;
     /// All alerts which are scheduled to occur, ordered ascending by time.
     std::set<std::shared_ptr<Alert>, alerts::TimeComparator> m_scheduledAlerts;
+    /// The alerts in @c m_scheduledAlerts, by token.
+    std::unordered_map<std::string, std::shared_ptr<Alert>> m_scheduledAlertsByToken;
 
     /// The timer for the next alert to go off, if one is not already active.
     avsCommon::utils::timing::Timer m_scheduledAlertTimer;
@@ -318,7 +318,7 @@ private:
      */
     bool handleSetAlert(
         const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-        const rapidjson::Document& payload,
+        const rapidjson::Value& payload,
         std::string* alertToken);
 
     /**
@@ -332,7 +332,7 @@ private:
      */
     bool handleDeleteAlert(
         const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-        const rapidjson::Document& payload,
+        const rapidjson::Value& payload,
         std::string* alertToken);
 
     /**
@@ -344,7 +344,7 @@ private:
      */
     bool handleDeleteAlerts(
         const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-        const rapidjson::Document& payload);
+        const rapidjson::Value& payload);
 
     /**
      * A helper function to handle the SetVolume directive.
@@ -355,7 +355,7 @@ private:
      */
     bool handleSetVolume(
         const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-        const rapidjson::Document& payload);
+        const rapidjson::Value& payload);
 
     /**
      * A helper function to handle the AdjustVolume directive.
@@ -366,7 +366,7 @@ private:
      */
     bool handleAdjustVolume(
         const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-        const rapidjson::Document& payload);
+        const rapidjson::Value& payload);
 
     /**
      * Utility function to send a single alert related Event to AVS. If isCertified is set to true, then the Event
@@ -19,6 +19,7 @@
 #include "Alerts/Renderer/RendererInterface.h"
 #include "Alerts/Renderer/RendererObserverInterface.h"
 
+#include <AVSCommon/Utils/File/AssetCache.h>
 #include <AVSCommon/Utils/Threading/Executor.h>
 #include <AVSCommon/Utils/MediaPlayer/MediaPlayerInterface.h>
 #include <AVSCommon/Utils/MediaPlayer/MediaPlayerObserverInterface.h>
@@ -44,10 +45,13 @@ public:
      * Creates a @c Renderer.
      *
      * @param mediaPlayer the @c MediaPlayerInterface that the @c Renderer object will interact with.
+     * @param assetCache An optional cache of the urls, which are fetched when they are prefetched and played from the
+     * cache when they are in it.
      * @return The @c Renderer object.
      */
     static std::shared_ptr<Renderer> create(
-        std::shared_ptr<avsCommon::utils::mediaPlayer::MediaPlayerInterface> mediaPlayer);
+        std::shared_ptr<avsCommon::utils::mediaPlayer::MediaPlayerInterface> mediaPlayer,
+        std::shared_ptr<avsCommon::utils::file::AssetCache> assetCache = nullptr);
 
     void setObserver(std::shared_ptr<RendererObserverInterface> observer) override;
 
@@ -59,6 +63,8 @@ public:
 
     void stop() override;
 
+    void prefetch(const std::vector<std::string>& urls) override;
+
     void onPlaybackStarted(SourceId sourceId) override;
 
     void onPlaybackStopped(SourceId sourceId) override;
@@ -76,8 +82,11 @@ private:
      * Constructor.
      *
      * @param mediaPlayer The @c MediaPlayerInterface, which will render audio for an alert.
+     * @param assetCache The cache of the urls, or @c nullptr to stream them.
      */
-    Renderer(std::shared_ptr<avsCommon::utils::mediaPlayer::MediaPlayerInterface> mediaPlayer);
+    Renderer(
+        std::shared_ptr<avsCommon::utils::mediaPlayer::MediaPlayerInterface> mediaPlayer,
+        std::shared_ptr<avsCommon::utils::file::AssetCache> assetCache);
 
     /**
      * @name Executor Thread Functions
@@ -244,6 +253,9 @@ private:
     /// The @cMediaPlayerInterface which renders the audio files.
     std::shared_ptr<avsCommon::utils::mediaPlayer::MediaPlayerInterface> m_mediaPlayer;
 
+    /// The cache of the urls, or @c nullptr to stream them.
+    std::shared_ptr<avsCommon::utils::file::AssetCache> m_assetCache;
+
     /// Our observer.
     std::shared_ptr<RendererObserverInterface> m_observer;
 
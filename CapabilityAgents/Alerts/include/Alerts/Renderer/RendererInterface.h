@@ -77,8 +77,19 @@ public:
      * Stop rendering.
      */
     virtual void stop() = 0;
+
+    /**
+     * Prepare to render urls later, for example by fetching them ahead of time.  The default implementation does
+     * nothing.
+     *
+     * @param urls The urls which may be rendered.
+     */
+    virtual void prefetch(const std::vector<std::string>& urls);
 };
 
+inline void RendererInterface::prefetch(const std::vector<std::string>& urls) {
+}
+
 }  // namespace renderer
 }  // namespace alerts
 }  // namespace capabilityAgents
@@ -71,6 +71,15 @@ public:
      */
     virtual bool store(std::shared_ptr<Alert> alert) = 0;
 
+    /**
+     * Stores multiple alerts in the database.  This function should be atomic, no alert is to be stored if there was
+     * an error storing one.  The default implementation stores the alerts one at a time.
+     *
+     * @param alerts The alerts to store.
+     * @return Whether all alerts were successfully stored.
+     */
+    virtual bool bulkStore(const std::vector<std::shared_ptr<Alert>>& alerts);
+
     /**
      * Loads all alerts in the database.
      *
@@ -89,6 +98,16 @@ public:
      */
     virtual bool modify(std::shared_ptr<Alert> alert) = 0;
 
+    /**
+     * Updates the database records of multiple alerts, as @c modify does.  This function should be atomic, no alert is
+     * to be modified if there was an error modifying one.  The default implementation modifies the alerts one at a
+     * time.
+     *
+     * @param alerts The alerts to be modified.
+     * @return Whether all alerts were successfully modified.
+     */
+    virtual bool bulkModify(const std::vector<std::shared_ptr<Alert>>& alerts);
+
     /**
      * Erases a single alert from the database.
      *
@@ -117,6 +136,24 @@ public:
     virtual bool clearDatabase() = 0;
 };
 
+inline bool AlertStorageInterface::bulkStore(const std::vector<std::shared_ptr<Alert>>& alerts) {
+    for (auto& alert : alerts) {
+        if (!store(alert)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline bool AlertStorageInterface::bulkModify(const std::vector<std::shared_ptr<Alert>>& alerts) {
+    for (auto& alert : alerts) {
+        if (!modify(alert)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 }  // namespace storage
 }  // namespace alerts
 }  // namespace capabilityAgents
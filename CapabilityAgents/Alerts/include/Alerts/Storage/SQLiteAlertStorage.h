@@ -38,7 +38,8 @@ namespace storage {
 class SQLiteAlertStorage : public AlertStorageInterface {
 public:
     /**
-     * Factory method for creating a storage object for Alerts based on an SQLite database.
+     * Factory method for creating a storage object for Alerts based on an SQLite database.  If the configuration has
+     * an @c SQLiteStorageEngine, the alerts are stored by the engine instead of a file of their own.
      *
      * @param configurationRoot The global config object.
      * @param alertsAudioFactory A factory that can produce default alert sounds.
@@ -61,10 +62,14 @@ public:
 
     bool store(std::shared_ptr<Alert> alert) override;
 
+    bool bulkStore(const std::vector<std::shared_ptr<Alert>>& alerts) override;
+
     bool load(std::vector<std::shared_ptr<Alert>>* alertContainer) override;
 
     bool modify(std::shared_ptr<Alert> alert) override;
 
+    bool bulkModify(const std::vector<std::shared_ptr<Alert>>& alerts) override;
+
     bool erase(std::shared_ptr<Alert> alert) override;
 
     bool bulkErase(const std::list<std::shared_ptr<Alert>>& alertList) override;
@@ -100,6 +105,16 @@ private:
         const std::string& dbFilePath,
         const std::shared_ptr<avsCommon::sdkInterfaces::audio::AlertsAudioFactoryInterface>& alertsAudioFactory);
 
+    /**
+     * Constructor for a storage object whose tables are hosted by an @c SQLiteStorageEngine.
+     *
+     * @param engine The engine hosting the tables.
+     * @param alertsAudioFactory A factory that can produce default alert sounds.
+     */
+    SQLiteAlertStorage(
+        std::shared_ptr<alexaClientSDK::storage::sqliteStorage::SQLiteStorageEngine> engine,
+        const std::shared_ptr<avsCommon::sdkInterfaces::audio::AlertsAudioFactoryInterface>& alertsAudioFactory);
+
     /**
      * Utility function to migrate an existing V1 Alerts database file to the V2 format.
      *
@@ -130,6 +145,30 @@ private:
      */
     bool alertExists(const std::string& token);
 
+    /**
+     * Stores an alert in the tables, without a transaction of its own.
+     *
+     * @param alert The @c Alert to store.
+     * @return Whether the @c Alert was successfully stored.
+     */
+    bool storeHelper(std::shared_ptr<Alert> alert);
+
+    /**
+     * Updates the record of an alert, without a transaction of its own.
+     *
+     * @param alert The @c Alert to be modified.
+     * @return Whether the @c Alert was successfully modified.
+     */
+    bool modifyHelper(std::shared_ptr<Alert> alert);
+
+    /**
+     * Erases an alert from the tables, without a transaction of its own.
+     *
+     * @param alert The @c Alert to be erased.
+     * @return Whether the @c Alert was successfully erased.
+     */
+    bool eraseHelper(std::shared_ptr<Alert> alert);
+
     /// A member that stores a factory that produces audio streams for alerts.
     std::shared_ptr<avsCommon::sdkInterfaces::audio::AlertsAudioFactoryInterface> m_alertsAudioFactory;
 
@@ -36,6 +36,18 @@ static const std::string TAG("AlertScheduler");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+/**
+ * Utility function to collect the urls of the assets of an alert, so that they can be prefetched.
+ *
+ * @param alert The alert.
+ * @param[out] urls The container the urls are appended to.
+ */
+static void appendAssetUrls(const std::shared_ptr<Alert>& alert, std::vector<std::string>* urls) {
+    for (auto& asset : alert->getAssetConfiguration().assets) {
+        urls->push_back(asset.second.url);
+    }
+}
+
 AlertScheduler::AlertScheduler(
     std::shared_ptr<storage::AlertStorageInterface> alertStorage,
     std::shared_ptr<renderer::RendererInterface> alertRenderer,
@@ -74,6 +86,9 @@ bool AlertScheduler::initialize(std::shared_ptr<AlertObserverInterface> observer
     }
 
     std::vector<std::shared_ptr<Alert>> alerts;
+    std::list<std::shared_ptr<Alert>> pastDueAlerts;
+    std::vector<std::shared_ptr<Alert>> resetAlerts;
+    std::vector<std::string> assetUrls;
 
     std::unique_lock<std::mutex> lock(m_mutex);
     m_alertStorage->load(&alerts);
@@ -82,23 +97,37 @@ bool AlertScheduler::initialize(std::shared_ptr<AlertObserverInterface> observer
         if (alert->isPastDue(unixEpochNow, m_alertPastDueTimeLimit)) {
             std::string alertToken = alert->getToken();
             notifyObserver(alertToken, AlertObserverInterface::State::PAST_DUE);
-            m_alertStorage->erase(alert);
+            pastDueAlerts.push_back(alert);
         } else {
             // if it was active when the system last powered down, then re-init the state to set
             if (Alert::State::ACTIVE == alert->getState()) {
                 alert->reset();
-                m_alertStorage->modify(alert);
+                resetAlerts.push_back(alert);
             }
 
             alert->setRenderer(m_alertRenderer);
             alert->setObserver(this);
 
-            m_scheduledAlerts.insert(alert);
+            addScheduledAlertLocked(alert);
+            appendAssetUrls(alert, &assetUrls);
         }
     }
 
+    // Write the changes in two batches rather than one per alert, so that they are committed with a sync each.
+    if (!pastDueAlerts.empty() && !m_alertStorage->bulkErase(pastDueAlerts)) {
+        ACSDK_ERROR(LX("initialize").m("Could not erase past-due alerts from database."));
+    }
+    if (!resetAlerts.empty() && !m_alertStorage->bulkModify(resetAlerts)) {
+        ACSDK_ERROR(LX("initialize").m("Could not reset active alerts in database."));
+    }
+
     lock.unlock();
 
+    // Fetch any assets which were not cached before the last shutdown, while the network is still likely to be up.
+    if (!assetUrls.empty()) {
+        m_alertRenderer->prefetch(assetUrls);
+    }
+
     setTimerForNextAlert();
     return true;
 }
@@ -134,7 +163,13 @@ bool AlertScheduler::scheduleAlert(std::shared_ptr<Alert> alert) {
     }
     alert->setRenderer(m_alertRenderer);
     alert->setObserver(this);
-    m_scheduledAlerts.insert(alert);
+    addScheduledAlertLocked(alert);
+
+    std::vector<std::string> assetUrls;
+    appendAssetUrls(alert, &assetUrls);
+    if (!assetUrls.empty()) {
+        m_alertRenderer->prefetch(assetUrls);
+    }
 
     if (!m_activeAlert) {
         setTimerForNextAlertLocked();
@@ -176,7 +211,7 @@ bool AlertScheduler::deleteAlert(const std::string& alertToken) {
         ACSDK_ERROR(LX("handleDeleteAlertFailed").m("Could not erase alert from database").d("token", alertToken));
     }
 
-    m_scheduledAlerts.erase(alert);
+    removeScheduledAlertLocked(alert);
     setTimerForNextAlertLocked();
 
     return true;
@@ -218,7 +253,7 @@ bool AlertScheduler::deleteAlerts(const std::list<std::string>& tokenList) {
     }
 
     for (auto& alert : alertsToBeRemoved) {
-        m_scheduledAlerts.erase(alert);
+        removeScheduledAlertLocked(alert);
     }
 
     setTimerForNextAlertLocked();
@@ -308,6 +343,7 @@ void AlertScheduler::clearData(Alert::StopReason reason) {
     }
 
     m_scheduledAlerts.clear();
+    m_scheduledAlertsByToken.clear();
 
     m_alertStorage->clearDatabase();
 }
@@ -325,6 +361,7 @@ void AlertScheduler::shutdown() {
     m_alertRenderer.reset();
     m_activeAlert.reset();
     m_scheduledAlerts.clear();
+    m_scheduledAlertsByToken.clear();
 }
 
 void AlertScheduler::executeOnAlertStateChange(std::string alertToken, State state, std::string reason) {
@@ -364,7 +401,7 @@ void AlertScheduler::executeOnAlertStateChange(std::string alertToken, State sta
 
         case State::SNOOZED:
             m_alertStorage->modify(m_activeAlert);
-            m_scheduledAlerts.insert(m_activeAlert);
+            addScheduledAlertLocked(m_activeAlert);
             m_activeAlert.reset();
             m_alertRenderer->setObserver(nullptr);
 
@@ -400,7 +437,7 @@ void AlertScheduler::executeOnAlertStateChange(std::string alertToken, State sta
                 auto alert = getAlertLocked(alertToken);
                 if (alert) {
                     m_alertStorage->erase(alert);
-                    m_scheduledAlerts.erase(alert);
+                    removeScheduledAlertLocked(alert);
                     setTimerForNextAlertLocked();
                 }
             }
@@ -497,7 +534,7 @@ void AlertScheduler::activateNextAlertLocked() {
     }
 
     m_activeAlert = *(m_scheduledAlerts.begin());
-    m_scheduledAlerts.erase(m_scheduledAlerts.begin());
+    removeScheduledAlertLocked(m_activeAlert);
 
     m_activeAlert->setFocusState(m_focusState);
     m_activeAlert->activate();
@@ -517,13 +554,27 @@ bool AlertScheduler::isAlertActiveLocked(std::shared_ptr<Alert> alert) const {
 }
 
 std::shared_ptr<Alert> AlertScheduler::getAlertLocked(const std::string& token) const {
-    for (auto& alert : m_scheduledAlerts) {
-        if (token == alert->getToken()) {
-            return alert;
-        }
+    auto it = m_scheduledAlertsByToken.find(token);
+    if (it == m_scheduledAlertsByToken.end()) {
+        return nullptr;
+    }
+
+    return it->second;
+}
+
+void AlertScheduler::addScheduledAlertLocked(std::shared_ptr<Alert> alert) {
+    if (m_scheduledAlerts.insert(alert).second) {
+        m_scheduledAlertsByToken[alert->getToken()] = alert;
     }
+}
 
-    return nullptr;
+void AlertScheduler::removeScheduledAlertLocked(std::shared_ptr<Alert> alert) {
+    if (m_scheduledAlerts.erase(alert)) {
+        auto it = m_scheduledAlertsByToken.find(alert->getToken());
+        if (it != m_scheduledAlertsByToken.end() && it->second == alert) {
+            m_scheduledAlertsByToken.erase(it);
+        }
+    }
 }
 
 std::list<std::shared_ptr<Alert>> AlertScheduler::getAllAlerts() {
@@ -404,7 +404,7 @@ bool AlertsCapabilityAgent::initializeAlerts() {
 
 bool AlertsCapabilityAgent::handleSetAlert(
     const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-    const rapidjson::Document& payload,
+    const rapidjson::Value& payload,
     std::string* alertToken) {
     ACSDK_DEBUG9(LX("handleSetAlert"));
     std::string alertType;
@@ -459,7 +459,7 @@ bool AlertsCapabilityAgent::handleSetAlert(
 
 bool AlertsCapabilityAgent::handleDeleteAlert(
     const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-    const rapidjson::Document& payload,
+    const rapidjson::Value& payload,
     std::string* alertToken) {
     ACSDK_DEBUG5(LX(__func__));
     if (!retrieveValue(payload, DIRECTIVE_PAYLOAD_TOKEN_KEY, alertToken)) {
@@ -478,7 +478,7 @@ bool AlertsCapabilityAgent::handleDeleteAlert(
 
 bool AlertsCapabilityAgent::handleDeleteAlerts(
     const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-    const rapidjson::Document& payload) {
+    const rapidjson::Value& payload) {
     ACSDK_DEBUG5(LX(__func__));
 
     std::list<std::string> alertTokens;
@@ -519,7 +519,7 @@ bool AlertsCapabilityAgent::handleDeleteAlerts(
 
 bool AlertsCapabilityAgent::handleSetVolume(
     const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-    const rapidjson::Document& payload) {
+    const rapidjson::Value& payload) {
     ACSDK_DEBUG5(LX(__func__));
     int64_t volumeValue = 0;
     if (!retrieveValue(payload, DIRECTIVE_PAYLOAD_VOLUME, &volumeValue)) {
@@ -534,7 +534,7 @@ bool AlertsCapabilityAgent::handleSetVolume(
 
 bool AlertsCapabilityAgent::handleAdjustVolume(
     const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-    const rapidjson::Document& payload) {
+    const rapidjson::Value& payload) {
     ACSDK_DEBUG5(LX(__func__));
     int64_t adjustValue = 0;
     if (!retrieveValue(payload, DIRECTIVE_PAYLOAD_VOLUME, &adjustValue)) {
@@ -670,15 +670,14 @@ void AlertsCapabilityAgent::executeHandleDirectiveImmediately(std::shared_ptr<Di
     ACSDK_DEBUG1(LX("executeHandleDirectiveImmediately"));
     auto& directive = info->directive;
 
-    rapidjson::Document payload;
-    payload.Parse(directive->getPayload());
-
-    if (payload.HasParseError()) {
+    auto parsedPayload = directive->getParsedPayload();
+    if (!parsedPayload) {
         std::string errorMessage = "Unable to parse payload";
         ACSDK_ERROR(LX("executeHandleDirectiveImmediatelyFailed").m(errorMessage));
         sendProcessingDirectiveException(directive, errorMessage);
         return;
     }
+    const rapidjson::Value& payload = *parsedPayload;
 
     auto directiveName = directive->getName();
     std::string alertToken;
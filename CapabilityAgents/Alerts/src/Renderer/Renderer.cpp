@@ -47,13 +47,15 @@ static bool isSourceIdOk(MediaPlayerInterface::SourceId sourceId) {
     return sourceId != MediaPlayerInterface::ERROR;
 }
 
-std::shared_ptr<Renderer> Renderer::create(std::shared_ptr<MediaPlayerInterface> mediaPlayer) {
+std::shared_ptr<Renderer> Renderer::create(
+    std::shared_ptr<MediaPlayerInterface> mediaPlayer,
+    std::shared_ptr<avsCommon::utils::file::AssetCache> assetCache) {
     if (!mediaPlayer) {
         ACSDK_ERROR(LX("createFailed").m("mediaPlayer parameter was nullptr."));
         return nullptr;
     }
 
-    auto renderer = std::shared_ptr<Renderer>(new Renderer{mediaPlayer});
+    auto renderer = std::shared_ptr<Renderer>(new Renderer{mediaPlayer, assetCache});
     mediaPlayer->setObserver(renderer);
     return renderer;
 }
@@ -95,6 +97,12 @@ void Renderer::stop() {
     m_executor.submit([this]() { executeStop(); });
 }
 
+void Renderer::prefetch(const std::vector<std::string>& urls) {
+    if (m_assetCache && !urls.empty()) {
+        m_assetCache->prefetch(urls);
+    }
+}
+
 void Renderer::onPlaybackStarted(SourceId sourceId) {
     m_executor.submit([this, sourceId]() { executeOnPlaybackStarted(sourceId); });
 }
@@ -114,8 +122,11 @@ void Renderer::onPlaybackError(
     m_executor.submit([this, sourceId, type, error]() { executeOnPlaybackError(sourceId, type, error); });
 }
 
-Renderer::Renderer(std::shared_ptr<MediaPlayerInterface> mediaPlayer) :
+Renderer::Renderer(
+    std::shared_ptr<MediaPlayerInterface> mediaPlayer,
+    std::shared_ptr<avsCommon::utils::file::AssetCache> assetCache) :
         m_mediaPlayer{mediaPlayer},
+        m_assetCache{assetCache},
         m_observer{nullptr},
         m_numberOfStreamsRenderedThisLoop{0},
         m_remainingLoopCount{0},
@@ -194,7 +205,13 @@ void Renderer::play() {
     if (shouldPlayDefault()) {
         m_currentSourceId = m_mediaPlayer->setSource(m_defaultAudioFactory(), shouldMediaPlayerRepeat());
     } else {
-        m_currentSourceId = m_mediaPlayer->setSource(m_urls[m_numberOfStreamsRenderedThisLoop]);
+        auto& url = m_urls[m_numberOfStreamsRenderedThisLoop];
+        std::shared_ptr<std::istream> cachedAudio = m_assetCache ? m_assetCache->open(url) : nullptr;
+        if (cachedAudio) {
+            m_currentSourceId = m_mediaPlayer->setSource(cachedAudio, false);
+        } else {
+            m_currentSourceId = m_mediaPlayer->setSource(url);
+        }
     }
     if (!isSourceIdOk(m_currentSourceId)) {
         ACSDK_ERROR(
@@ -19,6 +19,7 @@
 #include "Alerts/Timer.h"
 
 #include <SQLiteStorage/SQLiteStatement.h>
+#include <SQLiteStorage/SQLiteStorageEngine.h>
 #include <SQLiteStorage/SQLiteUtils.h>
 
 #include <AVSCommon/Utils/File/FileUtils.h>
@@ -26,6 +27,7 @@
 #include <AVSCommon/Utils/String/StringUtils.h>
 
 #include <fstream>
+#include <functional>
 #include <set>
 
 namespace alexaClientSDK {
@@ -48,6 +50,11 @@ static const std::string TAG("SQLiteAlertStorage");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+/// The name of this storage as a component of an @c SQLiteStorageEngine.
+static const std::string ALERTS_COMPONENT_NAME = "alerts";
+/// The schema version of this storage as a component of an @c SQLiteStorageEngine.
+static const int ALERTS_SCHEMA_VERSION = 1;
+
 /// The key in our config file to find the root of settings for this Capability Agent.
 static const std::string ALERTS_CAPABILITY_AGENT_CONFIGURATION_ROOT_KEY = "alertsCapabilityAgent";
 
@@ -141,6 +148,16 @@ static const std::string CREATE_ALERT_ASSET_PLAY_ORDER_ITEMS_TABLE_SQL_STRING =
         "asset_play_order_token TEXT NOT NULL);";
 // clang-format on
 
+/// The SQL strings to create the indexes which look up alerts by token, and their assets by alert, without scanning
+/// the tables.  They are created with the database, and when older databases are opened.
+// clang-format off
+static const std::vector<std::string> CREATE_INDEXES_SQL_STRINGS = {
+    "CREATE INDEX IF NOT EXISTS alertsTokenIndex ON " + ALERTS_V2_TABLE_NAME + " (token);",
+    "CREATE INDEX IF NOT EXISTS alertAssetsAlertIdIndex ON " + ALERT_ASSETS_TABLE_NAME + " (alert_id);",
+    "CREATE INDEX IF NOT EXISTS alertAssetPlayOrderItemsAlertIdIndex ON " +
+        ALERT_ASSET_PLAY_ORDER_ITEMS_TABLE_NAME + " (alert_id);"};
+// clang-format on
+
 struct AssetOrderItem {
     int index;
     std::string name;
@@ -270,6 +287,15 @@ static bool dbFieldToAlertState(int dbState, Alert::State* state) {
 std::unique_ptr<SQLiteAlertStorage> SQLiteAlertStorage::create(
     const avsCommon::utils::configuration::ConfigurationNode& configurationRoot,
     const std::shared_ptr<avsCommon::sdkInterfaces::audio::AlertsAudioFactoryInterface>& alertsAudioFactory) {
+    std::shared_ptr<SQLiteStorageEngine> engine;
+    if (!SQLiteStorageEngine::getInstance(configurationRoot, &engine)) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "Could not get storage engine"));
+        return nullptr;
+    }
+    if (engine) {
+        return std::unique_ptr<SQLiteAlertStorage>(new SQLiteAlertStorage(engine, alertsAudioFactory));
+    }
+
     auto alertsConfigurationRoot = configurationRoot[ALERTS_CAPABILITY_AGENT_CONFIGURATION_ROOT_KEY];
     if (!alertsConfigurationRoot) {
         ACSDK_ERROR(LX("createFailed")
@@ -297,6 +323,13 @@ SQLiteAlertStorage::SQLiteAlertStorage(
         m_db{dbFilePath} {
 }
 
+SQLiteAlertStorage::SQLiteAlertStorage(
+    std::shared_ptr<SQLiteStorageEngine> engine,
+    const std::shared_ptr<avsCommon::sdkInterfaces::audio::AlertsAudioFactoryInterface>& alertsAudioFactory) :
+        m_alertsAudioFactory{alertsAudioFactory},
+        m_db{std::move(engine), ALERTS_COMPONENT_NAME, ALERTS_SCHEMA_VERSION} {
+}
+
 SQLiteAlertStorage::~SQLiteAlertStorage() {
     close();
 }
@@ -361,6 +394,54 @@ static bool createAlertAssetPlayOrderItemsTable(SQLiteDatabase* db) {
     return true;
 }
 
+/**
+ * Utility function to create the indexes of the tables within the database, if they do not exist yet.
+ *
+ * @param db The SQLiteDatabase object.
+ * @return Whether the indexes were successfully created.
+ */
+static bool createIndexes(SQLiteDatabase* db) {
+    for (auto& sqlString : CREATE_INDEXES_SQL_STRINGS) {
+        if (!db->performQuery(sqlString)) {
+            ACSDK_ERROR(LX("createIndexesFailed").d("SQL string", sqlString));
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Utility function to perform a task in a single transaction, so that its writes to the tables are committed
+ * together, with a single sync, or not at all.
+ *
+ * @param db The SQLiteDatabase object.
+ * @param event The name of the operation, for logging.
+ * @param task The task, which returns whether its writes should be committed.
+ * @return Whether the task succeeded and its writes were committed.
+ */
+static bool performInTransaction(SQLiteDatabase* db, const std::string& event, const std::function<bool()>& task) {
+    auto transaction = db->beginTransaction();
+    if (!transaction) {
+        ACSDK_ERROR(LX(event + "Failed").d("reason", "Failed to begin transaction."));
+        return false;
+    }
+
+    if (!task()) {
+        if (!transaction->rollback()) {
+            ACSDK_ERROR(LX(event + "Failed").d("reason", "Failed to rollback alerts storage changes"));
+        }
+        return false;
+    }
+
+    if (!transaction->commit()) {
+        ACSDK_ERROR(LX(event + "Failed").d("reason", "Failed to commit alerts storage changes"));
+        return false;
+    }
+
+    return true;
+}
+
 bool SQLiteAlertStorage::createDatabase() {
     if (!m_db.initialize()) {
         ACSDK_ERROR(LX("createDatabaseFailed"));
@@ -385,6 +466,12 @@ bool SQLiteAlertStorage::createDatabase() {
         return false;
     }
 
+    if (!createIndexes(&m_db)) {
+        ACSDK_ERROR(LX("createDatabaseFailed").m("Indexes could not be created."));
+        close();
+        return false;
+    }
+
     return true;
 }
 
@@ -424,12 +511,9 @@ bool SQLiteAlertStorage::migrateAlertsDbFromV1ToV2() {
             return false;
         }
 
-        for (auto& alert : alertContainer) {
-            if (!store(alert)) {
-                ACSDK_ERROR(LX("migrateAlertsDbFromV1ToV2Failed").m("Could not migrate alert to V2 database."));
-                alert->printDiagnostic();
-                return false;
-            }
+        if (!bulkStore(alertContainer)) {
+            ACSDK_ERROR(LX("migrateAlertsDbFromV1ToV2Failed").m("Could not migrate alerts to V2 database."));
+            return false;
         }
 
         const std::string sqlString = "DROP TABLE IF EXISTS " + ALERTS_TABLE_NAME + ";";
@@ -444,7 +528,16 @@ bool SQLiteAlertStorage::migrateAlertsDbFromV1ToV2() {
 }
 
 bool SQLiteAlertStorage::open() {
-    return m_db.open();
+    if (!m_db.open()) {
+        return false;
+    }
+
+    // Databases created before the indexes were introduced get them on their first open.
+    if (!createIndexes(&m_db)) {
+        ACSDK_WARN(LX("openWarning").m("Indexes could not be created."));
+    }
+
+    return true;
 }
 
 void SQLiteAlertStorage::close() {
@@ -599,6 +692,26 @@ static bool storeAlertAssetPlayOrderItems(
 }
 
 bool SQLiteAlertStorage::store(std::shared_ptr<Alert> alert) {
+    return performInTransaction(&m_db, "store", [this, &alert]() { return storeHelper(alert); });
+}
+
+bool SQLiteAlertStorage::bulkStore(const std::vector<std::shared_ptr<Alert>>& alerts) {
+    if (alerts.empty()) {
+        return true;
+    }
+
+    return performInTransaction(&m_db, "bulkStore", [this, &alerts]() {
+        for (auto& alert : alerts) {
+            if (!storeHelper(alert)) {
+                ACSDK_ERROR(LX("bulkStoreFailed").d("reason", "Failed to store alert"));
+                return false;
+            }
+        }
+        return true;
+    });
+}
+
+bool SQLiteAlertStorage::storeHelper(std::shared_ptr<Alert> alert) {
     if (!alert) {
         ACSDK_ERROR(LX("storeFailed").m("Alert parameter is nullptr"));
         return false;
@@ -919,6 +1032,26 @@ bool SQLiteAlertStorage::load(std::vector<std::shared_ptr<Alert>>* alertContaine
 }
 
 bool SQLiteAlertStorage::modify(std::shared_ptr<Alert> alert) {
+    return modifyHelper(alert);
+}
+
+bool SQLiteAlertStorage::bulkModify(const std::vector<std::shared_ptr<Alert>>& alerts) {
+    if (alerts.empty()) {
+        return true;
+    }
+
+    return performInTransaction(&m_db, "bulkModify", [this, &alerts]() {
+        for (auto& alert : alerts) {
+            if (!modifyHelper(alert)) {
+                ACSDK_ERROR(LX("bulkModifyFailed").d("reason", "Failed to modify alert"));
+                return false;
+            }
+        }
+        return true;
+    });
+}
+
+bool SQLiteAlertStorage::modifyHelper(std::shared_ptr<Alert> alert) {
     if (!alert) {
         ACSDK_ERROR(LX("modifyFailed").m("Alert parameter is nullptr."));
         return false;
@@ -1092,6 +1225,10 @@ static bool eraseAlertByAlertId(SQLiteDatabase* db, int alertId) {
 }
 
 bool SQLiteAlertStorage::erase(std::shared_ptr<Alert> alert) {
+    return performInTransaction(&m_db, "erase", [this, &alert]() { return eraseHelper(alert); });
+}
+
+bool SQLiteAlertStorage::eraseHelper(std::shared_ptr<Alert> alert) {
     if (!alert) {
         ACSDK_ERROR(LX("eraseFailed").m("Alert parameter is nullptr."));
         return false;
@@ -1110,40 +1247,29 @@ bool SQLiteAlertStorage::bulkErase(const std::list<std::shared_ptr<Alert>>& aler
         return true;
     }
 
-    auto transaction = m_db.beginTransaction();
-    if (!transaction) {
-        ACSDK_ERROR(LX("bulkEraseFailed").d("reason", "Failed to begin transaction."));
-        return false;
-    }
-
-    for (auto& alert : alertList) {
-        if (!erase(alert)) {
-            ACSDK_ERROR(LX("bulkEraseFailed").d("reason", "Failed to erase alert"));
-            if (!transaction->rollback()) {
-                ACSDK_ERROR(LX("bulkEraseFailed").d("reason", "Failed to rollback alerts storage changes"));
+    return performInTransaction(&m_db, "bulkErase", [this, &alertList]() {
+        for (auto& alert : alertList) {
+            if (!eraseHelper(alert)) {
+                ACSDK_ERROR(LX("bulkEraseFailed").d("reason", "Failed to erase alert"));
+                return false;
             }
-            return false;
         }
-    }
-
-    if (!transaction->commit()) {
-        ACSDK_ERROR(LX("bulkEraseFailed").d("reason", "Failed to commit alerts storage changes"));
-        return false;
-    }
-    return true;
+        return true;
+    });
 }
 
 bool SQLiteAlertStorage::clearDatabase() {
     const std::vector<std::string> tablesToClear = {
         ALERTS_V2_TABLE_NAME, ALERT_ASSETS_TABLE_NAME, ALERT_ASSET_PLAY_ORDER_ITEMS_TABLE_NAME};
-    for (auto& tableName : tablesToClear) {
-        if (!m_db.clearTable(tableName)) {
-            ACSDK_ERROR(LX("clearDatabaseFailed").d("could not clear table", tableName));
-            return false;
+    return performInTransaction(&m_db, "clearDatabase", [this, &tablesToClear]() {
+        for (auto& tableName : tablesToClear) {
+            if (!m_db.clearTable(tableName)) {
+                ACSDK_ERROR(LX("clearDatabaseFailed").d("could not clear table", tableName));
+                return false;
+            }
         }
-    }
-
-    return true;
+        return true;
+    });
 }
 
 /**
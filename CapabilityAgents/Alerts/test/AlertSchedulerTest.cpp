@@ -17,6 +17,8 @@
 #include <gmock/gmock.h>
 #include <gmock/gmock-actions.h>
 
+#include <chrono>
+
 #include "Alerts/AlertScheduler.h"
 
 namespace alexaClientSDK {
@@ -182,6 +184,7 @@ public:
     MOCK_METHOD1(bulkErase, bool(const std::list<std::shared_ptr<Alert>>&));
     MOCK_METHOD1(erase, bool(std::shared_ptr<Alert>));
     MOCK_METHOD1(modify, bool(std::shared_ptr<Alert>));
+    MOCK_METHOD1(bulkModify, bool(const std::vector<std::shared_ptr<Alert>>&));
     MOCK_METHOD0(clearDatabase, bool());
 
 private:
@@ -313,10 +316,10 @@ TEST_F(AlertSchedulerTest, initialize) {
     m_alertStorage->setAlerts(alertsToAdd);
 
     /// past alert should get removed
-    EXPECT_CALL(*(m_alertStorage.get()), erase(testing::_)).Times(1);
+    EXPECT_CALL(*(m_alertStorage.get()), bulkErase(testing::SizeIs(1))).Times(1).WillOnce(testing::Return(true));
 
     /// active alert should get modified
-    EXPECT_CALL(*(m_alertStorage.get()), modify(testing::_)).Times(1);
+    EXPECT_CALL(*(m_alertStorage.get()), bulkModify(testing::SizeIs(1))).Times(1).WillOnce(testing::Return(true));
 
     ASSERT_TRUE(m_alertScheduler->initialize(alertSchedulerObs));
 
@@ -752,6 +755,39 @@ TEST_F(AlertSchedulerTest, onAlertStateChangeErrorInactiveAlert) {
     ASSERT_TRUE(m_testAlertObserver->waitFor(testState));
 }
 
+/**
+ * Report how long it takes to schedule many alerts, and to delete them all with a single directive, which look up each
+ * alert by its token.  Both times are recorded as test properties.  Disabled by default.
+ */
+TEST_F(AlertSchedulerTest, DISABLED_benchmarkScheduleAndDeleteAlerts) {
+    const int numberOfAlerts = 10000;
+    ON_CALL(*m_alertStorage.get(), bulkErase(_)).WillByDefault(Return(true));
+    m_alertScheduler->initialize(m_testAlertObserver);
+
+    std::list<std::string> tokens;
+    std::vector<std::shared_ptr<TestAlert>> alerts;
+    for (int i = 0; i < numberOfAlerts; ++i) {
+        tokens.push_back("token" + std::to_string(i));
+        alerts.push_back(std::make_shared<TestAlert>(tokens.back(), getFutureInstant(1)));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (auto& alert : alerts) {
+        ASSERT_TRUE(m_alertScheduler->scheduleAlert(alert));
+    }
+    auto scheduleElapsed = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(m_alertScheduler->deleteAlerts(tokens));
+    auto deleteElapsed = std::chrono::steady_clock::now() - start;
+    ASSERT_TRUE(m_alertScheduler->getAllAlerts().empty());
+
+    RecordProperty(
+        "scheduleMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(scheduleElapsed).count()));
+    RecordProperty(
+        "deleteMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(deleteElapsed).count()));
+}
+
 }  // namespace test
 }  // namespace alerts
 }  // namespace capabilityAgents
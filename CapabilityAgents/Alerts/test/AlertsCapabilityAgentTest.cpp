@@ -13,6 +13,7 @@
  * permissions and limitations under the License.
  */
 
+#include <mutex>
 #include <thread>
 
 #include <gtest/gtest.h>
@@ -198,23 +199,29 @@ public:
 class TestMessageSender : public MessageSenderInterface {
 public:
     void sendMessage(std::shared_ptr<avsCommon::avs::MessageRequest> request) override {
+        std::unique_lock<std::mutex> lock(m_mutex);
         if (m_nextMessagePromise) {
             m_nextMessagePromise->set_value(request);
             m_nextMessagePromise.reset();
         }
+        lock.unlock();
         request->sendCompleted(avsCommon::sdkInterfaces::MessageRequestObserverInterface::Status::SUCCESS);
     }
 
     /**
-     * Wait for next message to be sent using this object. The message sent is then returned to the caller.
+     * Wait for next message to be sent using this object. The message sent is then returned to the caller.  This must
+     * be called before the message is sent, since a message sent while nobody waits for it is dropped.
      * @return The last message sent using this object.
      */
     std::future<std::shared_ptr<avsCommon::avs::MessageRequest>> getNextMessage() {
+        std::lock_guard<std::mutex> lock(m_mutex);
         m_nextMessagePromise = std::make_shared<std::promise<std::shared_ptr<avsCommon::avs::MessageRequest>>>();
         return m_nextMessagePromise->get_future();
     }
 
 private:
+    /// Mutex to protect @c m_nextMessagePromise, which is set by the test thread and read by the sending thread.
+    std::mutex m_mutex;
     std::shared_ptr<std::promise<std::shared_ptr<avsCommon::avs::MessageRequest>>> m_nextMessagePromise;
 };
 
@@ -376,11 +383,10 @@ TEST_F(AlertsCapabilityAgentTest, localAlertVolumeChangeNoAlert) {
     SpeakerInterface::SpeakerSettings speakerSettings;
     speakerSettings.volume = TEST_VOLUME_VALUE;
     speakerSettings.mute = false;
+    auto future = m_mockMessageSender->getNextMessage();
     m_alertsCA->onSpeakerSettingsChanged(
         SpeakerManagerObserverInterface::Source::LOCAL_API, SpeakerInterface::Type::AVS_ALERTS_VOLUME, speakerSettings);
 
-    auto future = m_mockMessageSender->getNextMessage();
-
     ASSERT_EQ(future.wait_for(std::chrono::milliseconds(MAX_WAIT_TIME_MS)), std::future_status::ready);
 
     std::string content = future.get()->getJsonContent();
@@ -391,10 +397,10 @@ TEST_F(AlertsCapabilityAgentTest, localAlertVolumeChangeNoAlert) {
  * Test local alert volume changes. With alert sounding. Must not send event, volume is treated as local.
  */
 TEST_F(AlertsCapabilityAgentTest, localAlertVolumeChangeAlertPlaying) {
+    auto future = m_mockMessageSender->getNextMessage();
     m_alertsCA->onAlertStateChange("", AlertObserverInterface::State::STARTED, "");
 
     // We have to wait for the alert state to be processed before updating speaker settings.
-    auto future = m_mockMessageSender->getNextMessage();
     ASSERT_EQ(future.wait_for(std::chrono::milliseconds(MAX_WAIT_TIME_MS)), std::future_status::ready);
 
     std::string content = future.get()->getJsonContent();
@@ -402,12 +408,11 @@ TEST_F(AlertsCapabilityAgentTest, localAlertVolumeChangeAlertPlaying) {
 
     SpeakerInterface::SpeakerSettings speakerSettings;
     speakerSettings.volume = TEST_VOLUME_VALUE;
+    future = m_mockMessageSender->getNextMessage();
     m_alertsCA->onSpeakerSettingsChanged(
         SpeakerManagerObserverInterface::Source::LOCAL_API, SpeakerInterface::Type::AVS_ALERTS_VOLUME, speakerSettings);
 
-    ASSERT_EQ(
-        m_mockMessageSender->getNextMessage().wait_for(std::chrono::milliseconds(MAX_WAIT_TIME_MS)),
-        std::future_status::timeout);
+    ASSERT_EQ(future.wait_for(std::chrono::milliseconds(MAX_WAIT_TIME_MS)), std::future_status::timeout);
 }
 
 /**
@@ -424,12 +429,11 @@ TEST_F(AlertsCapabilityAgentTest, avsAlertVolumeChangeNoAlert) {
     EXPECT_CALL(*(m_speakerManager.get()), setVolume(SpeakerInterface::Type::AVS_ALERTS_VOLUME, TEST_VOLUME_VALUE, _))
         .Times(1);
 
+    auto future = m_mockMessageSender->getNextMessage();
     std::static_pointer_cast<CapabilityAgent>(m_alertsCA)
         ->preHandleDirective(directive, std::move(m_mockDirectiveHandlerResult));
     std::static_pointer_cast<CapabilityAgent>(m_alertsCA)->handleDirective(MESSAGE_ID);
 
-    auto future = m_mockMessageSender->getNextMessage();
-
     ASSERT_EQ(future.wait_for(std::chrono::milliseconds(MAX_WAIT_TIME_MS)), std::future_status::ready);
 
     std::string content = future.get()->getJsonContent();
@@ -450,19 +454,18 @@ TEST_F(AlertsCapabilityAgentTest, avsAlertVolumeChangeAlertPlaying) {
     EXPECT_CALL(*(m_speakerManager.get()), setVolume(SpeakerInterface::Type::AVS_ALERTS_VOLUME, TEST_VOLUME_VALUE, _))
         .Times(0);
 
-    m_alertsCA->onAlertStateChange("", AlertObserverInterface::State::STARTED, "");
     auto future = m_mockMessageSender->getNextMessage();
+    m_alertsCA->onAlertStateChange("", AlertObserverInterface::State::STARTED, "");
     ASSERT_EQ(future.wait_for(std::chrono::milliseconds(MAX_WAIT_TIME_MS)), std::future_status::ready);
 
     std::string content = future.get()->getJsonContent();
     ASSERT_TRUE(content.find("\"name\":\"AlertStarted\"") != std::string::npos);
 
+    future = m_mockMessageSender->getNextMessage();
     std::static_pointer_cast<CapabilityAgent>(m_alertsCA)
         ->preHandleDirective(directive, std::move(m_mockDirectiveHandlerResult));
     std::static_pointer_cast<CapabilityAgent>(m_alertsCA)->handleDirective(MESSAGE_ID);
 
-    future = m_mockMessageSender->getNextMessage();
-
     ASSERT_EQ(future.wait_for(std::chrono::milliseconds(MAX_WAIT_TIME_MS)), std::future_status::ready);
 
     content = future.get()->getJsonContent();
@@ -16,6 +16,11 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <cstdio>
+
+#include <AVSCommon/Utils/File/AssetCache.h>
+#include <AVSCommon/Utils/LibcurlUtils/HTTPContentFetcherFactory.h>
+#include <AVSCommon/Utils/LibcurlUtils/TestHTTPServer.h>
 #include <AVSCommon/Utils/MediaPlayer/MockMediaPlayer.h>
 
 #include "Alerts/Renderer/Renderer.h"
@@ -26,7 +31,11 @@ namespace alerts {
 namespace renderer {
 namespace test {
 
+using namespace avsCommon::utils::file;
+using namespace avsCommon::utils::libcurlUtils;
+using namespace avsCommon::utils::libcurlUtils::test;
 using namespace avsCommon::utils::mediaPlayer::test;
+using namespace ::testing;
 
 /// Amount of time that the renderer observer should wait for a task to finish.
 static const std::chrono::milliseconds TEST_TIMEOUT{100};
@@ -53,6 +62,15 @@ static const auto TEST_BACKGROUND_LOOP_PAUSE = std::chrono::seconds(1);
 /// Amount of time that the renderer observer should wait for a task to finish.
 static const auto TEST_BACKGROUND_TIMEOUT = std::chrono::seconds(5);
 
+/// The directory of the asset cache of the tests.
+static const std::string TEST_ASSET_CACHE_DIRECTORY = "RendererTest.cache";
+
+/// The size of the asset cache of the tests.
+static const uint64_t TEST_ASSET_CACHE_SIZE = 1024;
+
+/// The content of the asset served to the asset cache of the tests.
+static const std::string TEST_ASSET_CONTENT = "tone";
+
 class MockRendererObserver : public RendererObserverInterface {
 public:
     bool waitFor(RendererObserverInterface::State newState) {
@@ -334,6 +352,36 @@ TEST_F(RendererTest, emptyURLNonZeroLoopPause) {
     ASSERT_TRUE((elapsed >= TEST_BACKGROUND_LOOP_PAUSE) && (elapsed < TEST_BACKGROUND_TIMEOUT));
 }
 
+/**
+ * Test that a url which is in the asset cache is played from the cache rather than streamed.
+ */
+TEST_F(RendererTest, playCachedUrlFromAssetCache) {
+    TestHTTPServer server([](const std::string& path) {
+        return TestHTTPServer::Response{200, "audio/mpeg", TEST_ASSET_CONTENT, std::chrono::milliseconds::zero()};
+    });
+    auto url = server.getURL("/tone.mp3");
+    ASSERT_FALSE(url.empty());
+    auto assetCache = AssetCache::create(
+        TEST_ASSET_CACHE_DIRECTORY, TEST_ASSET_CACHE_SIZE, std::make_shared<HTTPContentFetcherFactory>());
+    ASSERT_TRUE(assetCache);
+    ASSERT_TRUE(assetCache->prefetch({url}).get());
+
+    auto mediaPlayer = MockMediaPlayer::create();
+    auto renderer = Renderer::create(mediaPlayer, assetCache);
+    EXPECT_CALL(*mediaPlayer, streamSetSource(_, false)).Times(1);
+    EXPECT_CALL(*mediaPlayer, urlSetSource(_)).Times(0);
+    renderer->start(RendererTest::audioFactoryFunc, {url});
+    EXPECT_TRUE(mediaPlayer->waitUntilNextSetSource(TEST_TIMEOUT));
+    EXPECT_EQ(1u, assetCache->getStatistics().hits);
+
+    renderer->stop();
+    mediaPlayer->setObserver(nullptr);
+    assetCache->clear();
+    assetCache.reset();
+    std::remove((TEST_ASSET_CACHE_DIRECTORY + "/index").c_str());
+    std::remove(TEST_ASSET_CACHE_DIRECTORY.c_str());
+}
+
 }  // namespace test
 }  // namespace renderer
 }  // namespace alerts
@@ -0,0 +1,246 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <iomanip>
+#include <list>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include <rapidjson/document.h>
+
+#include <AVSCommon/SDKInterfaces/Audio/MockAlertsAudioFactory.h>
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
+#include <AVSCommon/Utils/File/FileUtils.h>
+
+#include "Alerts/Alarm.h"
+#include "Alerts/Storage/SQLiteAlertStorage.h"
+
+namespace alexaClientSDK {
+namespace capabilityAgents {
+namespace alerts {
+namespace storage {
+namespace test {
+
+using namespace avsCommon::sdkInterfaces::audio::test;
+using namespace avsCommon::utils::configuration;
+using namespace avsCommon::utils::file;
+
+/// The file path of the database of the tests.
+static const std::string DB_FILE_PATH = "SQLiteAlertStorageTest.db";
+
+/// JSON text for the configuration of the tests.
+// clang-format off
+static const std::string ALERTS_CONFIG_JSON =
+    "{"
+      "\"alertsCapabilityAgent\":{"
+        "\"databaseFilePath\":\"" + DB_FILE_PATH + "\""
+      "}"
+    "}";
+// clang-format on
+
+/// The number of alerts in the benchmark.
+static const int BENCHMARK_ALERTS = 10000;
+
+/// The number of alerts stored one at a time in the benchmark, to compare with bulk storage.
+static const int BENCHMARK_SINGLE_ALERTS = 200;
+
+/**
+ * Creates an alarm.
+ *
+ * @param token The token of the alarm.
+ * @param secondsFromNow The number of seconds from a time in the future at which the alarm is scheduled.
+ * @return The alarm.
+ */
+static std::shared_ptr<Alert> createAlarm(const std::string& token, int secondsFromNow) {
+    auto alarm = std::make_shared<Alarm>(nullptr, nullptr);
+
+    std::ostringstream scheduledTime;
+    scheduledTime << "2099-01-01T" << std::setfill('0') << std::setw(2) << secondsFromNow / 3600 << ":"
+                  << std::setw(2) << (secondsFromNow / 60) % 60 << ":" << std::setw(2) << secondsFromNow % 60
+                  << "+0000";
+
+    // clang-format off
+    const std::string payloadJson =
+        "{"
+            "\"token\":\"" + token + "\","
+            "\"type\":\"ALARM\","
+            "\"scheduledTime\":\"" + scheduledTime.str() + "\""
+        "}";
+    // clang-format on
+
+    rapidjson::Document payload;
+    payload.Parse(payloadJson);
+    std::string errorMessage;
+    EXPECT_EQ(Alert::ParseFromJsonStatus::OK, alarm->parseFromJson(payload, &errorMessage));
+    return alarm;
+}
+
+/**
+ * Creates alarms with distinct tokens and times.
+ *
+ * @param count The number of alarms.
+ * @param tokenPrefix The prefix of their tokens.
+ * @return The alarms.
+ */
+static std::vector<std::shared_ptr<Alert>> createAlarms(int count, const std::string& tokenPrefix) {
+    std::vector<std::shared_ptr<Alert>> alarms;
+    for (int i = 0; i < count; ++i) {
+        alarms.push_back(createAlarm(tokenPrefix + std::to_string(i), i));
+    }
+    return alarms;
+}
+
+/**
+ * Gets the number of milliseconds since a time.
+ *
+ * @param start The time.
+ * @return The number of milliseconds elapsed.
+ */
+static long long millisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * Test harness for @c SQLiteAlertStorage class.
+ */
+class SQLiteAlertStorageTest : public ::testing::Test {
+public:
+    void SetUp() override;
+
+    void TearDown() override;
+
+protected:
+    /// The storage under test.
+    std::unique_ptr<SQLiteAlertStorage> m_storage;
+};
+
+void SQLiteAlertStorageTest::SetUp() {
+    removeFile(DB_FILE_PATH);
+    ASSERT_TRUE(ConfigurationNode::initialize({std::make_shared<std::stringstream>(ALERTS_CONFIG_JSON)}));
+    m_storage = SQLiteAlertStorage::create(
+        ConfigurationNode::getRoot(), std::make_shared<::testing::NiceMock<MockAlertsAudioFactory>>());
+    ASSERT_TRUE(m_storage);
+    ASSERT_TRUE(m_storage->createDatabase());
+}
+
+void SQLiteAlertStorageTest::TearDown() {
+    m_storage.reset();
+    ConfigurationNode::uninitialize();
+    removeFile(DB_FILE_PATH);
+}
+
+/// Test that alerts stored in bulk are loaded back, and that a failed bulk store stores none of them.
+TEST_F(SQLiteAlertStorageTest, bulkStoreIsAtomic) {
+    auto existing = createAlarm("existing", 0);
+    ASSERT_TRUE(m_storage->store(existing));
+
+    EXPECT_FALSE(m_storage->bulkStore({createAlarm("new", 1), createAlarm("existing", 2)}));
+    std::vector<std::shared_ptr<Alert>> loaded;
+    ASSERT_TRUE(m_storage->load(&loaded));
+    ASSERT_EQ(1u, loaded.size());
+    EXPECT_EQ("existing", loaded.front()->getToken());
+
+    EXPECT_TRUE(m_storage->bulkStore(createAlarms(3, "bulk")));
+    loaded.clear();
+    ASSERT_TRUE(m_storage->load(&loaded));
+    EXPECT_EQ(4u, loaded.size());
+}
+
+/// Test that alerts are modified and erased in bulk.
+TEST_F(SQLiteAlertStorageTest, bulkModifyAndErase) {
+    auto alarms = createAlarms(3, "alarm");
+    ASSERT_TRUE(m_storage->bulkStore(alarms));
+
+    for (auto& alarm : alarms) {
+        Alert::DynamicData dynamicData;
+        alarm->getAlertData(nullptr, &dynamicData);
+        dynamicData.state = Alert::State::ACTIVE;
+        ASSERT_TRUE(alarm->setAlertData(nullptr, &dynamicData));
+    }
+    ASSERT_TRUE(m_storage->bulkModify(alarms));
+
+    std::vector<std::shared_ptr<Alert>> loaded;
+    ASSERT_TRUE(m_storage->load(&loaded));
+    ASSERT_EQ(3u, loaded.size());
+    for (auto& alert : loaded) {
+        EXPECT_EQ(Alert::State::ACTIVE, alert->getState());
+    }
+
+    ASSERT_TRUE(m_storage->bulkErase({alarms[0], alarms[2]}));
+    loaded.clear();
+    ASSERT_TRUE(m_storage->load(&loaded));
+    ASSERT_EQ(1u, loaded.size());
+    EXPECT_EQ(alarms[1]->getToken(), loaded.front()->getToken());
+
+    // Erasing an alert which is not stored fails, and erases none of the others.
+    EXPECT_FALSE(m_storage->bulkErase({alarms[1], alarms[0]}));
+    loaded.clear();
+    ASSERT_TRUE(m_storage->load(&loaded));
+    EXPECT_EQ(1u, loaded.size());
+}
+
+/// Report how long it takes to store, load, modify and erase many alerts, in bulk and one at a time.  The times are
+/// recorded as test properties.  Disabled by default.
+TEST_F(SQLiteAlertStorageTest, DISABLED_benchmarkBulkOperations) {
+    auto singleAlarms = createAlarms(BENCHMARK_SINGLE_ALERTS, "single");
+    auto start = std::chrono::steady_clock::now();
+    for (auto& alarm : singleAlarms) {
+        ASSERT_TRUE(m_storage->store(alarm));
+    }
+    auto singleStoreMs = millisecondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (auto& alarm : singleAlarms) {
+        ASSERT_TRUE(m_storage->erase(alarm));
+    }
+    auto singleEraseMs = millisecondsSince(start);
+
+    auto alarms = createAlarms(BENCHMARK_ALERTS, "bulk");
+    start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(m_storage->bulkStore(alarms));
+    auto bulkStoreMs = millisecondsSince(start);
+
+    std::vector<std::shared_ptr<Alert>> loaded;
+    start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(m_storage->load(&loaded));
+    auto loadMs = millisecondsSince(start);
+    ASSERT_EQ(static_cast<size_t>(BENCHMARK_ALERTS), loaded.size());
+
+    start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(m_storage->bulkModify(alarms));
+    auto bulkModifyMs = millisecondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(m_storage->bulkErase(std::list<std::shared_ptr<Alert>>(alarms.begin(), alarms.end())));
+    auto bulkEraseMs = millisecondsSince(start);
+
+    RecordProperty("singleStoreMs", std::to_string(singleStoreMs));
+    RecordProperty("singleEraseMs", std::to_string(singleEraseMs));
+    RecordProperty("bulkStoreMs", std::to_string(bulkStoreMs));
+    RecordProperty("loadMs", std::to_string(loadMs));
+    RecordProperty("bulkModifyMs", std::to_string(bulkModifyMs));
+    RecordProperty("bulkEraseMs", std::to_string(bulkEraseMs));
+}
+
+}  // namespace test
+}  // namespace storage
+}  // namespace alerts
+}  // namespace capabilityAgents
+}  // namespace alexaClientSDK
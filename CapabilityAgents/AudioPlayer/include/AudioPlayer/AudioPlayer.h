@@ -158,13 +158,12 @@ private:
     /// @}
 
     /**
-     * This function deserializes a @c Directive's payload into a @c rapidjson::Document.
+     * This function gets a @c Directive's parsed payload, and reports the directive as failed if it has none.
      *
-     * @param info The @c DirectiveInfo to read the payload string from.
-     * @param[out] document The @c rapidjson::Document to parse the payload into.
-     * @return @c true if parsing was successful, else @c false.
+     * @param info The @c DirectiveInfo to read the payload from.
+     * @return The parsed payload, or @c nullptr if the payload is not valid JSON.
      */
-    bool parseDirectivePayload(std::shared_ptr<DirectiveInfo> info, rapidjson::Document* document);
+    std::shared_ptr<const rapidjson::Value> getDirectivePayload(std::shared_ptr<DirectiveInfo> info);
 
     /**
      * This function handles a @c PLAY directive.
@@ -17,11 +17,11 @@
 #define ALEXA_CLIENT_SDK_CAPABILITYAGENTS_AUDIOPLAYER_INCLUDE_AUDIOPLAYER_PROGRESSTIMER_H_
 
 #include <chrono>
-#include <condition_variable>
 #include <cstdint>
 #include <memory>
 #include <mutex>
-#include <thread>
+
+#include <AVSCommon/Utils/Timing/TimerService.h>
 
 namespace alexaClientSDK {
 namespace capabilityAgents {
@@ -149,7 +149,7 @@ private:
     friend std::ostream& operator<<(std::ostream& stream, ProgressTimer::State state);
 
     /**
-     * Set the current state.  Also notifies @c m_wake when the state changes.
+     * Set the current state.
      *
      * @param newState The state to transition to.
      * @return Whether or not the transition was allowed.
@@ -157,14 +157,24 @@ private:
     bool setState(State newState);
 
     /**
-     * Start the thread that runs @c main_loop().
+     * Schedule a request for the current progress on the @c TimerService.  @c m_stateMutex must be held when this
+     * method is called.
+     *
+     * @param delay How long to wait before requesting progress.
+     */
+    void scheduleProgressRequestLocked(std::chrono::milliseconds delay);
+
+    /**
+     * Request the current progress from the context.  This runs on a @c TimerService dispatch thread, and
+     * @c onProgress() continues once the context reports the progress.
      */
-    void startThread();
+    void requestProgress();
 
     /**
-     * Thread function that sends notifications when it is time to send progress reports.
+     * Cancel any pending progress request, waiting for one which is running to return.  @c m_stateMutex must not be
+     * held when this method is called.
      */
-    void mainLoop();
+    void cancelProgressRequest();
 
     /**
      * Step the target offset at which the next notification should be sent.
@@ -177,7 +187,7 @@ private:
     /// Mutex serializing calls to public methods.
     std::mutex m_callMutex;
 
-    /// Mutex serializing access to @c m_state, @c m_progress and @c m_gotProgress.
+    /// Mutex serializing access to @c m_state, @c m_progress and @c m_isAwaitingProgress.
     std::mutex m_stateMutex;
 
     /// The current state of the ProgressTimer.
@@ -198,17 +208,17 @@ private:
     /// The next offset at which to send a notification.
     std::chrono::milliseconds m_target;
 
-    /// Has progress been reported since last requested.
-    bool m_gotProgress;
+    /// Whether progress has been requested and not yet reported.
+    bool m_isAwaitingProgress;
 
     /// The last reported progress value.
     std::chrono::milliseconds m_progress;
 
-    /// Condition variable used to wake @c mainLoop() when there is a state change.
-    std::condition_variable m_wake;
+    /// The service which runs @c requestProgress() when it is time to check the progress again.
+    std::shared_ptr<avsCommon::utils::timing::TimerService> m_timerService;
 
-    /// The thread upon which @c mainLoop() runs.
-    std::thread m_thread;
+    /// The handle on which progress requests are scheduled.
+    std::unique_ptr<avsCommon::utils::timing::TimerService::Handle> m_timerHandle;
 };
 
 }  // namespace audioPlayer
@@ -19,7 +19,6 @@
 
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
-#include <rapidjson/error/en.h>
 
 #include <AVSCommon/AVS/CapabilityConfiguration.h>
 #include <AVSCommon/Utils/JSON/JSONUtils.h>
@@ -263,42 +262,42 @@ void AudioPlayer::onFocusChanged(FocusState newFocus) {
 
 void AudioPlayer::onPlaybackStarted(SourceId id) {
     ACSDK_DEBUG(LX("onPlaybackStarted").d("id", id));
-    m_executor.submit([this, id] { executeOnPlaybackStarted(id); });
+    m_executor.submitDetached([this, id] { executeOnPlaybackStarted(id); });
 }
 
 void AudioPlayer::onPlaybackStopped(SourceId id) {
     ACSDK_DEBUG(LX("onPlaybackStopped").d("id", id));
-    m_executor.submit([this, id] { executeOnPlaybackStopped(id); });
+    m_executor.submitDetached([this, id] { executeOnPlaybackStopped(id); });
 }
 
 void AudioPlayer::onPlaybackFinished(SourceId id) {
     ACSDK_DEBUG(LX("onPlaybackFinished").d("id", id));
-    m_executor.submit([this, id] { executeOnPlaybackFinished(id); });
+    m_executor.submitDetached([this, id] { executeOnPlaybackFinished(id); });
 }
 
 void AudioPlayer::onPlaybackError(SourceId id, const ErrorType& type, std::string error) {
     ACSDK_DEBUG(LX("onPlaybackError").d("type", type).d("error", error).d("id", id));
-    m_executor.submit([this, id, type, error] { executeOnPlaybackError(id, type, error); });
+    m_executor.submitDetached([this, id, type, error] { executeOnPlaybackError(id, type, error); });
 }
 
 void AudioPlayer::onPlaybackPaused(SourceId id) {
     ACSDK_DEBUG(LX("onPlaybackPaused").d("id", id));
-    m_executor.submit([this, id] { executeOnPlaybackPaused(id); });
+    m_executor.submitDetached([this, id] { executeOnPlaybackPaused(id); });
 }
 
 void AudioPlayer::onPlaybackResumed(SourceId id) {
     ACSDK_DEBUG(LX("onPlaybackResumed").d("id", id));
-    m_executor.submit([this, id] { executeOnPlaybackResumed(id); });
+    m_executor.submitDetached([this, id] { executeOnPlaybackResumed(id); });
 }
 
 void AudioPlayer::onBufferUnderrun(SourceId id) {
     ACSDK_DEBUG(LX("onBufferUnderrun").d("id", id));
-    m_executor.submit([this, id] { executeOnBufferUnderrun(id); });
+    m_executor.submitDetached([this, id] { executeOnBufferUnderrun(id); });
 }
 
 void AudioPlayer::onBufferRefilled(SourceId id) {
     ACSDK_DEBUG(LX("onBufferRefilled").d("id", id));
-    m_executor.submit([this, id] { executeOnBufferRefilled(id); });
+    m_executor.submitDetached([this, id] { executeOnBufferRefilled(id); });
 }
 
 void AudioPlayer::onTags(SourceId id, std::unique_ptr<const VectorOfTags> vectorOfTags) {
@@ -308,17 +307,17 @@ void AudioPlayer::onTags(SourceId id, std::unique_ptr<const VectorOfTags> vector
         return;
     }
     std::shared_ptr<const VectorOfTags> sharedVectorOfTags(std::move(vectorOfTags));
-    m_executor.submit([this, id, sharedVectorOfTags] { executeOnTags(id, sharedVectorOfTags); });
+    m_executor.submitDetached([this, id, sharedVectorOfTags] { executeOnTags(id, sharedVectorOfTags); });
 }
 
 void AudioPlayer::onProgressReportDelayElapsed() {
     ACSDK_DEBUG5(LX(__func__));
-    m_executor.submit([this] { sendEventWithTokenAndOffset("ProgressReportDelayElapsed"); });
+    m_executor.submitDetached([this] { sendEventWithTokenAndOffset("ProgressReportDelayElapsed"); });
 }
 
 void AudioPlayer::onProgressReportIntervalElapsed() {
     ACSDK_DEBUG9(LX(__func__));
-    m_executor.submit([this] { sendEventWithTokenAndOffset("ProgressReportIntervalElapsed"); });
+    m_executor.submitDetached([this] { sendEventWithTokenAndOffset("ProgressReportIntervalElapsed"); });
 }
 
 void AudioPlayer::requestProgress() {
@@ -407,28 +406,28 @@ void AudioPlayer::doShutdown() {
     m_playbackRouter.reset();
 }
 
-bool AudioPlayer::parseDirectivePayload(std::shared_ptr<DirectiveInfo> info, rapidjson::Document* document) {
-    rapidjson::ParseResult result = document->Parse(info->directive->getPayload());
-    if (result) {
-        return true;
+std::shared_ptr<const rapidjson::Value> AudioPlayer::getDirectivePayload(std::shared_ptr<DirectiveInfo> info) {
+    auto payload = info->directive->getParsedPayload();
+    if (payload) {
+        return payload;
     }
 
-    ACSDK_ERROR(LX("parseDirectivePayloadFailed")
-                    .d("reason", rapidjson::GetParseError_En(result.Code()))
-                    .d("offset", result.Offset())
+    ACSDK_ERROR(LX("getDirectivePayloadFailed")
+                    .d("reason", "invalidPayload")
                     .d("messageId", info->directive->getMessageId()));
     sendExceptionEncounteredAndReportFailed(
         info, "Unable to parse payload", ExceptionErrorType::UNEXPECTED_INFORMATION_RECEIVED);
-    return false;
+    return nullptr;
 }
 
 void AudioPlayer::handlePlayDirective(std::shared_ptr<DirectiveInfo> info) {
     ACSDK_DEBUG1(LX("handlePlayDirective"));
     ACSDK_DEBUG9(LX("PLAY").d("payload", info->directive->getPayload()));
-    rapidjson::Document payload;
-    if (!parseDirectivePayload(info, &payload)) {
+    auto parsedPayload = getDirectivePayload(info);
+    if (!parsedPayload) {
         return;
     }
+    const rapidjson::Value& payload = *parsedPayload;
 
     PlayBehavior playBehavior;
     if (!jsonUtils::retrieveValue(payload, "playBehavior", &playBehavior)) {
@@ -557,10 +556,11 @@ void AudioPlayer::handleStopDirective(std::shared_ptr<DirectiveInfo> info) {
 
 void AudioPlayer::handleClearQueueDirective(std::shared_ptr<DirectiveInfo> info) {
     ACSDK_DEBUG1(LX("handleClearQueue"));
-    rapidjson::Document payload;
-    if (!parseDirectivePayload(info, &payload)) {
+    auto parsedPayload = getDirectivePayload(info);
+    if (!parsedPayload) {
         return;
     }
+    const rapidjson::Value& payload = *parsedPayload;
 
     ClearBehavior clearBehavior;
     if (!jsonUtils::retrieveValue(payload, "clearBehavior", &clearBehavior)) {
@@ -16,7 +16,6 @@
 #include <algorithm>
 
 #include <AVSCommon/Utils/Logger/Logger.h>
-#include <AVSCommon/Utils/Timing/Timer.h>
 
 #include "AudioPlayer/ProgressTimer.h"
 
@@ -44,8 +43,10 @@ ProgressTimer::ProgressTimer() :
         m_delay{NO_DELAY},
         m_interval{NO_INTERVAL},
         m_target{std::chrono::milliseconds::zero()},
-        m_gotProgress{false},
-        m_progress{std::chrono::milliseconds::zero()} {
+        m_isAwaitingProgress{false},
+        m_progress{std::chrono::milliseconds::zero()},
+        m_timerService{TimerService::getInstance()},
+        m_timerHandle{m_timerService->createHandle()} {
 }
 
 /**
@@ -126,13 +127,14 @@ void ProgressTimer::start() {
         if (m_interval != NO_INTERVAL) {
             m_target = m_interval * ((m_offset / m_interval) + 1);
         } else {
-            ACSDK_DEBUG5(LX("startNotStartingThread").d("reason", "noTarget"));
+            ACSDK_DEBUG5(LX("startNotRequestingProgress").d("reason", "noTarget"));
             setState(State::IDLE);
             return;
         }
     }
 
-    startThread();
+    std::lock_guard<std::mutex> stateLock(m_stateMutex);
+    scheduleProgressRequestLocked(std::chrono::milliseconds::zero());
 }
 
 void ProgressTimer::pause() {
@@ -145,9 +147,7 @@ void ProgressTimer::pause() {
         return;
     }
 
-    if (m_thread.joinable()) {
-        m_thread.join();
-    }
+    cancelProgressRequest();
 }
 
 void ProgressTimer::resume() {
@@ -160,7 +160,8 @@ void ProgressTimer::resume() {
         return;
     }
 
-    startThread();
+    std::lock_guard<std::mutex> stateLock(m_stateMutex);
+    scheduleProgressRequestLocked(std::chrono::milliseconds::zero());
 }
 
 void ProgressTimer::stop() {
@@ -181,9 +182,7 @@ void ProgressTimer::stop() {
         return;
     }
 
-    if (m_thread.joinable()) {
-        m_thread.join();
-    }
+    cancelProgressRequest();
 
     if (!setState(State::IDLE)) {
         ACSDK_ERROR(LX("stopFailed").d("reason", "setStateFailed"));
@@ -202,8 +201,30 @@ void ProgressTimer::onProgress(std::chrono::milliseconds progress) {
     std::lock_guard<std::mutex> stateLock(m_stateMutex);
 
     m_progress = progress;
-    m_gotProgress = true;
-    m_wake.notify_all();
+    if (State::RUNNING != m_state || !m_isAwaitingProgress) {
+        return;
+    }
+    m_isAwaitingProgress = false;
+
+    if (m_progress < m_target) {
+        scheduleProgressRequestLocked(m_target - m_progress);
+        return;
+    }
+
+    if (m_target == m_delay) {
+        m_context->onProgressReportDelayElapsed();
+        // If delay and interval coincide, send both notifications.
+        if (m_interval != NO_INTERVAL && (m_target.count() % m_interval.count()) == 0) {
+            m_context->onProgressReportIntervalElapsed();
+        }
+    } else {
+        m_context->onProgressReportIntervalElapsed();
+    }
+    if (!updateTargetLocked()) {
+        ACSDK_DEBUG5(LX("onProgress").d("action", "noMoreProgressRequests").d("reason", "noTarget"));
+        return;
+    }
+    scheduleProgressRequestLocked(std::chrono::milliseconds::zero());
 }
 
 bool ProgressTimer::setState(State newState) {
@@ -230,7 +251,6 @@ bool ProgressTimer::setState(State newState) {
     if (allowed) {
         ACSDK_DEBUG9(LX(__func__).d("state", m_state).d("newState", newState));
         m_state = newState;
-        m_wake.notify_one();
     } else {
         ACSDK_ERROR(LX("setStateFailed").d("reason", "notAllowed").d("state", m_state).d("newState", newState));
     }
@@ -238,51 +258,28 @@ bool ProgressTimer::setState(State newState) {
     return allowed;
 }
 
-void ProgressTimer::startThread() {
-    if (m_thread.joinable()) {
-        m_thread.join();
-    }
-    m_thread = std::thread(&ProgressTimer::mainLoop, this);
+void ProgressTimer::scheduleProgressRequestLocked(std::chrono::milliseconds delay) {
+    m_timerService->schedule(
+        m_timerHandle.get(), std::chrono::steady_clock::now() + delay, [this] { requestProgress(); });
 }
 
-void ProgressTimer::mainLoop() {
-    ACSDK_DEBUG5(LX(__func__));
-
-    std::unique_lock<std::mutex> stateLock(m_stateMutex);
-
-    while (State::RUNNING == m_state) {
-        stateLock.unlock();
-        m_gotProgress = false;
-        m_context->requestProgress();
-        stateLock.lock();
-
-        m_wake.wait(stateLock, [this] { return m_state != State::RUNNING || m_gotProgress; });
-
-        if (m_state != State::RUNNING) {
-            break;
-        }
-
-        if (m_progress >= m_target) {
-            if (m_target == m_delay) {
-                m_context->onProgressReportDelayElapsed();
-                // If delay and interval coincide, send both notifications.
-                if (m_interval != NO_INTERVAL && (m_target.count() % m_interval.count()) == 0) {
-                    m_context->onProgressReportIntervalElapsed();
-                }
-            } else {
-                m_context->onProgressReportIntervalElapsed();
-            }
-            if (!updateTargetLocked()) {
-                ACSDK_DEBUG5(LX("mainLoopExiting").d("reason", "noTarget"));
-                return;
-            }
-        } else {
-            std::chrono::milliseconds timeout = m_target - m_progress;
-            m_wake.wait_for(stateLock, timeout, [this] { return m_state != State::RUNNING; });
+void ProgressTimer::requestProgress() {
+    std::shared_ptr<ContextInterface> context;
+    {
+        std::lock_guard<std::mutex> stateLock(m_stateMutex);
+        if (State::RUNNING != m_state) {
+            return;
         }
+        m_isAwaitingProgress = true;
+        context = m_context;
     }
+    context->requestProgress();
+}
 
-    ACSDK_DEBUG5(LX("mainLoopExiting").d("reason", "isStopping"));
+void ProgressTimer::cancelProgressRequest() {
+    m_timerService->cancel(m_timerHandle.get());
+    std::lock_guard<std::mutex> stateLock(m_stateMutex);
+    m_isAwaitingProgress = false;
 }
 
 bool ProgressTimer::updateTargetLocked() {
@@ -36,6 +36,7 @@ public:
      * @param configurationRoot A ConfigurationNode containing the location of the .db file.
      * Should take the form:
      * "bluetooth" : { "databaseFilePath" : "<filePath>" }
+     * If it configures an @c SQLiteStorageEngine instead, the table is stored by the engine.
      */
     static std::unique_ptr<SQLiteBluetoothStorage> create(
         const avsCommon::utils::configuration::ConfigurationNode& configurationRoot);
@@ -63,6 +64,13 @@ private:
      */
     SQLiteBluetoothStorage(const std::string& filepath);
 
+    /**
+     * Constructor for a storage object whose table is hosted by an @c SQLiteStorageEngine.
+     *
+     * @param engine The engine hosting the table.
+     */
+    SQLiteBluetoothStorage(std::shared_ptr<alexaClientSDK::storage::sqliteStorage::SQLiteStorageEngine> engine);
+
     /**
      * Utility that extracts a row from the database using a given statement. The lock must be obtained
      * before calling this function to ensure a consistent result. A step will be executed on the passed
@@ -16,6 +16,7 @@
 #include "Bluetooth/SQLiteBluetoothStorage.h"
 #include "Bluetooth/BluetoothStorageInterface.h"
 #include <AVSCommon/Utils/Logger/Logger.h>
+#include <SQLiteStorage/SQLiteStorageEngine.h>
 
 /// String to identify log entries originating from this file.
 static const std::string TAG{"SQLiteBluetoothStorage"};
@@ -33,6 +34,12 @@ namespace bluetooth {
 
 using namespace alexaClientSDK::storage::sqliteStorage;
 
+/// The name of this storage as a component of an @c SQLiteStorageEngine.
+static const std::string BLUETOOTH_COMPONENT_NAME = "bluetooth";
+
+/// The schema version of this storage as a component of an @c SQLiteStorageEngine.
+static const int BLUETOOTH_SCHEMA_VERSION = 1;
+
 /// Configuration root.
 static const std::string BLUETOOTH_CONFIGURATION_ROOT_KEY = "bluetooth";
 
@@ -51,6 +58,15 @@ static const std::string COLUMN_MAC = "mac";
 std::unique_ptr<SQLiteBluetoothStorage> SQLiteBluetoothStorage::create(
     const avsCommon::utils::configuration::ConfigurationNode& configurationRoot) {
     ACSDK_DEBUG5(LX(__func__));
+    std::shared_ptr<SQLiteStorageEngine> engine;
+    if (!SQLiteStorageEngine::getInstance(configurationRoot, &engine)) {
+        ACSDK_ERROR(LX(__func__).d("reason", "getStorageEngineFailed"));
+        return nullptr;
+    }
+    if (engine) {
+        return std::unique_ptr<SQLiteBluetoothStorage>(new SQLiteBluetoothStorage(engine));
+    }
+
     auto bluetoothConfigurationRoot = configurationRoot[BLUETOOTH_CONFIGURATION_ROOT_KEY];
     if (!bluetoothConfigurationRoot) {
         ACSDK_ERROR(LX(__func__).d("reason", "loadConfigFailed").d("key", BLUETOOTH_CONFIGURATION_ROOT_KEY));
@@ -365,6 +381,10 @@ bool SQLiteBluetoothStorage::remove(const std::string& mac) {
 SQLiteBluetoothStorage::SQLiteBluetoothStorage(const std::string& filePath) : m_db{filePath} {
 }
 
+SQLiteBluetoothStorage::SQLiteBluetoothStorage(std::shared_ptr<SQLiteStorageEngine> engine) :
+        m_db{std::move(engine), BLUETOOTH_COMPONENT_NAME, BLUETOOTH_SCHEMA_VERSION} {
+}
+
 }  // namespace bluetooth
 }  // namespace capabilityAgents
 }  // namespace alexaClientSDK
@@ -19,6 +19,7 @@
 #include <mutex>
 #include <unordered_set>
 
+#include <AVSCommon/Utils/File/AssetCache.h>
 #include <AVSCommon/Utils/MediaPlayer/MediaPlayerInterface.h>
 #include <AVSCommon/Utils/MediaPlayer/MediaPlayerObserverInterface.h>
 
@@ -44,10 +45,13 @@ public:
      * IDLE state, awaiting request to render notifications.
      *
      * @param mediaPlayer The @c MediaPlayer instance to use to render audio.
+     * @param assetCache An optional cache of the audio assets, which are fetched when they are prefetched and played
+     * from the cache when they are in it.
      * @return The new NotificationRenderer, or null if the operation fails.
      */
     static std::shared_ptr<NotificationRenderer> create(
-        std::shared_ptr<avsCommon::utils::mediaPlayer::MediaPlayerInterface> mediaPlayer);
+        std::shared_ptr<avsCommon::utils::mediaPlayer::MediaPlayerInterface> mediaPlayer,
+        std::shared_ptr<avsCommon::utils::file::AssetCache> assetCache = nullptr);
 
     /// @name NotificationRendererInterface methods
     /// @{
@@ -56,6 +60,7 @@ public:
     bool renderNotification(std::function<std::unique_ptr<std::istream>()> audioFactory, const std::string& url)
         override;
     bool cancelNotificationRendering() override;
+    void prefetch(const std::string& url) override;
     /// @}
 
     /// @name MediaPlayerObserverInterface methods
@@ -111,8 +116,11 @@ private:
      * Constructor.
      *
      * @param mediaPlayer The @c MediaPlayer instance to use to render audio.
+     * @param assetCache The cache of the audio assets, or @c nullptr to stream them.
      */
-    NotificationRenderer(std::shared_ptr<avsCommon::utils::mediaPlayer::MediaPlayerInterface> mediaPlayer);
+    NotificationRenderer(
+        std::shared_ptr<avsCommon::utils::mediaPlayer::MediaPlayerInterface> mediaPlayer,
+        std::shared_ptr<avsCommon::utils::file::AssetCache> assetCache);
 
     /**
      * Handle the completion of rendering an audio asset, whether successful or not.
@@ -149,6 +157,9 @@ private:
     /// The mediaPlayer with which to render the notification.
     std::shared_ptr<avsCommon::utils::mediaPlayer::MediaPlayerInterface> m_mediaPlayer;
 
+    /// The cache of the audio assets, or @c nullptr to stream them.
+    std::shared_ptr<avsCommon::utils::file::AssetCache> m_assetCache;
+
     /// The observers to notify when rendering is finished.  Access serialized by @c m_mutex.
     std::unordered_set<std::shared_ptr<NotificationRendererObserverInterface>> m_observers;
 
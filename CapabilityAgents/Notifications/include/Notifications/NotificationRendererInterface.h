@@ -69,8 +69,19 @@ public:
      * @return Whether or not the cancellation was allowed.
      */
     virtual bool cancelNotificationRendering() = 0;
+
+    /**
+     * Prepare to render a notification audio clip later, for example by fetching it ahead of time.  The default
+     * implementation does nothing.
+     *
+     * @param url URL of the audio asset which may be rendered.
+     */
+    virtual void prefetch(const std::string& url);
 };
 
+inline void NotificationRendererInterface::prefetch(const std::string& url) {
+}
+
 }  // namespace notifications
 }  // namespace capabilityAgents
 }  // namespace alexaClientSDK
@@ -34,7 +34,9 @@ namespace notifications {
 class SQLiteNotificationsStorage : public NotificationsStorageInterface {
 public:
     /**
-     * Factory method for creating a storage object for Notifications based on an SQLite database.
+     * Factory method for creating a storage object for Notifications based on an SQLite database.  If the
+     * configuration has an @c SQLiteStorageEngine, the notifications are stored by the engine instead of a file of
+     * their own.
      *
      * @param configurationRoot The global config object.
      * @return Pointer to the SQLiteMessagetStorge object, nullptr if there's an error creating it.
@@ -49,6 +51,13 @@ public:
      */
     SQLiteNotificationsStorage(const std::string& databaseFilePath);
 
+    /**
+     * Constructor for a storage object whose tables are hosted by an @c SQLiteStorageEngine.
+     *
+     * @param engine The engine hosting the tables.
+     */
+    SQLiteNotificationsStorage(std::shared_ptr<storage::sqliteStorage::SQLiteStorageEngine> engine);
+
     ~SQLiteNotificationsStorage();
 
     bool createDatabase() override;
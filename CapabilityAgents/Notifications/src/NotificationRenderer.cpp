@@ -64,13 +64,15 @@ std::ostream& operator<<(std::ostream& stream, const NotificationRenderer::State
     return stream;
 }
 
-std::shared_ptr<NotificationRenderer> NotificationRenderer::create(std::shared_ptr<MediaPlayerInterface> mediaPlayer) {
+std::shared_ptr<NotificationRenderer> NotificationRenderer::create(
+    std::shared_ptr<MediaPlayerInterface> mediaPlayer,
+    std::shared_ptr<avsCommon::utils::file::AssetCache> assetCache) {
     ACSDK_DEBUG5(LX("create"));
     if (!mediaPlayer) {
         ACSDK_ERROR(LX("createFailed").d("reason", "nullMediaPlayer"));
         return nullptr;
     }
-    std::shared_ptr<NotificationRenderer> result(new NotificationRenderer(mediaPlayer));
+    std::shared_ptr<NotificationRenderer> result(new NotificationRenderer(mediaPlayer, assetCache));
     mediaPlayer->setObserver(result);
     return result;
 }
@@ -112,7 +114,12 @@ bool NotificationRenderer::renderNotification(
     }
 
     m_audioFactory = audioFactory;
-    m_sourceId = m_mediaPlayer->setSource(url);
+    std::shared_ptr<std::istream> cachedAudio = m_assetCache ? m_assetCache->open(url) : nullptr;
+    if (cachedAudio) {
+        m_sourceId = m_mediaPlayer->setSource(cachedAudio, false);
+    } else {
+        m_sourceId = m_mediaPlayer->setSource(url);
+    }
     if (m_sourceId != MediaPlayerInterface::ERROR && m_mediaPlayer->play(m_sourceId)) {
         ACSDK_DEBUG5(LX("renderNotificationPreferredSuccess").d("sourceId", m_sourceId));
         return true;
@@ -149,6 +156,12 @@ bool NotificationRenderer::cancelNotificationRendering() {
     return true;
 }
 
+void NotificationRenderer::prefetch(const std::string& url) {
+    if (m_assetCache && !url.empty()) {
+        m_assetCache->prefetch({url});
+    }
+}
+
 void NotificationRenderer::onPlaybackStarted(SourceId sourceId) {
     ACSDK_DEBUG5(LX("onPlaybackStarted").d("sourceId", sourceId));
     if (sourceId != m_sourceId) {
@@ -219,8 +232,11 @@ void NotificationRenderer::onPlaybackError(SourceId sourceId, const ErrorType& t
     });
 }
 
-NotificationRenderer::NotificationRenderer(std::shared_ptr<MediaPlayerInterface> mediaPlayer) :
+NotificationRenderer::NotificationRenderer(
+    std::shared_ptr<MediaPlayerInterface> mediaPlayer,
+    std::shared_ptr<avsCommon::utils::file::AssetCache> assetCache) :
         m_mediaPlayer{mediaPlayer},
+        m_assetCache{assetCache},
         m_state{State::IDLE},
         m_sourceId{MediaPlayerInterface::ERROR} {
 }
@@ -343,6 +343,10 @@ void NotificationsCapabilityAgent::handleSetIndicatorDirective(std::shared_ptr<D
         }
     }
 
+    if (playAudioIndicator) {
+        m_renderer->prefetch(url);
+    }
+
     const NotificationIndicator nextNotificationIndicator(persistVisualIndicator, playAudioIndicator, assetId, url);
     m_executor.submit(
         [this, nextNotificationIndicator, info] { executeSetIndicator(nextNotificationIndicator, info); });
@@ -15,6 +15,7 @@
 
 #include <SQLiteStorage/SQLiteUtils.h>
 #include <SQLiteStorage/SQLiteStatement.h>
+#include <SQLiteStorage/SQLiteStorageEngine.h>
 
 #include <AVSCommon/Utils/File/FileUtils.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
@@ -39,6 +40,11 @@ static const std::string TAG("SQLiteNotificationsStorage");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+/// The name of this storage as a component of an @c SQLiteStorageEngine.
+static const std::string NOTIFICATIONS_COMPONENT_NAME = "notifications";
+/// The schema version of this storage as a component of an @c SQLiteStorageEngine.
+static const int NOTIFICATIONS_SCHEMA_VERSION = 1;
+
 /// The key in our config file to find the root of settings.
 static const std::string NOTIFICATIONS_CONFIGURATION_ROOT_KEY = "notifications";
 
@@ -69,6 +75,15 @@ static const std::string CREATE_INDICATOR_STATE_TABLE_SQL_STRING =
 
 std::unique_ptr<SQLiteNotificationsStorage> SQLiteNotificationsStorage::create(
     const avsCommon::utils::configuration::ConfigurationNode& configurationRoot) {
+    std::shared_ptr<SQLiteStorageEngine> engine;
+    if (!SQLiteStorageEngine::getInstance(configurationRoot, &engine)) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "Could not get storage engine"));
+        return nullptr;
+    }
+    if (engine) {
+        return std::unique_ptr<SQLiteNotificationsStorage>(new SQLiteNotificationsStorage(engine));
+    }
+
     auto notificationConfigurationRoot = configurationRoot[NOTIFICATIONS_CONFIGURATION_ROOT_KEY];
     if (!notificationConfigurationRoot) {
         ACSDK_ERROR(LX("createFailed")
@@ -92,6 +107,10 @@ SQLiteNotificationsStorage::SQLiteNotificationsStorage(const std::string& databa
         m_database{databaseFilePath} {
 }
 
+SQLiteNotificationsStorage::SQLiteNotificationsStorage(std::shared_ptr<SQLiteStorageEngine> engine) :
+        m_database{std::move(engine), NOTIFICATIONS_COMPONENT_NAME, NOTIFICATIONS_SCHEMA_VERSION} {
+}
+
 bool SQLiteNotificationsStorage::createDatabase() {
     if (!m_database.initialize()) {
         ACSDK_ERROR(LX("createDatabaseFailed").d("reason", "SQLiteCreateDatabaseFailed"));
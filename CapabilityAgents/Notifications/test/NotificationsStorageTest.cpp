@@ -13,8 +13,11 @@
  * permissions and limitations under the License.
  */
 
+#include <chrono>
+#include <iostream>
 #include <memory>
 #include <random>
+#include <sstream>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
@@ -22,6 +25,7 @@
 #include <Notifications/SQLiteNotificationsStorage.h>
 #include <Notifications/NotificationIndicator.h>
 
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <AVSCommon/Utils/File/FileUtils.h>
 
 using namespace ::testing;
@@ -31,6 +35,7 @@ namespace capabilityAgents {
 namespace notifications {
 namespace test {
 
+using namespace avsCommon::utils::configuration;
 using namespace avsCommon::utils::file;
 using IndicatorState = avsCommon::avs::IndicatorState;
 
@@ -57,6 +62,16 @@ static const unsigned int NOTIFICATION_INDICATOR_SEED = 1;
 /// The max random number to generate.
 static const unsigned int MAX_RANDOM_INT = 100;
 
+/// The number of notifications enqueued and dequeued by the benchmark.
+static const int BENCHMARK_NOTIFICATIONS = 200;
+
+/// A connection profile like the one the database was opened with before connection profiles.
+static const std::string ROLLBACK_JOURNAL_PROFILE_JSON =
+    R"({"sqliteStorage":{"journalMode":"DELETE","synchronous":"FULL","statementCacheSize":0}})";
+
+/// The default connection profile.
+static const std::string DEFAULT_PROFILE_JSON = R"({})";
+
 /**
  * Utility function to determine if the storage component is opened.
  *
@@ -88,6 +103,15 @@ public:
         const NotificationIndicator& actual,
         const NotificationIndicator& expected);
 
+    /**
+     * Utility function to enqueue, peek and dequeue notifications one at a time in a database opened with a
+     * connection profile, as a notification arriving and being rendered does.
+     *
+     * @param profileJson The configuration of the connection profile.
+     * @return How long it took.
+     */
+    std::chrono::steady_clock::duration enqueueAndDequeueWithProfile(const std::string& profileJson);
+
 protected:
     /// The message database object we will test.
     std::shared_ptr<SQLiteNotificationsStorage> m_storage;
@@ -122,6 +146,30 @@ void NotificationsStorageTest::checkNotificationIndicatorsEquality(
     ASSERT_EQ(actual.asset.url, expected.asset.url);
 }
 
+std::chrono::steady_clock::duration NotificationsStorageTest::enqueueAndDequeueWithProfile(
+    const std::string& profileJson) {
+    cleanupLocalDbFile();
+    EXPECT_TRUE(ConfigurationNode::initialize({std::make_shared<std::stringstream>(profileJson)}));
+    SQLiteNotificationsStorage storage(TEST_DATABASE_FILE_PATH);
+    ConfigurationNode::uninitialize();
+    EXPECT_TRUE(storage.createDatabase());
+
+    NotificationIndicator indicator(true, true, TEST_ASSET_ID1, TEST_ASSET_URL1);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCHMARK_NOTIFICATIONS; ++i) {
+        EXPECT_TRUE(storage.enqueue(indicator));
+        EXPECT_TRUE(storage.setIndicatorState(IndicatorState::ON));
+        NotificationIndicator peeked;
+        EXPECT_TRUE(storage.peek(&peeked));
+        EXPECT_TRUE(storage.dequeue());
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    storage.close();
+    cleanupLocalDbFile();
+    return elapsed;
+}
+
 /**
  * Test basic construction. Database should not be open.
  */
@@ -400,6 +448,23 @@ TEST_F(NotificationsStorageTest, testSize) {
     ASSERT_EQ(size, 0);
 }
 
+/**
+ * Report how long it takes to enqueue and dequeue notifications with the connection profile the database was opened
+ * with before against the default connection profile.  The times are recorded as test properties.  Disabled by
+ * default.
+ */
+TEST_F(NotificationsStorageTest, DISABLED_benchmarkConnectionProfiles) {
+    auto rollbackJournalElapsed = enqueueAndDequeueWithProfile(ROLLBACK_JOURNAL_PROFILE_JSON);
+    auto defaultElapsed = enqueueAndDequeueWithProfile(DEFAULT_PROFILE_JSON);
+
+    RecordProperty(
+        "rollbackJournalMs",
+        std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(rollbackJournalElapsed).count()));
+    RecordProperty(
+        "defaultProfileMs",
+        std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(defaultElapsed).count()));
+}
+
 }  // namespace test
 }  // namespace notifications
 }  // namespace capabilityAgents
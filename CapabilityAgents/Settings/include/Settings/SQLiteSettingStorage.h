@@ -33,7 +33,8 @@ namespace settings {
 class SQLiteSettingStorage : public SettingsStorageInterface {
 public:
     /**
-     * Factory method for creating a storage object for Settings based on an SQLite database.
+     * Factory method for creating a storage object for Settings based on an SQLite database.  If the configuration
+     * has an @c SQLiteStorageEngine, the settings are stored by the engine instead of a file of their own.
      *
      * @param configurationRoot The global config object.
      * @return Pointer to the SQLiteSettingStorage object, nullptr if there's an error creating it.
@@ -48,6 +49,13 @@ public:
      */
     SQLiteSettingStorage(const std::string& databaseFilePath);
 
+    /**
+     * Constructor for a storage object whose table is hosted by an @c SQLiteStorageEngine.
+     *
+     * @param engine The engine hosting the table.
+     */
+    SQLiteSettingStorage(std::shared_ptr<storage::sqliteStorage::SQLiteStorageEngine> engine);
+
     bool createDatabase() override;
 
     bool open() override;
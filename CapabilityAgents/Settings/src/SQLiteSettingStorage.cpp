@@ -14,6 +14,7 @@
  */
 
 #include <SQLiteStorage/SQLiteStatement.h>
+#include <SQLiteStorage/SQLiteStorageEngine.h>
 #include <SQLiteStorage/SQLiteUtils.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 #include <AVSCommon/Utils/String/StringUtils.h>
@@ -38,6 +39,11 @@ static const std::string TAG("SQLiteSettingsStorage");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+/// The name of this storage as a component of an @c SQLiteStorageEngine.
+static const std::string SETTINGS_COMPONENT_NAME = "settings";
+/// The schema version of this storage as a component of an @c SQLiteStorageEngine.
+static const int SETTINGS_SCHEMA_VERSION = 1;
+
 /// The key in our config file to find the root of settings.
 static const std::string SETTINGS_CONFIGURATION_ROOT_KEY = "settings";
 /// The key in our config file to find the database file path.
@@ -56,6 +62,15 @@ static const std::string CREATE_SETTINGS_TABLE_SQL_STRING = std::string("CREATE
 
 std::unique_ptr<SQLiteSettingStorage> SQLiteSettingStorage::create(
     const avsCommon::utils::configuration::ConfigurationNode& configurationRoot) {
+    std::shared_ptr<SQLiteStorageEngine> engine;
+    if (!SQLiteStorageEngine::getInstance(configurationRoot, &engine)) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "Could not get storage engine"));
+        return nullptr;
+    }
+    if (engine) {
+        return std::unique_ptr<SQLiteSettingStorage>(new SQLiteSettingStorage(engine));
+    }
+
     auto settingsConfigurationRoot = configurationRoot[SETTINGS_CONFIGURATION_ROOT_KEY];
     if (!settingsConfigurationRoot) {
         ACSDK_ERROR(LX("createFailed")
@@ -77,6 +92,10 @@ std::unique_ptr<SQLiteSettingStorage> SQLiteSettingStorage::create(
 SQLiteSettingStorage::SQLiteSettingStorage(const std::string& databaseFilePath) : m_database{databaseFilePath} {
 }
 
+SQLiteSettingStorage::SQLiteSettingStorage(std::shared_ptr<SQLiteStorageEngine> engine) :
+        m_database{std::move(engine), SETTINGS_COMPONENT_NAME, SETTINGS_SCHEMA_VERSION} {
+}
+
 bool SQLiteSettingStorage::createDatabase() {
     if (!m_database.initialize()) {
         ACSDK_ERROR(LX("createDatabaseFailed").d("reason", "SQLiteCreateDatabaseFailed"));
@@ -16,7 +16,6 @@
 #include <rapidjson/document.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
-#include <rapidjson/error/en.h>
 
 #include <AVSCommon/AVS/CapabilityConfiguration.h>
 #include <AVSCommon/AVS/SpeakerConstants/SpeakerConstants.h>
@@ -140,9 +139,11 @@ std::shared_ptr<CapabilityConfiguration> getSpeakerCapabilityConfiguration() {
 
 DirectiveHandlerConfiguration SpeakerManager::getConfiguration() const {
     DirectiveHandlerConfiguration configuration;
-    configuration[SET_VOLUME] = BlockingPolicy::NON_BLOCKING;
-    configuration[ADJUST_VOLUME] = BlockingPolicy::NON_BLOCKING;
-    configuration[SET_MUTE] = BlockingPolicy::NON_BLOCKING;
+    // Volume changes use neither audio nor visual lane, so they are not held up behind speech or cards.
+    auto neitherAudioNorVisualNonBlocking = BlockingPolicy(BlockingPolicy::MEDIUMS_NONE, false);
+    configuration[SET_VOLUME] = neitherAudioNorVisualNonBlocking;
+    configuration[ADJUST_VOLUME] = neitherAudioNorVisualNonBlocking;
+    configuration[SET_MUTE] = neitherAudioNorVisualNonBlocking;
     return configuration;
 }
 
@@ -162,24 +163,6 @@ void SpeakerManager::handleDirectiveImmediately(std::shared_ptr<AVSDirective> di
     handleDirective(std::make_shared<DirectiveInfo>(directive, nullptr));
 };
 
-bool SpeakerManager::parseDirectivePayload(std::string payload, Document* document) {
-    if (!document) {
-        ACSDK_ERROR(LX("parseDirectivePayloadFailed").d("reason", "nullDocument"));
-        return false;
-    }
-
-    ParseResult result = document->Parse(payload);
-    if (!result) {
-        ACSDK_ERROR(LX("parseDirectivePayloadFailed")
-                        .d("reason", "parseFailed")
-                        .d("error", GetParseError_En(result.Code()))
-                        .d("offset", result.Offset()));
-        return false;
-    }
-
-    return true;
-}
-
 void SpeakerManager::sendExceptionEncountered(
     std::shared_ptr<CapabilityAgent::DirectiveInfo> info,
     const std::string& message,
@@ -239,11 +222,13 @@ void SpeakerManager::handleDirective(std::shared_ptr<CapabilityAgent::DirectiveI
     // Handling only AVS Speaker API volume here.
     SpeakerInterface::Type directiveType = SpeakerInterface::Type::AVS_SPEAKER_VOLUME;
 
-    Document payload(kObjectType);
-    if (!parseDirectivePayload(info->directive->getPayload(), &payload)) {
+    auto parsedPayload = info->directive->getParsedPayload();
+    if (!parsedPayload) {
+        ACSDK_ERROR(LX("handleDirectiveFailed").d("reason", "invalidPayload"));
         sendExceptionEncountered(info, "Payload Parsing Failed", ExceptionErrorType::UNEXPECTED_INFORMATION_RECEIVED);
         return;
     }
+    const Value& payload = *parsedPayload;
 
     /*
      * For AdjustVolume and SetVolume, unmute the speaker before a volume change. This behavior
@@ -253,7 +238,7 @@ void SpeakerManager::handleDirective(std::shared_ptr<CapabilityAgent::DirectiveI
         int64_t volume;
         if (jsonUtils::retrieveValue(payload, VOLUME_KEY, &volume) &&
             withinBounds(volume, static_cast<int64_t>(AVS_SET_VOLUME_MIN), static_cast<int64_t>(AVS_SET_VOLUME_MAX))) {
-            m_executor.submit([this, volume, directiveType, info] {
+            m_executor.submitDetached([this, volume, directiveType, info] {
                 /*
                  * Since AVS doesn't have a concept of Speaker IDs or types, no-op if a directive
                  * comes in and there are no AVS_SPEAKER_VOLUME speakers.
@@ -286,7 +271,7 @@ void SpeakerManager::handleDirective(std::shared_ptr<CapabilityAgent::DirectiveI
         if (jsonUtils::retrieveValue(payload, VOLUME_KEY, &delta) &&
             withinBounds(
                 delta, static_cast<int64_t>(AVS_ADJUST_VOLUME_MIN), static_cast<int64_t>(AVS_ADJUST_VOLUME_MAX))) {
-            m_executor.submit([this, delta, directiveType, info] {
+            m_executor.submitDetached([this, delta, directiveType, info] {
                 /*
                  * Since AVS doesn't have a concept of Speaker IDs or types, no-op if a directive
                  * comes in and there are no AVS_SPEAKER_VOLUME speakers.
@@ -317,7 +302,7 @@ void SpeakerManager::handleDirective(std::shared_ptr<CapabilityAgent::DirectiveI
     } else if (directiveName == SET_MUTE.name) {
         bool mute = false;
         if (jsonUtils::retrieveValue(payload, MUTE_KEY, &mute)) {
-            m_executor.submit([this, mute, directiveType, info] {
+            m_executor.submitDetached([this, mute, directiveType, info] {
                 /*
                  * Since AVS doesn't have a concept of Speaker IDs or types, no-op if a directive
                  * comes in and there are no AVS_SPEAKER_VOLUME speakers.
@@ -146,7 +146,7 @@ std::shared_ptr<SpeechSynthesizer> SpeechSynthesizer::create(
 
 avsCommon::avs::DirectiveHandlerConfiguration SpeechSynthesizer::getConfiguration() const {
     avsCommon::avs::DirectiveHandlerConfiguration configuration;
-    configuration[SPEAK] = avsCommon::avs::BlockingPolicy::BLOCKING;
+    configuration[SPEAK] = avsCommon::avs::BlockingPolicy(avsCommon::avs::BlockingPolicy::MEDIUM_AUDIO, true);
     return configuration;
 }
 
@@ -403,8 +403,8 @@ void SpeechSynthesizer::executePreHandleAfterValidation(std::shared_ptr<SpeakDir
         return;
     }
 
-    Document payload;
-    if (payload.Parse(speakInfo->directive->getPayload()).HasParseError()) {
+    auto parsedPayload = speakInfo->directive->getParsedPayload();
+    if (!parsedPayload) {
         const std::string message("unableToParsePayload" + speakInfo->directive->getMessageId());
         ACSDK_ERROR(
             LX("executePreHandleFailed").d("reason", message).d("messageId", speakInfo->directive->getMessageId()));
@@ -413,6 +413,7 @@ void SpeechSynthesizer::executePreHandleAfterValidation(std::shared_ptr<SpeakDir
         return;
     }
 
+    const Value& payload = *parsedPayload;
     Value::ConstMemberIterator it = payload.FindMember(KEY_TOKEN);
     if (payload.MemberEnd() == it) {
         sendExceptionEncounteredAndReportMissingProperty(speakInfo, KEY_TOKEN);
@@ -15,8 +15,6 @@
 
 #include <ostream>
 
-#include <rapidjson/error/en.h>
-
 #include <AVSCommon/AVS/CapabilityConfiguration.h>
 #include <AVSCommon/Utils/JSON/JSONUtils.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
@@ -315,12 +313,10 @@ void TemplateRuntime::handleRenderPlayerInfoDirective(std::shared_ptr<DirectiveI
         ACSDK_DEBUG5(LX("handleRenderPlayerInfoDirectiveInExecutor"));
         m_isRenderTemplateLastReceived = false;
 
-        rapidjson::Document payload;
-        rapidjson::ParseResult result = payload.Parse(info->directive->getPayload());
-        if (!result) {
+        auto parsedPayload = info->directive->getParsedPayload();
+        if (!parsedPayload) {
             ACSDK_ERROR(LX("handleRenderPlayerInfoDirectiveInExecutorParseFailed")
-                            .d("reason", rapidjson::GetParseError_En(result.Code()))
-                            .d("offset", result.Offset())
+                            .d("reason", "invalidPayload")
                             .d("messageId", info->directive->getMessageId()));
             sendExceptionEncounteredAndReportFailed(
                 info, "Unable to parse payload", ExceptionErrorType::UNEXPECTED_INFORMATION_RECEIVED);
@@ -328,7 +324,7 @@ void TemplateRuntime::handleRenderPlayerInfoDirective(std::shared_ptr<DirectiveI
         }
 
         std::string audioItemId;
-        if (!jsonUtils::retrieveValue(payload, AUDIO_ITEM_ID_TAG, &audioItemId)) {
+        if (!jsonUtils::retrieveValue(*parsedPayload, AUDIO_ITEM_ID_TAG, &audioItemId)) {
             ACSDK_ERROR(LX("handleRenderPlayerInfoDirective")
                             .d("reason", "missingAudioItemId")
                             .d("messageId", info->directive->getMessageId()));
@@ -28,7 +28,9 @@
 #include <RegistrationManager/CustomerDataManager.h>
 
 #include <deque>
+#include <future>
 #include <memory>
+#include <vector>
 
 namespace alexaClientSDK {
 namespace certifiedSender {
@@ -37,6 +39,8 @@ namespace certifiedSender {
 static const int CERTIFIED_SENDER_QUEUE_SIZE_WARN_LIMIT = 25;
 /// The maximum number of items we can store for sending.
 static const int CERTIFIED_SENDER_QUEUE_SIZE_HARD_LIMIT = 50;
+/// The maximum number of items we send before the first of them has been responded to.
+static const int CERTIFIED_SENDER_MAX_MESSAGES_IN_FLIGHT = 1;
 
 /**
  * This class provides a guaranteed message delivery service to AVS.  Upon calling the single api,
@@ -48,9 +52,16 @@ static const int CERTIFIED_SENDER_QUEUE_SIZE_HARD_LIMIT = 50;
  *
  * Similarly, the file path for the database storage is configured under the setting 'databaseFilePath'.
  *
+ * Messages passed to @c sendJSONMessage while earlier ones are being persisted are persisted together, and messages
+ * responded to together are erased together, so that a burst of messages costs a few storage commits rather than two
+ * per message.
+ *
  * This class maintains the ordering of messages passed to it.  For example, if @c sendJSONMessage is invoked with
  * messages A then B then C, then this class guarantees that the messages will be sent to AVS in the same order -
- * A then B then C.
+ * A then B then C.  Up to 'maxMessagesInFlight' messages (by default 1) are sent before the first of them is responded
+ * to.  If one of them fails to be sent, it and every message sent after it are sent again in order once all of them
+ * have been responded to, so a message may be delivered more than once, but is never last delivered before a message
+ * passed to @c sendJSONMessage ahead of it.
  */
 class CertifiedSender
         : public avsCommon::utils::RequiresShutdown
@@ -96,6 +107,17 @@ public:
     void clearData() override;
 
 private:
+    /**
+     * The mutex and condition variable with which the worker thread waits for work.  Each @c CertifiedMessageRequest
+     * shares them, so that it can wake the worker thread without keeping the @c CertifiedSender alive.
+     */
+    struct WorkerSignal {
+        /// Mutex to protect access to the @c CertifiedSender's data members.
+        std::mutex mutex;
+        /// A condition variable with which to notify the worker thread that there may be work to do.
+        std::condition_variable condition;
+    };
+
     /**
      * A utility class to manage interaction with the MessageSender.
      */
@@ -106,8 +128,10 @@ private:
          *
          * @param jsonContent The JSON text to be sent to AVS.
          * @param dbId The database id associated with this @c MessageRequest.
+         * @param workerSignal The signal with which to wake the worker thread when the @c MessageSender has completed
+         * processing the message.
          */
-        CertifiedMessageRequest(const std::string& jsonContent, int dbId);
+        CertifiedMessageRequest(const std::string& jsonContent, int dbId, std::shared_ptr<WorkerSignal> workerSignal);
 
         void exceptionReceived(const std::string& exceptionMessage) override;
 
@@ -115,11 +139,13 @@ private:
             avsCommon::sdkInterfaces::MessageRequestObserverInterface::Status sendMessageStatus) override;
 
         /**
-         * A blocking function which will return once the @c MessageSender has completed processing the message.
+         * Checks whether the @c MessageSender has completed processing the message.
          *
-         * @return The status returned by the @c MessageSender once it's handled the message (successfully or not).
+         * @param[out] status The status returned by the @c MessageSender once it's handled the message (successfully
+         * or not), if it has.
+         * @return Whether the @c MessageSender has completed processing the message.
          */
-        avsCommon::sdkInterfaces::MessageRequestObserverInterface::Status waitForCompletion();
+        bool isCompleted(avsCommon::sdkInterfaces::MessageRequestObserverInterface::Status* status);
 
         /**
          * Utility function to return the database id associated with this @c MessageRequest.
@@ -128,24 +154,33 @@ private:
          */
         int getDbId();
 
+    private:
         /**
-         * A function that allows early exit of the message sending logic.
+         * Records the response to the message and wakes the worker thread, unless a response has already been
+         * recorded.
+         *
+         * @param sendMessageStatus The status of the response.
          */
-        void shutdown();
+        void complete(avsCommon::sdkInterfaces::MessageRequestObserverInterface::Status sendMessageStatus);
 
-    private:
         /// The status of whether the message was sent to AVS ok.
         avsCommon::sdkInterfaces::MessageRequestObserverInterface::Status m_sendMessageStatus;
         /// Captures if the @c MessageRequest has been processed or not by AVS.
         bool m_responseReceived;
         /// Mutex used to enforce thread safety.
         std::mutex m_mutex;
-        /// The condition variable used when waiting for the @c MessageRequest to be processed.
-        std::condition_variable m_cv;
         /// The database id associated with this @c MessageRequest.
         int m_dbId;
-        /// A control so we may allow the message to stop waiting to be sent.
-        bool m_isShuttingDown;
+        /// The signal with which to wake the worker thread when the @c MessageRequest has been processed.
+        std::shared_ptr<WorkerSignal> m_workerSignal;
+    };
+
+    /// A message passed to @c sendJSONMessage which has not been persisted yet.
+    struct PendingMessage {
+        /// The message to be sent to AVS.
+        std::string jsonMessage;
+        /// The promise to fulfil with whether the message was successfully persisted.
+        std::promise<bool> persisted;
     };
 
     /**
@@ -157,6 +192,7 @@ private:
      * @param dataManager A dataManager object that will track the CustomerDataHandler.
      * @param queueSizeWarnLimit The number of items we can store for sending without emitting a warning.
      * @param queueSizeHardLimit The maximum number of items we can store for sending.
+     * @param maxMessagesInFlight The maximum number of items we send before the first of them is responded to.
      */
     CertifiedSender(
         std::shared_ptr<avsCommon::sdkInterfaces::MessageSenderInterface> messageSender,
@@ -164,7 +200,8 @@ private:
         std::shared_ptr<MessageStorageInterface> storage,
         std::shared_ptr<registrationManager::CustomerDataManager> dataManager,
         int queueSizeWarnLimit = CERTIFIED_SENDER_QUEUE_SIZE_WARN_LIMIT,
-        int queueSizeHardLimit = CERTIFIED_SENDER_QUEUE_SIZE_HARD_LIMIT);
+        int queueSizeHardLimit = CERTIFIED_SENDER_QUEUE_SIZE_HARD_LIMIT,
+        int maxMessagesInFlight = CERTIFIED_SENDER_MAX_MESSAGES_IN_FLIGHT);
 
     void onConnectionStatusChanged(
         const avsCommon::sdkInterfaces::ConnectionStatusObserverInterface::Status status,
@@ -178,12 +215,10 @@ private:
     bool init();
 
     /**
-     * The actual handling of the sendJSONMessage call by our internal executor.
-     *
-     * @param jsonMessage The message to be sent to AVS.
-     * @return Whether the message was successfully persisted.
+     * The actual handling of the sendJSONMessage calls by our internal executor.  Persists all the messages in
+     * @c m_pendingMessages together.
      */
-    bool executeSendJSONMessage(std::string jsonMessage);
+    void executeSendJSONMessages();
 
     void doShutdown() override;
 
@@ -192,35 +227,69 @@ private:
      */
     void mainloop();
 
+    /**
+     * Checks whether every message which has been sent and not yet erased has been responded to.  The mutex of
+     * @c m_workerSignal must be held when this is called.
+     *
+     * @return Whether every message in flight has been responded to.
+     */
+    bool allMessagesInFlightCompletedLocked();
+
+    /**
+     * Checks whether the worker thread has anything to do.  The mutex of @c m_workerSignal must be held when this is
+     * called.
+     *
+     * @return Whether the worker thread has anything to do.
+     */
+    bool hasWorkLocked();
+
     /// A queue size threshold, beyond which we will emit warnings if more items are added.
     int m_queueSizeWarnLimit;
     /// The maximum possible size of the queue.
     int m_queueSizeHardLimit;
+    /// The maximum number of messages sent before the first of them has been responded to.
+    int m_maxMessagesInFlight;
 
     /// The thread that will actually handle the sending of messages.
     std::thread m_workerThread;
     /// A control so we may disable the worker thread on shutdown.
     bool m_isShuttingDown;
-    /// Mutex to protect access to class data members.
-    std::mutex m_mutex;
-    /// A condition variable with which to notify the worker thread that a new item was added to the queue.
-    std::condition_variable m_workerThreadCV;
+    /// The mutex protecting the members below, and the condition variable on which the worker thread waits.
+    std::shared_ptr<WorkerSignal> m_workerSignal;
 
     /// A variable to capture if we are currently connected to AVS.
     bool m_isConnected;
 
-    /// Our queue of requests that should be sent.
+    /// Our queue of requests that should be sent.  The first @c m_messagesInFlight of them have been sent.
     std::deque<std::shared_ptr<CertifiedMessageRequest>> m_messagesToSend;
 
+    /// The number of requests at the front of @c m_messagesToSend which have been sent and not yet erased.
+    size_t m_messagesInFlight;
+
+    /**
+     * Whether a request in flight failed, so no more requests are sent until all the requests in flight have been
+     * responded to and can be sent again.
+     */
+    bool m_isRetryPending;
+
+    /// Mutex to protect @c m_pendingMessages.
+    std::mutex m_pendingMessagesMutex;
+
+    /// The messages passed to @c sendJSONMessage which have not been persisted yet, in order.
+    std::vector<PendingMessage> m_pendingMessages;
+
     /// The entity which actually sends the messages to AVS.
     std::shared_ptr<avsCommon::sdkInterfaces::MessageSenderInterface> m_messageSender;
 
-    /// The message currently being sent.
-    std::shared_ptr<CertifiedMessageRequest> m_currentMessage;
-
     // The connection object we are observing.
     std::shared_ptr<avsCommon::sdkInterfaces::AVSConnectionManagerInterface> m_connection;
 
+    /**
+     * Mutex to serialize access to @c m_storage.  It is never held together with the @c WorkerSignal's mutex, so that
+     * completing a request never waits for storage.
+     */
+    std::mutex m_storageMutex;
+
     /// Where we will store the messages we wish to send.
     std::shared_ptr<MessageStorageInterface> m_storage;
 
@@ -19,6 +19,7 @@
 #include <memory>
 #include <string>
 #include <queue>
+#include <vector>
 
 namespace alexaClientSDK {
 namespace certifiedSender {
@@ -96,6 +97,17 @@ public:
      */
     virtual bool store(const std::string& message, int* id) = 0;
 
+    /**
+     * Stores several messages in the database, in order.  Either all of them are stored or none of them are, and an
+     * implementation should commit them together so that storing a batch costs about as much as storing one message.
+     * The default implementation stores them one at a time, and is not atomic.
+     *
+     * @param messages The messages to store.
+     * @param[out] ids The ids associated with the stored messages, in the same order, if successfully stored.
+     * @return Whether the messages were successfully stored.
+     */
+    virtual bool storeBatch(const std::vector<std::string>& messages, std::vector<int>* ids);
+
     /**
      * Loads all messages in the database.
      *
@@ -112,6 +124,15 @@ public:
      */
     virtual bool erase(int messageId) = 0;
 
+    /**
+     * Erases several messages from the database.  An implementation should commit the erasures together.  The default
+     * implementation erases them one at a time.
+     *
+     * @param messageIds The ids of the messages to be erased.
+     * @return Whether the messages were successfully erased.
+     */
+    virtual bool eraseBatch(const std::vector<int>& messageIds);
+
     /**
      * A utility function to clear the database of all records.  Note that the database will still exist, as will
      * the tables.  Only the rows will be erased.
@@ -121,6 +142,28 @@ public:
     virtual bool clearDatabase() = 0;
 };
 
+inline bool MessageStorageInterface::storeBatch(const std::vector<std::string>& messages, std::vector<int>* ids) {
+    if (!ids) {
+        return false;
+    }
+    for (auto& message : messages) {
+        int id = 0;
+        if (!store(message, &id)) {
+            return false;
+        }
+        ids->push_back(id);
+    }
+    return true;
+}
+
+inline bool MessageStorageInterface::eraseBatch(const std::vector<int>& messageIds) {
+    bool success = true;
+    for (auto id : messageIds) {
+        success = erase(id) && success;
+    }
+    return success;
+}
+
 }  // namespace certifiedSender
 }  // namespace alexaClientSDK
 
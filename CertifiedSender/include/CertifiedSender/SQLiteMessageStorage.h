@@ -25,14 +25,16 @@ namespace alexaClientSDK {
 namespace certifiedSender {
 
 /**
- * An implementation that allows us to store messages using SQLite.
+ * An implementation that allows us to store messages using SQLite.  Batches of messages are stored or erased in a
+ * single transaction, so that each batch is made durable with one sync rather than one per message.
  *
  * This class is not thread-safe.
  */
 class SQLiteMessageStorage : public MessageStorageInterface {
 public:
     /**
-     * Factory method for creating a storage object for Messages based on an SQLite database.
+     * Factory method for creating a storage object for Messages based on an SQLite database.  If the configuration
+     * has an @c SQLiteStorageEngine, the messages are stored by the engine instead of a file of their own.
      *
      * @param configurationRoot The global config object.
      * @return Pointer to the SQLiteMessagetStorge object, nullptr if there's an error creating it.
@@ -47,6 +49,13 @@ public:
      */
     SQLiteMessageStorage(const std::string& databaseFilePath);
 
+    /**
+     * Constructor for a storage object whose table is hosted by an @c SQLiteStorageEngine.
+     *
+     * @param engine The engine hosting the table.
+     */
+    SQLiteMessageStorage(std::shared_ptr<storage::sqliteStorage::SQLiteStorageEngine> engine);
+
     ~SQLiteMessageStorage();
 
     bool createDatabase() override;
@@ -61,9 +70,30 @@ public:
 
     bool erase(int messageId) override;
 
+    bool storeBatch(const std::vector<std::string>& messages, std::vector<int>* ids) override;
+
+    bool eraseBatch(const std::vector<int>& messageIds) override;
+
     bool clearDatabase() override;
 
 private:
+    /**
+     * Inserts a message, without starting a transaction.
+     *
+     * @param message The message to store.
+     * @param id The id to store the message with.
+     * @return Whether the message was inserted.
+     */
+    bool insertMessage(const std::string& message, int id);
+
+    /**
+     * Deletes a message, without starting a transaction.
+     *
+     * @param messageId The id of the message to delete.
+     * @return Whether the message was deleted.
+     */
+    bool deleteMessage(int messageId);
+
     /// The underlying database class.
     alexaClientSDK::storage::sqliteStorage::SQLiteDatabase m_database;
 };
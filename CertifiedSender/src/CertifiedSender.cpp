@@ -38,49 +38,58 @@ static const std::string TAG("CertifiedSender");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
-CertifiedSender::CertifiedMessageRequest::CertifiedMessageRequest(const std::string& jsonContent, int dbId) :
+/// The key in our config file to find the root of settings for this component.
+static const std::string CERTIFIED_SENDER_CONFIGURATION_ROOT_KEY = "certifiedSender";
+/// The key in our config file to find the queue size warn limit.
+static const std::string QUEUE_SIZE_WARN_LIMIT_KEY = "queueSizeWarnLimit";
+/// The key in our config file to find the queue size hard limit.
+static const std::string QUEUE_SIZE_HARD_LIMIT_KEY = "queueSizeHardLimit";
+/// The key in our config file to find the maximum number of messages in flight.
+static const std::string MAX_MESSAGES_IN_FLIGHT_KEY = "maxMessagesInFlight";
+
+CertifiedSender::CertifiedMessageRequest::CertifiedMessageRequest(
+    const std::string& jsonContent,
+    int dbId,
+    std::shared_ptr<WorkerSignal> workerSignal) :
         MessageRequest{jsonContent},
         m_responseReceived{false},
         m_dbId{dbId},
-        m_isShuttingDown{false} {
+        m_workerSignal{workerSignal} {
 }
 
 void CertifiedSender::CertifiedMessageRequest::exceptionReceived(const std::string& exceptionMessage) {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_sendMessageStatus = MessageRequestObserverInterface::Status::SERVER_INTERNAL_ERROR_V2;
-    m_responseReceived = true;
-    m_cv.notify_all();
+    complete(MessageRequestObserverInterface::Status::SERVER_INTERNAL_ERROR_V2);
 }
 
 void CertifiedSender::CertifiedMessageRequest::sendCompleted(
     MessageRequestObserverInterface::Status sendMessageStatus) {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    if (!m_responseReceived) {
-        m_sendMessageStatus = sendMessageStatus;
-        m_responseReceived = true;
-        m_cv.notify_all();
-    }
+    complete(sendMessageStatus);
 }
 
-MessageRequestObserverInterface::Status CertifiedSender::CertifiedMessageRequest::waitForCompletion() {
+void CertifiedSender::CertifiedMessageRequest::complete(MessageRequestObserverInterface::Status sendMessageStatus) {
     std::unique_lock<std::mutex> lock(m_mutex);
-    m_cv.wait(lock, [this]() { return m_isShuttingDown || m_responseReceived; });
-
-    if (m_isShuttingDown) {
-        return MessageRequestObserverInterface::Status::TIMEDOUT;
+    if (m_responseReceived) {
+        return;
     }
+    m_sendMessageStatus = sendMessageStatus;
+    m_responseReceived = true;
+    lock.unlock();
 
-    return m_sendMessageStatus;
+    // The worker thread checks this request while holding the signal's lock, so it is notified after releasing ours.
+    std::lock_guard<std::mutex> signalLock(m_workerSignal->mutex);
+    m_workerSignal->condition.notify_one();
 }
 
-int CertifiedSender::CertifiedMessageRequest::getDbId() {
-    return m_dbId;
+bool CertifiedSender::CertifiedMessageRequest::isCompleted(MessageRequestObserverInterface::Status* status) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_responseReceived) {
+        *status = m_sendMessageStatus;
+    }
+    return m_responseReceived;
 }
 
-void CertifiedSender::CertifiedMessageRequest::shutdown() {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_isShuttingDown = true;
-    m_cv.notify_all();
+int CertifiedSender::CertifiedMessageRequest::getDbId() {
+    return m_dbId;
 }
 
 std::shared_ptr<CertifiedSender> CertifiedSender::create(
@@ -88,8 +97,22 @@ std::shared_ptr<CertifiedSender> CertifiedSender::create(
     std::shared_ptr<AVSConnectionManagerInterface> connection,
     std::shared_ptr<MessageStorageInterface> storage,
     std::shared_ptr<registrationManager::CustomerDataManager> dataManager) {
-    auto certifiedSender =
-        std::shared_ptr<CertifiedSender>(new CertifiedSender(messageSender, connection, storage, dataManager));
+    auto configurationRoot = ConfigurationNode::getRoot()[CERTIFIED_SENDER_CONFIGURATION_ROOT_KEY];
+    int queueSizeWarnLimit = CERTIFIED_SENDER_QUEUE_SIZE_WARN_LIMIT;
+    int queueSizeHardLimit = CERTIFIED_SENDER_QUEUE_SIZE_HARD_LIMIT;
+    int maxMessagesInFlight = CERTIFIED_SENDER_MAX_MESSAGES_IN_FLIGHT;
+    configurationRoot.getInt(QUEUE_SIZE_WARN_LIMIT_KEY, &queueSizeWarnLimit, CERTIFIED_SENDER_QUEUE_SIZE_WARN_LIMIT);
+    configurationRoot.getInt(QUEUE_SIZE_HARD_LIMIT_KEY, &queueSizeHardLimit, CERTIFIED_SENDER_QUEUE_SIZE_HARD_LIMIT);
+    configurationRoot.getInt(MAX_MESSAGES_IN_FLIGHT_KEY, &maxMessagesInFlight, CERTIFIED_SENDER_MAX_MESSAGES_IN_FLIGHT);
+
+    auto certifiedSender = std::shared_ptr<CertifiedSender>(new CertifiedSender(
+        messageSender,
+        connection,
+        storage,
+        dataManager,
+        queueSizeWarnLimit,
+        queueSizeHardLimit,
+        maxMessagesInFlight));
 
     if (!certifiedSender->init()) {
         ACSDK_ERROR(LX("createFailed").m("Could not initialize certifiedSender."));
@@ -107,27 +130,29 @@ CertifiedSender::CertifiedSender(
     std::shared_ptr<MessageStorageInterface> storage,
     std::shared_ptr<registrationManager::CustomerDataManager> dataManager,
     int queueSizeWarnLimit,
-    int queueSizeHardLimit) :
+    int queueSizeHardLimit,
+    int maxMessagesInFlight) :
         RequiresShutdown("CertifiedSender"),
         CustomerDataHandler(dataManager),
         m_queueSizeWarnLimit{queueSizeWarnLimit},
         m_queueSizeHardLimit{queueSizeHardLimit},
+        m_maxMessagesInFlight{maxMessagesInFlight},
         m_isShuttingDown{false},
+        m_workerSignal{std::make_shared<WorkerSignal>()},
         m_isConnected{false},
+        m_messagesInFlight{0},
+        m_isRetryPending{false},
         m_messageSender{messageSender},
         m_connection{connection},
         m_storage{storage} {
 }
 
 CertifiedSender::~CertifiedSender() {
-    std::unique_lock<std::mutex> lock(m_mutex);
+    std::unique_lock<std::mutex> lock(m_workerSignal->mutex);
     m_isShuttingDown = true;
-    if (m_currentMessage) {
-        m_currentMessage->shutdown();
-    }
     lock.unlock();
 
-    m_workerThreadCV.notify_one();
+    m_workerSignal->condition.notify_one();
 
     if (m_workerThread.joinable()) {
         m_workerThread.join();
@@ -143,6 +168,11 @@ bool CertifiedSender::init() {
         return false;
     }
 
+    if (m_maxMessagesInFlight <= 0) {
+        ACSDK_ERROR(LX("initFailed").d("maxMessagesInFlight", m_maxMessagesInFlight).m("Limit value is invalid."));
+        return false;
+    }
+
     if (!m_storage->open()) {
         ACSDK_INFO(LX("init : Database file does not exist.  Creating."));
         if (!m_storage->createDatabase()) {
@@ -156,92 +186,162 @@ bool CertifiedSender::init() {
     return true;
 }
 
-void CertifiedSender::mainloop() {
-    while (true) {
-        std::unique_lock<std::mutex> lock(m_mutex);
+bool CertifiedSender::allMessagesInFlightCompletedLocked() {
+    MessageRequestObserverInterface::Status status;
+    for (size_t i = 0; i < m_messagesInFlight; ++i) {
+        if (!m_messagesToSend[i]->isCompleted(&status)) {
+            return false;
+        }
+    }
+    return true;
+}
 
-        m_currentMessage.reset();
+bool CertifiedSender::hasWorkLocked() {
+    MessageRequestObserverInterface::Status status;
+    if (m_isRetryPending) {
+        return allMessagesInFlightCompletedLocked();
+    }
+    if (m_messagesInFlight > 0 && m_messagesToSend.front()->isCompleted(&status)) {
+        return true;
+    }
+    return m_isConnected && m_messagesInFlight < m_messagesToSend.size() &&
+           m_messagesInFlight < static_cast<size_t>(m_maxMessagesInFlight);
+}
 
-        if ((!m_isConnected || m_messagesToSend.empty()) && !m_isShuttingDown) {
-            m_workerThreadCV.wait(
-                lock, [this]() { return ((m_isConnected && !m_messagesToSend.empty()) || m_isShuttingDown); });
-        }
+void CertifiedSender::mainloop() {
+    std::unique_lock<std::mutex> lock(m_workerSignal->mutex);
+    while (true) {
+        m_workerSignal->condition.wait(lock, [this]() { return m_isShuttingDown || hasWorkLocked(); });
 
         if (m_isShuttingDown) {
             ACSDK_DEBUG9(LX("CertifiedSender worker thread done.  exiting mainloop."));
             return;
         }
 
-        m_currentMessage = m_messagesToSend.front();
-
-        lock.unlock();
-
-        // We have a message to send - send it!
-        m_messageSender->sendMessage(m_currentMessage);
-
-        auto status = m_currentMessage->waitForCompletion();
-
-        if (MessageRequest::isServerStatus(status)) {
-            lock.lock();
-
-            if (!m_storage->erase(m_currentMessage->getDbId())) {
-                ACSDK_ERROR(LX("mainloop : could not erase message from storage."));
+        // Erase the messages at the front of the queue which have been sent ok, stopping at the first failure.
+        std::vector<int> sentMessageIds;
+        MessageRequestObserverInterface::Status status;
+        while (!m_isRetryPending && m_messagesInFlight > 0 && m_messagesToSend.front()->isCompleted(&status)) {
+            if (!MessageRequest::isServerStatus(status)) {
+                m_isRetryPending = true;
+                break;
             }
-
+            sentMessageIds.push_back(m_messagesToSend.front()->getDbId());
             m_messagesToSend.pop_front();
+            m_messagesInFlight--;
+        }
+        if (!sentMessageIds.empty()) {
+            // Requests are completed on the network thread, which should not wait for storage, so erase unlocked.
             lock.unlock();
-        } else {
-            // If we couldn't send the message ok, let's push a fresh instance to the front of the deque.  This allows
-            // ACL to continue interacting with the old instance (for example, if it is involved in a complex flow
-            // of exception / onCompleted handling), and allows us to safely try sending the new instance.
+            {
+                std::lock_guard<std::mutex> storageLock(m_storageMutex);
+                if (!m_storage->eraseBatch(sentMessageIds)) {
+                    ACSDK_ERROR(LX("mainloop : could not erase messages from storage."));
+                }
+            }
             lock.lock();
-            m_messagesToSend.pop_front();
-            m_messagesToSend.push_front(std::make_shared<CertifiedMessageRequest>(
-                m_currentMessage->getJsonContent(), m_currentMessage->getDbId()));
-            lock.unlock();
         }
+
+        if (m_isRetryPending && allMessagesInFlightCompletedLocked()) {
+            // If we couldn't send a message ok, let's replace it and every message sent after it with fresh instances
+            // to be sent again in order.  This allows ACL to continue interacting with the old instances (for example,
+            // if one is involved in a complex flow of exception / onCompleted handling), and allows us to safely try
+            // sending the new instances.
+            for (size_t i = 0; i < m_messagesInFlight; ++i) {
+                auto& message = m_messagesToSend[i];
+                message = std::make_shared<CertifiedMessageRequest>(
+                    message->getJsonContent(), message->getDbId(), m_workerSignal);
+            }
+            m_messagesInFlight = 0;
+            m_isRetryPending = false;
+        }
+
+        std::vector<std::shared_ptr<CertifiedMessageRequest>> messagesToSend;
+        while (m_isConnected && !m_isRetryPending && m_messagesInFlight < m_messagesToSend.size() &&
+               m_messagesInFlight < static_cast<size_t>(m_maxMessagesInFlight)) {
+            messagesToSend.push_back(m_messagesToSend[m_messagesInFlight++]);
+        }
+        if (messagesToSend.empty()) {
+            continue;
+        }
+
+        lock.unlock();
+        // We have messages to send - send them, in order!
+        for (auto& message : messagesToSend) {
+            m_messageSender->sendMessage(message);
+        }
+        lock.lock();
     }
 }
 
 void CertifiedSender::onConnectionStatusChanged(
     ConnectionStatusObserverInterface::Status status,
     ConnectionStatusObserverInterface::ChangedReason reason) {
-    std::lock_guard<std::mutex> lock(m_mutex);
+    std::lock_guard<std::mutex> lock(m_workerSignal->mutex);
     m_isConnected = (ConnectionStatusObserverInterface::Status::CONNECTED == status);
-    m_workerThreadCV.notify_one();
+    m_workerSignal->condition.notify_one();
 }
 
 std::future<bool> CertifiedSender::sendJSONMessage(const std::string& jsonMessage) {
-    return m_executor.submit([this, jsonMessage]() { return executeSendJSONMessage(jsonMessage); });
+    std::lock_guard<std::mutex> lock(m_pendingMessagesMutex);
+    m_pendingMessages.emplace_back();
+    auto& pendingMessage = m_pendingMessages.back();
+    pendingMessage.jsonMessage = jsonMessage;
+    auto future = pendingMessage.persisted.get_future();
+    // Messages passed to us while a batch is waiting to be persisted join that batch.
+    if (1 == m_pendingMessages.size()) {
+        m_executor.submitDetached([this]() { executeSendJSONMessages(); });
+    }
+    return future;
 }
 
-bool CertifiedSender::executeSendJSONMessage(std::string jsonMessage) {
-    std::unique_lock<std::mutex> lock(m_mutex);
+void CertifiedSender::executeSendJSONMessages() {
+    std::vector<PendingMessage> pendingMessages;
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMessagesMutex);
+        pendingMessages.swap(m_pendingMessages);
+    }
 
-    int queueSize = static_cast<int>(m_messagesToSend.size());
+    std::unique_lock<std::mutex> lock(m_workerSignal->mutex);
 
-    if (queueSize >= m_queueSizeHardLimit) {
-        ACSDK_ERROR(LX("executeSendJSONMessage").m("Queue size is at max limit.  Cannot add message to send."));
-        return false;
+    int queueSize = static_cast<int>(m_messagesToSend.size());
+    std::vector<std::string> messages;
+    for (auto& pendingMessage : pendingMessages) {
+        if (queueSize + static_cast<int>(messages.size()) >= m_queueSizeHardLimit) {
+            ACSDK_ERROR(LX("executeSendJSONMessages").m("Queue size is at max limit.  Cannot add message to send."));
+            break;
+        }
+        messages.push_back(pendingMessage.jsonMessage);
     }
 
-    if (queueSize >= m_queueSizeWarnLimit) {
-        ACSDK_WARN(LX("executeSendJSONMessage").m("Warning : queue size has exceeded the warn limit."));
+    if (queueSize + static_cast<int>(messages.size()) > m_queueSizeWarnLimit) {
+        ACSDK_WARN(LX("executeSendJSONMessages").m("Warning : queue size has exceeded the warn limit."));
     }
 
-    int messageId = 0;
-    if (!m_storage->store(jsonMessage, &messageId)) {
-        ACSDK_ERROR(LX("executeSendJSONMessage").m("Could not store message."));
-        return false;
+    lock.unlock();
+
+    std::vector<int> messageIds;
+    if (!messages.empty()) {
+        std::lock_guard<std::mutex> storageLock(m_storageMutex);
+        if (!m_storage->storeBatch(messages, &messageIds)) {
+            ACSDK_ERROR(LX("executeSendJSONMessages").m("Could not store messages."));
+            messages.clear();
+        }
     }
 
-    m_messagesToSend.push_back(std::make_shared<CertifiedMessageRequest>(jsonMessage, messageId));
+    lock.lock();
+    for (size_t i = 0; i < messages.size(); ++i) {
+        m_messagesToSend.push_back(
+            std::make_shared<CertifiedMessageRequest>(messages[i], messageIds[i], m_workerSignal));
+    }
 
     lock.unlock();
 
-    m_workerThreadCV.notify_one();
+    m_workerSignal->condition.notify_one();
 
-    return true;
+    for (size_t i = 0; i < pendingMessages.size(); ++i) {
+        pendingMessages[i].persisted.set_value(i < messages.size());
+    }
 }
 
 void CertifiedSender::doShutdown() {
@@ -250,8 +350,13 @@ void CertifiedSender::doShutdown() {
 
 void CertifiedSender::clearData() {
     auto result = m_executor.submit([this]() {
-        std::unique_lock<std::mutex> lock(m_mutex);
+        std::unique_lock<std::mutex> lock(m_workerSignal->mutex);
         m_messagesToSend.clear();
+        m_messagesInFlight = 0;
+        m_isRetryPending = false;
+        lock.unlock();
+
+        std::lock_guard<std::mutex> storageLock(m_storageMutex);
         m_storage->clearDatabase();
     });
     result.wait();
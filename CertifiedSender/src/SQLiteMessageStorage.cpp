@@ -17,11 +17,13 @@
 
 #include <SQLiteStorage/SQLiteUtils.h>
 #include <SQLiteStorage/SQLiteStatement.h>
+#include <SQLiteStorage/SQLiteStorageEngine.h>
 
 #include <AVSCommon/Utils/File/FileUtils.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 
 #include <fstream>
+#include <limits>
 
 namespace alexaClientSDK {
 namespace certifiedSender {
@@ -44,6 +46,10 @@ static const std::string TAG("SQLiteMessageStorage");
 static const std::string CERTIFIED_SENDER_CONFIGURATION_ROOT_KEY = "certifiedSender";
 /// The key in our config file to find the database file path.
 static const std::string CERTIFIED_SENDER_DB_FILE_PATH_KEY = "databaseFilePath";
+/// The name of this storage as a component of an @c SQLiteStorageEngine.
+static const std::string CERTIFIED_SENDER_COMPONENT_NAME = "certifiedSender";
+/// The schema version of this storage as a component of an @c SQLiteStorageEngine.
+static const int CERTIFIED_SENDER_SCHEMA_VERSION = 1;
 
 /// The name of the alerts table.
 static const std::string MESSAGES_TABLE_NAME = "messages";
@@ -55,9 +61,24 @@ static const std::string DATABASE_COLUMN_MESSAGE_TEXT_NAME = "message_text";
 static const std::string CREATE_MESSAGES_TABLE_SQL_STRING = std::string("CREATE TABLE ") + MESSAGES_TABLE_NAME + " (" +
                                                             DATABASE_COLUMN_ID_NAME + " INT PRIMARY KEY NOT NULL," +
                                                             DATABASE_COLUMN_MESSAGE_TEXT_NAME + " TEXT NOT NULL);";
+/// The SQL string to insert a message.
+static const std::string INSERT_MESSAGE_SQL_STRING = "INSERT INTO " + MESSAGES_TABLE_NAME + " (" +
+                                                     DATABASE_COLUMN_ID_NAME + ", " +
+                                                     DATABASE_COLUMN_MESSAGE_TEXT_NAME + ") VALUES (?, ?);";
+/// The SQL string to delete a message.
+static const std::string DELETE_MESSAGE_SQL_STRING = "DELETE FROM " + MESSAGES_TABLE_NAME + " WHERE id=?;";
 
 std::unique_ptr<SQLiteMessageStorage> SQLiteMessageStorage::create(
     const avsCommon::utils::configuration::ConfigurationNode& configurationRoot) {
+    std::shared_ptr<SQLiteStorageEngine> engine;
+    if (!SQLiteStorageEngine::getInstance(configurationRoot, &engine)) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "Could not get storage engine"));
+        return nullptr;
+    }
+    if (engine) {
+        return std::unique_ptr<SQLiteMessageStorage>(new SQLiteMessageStorage(engine));
+    }
+
     auto certifiedSenderConfigurationRoot = configurationRoot[CERTIFIED_SENDER_CONFIGURATION_ROOT_KEY];
     if (!certifiedSenderConfigurationRoot) {
         ACSDK_ERROR(LX("createFailed")
@@ -82,6 +103,10 @@ SQLiteMessageStorage::SQLiteMessageStorage(const std::string& certifiedSenderDat
         m_database{certifiedSenderDatabaseFilePath} {
 }
 
+SQLiteMessageStorage::SQLiteMessageStorage(std::shared_ptr<SQLiteStorageEngine> engine) :
+        m_database{std::move(engine), CERTIFIED_SENDER_COMPONENT_NAME, CERTIFIED_SENDER_SCHEMA_VERSION} {
+}
+
 SQLiteMessageStorage::~SQLiteMessageStorage() {
     close();
 }
@@ -115,22 +140,62 @@ bool SQLiteMessageStorage::store(const std::string& message, int* id) {
         return false;
     }
 
-    std::string sqlString = std::string("INSERT INTO " + MESSAGES_TABLE_NAME + " (") + DATABASE_COLUMN_ID_NAME + ", " +
-                            DATABASE_COLUMN_MESSAGE_TEXT_NAME + ") VALUES (" + "?, ?" + ");";
+    std::vector<int> ids;
+    if (!storeBatch({message}, &ids)) {
+        return false;
+    }
+
+    *id = ids.front();
+
+    return true;
+}
+
+bool SQLiteMessageStorage::storeBatch(const std::vector<std::string>& messages, std::vector<int>* ids) {
+    if (!ids) {
+        ACSDK_ERROR(LX("storeBatchFailed").m("ids parameter was nullptr."));
+        return false;
+    }
+
+    int maxId = 0;
+    if (!getTableMaxIntValue(&m_database, MESSAGES_TABLE_NAME, DATABASE_COLUMN_ID_NAME, &maxId)) {
+        ACSDK_ERROR(LX("storeBatchFailed").m("Cannot generate message id."));
+        return false;
+    }
 
-    int nextId = 0;
-    if (!getTableMaxIntValue(&m_database, MESSAGES_TABLE_NAME, DATABASE_COLUMN_ID_NAME, &nextId)) {
-        ACSDK_ERROR(LX("storeFailed").m("Cannot generate message id."));
+    if (maxId < 0 || static_cast<size_t>(std::numeric_limits<int>::max() - maxId) < messages.size()) {
+        ACSDK_ERROR(LX("storeBatchFailed").m("Invalid computed row id.  Possible numerical overflow.").d("id", maxId));
         return false;
     }
-    nextId++;
 
-    if (nextId <= 0) {
-        ACSDK_ERROR(LX("storeFailed").m("Invalid computed row id.  Possible numerical overflow.").d("id", nextId));
+    auto transaction = m_database.beginTransaction();
+    if (!transaction) {
+        ACSDK_ERROR(LX("storeBatchFailed").m("Could not begin transaction."));
         return false;
     }
 
-    auto statement = m_database.createStatement(sqlString);
+    std::vector<int> storedIds;
+    storedIds.reserve(messages.size());
+    for (auto& message : messages) {
+        int nextId = maxId + static_cast<int>(storedIds.size()) + 1;
+        if (!insertMessage(message, nextId)) {
+            transaction->rollback();
+            return false;
+        }
+        storedIds.push_back(nextId);
+    }
+
+    if (!transaction->commit()) {
+        ACSDK_ERROR(LX("storeBatchFailed").m("Could not commit transaction."));
+        return false;
+    }
+
+    ids->insert(ids->end(), storedIds.begin(), storedIds.end());
+
+    return true;
+}
+
+bool SQLiteMessageStorage::insertMessage(const std::string& message, int id) {
+    auto statement = m_database.createStatement(INSERT_MESSAGE_SQL_STRING);
 
     if (!statement) {
         ACSDK_ERROR(LX("storeFailed").m("Could not create statement."));
@@ -138,7 +203,7 @@ bool SQLiteMessageStorage::store(const std::string& message, int* id) {
     }
 
     int boundParam = 1;
-    if (!statement->bindIntParameter(boundParam++, nextId) || !statement->bindStringParameter(boundParam, message)) {
+    if (!statement->bindIntParameter(boundParam++, id) || !statement->bindStringParameter(boundParam, message)) {
         ACSDK_ERROR(LX("storeFailed").m("Could not bind parameter."));
         return false;
     }
@@ -148,8 +213,6 @@ bool SQLiteMessageStorage::store(const std::string& message, int* id) {
         return false;
     }
 
-    *id = nextId;
-
     return true;
 }
 
@@ -202,9 +265,33 @@ bool SQLiteMessageStorage::load(std::queue<StoredMessage>* messageContainer) {
 }
 
 bool SQLiteMessageStorage::erase(int messageId) {
-    std::string sqlString = "DELETE FROM " + MESSAGES_TABLE_NAME + " WHERE id=?;";
+    return deleteMessage(messageId);
+}
 
-    auto statement = m_database.createStatement(sqlString);
+bool SQLiteMessageStorage::eraseBatch(const std::vector<int>& messageIds) {
+    auto transaction = m_database.beginTransaction();
+    if (!transaction) {
+        ACSDK_ERROR(LX("eraseBatchFailed").m("Could not begin transaction."));
+        return false;
+    }
+
+    for (auto messageId : messageIds) {
+        if (!deleteMessage(messageId)) {
+            transaction->rollback();
+            return false;
+        }
+    }
+
+    if (!transaction->commit()) {
+        ACSDK_ERROR(LX("eraseBatchFailed").m("Could not commit transaction."));
+        return false;
+    }
+
+    return true;
+}
+
+bool SQLiteMessageStorage::deleteMessage(int messageId) {
+    auto statement = m_database.createStatement(DELETE_MESSAGE_SQL_STRING);
 
     if (!statement) {
         ACSDK_ERROR(LX("eraseFailed").m("Could not create statement."));
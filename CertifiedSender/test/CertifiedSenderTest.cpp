@@ -13,7 +13,16 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -23,6 +32,7 @@
 #include <AVSCommon/SDKInterfaces/MockMessageSender.h>
 
 #include "CertifiedSender/CertifiedSender.h"
+#include "CertifiedSender/SQLiteMessageStorage.h"
 
 using namespace ::testing;
 
@@ -30,7 +40,42 @@ namespace alexaClientSDK {
 namespace certifiedSender {
 namespace test {
 
+using namespace avsCommon::avs;
+using namespace avsCommon::sdkInterfaces;
+
+/// The number of messages sent in the ordering tests.
+static const int NUM_MESSAGES = 20;
+
+/// The maximum number of messages in flight in the windowed tests.
+static const int MAX_MESSAGES_IN_FLIGHT = 8;
+
+/// How long to wait for all the messages to be sent.
+static const std::chrono::seconds SEND_TIMEOUT(10);
+
+/// How long @c InMemoryMessageStorage takes to store a batch of messages.
+static const std::chrono::milliseconds STORE_TIME(1);
+
+/// The number of queued messages the benchmark drains.
+static const int BENCHMARK_MESSAGES = 1000;
+
+/// The simulated round-trip time of each message sent by the benchmark.
+static const std::chrono::microseconds BENCHMARK_ROUND_TRIP_TIME(500);
+
+/// The database file used by the benchmark, relative to the working directory.
+static const std::string BENCHMARK_DATABASE_FILE_PATH = "certifiedSenderBenchmark.db";
+
 class MockConnection : public avsCommon::avs::AbstractAVSConnectionManager {
+public:
+    /**
+     * Notify the observers that the connection is now connected.
+     */
+    void connect() {
+        updateConnectionStatus(
+            ConnectionStatusObserverInterface::Status::CONNECTED,
+            ConnectionStatusObserverInterface::ChangedReason::ACL_CLIENT_REQUEST);
+        notifyObservers();
+    }
+
     MOCK_METHOD0(enable, void());
     MOCK_METHOD0(disable, void());
     MOCK_METHOD0(isEnabled, bool());
@@ -96,6 +141,328 @@ protected:
     std::shared_ptr<MockConnection> m_connection;
 };
 
+/**
+ * A @c MessageSenderInterface which responds to each message in the order it was sent, after a round-trip time, and
+ * records the messages it was sent.
+ */
+class TestTransport : public MessageSenderInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param roundTripTime How long after being sent each message is responded to.
+     */
+    TestTransport(std::chrono::steady_clock::duration roundTripTime) :
+            m_roundTripTime{roundTripTime},
+            m_maxInFlight{0},
+            m_isShuttingDown{false} {
+        m_thread = std::thread(&TestTransport::respond, this);
+    }
+
+    ~TestTransport() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_isShuttingDown = true;
+        m_wakeTrigger.notify_all();
+        lock.unlock();
+        m_thread.join();
+    }
+
+    void sendMessage(std::shared_ptr<MessageRequest> request) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_inFlight.push_back({request, std::chrono::steady_clock::now() + m_roundTripTime});
+        m_sent.push_back(request->getJsonContent());
+        m_maxInFlight = std::max(m_maxInFlight, m_inFlight.size());
+        m_wakeTrigger.notify_all();
+    }
+
+    /**
+     * Fail the next time a message is sent.
+     *
+     * @param message The message to fail.
+     */
+    void failOnce(const std::string& message) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_messagesToFail.push_back(message);
+    }
+
+    /**
+     * Wait until a number of messages have been responded to successfully, and their @c sendCompleted() calls have
+     * returned.
+     *
+     * @param count The number of messages.
+     * @return Whether they were responded to before @c SEND_TIMEOUT.
+     */
+    bool waitForSuccesses(size_t count) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_wakeTrigger.wait_for(lock, SEND_TIMEOUT, [this, count]() { return m_successCount >= count; });
+    }
+
+    /**
+     * Get the messages sent, in the order they were sent.
+     *
+     * @return The messages sent.
+     */
+    std::vector<std::string> getSent() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_sent;
+    }
+
+    /**
+     * Get the largest number of messages which were in flight together.
+     *
+     * @return The largest number of messages in flight.
+     */
+    size_t getMaxInFlight() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_maxInFlight;
+    }
+
+private:
+    /// A message which has been sent and not yet responded to.
+    struct InFlightMessage {
+        /// The message.
+        std::shared_ptr<MessageRequest> request;
+        /// When to respond to the message.
+        std::chrono::steady_clock::time_point responseTime;
+    };
+
+    /// Respond to messages in the order they were sent.
+    void respond() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true) {
+            m_wakeTrigger.wait(lock, [this]() { return m_isShuttingDown || !m_inFlight.empty(); });
+            if (m_isShuttingDown) {
+                return;
+            }
+            auto message = m_inFlight.front();
+            m_wakeTrigger.wait_until(lock, message.responseTime, [this]() { return m_isShuttingDown; });
+            if (m_isShuttingDown) {
+                return;
+            }
+            m_inFlight.pop_front();
+            auto status = MessageRequestObserverInterface::Status::SUCCESS;
+            auto it = std::find(m_messagesToFail.begin(), m_messagesToFail.end(), message.request->getJsonContent());
+            if (it != m_messagesToFail.end()) {
+                m_messagesToFail.erase(it);
+                status = MessageRequestObserverInterface::Status::TIMEDOUT;
+            }
+            lock.unlock();
+            message.request->sendCompleted(status);
+            lock.lock();
+            if (MessageRequestObserverInterface::Status::SUCCESS == status) {
+                m_successCount++;
+            }
+            m_wakeTrigger.notify_all();
+        }
+    }
+
+    /// How long after being sent each message is responded to.
+    const std::chrono::steady_clock::duration m_roundTripTime;
+
+    /// Mutex to protect the members below.
+    std::mutex m_mutex;
+
+    /// Condition variable to wake the responding thread and @c waitForSuccesses.
+    std::condition_variable m_wakeTrigger;
+
+    /// The messages sent and not yet responded to, in order.
+    std::deque<InFlightMessage> m_inFlight;
+
+    /// The messages sent, in order.
+    std::vector<std::string> m_sent;
+
+    /// The messages to fail the next time they are sent.
+    std::vector<std::string> m_messagesToFail;
+
+    /// The number of messages responded to successfully.
+    size_t m_successCount = 0;
+
+    /// The largest number of messages in flight together.
+    size_t m_maxInFlight;
+
+    /// Whether the responding thread should exit.
+    bool m_isShuttingDown;
+
+    /// The thread which responds to messages.
+    std::thread m_thread;
+};
+
+/**
+ * A @c MessageStorageInterface which keeps messages in memory and counts the batches stored in it.  Storing a batch
+ * takes @c STORE_TIME, standing in for a sync to disk.
+ */
+class InMemoryMessageStorage : public MessageStorageInterface {
+public:
+    InMemoryMessageStorage() : m_nextId{1}, m_storeCount{0}, m_isEraseBlocked{false} {
+    }
+
+    bool createDatabase() override {
+        return true;
+    }
+
+    bool open() override {
+        return true;
+    }
+
+    void close() override {
+    }
+
+    bool store(const std::string& message, int* id) override {
+        std::vector<int> ids;
+        if (!storeBatch({message}, &ids)) {
+            return false;
+        }
+        *id = ids.front();
+        return true;
+    }
+
+    bool storeBatch(const std::vector<std::string>& messages, std::vector<int>* ids) override {
+        std::this_thread::sleep_for(STORE_TIME);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& message : messages) {
+            m_messages.push_back({m_nextId, message});
+            ids->push_back(m_nextId++);
+        }
+        m_storeCount++;
+        return true;
+    }
+
+    bool load(std::queue<StoredMessage>* messageContainer) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& message : m_messages) {
+            messageContainer->push(message);
+        }
+        return true;
+    }
+
+    bool erase(int messageId) override {
+        return eraseBatch({messageId});
+    }
+
+    bool eraseBatch(const std::vector<int>& messageIds) override {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_wakeTrigger.wait(lock, [this]() { return !m_isEraseBlocked; });
+        for (auto id : messageIds) {
+            m_messages.erase(
+                std::remove_if(
+                    m_messages.begin(),
+                    m_messages.end(),
+                    [id](const StoredMessage& message) { return message.id == id; }),
+                m_messages.end());
+        }
+        m_wakeTrigger.notify_all();
+        return true;
+    }
+
+    bool clearDatabase() override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_messages.clear();
+        return true;
+    }
+
+    /**
+     * Wait until all the messages stored have been erased.
+     *
+     * @return Whether they were erased before @c SEND_TIMEOUT.
+     */
+    bool waitUntilEmpty() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_wakeTrigger.wait_for(lock, SEND_TIMEOUT, [this]() { return m_messages.empty(); });
+    }
+
+    /**
+     * Make @c eraseBatch() wait until it is unblocked, standing in for a slow sync to disk.
+     *
+     * @param isBlocked Whether @c eraseBatch() waits.
+     */
+    void setEraseBlocked(bool isBlocked) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isEraseBlocked = isBlocked;
+        m_wakeTrigger.notify_all();
+    }
+
+    /**
+     * Get the number of batches stored.
+     *
+     * @return The number of batches stored.
+     */
+    int getStoreCount() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_storeCount;
+    }
+
+private:
+    /// Mutex to protect the members below.
+    std::mutex m_mutex;
+
+    /// Condition variable to wake @c waitUntilEmpty.
+    std::condition_variable m_wakeTrigger;
+
+    /// The messages stored, in order.
+    std::vector<StoredMessage> m_messages;
+
+    /// The id of the next message stored.
+    int m_nextId;
+
+    /// The number of batches stored.
+    int m_storeCount;
+
+    /// Whether @c eraseBatch() waits until it is unblocked.
+    bool m_isEraseBlocked;
+};
+
+/**
+ * Initialize the configuration of the @c CertifiedSender.
+ *
+ * @param maxMessagesInFlight The maximum number of messages in flight.
+ * @param queueSizeHardLimit The maximum number of messages queued.
+ * @return Whether the configuration was initialized.
+ */
+static bool initializeConfiguration(int maxMessagesInFlight, int queueSizeHardLimit) {
+    if (avsCommon::avs::initialization::AlexaClientSDKInit::isInitialized()) {
+        avsCommon::avs::initialization::AlexaClientSDKInit::uninitialize();
+    }
+    auto configuration = std::shared_ptr<std::stringstream>(new std::stringstream());
+    (*configuration) << "{\"certifiedSender\":{\"databaseFilePath\":\"database.db\",\"maxMessagesInFlight\":"
+                     << maxMessagesInFlight << ",\"queueSizeWarnLimit\":" << queueSizeHardLimit
+                     << ",\"queueSizeHardLimit\":" << queueSizeHardLimit << "}}";
+    return avsCommon::avs::initialization::AlexaClientSDKInit::initialize({configuration});
+}
+
+/**
+ * Queue messages on a disconnected @c CertifiedSender, then connect it and wait for them to be sent.
+ *
+ * @param certifiedSender The @c CertifiedSender.
+ * @param connection The connection of the @c CertifiedSender.
+ * @param transport The transport of the @c CertifiedSender.
+ * @param count The number of messages.
+ * @param[out] drainTime How long the messages took to be sent after connecting.
+ * @return Whether the messages were persisted and sent.
+ */
+static bool queueAndDrain(
+    std::shared_ptr<CertifiedSender> certifiedSender,
+    std::shared_ptr<MockConnection> connection,
+    std::shared_ptr<TestTransport> transport,
+    int count,
+    std::chrono::steady_clock::duration* drainTime) {
+    std::vector<std::future<bool>> persisted;
+    for (int i = 0; i < count; ++i) {
+        persisted.push_back(certifiedSender->sendJSONMessage(std::to_string(i)));
+    }
+    for (auto& future : persisted) {
+        if (!future.get()) {
+            return false;
+        }
+    }
+    auto start = std::chrono::steady_clock::now();
+    connection->connect();
+    if (!transport->waitForSuccesses(count)) {
+        return false;
+    }
+    *drainTime = std::chrono::steady_clock::now() - start;
+    return true;
+}
+
 /**
  * Check that @c clearData() method clears the persistent message storage and the current msg queue
  */
@@ -104,6 +471,131 @@ TEST_F(CertifiedSenderTest, clearDataTest) {
     m_certifiedSender->clearData();
 }
 
+/**
+ * Check that queued messages are persisted in a few batches, sent in order with several of them in flight, and erased
+ * once sent.
+ */
+TEST(CertifiedSenderWindowTest, sendsQueuedMessagesInOrder) {
+    ASSERT_TRUE(initializeConfiguration(MAX_MESSAGES_IN_FLIGHT, NUM_MESSAGES));
+    auto connection = std::make_shared<MockConnection>();
+    auto transport = std::make_shared<TestTransport>(std::chrono::milliseconds(1));
+    auto storage = std::make_shared<InMemoryMessageStorage>();
+    auto certifiedSender = CertifiedSender::create(
+        transport, connection, storage, std::make_shared<registrationManager::CustomerDataManager>());
+    ASSERT_TRUE(certifiedSender);
+
+    std::chrono::steady_clock::duration drainTime;
+    ASSERT_TRUE(queueAndDrain(certifiedSender, connection, transport, NUM_MESSAGES, &drainTime));
+
+    auto sent = transport->getSent();
+    ASSERT_EQ(static_cast<size_t>(NUM_MESSAGES), sent.size());
+    for (int i = 0; i < NUM_MESSAGES; ++i) {
+        EXPECT_EQ(std::to_string(i), sent[i]);
+    }
+    EXPECT_GT(transport->getMaxInFlight(), 1u);
+    EXPECT_LE(transport->getMaxInFlight(), static_cast<size_t>(MAX_MESSAGES_IN_FLIGHT));
+
+    EXPECT_TRUE(storage->waitUntilEmpty());
+    EXPECT_LT(storage->getStoreCount(), NUM_MESSAGES);
+    certifiedSender->shutdown();
+    connection->removeConnectionStatusObserver(certifiedSender);
+    avsCommon::avs::initialization::AlexaClientSDKInit::uninitialize();
+}
+
+/**
+ * Check that when a message in flight fails, it and the messages sent after it are sent again in order, so that the
+ * last time each message is sent is in the order the messages were queued.
+ */
+TEST(CertifiedSenderWindowTest, resendsInOrderAfterFailure) {
+    ASSERT_TRUE(initializeConfiguration(MAX_MESSAGES_IN_FLIGHT, NUM_MESSAGES));
+    auto connection = std::make_shared<MockConnection>();
+    auto transport = std::make_shared<TestTransport>(std::chrono::milliseconds(1));
+    auto storage = std::make_shared<InMemoryMessageStorage>();
+    auto certifiedSender = CertifiedSender::create(
+        transport, connection, storage, std::make_shared<registrationManager::CustomerDataManager>());
+    ASSERT_TRUE(certifiedSender);
+    auto failedMessage = std::to_string(MAX_MESSAGES_IN_FLIGHT / 2);
+    transport->failOnce(failedMessage);
+
+    std::chrono::steady_clock::duration drainTime;
+    ASSERT_TRUE(queueAndDrain(certifiedSender, connection, transport, NUM_MESSAGES, &drainTime));
+    EXPECT_TRUE(storage->waitUntilEmpty());
+    certifiedSender->shutdown();
+
+    auto sent = transport->getSent();
+    EXPECT_GT(sent.size(), static_cast<size_t>(NUM_MESSAGES));
+    EXPECT_EQ(2, std::count(sent.begin(), sent.end(), failedMessage));
+    std::vector<size_t> lastSent(NUM_MESSAGES);
+    for (size_t i = 0; i < sent.size(); ++i) {
+        lastSent[std::stoi(sent[i])] = i;
+    }
+    EXPECT_TRUE(std::is_sorted(lastSent.begin(), lastSent.end()));
+    connection->removeConnectionStatusObserver(certifiedSender);
+    avsCommon::avs::initialization::AlexaClientSDKInit::uninitialize();
+}
+
+/**
+ * Check that responses to messages in flight are not held up while sent messages are being erased from storage, since
+ * they are delivered on the network thread.
+ */
+TEST(CertifiedSenderWindowTest, completesWhileErasing) {
+    ASSERT_TRUE(initializeConfiguration(MAX_MESSAGES_IN_FLIGHT, NUM_MESSAGES));
+    auto connection = std::make_shared<MockConnection>();
+    auto transport = std::make_shared<TestTransport>(std::chrono::milliseconds(1));
+    auto storage = std::make_shared<InMemoryMessageStorage>();
+    auto certifiedSender = CertifiedSender::create(
+        transport, connection, storage, std::make_shared<registrationManager::CustomerDataManager>());
+    ASSERT_TRUE(certifiedSender);
+    storage->setEraseBlocked(true);
+
+    std::chrono::steady_clock::duration drainTime;
+    EXPECT_TRUE(queueAndDrain(certifiedSender, connection, transport, MAX_MESSAGES_IN_FLIGHT, &drainTime));
+
+    storage->setEraseBlocked(false);
+    EXPECT_TRUE(storage->waitUntilEmpty());
+    certifiedSender->shutdown();
+    connection->removeConnectionStatusObserver(certifiedSender);
+    avsCommon::avs::initialization::AlexaClientSDKInit::uninitialize();
+}
+
+/**
+ * Report how long 1,000 queued messages take to be drained into a local transport from an SQLite database, with one
+ * message in flight at a time and with several.  The persist and drain times are recorded as test properties for each
+ * window size.  Disabled by default.
+ */
+TEST(CertifiedSenderWindowTest, DISABLED_benchmarkDrainQueuedMessages) {
+    for (auto maxMessagesInFlight : {1, MAX_MESSAGES_IN_FLIGHT}) {
+        std::remove(BENCHMARK_DATABASE_FILE_PATH.c_str());
+        ASSERT_TRUE(initializeConfiguration(maxMessagesInFlight, BENCHMARK_MESSAGES));
+        auto connection = std::make_shared<MockConnection>();
+        auto transport = std::make_shared<TestTransport>(BENCHMARK_ROUND_TRIP_TIME);
+        std::shared_ptr<MessageStorageInterface> storage =
+            std::make_shared<SQLiteMessageStorage>(BENCHMARK_DATABASE_FILE_PATH);
+        auto certifiedSender = CertifiedSender::create(
+            transport, connection, storage, std::make_shared<registrationManager::CustomerDataManager>());
+        ASSERT_TRUE(certifiedSender);
+
+        auto start = std::chrono::steady_clock::now();
+        std::chrono::steady_clock::duration drainTime;
+        ASSERT_TRUE(queueAndDrain(certifiedSender, connection, transport, BENCHMARK_MESSAGES, &drainTime));
+        auto queueTime = std::chrono::steady_clock::now() - start - drainTime;
+        certifiedSender->shutdown();
+        connection->removeConnectionStatusObserver(certifiedSender);
+        certifiedSender.reset();
+        storage->close();
+        std::remove(BENCHMARK_DATABASE_FILE_PATH.c_str());
+
+        auto label = "inFlight" + std::to_string(maxMessagesInFlight);
+        RecordProperty(
+            label + "PersistMs",
+            std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(queueTime).count()));
+        RecordProperty(
+            label + "DrainMs",
+            std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(drainTime).count()));
+    }
+    avsCommon::avs::initialization::AlexaClientSDKInit::uninitialize();
+}
+
 }  // namespace test
 }  // namespace certifiedSender
 }  // namespace alexaClientSDK
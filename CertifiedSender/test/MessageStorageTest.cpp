@@ -18,11 +18,16 @@
 
 #include <CertifiedSender/SQLiteMessageStorage.h>
 
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <AVSCommon/Utils/File/FileUtils.h>
 
+#include <chrono>
 #include <fstream>
+#include <iostream>
 #include <queue>
 #include <memory>
+#include <sstream>
+#include <vector>
 
 using namespace ::testing;
 
@@ -30,6 +35,7 @@ namespace alexaClientSDK {
 namespace certifiedSender {
 namespace test {
 
+using namespace avsCommon::utils::configuration;
 using namespace avsCommon::utils::file;
 
 /// The filename we will use for the test database file.
@@ -46,6 +52,17 @@ static const std::string TEST_MESSAGE_ONE = "test_message_one";
 static const std::string TEST_MESSAGE_TWO = "test_message_two";
 /// A test message text.
 static const std::string TEST_MESSAGE_THREE = "test_message_three";
+/// The number of messages stored by the benchmark.
+static const int BENCHMARK_MESSAGES = 1000;
+/// The number of messages stored one at a time by the connection profile benchmark.
+static const int PROFILE_BENCHMARK_MESSAGES = 200;
+/// A connection profile like the one the database was opened with before connection profiles.
+static const std::string ROLLBACK_JOURNAL_PROFILE_JSON =
+    R"({"sqliteStorage":{"journalMode":"DELETE","synchronous":"FULL","statementCacheSize":0}})";
+/// The default connection profile.
+static const std::string DEFAULT_PROFILE_JSON = R"({})";
+/// The default connection profile, with fewer syncs.
+static const std::string NORMAL_SYNCHRONOUS_PROFILE_JSON = R"({"sqliteStorage":{"synchronous":"NORMAL"}})";
 
 /**
  * A class which helps drive this unit test suite.
@@ -87,6 +104,35 @@ public:
         }
     }
 
+    /**
+     * Utility function to store, load and erase messages one at a time in a database opened with a connection
+     * profile.
+     *
+     * @param profileJson The configuration of the connection profile.
+     * @return How long it took.
+     */
+    std::chrono::steady_clock::duration storeLoadAndEraseWithProfile(const std::string& profileJson) {
+        cleanupLocalDbFile();
+        EXPECT_TRUE(ConfigurationNode::initialize({std::make_shared<std::stringstream>(profileJson)}));
+        SQLiteMessageStorage storage(g_dbTestFilePath);
+        ConfigurationNode::uninitialize();
+        EXPECT_TRUE(storage.createDatabase());
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < PROFILE_BENCHMARK_MESSAGES; ++i) {
+            int dbId = 0;
+            EXPECT_TRUE(storage.store(TEST_MESSAGE_ONE, &dbId));
+            std::queue<MessageStorageInterface::StoredMessage> dbMessages;
+            EXPECT_TRUE(storage.load(&dbMessages));
+            EXPECT_TRUE(storage.erase(dbId));
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+
+        storage.close();
+        cleanupLocalDbFile();
+        return elapsed;
+    }
+
 protected:
     /// The message database object we will test.
     std::shared_ptr<MessageStorageInterface> m_storage;
@@ -226,6 +272,89 @@ TEST_F(MessageStorageTest, testDatabaseClear) {
     ASSERT_EQ(static_cast<int>(dbMessages.size()), 0);
 }
 
+/**
+ * Test storing and erasing messages in batches.
+ */
+TEST_F(MessageStorageTest, testDatabaseStoreAndEraseBatch) {
+    createDatabase();
+    ASSERT_TRUE(isOpen(m_storage));
+
+    int dbId = 0;
+    ASSERT_TRUE(m_storage->store(TEST_MESSAGE_ONE, &dbId));
+    std::vector<int> dbIds;
+    ASSERT_TRUE(m_storage->storeBatch({TEST_MESSAGE_TWO, TEST_MESSAGE_THREE}, &dbIds));
+    ASSERT_EQ(dbIds, std::vector<int>({2, 3}));
+
+    std::queue<MessageStorageInterface::StoredMessage> dbMessages;
+    ASSERT_TRUE(m_storage->load(&dbMessages));
+    ASSERT_EQ(static_cast<int>(dbMessages.size()), 3);
+    ASSERT_EQ(dbMessages.front().message, TEST_MESSAGE_ONE);
+    dbMessages.pop();
+    ASSERT_EQ(dbMessages.front().message, TEST_MESSAGE_TWO);
+    dbMessages.pop();
+    ASSERT_EQ(dbMessages.front().message, TEST_MESSAGE_THREE);
+    dbMessages.pop();
+
+    ASSERT_TRUE(m_storage->eraseBatch({dbId, dbIds.front()}));
+    ASSERT_TRUE(m_storage->load(&dbMessages));
+    ASSERT_EQ(static_cast<int>(dbMessages.size()), 1);
+    ASSERT_EQ(dbMessages.front().message, TEST_MESSAGE_THREE);
+}
+
+/**
+ * Report how long it takes to store and erase messages one at a time, and in a batch, as test properties.  Disabled by
+ * default.
+ */
+TEST_F(MessageStorageTest, DISABLED_benchmarkStoreAndEraseBatch) {
+    createDatabase();
+    ASSERT_TRUE(isOpen(m_storage));
+    std::vector<std::string> messages(BENCHMARK_MESSAGES, TEST_MESSAGE_ONE);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<int> dbIds;
+    for (auto& message : messages) {
+        int dbId = 0;
+        ASSERT_TRUE(m_storage->store(message, &dbId));
+        dbIds.push_back(dbId);
+    }
+    for (auto dbId : dbIds) {
+        ASSERT_TRUE(m_storage->erase(dbId));
+    }
+    auto singleElapsed = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    dbIds.clear();
+    ASSERT_TRUE(m_storage->storeBatch(messages, &dbIds));
+    ASSERT_TRUE(m_storage->eraseBatch(dbIds));
+    auto batchElapsed = std::chrono::steady_clock::now() - start;
+
+    RecordProperty(
+        "oneAtATimeMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(singleElapsed).count()));
+    RecordProperty(
+        "batchedMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(batchElapsed).count()));
+}
+
+/**
+ * Report how long it takes to store, load and erase messages one at a time with the connection profile the database
+ * was opened with before against the default connection profile.  Disabled by default; the times are recorded as
+ * test properties.
+ */
+TEST_F(MessageStorageTest, DISABLED_benchmarkConnectionProfiles) {
+    auto rollbackJournalElapsed = storeLoadAndEraseWithProfile(ROLLBACK_JOURNAL_PROFILE_JSON);
+    auto defaultElapsed = storeLoadAndEraseWithProfile(DEFAULT_PROFILE_JSON);
+    auto normalElapsed = storeLoadAndEraseWithProfile(NORMAL_SYNCHRONOUS_PROFILE_JSON);
+
+    RecordProperty(
+        "rollbackJournalMs",
+        std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(rollbackJournalElapsed).count()));
+    RecordProperty(
+        "defaultProfileMs",
+        std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(defaultElapsed).count()));
+    RecordProperty(
+        "synchronousNormalMs",
+        std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(normalElapsed).count()));
+}
+
 }  // namespace test
 }  // namespace certifiedSender
 }  // namespace alexaClientSDK
@@ -34,6 +34,10 @@
 #include <AVSCommon/SDKInterfaces/StateProviderInterface.h>
 #include <AVSCommon/AVS/StateRefreshPolicy.h>
 #include <AVSCommon/AVS/NamespaceAndName.h>
+#include <AVSCommon/Utils/Threading/Executor.h>
+#include <AVSCommon/Utils/Threading/ExecutorPool.h>
+
+#include "ContextManager/ResponseTimeHistogram.h"
 
 namespace alexaClientSDK {
 namespace contextManager {
@@ -51,9 +55,40 @@ public:
      */
     static std::shared_ptr<ContextManager> create();
 
+    /**
+     * Create a new @c ContextManager instance which requests the states of its @c StateProviderInterfaces
+     * concurrently, so that the context is sent as soon as the slowest of them responds rather than after the sum of
+     * their response times.  Requests to each @c StateProviderInterface are made in order on a @c Strand of @c pool.
+     *
+     * @param pool The pool to make @c provideState requests on.
+     * @return Returns a new @c ContextManager.
+     */
+    static std::shared_ptr<ContextManager> create(std::shared_ptr<avsCommon::utils::threading::ExecutorPool> pool);
+
     /// Destructor.
     ~ContextManager() override;
 
+    /**
+     * Lets the context be sent without waiting for a @c StateProviderInterface for longer than a soft deadline, using
+     * the last state it provided instead.  This is meant for @c StateProviderInterfaces whose state changes rarely, so
+     * that a stale state is better than failing or delaying the context.  If it has never provided a state, its state
+     * is left out of the context.
+     *
+     * @param stateProviderName The name of the @c StateProviderInterface.
+     * @param softDeadline How long to wait for the @c StateProviderInterface to respond to a @c provideState request,
+     * which should be shorter than the timeout after which the context fails.
+     */
+    void setStateProviderSoftDeadline(
+        const avsCommon::avs::NamespaceAndName& stateProviderName,
+        std::chrono::milliseconds softDeadline);
+
+    /**
+     * Gets histograms of how long each @c StateProviderInterface took to respond to @c provideState requests.
+     *
+     * @return A map of state provider namespace and name to response times.
+     */
+    std::unordered_map<avsCommon::avs::NamespaceAndName, ResponseTimeHistogram> getStateProviderResponseTimes();
+
     void setStateProvider(
         const avsCommon::avs::NamespaceAndName& stateProviderName,
         std::shared_ptr<avsCommon::sdkInterfaces::StateProviderInterface> stateProvider) override;
@@ -80,6 +115,12 @@ private:
         /// RefreshPolicy for the state of a @c StateProviderInterface.
         avsCommon::avs::StateRefreshPolicy refreshPolicy;
 
+        /**
+         * The serialized state object, including the header and the payload, ready to be spliced into the context.
+         * This is an empty string if @c jsonState is not valid JSON.
+         */
+        std::string stateFragment;
+
         /**
          * Constructor.
          *
@@ -93,8 +134,13 @@ private:
             avsCommon::avs::StateRefreshPolicy initRefreshPolicy = avsCommon::avs::StateRefreshPolicy::ALWAYS);
     };
 
-    /// Constructor.
-    ContextManager();
+    /**
+     * Constructor.
+     *
+     * @param pool The pool to make @c provideState requests on, or @c nullptr to make them one after another on
+     * @c m_updateStatesThread.
+     */
+    ContextManager(std::shared_ptr<avsCommon::utils::threading::ExecutorPool> pool);
 
     /**
      * Initialize a new instance of @c ContextManager.
@@ -107,9 +153,26 @@ private:
      *
      * @param stateProviderName The name of the @c StateProviderInterface whose state is being updated.
      * @param jsonState The state of the @c StateProviderInterface.
+     * @param stateFragment The serialized state object built from @c jsonState by @c buildStateFragment, which is only
+     * used if the state changed.
      * @param refreshPolicy The refresh policy for the state.
      */
     avsCommon::sdkInterfaces::SetStateResult updateStateLocked(
+        const avsCommon::avs::NamespaceAndName& stateProviderName,
+        const std::string& jsonState,
+        const std::string& stateFragment,
+        const avsCommon::avs::StateRefreshPolicy& refreshPolicy);
+
+    /**
+     * Checks whether a state differs from the one last set by a @c StateProviderInterface.  The
+     * @c m_stateProviderMutex needs to be acquired before this function is called.
+     *
+     * @param stateProviderName The name of the @c StateProviderInterface whose state is being updated.
+     * @param jsonState The state of the @c StateProviderInterface.
+     * @param refreshPolicy The refresh policy for the state.
+     * @return Whether the state or its refresh policy changed, or no state was set before.
+     */
+    bool isStateChangedLocked(
         const avsCommon::avs::NamespaceAndName& stateProviderName,
         const std::string& jsonState,
         const avsCommon::avs::StateRefreshPolicy& refreshPolicy);
@@ -121,6 +184,18 @@ private:
      */
     void requestStatesLocked(std::unique_lock<std::mutex>& stateProviderLock);
 
+    /**
+     * Waits until all the @c StateProviderInterfaces in @c m_pendingOnStateProviders have responded, or their soft
+     * deadline or @c PROVIDE_STATE_DEFAULT_TIMEOUT has passed, and then clears @c m_pendingOnStateProviders.
+     *
+     * @param stateProviderLock The lock acquired on the @c m_stateProviderMutex.
+     * @param[out] staleStateProviders The @c StateProviderInterfaces which missed their soft deadline.
+     * @return @c false if a @c StateProviderInterface without a soft deadline timed out, else @c true.
+     */
+    bool waitForStatesLocked(
+        std::unique_lock<std::mutex>& stateProviderLock,
+        std::unordered_set<avsCommon::avs::NamespaceAndName>* staleStateProviders);
+
     /**
      * Sends the context to all @c ContextRequesterInterfaces in the queue. It sends failure to all the
      * @c ContextRequesterInterfaces if an error was encountered while updating the states or building the context.
@@ -153,24 +228,36 @@ private:
         rapidjson::Document::AllocatorType& allocator);
 
     /**
-     * Builds a JSON state object. The state includes the header and the payload.
+     * Builds a serialized JSON state object. The state includes the header and the payload.  This validates and
+     * re-serializes the payload, so that building the context only has to join the state objects together.
      *
      * @param namespaceAndName Namespace and name of the state provider.
      * @param jsonPayloadValue The payload value associated with the "payload" key.
-     * @param allocator The rapidjson allocator to use to build the JSON header.
-     * @return A state object if successful else empty value.
+     * @return The serialized state object if successful else an empty string.
      */
-    rapidjson::Value buildState(
+    std::string buildStateFragment(
         const avsCommon::avs::NamespaceAndName& namespaceAndName,
-        const std::string jsonPayloadValue,
-        rapidjson::Document::AllocatorType& allocator);
+        const std::string& jsonPayloadValue);
+
+    /**
+     * Builds the context from the state objects of the @c stateProviderInterfaces, or reuses the context built last
+     * time if no state has changed since.  The @c m_stateProviderMutex needs to be acquired before this function is
+     * called.
+     *
+     * @param staleStateProviders The @c StateProviderInterfaces which missed their soft deadline, which are left out
+     * of the context if they have never provided a state.
+     * @return The context JSON string, or an empty string if building the context failed.
+     */
+    std::string buildContextLocked(const std::unordered_set<avsCommon::avs::NamespaceAndName>& staleStateProviders);
 
     /**
      * Builds the context states from a map of state provider namespace and name to state information provided by each
      * of the @c stateProviderInterfaces and sends the context by calling @c onContextAvailable for each of the context
      * requesters.
+     *
+     * @param staleStateProviders The @c StateProviderInterfaces which missed their soft deadline.
      */
-    void sendContextToRequesters();
+    void sendContextToRequesters(const std::unordered_set<avsCommon::avs::NamespaceAndName>& staleStateProviders);
 
     /**
      * Map of state provider namespace and name to the state information. @c m_stateProviderMutex must be acquired
@@ -182,10 +269,35 @@ private:
     std::queue<std::shared_ptr<avsCommon::sdkInterfaces::ContextRequesterInterface>> m_contextRequesterQueue;
 
     /**
-     * Maintains a set of namespace and name of the the state providers to whom a @c provideState request has been sent.
-     * @c m_stateProviderMutex must be acquired before modifying the set.
+     * Maps the namespace and name of the the state providers to whom a @c provideState request has been sent to the
+     * time the request was made.  @c m_stateProviderMutex must be acquired before modifying the map.
      */
-    std::unordered_set<avsCommon::avs::NamespaceAndName> m_pendingOnStateProviders;
+    std::unordered_map<avsCommon::avs::NamespaceAndName, std::chrono::steady_clock::time_point>
+        m_pendingOnStateProviders;
+
+    /**
+     * Map of state provider namespace and name to its soft deadline.  @c m_stateProviderMutex must be acquired before
+     * accessing the map.
+     */
+    std::unordered_map<avsCommon::avs::NamespaceAndName, std::chrono::milliseconds> m_softDeadlines;
+
+    /**
+     * Map of state provider namespace and name to how long it took to respond to @c provideState requests.
+     * @c m_stateProviderMutex must be acquired before accessing the map.
+     */
+    std::unordered_map<avsCommon::avs::NamespaceAndName, ResponseTimeHistogram> m_responseTimes;
+
+    /// The pool to make @c provideState requests on, or @c nullptr to make them on @c m_updateStatesThread.
+    const std::shared_ptr<avsCommon::utils::threading::ExecutorPool> m_executorPool;
+
+    /**
+     * Map of state provider namespace and name to the @c Executor its @c provideState requests are made on, when
+     * @c m_executorPool is set.  Entries are kept when state providers are removed, so that an @c Executor is never
+     * destroyed (which waits for its running task) while @c m_stateProviderMutex is held.  @c m_stateProviderMutex
+     * must be acquired before accessing the map.
+     */
+    std::unordered_map<avsCommon::avs::NamespaceAndName, std::shared_ptr<avsCommon::utils::threading::Executor>>
+        m_stateProviderExecutors;
 
     /// Mutex to manage writes and reads to and from @c m_namespaceNameToStateInfo.
     std::mutex m_stateProviderMutex;
@@ -215,6 +327,24 @@ private:
      */
     unsigned int m_stateRequestToken;
 
+    /**
+     * The generation of the states in @c m_namespaceNameToStateInfo, which is incremented whenever a state is changed,
+     * added or removed.  The @c m_stateProviderMutex must be acquired before modifying or reading the value.
+     */
+    uint64_t m_stateGeneration;
+
+    /**
+     * The context built from the states of generation @c m_cachedContextGeneration, or an empty string if none has been
+     * built.  The @c m_stateProviderMutex must be acquired before modifying or reading the value.
+     */
+    std::string m_cachedContext;
+
+    /**
+     * The generation of the states @c m_cachedContext was built from.  The @c m_stateProviderMutex must be acquired
+     * before modifying or reading the value.
+     */
+    uint64_t m_cachedContextGeneration;
+
     /*
      * Whether the contextManager is shutting down. The @c m_contextRequesterMutex is acquired before this value is
      * modified or read.
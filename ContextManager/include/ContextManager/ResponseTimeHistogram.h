@@ -0,0 +1,110 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_CONTEXTMANAGER_INCLUDE_CONTEXTMANAGER_RESPONSETIMEHISTOGRAM_H_
+#define ALEXA_CLIENT_SDK_CONTEXTMANAGER_INCLUDE_CONTEXTMANAGER_RESPONSETIMEHISTOGRAM_H_
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+namespace alexaClientSDK {
+namespace contextManager {
+
+/**
+ * A histogram of how long a state provider took to respond to @c provideState requests, so that slow state providers
+ * can be identified.  Response times are counted in buckets with fixed upper bounds, from 1 ms to 2 s.
+ */
+class ResponseTimeHistogram {
+public:
+    /// The number of buckets with an upper bound.  One more bucket counts the response times above all of them.
+    static constexpr size_t NUM_BOUNDED_BUCKETS = 11;
+
+    /// The upper bounds of the buckets, inclusive.
+    static const std::array<std::chrono::milliseconds, NUM_BOUNDED_BUCKETS> BUCKET_BOUNDS;
+
+    /// The counts of response times in each bucket, followed by the count of those above all the bounds.
+    using Counts = std::array<uint64_t, NUM_BOUNDED_BUCKETS + 1>;
+
+    /// Constructor.
+    ResponseTimeHistogram();
+
+    /**
+     * Counts a response.
+     *
+     * @param responseTime The time from the @c provideState request to the @c setState response.
+     */
+    void record(std::chrono::steady_clock::duration responseTime);
+
+    /// Counts a request which was not responded to in time.
+    void recordTimeout();
+
+    /**
+     * Gets the counts of response times in each bucket.
+     *
+     * @return The counts of response times in each bucket.
+     */
+    const Counts& getCounts() const;
+
+    /**
+     * Gets the number of responses counted.
+     *
+     * @return The number of responses counted.
+     */
+    uint64_t getResponseCount() const;
+
+    /**
+     * Gets the number of requests which were not responded to in time.
+     *
+     * @return The number of requests which were not responded to in time.
+     */
+    uint64_t getTimeoutCount() const;
+
+    /**
+     * Gets the longest response time counted.
+     *
+     * @return The longest response time counted, or zero if no responses have been counted.
+     */
+    std::chrono::steady_clock::duration getMaxResponseTime() const;
+
+private:
+    /// The counts of response times in each bucket.
+    Counts m_counts;
+
+    /// The number of responses counted.
+    uint64_t m_responseCount;
+
+    /// The number of requests which were not responded to in time.
+    uint64_t m_timeoutCount;
+
+    /// The longest response time counted.
+    std::chrono::steady_clock::duration m_maxResponseTime;
+};
+
+/**
+ * Write a @c ResponseTimeHistogram to an @c ostream as a list of non-empty buckets, such as "<=5ms:3 <=10ms:1
+ * timeouts:0".
+ *
+ * @param stream The stream to write to.
+ * @param histogram The histogram to write.
+ * @return The stream.
+ */
+std::ostream& operator<<(std::ostream& stream, const ResponseTimeHistogram& histogram);
+
+}  // namespace contextManager
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_CONTEXTMANAGER_INCLUDE_CONTEXTMANAGER_RESPONSETIMEHISTOGRAM_H_
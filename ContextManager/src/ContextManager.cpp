@@ -13,6 +13,7 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
 #include <string>
 
 #include <AVSCommon/Utils/Logger/Logger.h>
@@ -30,6 +31,7 @@ using namespace avsCommon;
 using namespace avsCommon::avs;
 using namespace avsCommon::sdkInterfaces;
 using namespace avsCommon::utils;
+using namespace avsCommon::utils::threading;
 
 /// String to identify log entries originating from this file.
 static const std::string TAG("ContextManager");
@@ -57,7 +59,17 @@ static const std::string PAYLOAD_JSON_KEY = "payload";
 static const std::string CONTEXT_JSON_KEY = "context";
 
 std::shared_ptr<ContextManager> ContextManager::create() {
-    std::shared_ptr<ContextManager> contextManager(new ContextManager());
+    std::shared_ptr<ContextManager> contextManager(new ContextManager(nullptr));
+    contextManager->init();
+    return contextManager;
+}
+
+std::shared_ptr<ContextManager> ContextManager::create(std::shared_ptr<ExecutorPool> pool) {
+    if (!pool) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullPool"));
+        return nullptr;
+    }
+    std::shared_ptr<ContextManager> contextManager(new ContextManager(pool));
     contextManager->init();
     return contextManager;
 }
@@ -71,18 +83,36 @@ ContextManager::~ContextManager() {
     if (m_updateStatesThread.joinable()) {
         m_updateStatesThread.join();
     }
+
+    // Destroying the executors waits for any provideState call in progress, which may call setState.
+    std::unique_lock<std::mutex> stateProviderLock(m_stateProviderMutex);
+    auto executors = std::move(m_stateProviderExecutors);
+    m_stateProviderExecutors.clear();
+    stateProviderLock.unlock();
+    executors.clear();
 }
 
 void ContextManager::setStateProvider(
     const NamespaceAndName& stateProviderName,
     std::shared_ptr<StateProviderInterface> stateProvider) {
-    std::lock_guard<std::mutex> stateProviderLock(m_stateProviderMutex);
+    std::unique_lock<std::mutex> stateProviderLock(m_stateProviderMutex);
     if (!stateProvider) {
-        m_namespaceNameToStateInfo.erase(stateProviderName);
+        if (m_namespaceNameToStateInfo.erase(stateProviderName)) {
+            m_stateGeneration++;
+        }
+        std::shared_ptr<Executor> executor;
+        auto executorIt = m_stateProviderExecutors.find(stateProviderName);
+        if (executorIt != m_stateProviderExecutors.end()) {
+            executor = executorIt->second;
+            m_stateProviderExecutors.erase(executorIt);
+        }
         ACSDK_DEBUG5(LX("setStateProvider")
                          .d("action", "removedStateProvider")
                          .d("namespace", stateProviderName.nameSpace)
                          .d("name", stateProviderName.name));
+        // A provideState call still running on the executor may be waiting for the lock in setState.
+        stateProviderLock.unlock();
+        executor.reset();
         return;
     }
     auto stateInfoMappingIt = m_namespaceNameToStateInfo.find(stateProviderName);
@@ -91,6 +121,21 @@ void ContextManager::setStateProvider(
     } else {
         stateInfoMappingIt->second->stateProvider = stateProvider;
     }
+    if (m_executorPool && m_stateProviderExecutors.end() == m_stateProviderExecutors.find(stateProviderName)) {
+        m_stateProviderExecutors[stateProviderName] = std::make_shared<Executor>(m_executorPool);
+    }
+}
+
+void ContextManager::setStateProviderSoftDeadline(
+    const NamespaceAndName& stateProviderName,
+    std::chrono::milliseconds softDeadline) {
+    std::lock_guard<std::mutex> stateProviderLock(m_stateProviderMutex);
+    m_softDeadlines[stateProviderName] = softDeadline;
+}
+
+std::unordered_map<NamespaceAndName, ResponseTimeHistogram> ContextManager::getStateProviderResponseTimes() {
+    std::lock_guard<std::mutex> stateProviderLock(m_stateProviderMutex);
+    return m_responseTimes;
 }
 
 SetStateResult ContextManager::setState(
@@ -98,9 +143,20 @@ SetStateResult ContextManager::setState(
     const std::string& jsonState,
     const StateRefreshPolicy& refreshPolicy,
     const unsigned int stateRequestToken) {
-    std::lock_guard<std::mutex> stateProviderLock(m_stateProviderMutex);
+    std::unique_lock<std::mutex> stateProviderLock(m_stateProviderMutex);
+    std::string stateFragment;
+    /*
+     * Serialize a changed state without the lock, so that building the context only has to join the states.  If the
+     * state is unchanged, the lock is held until updateStateLocked finds it unchanged too.  An empty state is either
+     * left out of the context or fails it, so it is not serialized.
+     */
+    if (!jsonState.empty() && isStateChangedLocked(stateProviderName, jsonState, refreshPolicy)) {
+        stateProviderLock.unlock();
+        stateFragment = buildStateFragment(stateProviderName, jsonState);
+        stateProviderLock.lock();
+    }
     if (0 == stateRequestToken) {
-        return updateStateLocked(stateProviderName, jsonState, refreshPolicy);
+        return updateStateLocked(stateProviderName, jsonState, stateFragment, refreshPolicy);
     }
     if (stateRequestToken != m_stateRequestToken) {
         ACSDK_ERROR(LX("setStateFailed")
@@ -112,18 +168,17 @@ SetStateResult ContextManager::setState(
 
         return SetStateResult::STATE_TOKEN_OUTDATED;
     }
-    SetStateResult status = updateStateLocked(stateProviderName, jsonState, refreshPolicy);
+    SetStateResult status = updateStateLocked(stateProviderName, jsonState, stateFragment, refreshPolicy);
     if (SetStateResult::SUCCESS == status) {
         auto it = m_pendingOnStateProviders.find(stateProviderName);
         if (it != m_pendingOnStateProviders.end()) {
+            m_responseTimes[stateProviderName].record(std::chrono::steady_clock::now() - it->second);
             m_pendingOnStateProviders.erase(it);
-        }
-        /*
-         * Once the m_pendingOnStateProviders is empty, it implies that the ContextManager has received the state
-         * from all the StateProviderInterfaces it sent provideState requests to, and updateStatesLoop should be
-         * notified.
-         */
-        if (m_pendingOnStateProviders.empty()) {
+            /*
+             * updateStatesLoop is notified of every response rather than only once m_pendingOnStateProviders is
+             * empty, since it may be able to send the context without waiting for the providers past their soft
+             * deadline.
+             */
             m_setStateCompleteNotifier.notify_one();
         }
     }
@@ -151,16 +206,32 @@ ContextManager::StateInfo::StateInfo(
         refreshPolicy{initRefreshPolicy} {
 }
 
-ContextManager::ContextManager() : m_stateRequestToken{0}, m_shutdown{false} {
+ContextManager::ContextManager(std::shared_ptr<ExecutorPool> pool) :
+        m_executorPool{pool},
+        m_stateRequestToken{0},
+        m_stateGeneration{0},
+        m_cachedContextGeneration{0},
+        m_shutdown{false} {
 }
 
 void ContextManager::init() {
     m_updateStatesThread = std::thread(&ContextManager::updateStatesLoop, this);
 }
 
+bool ContextManager::isStateChangedLocked(
+    const NamespaceAndName& stateProviderName,
+    const std::string& jsonState,
+    const StateRefreshPolicy& refreshPolicy) {
+    auto stateInfoMappingIt = m_namespaceNameToStateInfo.find(stateProviderName);
+    return m_namespaceNameToStateInfo.end() == stateInfoMappingIt ||
+           stateInfoMappingIt->second->jsonState != jsonState ||
+           stateInfoMappingIt->second->refreshPolicy != refreshPolicy;
+}
+
 SetStateResult ContextManager::updateStateLocked(
     const NamespaceAndName& stateProviderName,
     const std::string& jsonState,
+    const std::string& stateFragment,
     const StateRefreshPolicy& refreshPolicy) {
     auto stateInfoMappingIt = m_namespaceNameToStateInfo.find(stateProviderName);
     if (m_namespaceNameToStateInfo.end() == stateInfoMappingIt) {
@@ -171,10 +242,19 @@ SetStateResult ContextManager::updateStateLocked(
                             .d("name", stateProviderName.name));
             return SetStateResult::STATE_PROVIDER_NOT_REGISTERED;
         }
-        m_namespaceNameToStateInfo[stateProviderName] = std::make_shared<StateInfo>(nullptr, jsonState, refreshPolicy);
+        auto stateInfo = std::make_shared<StateInfo>(nullptr, jsonState, refreshPolicy);
+        stateInfo->stateFragment = stateFragment;
+        m_namespaceNameToStateInfo[stateProviderName] = stateInfo;
+        m_stateGeneration++;
     } else {
-        stateInfoMappingIt->second->jsonState = jsonState;
-        stateInfoMappingIt->second->refreshPolicy = refreshPolicy;
+        auto& stateInfo = stateInfoMappingIt->second;
+        if (stateInfo->jsonState == jsonState && stateInfo->refreshPolicy == refreshPolicy) {
+            return SetStateResult::SUCCESS;
+        }
+        stateInfo->jsonState = jsonState;
+        stateInfo->stateFragment = stateFragment;
+        stateInfo->refreshPolicy = refreshPolicy;
+        m_stateGeneration++;
         ACSDK_DEBUG9(LX("updateStateLocked")
                          .d("action", "updatedState")
                          .sensitive("state", jsonState)
@@ -199,28 +279,104 @@ void ContextManager::requestStatesLocked(std::unique_lock<std::mutex>& stateProv
         auto& stateInfo = it->second;
         if (StateRefreshPolicy::ALWAYS == stateInfo->refreshPolicy ||
             StateRefreshPolicy::SOMETIMES == stateInfo->refreshPolicy) {
-            m_pendingOnStateProviders.insert(it->first);
+            m_pendingOnStateProviders[it->first] = std::chrono::steady_clock::now();
+            auto stateProvider = stateInfo->stateProvider;
+            auto stateProviderName = it->first;
+            auto executorIt = m_stateProviderExecutors.find(it->first);
+            if (executorIt != m_stateProviderExecutors.end()) {
+                executorIt->second->submitDetached([stateProvider, stateProviderName, curStateReqToken]() {
+                    stateProvider->provideState(stateProviderName, curStateReqToken);
+                });
+                continue;
+            }
+            /*
+             * Iterators of m_namespaceNameToStateInfo may be invalidated while the lock is released, so iterate over
+             * a copy of the name instead.
+             */
             stateProviderLock.unlock();
-            stateInfo->stateProvider->provideState(it->first, curStateReqToken);
+            stateProvider->provideState(stateProviderName, curStateReqToken);
             stateProviderLock.lock();
+            it = m_namespaceNameToStateInfo.find(stateProviderName);
+            if (m_namespaceNameToStateInfo.end() == it) {
+                break;
+            }
+        }
+    }
+}
+
+bool ContextManager::waitForStatesLocked(
+    std::unique_lock<std::mutex>& stateProviderLock,
+    std::unordered_set<NamespaceAndName>* staleStateProviders) {
+    auto hardDeadline = std::chrono::steady_clock::now() + PROVIDE_STATE_DEFAULT_TIMEOUT;
+    while (!m_pendingOnStateProviders.empty()) {
+        // Wait for the nearest deadline of the pending providers: their soft deadline if they have one.
+        auto nextDeadline = hardDeadline;
+        for (auto& pending : m_pendingOnStateProviders) {
+            auto softDeadlineIt = m_softDeadlines.find(pending.first);
+            if (softDeadlineIt != m_softDeadlines.end()) {
+                nextDeadline = std::min(nextDeadline, pending.second + softDeadlineIt->second);
+            }
+        }
+        if (std::cv_status::timeout != m_setStateCompleteNotifier.wait_until(stateProviderLock, nextDeadline)) {
+            continue;
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (now >= hardDeadline) {
+            break;
+        }
+        for (auto it = m_pendingOnStateProviders.begin(); it != m_pendingOnStateProviders.end();) {
+            auto softDeadlineIt = m_softDeadlines.find(it->first);
+            if (softDeadlineIt != m_softDeadlines.end() && now >= it->second + softDeadlineIt->second) {
+                ACSDK_DEBUG5(LX("waitForStatesLocked")
+                                 .d("action", "usingStaleState")
+                                 .d("namespace", it->first.nameSpace)
+                                 .d("name", it->first.name));
+                m_responseTimes[it->first].recordTimeout();
+                staleStateProviders->insert(it->first);
+                it = m_pendingOnStateProviders.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    bool success = true;
+    for (auto& pending : m_pendingOnStateProviders) {
+        m_responseTimes[pending.first].recordTimeout();
+        if (m_softDeadlines.count(pending.first)) {
+            staleStateProviders->insert(pending.first);
+        } else {
+            ACSDK_ERROR(LX("waitForStatesLockedFailed")
+                            .d("reason", "stateProviderTimedOut")
+                            .d("namespace", pending.first.nameSpace)
+                            .d("name", pending.first.name));
+            success = false;
         }
     }
+    m_pendingOnStateProviders.clear();
+    return success;
 }
 
 void ContextManager::sendContextAndClearQueue(
     const std::string& context,
     const ContextRequestError& contextRequestError) {
-    std::unique_lock<std::mutex> contextRequesterLock(m_contextRequesterMutex);
-    while (!m_contextRequesterQueue.empty()) {
-        auto currentContextRequester = m_contextRequesterQueue.front();
-        contextRequesterLock.unlock();
+    /*
+     * Take the queue before delivering, so that a requester calling getContext from its callback is queued for the
+     * next context rather than served this one, and so that the queue is already empty once a requester is served.
+     */
+    std::queue<std::shared_ptr<ContextRequesterInterface>> contextRequesters;
+    {
+        std::lock_guard<std::mutex> contextRequesterLock(m_contextRequesterMutex);
+        std::swap(contextRequesters, m_contextRequesterQueue);
+    }
+    while (!contextRequesters.empty()) {
+        auto currentContextRequester = contextRequesters.front();
+        contextRequesters.pop();
         if (!context.empty()) {
             currentContextRequester->onContextAvailable(context);
         } else {
             currentContextRequester->onContextFailure(contextRequestError);
         }
-        contextRequesterLock.lock();
-        m_contextRequesterQueue.pop();
     }
 }
 
@@ -237,19 +393,16 @@ void ContextManager::updateStatesLoop() {
         std::unique_lock<std::mutex> stateProviderLock(m_stateProviderMutex);
         requestStatesLocked(stateProviderLock);
 
-        if (!m_pendingOnStateProviders.empty()) {
-            if (!m_setStateCompleteNotifier.wait_for(stateProviderLock, PROVIDE_STATE_DEFAULT_TIMEOUT, [this]() {
-                    return m_pendingOnStateProviders.empty();
-                })) {
-                stateProviderLock.unlock();
-                ACSDK_ERROR(LX("updateStatesLoopFailed").d("reason", "stateProviderTimedOut"));
-                sendContextAndClearQueue("", ContextRequestError::STATE_PROVIDER_TIMEDOUT);
-                continue;
-            }
+        std::unordered_set<NamespaceAndName> staleStateProviders;
+        if (!waitForStatesLocked(stateProviderLock, &staleStateProviders)) {
+            stateProviderLock.unlock();
+            ACSDK_ERROR(LX("updateStatesLoopFailed").d("reason", "stateProviderTimedOut"));
+            sendContextAndClearQueue("", ContextRequestError::STATE_PROVIDER_TIMEDOUT);
+            continue;
         }
         stateProviderLock.unlock();
 
-        sendContextToRequesters();
+        sendContextToRequesters(staleStateProviders);
     }
 }
 
@@ -262,41 +415,45 @@ Value ContextManager::buildHeader(const NamespaceAndName& namespaceAndName, Docu
     return header;
 }
 
-Value ContextManager::buildState(
+std::string ContextManager::buildStateFragment(
     const NamespaceAndName& namespaceAndName,
-    const std::string jsonPayloadValue,
-    Document::AllocatorType& allocator) {
-    Document payload;
-    Value state(kObjectType);
+    const std::string& jsonPayloadValue) {
+    Document state(kObjectType);
+    Document::AllocatorType& allocator = state.GetAllocator();
     Value header = buildHeader(namespaceAndName, allocator);
 
-    // If the header is an empty object or during parsing the payload, an error occurs, return an empty event value.
+    // If the header is an empty object or during parsing the payload, an error occurs, return an empty state.
     if (header.ObjectEmpty()) {
-        ACSDK_ERROR(LX("buildStateFailed").d("reason", "emptyHeader"));
-        return state;
+        ACSDK_ERROR(LX("buildStateFragmentFailed").d("reason", "emptyHeader"));
+        return "";
     }
 
+    Document payload(&allocator);
     if (payload.Parse(jsonPayloadValue).HasParseError()) {
-        ACSDK_ERROR(LX("buildStateFailed").d("reason", "parseError").d("payload", jsonPayloadValue));
-        return state;
+        ACSDK_ERROR(LX("buildStateFragmentFailed").d("reason", "parseError").sensitive("payload", jsonPayloadValue));
+        return "";
     }
 
     state.AddMember(StringRef(HEADER_JSON_KEY), header, allocator);
-    state.AddMember(StringRef(PAYLOAD_JSON_KEY), Value(payload, allocator), allocator);
+    state.AddMember(StringRef(PAYLOAD_JSON_KEY), payload, allocator);
 
-    return state;
+    StringBuffer stateBuf;
+    Writer<StringBuffer> writer(stateBuf);
+    if (!state.Accept(writer)) {
+        ACSDK_ERROR(LX("buildStateFragmentFailed").d("reason", "convertingJsonToStringFailed"));
+        return "";
+    }
+    return std::string(stateBuf.GetString(), stateBuf.GetSize());
 }
 
-void ContextManager::sendContextToRequesters() {
-    bool errorBuildingContext = false;
-    Document jsonContext;
-    StringBuffer jsonContextBuf;
-
-    jsonContext.SetObject();
-    Value statesArray(kArrayType);
-    Document::AllocatorType& allocator = jsonContext.GetAllocator();
+std::string ContextManager::buildContextLocked(const std::unordered_set<NamespaceAndName>& staleStateProviders) {
+    if (!m_cachedContext.empty() && m_cachedContextGeneration == m_stateGeneration) {
+        return m_cachedContext;
+    }
 
-    std::unique_lock<std::mutex> stateProviderLock(m_stateProviderMutex);
+    std::string context = "{\"" + CONTEXT_JSON_KEY + "\":[";
+    bool isFirstState = true;
+    bool isPartial = false;
     for (auto it = m_namespaceNameToStateInfo.begin(); it != m_namespaceNameToStateInfo.end(); ++it) {
         auto& stateInfo = it->second;
         if (stateInfo->jsonState.empty() && StateRefreshPolicy::SOMETIMES == stateInfo->refreshPolicy) {
@@ -307,30 +464,48 @@ void ContextManager::sendContextToRequesters() {
             ACSDK_DEBUG9(LX("buildContextIgnored").d("namespace", it->first.nameSpace).d("name", it->first.name));
             continue;
         }
-        Value jsonState = buildState(it->first, stateInfo->jsonState, allocator);
-        if (jsonState.ObjectEmpty()) {
-            ACSDK_ERROR(LX("buildContextFailed").d("reason", "buildStateFailed"));
-            errorBuildingContext = true;
-            break;
+        if (stateInfo->jsonState.empty() && staleStateProviders.count(it->first)) {
+            // A state provider which missed its soft deadline without ever providing a state is left out.
+            ACSDK_DEBUG9(LX("buildContextIgnored")
+                             .d("reason", "noStaleState")
+                             .d("namespace", it->first.nameSpace)
+                             .d("name", it->first.name));
+            isPartial = true;
+            continue;
+        }
+        if (stateInfo->stateFragment.empty()) {
+            ACSDK_ERROR(LX("buildContextFailed")
+                            .d("reason", "buildStateFailed")
+                            .d("namespace", it->first.nameSpace)
+                            .d("name", it->first.name)
+                            .sensitive("payload", stateInfo->jsonState));
+            return "";
+        }
+        if (!isFirstState) {
+            context += ',';
         }
-        statesArray.PushBack(Value(jsonState, allocator).Move(), allocator);
+        context += stateInfo->stateFragment;
+        isFirstState = false;
     }
-    stateProviderLock.unlock();
+    context += "]}";
 
-    if (!errorBuildingContext) {
-        jsonContext.AddMember(StringRef(CONTEXT_JSON_KEY), statesArray, allocator);
-        Writer<StringBuffer> writer(jsonContextBuf);
-        if (!jsonContext.Accept(writer)) {
-            ACSDK_ERROR(LX("buildContextFailed").d("reason", "convertingJsonToStringFailed"));
-            errorBuildingContext = true;
-        }
+    if (!isPartial) {
+        m_cachedContext = context;
+        m_cachedContextGeneration = m_stateGeneration;
     }
+    return context;
+}
+
+void ContextManager::sendContextToRequesters(const std::unordered_set<NamespaceAndName>& staleStateProviders) {
+    std::unique_lock<std::mutex> stateProviderLock(m_stateProviderMutex);
+    auto context = buildContextLocked(staleStateProviders);
+    stateProviderLock.unlock();
 
-    if (errorBuildingContext) {
+    if (context.empty()) {
         sendContextAndClearQueue("", ContextRequestError::BUILD_CONTEXT_ERROR);
     } else {
-        ACSDK_DEBUG5(LX("buildContextSuccessful").sensitive("context", jsonContextBuf.GetString()));
-        sendContextAndClearQueue(jsonContextBuf.GetString());
+        ACSDK_DEBUG5(LX("buildContextSuccessful").sensitive("context", context));
+        sendContextAndClearQueue(context);
     }
 }
 
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+
+#include "ContextManager/ResponseTimeHistogram.h"
+
+namespace alexaClientSDK {
+namespace contextManager {
+
+using namespace std::chrono;
+
+constexpr size_t ResponseTimeHistogram::NUM_BOUNDED_BUCKETS;
+
+const std::array<milliseconds, ResponseTimeHistogram::NUM_BOUNDED_BUCKETS> ResponseTimeHistogram::BUCKET_BOUNDS = {
+    {milliseconds(1),
+     milliseconds(2),
+     milliseconds(5),
+     milliseconds(10),
+     milliseconds(20),
+     milliseconds(50),
+     milliseconds(100),
+     milliseconds(200),
+     milliseconds(500),
+     milliseconds(1000),
+     milliseconds(2000)}};
+
+ResponseTimeHistogram::ResponseTimeHistogram() :
+        m_counts(),
+        m_responseCount{0},
+        m_timeoutCount{0},
+        m_maxResponseTime{steady_clock::duration::zero()} {
+}
+
+void ResponseTimeHistogram::record(steady_clock::duration responseTime) {
+    auto bound = std::lower_bound(BUCKET_BOUNDS.begin(), BUCKET_BOUNDS.end(), responseTime);
+    m_counts[bound - BUCKET_BOUNDS.begin()]++;
+    m_responseCount++;
+    m_maxResponseTime = std::max(m_maxResponseTime, responseTime);
+}
+
+void ResponseTimeHistogram::recordTimeout() {
+    m_timeoutCount++;
+}
+
+const ResponseTimeHistogram::Counts& ResponseTimeHistogram::getCounts() const {
+    return m_counts;
+}
+
+uint64_t ResponseTimeHistogram::getResponseCount() const {
+    return m_responseCount;
+}
+
+uint64_t ResponseTimeHistogram::getTimeoutCount() const {
+    return m_timeoutCount;
+}
+
+steady_clock::duration ResponseTimeHistogram::getMaxResponseTime() const {
+    return m_maxResponseTime;
+}
+
+std::ostream& operator<<(std::ostream& stream, const ResponseTimeHistogram& histogram) {
+    auto& counts = histogram.getCounts();
+    for (size_t i = 0; i < counts.size(); ++i) {
+        if (0 == counts[i]) {
+            continue;
+        }
+        if (i < ResponseTimeHistogram::BUCKET_BOUNDS.size()) {
+            stream << "<=" << ResponseTimeHistogram::BUCKET_BOUNDS[i].count() << "ms:" << counts[i] << " ";
+        } else {
+            stream << ">" << ResponseTimeHistogram::BUCKET_BOUNDS.back().count() << "ms:" << counts[i] << " ";
+        }
+    }
+    return stream << "timeouts:" << histogram.getTimeoutCount();
+}
+
+}  // namespace contextManager
+}  // namespace alexaClientSDK
@@ -13,7 +13,12 @@
  * permissions and limitations under the License.
  */
 
+#include <chrono>
+#include <sstream>
+#include <vector>
+
 #include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Threading/ExecutorPool.h>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -28,6 +33,7 @@ namespace test {
 using namespace avsCommon;
 using namespace avsCommon::avs;
 using namespace avsCommon::sdkInterfaces;
+using namespace avsCommon::utils::threading;
 
 /// String to identify log entries originating from this file.
 static const std::string TAG("ContextManagerTest");
@@ -155,6 +161,27 @@ static const NamespaceAndName ALERTS(NAMESPACE_ALERTS, NAME_ALERTS_STATE);
 /// Dummy provider namespace and name
 static const NamespaceAndName DUMMY_PROVIDER("Dummy", "DummyName");
 
+/// The numbers of state providers the benchmark builds the context from.
+static const std::vector<int> BENCHMARK_PROVIDER_COUNTS = {1, 5, 15, 30};
+
+/// The number of contexts the benchmark requests for each number of state providers.
+static const int BENCHMARK_ITERATIONS = 200;
+
+/// The number of bytes of the token in the state of each benchmark state provider.
+static const size_t BENCHMARK_TOKEN_SIZE = 512;
+
+/// The number of slow state providers in the concurrent fan-out tests.
+static const int SLOW_PROVIDER_COUNT = 4;
+
+/// The time each slow state provider blocks in @c provideState.
+static const std::chrono::milliseconds SLOW_PROVIDE_STATE_TIME = std::chrono::milliseconds(100);
+
+/// The soft deadline of the stale-tolerant state providers, well below @c TIMEOUT_SLEEP_TIME.
+static const std::chrono::milliseconds SOFT_DEADLINE = std::chrono::milliseconds(20);
+
+/// The number of threads in the pool of concurrent @c ContextManagers.
+static const size_t POOL_THREADS = 8;
+
 /**
  * @c MockContextRequester used to verify @c ContextManager behavior.
  */
@@ -522,6 +549,120 @@ unsigned int MockStateProvider::getCurrentstateRequestToken() {
     return m_stateRequestToken;
 }
 
+/**
+ * A @c StateProviderInterface which does its work within @c provideState, blocking the caller before it calls
+ * @c setState.
+ */
+class BlockingStateProvider : public StateProviderInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param contextManager The @c ContextManager to provide the state to.
+     * @param state The state to provide.
+     * @param delayTime The time to block in @c provideState.
+     */
+    BlockingStateProvider(
+        ContextManager* contextManager,
+        const std::string& state,
+        std::chrono::milliseconds delayTime) :
+            m_contextManager{contextManager},
+            m_state{state},
+            m_delayTime{delayTime} {
+    }
+
+    void provideState(const NamespaceAndName& stateProviderName, unsigned int stateRequestToken) override {
+        std::this_thread::sleep_for(m_delayTime);
+        m_contextManager->setState(stateProviderName, m_state, StateRefreshPolicy::ALWAYS, stateRequestToken);
+    }
+
+private:
+    /// The @c ContextManager to provide the state to.  This is a raw pointer to avoid a reference cycle.
+    ContextManager* m_contextManager;
+
+    /// The state to provide.
+    std::string m_state;
+
+    /// The time to block in @c provideState.
+    std::chrono::milliseconds m_delayTime;
+};
+
+/**
+ * Register @c BlockingStateProviders with a @c ContextManager.
+ *
+ * @param contextManager The @c ContextManager.
+ * @param count The number of @c BlockingStateProviders.
+ * @param delayTime The time each of them blocks in @c provideState.
+ * @return The @c BlockingStateProviders.
+ */
+static std::vector<std::shared_ptr<BlockingStateProvider>> addBlockingStateProviders(
+    std::shared_ptr<ContextManager> contextManager,
+    int count,
+    std::chrono::milliseconds delayTime) {
+    std::vector<std::shared_ptr<BlockingStateProvider>> providers;
+    for (int i = 0; i < count; ++i) {
+        auto provider = std::make_shared<BlockingStateProvider>(contextManager.get(), AUDIO_PLAYER_PAYLOAD, delayTime);
+        contextManager->setStateProvider(NamespaceAndName("Slow" + std::to_string(i), NAME_PLAYBACK_STATE), provider);
+        providers.push_back(provider);
+    }
+    return providers;
+}
+
+/**
+ * A @c ContextRequesterInterface which counts the contexts it receives, so that it can wait for each of many requests.
+ */
+class CountingContextRequester : public ContextRequesterInterface {
+public:
+    /// Constructor.
+    CountingContextRequester() : m_contextCount{0} {
+    }
+
+    void onContextAvailable(const std::string& context) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_context = context;
+        m_contextCount++;
+        m_wakeTrigger.notify_one();
+    }
+
+    void onContextFailure(const ContextRequestError error) override {
+    }
+
+    /**
+     * Waits for a specified time for a number of contexts to have been received in total.
+     *
+     * @param count The number of contexts.
+     * @param duration Number of milliseconds to wait before giving up.
+     * @return @c true if the contexts were received within the specified duration, else @c false.
+     */
+    bool waitForContextCount(int count, const std::chrono::milliseconds duration = std::chrono::milliseconds(200)) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_wakeTrigger.wait_for(lock, duration, [this, count]() { return m_contextCount >= count; });
+    }
+
+    /**
+     * Function to read the last context received.
+     *
+     * @return The context.
+     */
+    std::string getContextString() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_context;
+    }
+
+private:
+    /// Mutex to protect @c m_contextCount and @c m_context.
+    std::mutex m_mutex;
+
+    /// Condition variable to wake @c waitForContextCount.
+    std::condition_variable m_wakeTrigger;
+
+    /// The number of contexts received.
+    int m_contextCount;
+
+    /// The last context received.
+    std::string m_context;
+};
+
 /// Context Manager Test
 class ContextManagerTest : public ::testing::Test {
 public:
@@ -789,6 +930,208 @@ TEST_F(ContextManagerTest, testEmptyProvider) {
     ASSERT_TRUE(m_contextRequester->checkContextString(CONTEXT_TEST, m_contextRequester->getContextString()));
 }
 
+/**
+ * Set a state which is not valid JSON. Request for context by calling @c getContext. Expect that failure occurs. Then
+ * set a valid state for the same @c StateProviderInterface, and expect that the context is returned.
+ */
+TEST_F(ContextManagerTest, testInvalidState) {
+    ASSERT_EQ(SetStateResult::SUCCESS, m_contextManager->setState(ALERTS, "{", StateRefreshPolicy::NEVER));
+    m_contextManager->getContext(m_contextRequester);
+    ASSERT_TRUE(m_contextRequester->waitForFailure(FAILURE_TIMEOUT));
+
+    ASSERT_EQ(SetStateResult::SUCCESS, m_contextManager->setState(ALERTS, ALERTS_PAYLOAD, StateRefreshPolicy::NEVER));
+    auto contextRequester = std::make_shared<CountingContextRequester>();
+    m_contextManager->getContext(contextRequester);
+    ASSERT_TRUE(contextRequester->waitForContextCount(1));
+    EXPECT_NE(std::string::npos, contextRequester->getContextString().find(NAME_ALERTS_STATE));
+}
+
+/**
+ * Request for context by calling @c getContext twice, changing the state of one @c StateProviderInterface in between.
+ * Expect that only the second context includes the changed state, and that a third context is the same as the second.
+ */
+TEST_F(ContextManagerTest, testContextIncludesChangedState) {
+    auto contextRequester = std::make_shared<CountingContextRequester>();
+    m_contextManager->getContext(contextRequester);
+    ASSERT_TRUE(contextRequester->waitForContextCount(1));
+    ASSERT_EQ(CONTEXT_TEST, contextRequester->getContextString());
+
+    ASSERT_EQ(
+        SetStateResult::SUCCESS,
+        m_contextManager->setState(SPEECH_SYNTHESIZER, SPEECH_SYNTHESIZER_PAYLOAD_PLAYING, StateRefreshPolicy::NEVER));
+    m_contextManager->getContext(contextRequester);
+    ASSERT_TRUE(contextRequester->waitForContextCount(2));
+    auto context = contextRequester->getContextString();
+    EXPECT_NE(std::string::npos, context.find("PLAYING"));
+    EXPECT_NE(CONTEXT_TEST, context);
+
+    m_contextManager->getContext(contextRequester);
+    ASSERT_TRUE(contextRequester->waitForContextCount(3));
+    EXPECT_EQ(context, contextRequester->getContextString());
+}
+
+/**
+ * Register several @c StateProviderInterfaces which block in @c provideState with a @c ContextManager which requests
+ * states concurrently. Request for context by calling @c getContext. Expect that the context is returned in about the
+ * time of the slowest @c StateProviderInterface rather than the sum of their times.
+ */
+TEST(ContextManagerConcurrentTest, testConcurrentProvideState) {
+    auto contextManager = ContextManager::create(ExecutorPool::create(POOL_THREADS));
+    ASSERT_TRUE(contextManager);
+    auto providers = addBlockingStateProviders(contextManager, SLOW_PROVIDER_COUNT, SLOW_PROVIDE_STATE_TIME);
+    auto contextRequester = std::make_shared<CountingContextRequester>();
+
+    auto start = std::chrono::steady_clock::now();
+    contextManager->getContext(contextRequester);
+    ASSERT_TRUE(contextRequester->waitForContextCount(1, SLOW_PROVIDE_STATE_TIME * SLOW_PROVIDER_COUNT));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_LT(elapsed, SLOW_PROVIDE_STATE_TIME * (SLOW_PROVIDER_COUNT - 1));
+
+    auto context = contextRequester->getContextString();
+    for (int i = 0; i < SLOW_PROVIDER_COUNT; ++i) {
+        EXPECT_NE(std::string::npos, context.find("Slow" + std::to_string(i)));
+    }
+    auto responseTimes = contextManager->getStateProviderResponseTimes();
+    ASSERT_EQ(static_cast<size_t>(SLOW_PROVIDER_COUNT), responseTimes.size());
+    for (auto& responseTime : responseTimes) {
+        EXPECT_EQ(1u, responseTime.second.getResponseCount());
+        EXPECT_EQ(0u, responseTime.second.getTimeoutCount());
+        EXPECT_GE(responseTime.second.getMaxResponseTime(), SLOW_PROVIDE_STATE_TIME);
+    }
+}
+
+/**
+ * Give a soft deadline to a @c StateProviderInterface which responds slowly to @c provideState requests, and to
+ * another one which never provided a state. Request for context by calling @c getContext. Expect that the context is
+ * returned before the slow @c StateProviderInterface responds, with its last state, without the state of the other
+ * one, and that both are counted as timeouts.
+ */
+TEST_F(ContextManagerTest, testSoftDeadlineUsesStaleState) {
+    m_alerts = MockStateProvider::create(
+        m_contextManager, ALERTS, ALERTS_PAYLOAD, StateRefreshPolicy::ALWAYS, TIMEOUT_SLEEP_TIME);
+    m_contextManager->setStateProvider(ALERTS, m_alerts);
+    ASSERT_EQ(
+        SetStateResult::SUCCESS, m_contextManager->setState(ALERTS, ALERTS_PAYLOAD, StateRefreshPolicy::ALWAYS));
+    m_contextManager->setStateProviderSoftDeadline(ALERTS, SOFT_DEADLINE);
+    auto dummyProvider = MockStateProvider::create(
+        m_contextManager, DUMMY_PROVIDER, ALERTS_PAYLOAD, StateRefreshPolicy::ALWAYS, TIMEOUT_SLEEP_TIME);
+    m_contextManager->setStateProvider(DUMMY_PROVIDER, dummyProvider);
+    m_contextManager->setStateProviderSoftDeadline(DUMMY_PROVIDER, SOFT_DEADLINE);
+
+    auto contextRequester = std::make_shared<CountingContextRequester>();
+    m_contextManager->getContext(contextRequester);
+    ASSERT_TRUE(contextRequester->waitForContextCount(1, TIMEOUT_SLEEP_TIME - SOFT_DEADLINE));
+    auto context = contextRequester->getContextString();
+    EXPECT_NE(std::string::npos, context.find(NAME_ALERTS_STATE));
+    EXPECT_EQ(std::string::npos, context.find(DUMMY_PROVIDER.name));
+
+    auto responseTimes = m_contextManager->getStateProviderResponseTimes();
+    EXPECT_EQ(1u, responseTimes[ALERTS].getTimeoutCount());
+    EXPECT_EQ(1u, responseTimes[DUMMY_PROVIDER].getTimeoutCount());
+    EXPECT_EQ(0u, responseTimes[ALERTS].getResponseCount());
+}
+
+/// Verify that response times are counted in the bucket of the smallest bound which is not below them.
+TEST(ResponseTimeHistogramTest, testBuckets) {
+    ResponseTimeHistogram histogram;
+    histogram.record(std::chrono::microseconds(500));
+    histogram.record(std::chrono::milliseconds(5));
+    histogram.record(std::chrono::microseconds(5001));
+    histogram.record(std::chrono::seconds(3));
+    histogram.recordTimeout();
+
+    auto& counts = histogram.getCounts();
+    EXPECT_EQ(1u, counts[0]);
+    EXPECT_EQ(1u, counts[2]);
+    EXPECT_EQ(1u, counts[3]);
+    EXPECT_EQ(1u, counts.back());
+    EXPECT_EQ(4u, histogram.getResponseCount());
+    EXPECT_EQ(1u, histogram.getTimeoutCount());
+    EXPECT_EQ(std::chrono::seconds(3), histogram.getMaxResponseTime());
+
+    std::stringstream stream;
+    stream << histogram;
+    EXPECT_EQ("<=1ms:1 <=5ms:1 <=10ms:1 >2000ms:1 timeouts:1", stream.str());
+}
+
+/**
+ * Record the latency of @c getContext against the number of state providers, both when no state has changed since the
+ * last context was built and when one state changes before each request.  The latencies are recorded as test
+ * properties.  Disabled by default.
+ */
+TEST(ContextManagerBenchmarkTest, DISABLED_benchmarkGetContextLatency) {
+    for (auto providerCount : BENCHMARK_PROVIDER_COUNTS) {
+        auto contextManager = ContextManager::create();
+        auto state = "{\"playerActivity\":\"IDLE\",\"offsetInMilliseconds\":0,\"token\":\"" +
+                     std::string(BENCHMARK_TOKEN_SIZE, 't') + "\"}";
+        for (int i = 0; i < providerCount; ++i) {
+            NamespaceAndName provider("Benchmark" + std::to_string(i), NAME_PLAYBACK_STATE);
+            ASSERT_EQ(SetStateResult::SUCCESS, contextManager->setState(provider, state, StateRefreshPolicy::NEVER));
+        }
+        NamespaceAndName changingProvider("Benchmark0", NAME_PLAYBACK_STATE);
+        auto contextRequester = std::make_shared<CountingContextRequester>();
+        int contextCount = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < BENCHMARK_ITERATIONS; ++i) {
+            contextManager->getContext(contextRequester);
+            ASSERT_TRUE(contextRequester->waitForContextCount(++contextCount));
+        }
+        auto unchangedElapsed = std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < BENCHMARK_ITERATIONS; ++i) {
+            auto changedState = i % 2 ? SPEECH_SYNTHESIZER_PAYLOAD_PLAYING : SPEECH_SYNTHESIZER_PAYLOAD_FINISHED;
+            contextManager->setState(changingProvider, changedState, StateRefreshPolicy::NEVER);
+            contextManager->getContext(contextRequester);
+            ASSERT_TRUE(contextRequester->waitForContextCount(++contextCount));
+        }
+        auto changedElapsed = std::chrono::steady_clock::now() - start;
+
+        auto microseconds = [](std::chrono::steady_clock::duration elapsed) {
+            return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+        };
+        auto label = "providers" + std::to_string(providerCount);
+        RecordProperty(label + "UnchangedUs", std::to_string(microseconds(unchangedElapsed) / BENCHMARK_ITERATIONS));
+        RecordProperty(label + "OneChangedUs", std::to_string(microseconds(changedElapsed) / BENCHMARK_ITERATIONS));
+    }
+}
+
+/**
+ * Report the latency of @c getContext with state providers which block in @c provideState, when their states are
+ * requested one after another and when they are requested concurrently.  The latencies and the response time
+ * histogram of each concurrently queried provider are recorded as test properties.  Disabled by default.
+ */
+TEST(ContextManagerBenchmarkTest, DISABLED_benchmarkSlowStateProviderFanOut) {
+    auto sequentialContextManager = ContextManager::create();
+    auto concurrentContextManager = ContextManager::create(ExecutorPool::create(POOL_THREADS));
+    auto delayTime = SLOW_PROVIDE_STATE_TIME / 5;
+    auto sequentialProviders = addBlockingStateProviders(sequentialContextManager, SLOW_PROVIDER_COUNT, delayTime);
+    auto concurrentProviders = addBlockingStateProviders(concurrentContextManager, SLOW_PROVIDER_COUNT, delayTime);
+
+    std::chrono::steady_clock::duration elapsed[2];
+    std::shared_ptr<ContextManager> contextManagers[2] = {sequentialContextManager, concurrentContextManager};
+    for (int i = 0; i < 2; ++i) {
+        auto contextRequester = std::make_shared<CountingContextRequester>();
+        auto start = std::chrono::steady_clock::now();
+        for (int count = 1; count <= BENCHMARK_ITERATIONS / 20; ++count) {
+            contextManagers[i]->getContext(contextRequester);
+            ASSERT_TRUE(contextRequester->waitForContextCount(count, delayTime * SLOW_PROVIDER_COUNT * 2));
+        }
+        elapsed[i] = (std::chrono::steady_clock::now() - start) / (BENCHMARK_ITERATIONS / 20);
+    }
+
+    RecordProperty(
+        "sequentialMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed[0]).count()));
+    RecordProperty(
+        "concurrentMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed[1]).count()));
+    for (auto& responseTime : concurrentContextManager->getStateProviderResponseTimes()) {
+        std::stringstream histogram;
+        histogram << responseTime.second;
+        RecordProperty(responseTime.first.nameSpace + "ResponseTimes", histogram.str());
+    }
+}
+
 }  // namespace test
 }  // namespace contextManager
 }  // namespace alexaClientSDK
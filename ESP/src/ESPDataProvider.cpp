@@ -12,6 +12,8 @@
  * express or implied. See the License for the specific language governing
  * permissions and limitations under the License.
  */
+#include <cstring>
+
 #include <AIP/AudioProvider.h>
 #include <AIP/ESPData.h>
 #include <AVSCommon/AVS/AudioInputStream.h>
@@ -108,15 +110,34 @@ void ESPDataProvider::espLoop() {
     bool hasErrorOccurred = false;
 
     while (!m_isShuttingDown) {
-        auto words = m_reader->read(&procBuff, numWords, TIMEOUT);
+        AudioInputStream::Span span;
+        auto words = m_reader->peek(&span, numWords, TIMEOUT);
 
         if (words > 0) {
-            // Call VAD and get frame energy
-            m_vad.process(procBuff, GVAD, currentFrameEnergy);
-            {
-                std::lock_guard<std::mutex> lock{m_mutex};
-                m_frameEnergyCompute.process(GVAD, currentFrameEnergy);
+            // Process the frame in place when it is contiguous in the stream, and only copy it when it wraps.
+            short* frame = reinterpret_cast<short*>(span.first);
+            if (span.firstWords < numWords) {
+                auto procBuff8 = reinterpret_cast<uint8_t*>(procBuff);
+                memcpy(procBuff8, span.first, span.firstWords * m_reader->getWordSize());
+                if (span.secondWords > 0) {
+                    memcpy(
+                        procBuff8 + span.firstWords * m_reader->getWordSize(),
+                        span.second,
+                        span.secondWords * m_reader->getWordSize());
+                }
+                frame = procBuff;
             }
+
+            // Call VAD and get frame energy
+            m_vad.process(frame, GVAD, currentFrameEnergy);
+
+            // If the frame was overwritten while we were processing it, its energy is meaningless.
+            words = m_reader->commit(words);
+        }
+
+        if (words > 0) {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_frameEnergyCompute.process(GVAD, currentFrameEnergy);
         } else {
             switch (words) {
                 case AudioInputStream::Reader::Error::CLOSED:
@@ -193,18 +193,30 @@ bool KittAiKeyWordDetector::isAudioFormatCompatibleWithKittAi(avsCommon::utils::
 
 void KittAiKeyWordDetector::detectionLoop() {
     notifyKeyWordDetectorStateObservers(KeyWordDetectorStateObserverInterface::KeyWordDetectorState::ACTIVE);
-    int16_t audioDataToPush[m_maxSamplesPerPush];
     ssize_t wordsRead;
     while (!m_isShuttingDown) {
         bool didErrorOccur;
-        wordsRead = readFromStream(
-            m_streamReader, m_stream, audioDataToPush, m_maxSamplesPerPush, TIMEOUT_FOR_READ_CALLS, &didErrorOccur);
+        AudioInputStream::Span span;
+        wordsRead = peekFromStream(
+            m_streamReader, m_stream, &span, m_maxSamplesPerPush, TIMEOUT_FOR_READ_CALLS, &didErrorOccur);
         if (didErrorOccur) {
             break;
         } else if (wordsRead > 0) {
             // Words were successfully read.
             notifyKeyWordDetectorStateObservers(KeyWordDetectorStateObserverInterface::KeyWordDetectorState::ACTIVE);
-            int detectionResult = m_kittAiEngine->RunDetection(audioDataToPush, wordsRead);
+            /*
+             * Run detection directly on the stream's buffer.  If the data wraps around the end of the buffer, only
+             * the first region is processed here, and the remainder is picked up on the next iteration.
+             */
+            int detectionResult =
+                m_kittAiEngine->RunDetection(reinterpret_cast<const int16_t*>(span.first), span.firstWords);
+            wordsRead = commitToStream(m_streamReader, m_stream, span.firstWords, &didErrorOccur);
+            if (didErrorOccur) {
+                break;
+            } else if (wordsRead < 0) {
+                // The audio was overwritten while it was being processed, so the result is not meaningful.
+                continue;
+            }
             if (detectionResult > 0) {
                 // > 0 indicates a keyword was found
                 if (m_detectionResultsToKeyWords.find(detectionResult) == m_detectionResultsToKeyWords.end()) {
@@ -20,6 +20,7 @@
 #include <string>
 #include <thread>
 #include <unordered_set>
+#include <vector>
 
 #include <AVSCommon/Utils/AudioFormat.h>
 #include <AVSCommon/AVS/AudioInputStream.h>
@@ -135,6 +136,13 @@ private:
      */
     avsCommon::avs::AudioInputStream::Index m_beginIndexOfStreamReader;
 
+    /**
+     * Detections reported by the engine for the data currently being processed in place.  Observers are only notified
+     * of these once the data has been committed without an overrun, since the writer may overwrite peeked data while
+     * the engine is running.  Only accessed from @c m_detectionThread.
+     */
+    std::vector<PendingDetection> m_pendingDetections;
+
     /// Internal thread that reads audio from the buffer and feeds it to the Sensory engine.
     std::thread m_detectionThread;
 
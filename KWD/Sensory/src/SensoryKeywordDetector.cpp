@@ -154,11 +154,10 @@ SnsrRC SensoryKeywordDetector::keyWordDetectedCallback(SnsrSession s, const char
         return result;
     }
 
-    engine->notifyKeyWordObservers(
-        engine->m_stream,
-        keyword,
-        engine->m_beginIndexOfStreamReader + begin,
-        engine->m_beginIndexOfStreamReader + end);
+    engine->m_pendingDetections.push_back(
+        {keyword,
+         engine->m_beginIndexOfStreamReader + static_cast<AudioInputStream::Index>(begin),
+         engine->m_beginIndexOfStreamReader + static_cast<AudioInputStream::Index>(end)});
     return SNSR_RC_OK;
 }
 
@@ -308,56 +307,31 @@ bool SensoryKeywordDetector::setUpRuntimeSettings(SnsrSession* session) {
 void SensoryKeywordDetector::detectionLoop() {
     m_beginIndexOfStreamReader = m_streamReader->tell();
     notifyKeyWordDetectorStateObservers(KeyWordDetectorStateObserverInterface::KeyWordDetectorState::ACTIVE);
-    std::vector<int16_t> audioDataToPush(m_maxSamplesPerPush);
     ssize_t wordsRead;
     SnsrRC result;
     while (!m_isShuttingDown) {
         bool didErrorOccur = false;
-        wordsRead = readFromStream(
-            m_streamReader,
-            m_stream,
-            audioDataToPush.data(),
-            audioDataToPush.size(),
-            TIMEOUT_FOR_READ_CALLS,
-            &didErrorOccur);
+        AudioInputStream::Span span;
+        wordsRead = peekFromStream(
+            m_streamReader, m_stream, &span, m_maxSamplesPerPush, TIMEOUT_FOR_READ_CALLS, &didErrorOccur);
         if (didErrorOccur) {
             /*
              * Note that this does not include the overrun condition, which the base class handles by instructing the
              * reader to seek to BEFORE_WRITER.
              */
             break;
-        } else if (wordsRead == AudioInputStream::Reader::Error::OVERRUN) {
+        } else if (wordsRead > 0) {
             /*
-             * Updating reference point of Reader so that new indices that get emitted to keyWordObservers can be
-             * relative to it.
+             * Words were successfully read.  Run them through the engine directly from the stream's buffer.  If the
+             * data wraps around the end of the buffer, only the first region is processed here, and the remainder is
+             * picked up on the next iteration.  Any keywords detected are only reported once the data has been
+             * committed, since the writer may overwrite it while the engine is running.
              */
-            m_beginIndexOfStreamReader = m_streamReader->tell();
-            SnsrSession newSession{nullptr};
-            /*
-             * This duplicated SnsrSession will have all the same configurations as m_session but none of the runtime
-             * settings. Thus, we will need to setup some of the runtime settings again. The reason for creating a new
-             * session is so that on overrun conditions, Sensory can start counting from 0 again.
-             */
-            result = snsrDup(m_session, &newSession);
-            if (result != SNSR_RC_OK) {
-                ACSDK_ERROR(LX("detectionLoopFailed")
-                                .d("reason", "sessionDuplicationFailed")
-                                .d("error", getSensoryDetails(newSession, result)));
-                break;
-            }
-
-            if (!setUpRuntimeSettings(&newSession)) {
-                break;
-            }
-
-            m_session = newSession;
-        } else if (wordsRead > 0) {
-            // Words were successfully read.
+            m_pendingDetections.clear();
             snsrSetStream(
                 m_session,
                 SNSR_SOURCE_AUDIO_PCM,
-                snsrStreamFromMemory(
-                    audioDataToPush.data(), wordsRead * sizeof(*audioDataToPush.data()), SNSR_ST_MODE_READ));
+                snsrStreamFromMemory(span.first, span.firstWords * m_streamReader->getWordSize(), SNSR_ST_MODE_READ));
             result = snsrRun(m_session);
             switch (result) {
                 case SNSR_RC_STREAM_END:
@@ -379,6 +353,38 @@ void SensoryKeywordDetector::detectionLoop() {
             if (didErrorOccur) {
                 break;
             }
+            wordsRead = commitToStreamAndNotify(
+                m_streamReader, m_stream, span.firstWords, m_pendingDetections, &didErrorOccur);
+            m_pendingDetections.clear();
+            if (didErrorOccur) {
+                break;
+            }
+        }
+        if (wordsRead == AudioInputStream::Reader::Error::OVERRUN) {
+            /*
+             * Updating reference point of Reader so that new indices that get emitted to keyWordObservers can be
+             * relative to it.
+             */
+            m_beginIndexOfStreamReader = m_streamReader->tell();
+            SnsrSession newSession{nullptr};
+            /*
+             * This duplicated SnsrSession will have all the same configurations as m_session but none of the runtime
+             * settings. Thus, we will need to setup some of the runtime settings again. The reason for creating a new
+             * session is so that on overrun conditions, Sensory can start counting from 0 again.
+             */
+            result = snsrDup(m_session, &newSession);
+            if (result != SNSR_RC_OK) {
+                ACSDK_ERROR(LX("detectionLoopFailed")
+                                .d("reason", "sessionDuplicationFailed")
+                                .d("error", getSensoryDetails(newSession, result)));
+                break;
+            }
+
+            if (!setUpRuntimeSettings(&newSession)) {
+                break;
+            }
+
+            m_session = newSession;
         }
         // Reset return code for next round
         snsrClearRC(m_session);
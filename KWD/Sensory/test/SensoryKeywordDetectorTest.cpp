@@ -15,6 +15,7 @@
 
 /// @file SensoryKeyWordDetectorTest.cpp
 
+#include <algorithm>
 #include <chrono>
 #include <fstream>
 #include <iostream>
@@ -81,6 +82,16 @@ std::vector<AudioInputStream::Index> BEGIN_INDICES_OF_ALEXAS_IN_ALEXA_STOP_ALEXA
 /// The approximate end indices of the two "Alexa" keywords in the alexa_stop_alexa_joke.wav file.
 std::vector<AudioInputStream::Index> END_INDICES_OF_ALEXAS_IN_ALEXA_STOP_ALEXA_JOKE_AUDIO_FILE = {20960, 51312};
 
+/// The number of words held by the stream used to test keywords which wrap around the end of the stream's buffer.
+static const size_t SMALL_STREAM_WORDS = 20000;
+
+/// The number of words written at a time when feeding audio to the detector in real time.
+static const size_t REAL_TIME_CHUNK_WORDS = 1600;
+
+/// The time represented by @c REAL_TIME_CHUNK_WORDS words of audio.
+static const std::chrono::milliseconds REAL_TIME_CHUNK_DURATION =
+    std::chrono::milliseconds(REAL_TIME_CHUNK_WORDS / SAMPLES_PER_MS);
+
 /// The compatible encoding for Sensory.
 static const avsCommon::utils::AudioFormat::Encoding COMPATIBLE_ENCODING =
     avsCommon::utils::AudioFormat::Encoding::LPCM;
@@ -560,6 +571,50 @@ TEST_F(SensoryKeywordTest, getExpectedNumberOfDetectionsInAlexaStopAlexaJokeAudi
     }
 }
 
+/**
+ * Tests that keywords are still reported, at the right indices, when the stream's buffer is small enough that the
+ * audio wraps around it several times.  The detector runs the engine directly on the stream's buffer and only reports
+ * a keyword once the audio it was detected in has been committed, so this exercises that deferred reporting across
+ * the wrap.
+ */
+TEST_F(SensoryKeywordTest, getExpectedNumberOfDetectionsInFourAlexasAudioFileWrappingSmallStream) {
+    auto fourAlexasBuffer = std::make_shared<avsCommon::avs::AudioInputStream::Buffer>(
+        avsCommon::avs::AudioInputStream::calculateBufferSize(SMALL_STREAM_WORDS, 2, 1));
+    auto fourAlexasSds = avsCommon::avs::AudioInputStream::create(fourAlexasBuffer, 2, 1);
+    std::shared_ptr<AudioInputStream> fourAlexasAudioBuffer = std::move(fourAlexasSds);
+
+    std::unique_ptr<AudioInputStream::Writer> fourAlexasAudioBufferWriter =
+        fourAlexasAudioBuffer->createWriter(avsCommon::avs::AudioInputStream::Writer::Policy::NONBLOCKABLE);
+
+    std::string audioFilePath = inputsDirPath + FOUR_ALEXAS_AUDIO_FILE;
+    bool error;
+    std::vector<int16_t> audioData = readAudioFromFile(audioFilePath, &error);
+    ASSERT_FALSE(error);
+    ASSERT_GT(audioData.size(), 2 * SMALL_STREAM_WORDS);
+
+    auto detector = SensoryKeywordDetector::create(
+        fourAlexasAudioBuffer, compatibleAudioFormat, {keyWordObserver1}, {stateObserver}, modelFilePath);
+    ASSERT_TRUE(detector);
+
+    // Feed the audio at the rate it would arrive from a microphone, so that the detector keeps up with the writer.
+    for (size_t offset = 0; offset < audioData.size(); offset += REAL_TIME_CHUNK_WORDS) {
+        size_t nWords = std::min(REAL_TIME_CHUNK_WORDS, audioData.size() - offset);
+        fourAlexasAudioBufferWriter->write(audioData.data() + offset, nWords);
+        std::this_thread::sleep_for(REAL_TIME_CHUNK_DURATION);
+    }
+
+    auto detections = keyWordObserver1->waitForNDetections(NUM_ALEXAS_IN_FOUR_ALEXAS_AUDIO_FILE, DEFAULT_TIMEOUT);
+    ASSERT_EQ(detections.size(), NUM_ALEXAS_IN_FOUR_ALEXAS_AUDIO_FILE);
+
+    for (unsigned int i = 0; i < NUM_ALEXAS_IN_FOUR_ALEXAS_AUDIO_FILE; ++i) {
+        ASSERT_TRUE(isResultPresent(
+            detections,
+            BEGIN_INDICES_OF_ALEXAS_IN_FOUR_ALEXAS_AUDIO_FILE.at(i),
+            END_INDICES_OF_ALEXAS_IN_FOUR_ALEXAS_AUDIO_FILE.at(i),
+            KEYWORD));
+    }
+}
+
 }  // namespace test
 }  // namespace kwd
 }  // namespace alexaClientSDK
@@ -17,7 +17,9 @@
 #define ALEXA_CLIENT_SDK_KWD_INCLUDE_KWD_ABSTRACTKEYWORDDETECTOR_H_
 
 #include <mutex>
+#include <string>
 #include <unordered_set>
+#include <vector>
 
 #include <AVSCommon/Utils/AudioFormat.h>
 #include <AVSCommon/AVS/AudioInputStream.h>
@@ -121,6 +123,74 @@ protected:
         std::chrono::milliseconds timeout,
         bool* errorOccurred);
 
+    /**
+     * Peeks at data in the specified stream without copying it, and does the same error checking and observer
+     * notifications as @c readFromStream().  The data must subsequently be consumed with @c commitToStream().
+     *
+     * @param reader The stream reader. This should be a blocking reader.
+     * @param stream The stream being read from.
+     * @param[out] span The location of the available data in the stream's buffer.
+     * @param nWords The maximum number of words to peek at.
+     * @param timeout The amount of time to wait for data to become available.
+     * @param[out] errorOccurred Lets caller know if there were any errors that occurred with the peek call.
+     * @return The number of words available in @c span.
+     */
+    ssize_t peekFromStream(
+        std::shared_ptr<avsCommon::avs::AudioInputStream::Reader> reader,
+        std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+        avsCommon::avs::AudioInputStream::Span* span,
+        size_t nWords,
+        std::chrono::milliseconds timeout,
+        bool* errorOccurred);
+
+    /**
+     * Consumes data previously returned by @c peekFromStream(), and does the same error checking and observer
+     * notifications as @c readFromStream().  If the data was overwritten while it was being processed, this returns
+     * @c AudioInputStream::Reader::Error::OVERRUN and the caller should discard any results derived from it.
+     *
+     * @param reader The stream reader.
+     * @param stream The stream being read from.
+     * @param nWords The number of words to consume.
+     * @param[out] errorOccurred Lets caller know if there were any errors that occurred with the commit call.
+     * @return The number of words consumed.
+     */
+    ssize_t commitToStream(
+        std::shared_ptr<avsCommon::avs::AudioInputStream::Reader> reader,
+        std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+        size_t nWords,
+        bool* errorOccurred);
+
+    /// A keyword detection made in data obtained with @c peekFromStream(), held back until that data is committed.
+    struct PendingDetection {
+        /// The detected keyword.
+        std::string keyword;
+
+        /// The stream index of the start of the keyword.
+        avsCommon::avs::AudioInputStream::Index beginIndex;
+
+        /// The stream index of the end of the keyword.
+        avsCommon::avs::AudioInputStream::Index endIndex;
+    };
+
+    /**
+     * Consumes data previously returned by @c peekFromStream() as @c commitToStream() does, and then notifies keyword
+     * observers of the detections made in that data.  If the data was overwritten while it was being processed, the
+     * detections are discarded rather than reported.
+     *
+     * @param reader The stream reader.
+     * @param stream The stream being read from.
+     * @param nWords The number of words to consume.
+     * @param detections The detections made in the data being consumed.
+     * @param[out] errorOccurred Lets caller know if there were any errors that occurred with the commit call.
+     * @return The number of words consumed.
+     */
+    ssize_t commitToStreamAndNotify(
+        std::shared_ptr<avsCommon::avs::AudioInputStream::Reader> reader,
+        std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+        size_t nWords,
+        const std::vector<PendingDetection>& detections,
+        bool* errorOccurred);
+
     /**
      * Checks to see if the @c audioFormat matches the platform endianness.
      *
@@ -130,6 +200,21 @@ protected:
     static bool isByteswappingRequired(avsCommon::utils::AudioFormat audioFormat);
 
 private:
+    /**
+     * Does the error checking and observer notifications for the result of a stream read, peek or commit.
+     *
+     * @param reader The stream reader.
+     * @param stream The stream being read from.
+     * @param wordsRead The value returned by the @c reader.
+     * @param[out] errorOccurred Lets caller know if @c wordsRead represents an error.
+     * @return @c wordsRead.
+     */
+    ssize_t checkReadResult(
+        std::shared_ptr<avsCommon::avs::AudioInputStream::Reader> reader,
+        std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+        ssize_t wordsRead,
+        bool* errorOccurred);
+
     /**
      * The observers to notify on key word detections. This should be locked with m_keyWordObserversMutex prior to
      * usage.
@@ -14,6 +14,7 @@
  */
 
 #include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Metrics/LatencyTracer.h>
 
 #include "KWD/AbstractKeywordDetector.h"
 
@@ -70,6 +71,7 @@ void AbstractKeywordDetector::notifyKeyWordObservers(
     AudioInputStream::Index beginIndex,
     AudioInputStream::Index endIndex,
     std::shared_ptr<const std::vector<char>> KWDMetadata) const {
+    avsCommon::utils::metrics::LatencyTracer::record(avsCommon::utils::metrics::TracePoint::KEYWORD_DETECTED);
     std::lock_guard<std::mutex> lock(m_keyWordObserversMutex);
     for (auto keyWordObserver : m_keyWordObservers) {
         keyWordObserver->onKeyWordDetected(stream, keyword, beginIndex, endIndex, KWDMetadata);
@@ -94,10 +96,54 @@ ssize_t AbstractKeywordDetector::readFromStream(
     size_t nWords,
     std::chrono::milliseconds timeout,
     bool* errorOccurred) {
+    return checkReadResult(reader, stream, reader->read(buf, nWords, timeout), errorOccurred);
+}
+
+ssize_t AbstractKeywordDetector::peekFromStream(
+    std::shared_ptr<avsCommon::avs::AudioInputStream::Reader> reader,
+    std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+    avsCommon::avs::AudioInputStream::Span* span,
+    size_t nWords,
+    std::chrono::milliseconds timeout,
+    bool* errorOccurred) {
+    return checkReadResult(reader, stream, reader->peek(span, nWords, timeout), errorOccurred);
+}
+
+ssize_t AbstractKeywordDetector::commitToStream(
+    std::shared_ptr<avsCommon::avs::AudioInputStream::Reader> reader,
+    std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+    size_t nWords,
+    bool* errorOccurred) {
+    return checkReadResult(reader, stream, reader->commit(nWords), errorOccurred);
+}
+
+ssize_t AbstractKeywordDetector::commitToStreamAndNotify(
+    std::shared_ptr<avsCommon::avs::AudioInputStream::Reader> reader,
+    std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+    size_t nWords,
+    const std::vector<PendingDetection>& detections,
+    bool* errorOccurred) {
+    auto wordsCommitted = commitToStream(reader, stream, nWords, errorOccurred);
+    if (wordsCommitted > 0) {
+        for (const auto& detection : detections) {
+            notifyKeyWordObservers(stream, detection.keyword, detection.beginIndex, detection.endIndex);
+        }
+    } else if (!detections.empty()) {
+        ACSDK_WARN(LX("detectionDiscarded")
+                       .d("reason", wordsCommitted < 0 ? "audioOverwrittenDuringDetection" : "streamClosed")
+                       .d("detections", detections.size()));
+    }
+    return wordsCommitted;
+}
+
+ssize_t AbstractKeywordDetector::checkReadResult(
+    std::shared_ptr<avsCommon::avs::AudioInputStream::Reader> reader,
+    std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+    ssize_t wordsRead,
+    bool* errorOccurred) {
     if (errorOccurred) {
         *errorOccurred = false;
     }
-    ssize_t wordsRead = reader->read(buf, nWords, timeout);
     // Stream has been closed
     if (wordsRead == 0) {
         ACSDK_DEBUG(LX("readFromStream").d("event", "streamClosed"));
@@ -17,6 +17,7 @@
 #include <gmock/gmock.h>
 
 #include <unordered_set>
+#include <vector>
 
 #include <AVSCommon/Utils/AudioFormat.h>
 #include <AVSCommon/AVS/AudioInputStream.h>
@@ -31,6 +32,21 @@ namespace test {
 
 using ::testing::_;
 
+/// The number of words in the stream used by the peek/commit tests.
+static const size_t STREAM_WORDS = 16;
+
+/// The size of each word in the stream used by the peek/commit tests.
+static const size_t STREAM_WORD_SIZE = 2;
+
+/// The number of words the peek/commit tests process at a time.
+static const size_t CHUNK_WORDS = 8;
+
+/// How long the peek/commit tests wait for data to become available.
+static const std::chrono::milliseconds PEEK_TIMEOUT(100);
+
+/// The keyword reported by the peek/commit tests.
+static const std::string KEYWORD = "ALEXA";
+
 /// A test observer that mocks out the KeyWordObserverInterface##onKeyWordDetected() call.
 class MockKeyWordObserver : public avsCommon::sdkInterfaces::KeyWordObserverInterface {
 public:
@@ -74,6 +90,39 @@ public:
         avsCommon::sdkInterfaces::KeyWordDetectorStateObserverInterface::KeyWordDetectorState state) {
         notifyKeyWordDetectorStateObservers(state);
     };
+
+    /// Exposes @c AbstractKeywordDetector::peekFromStream() to the tests.
+    ssize_t peek(
+        std::shared_ptr<avsCommon::avs::AudioInputStream::Reader> reader,
+        std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+        avsCommon::avs::AudioInputStream::Span* span,
+        size_t nWords,
+        bool* errorOccurred) {
+        return peekFromStream(reader, stream, span, nWords, PEEK_TIMEOUT, errorOccurred);
+    }
+
+    /// Exposes @c AbstractKeywordDetector::commitToStreamAndNotify() to the tests.
+    ssize_t commitAndNotify(
+        std::shared_ptr<avsCommon::avs::AudioInputStream::Reader> reader,
+        std::shared_ptr<avsCommon::avs::AudioInputStream> stream,
+        size_t nWords,
+        const std::vector<PendingDetection>& detections,
+        bool* errorOccurred) {
+        return commitToStreamAndNotify(reader, stream, nWords, detections, errorOccurred);
+    }
+
+    /**
+     * Builds a detection for the tests, since @c PendingDetection is not accessible outside the detector.
+     *
+     * @param beginIndex The stream index of the start of the keyword.
+     * @param endIndex The stream index of the end of the keyword.
+     * @return A list holding the one detection.
+     */
+    static std::vector<PendingDetection> detection(
+        avsCommon::avs::AudioInputStream::Index beginIndex,
+        avsCommon::avs::AudioInputStream::Index endIndex) {
+        return {{KEYWORD, beginIndex, endIndex}};
+    }
 };
 
 class AbstractKeyWordDetectorTest : public ::testing::Test {
@@ -83,6 +132,9 @@ protected:
     std::shared_ptr<MockKeyWordObserver> keyWordObserver2;
     std::shared_ptr<MockStateObserver> stateObserver1;
     std::shared_ptr<MockStateObserver> stateObserver2;
+    std::shared_ptr<avsCommon::avs::AudioInputStream> stream;
+    std::shared_ptr<avsCommon::avs::AudioInputStream::Writer> writer;
+    std::shared_ptr<avsCommon::avs::AudioInputStream::Reader> reader;
 
     virtual void SetUp() {
         detector = std::make_shared<MockKeyWordDetector>();
@@ -90,6 +142,17 @@ protected:
         keyWordObserver2 = std::make_shared<MockKeyWordObserver>();
         stateObserver1 = std::make_shared<MockStateObserver>();
         stateObserver2 = std::make_shared<MockStateObserver>();
+        auto buffer = std::make_shared<avsCommon::avs::AudioInputStream::Buffer>(
+            avsCommon::avs::AudioInputStream::calculateBufferSize(STREAM_WORDS, STREAM_WORD_SIZE));
+        stream = avsCommon::avs::AudioInputStream::create(buffer, STREAM_WORD_SIZE);
+        writer = stream->createWriter(avsCommon::avs::AudioInputStream::Writer::Policy::NONBLOCKABLE);
+        reader = stream->createReader(avsCommon::avs::AudioInputStream::Reader::Policy::BLOCKING);
+    }
+
+    /// Writes @c CHUNK_WORDS words of silence to @c stream.
+    void writeChunk() {
+        std::vector<int16_t> samples(CHUNK_WORDS, 0);
+        ASSERT_EQ(static_cast<ssize_t>(CHUNK_WORDS), writer->write(samples.data(), samples.size()));
     }
 };
 
@@ -171,6 +234,54 @@ TEST_F(AbstractKeyWordDetectorTest, testObserversDontGetNotifiedOfSameStateTwice
         avsCommon::sdkInterfaces::KeyWordDetectorStateObserverInterface::KeyWordDetectorState::ACTIVE);
 }
 
+/**
+ * Verify that detections made in peeked data are reported once the data has been committed.
+ */
+TEST_F(AbstractKeyWordDetectorTest, testDetectionsReportedAfterCommit) {
+    detector->addKeyWordObserver(keyWordObserver1);
+    writeChunk();
+
+    bool errorOccurred = true;
+    avsCommon::avs::AudioInputStream::Span span;
+    ASSERT_EQ(static_cast<ssize_t>(CHUNK_WORDS), detector->peek(reader, stream, &span, CHUNK_WORDS, &errorOccurred));
+    ASSERT_FALSE(errorOccurred);
+
+    EXPECT_CALL(*keyWordObserver1, onKeyWordDetected(stream, KEYWORD, 2, 6, _)).Times(1);
+    EXPECT_EQ(
+        static_cast<ssize_t>(CHUNK_WORDS),
+        detector->commitAndNotify(
+            reader, stream, span.firstWords, MockKeyWordDetector::detection(2, 6), &errorOccurred));
+    EXPECT_FALSE(errorOccurred);
+    EXPECT_EQ(CHUNK_WORDS, reader->tell());
+}
+
+/**
+ * Verify that detections made in peeked data are discarded if the writer overwrites that data before it is committed,
+ * and that the reader is moved up to the writer.
+ */
+TEST_F(AbstractKeyWordDetectorTest, testDetectionsInOverwrittenAudioDiscarded) {
+    detector->addKeyWordObserver(keyWordObserver1);
+    writeChunk();
+
+    bool errorOccurred = true;
+    avsCommon::avs::AudioInputStream::Span span;
+    ASSERT_EQ(static_cast<ssize_t>(CHUNK_WORDS), detector->peek(reader, stream, &span, CHUNK_WORDS, &errorOccurred));
+    ASSERT_FALSE(errorOccurred);
+
+    // Wrap around the whole buffer while the peeked data is being "processed".
+    for (size_t written = 0; written < STREAM_WORDS; written += CHUNK_WORDS) {
+        writeChunk();
+    }
+
+    EXPECT_CALL(*keyWordObserver1, onKeyWordDetected(_, _, _, _, _)).Times(0);
+    EXPECT_EQ(
+        avsCommon::avs::AudioInputStream::Reader::Error::OVERRUN,
+        detector->commitAndNotify(
+            reader, stream, span.firstWords, MockKeyWordDetector::detection(2, 6), &errorOccurred));
+    EXPECT_FALSE(errorOccurred);
+    EXPECT_EQ(0u, reader->tell(avsCommon::avs::AudioInputStream::Reader::Reference::BEFORE_WRITER));
+}
+
 }  // namespace test
 }  // namespace kwd
 }  // namespace alexaClientSDK
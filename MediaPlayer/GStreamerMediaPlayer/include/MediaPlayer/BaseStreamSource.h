@@ -52,9 +52,11 @@ protected:
      * callbacks for signals should be handled.
      *
      * @param audioFormat The audioFormat to be used when playing raw PCM data.
+     * @param decode Whether to create a decoder.  When @c false, which requires @c audioFormat, the appsrc element is
+     * left unlinked for the owner of the @c AudioPipeline to link to the element after the decoder.
      * @return @c true if the initialization was successful else @c false.
      */
-    bool init(const avsCommon::utils::AudioFormat* audioFormat = nullptr);
+    bool init(const avsCommon::utils::AudioFormat* audioFormat = nullptr, bool decode = true);
 
     /**
      * Return whether the audio source is still open.
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_MEDIAPLAYER_GSTREAMERMEDIAPLAYER_INCLUDE_MEDIAPLAYER_DECODEDAUDIOCACHE_H_
+#define ALEXA_CLIENT_SDK_MEDIAPLAYER_GSTREAMERMEDIAPLAYER_INCLUDE_MEDIAPLAYER_DECODEDAUDIOCACHE_H_
+
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <AVSCommon/SDKInterfaces/Audio/AudioFactoryInterface.h>
+#include <AVSCommon/Utils/AudioFormat.h>
+#include <AVSCommon/Utils/Threading/Executor.h>
+
+namespace alexaClientSDK {
+namespace mediaPlayer {
+
+/**
+ * A cache of built-in audio, such as alert tones and earcons, decoded to PCM once so that a @c MediaPlayer does not
+ * decode it again each time it is played or repeated.
+ *
+ * The audio is registered with @c prefetch() as the factories which produce its streams.  Only the streams created by
+ * @c avsCommon::utils::stream::streamFromData() are cached: they are recognized by the data they read from, which
+ * must outlive the cache, as the data embedded in the SDK does.  A @c MediaPlayer which was given the cache plays
+ * the streams it recognizes from their PCM, and decodes the others as usual.
+ *
+ * The PCM is 16-bit signed little-endian interleaved samples, at the rate and with the channels of the audio.
+ *
+ * This class is thread-safe.
+ */
+class DecodedAudioCache {
+public:
+    /// Audio decoded to PCM.
+    struct DecodedAudio {
+        /// The format of @c samples.
+        avsCommon::utils::AudioFormat format;
+
+        /// The samples.
+        std::vector<uint8_t> samples;
+    };
+
+    /// A factory which produces streams of audio.
+    using AudioFactory = std::function<std::unique_ptr<std::istream>()>;
+
+    /**
+     * Creates a cache.
+     *
+     * @param maxSizeInBytes The largest number of bytes of PCM the cache may hold.  Audio which would exceed it is not
+     * cached.
+     * @return The cache, or @c nullptr if GStreamer could not be initialized.
+     */
+    static std::shared_ptr<DecodedAudioCache> create(size_t maxSizeInBytes = DEFAULT_MAX_SIZE_IN_BYTES);
+
+    /**
+     * Destructor.  Audio which has not been decoded yet is abandoned.
+     */
+    ~DecodedAudioCache();
+
+    /**
+     * Decodes audio in the background, skipping the audio which is already cached.
+     *
+     * @param audioFactories The factories of the audio.
+     * @return A future which is @c true when all of the audio is cached, and @c false if any of it could not be.
+     */
+    std::future<bool> prefetch(const std::vector<AudioFactory>& audioFactories);
+
+    /**
+     * Decodes all of the audio of an @c AudioFactoryInterface in the background.
+     *
+     * @param audioFactory The factory of the audio.
+     * @return A future which is @c true when all of the audio is cached, and @c false if any of it could not be.
+     */
+    std::future<bool> prefetch(std::shared_ptr<avsCommon::sdkInterfaces::audio::AudioFactoryInterface> audioFactory);
+
+    /**
+     * Gets the PCM of a stream.
+     *
+     * @param stream The stream.
+     * @return The PCM of the audio of @c stream, or @c nullptr if it is not cached.
+     */
+    std::shared_ptr<const DecodedAudio> get(const std::istream& stream) const;
+
+    /// The default largest number of bytes of PCM the cache may hold.
+    static const size_t DEFAULT_MAX_SIZE_IN_BYTES;
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param maxSizeInBytes The largest number of bytes of PCM the cache may hold.
+     */
+    DecodedAudioCache(size_t maxSizeInBytes);
+
+    /**
+     * Decodes and caches the audio of a factory, unless it is already cached.  Called on @c m_executor.
+     *
+     * @param audioFactory The factory of the audio.
+     * @return Whether the audio is cached.
+     */
+    bool decode(const AudioFactory& audioFactory);
+
+    /// The largest number of bytes of PCM the cache may hold.
+    const size_t m_maxSizeInBytes;
+
+    /// Serializes access to the members below.
+    mutable std::mutex m_mutex;
+
+    /// The PCM of the audio, by the data its streams read from.
+    std::unordered_map<const unsigned char*, std::shared_ptr<const DecodedAudio>> m_entries;
+
+    /// The number of bytes of PCM in the cache.
+    size_t m_sizeInBytes;
+
+    /// Decodes audio one at a time.  It is declared last so that it is shut down before the other members are freed.
+    avsCommon::utils::threading::Executor m_executor;
+};
+
+}  // namespace mediaPlayer
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_MEDIAPLAYER_GSTREAMERMEDIAPLAYER_INCLUDE_MEDIAPLAYER_DECODEDAUDIOCACHE_H_
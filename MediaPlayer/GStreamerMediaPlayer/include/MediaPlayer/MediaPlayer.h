@@ -38,6 +38,7 @@
 #include <AVSCommon/Utils/PlaylistParser/PlaylistParserInterface.h>
 #include <PlaylistParser/UrlContentToAttachmentConverter.h>
 
+#include "MediaPlayer/DecodedAudioCache.h"
 #include "MediaPlayer/OffsetManager.h"
 #include "MediaPlayer/PipelineInterface.h"
 #include "MediaPlayer/SourceInterface.h"
@@ -66,6 +67,8 @@ public:
      * @param enableEqualizer Flag, indicating whether equalizer should be enabled for this instance.
      * @param type The type used to categorize the speaker for volume control.
      * @param name Readable name for the new instance.
+     * @param decodedAudioCache The optional cache of decoded audio, from which the streams it recognizes are played
+     * without being decoded.
      * @return An instance of the @c MediaPlayer if successful else a @c nullptr.
      */
     static std::shared_ptr<MediaPlayer> create(
@@ -74,7 +77,8 @@ public:
         bool enableEqualizer = false,
         avsCommon::sdkInterfaces::SpeakerInterface::Type type =
             avsCommon::sdkInterfaces::SpeakerInterface::Type::AVS_SPEAKER_VOLUME,
-        std::string name = "");
+        std::string name = "",
+        std::shared_ptr<DecodedAudioCache> decodedAudioCache = nullptr);
 
     /**
      * Destructor.
@@ -198,12 +202,14 @@ private:
      * @param enableEqualizer Flag, indicating whether equalizer should be enabled for this instance.
      * @param type The type used to categorize the speaker for volume control.
      * @param name Readable name of this instance.
+     * @param decodedAudioCache The optional cache of decoded audio.
      */
     MediaPlayer(
         std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory,
         bool enableEqualizer,
         avsCommon::sdkInterfaces::SpeakerInterface::Type type,
-        std::string name);
+        std::string name,
+        std::shared_ptr<DecodedAudioCache> decodedAudioCache);
 
     /**
      * The worker loop to run the glib mainloop.
@@ -333,6 +339,19 @@ private:
      */
     void handleSetIStreamSource(std::shared_ptr<std::istream> stream, bool repeat, std::promise<SourceId>* promise);
 
+    /**
+     * Worker thread handler for setting decoded audio as the source of audio to play.  The appsrc is linked to the
+     * decodedQueue directly.
+     *
+     * @param audio The decoded audio to play.
+     * @param repeat Whether the audio should be played in a loop until stopped.
+     * @param promise A promise to fulfill with a @c SourceId value once the source has been set.
+     */
+    void handleSetPCMSource(
+        std::shared_ptr<const DecodedAudioCache::DecodedAudio> audio,
+        bool repeat,
+        std::promise<SourceId>* promise);
+
     /**
      * Internal method to update the volume according to a gstreamer bug fix
      * https://bugzilla.gnome.org/show_bug.cgi?id=793081
@@ -552,6 +571,9 @@ private:
     /// Used to create objects that can fetch remote HTTP content.
     std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> m_contentFetcherFactory;
 
+    /// The cache of decoded audio, or @c nullptr if every stream is decoded.
+    std::shared_ptr<DecodedAudioCache> m_decodedAudioCache;
+
     /// Flag indicating if equalizer is enabled for this Media Player
     bool m_equalizerEnabled;
 
@@ -0,0 +1,113 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_MEDIAPLAYER_GSTREAMERMEDIAPLAYER_INCLUDE_MEDIAPLAYER_PCMSOURCE_H_
+#define ALEXA_CLIENT_SDK_MEDIAPLAYER_GSTREAMERMEDIAPLAYER_INCLUDE_MEDIAPLAYER_PCMSOURCE_H_
+
+#include <memory>
+
+#include <gst/gst.h>
+#include <gst/app/gstappsrc.h>
+
+#include "MediaPlayer/BaseStreamSource.h"
+#include "MediaPlayer/DecodedAudioCache.h"
+
+namespace alexaClientSDK {
+namespace mediaPlayer {
+
+/**
+ * A source which plays audio decoded by a @c DecodedAudioCache.  The samples are pushed without being copied into an
+ * appsrc whose caps are those of the PCM, and the appsrc is linked to the @c decodedQueue of the @c AudioPipeline
+ * directly: no decoder is created, and the type of the audio is not found again each time it is played.
+ */
+class PCMSource : public BaseStreamSource {
+public:
+    /**
+     * Create a PCM source.
+     *
+     * @param pipeline The @c PipelineInterface through which the source of the @c AudioPipeline may be set.
+     * @param audio The decoded audio to play.
+     * @param repeat Whether the audio should be replayed until stopped.
+     */
+    static std::unique_ptr<PCMSource> create(
+        PipelineInterface* pipeline,
+        std::shared_ptr<const DecodedAudioCache::DecodedAudio> audio,
+        bool repeat);
+
+    /**
+     * Destructor.
+     */
+    ~PCMSource() override;
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param pipeline The @c PipelineInterface through which the source of the @c AudioPipeline may be set.
+     * @param audio The decoded audio to play.
+     * @param repeat Whether the audio should be replayed until stopped.
+     */
+    PCMSource(
+        PipelineInterface* pipeline,
+        std::shared_ptr<const DecodedAudioCache::DecodedAudio> audio,
+        bool repeat);
+
+    /// @name Overridden SourceInterface methods.
+    /// @{
+    bool isPlaybackRemote() const override;
+    bool hasAdditionalData() override;
+    /// @}
+
+    /// @name RequiresShutdown Functions
+    /// @{
+    void doShutdown() override{};
+    /// @}
+
+    /// @name Overridden BaseStreamSource methods.
+    /// @{
+    bool isOpen() override;
+    void close() override;
+    gboolean handleReadData() override;
+    gboolean handleSeekData(guint64 offset) override;
+    /// @}
+
+    /**
+     * Converts a number of bytes of the audio to its duration.
+     *
+     * @param bytes The number of bytes.
+     * @return The duration, in nanoseconds.
+     */
+    guint64 bytesToTime(guint64 bytes) const;
+
+    /// The audio to play.
+    std::shared_ptr<const DecodedAudioCache::DecodedAudio> m_audio;
+
+    /// Play the audio over and over until told to stop.
+    bool m_repeat;
+
+    /// The number of bytes in a frame of the audio.
+    size_t m_bytesPerFrame;
+
+    /// The offset in the samples of the audio of the next bytes to push.
+    size_t m_offset;
+
+    /// The position in the stream of the next bytes to push, which keeps growing as the audio is repeated.
+    guint64 m_position;
+};
+
+}  // namespace mediaPlayer
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_MEDIAPLAYER_GSTREAMERMEDIAPLAYER_INCLUDE_MEDIAPLAYER_PCMSOURCE_H_
@@ -125,7 +125,12 @@ BaseStreamSource::~BaseStreamSource() {
     uninstallOnReadDataHandler();
 }
 
-bool BaseStreamSource::init(const AudioFormat* audioFormat) {
+bool BaseStreamSource::init(const AudioFormat* audioFormat, bool decode) {
+    if (!decode && !audioFormat) {
+        ACSDK_ERROR(LX("initFailed").d("reason", "noAudioFormatWithoutDecoder"));
+        return false;
+    }
+
     auto appsrc = reinterpret_cast<GstAppSrc*>(gst_element_factory_make("appsrc", "src"));
     if (!appsrc) {
         ACSDK_ERROR(LX("initFailed").d("reason", "createSourceElementFailed"));
@@ -153,8 +158,11 @@ bool BaseStreamSource::init(const AudioFormat* audioFormat) {
         ACSDK_DEBUG9(LX("initNoAudioFormat"));
     }
 
-    auto decoder = gst_element_factory_make("decodebin", "decoder");
-    if (!decoder) {
+    GstElement* decoder = nullptr;
+    if (decode) {
+        decoder = gst_element_factory_make("decodebin", "decoder");
+    }
+    if (decode && !decoder) {
         ACSDK_ERROR(LX("initFailed").d("reason", "createDecoderElementFailed"));
         return false;
     }
@@ -169,7 +177,7 @@ bool BaseStreamSource::init(const AudioFormat* audioFormat) {
         return false;
     }
 
-    if (!gst_bin_add(GST_BIN(m_pipeline->getPipeline()), decoder)) {
+    if (decoder && !gst_bin_add(GST_BIN(m_pipeline->getPipeline()), decoder)) {
         ACSDK_ERROR(LX("initFailed").d("reason", "addingDecoderToPipelineFailed"));
         return false;
     }
@@ -179,7 +187,7 @@ bool BaseStreamSource::init(const AudioFormat* audioFormat) {
      * stream type it is decoding. Once the pad has been added, pad-added signal is emitted, and the padAddedHandler
      * callback will link the newly created source pad of the decoder to the sink of the converter element.
      */
-    if (!gst_element_link(reinterpret_cast<GstElement*>(appsrc), decoder)) {
+    if (decoder && !gst_element_link(reinterpret_cast<GstElement*>(appsrc), decoder)) {
         ACSDK_ERROR(LX("initFailed").d("reason", "createSourceToDecoderLinkFailed"));
         return false;
     }
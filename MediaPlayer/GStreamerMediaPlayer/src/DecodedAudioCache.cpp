@@ -0,0 +1,316 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+
+#include <gst/gst.h>
+#include <gst/app/gstappsink.h>
+#include <gst/app/gstappsrc.h>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Stream/StreamFunctions.h>
+
+#include "MediaPlayer/DecodedAudioCache.h"
+
+namespace alexaClientSDK {
+namespace mediaPlayer {
+
+using namespace avsCommon::sdkInterfaces::audio;
+using namespace avsCommon::utils;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("DecodedAudioCache");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/**
+ * The pipeline which decodes audio.  The samples are converted to the format of @c DecodedAudio, and the sink does
+ * not synchronize to the clock, so that the audio is decoded as fast as possible.
+ */
+static const char DECODER_PIPELINE_DESCRIPTION[] =
+    "appsrc name=src ! decodebin ! audioconvert ! audio/x-raw,format=S16LE,layout=interleaved ! "
+    "appsink name=sink sync=false";
+
+/// The size of the samples of @c DecodedAudio, in bits.
+static const unsigned int SAMPLE_SIZE_IN_BITS = 16;
+
+/// How long to wait for audio to be decoded.
+static const std::chrono::seconds DECODE_TIMEOUT(10);
+
+const size_t DecodedAudioCache::DEFAULT_MAX_SIZE_IN_BYTES = 16 * 1024 * 1024;
+
+/// The state of the decoding of one piece of audio, shared with the appsink callback.
+struct DecodeContext {
+    /// The audio being decoded.
+    std::shared_ptr<DecodedAudioCache::DecodedAudio> audio;
+
+    /// The largest number of bytes of PCM the audio may have.
+    size_t maxSizeInBytes;
+
+    /// Whether the audio turned out to be larger than @c maxSizeInBytes.
+    bool isTooLarge;
+};
+
+/**
+ * The appsink callback which collects the decoded samples.
+ *
+ * @param sink The appsink element.
+ * @param pointer The @c DecodeContext.
+ * @return @c GST_FLOW_OK, or @c GST_FLOW_ERROR to stop decoding audio which is too large or has no format.
+ */
+static GstFlowReturn onNewSample(GstAppSink* sink, gpointer pointer) {
+    auto context = static_cast<DecodeContext*>(pointer);
+    auto sample = gst_app_sink_pull_sample(sink);
+    if (!sample) {
+        return GST_FLOW_ERROR;
+    }
+
+    if (0 == context->audio->format.sampleRateHz) {
+        gint rate = 0;
+        gint channels = 0;
+        auto caps = gst_sample_get_caps(sample);
+        auto structure = caps ? gst_caps_get_structure(caps, 0) : nullptr;
+        if (!structure || !gst_structure_get_int(structure, "rate", &rate) ||
+            !gst_structure_get_int(structure, "channels", &channels) || rate <= 0 || channels <= 0) {
+            ACSDK_ERROR(LX("onNewSampleFailed").d("reason", "noAudioFormat"));
+            gst_sample_unref(sample);
+            return GST_FLOW_ERROR;
+        }
+        context->audio->format.sampleRateHz = rate;
+        context->audio->format.numChannels = channels;
+    }
+
+    auto buffer = gst_sample_get_buffer(sample);
+    GstMapInfo info;
+    if (!buffer || !gst_buffer_map(buffer, &info, GST_MAP_READ)) {
+        ACSDK_ERROR(LX("onNewSampleFailed").d("reason", "gstBufferMapFailed"));
+        gst_sample_unref(sample);
+        return GST_FLOW_ERROR;
+    }
+    auto& samples = context->audio->samples;
+    if (samples.size() + info.size > context->maxSizeInBytes) {
+        context->isTooLarge = true;
+    } else {
+        samples.insert(samples.end(), info.data, info.data + info.size);
+    }
+    gst_buffer_unmap(buffer, &info);
+    gst_sample_unref(sample);
+    return context->isTooLarge ? GST_FLOW_ERROR : GST_FLOW_OK;
+}
+
+/**
+ * Decodes audio to PCM.
+ *
+ * @param data The encoded audio.
+ * @param length The length of @c data.
+ * @param maxSizeInBytes The largest number of bytes of PCM the audio may have.
+ * @return The PCM of the audio, or @c nullptr if it could not be decoded.
+ */
+static std::shared_ptr<DecodedAudioCache::DecodedAudio> decodeData(
+    const unsigned char* data,
+    size_t length,
+    size_t maxSizeInBytes) {
+    GError* error = nullptr;
+    auto pipeline = gst_parse_launch(DECODER_PIPELINE_DESCRIPTION, &error);
+    if (error) {
+        ACSDK_ERROR(LX("decodeDataFailed").d("reason", "gstParseLaunchFailed").d("error", error->message));
+        g_error_free(error);
+        if (pipeline) {
+            gst_object_unref(pipeline);
+        }
+        return nullptr;
+    }
+
+    DecodeContext context;
+    context.audio = std::make_shared<DecodedAudioCache::DecodedAudio>();
+    context.audio->format = {AudioFormat::Encoding::LPCM,
+                             AudioFormat::Endianness::LITTLE,
+                             0,
+                             SAMPLE_SIZE_IN_BITS,
+                             0,
+                             true,
+                             AudioFormat::Layout::INTERLEAVED};
+    context.maxSizeInBytes = maxSizeInBytes;
+    context.isTooLarge = false;
+
+    auto src = gst_bin_get_by_name(GST_BIN(pipeline), "src");
+    auto sink = gst_bin_get_by_name(GST_BIN(pipeline), "sink");
+    GstAppSinkCallbacks callbacks = {};
+    callbacks.new_sample = &onNewSample;
+    gst_app_sink_set_callbacks(GST_APP_SINK(sink), &callbacks, &context, nullptr);
+
+    bool decoded = GST_STATE_CHANGE_FAILURE != gst_element_set_state(pipeline, GST_STATE_PLAYING);
+    if (decoded) {
+        // The data outlives the pipeline, so it is pushed in one buffer without being copied.
+        auto buffer = gst_buffer_new_wrapped_full(
+            GST_MEMORY_FLAG_READONLY, const_cast<unsigned char*>(data), length, 0, length, nullptr, nullptr);
+        decoded = GST_FLOW_OK == gst_app_src_push_buffer(GST_APP_SRC(src), buffer) &&
+                  GST_FLOW_OK == gst_app_src_end_of_stream(GST_APP_SRC(src));
+    }
+
+    if (decoded) {
+        auto bus = gst_element_get_bus(pipeline);
+        auto message = gst_bus_timed_pop_filtered(
+            bus,
+            std::chrono::duration_cast<std::chrono::nanoseconds>(DECODE_TIMEOUT).count(),
+            static_cast<GstMessageType>(GST_MESSAGE_EOS | GST_MESSAGE_ERROR));
+        if (!message) {
+            ACSDK_ERROR(LX("decodeDataFailed").d("reason", "timedOut"));
+            decoded = false;
+        } else if (GST_MESSAGE_ERROR == GST_MESSAGE_TYPE(message)) {
+            GError* decodeError = nullptr;
+            gchar* debug = nullptr;
+            gst_message_parse_error(message, &decodeError, &debug);
+            ACSDK_ERROR(LX("decodeDataFailed")
+                            .d("reason", context.isTooLarge ? "tooLarge" : "decodeError")
+                            .d("error", decodeError ? decodeError->message : "noInfo"));
+            g_clear_error(&decodeError);
+            g_free(debug);
+            decoded = false;
+        }
+        if (message) {
+            gst_message_unref(message);
+        }
+        gst_object_unref(bus);
+    } else {
+        ACSDK_ERROR(LX("decodeDataFailed").d("reason", "startPipelineFailed"));
+    }
+
+    gst_element_set_state(pipeline, GST_STATE_NULL);
+    gst_object_unref(sink);
+    gst_object_unref(src);
+    gst_object_unref(pipeline);
+
+    if (!decoded || context.audio->samples.empty()) {
+        return nullptr;
+    }
+    return context.audio;
+}
+
+std::shared_ptr<DecodedAudioCache> DecodedAudioCache::create(size_t maxSizeInBytes) {
+    if (false == gst_init_check(NULL, NULL, NULL)) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "gstInitCheckFailed"));
+        return nullptr;
+    }
+    return std::shared_ptr<DecodedAudioCache>(new DecodedAudioCache(maxSizeInBytes));
+}
+
+DecodedAudioCache::DecodedAudioCache(size_t maxSizeInBytes) : m_maxSizeInBytes{maxSizeInBytes}, m_sizeInBytes{0} {
+}
+
+DecodedAudioCache::~DecodedAudioCache() {
+    m_executor.shutdown();
+}
+
+std::future<bool> DecodedAudioCache::prefetch(const std::vector<AudioFactory>& audioFactories) {
+    return m_executor.submit([this, audioFactories]() {
+        bool allCached = true;
+        for (auto& audioFactory : audioFactories) {
+            if (!decode(audioFactory)) {
+                allCached = false;
+            }
+        }
+        return allCached;
+    });
+}
+
+std::future<bool> DecodedAudioCache::prefetch(std::shared_ptr<AudioFactoryInterface> audioFactory) {
+    if (!audioFactory) {
+        ACSDK_ERROR(LX("prefetchFailed").d("reason", "nullAudioFactory"));
+        std::promise<bool> promise;
+        promise.set_value(false);
+        return promise.get_future();
+    }
+    std::vector<AudioFactory> audioFactories;
+    if (auto alerts = audioFactory->alerts()) {
+        audioFactories.push_back(alerts->alarmDefault());
+        audioFactories.push_back(alerts->alarmShort());
+        audioFactories.push_back(alerts->timerDefault());
+        audioFactories.push_back(alerts->timerShort());
+        audioFactories.push_back(alerts->reminderDefault());
+        audioFactories.push_back(alerts->reminderShort());
+    }
+    if (auto notifications = audioFactory->notifications()) {
+        audioFactories.push_back(notifications->notificationDefault());
+    }
+    if (auto communications = audioFactory->communications()) {
+        audioFactories.push_back(communications->callConnectedRingtone());
+        audioFactories.push_back(communications->callDisconnectedRingtone());
+        audioFactories.push_back(communications->outboundRingtone());
+        audioFactories.push_back(communications->dropInConnectedRingtone());
+        audioFactories.push_back(communications->callIncomingRingtone());
+    }
+    return prefetch(audioFactories);
+}
+
+std::shared_ptr<const DecodedAudioCache::DecodedAudio> DecodedAudioCache::get(const std::istream& stream) const {
+    const unsigned char* data = nullptr;
+    size_t length = 0;
+    if (!stream::dataFromStream(stream, &data, &length)) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(data);
+    if (it == m_entries.end()) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+bool DecodedAudioCache::decode(const AudioFactory& audioFactory) {
+    auto stream = audioFactory ? audioFactory() : nullptr;
+    const unsigned char* data = nullptr;
+    size_t length = 0;
+    if (!stream || !stream::dataFromStream(*stream, &data, &length)) {
+        ACSDK_WARN(LX("decodeFailed").d("reason", "streamNotFromData"));
+        return false;
+    }
+
+    size_t remainingSizeInBytes = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_entries.count(data)) {
+            return true;
+        }
+        remainingSizeInBytes = m_maxSizeInBytes - m_sizeInBytes;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto audio = decodeData(data, length, remainingSizeInBytes);
+    if (!audio) {
+        return false;
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries[data] = audio;
+    m_sizeInBytes += audio->samples.size();
+    ACSDK_DEBUG5(LX("decoded")
+                     .d("encodedBytes", length)
+                     .d("decodedBytes", audio->samples.size())
+                     .d("rate", audio->format.sampleRateHz)
+                     .d("channels", audio->format.numChannels)
+                     .d("elapsedMs", elapsed.count())
+                     .d("cacheSizeInBytes", m_sizeInBytes));
+    return true;
+}
+
+}  // namespace mediaPlayer
+}  // namespace alexaClientSDK
@@ -20,6 +20,7 @@
 #include <AVSCommon/AVS/Attachment/AttachmentReader.h>
 #include <AVSCommon/AVS/SpeakerConstants/SpeakerConstants.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Metrics/LatencyTracer.h>
 #include <AVSCommon/Utils/Memory/Memory.h>
 #include <PlaylistParser/PlaylistParser.h>
 #include <PlaylistParser/UrlContentToAttachmentConverter.h>
@@ -28,6 +29,7 @@
 #include "MediaPlayer/ErrorTypeConversion.h"
 #include "MediaPlayer/IStreamSource.h"
 #include "MediaPlayer/Normalizer.h"
+#include "MediaPlayer/PCMSource.h"
 
 #include "MediaPlayer/MediaPlayer.h"
 
@@ -40,6 +42,7 @@ using namespace avsCommon::sdkInterfaces;
 using namespace avsCommon::utils;
 using namespace avsCommon::utils::mediaPlayer;
 using namespace avsCommon::utils::memory;
+using namespace avsCommon::utils::metrics;
 using namespace avsCommon::utils::configuration;
 
 /// String to identify log entries originating from this file.
@@ -160,9 +163,11 @@ std::shared_ptr<MediaPlayer> MediaPlayer::create(
     std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory,
     bool enableEqualizer,
     SpeakerInterface::Type type,
-    std::string name) {
+    std::string name,
+    std::shared_ptr<DecodedAudioCache> decodedAudioCache) {
     ACSDK_DEBUG9(LX("createCalled"));
-    std::shared_ptr<MediaPlayer> mediaPlayer(new MediaPlayer(contentFetcherFactory, enableEqualizer, type, name));
+    std::shared_ptr<MediaPlayer> mediaPlayer(
+        new MediaPlayer(contentFetcherFactory, enableEqualizer, type, name, decodedAudioCache));
     if (mediaPlayer->init()) {
         return mediaPlayer;
     } else {
@@ -555,11 +560,13 @@ MediaPlayer::MediaPlayer(
     std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory,
     bool enableEqualizer,
     SpeakerInterface::Type type,
-    std::string name) :
+    std::string name,
+    std::shared_ptr<DecodedAudioCache> decodedAudioCache) :
         RequiresShutdown{name},
         m_lastVolume{GST_SET_VOLUME_MAX},
         m_isMuted{false},
         m_contentFetcherFactory{contentFetcherFactory},
+        m_decodedAudioCache{decodedAudioCache},
         m_equalizerEnabled{enableEqualizer},
         m_speakerType{type},
         m_playbackStartedSent{false},
@@ -1052,6 +1059,7 @@ gboolean MediaPlayer::handleBusMessage(GstMessage* message) {
                     }
                 } else if (newState == GST_STATE_PLAYING) {
                     if (!m_playbackStartedSent) {
+                        LatencyTracer::record(TracePoint::MEDIA_PLAYER_PLAYING, m_currentId);
                         sendPlaybackStarted();
                     } else {
                         if (m_isBufferUnderrun) {
@@ -1199,6 +1207,7 @@ void MediaPlayer::handleSetAttachmentReaderSource(
     m_source = source;
     m_currentId = ++g_id;
     m_offsetManager.setIsSeekable(true);
+    LatencyTracer::record(TracePoint::MEDIA_PLAYER_SOURCE_SET, m_currentId);
     promise->set_value(m_currentId);
 }
 
@@ -1208,6 +1217,13 @@ void MediaPlayer::handleSetIStreamSource(
     std::promise<MediaPlayer::SourceId>* promise) {
     ACSDK_DEBUG(LX("handleSetSourceCalled"));
 
+    if (m_decodedAudioCache && stream) {
+        if (auto audio = m_decodedAudioCache->get(*stream)) {
+            handleSetPCMSource(audio, repeat, promise);
+            return;
+        }
+    }
+
     tearDownTransientPipelineElements(true);
 
     std::shared_ptr<SourceInterface> source = IStreamSource::create(this, stream, repeat);
@@ -1230,6 +1246,36 @@ void MediaPlayer::handleSetIStreamSource(
 
     m_source = source;
     m_currentId = ++g_id;
+    LatencyTracer::record(TracePoint::MEDIA_PLAYER_SOURCE_SET, m_currentId);
+    promise->set_value(m_currentId);
+}
+
+void MediaPlayer::handleSetPCMSource(
+    std::shared_ptr<const DecodedAudioCache::DecodedAudio> audio,
+    bool repeat,
+    std::promise<MediaPlayer::SourceId>* promise) {
+    ACSDK_DEBUG(LX("handleSetPCMSourceCalled"));
+
+    tearDownTransientPipelineElements(true);
+
+    std::shared_ptr<SourceInterface> source = PCMSource::create(this, audio, repeat);
+
+    if (!source) {
+        ACSDK_ERROR(LX("handleSetPCMSourceFailed").d("reason", "sourceIsNullptr"));
+        promise->set_value(ERROR_SOURCE_ID);
+        return;
+    }
+
+    // The audio is already decoded, so there is no decoder to add a pad, and the appsrc is linked directly.
+    if (!gst_element_link(reinterpret_cast<GstElement*>(m_pipeline.appsrc), m_pipeline.decodedQueue)) {
+        ACSDK_ERROR(LX("handleSetPCMSourceFailed").d("reason", "linkAppSrcToDecodedQueueFailed"));
+        promise->set_value(ERROR_SOURCE_ID);
+        return;
+    }
+
+    m_source = source;
+    m_currentId = ++g_id;
+    LatencyTracer::record(TracePoint::MEDIA_PLAYER_SOURCE_SET, m_currentId);
     promise->set_value(m_currentId);
 }
 
@@ -0,0 +1,172 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+#include "MediaPlayer/PCMSource.h"
+
+namespace alexaClientSDK {
+namespace mediaPlayer {
+
+using namespace avsCommon::utils;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("PCMSource");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The largest number of bytes pushed to the appsrc element at a time.
+static const size_t CHUNK_SIZE(16384);
+
+/**
+ * Frees the reference to the audio held by a buffer which wraps its samples.
+ *
+ * @param pointer The @c std::shared_ptr to the audio.
+ */
+static void releaseAudio(gpointer pointer) {
+    delete static_cast<std::shared_ptr<const DecodedAudioCache::DecodedAudio>*>(pointer);
+}
+
+std::unique_ptr<PCMSource> PCMSource::create(
+    PipelineInterface* pipeline,
+    std::shared_ptr<const DecodedAudioCache::DecodedAudio> audio,
+    bool repeat) {
+    if (!audio || audio->samples.empty()) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "noAudio"));
+        return nullptr;
+    }
+    std::unique_ptr<PCMSource> result(new PCMSource(pipeline, std::move(audio), repeat));
+    if (0 == result->m_bytesPerFrame || 0 == result->m_audio->format.sampleRateHz) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "invalidAudioFormat"));
+        return nullptr;
+    }
+    // The caps of the appsrc are those of the PCM, so that it needs no decoder.
+    if (result->init(&result->m_audio->format, false)) {
+        return result;
+    }
+    return nullptr;
+}
+
+PCMSource::PCMSource(
+    PipelineInterface* pipeline,
+    std::shared_ptr<const DecodedAudioCache::DecodedAudio> audio,
+    bool repeat) :
+        BaseStreamSource{pipeline, "PCMSource"},
+        m_audio{std::move(audio)},
+        m_repeat{repeat},
+        m_bytesPerFrame{m_audio->format.sampleSizeInBits / 8 * m_audio->format.numChannels},
+        m_offset{0},
+        m_position{0} {
+}
+
+PCMSource::~PCMSource() {
+    close();
+}
+
+bool PCMSource::isPlaybackRemote() const {
+    return false;
+}
+
+bool PCMSource::hasAdditionalData() {
+    if (!m_repeat) {
+        return false;
+    }
+    m_offset = 0;
+    return true;
+}
+
+bool PCMSource::isOpen() {
+    return m_audio != nullptr;
+}
+
+void PCMSource::close() {
+    m_audio.reset();
+}
+
+gboolean PCMSource::handleReadData() {
+    if (!isOpen()) {
+        ACSDK_ERROR(LX("handleReadDataFailed").d("reason", "audioIsNullPtr"));
+        return false;
+    }
+
+    auto& samples = m_audio->samples;
+    if (m_offset >= samples.size()) {
+        if (!m_repeat) {
+            signalEndOfData();
+            return false;
+        }
+        m_offset = 0;
+    }
+
+    auto size = std::min(CHUNK_SIZE / m_bytesPerFrame * m_bytesPerFrame, samples.size() - m_offset);
+
+    // The buffer holds a reference to the audio rather than a copy of its samples.
+    auto buffer = gst_buffer_new_wrapped_full(
+        GST_MEMORY_FLAG_READONLY,
+        const_cast<uint8_t*>(samples.data()),
+        samples.size(),
+        m_offset,
+        size,
+        new std::shared_ptr<const DecodedAudioCache::DecodedAudio>(m_audio),
+        &releaseAudio);
+    if (!buffer) {
+        ACSDK_ERROR(LX("handleReadDataFailed").d("reason", "gstBufferNewWrappedFullFailed"));
+        signalEndOfData();
+        return false;
+    }
+
+    GST_BUFFER_PTS(buffer) = bytesToTime(m_position);
+    GST_BUFFER_DURATION(buffer) = bytesToTime(m_position + size) - GST_BUFFER_PTS(buffer);
+    m_offset += size;
+    m_position += size;
+
+    ACSDK_DEBUG9(LX("read").d("size", size).d("offset", m_offset).d("position", m_position));
+
+    installOnReadDataHandler();
+    auto flowRet = gst_app_src_push_buffer(getAppSrc(), buffer);
+    if (flowRet != GST_FLOW_OK) {
+        ACSDK_ERROR(LX("handleReadDataFailed")
+                        .d("reason", "gstAppSrcPushBufferFailed")
+                        .d("error", gst_flow_get_name(flowRet)));
+        return false;
+    }
+    return true;
+}
+
+gboolean PCMSource::handleSeekData(guint64 offset) {
+    if (!isOpen()) {
+        return false;
+    }
+    // The appsrc is in time format, so the offset is a time.
+    auto frames = gst_util_uint64_scale(offset, m_audio->format.sampleRateHz, GST_SECOND);
+    auto bytes = std::min<guint64>(frames * m_bytesPerFrame, m_audio->samples.size());
+    m_offset = static_cast<size_t>(bytes);
+    m_position = bytes;
+    return true;
+}
+
+guint64 PCMSource::bytesToTime(guint64 bytes) const {
+    return gst_util_uint64_scale(bytes / m_bytesPerFrame, GST_SECOND, m_audio->format.sampleRateHz);
+}
+
+}  // namespace mediaPlayer
+}  // namespace alexaClientSDK
@@ -16,11 +16,15 @@
 #include <algorithm>
 #include <chrono>
 #include <condition_variable>
+#include <ctime>
 #include <fstream>
+#include <iostream>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -30,6 +34,7 @@
 #include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 #include <AVSCommon/Utils/Memory/Memory.h>
+#include <AVSCommon/Utils/Stream/StreamFunctions.h>
 #include <PlaylistParser/PlaylistParser.h>
 
 #include "MediaPlayer/MediaPlayer.h"
@@ -98,6 +103,35 @@ static std::unordered_map<std::string, std::string> urlsToContentTypes;
 
 static std::unordered_map<std::string, std::string> urlsToContent;
 
+/// The number of times audio is played in the benchmark of the time to start playing.
+static const int BENCHMARK_PLAYS = 10;
+
+/// The number of times audio is repeated in the benchmark of the CPU time of repeated audio.
+static const int BENCHMARK_LOOPS = 3;
+
+/**
+ * Gets the content of the MP3 test file, which lives as long as the process, as built-in audio does.
+ *
+ * @return The content of the MP3 test file.
+ */
+static const std::vector<unsigned char>& getMp3Data() {
+    static const std::vector<unsigned char> data = []() {
+        std::ifstream stream(inputsDirPath + MP3_FILE_PATH, std::ifstream::binary);
+        return std::vector<unsigned char>(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }();
+    return data;
+}
+
+/**
+ * Creates a stream of the content of the MP3 test file, as the factories of the built-in audio do.
+ *
+ * @return The stream.
+ */
+static std::unique_ptr<std::istream> mp3DataFactory() {
+    auto& data = getMp3Data();
+    return avsCommon::utils::stream::streamFromData(data.data(), data.size());
+}
+
 /// A mock content fetcher
 class MockContentFetcher : public avsCommon::sdkInterfaces::HTTPContentFetcherInterface {
 public:
@@ -1387,6 +1421,117 @@ TEST_F(MediaPlayerTest, resumeAfterPauseWithPendingPlay) {
     ASSERT_TRUE(m_playerObserver->waitForPlaybackFinished(sourceId));
 }
 
+/**
+ * Test fixture for a @c MediaPlayer which plays audio from a @c DecodedAudioCache.
+ */
+class DecodedAudioMediaPlayerTest : public MediaPlayerTest {
+public:
+    void SetUp() override;
+
+    void TearDown() override {
+        m_decodedAudioMediaPlayer->shutdown();
+        MediaPlayerTest::TearDown();
+    }
+
+    /// The cache of the decoded MP3 test file.
+    std::shared_ptr<DecodedAudioCache> m_decodedAudioCache;
+
+    /// A @c MediaPlayer which plays audio from @c m_decodedAudioCache.
+    std::shared_ptr<MediaPlayer> m_decodedAudioMediaPlayer;
+};
+
+void DecodedAudioMediaPlayerTest::SetUp() {
+    MediaPlayerTest::SetUp();
+    m_decodedAudioCache = DecodedAudioCache::create();
+    ASSERT_TRUE(m_decodedAudioCache);
+    ASSERT_TRUE(m_decodedAudioCache->prefetch({mp3DataFactory}).get());
+    m_decodedAudioMediaPlayer = MediaPlayer::create(
+        std::make_shared<MockContentFetcherFactory>(),
+        false,
+        SpeakerInterface::Type::AVS_SPEAKER_VOLUME,
+        "DecodedAudioMediaPlayer",
+        m_decodedAudioCache);
+    ASSERT_TRUE(m_decodedAudioMediaPlayer);
+    m_decodedAudioMediaPlayer->setObserver(m_playerObserver);
+}
+
+/**
+ * Test that built-in audio is decoded once, and played to the end from its PCM.
+ */
+TEST_F(DecodedAudioMediaPlayerTest, testPlayDecodedAudio) {
+    auto audio = m_decodedAudioCache->get(*mp3DataFactory());
+    ASSERT_TRUE(audio);
+    ASSERT_FALSE(audio->samples.empty());
+    ASSERT_EQ(16u, audio->format.sampleSizeInBits);
+
+    // Audio which is not built-in is not cached.
+    std::ifstream fileStream(inputsDirPath + MP3_FILE_PATH, std::ifstream::binary);
+    ASSERT_FALSE(m_decodedAudioCache->get(fileStream));
+
+    auto sourceId = m_decodedAudioMediaPlayer->setSource(mp3DataFactory(), false);
+    ASSERT_NE(ERROR_SOURCE_ID, sourceId);
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(m_decodedAudioMediaPlayer->play(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackStarted(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackFinished(sourceId));
+    ASSERT_GE(std::chrono::steady_clock::now() - start, MP3_FILE_LENGTH - TOLERANCE);
+}
+
+/**
+ * Test that repeated decoded audio plays until it is stopped.
+ */
+TEST_F(DecodedAudioMediaPlayerTest, testRepeatDecodedAudio) {
+    auto sourceId = m_decodedAudioMediaPlayer->setSource(mp3DataFactory(), true);
+    ASSERT_NE(ERROR_SOURCE_ID, sourceId);
+    ASSERT_TRUE(m_decodedAudioMediaPlayer->play(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackStarted(sourceId));
+    ASSERT_FALSE(m_playerObserver->waitForPlaybackFinished(sourceId, MP3_FILE_LENGTH + TOLERANCE));
+    ASSERT_TRUE(m_decodedAudioMediaPlayer->stop(sourceId));
+    ASSERT_TRUE(m_playerObserver->waitForPlaybackStopped(sourceId));
+}
+
+/**
+ * Report how long it takes from setSource() to the start of playback, and how much CPU time a loop of repeated audio
+ * takes, when the audio is decoded each time and when it is played from the cache.  The results are recorded as test
+ * properties.  Disabled by default.
+ */
+TEST_F(DecodedAudioMediaPlayerTest, DISABLED_benchmarkDecodedAudio) {
+    std::shared_ptr<MediaPlayer> mediaPlayers[] = {m_mediaPlayer, m_decodedAudioMediaPlayer};
+    std::chrono::microseconds startTimes[2];
+    double cpuMsPerLoop[2];
+
+    for (int i = 0; i < 2; ++i) {
+        auto& mediaPlayer = mediaPlayers[i];
+        std::chrono::steady_clock::duration total{0};
+        for (int play = 0; play < BENCHMARK_PLAYS; ++play) {
+            auto start = std::chrono::steady_clock::now();
+            auto sourceId = mediaPlayer->setSource(mp3DataFactory(), false);
+            ASSERT_NE(ERROR_SOURCE_ID, sourceId);
+            ASSERT_TRUE(mediaPlayer->play(sourceId));
+            ASSERT_TRUE(m_playerObserver->waitForPlaybackStarted(sourceId));
+            total += std::chrono::steady_clock::now() - start;
+            ASSERT_TRUE(mediaPlayer->stop(sourceId));
+            ASSERT_TRUE(m_playerObserver->waitForPlaybackStopped(sourceId));
+        }
+        startTimes[i] = std::chrono::duration_cast<std::chrono::microseconds>(total / BENCHMARK_PLAYS);
+
+        auto sourceId = mediaPlayer->setSource(mp3DataFactory(), true);
+        ASSERT_NE(ERROR_SOURCE_ID, sourceId);
+        auto cpuStart = std::clock();
+        ASSERT_TRUE(mediaPlayer->play(sourceId));
+        ASSERT_TRUE(m_playerObserver->waitForPlaybackStarted(sourceId));
+        std::this_thread::sleep_for(MP3_FILE_LENGTH * BENCHMARK_LOOPS);
+        ASSERT_TRUE(mediaPlayer->stop(sourceId));
+        ASSERT_TRUE(m_playerObserver->waitForPlaybackStopped(sourceId));
+        cpuMsPerLoop[i] = 1000.0 * (std::clock() - cpuStart) / CLOCKS_PER_SEC / BENCHMARK_LOOPS;
+    }
+
+    RecordProperty("decodedStartUs", std::to_string(startTimes[0].count()));
+    RecordProperty("cachedStartUs", std::to_string(startTimes[1].count()));
+    RecordProperty("decodedCpuMsPerLoop", std::to_string(cpuMsPerLoop[0]));
+    RecordProperty("cachedCpuMsPerLoop", std::to_string(cpuMsPerLoop[1]));
+}
+
 }  // namespace test
 }  // namespace mediaPlayer
 }  // namespace alexaClientSDK
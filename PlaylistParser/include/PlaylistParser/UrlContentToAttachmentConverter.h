@@ -17,7 +17,9 @@
 #define ALEXA_CLIENT_SDK_PLAYLISTPARSER_INCLUDE_PLAYLISTPARSER_URLCONTENTTOATTACHMENTCONVERTER_H_
 
 #include <atomic>
+#include <deque>
 #include <memory>
+#include <mutex>
 
 #include <AVSCommon/AVS/Attachment/InProcessAttachment.h>
 #include <AVSCommon/AVS/Attachment/InProcessAttachmentWriter.h>
@@ -38,6 +40,14 @@ class UrlContentToAttachmentConverter
         : public avsCommon::utils::playlistParser::PlaylistParserObserverInterface
         , public avsCommon::utils::RequiresShutdown {
 public:
+    /// Metrics about the playlist entries downloaded ahead of the one being streamed.
+    struct PrefetchMetrics {
+        /// The number of entries being downloaded, or downloaded and waiting, after the one being streamed.
+        size_t entriesAhead;
+        /// The number of bytes downloaded but not yet streamed, including those of the entry being streamed.
+        uint64_t bytesBuffered;
+    };
+
     /// Class to observe errors that arise from converting a URL to to an @c Attachment
     class ErrorObserverInterface {
     public:
@@ -91,9 +101,19 @@ public:
      */
     std::chrono::milliseconds getDesiredStreamingPoint();
 
+    /**
+     * Gets the current state of the download of playlist entries ahead of the one being streamed.
+     *
+     * @return The current @c PrefetchMetrics.
+     */
+    PrefetchMetrics getPrefetchMetrics();
+
     void doShutdown() override;
 
 private:
+    /// A playlist entry to be streamed, and its download.
+    struct PlaylistEntry;
+
     /**
      * Constructor.
      *
@@ -126,14 +146,30 @@ private:
     /// @{
 
     /**
-     * Downloads the content from the url and writes it into the internal stream.
+     * Takes the next entry from @c m_entries, and writes its downloaded content into the internal stream, unless the
+     * stream has been closed.
      *
      * @return @c true if the content was successfully streamed and written or @c false otherwise.
      */
-    bool writeUrlContentIntoStream(std::string url);
+    bool writeNextEntryIntoStream();
+
+    /**
+     * Writes data into the internal stream, waiting for room if needed.
+     *
+     * @param data The data to write.
+     * @param size The number of bytes to write.
+     * @return @c true if all the data was written, or @c false on error or shutdown.
+     */
+    bool writeIntoStream(const char* data, size_t size);
 
     /// @}
 
+    /**
+     * Starts downloading the entry to be streamed next, and the ones after it within the prefetch window.
+     * @c m_entriesMutex must be held.
+     */
+    void startDownloadsLocked();
+
     /// The initial desired offset from which streaming should begin.
     const std::chrono::milliseconds m_desiredStreamPoint;
 
@@ -158,6 +194,15 @@ private:
     /// Flag to indicate if a shutdown is occurring.
     std::atomic<bool> m_shuttingDown;
 
+    /// Serializes access to @c m_entries.
+    std::mutex m_entriesMutex;
+
+    /// The entries parsed and not yet streamed, in order.  The first is the one being streamed.
+    std::deque<std::shared_ptr<PlaylistEntry>> m_entries;
+
+    /// The number of downloaded bytes of the entry being streamed which have not been streamed yet.
+    std::atomic<uint64_t> m_currentEntryUnreadBytes;
+
     /**
      * @name @c onPlaylistEntryParsed Callback Variables
      *
@@ -16,6 +16,7 @@
 #include <algorithm>
 #include <deque>
 #include <sstream>
+#include <unordered_map>
 
 #include <AVSCommon/Utils/Logger/Logger.h>
 #include <AVSCommon/Utils/PlaylistParser/PlaylistParserObserverInterface.h>
@@ -48,6 +49,37 @@ static int g_id = 0;
 static const std::chrono::milliseconds INVALID_DURATION =
     avsCommon::utils::playlistParser::PlaylistParserObserverInterface::INVALID_DURATION;
 
+/// The number of upcoming URLs whose content type is requested while the current one is being parsed.
+static const size_t CONTENT_TYPE_PROBE_WINDOW = 3;
+
+/// A request for the content type of a URL, started before the URL is reached.
+struct ContentTypeProbe {
+    /// The fetcher making the request, which must outlive @c content.
+    std::unique_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> fetcher;
+
+    /// The result of the request.
+    std::unique_ptr<avsCommon::utils::HTTPContent> content;
+};
+
+/**
+ * Request the content type of a URL.
+ *
+ * @param contentFetcherFactory The factory used to create the fetcher.
+ * @param url The URL.
+ * @return The request, whose @c content is @c nullptr if the request could not be started.
+ */
+static ContentTypeProbe startContentTypeProbe(
+    std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory,
+    const std::string& url) {
+    ContentTypeProbe probe;
+    probe.fetcher = contentFetcherFactory->create(url);
+    if (probe.fetcher) {
+        probe.content = probe.fetcher->getContent(
+            avsCommon::sdkInterfaces::HTTPContentFetcherInterface::FetchOptions::CONTENT_TYPE);
+    }
+    return probe;
+}
+
 std::unique_ptr<PlaylistParser> PlaylistParser::create(
     std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory) {
     if (!contentFetcherFactory) {
@@ -97,9 +129,25 @@ void PlaylistParser::doDepthFirstSearch(
     std::deque<UrlAndInfo> urlsToParse;
     urlsToParse.push_front({rootUrl, INVALID_DURATION});
     std::string lastUrlParsed;
+    /*
+     * Content type requests for the next few URLs that may be playlists, started ahead so that resolving nested
+     * playlists overlaps.  Results are still consumed in order, so entries are reported in the same order.
+     */
+    std::unordered_map<std::string, ContentTypeProbe> probes;
     while (!urlsToParse.empty() && !m_shuttingDown) {
         auto urlAndInfo = urlsToParse.front();
         urlsToParse.pop_front();
+        size_t probesAhead = 0;
+        for (auto it = urlsToParse.begin(); it != urlsToParse.end() && probesAhead < CONTENT_TYPE_PROBE_WINDOW;
+             ++it) {
+            if (it->length != INVALID_DURATION || it->url == urlAndInfo.url) {
+                continue;
+            }
+            ++probesAhead;
+            if (probes.find(it->url) == probes.end()) {
+                probes[it->url] = startContentTypeProbe(m_contentFetcherFactory, it->url);
+            }
+        }
         if (urlAndInfo.length != INVALID_DURATION) {
             // This is a media URL and not a playlist
             ACSDK_DEBUG9(LX("foundNonPlaylistURL"));
@@ -111,9 +159,15 @@ void PlaylistParser::doDepthFirstSearch(
                 urlAndInfo.length);
             continue;
         }
-        auto contentFetcher = m_contentFetcherFactory->create(urlAndInfo.url);
-        auto httpContent = contentFetcher->getContent(
-            avsCommon::sdkInterfaces::HTTPContentFetcherInterface::FetchOptions::CONTENT_TYPE);
+        ContentTypeProbe probe;
+        auto probeIt = probes.find(urlAndInfo.url);
+        if (probeIt != probes.end()) {
+            probe = std::move(probeIt->second);
+            probes.erase(probeIt);
+        } else {
+            probe = startContentTypeProbe(m_contentFetcherFactory, urlAndInfo.url);
+        }
+        auto& httpContent = probe.content;
         if (!httpContent) {
             ACSDK_ERROR(LX("getHTTPContent").d("reason", "nullHTTPContentReceived"));
             observer->onPlaylistEntryParsed(
@@ -15,6 +15,9 @@
 
 #include "PlaylistParser/UrlContentToAttachmentConverter.h"
 
+#include <vector>
+
+#include <AVSCommon/Utils/HTTPContent.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 
 namespace alexaClientSDK {
@@ -36,6 +39,65 @@ static const std::chrono::milliseconds UNVALID_DURATION =
 /// Timeout for future ready.
 static const std::chrono::milliseconds WAIT_FOR_FUTURE_READY_TIMEOUT(100);
 
+/**
+ * The number of entries downloaded ahead of the one being streamed.  Each is downloaded into its own
+ * @c InProcessAttachment, so at most this many times @c SDS_BUFFER_DEFAULT_SIZE_IN_BYTES is buffered ahead.
+ */
+static const size_t PREFETCH_WINDOW = 2;
+
+/// Timeout for reading downloaded content and writing it into the stream, between checks for shutdown.
+static const std::chrono::milliseconds SPLICE_TIMEOUT(100);
+
+/**
+ * Timeout for reading downloaded content while its download is still in progress, between checks for whether the
+ * download has finished.
+ */
+static const std::chrono::milliseconds DOWNLOAD_POLL_INTERVAL(10);
+
+/// The size of the chunks in which downloaded content is copied into the stream.
+static const size_t SPLICE_CHUNK_SIZE = 4096;
+
+struct UrlContentToAttachmentConverter::PlaylistEntry {
+    /**
+     * Constructor.
+     *
+     * @param url The URL of the entry.
+     * @param duration The duration of the entry, or @c INVALID_DURATION if unknown.
+     */
+    PlaylistEntry(const std::string& url, std::chrono::milliseconds duration) :
+            url{url},
+            duration{duration},
+            isDownloadStarted{false} {
+    }
+
+    /// The URL of the entry.
+    const std::string url;
+
+    /// The duration of the entry.  Only entries of known duration, such as HLS segments, are downloaded ahead.
+    const std::chrono::milliseconds duration;
+
+    /// Whether the download has been started.
+    bool isDownloadStarted;
+
+    /// The fetcher downloading the entry.
+    std::unique_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> fetcher;
+
+    /// The result of the download, or @c nullptr if it failed to start.
+    std::unique_ptr<avsCommon::utils::HTTPContent> content;
+
+    /// The attachment the entry is downloaded into.
+    std::shared_ptr<avsCommon::avs::attachment::InProcessAttachment> stream;
+
+    /// Reads the downloaded content, or @c nullptr if the download failed to start.
+    std::unique_ptr<avsCommon::avs::attachment::AttachmentReader> reader;
+
+    /**
+     * Writes the downloaded content until the download finishes.  The fetcher does not close a writer it is given, so
+     * it is closed, and reset, once the download has finished.
+     */
+    std::shared_ptr<avsCommon::avs::attachment::AttachmentWriter> writer;
+};
+
 std::shared_ptr<UrlContentToAttachmentConverter> UrlContentToAttachmentConverter::create(
     std::shared_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface> contentFetcherFactory,
     const std::string& url,
@@ -68,6 +130,7 @@ UrlContentToAttachmentConverter::UrlContentToAttachmentConverter(
         m_contentFetcherFactory{contentFetcherFactory},
         m_observer{observer},
         m_shuttingDown{false},
+        m_currentEntryUnreadBytes{0},
         m_runningTotal{0},
         m_startedStreaming{false},
         m_streamWriterClosed{false} {
@@ -85,6 +148,19 @@ std::chrono::milliseconds UrlContentToAttachmentConverter::getDesiredStreamingPo
     return m_desiredStreamPoint;
 }
 
+UrlContentToAttachmentConverter::PrefetchMetrics UrlContentToAttachmentConverter::getPrefetchMetrics() {
+    PrefetchMetrics metrics{0, m_currentEntryUnreadBytes};
+    std::lock_guard<std::mutex> lock{m_entriesMutex};
+    // The first entry's reader belongs to the executor thread, which publishes m_currentEntryUnreadBytes instead.
+    for (size_t i = 1; i < m_entries.size() && m_entries[i]->isDownloadStarted; ++i) {
+        ++metrics.entriesAhead;
+        if (m_entries[i]->reader) {
+            metrics.bytesBuffered += m_entries[i]->reader->getNumUnreadBytes();
+        }
+    }
+    return metrics;
+}
+
 void UrlContentToAttachmentConverter::onPlaylistEntryParsed(
     int requestId,
     std::string url,
@@ -109,6 +185,12 @@ void UrlContentToAttachmentConverter::onPlaylistEntryParsed(
     }
     m_startedStreaming = true;
     ACSDK_DEBUG3(LX("onPlaylistEntryParsed").d("status", parseResult));
+    if (parseResult != avsCommon::utils::playlistParser::PlaylistParseResult::ERROR) {
+        // Queue the entry for streaming, and start downloading it if it is within the prefetch window.
+        std::lock_guard<std::mutex> lock{m_entriesMutex};
+        m_entries.push_back(std::make_shared<PlaylistEntry>(url, duration));
+        startDownloadsLocked();
+    }
     switch (parseResult) {
         case avsCommon::utils::playlistParser::PlaylistParseResult::ERROR:
             m_executor.submit([this]() {
@@ -124,8 +206,8 @@ void UrlContentToAttachmentConverter::onPlaylistEntryParsed(
             });
             break;
         case avsCommon::utils::playlistParser::PlaylistParseResult::FINISHED:
-            m_executor.submit([this, url]() {
-                if (!m_streamWriterClosed && !writeUrlContentIntoStream(url)) {
+            m_executor.submit([this]() {
+                if (!writeNextEntryIntoStream()) {
                     ACSDK_ERROR(LX("writeUrlContentToStreamFailed"));
                     std::unique_lock<std::mutex> lock{m_mutex};
                     auto observer = m_observer;
@@ -140,8 +222,8 @@ void UrlContentToAttachmentConverter::onPlaylistEntryParsed(
             });
             break;
         case avsCommon::utils::playlistParser::PlaylistParseResult::STILL_ONGOING:
-            m_executor.submit([this, url]() {
-                if (!m_streamWriterClosed && !writeUrlContentIntoStream(url)) {
+            m_executor.submit([this]() {
+                if (!writeNextEntryIntoStream()) {
                     ACSDK_ERROR(LX("writeUrlContentToStreamFailed").d("info", "closingWriter"));
                     m_streamWriter->close();
                     m_streamWriterClosed = true;
@@ -159,30 +241,129 @@ void UrlContentToAttachmentConverter::onPlaylistEntryParsed(
     }
 }
 
-bool UrlContentToAttachmentConverter::writeUrlContentIntoStream(std::string url) {
-    ACSDK_DEBUG9(LX("writeUrlContentIntoStream").d("info", "beginning"));
+void UrlContentToAttachmentConverter::startDownloadsLocked() {
+    if (m_shuttingDown) {
+        return;
+    }
+    for (size_t i = 0; i < m_entries.size() && i <= PREFETCH_WINDOW; ++i) {
+        auto& entry = *m_entries[i];
+        if (entry.isDownloadStarted) {
+            continue;
+        }
+        // Entries of unknown duration may be endless live streams, which are only downloaded when streamed.
+        if (i > 0 && UNVALID_DURATION == entry.duration) {
+            break;
+        }
+        ACSDK_DEBUG9(LX("startDownload").d("entriesAhead", i));
+        entry.isDownloadStarted = true;
+        entry.fetcher = m_contentFetcherFactory->create(entry.url);
+        if (!entry.fetcher) {
+            continue;
+        }
+        // The reader is created before the download starts, so that it sees the content from its first byte.
+        entry.stream = std::make_shared<avsCommon::avs::attachment::InProcessAttachment>(entry.url);
+        entry.reader = entry.stream->createReader(avsCommon::utils::sds::ReaderPolicy::BLOCKING);
+        entry.writer = entry.stream->createWriter(avsCommon::utils::sds::WriterPolicy::BLOCKING);
+        if (!entry.reader || !entry.writer) {
+            entry.reader.reset();
+            entry.writer.reset();
+            continue;
+        }
+        entry.content = entry.fetcher->getContent(
+            avsCommon::sdkInterfaces::HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY, entry.writer);
+    }
+}
+
+bool UrlContentToAttachmentConverter::writeNextEntryIntoStream() {
+    ACSDK_DEBUG9(LX("writeNextEntryIntoStream").d("info", "beginning"));
+
+    std::shared_ptr<PlaylistEntry> entry;
+    {
+        std::lock_guard<std::mutex> lock{m_entriesMutex};
+        if (m_entries.empty()) {
+            ACSDK_ERROR(LX("writeNextEntryIntoStreamFailed").d("reason", "noEntry"));
+            return false;
+        }
+        entry = m_entries.front();
+        startDownloadsLocked();
+    }
 
-    auto contentFetcher = m_contentFetcherFactory->create(url);
-    auto httpContent = contentFetcher->getContent(
-        avsCommon::sdkInterfaces::HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY, m_streamWriter);
-    if (!httpContent) {
+    auto result = true;
+    if (m_streamWriterClosed || m_shuttingDown) {
+        ACSDK_DEBUG9(LX("writeNextEntryIntoStream").d("info", "skipped"));
+    } else if (!entry->content || !entry->reader) {
         ACSDK_ERROR(LX("getContentFailed").d("reason", "nullHTTPContentReceived"));
-        return false;
+        result = false;
+    } else {
+        std::vector<char> chunk(SPLICE_CHUNK_SIZE);
+        auto status = avsCommon::avs::attachment::AttachmentReader::ReadStatus::OK;
+        while (result && !m_shuttingDown &&
+               status != avsCommon::avs::attachment::AttachmentReader::ReadStatus::CLOSED) {
+            if (entry->writer && entry->content->isReady(std::chrono::milliseconds::zero())) {
+                // The download has finished, so closing its writer lets the reader reach the end of the content.
+                entry->writer->close();
+                entry->writer.reset();
+            }
+            auto timeout = entry->writer ? DOWNLOAD_POLL_INTERVAL : SPLICE_TIMEOUT;
+            auto size = entry->reader->read(chunk.data(), chunk.size(), &status, timeout);
+            m_currentEntryUnreadBytes = entry->reader->getNumUnreadBytes();
+            switch (status) {
+                case avsCommon::avs::attachment::AttachmentReader::ReadStatus::OK:
+                case avsCommon::avs::attachment::AttachmentReader::ReadStatus::OK_WOULDBLOCK:
+                case avsCommon::avs::attachment::AttachmentReader::ReadStatus::OK_TIMEDOUT:
+                case avsCommon::avs::attachment::AttachmentReader::ReadStatus::CLOSED:
+                    result = writeIntoStream(chunk.data(), size);
+                    break;
+                case avsCommon::avs::attachment::AttachmentReader::ReadStatus::OK_OVERRUN_RESET:
+                case avsCommon::avs::attachment::AttachmentReader::ReadStatus::ERROR_OVERRUN:
+                case avsCommon::avs::attachment::AttachmentReader::ReadStatus::ERROR_BYTES_LESS_THAN_WORD_SIZE:
+                case avsCommon::avs::attachment::AttachmentReader::ReadStatus::ERROR_INTERNAL:
+                    ACSDK_ERROR(LX("writeNextEntryIntoStreamFailed").d("reason", "readFailed"));
+                    result = false;
+                    break;
+            }
+        }
+        m_currentEntryUnreadBytes = 0;
+        if (result && !m_shuttingDown && !entry->content->isStatusCodeSuccess()) {
+            ACSDK_ERROR(LX("getContentFailed")
+                            .d("reason", "badHTTPContentReceived")
+                            .d("statusCode", entry->content->getStatusCode()));
+            result = false;
+        }
     }
 
-    do {
+    {
+        std::lock_guard<std::mutex> lock{m_entriesMutex};
+        m_entries.pop_front();
+        startDownloadsLocked();
+    }
+    if (result) {
+        ACSDK_DEBUG9(LX("writeNextEntryIntoStreamSuccess"));
+    }
+    return result;
+}
+
+bool UrlContentToAttachmentConverter::writeIntoStream(const char* data, size_t size) {
+    while (size > 0) {
         if (m_shuttingDown) {
-            ACSDK_DEBUG9(LX("writeUrlContentIntoStream").d("info", "shuttingDown"));
-            return true;
+            return false;
+        }
+        auto status = avsCommon::avs::attachment::AttachmentWriter::WriteStatus::OK;
+        auto written = m_streamWriter->write(data, size, &status, SPLICE_TIMEOUT);
+        data += written;
+        size -= written;
+        switch (status) {
+            case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::OK:
+            case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::TIMEDOUT:
+                break;
+            case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::OK_BUFFER_FULL:
+            case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::CLOSED:
+            case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::ERROR_BYTES_LESS_THAN_WORD_SIZE:
+            case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::ERROR_INTERNAL:
+                ACSDK_ERROR(LX("writeIntoStreamFailed").d("status", static_cast<int>(status)));
+                return false;
         }
-    } while (!httpContent->isReady(WAIT_FOR_FUTURE_READY_TIMEOUT));
-
-    if (!httpContent->isStatusCodeSuccess()) {
-        ACSDK_ERROR(
-            LX("getContentFailed").d("reason", "badHTTPContentReceived").d("statusCode", httpContent->getStatusCode()));
-        return false;
     }
-    ACSDK_DEBUG9(LX("writeUrlContentIntoStreamSuccess"));
     return true;
 }
 
@@ -195,6 +376,11 @@ void UrlContentToAttachmentConverter::doShutdown() {
     m_executor.shutdown();
     m_playlistParser->shutdown();
     m_playlistParser.reset();
+    {
+        // Stops the downloads still running.
+        std::lock_guard<std::mutex> lock{m_entriesMutex};
+        m_entries.clear();
+    }
     m_streamWriter->close();
     m_streamWriter.reset();
     if (!m_startedStreaming) {
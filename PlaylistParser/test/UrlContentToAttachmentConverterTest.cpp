@@ -0,0 +1,293 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/LibcurlUtils/HTTPContentFetcherFactory.h>
+#include <AVSCommon/Utils/LibcurlUtils/TestHTTPServer.h>
+
+#include "PlaylistParser/UrlContentToAttachmentConverter.h"
+
+namespace alexaClientSDK {
+namespace playlistParser {
+namespace test {
+
+using namespace avsCommon::avs::attachment;
+using namespace avsCommon::utils::libcurlUtils;
+using namespace avsCommon::utils::libcurlUtils::test;
+
+/// The number of segments in the synthetic HLS stream.
+static const int NUM_SEGMENTS = 6;
+
+/// The size of each segment.
+static const size_t SEGMENT_SIZE = 16 * 1024;
+
+/// How long the server takes to answer each segment request, standing in for a slow CDN.
+static const std::chrono::milliseconds SEGMENT_DELAY(200);
+
+/// The number of segments downloaded ahead of the one being streamed.
+static const int PREFETCH_SEGMENTS = 2;
+
+/// How long the server takes to answer each nested playlist request.
+static const std::chrono::milliseconds NESTED_PLAYLIST_DELAY(200);
+
+/// The number of nested playlists in the master playlist.
+static const int NUM_NESTED_PLAYLISTS = 3;
+
+/// How long to wait for the whole stream.
+static const std::chrono::seconds STREAM_TIMEOUT(10);
+
+/// The timeout of each read from the stream.
+static const std::chrono::milliseconds READ_TIMEOUT(50);
+
+/// The name of each HLS media playlist, in a directory named after its index.
+static const std::string MEDIA_PLAYLIST_NAME = "media.m3u8";
+
+/// A plain M3U playlist of nested HLS media playlists.
+static const std::string MASTER_PLAYLIST_PATH = "/master.m3u";
+
+/// The content type of M3U playlists.
+static const std::string M3U_CONTENT_TYPE = "audio/x-mpegurl";
+
+/// An observer which counts errors.
+class TestErrorObserver : public UrlContentToAttachmentConverter::ErrorObserverInterface {
+public:
+    TestErrorObserver() : m_errors{0} {
+    }
+
+    void onError() override {
+        ++m_errors;
+    }
+
+    /// The number of errors.
+    std::atomic<int> m_errors;
+};
+
+/**
+ * Get the body of a segment.
+ *
+ * @param path The path of the segment.
+ * @return The body, consisting of the path repeated.
+ */
+static std::string getSegmentBody(const std::string& path) {
+    std::string body;
+    while (body.size() < SEGMENT_SIZE) {
+        body += path;
+    }
+    return body.substr(0, SEGMENT_SIZE);
+}
+
+/**
+ * Get the path of a segment.
+ *
+ * @param playlist The index of the playlist containing the segment.
+ * @param segment The index of the segment.
+ * @return The path.
+ */
+static std::string getSegmentPath(int playlist, int segment) {
+    return "/" + std::to_string(playlist) + "/segment" + std::to_string(segment) + ".ts";
+}
+
+/**
+ * Get an HLS media playlist, which lists every segment relative to the playlist's directory.
+ *
+ * @param playlist The index of the playlist.
+ * @return The playlist.
+ */
+static std::string getMediaPlaylist(int playlist) {
+    std::string content = "#EXTM3U\n#EXT-X-TARGETDURATION:10\n";
+    for (int i = 0; i < NUM_SEGMENTS; ++i) {
+        content += "#EXTINF:10,\nsegment" + std::to_string(i) + ".ts\n";
+    }
+    return content + "#EXT-X-ENDLIST\n";
+}
+
+/**
+ * Serve a synthetic slow HLS stream.
+ *
+ * @param path The path of the request.
+ * @return The response.
+ */
+static TestHTTPServer::Response serveSlowHLSStream(const std::string& path) {
+    if (MASTER_PLAYLIST_PATH == path) {
+        std::string content;
+        for (int i = 1; i <= NUM_NESTED_PLAYLISTS; ++i) {
+            content += std::to_string(i) + "/" + MEDIA_PLAYLIST_NAME + "\n";
+        }
+        return {200, M3U_CONTENT_TYPE, content, std::chrono::milliseconds::zero()};
+    }
+    if (path.find(MEDIA_PLAYLIST_NAME) != std::string::npos) {
+        // Only the nested playlists are slow.
+        auto playlist = path[1] - '0';
+        auto delay = playlist ? NESTED_PLAYLIST_DELAY : std::chrono::milliseconds::zero();
+        return {200, M3U_CONTENT_TYPE, getMediaPlaylist(playlist), delay};
+    }
+    if (path.find(".ts") != std::string::npos) {
+        return {200, "video/mp2t", getSegmentBody(path), SEGMENT_DELAY};
+    }
+    return {404, "text/plain", "", std::chrono::milliseconds::zero()};
+}
+
+class UrlContentToAttachmentConverterTest : public ::testing::Test {
+public:
+    void SetUp() override;
+
+    /**
+     * Stream a URL into a string, recording the prefetch metrics along the way.
+     *
+     * @param url The URL.
+     * @param[out] content The streamed content.
+     * @param pause How long to stop reading after the first read, letting the downloads ahead finish.
+     * @return Whether the stream was closed before the timeout.
+     */
+    bool stream(
+        const std::string& url,
+        std::string* content,
+        std::chrono::milliseconds pause = std::chrono::milliseconds::zero());
+
+    /// The server.
+    std::unique_ptr<TestHTTPServer> m_server;
+
+    /// The observer of the converter.
+    std::shared_ptr<TestErrorObserver> m_observer;
+
+    /// The largest number of entries downloaded ahead while streaming.
+    size_t m_maxEntriesAhead;
+
+    /// The largest number of bytes buffered while streaming.
+    uint64_t m_maxBytesBuffered;
+};
+
+void UrlContentToAttachmentConverterTest::SetUp() {
+    m_server = std::unique_ptr<TestHTTPServer>(new TestHTTPServer(serveSlowHLSStream));
+    m_observer = std::make_shared<TestErrorObserver>();
+    m_maxEntriesAhead = 0;
+    m_maxBytesBuffered = 0;
+}
+
+bool UrlContentToAttachmentConverterTest::stream(
+    const std::string& url,
+    std::string* content,
+    std::chrono::milliseconds pause) {
+    auto converter =
+        UrlContentToAttachmentConverter::create(std::make_shared<HTTPContentFetcherFactory>(), url, m_observer);
+    if (!converter) {
+        return false;
+    }
+    auto reader = converter->getAttachment()->createReader(avsCommon::utils::sds::ReaderPolicy::BLOCKING);
+    if (!reader) {
+        converter->shutdown();
+        return false;
+    }
+    auto deadline = std::chrono::steady_clock::now() + STREAM_TIMEOUT;
+    auto status = AttachmentReader::ReadStatus::OK;
+    char buffer[4096];
+    while (status != AttachmentReader::ReadStatus::CLOSED && std::chrono::steady_clock::now() < deadline) {
+        auto size = reader->read(buffer, sizeof(buffer), &status, READ_TIMEOUT);
+        content->append(buffer, size);
+        if (size > 0 && pause > std::chrono::milliseconds::zero()) {
+            std::this_thread::sleep_for(pause);
+            pause = std::chrono::milliseconds::zero();
+        }
+        auto metrics = converter->getPrefetchMetrics();
+        m_maxEntriesAhead = std::max(m_maxEntriesAhead, metrics.entriesAhead);
+        m_maxBytesBuffered = std::max(m_maxBytesBuffered, metrics.bytesBuffered);
+    }
+    converter->shutdown();
+    return AttachmentReader::ReadStatus::CLOSED == status;
+}
+
+/// Verify that segments of a slow HLS stream are downloaded ahead, and still streamed whole and in order.
+TEST_F(UrlContentToAttachmentConverterTest, prefetchesSegmentsInOrder) {
+    auto url = m_server->getURL("/0/" + MEDIA_PLAYLIST_NAME);
+    ASSERT_FALSE(url.empty());
+
+    std::string content;
+    ASSERT_TRUE(stream(url, &content));
+
+    std::string expected;
+    for (int i = 0; i < NUM_SEGMENTS; ++i) {
+        expected += getSegmentBody(getSegmentPath(0, i));
+    }
+    EXPECT_EQ(expected.size(), content.size());
+    EXPECT_TRUE(expected == content);
+    EXPECT_EQ(0, m_observer->m_errors);
+    EXPECT_GT(m_server->getMaxConcurrentRequests(), 1);
+    EXPECT_GE(m_maxEntriesAhead, 1u);
+    EXPECT_LE(m_maxEntriesAhead, 2u);
+    EXPECT_LE(m_maxBytesBuffered, 3 * SEGMENT_SIZE);
+}
+
+/// Verify that segments whose download finished before they were streamed are still streamed whole.
+TEST_F(UrlContentToAttachmentConverterTest, streamsFinishedDownloadsWhole) {
+    auto url = m_server->getURL("/0/" + MEDIA_PLAYLIST_NAME);
+    ASSERT_FALSE(url.empty());
+
+    std::string content;
+    ASSERT_TRUE(stream(url, &content, (PREFETCH_SEGMENTS + 1) * SEGMENT_DELAY));
+
+    std::string expected;
+    for (int i = 0; i < NUM_SEGMENTS; ++i) {
+        expected += getSegmentBody(getSegmentPath(0, i));
+    }
+    EXPECT_EQ(expected.size(), content.size());
+    EXPECT_TRUE(expected == content);
+    EXPECT_EQ(0, m_observer->m_errors);
+}
+
+/// Verify that nested playlists are resolved concurrently, and their segments still streamed in order.
+TEST_F(UrlContentToAttachmentConverterTest, resolvesNestedPlaylistsInOrder) {
+    auto url = m_server->getURL(MASTER_PLAYLIST_PATH);
+    ASSERT_FALSE(url.empty());
+
+    std::string content;
+    ASSERT_TRUE(stream(url, &content));
+
+    std::string expected;
+    for (int playlist = 1; playlist <= NUM_NESTED_PLAYLISTS; ++playlist) {
+        for (int i = 0; i < NUM_SEGMENTS; ++i) {
+            expected += getSegmentBody(getSegmentPath(playlist, i));
+        }
+    }
+    EXPECT_EQ(expected.size(), content.size());
+    EXPECT_TRUE(expected == content);
+    EXPECT_EQ(0, m_observer->m_errors);
+}
+
+/// Report how long a slow HLS stream takes to stream, against the time to download its segments one by one.  Both are
+/// recorded as test properties.  Disabled by default.
+TEST_F(UrlContentToAttachmentConverterTest, DISABLED_benchmarkSlowHLSStream) {
+    auto url = m_server->getURL("/0/" + MEDIA_PLAYLIST_NAME);
+    ASSERT_FALSE(url.empty());
+
+    std::string content;
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(stream(url, &content));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    RecordProperty(
+        "streamedMs", std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()));
+    RecordProperty("sequentialDownloadMs", std::to_string((NUM_SEGMENTS * SEGMENT_DELAY).count()));
+}
+
+}  // namespace test
+}  // namespace playlistParser
+}  // namespace alexaClientSDK
@@ -50,6 +50,8 @@ public:
      * Clear every customer data kept in the device.
      *
      * @note We do not guarantee the order that the CustomerDataHandlers are called.
+     * @note Each handler clears its own storage independently, so the data is not cleared atomically, even when the
+     * storage components share a single database file.
      */
     void clearData();
 
@@ -35,7 +35,9 @@ namespace cblAuthDelegate {
 class SQLiteCBLAuthDelegateStorage : public CBLAuthDelegateStorageInterface {
 public:
     /**
-     * Factory method for creating a storage object for CBLAuthDelegate based on an SQLite database.
+     * Factory method for creating a storage object for CBLAuthDelegate based on an SQLite database.  If the
+     * configuration has an @c SQLiteStorageEngine, the refresh token is stored by the engine instead of a file of its
+     * own.
      *
      * @param configurationRoot The global config object.
      * @return Pointer to the SQLiteCBLAuthDelegate object, nullptr if there's an error creating it.
@@ -64,6 +66,13 @@ private:
      */
     SQLiteCBLAuthDelegateStorage(const std::string& databaseFilePath);
 
+    /**
+     * Constructor for a storage object whose table is hosted by an @c SQLiteStorageEngine.
+     *
+     * @param engine The engine hosting the table.
+     */
+    SQLiteCBLAuthDelegateStorage(std::shared_ptr<storage::sqliteStorage::SQLiteStorageEngine> engine);
+
     /**
      * Close the database.
      */
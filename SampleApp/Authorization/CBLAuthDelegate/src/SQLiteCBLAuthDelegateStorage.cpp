@@ -14,6 +14,7 @@
  */
 
 #include <SQLiteStorage/SQLiteStatement.h>
+#include <SQLiteStorage/SQLiteStorageEngine.h>
 #include <SQLiteStorage/SQLiteUtils.h>
 #include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <AVSCommon/Utils/File/FileUtils.h>
@@ -41,6 +42,12 @@ static const std::string TAG("SQLiteCBLAuthDelegateStorage");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+/// The name of this storage as a component of an @c SQLiteStorageEngine.
+static const std::string CBL_AUTH_DELEGATE_COMPONENT_NAME = "cblAuthDelegate";
+
+/// The schema version of this storage as a component of an @c SQLiteStorageEngine.
+static const int CBL_AUTH_DELEGATE_SCHEMA_VERSION = 1;
+
 /// Name of @c ConfigurationNode for CBLAuthDelegate
 static const std::string CONFIG_KEY_CBL_AUTH_DELEGATE = "cblAuthDelegate";
 
@@ -59,6 +66,15 @@ static const std::string CREATE_REFRESH_TOKEN_TABLE_SQL_STRING =
 
 std::unique_ptr<SQLiteCBLAuthDelegateStorage> SQLiteCBLAuthDelegateStorage::create(
     const avsCommon::utils::configuration::ConfigurationNode& configurationRoot) {
+    std::shared_ptr<SQLiteStorageEngine> engine;
+    if (!SQLiteStorageEngine::getInstance(configurationRoot, &engine)) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "Could not get storage engine"));
+        return nullptr;
+    }
+    if (engine) {
+        return std::unique_ptr<SQLiteCBLAuthDelegateStorage>(new SQLiteCBLAuthDelegateStorage(engine));
+    }
+
     auto cblAuthDelegateConfigurationRoot = configurationRoot[CONFIG_KEY_CBL_AUTH_DELEGATE];
     if (!cblAuthDelegateConfigurationRoot) {
         ACSDK_ERROR(LX("createFailed").d("reason", "missingConfigurationValue").d("key", CONFIG_KEY_CBL_AUTH_DELEGATE));
@@ -224,6 +240,10 @@ SQLiteCBLAuthDelegateStorage::SQLiteCBLAuthDelegateStorage(const std::string& da
         m_database{databaseFilePath} {
 }
 
+SQLiteCBLAuthDelegateStorage::SQLiteCBLAuthDelegateStorage(std::shared_ptr<SQLiteStorageEngine> engine) :
+        m_database{std::move(engine), CBL_AUTH_DELEGATE_COMPONENT_NAME, CBL_AUTH_DELEGATE_SCHEMA_VERSION} {
+}
+
 }  // namespace cblAuthDelegate
 }  // namespace authorization
 }  // namespace alexaClientSDK
@@ -232,6 +232,11 @@ private:
     std::unique_ptr<kwd::AbstractKeywordDetector> m_keywordDetector;
 #endif
 
+#ifdef GSTREAMER_MEDIA_PLAYER
+    /// The cache of the built-in audio decoded to PCM, which the media players play without decoding it again.
+    std::shared_ptr<mediaPlayer::DecodedAudioCache> m_decodedAudioCache;
+#endif
+
 #if defined(ANDROID_MEDIA_PLAYER) || defined(ANDROID_MICROPHONE)
     /// The android OpenSL ES engine used to create media players and microphone.
     std::shared_ptr<applicationUtilities::androidUtilities::AndroidSLESEngine> m_openSlEngine;
@@ -345,6 +345,12 @@ bool SampleApplication::initialize(
 #ifdef ANDROID_LOGGER
     alexaClientSDK::avsCommon::utils::logger::LoggerSinkManager::instance().initialize(
         std::make_shared<applicationUtilities::androidUtilities::AndroidLogger>(logLevelValue));
+#elif defined(ACSDK_ASYNC_LOG_SINK)
+    auto asyncLogger = alexaClientSDK::avsCommon::utils::logger::ACSDK_GET_SINK_LOGGER();
+    if (alexaClientSDK::avsCommon::utils::logger::Level::UNKNOWN != logLevelValue) {
+        asyncLogger->setLevel(logLevelValue);
+    }
+    alexaClientSDK::avsCommon::utils::logger::LoggerSinkManager::instance().initialize(asyncLogger);
 #else
     alexaClientSDK::avsCommon::utils::logger::LoggerSinkManager::instance().initialize(consolePrinter);
 #endif
@@ -406,6 +412,16 @@ bool SampleApplication::initialize(
     }
 #endif
 
+    auto audioFactory = std::make_shared<alexaClientSDK::applicationUtilities::resources::audio::AudioFactory>();
+
+#ifdef GSTREAMER_MEDIA_PLAYER
+    // Decode the built-in alert tones and earcons once, rather than each time the media players play them.
+    m_decodedAudioCache = mediaPlayer::DecodedAudioCache::create();
+    if (m_decodedAudioCache) {
+        m_decodedAudioCache->prefetch(audioFactory);
+    }
+#endif
+
     std::shared_ptr<alexaClientSDK::avsCommon::sdkInterfaces::SpeakerInterface> speakSpeaker;
     std::tie(m_speakMediaPlayer, speakSpeaker) = createApplicationMediaPlayer(
         httpContentFetcherFactory,
@@ -480,8 +496,6 @@ bool SampleApplication::initialize(
         return false;
     }
 
-    auto audioFactory = std::make_shared<alexaClientSDK::applicationUtilities::resources::audio::AudioFactory>();
-
     // Creating equalizers
     if (nullptr != equalizerRuntimeSetup) {
         equalizerRuntimeSetup->addEqualizer(m_audioMediaPlayer);
@@ -839,8 +853,8 @@ SampleApplication::createApplicationMediaPlayer(
      * Note the externalMusicProviderMediaPlayer is not added to the set of SpeakerInterfaces as there would be
      * more actions needed for these beyond setting the volume control on the MediaPlayer.
      */
-    auto mediaPlayer =
-        alexaClientSDK::mediaPlayer::MediaPlayer::create(httpContentFetcherFactory, enableEqualizer, type, name);
+    auto mediaPlayer = alexaClientSDK::mediaPlayer::MediaPlayer::create(
+        httpContentFetcherFactory, enableEqualizer, type, name, m_decodedAudioCache);
     return {mediaPlayer,
             std::static_pointer_cast<alexaClientSDK::avsCommon::sdkInterfaces::SpeakerInterface>(mediaPlayer)};
 #elif defined(ANDROID_MEDIA_PLAYER)
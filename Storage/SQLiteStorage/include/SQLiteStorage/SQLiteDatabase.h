@@ -16,8 +16,13 @@
 #ifndef ALEXA_CLIENT_SDK_STORAGE_SQLITESTORAGE_INCLUDE_SQLITESTORAGE_SQLITEDATABASE_H_
 #define ALEXA_CLIENT_SDK_STORAGE_SQLITESTORAGE_INCLUDE_SQLITESTORAGE_SQLITEDATABASE_H_
 
+#include <cstddef>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <sqlite3.h>
@@ -28,13 +33,75 @@ namespace alexaClientSDK {
 namespace storage {
 namespace sqliteStorage {
 
+class SQLiteStorageEngine;
+
 /**
  * A basic class for performing basic SQLite database operations.  This the boilerplate code used to manage the
  * SQLiteDatabase.  This database is not thread-safe, and must be protected before being used in a mutlithreaded
  * fashion.
+ *
+ * Each connection is tuned with a @c ConnectionProfile, and keeps the statements it has prepared in a least recently
+ * used cache keyed by their SQL, so that the hot statements of a storage class are only prepared once.
+ *
+ * A database created for a component of an @c SQLiteStorageEngine shares the connection of the engine instead of
+ * opening a file of its own.  Its operations, statements and transactions hold the connection for their duration, so
+ * such a database may be used by several threads, as long as each statement and transaction is used by one thread.
  */
 class SQLiteDatabase {
+    /// Allow @c SQLiteStatement to return its statement handle to the statement cache.
+    friend SQLiteStatement;
+
+    /// Allow @c SQLiteStorageEngine to share its connection with the database of each component.
+    friend SQLiteStorageEngine;
+
 public:
+    /**
+     * The settings applied to each connection when it is opened.  They are read from the @c sqliteStorage root of the
+     * configuration, for example:
+     *
+     * @code{.json}
+     * "sqliteStorage": {
+     *     "journalMode": "WAL",
+     *     "synchronous": "NORMAL",
+     *     "mmapSize": 1048576,
+     *     "cacheSize": -512,
+     *     "statementCacheSize": 32
+     * }
+     * @endcode
+     *
+     * See https://sqlite.org/pragma.html for the meaning of each pragma.
+     */
+    struct ConnectionProfile {
+        /**
+         * Constructor.  The profile uses write-ahead logging and a statement cache, leaving every other setting at the
+         * SQLite default.
+         */
+        ConnectionProfile();
+
+        /**
+         * Creates a profile from the @c sqliteStorage root of the configuration.  Settings which are missing or
+         * invalid keep their default value.
+         *
+         * @return The profile.
+         */
+        static ConnectionProfile createFromConfiguration();
+
+        /// The @c journal_mode pragma, such as "WAL" or "DELETE".  Empty leaves the SQLite default.
+        std::string journalMode;
+
+        /// The @c synchronous pragma, such as "NORMAL" or "FULL".  Empty leaves the SQLite default.
+        std::string synchronous;
+
+        /// The @c mmap_size pragma, in bytes.  Negative leaves the SQLite default.
+        int mmapSize;
+
+        /// The @c cache_size pragma, in pages, or in KiB if negative.  Zero leaves the SQLite default.
+        int cacheSize;
+
+        /// The maximum number of idle prepared statements to keep for reuse.  Zero disables the statement cache.
+        size_t statementCacheSize;
+    };
+
     /**
      * Class to manage SQL transaction lifecycle.
      */
@@ -89,6 +156,26 @@ public:
      */
     SQLiteDatabase(const std::string& filePath);
 
+    /**
+     * Constructor with an explicit connection profile, instead of the one in the configuration.
+     *
+     * @param filePath The location of the file that the SQLite DB will use as it's backing storage when initialize or
+     * open are called.
+     * @param profile The settings applied to each connection.
+     */
+    SQLiteDatabase(const std::string& filePath, const ConnectionProfile& profile);
+
+    /**
+     * Constructor for the database of a component of an @c SQLiteStorageEngine.  Creating it with @c initialize
+     * records the schema version of the component, and @c open fails until it has been created.
+     *
+     * @param engine The engine hosting the tables of the component.
+     * @param componentName The name of the component, which must be unique within the engine.
+     * @param schemaVersion The version of the tables of the component.  If @c open finds a different version, the
+     * component's own @c open is expected to migrate its tables, and the new version is recorded.
+     */
+    SQLiteDatabase(std::shared_ptr<SQLiteStorageEngine> engine, const std::string& componentName, int schemaVersion);
+
     /**
      * Destructor.
      *
@@ -145,7 +232,8 @@ public:
     void close();
 
     /**
-     * Create an SQLiteStatement object to execute the provided string.
+     * Create an SQLiteStatement object to execute the provided string.  A statement for the same SQL which has been
+     * finalized is reused if it is still in the statement cache.
      *
      * @param sqlString The SQL command to execute.
      * @return A unique_ptr to the SQLiteStatement that represents the sqlString.
@@ -160,13 +248,52 @@ public:
     bool isDatabaseReady();
 
     /**
-     * Begins transaction.
+     * Begins transaction.  The transaction of the database of a component of an @c SQLiteStorageEngine is nested in
+     * any transaction the engine is performing, and holds the connection until it is completed, so it must be
+     * completed by the thread which began it.
      *
      * @return true if query succeeded, false otherwise
      */
     std::unique_ptr<Transaction> beginTransaction();
 
 private:
+    /// An idle prepared statement, with the SQL it was prepared for.
+    using CachedStatement = std::pair<std::string, sqlite3_stmt*>;
+
+    /**
+     * Applies the connection profile to the open connection.  The database remains usable with the SQLite defaults
+     * if a setting cannot be applied.
+     */
+    void applyConnectionProfile();
+
+    /**
+     * Takes a statement handle for the SQL out of the statement cache.
+     *
+     * @param sqlString The SQL of the statement.
+     * @return The statement handle, or @c nullptr if there is none in the cache.
+     */
+    sqlite3_stmt* acquireCachedStatement(const std::string& sqlString);
+
+    /**
+     * Resets a statement handle which is no longer used, clears its bindings and puts it in the statement cache,
+     * evicting the least recently used statement if the cache is full.  The statement handle is released instead if
+     * it cannot be reused.
+     *
+     * @param sqlString The SQL of the statement.
+     * @param handle The statement handle.
+     */
+    void releaseStatement(const std::string& sqlString, sqlite3_stmt* handle);
+
+    /// Releases every statement handle in the statement cache.
+    void clearStatementCache();
+
+    /**
+     * Locks the connection for the calling thread if it is shared with other components.
+     *
+     * @return The lock, which does not own a mutex if the connection is not shared.
+     */
+    std::unique_lock<std::recursive_mutex> lockConnection();
+
     /**
      * Commits the transaction started with @c beginTransaction.
      *
@@ -189,6 +316,27 @@ private:
     /// The sqlite database handle.
     sqlite3* m_dbHandle;
 
+    /// The settings applied to each connection.
+    const ConnectionProfile m_profile;
+
+    /// The idle prepared statements, from the most to the least recently used.
+    std::list<CachedStatement> m_cachedStatements;
+
+    /// The idle prepared statements, by their SQL.
+    std::unordered_map<std::string, std::list<CachedStatement>::iterator> m_cachedStatementsBySql;
+
+    /// The engine whose connection this database shares, if any.
+    std::shared_ptr<SQLiteStorageEngine> m_engine;
+
+    /// The name of the component of the engine, if any.
+    const std::string m_componentName;
+
+    /// The schema version of the component of the engine, if any.
+    const int m_schemaVersion;
+
+    /// The lock on the shared connection held by the transaction in progress, if any.
+    std::unique_lock<std::recursive_mutex> m_transactionLock;
+
     /**
      * A shared_ptr to this that is used to manage viability of weak_ptrs to this.  This shared_ptr has a no-op deleter,
      * and does not manage the lifecycle of this instance.  Instead, ~SQLiteDatabase() resets this shared_ptr to signal
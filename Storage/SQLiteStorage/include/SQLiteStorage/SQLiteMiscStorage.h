@@ -31,7 +31,8 @@ class SQLiteMiscStorage : public avsCommon::sdkInterfaces::storage::MiscStorageI
 public:
     /**
      * Factory method for creating a storage object for a SQLite database.
-     * Note that the actual database will not be created by this function.
+     * Note that the actual database will not be created by this function.  If the configuration has an
+     * @c SQLiteStorageEngine, its tables are hosted by the engine instead of a file of their own.
      *
      * @param configurationRoot The global config object.
      * @return Pointer to the SQLiteAlertStorage object, nullptr if there's an error creating it.
@@ -109,6 +110,13 @@ private:
      */
     SQLiteMiscStorage(const std::string& dbFilePath);
 
+    /**
+     * Constructor for a storage object whose tables are hosted by an @c SQLiteStorageEngine.
+     *
+     * @param engine The engine hosting the tables.
+     */
+    SQLiteMiscStorage(std::shared_ptr<SQLiteStorageEngine> engine);
+
     /**
      * Method that will get the key column type and value column type.
      *
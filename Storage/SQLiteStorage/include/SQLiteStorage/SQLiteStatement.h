@@ -16,6 +16,8 @@
 #ifndef ALEXA_CLIENT_SDK_STORAGE_SQLITESTORAGE_INCLUDE_SQLITESTORAGE_SQLITESTATEMENT_H_
 #define ALEXA_CLIENT_SDK_STORAGE_SQLITESTORAGE_INCLUDE_SQLITESTORAGE_SQLITESTATEMENT_H_
 
+#include <memory>
+#include <mutex>
 #include <sqlite3.h>
 #include <string>
 
@@ -23,6 +25,8 @@ namespace alexaClientSDK {
 namespace storage {
 namespace sqliteStorage {
 
+class SQLiteDatabase;
+
 /**
  * A utility class to simplify interaction with a SQLite statement.  In particular, the resource management
  * operations which are common to many functions are captured in this class's constructor and destructor, as well
@@ -32,6 +36,9 @@ namespace sqliteStorage {
  * for SQLite for further guidance.  This is a good place to begin:
  *
  * https://sqlite.org/c3ref/intro.html
+ *
+ * A statement created by an @c SQLiteDatabase is returned to that database's statement cache when it is finalized,
+ * instead of being released, so that the next statement with the same SQL can skip preparing it again.
  */
 class SQLiteStatement {
 public:
@@ -40,8 +47,31 @@ public:
      *
      * @param dbHandle A SQLite database handle.
      * @param sqlString The SQL which this statement object will perform.
+     * @param database The database to return the statement handle to when this statement is finalized, if any.
+     * @param connectionLock A lock on the connection, if it is shared, which this statement holds until it is
+     * finalized.
+     */
+    SQLiteStatement(
+        sqlite3* dbHandle,
+        const std::string& sqlString,
+        std::weak_ptr<SQLiteDatabase> database = std::weak_ptr<SQLiteDatabase>(),
+        std::unique_lock<std::recursive_mutex> connectionLock = std::unique_lock<std::recursive_mutex>());
+
+    /**
+     * Constructor for a statement which is returned to the statement cache of a database when it is finalized.
+     *
+     * @param handle A SQLite statement handle prepared for @c sqlString, which this object takes ownership of.
+     * @param sqlString The SQL which this statement object will perform.
+     * @param database The database to return the statement handle to.  If it no longer exists when this statement is
+     * finalized, the statement handle is released instead.
+     * @param connectionLock A lock on the connection, if it is shared, which this statement holds until it is
+     * finalized.
      */
-    SQLiteStatement(sqlite3* dbHandle, const std::string& sqlString);
+    SQLiteStatement(
+        sqlite3_stmt* handle,
+        const std::string& sqlString,
+        std::weak_ptr<SQLiteDatabase> database,
+        std::unique_lock<std::recursive_mutex> connectionLock = std::unique_lock<std::recursive_mutex>());
 
     /**
      * Destructor.
@@ -174,7 +204,8 @@ public:
     int64_t getColumnInt64(int index) const;
 
     /**
-     * Releases the SQLite resources.
+     * Releases the SQLite resources, or returns them to the statement cache of the database which created this
+     * statement.
      */
     void finalize();
 
@@ -184,6 +215,15 @@ private:
 
     /// The result of the last step operation.
     int m_stepResult;
+
+    /// The SQL which this statement performs, if it is returned to a statement cache.
+    std::string m_sqlString;
+
+    /// The database whose statement cache this statement is returned to, if any.
+    std::weak_ptr<SQLiteDatabase> m_database;
+
+    /// The lock on the shared connection held until this statement is finalized, if any.
+    std::unique_lock<std::recursive_mutex> m_connectionLock;
 };
 
 }  // namespace sqliteStorage
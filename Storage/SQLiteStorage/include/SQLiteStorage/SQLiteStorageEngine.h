@@ -0,0 +1,172 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_STORAGE_SQLITESTORAGE_INCLUDE_SQLITESTORAGE_SQLITESTORAGEENGINE_H_
+#define ALEXA_CLIENT_SDK_STORAGE_SQLITESTORAGE_INCLUDE_SQLITESTORAGE_SQLITESTORAGEENGINE_H_
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <sqlite3.h>
+
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
+#include <SQLiteStorage/SQLiteDatabase.h>
+
+namespace alexaClientSDK {
+namespace storage {
+namespace sqliteStorage {
+
+/**
+ * A single SQLite database file which hosts the tables of every storage component, so that the SDK opens one
+ * connection with one page cache instead of one per component, and a transaction can span components.
+ *
+ * Each component accesses the engine through an @c SQLiteDatabase created for it with
+ * @c SQLiteDatabase(engine, componentName, schemaVersion), which behaves like a database of its own: it is created once
+ * per component, and its schema version is recorded by the engine.  Access to the connection is serialized, so that
+ * only one component writes at a time and the transaction of one component never includes the writes of another.
+ *
+ * The engine is used when the @c databaseFilePath of the @c sqliteStorage root of the configuration is set, for
+ * example:
+ *
+ * @code{.json}
+ * "sqliteStorage": {
+ *     "databaseFilePath": "/home/ubuntu/Build/alexa.db"
+ * }
+ * @endcode
+ *
+ * This class is thread-safe.
+ */
+class SQLiteStorageEngine {
+    /// Allow the @c SQLiteDatabase of each component to access the connection.
+    friend SQLiteDatabase;
+
+public:
+    /**
+     * Gets the engine shared by every storage component, if the configuration has one.  The engine is opened, or
+     * created if its file does not exist yet, by the first component to get it, and closed when the last component
+     * releases it.
+     *
+     * @param configurationRoot The global config object.
+     * @param[out] engine The engine, or @c nullptr if the configuration has no shared database file.
+     * @return false if the configuration has a shared database file which could not be opened, true otherwise.
+     */
+    static bool getInstance(
+        const avsCommon::utils::configuration::ConfigurationNode& configurationRoot,
+        std::shared_ptr<SQLiteStorageEngine>* engine);
+
+    /**
+     * Creates an engine, which opens the database file, or creates it if it does not exist yet.
+     *
+     * @param filePath The path of the database file.
+     * @param profile The settings applied to the connection.
+     * @return The engine, or @c nullptr if the database file could not be opened or created.
+     */
+    static std::shared_ptr<SQLiteStorageEngine> create(
+        const std::string& filePath,
+        const SQLiteDatabase::ConnectionProfile& profile);
+
+    /**
+     * Destructor.  The connection is closed.
+     */
+    ~SQLiteStorageEngine();
+
+    /**
+     * Gets the path of the database file.
+     *
+     * @return The path of the database file.
+     */
+    std::string getFilePath() const;
+
+    /**
+     * Gets the schema version of a component.
+     *
+     * @param componentName The name of the component.
+     * @return The schema version, or 0 if the component has not created its tables yet.
+     */
+    int getSchemaVersion(const std::string& componentName);
+
+    /**
+     * Performs a task in a single transaction, so that the writes of several components are committed together, or
+     * not at all.  The transactions which components begin during the task are nested in it.
+     *
+     * The connection is held for the whole task, so the task must not wait for other threads which use the storage,
+     * nor for locks which they may hold while they use it.
+     *
+     * @param task The task, which returns whether its writes should be committed.
+     * @return Whether the task succeeded and its writes were committed.
+     */
+    bool executeInTransaction(std::function<bool()> task);
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param filePath The path of the database file.
+     * @param profile The settings applied to the connection.
+     */
+    SQLiteStorageEngine(const std::string& filePath, const SQLiteDatabase::ConnectionProfile& profile);
+
+    /**
+     * Opens the database file, or creates it if it does not exist yet, and creates the schema version table.
+     *
+     * @return Whether the database is ready.
+     */
+    bool initialize();
+
+    /**
+     * Records the schema version of a component.  The connection lock must be held.
+     *
+     * @param componentName The name of the component.
+     * @param version The schema version.
+     * @return Whether the schema version was recorded.
+     */
+    bool setSchemaVersionLocked(const std::string& componentName, int version);
+
+    /**
+     * Gets the schema version of a component.  The connection lock must be held.
+     *
+     * @param componentName The name of the component.
+     * @return The schema version, or 0 if the component has not created its tables yet.
+     */
+    int getSchemaVersionLocked(const std::string& componentName);
+
+    /**
+     * Locks the connection for the calling thread.  The lock may be taken again by the thread which holds it.
+     *
+     * @return The lock.
+     */
+    std::unique_lock<std::recursive_mutex> lockConnection();
+
+    /**
+     * Gets the connection.
+     *
+     * @return The SQLite database handle.
+     */
+    sqlite3* getHandle();
+
+    /// Serializes access to the connection.
+    std::recursive_mutex m_connectionMutex;
+
+    /// The database holding the tables of every component.
+    SQLiteDatabase m_database;
+};
+
+}  // namespace sqliteStorage
+}  // namespace storage
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_STORAGE_SQLITESTORAGE_INCLUDE_SQLITESTORAGE_SQLITESTORAGEENGINE_H_
@@ -14,9 +14,12 @@
  */
 
 #include "SQLiteStorage/SQLiteDatabase.h"
+#include "SQLiteStorage/SQLiteStorageEngine.h"
 
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <AVSCommon/Utils/File/FileUtils.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
+#include <algorithm>
 #include <utility>
 #include "SQLiteStorage/SQLiteUtils.h"
 
@@ -34,14 +37,141 @@ static const std::string TAG("SQLiteDatabase");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+/// The root key for the connection profile in the configuration.
+static const std::string SQLITE_STORAGE_CONFIGURATION_ROOT_KEY = "sqliteStorage";
+
+/// The key for the journal mode in the connection profile configuration.
+static const std::string JOURNAL_MODE_KEY = "journalMode";
+
+/// The key for the synchronous setting in the connection profile configuration.
+static const std::string SYNCHRONOUS_KEY = "synchronous";
+
+/// The key for the memory-mapped I/O size in the connection profile configuration.
+static const std::string MMAP_SIZE_KEY = "mmapSize";
+
+/// The key for the page cache size in the connection profile configuration.
+static const std::string CACHE_SIZE_KEY = "cacheSize";
+
+/// The key for the statement cache size in the connection profile configuration.
+static const std::string STATEMENT_CACHE_SIZE_KEY = "statementCacheSize";
+
+/// The journal mode used by default.
+static const std::string DEFAULT_JOURNAL_MODE = "WAL";
+
+/// The number of idle prepared statements kept for reuse by default.
+static const int DEFAULT_STATEMENT_CACHE_SIZE = 32;
+
+/// The SQL string to count the tables with a name.
+static const std::string TABLE_EXISTS_SQL_STRING = "SELECT count(*) FROM sqlite_master WHERE type='table' AND name=?;";
+
+/// The SQL string to begin a transaction.
+static const std::string BEGIN_TRANSACTION_SQL_STRING = "BEGIN TRANSACTION;";
+
+/// The SQL string to commit a transaction.
+static const std::string COMMIT_TRANSACTION_SQL_STRING = "COMMIT TRANSACTION;";
+
+/// The SQL string to roll back a transaction.
+static const std::string ROLLBACK_TRANSACTION_SQL_STRING = "ROLLBACK TRANSACTION;";
+
+/// The valid values of the journal mode.
+static const std::vector<std::string> JOURNAL_MODES = {"DELETE", "TRUNCATE", "PERSIST", "MEMORY", "WAL", "OFF"};
+
+/// The valid values of the synchronous setting.
+static const std::vector<std::string> SYNCHRONOUS_MODES = {"OFF", "NORMAL", "FULL", "EXTRA"};
+
+/**
+ * Reads a pragma value from the connection profile configuration.
+ *
+ * @param configurationRoot The connection profile configuration.
+ * @param key The key of the value.
+ * @param validValues The valid values.
+ * @param[in,out] value The value, which is left as is if the configuration has no valid value.
+ */
+static void getPragmaValue(
+    const avsCommon::utils::configuration::ConfigurationNode& configurationRoot,
+    const std::string& key,
+    const std::vector<std::string>& validValues,
+    std::string* value) {
+    std::string configuredValue;
+    if (!configurationRoot.getString(key, &configuredValue)) {
+        return;
+    }
+    std::transform(configuredValue.begin(), configuredValue.end(), configuredValue.begin(), ::toupper);
+    if (std::find(validValues.begin(), validValues.end(), configuredValue) == validValues.end()) {
+        ACSDK_WARN(LX("getPragmaValueFailed").d("reason", "invalidValue").d("key", key).d("value", configuredValue));
+        return;
+    }
+    *value = configuredValue;
+}
+
+SQLiteDatabase::ConnectionProfile::ConnectionProfile() :
+        journalMode{DEFAULT_JOURNAL_MODE},
+        mmapSize{-1},
+        cacheSize{0},
+        statementCacheSize{DEFAULT_STATEMENT_CACHE_SIZE} {
+}
+
+SQLiteDatabase::ConnectionProfile SQLiteDatabase::ConnectionProfile::createFromConfiguration() {
+    ConnectionProfile profile;
+    auto configurationRoot =
+        avsCommon::utils::configuration::ConfigurationNode::getRoot()[SQLITE_STORAGE_CONFIGURATION_ROOT_KEY];
+    if (!configurationRoot) {
+        return profile;
+    }
+
+    getPragmaValue(configurationRoot, JOURNAL_MODE_KEY, JOURNAL_MODES, &profile.journalMode);
+    getPragmaValue(configurationRoot, SYNCHRONOUS_KEY, SYNCHRONOUS_MODES, &profile.synchronous);
+    configurationRoot.getInt(MMAP_SIZE_KEY, &profile.mmapSize, profile.mmapSize);
+    configurationRoot.getInt(CACHE_SIZE_KEY, &profile.cacheSize, profile.cacheSize);
+
+    int statementCacheSize = DEFAULT_STATEMENT_CACHE_SIZE;
+    configurationRoot.getInt(STATEMENT_CACHE_SIZE_KEY, &statementCacheSize, statementCacheSize);
+    if (statementCacheSize < 0) {
+        ACSDK_WARN(LX("createFromConfigurationFailed")
+                       .d("reason", "invalidValue")
+                       .d("key", STATEMENT_CACHE_SIZE_KEY)
+                       .d("value", statementCacheSize));
+    } else {
+        profile.statementCacheSize = static_cast<size_t>(statementCacheSize);
+    }
+
+    return profile;
+}
+
 SQLiteDatabase::SQLiteDatabase(const std::string& storageFilePath) :
+        SQLiteDatabase{storageFilePath, ConnectionProfile::createFromConfiguration()} {
+}
+
+SQLiteDatabase::SQLiteDatabase(const std::string& storageFilePath, const ConnectionProfile& profile) :
         m_storageFilePath{storageFilePath},
         m_transactionIsInProgress{false},
-        m_dbHandle{nullptr} {
+        m_dbHandle{nullptr},
+        m_profile(profile),
+        m_schemaVersion{0} {
+    m_sharedThisPlaceholder = std::shared_ptr<SQLiteDatabase>(this, [](SQLiteDatabase*) {});
+}
+
+SQLiteDatabase::SQLiteDatabase(
+    std::shared_ptr<SQLiteStorageEngine> engine,
+    const std::string& componentName,
+    int schemaVersion) :
+        m_storageFilePath{engine->getFilePath()},
+        m_transactionIsInProgress{false},
+        m_dbHandle{nullptr},
+        m_profile(engine->m_database.m_profile),
+        m_engine{std::move(engine)},
+        m_componentName{componentName},
+        m_schemaVersion{schemaVersion} {
     m_sharedThisPlaceholder = std::shared_ptr<SQLiteDatabase>(this, [](SQLiteDatabase*) {});
 }
 
 SQLiteDatabase::~SQLiteDatabase() {
+    // Roll back before closing, as a shared connection stays open after this database is closed.
+    if (m_transactionIsInProgress) {
+        ACSDK_ERROR(LX(__func__).d("reason", "There is an incomplete transaction. Rolling it back."));
+        rollbackTransaction();
+    }
+
     if (m_dbHandle) {
         ACSDK_WARN(
             LX(__func__).m("DB wasn't closed before destruction of SQLiteDatabase").d("file path", m_storageFilePath));
@@ -52,21 +182,30 @@ SQLiteDatabase::~SQLiteDatabase() {
         close();
     }
 
-    if (m_transactionIsInProgress) {
-        ACSDK_ERROR(LX(__func__).d("reason", "There is an incomplete transaction. Rolling it back."));
-        rollbackTransaction();
-    }
-
     // Reset the shared_ptr so transaction's weak_ptr will invalidate.
     m_sharedThisPlaceholder.reset();
 }
 
 bool SQLiteDatabase::initialize() {
+    auto lock = lockConnection();
     if (m_dbHandle) {
         ACSDK_ERROR(LX(__func__).m("Database is already open."));
         return false;
     }
 
+    if (m_engine) {
+        if (m_engine->getSchemaVersionLocked(m_componentName) != 0) {
+            ACSDK_ERROR(LX(__func__).m("Component already exists.").d("component", m_componentName));
+            return false;
+        }
+        if (!m_engine->setSchemaVersionLocked(m_componentName, m_schemaVersion)) {
+            ACSDK_ERROR(LX(__func__).m("Component could not be created.").d("component", m_componentName));
+            return false;
+        }
+        m_dbHandle = m_engine->getHandle();
+        return true;
+    }
+
     if (avsCommon::utils::file::fileExists(m_storageFilePath)) {
         ACSDK_ERROR(LX(__func__).m("File specified already exists.").d("file path", m_storageFilePath));
         return false;
@@ -78,15 +217,38 @@ bool SQLiteDatabase::initialize() {
         return false;
     }
 
+    applyConnectionProfile();
     return true;
 }
 
 bool SQLiteDatabase::open() {
+    auto lock = lockConnection();
     if (m_dbHandle) {
         ACSDK_ERROR(LX(__func__).m("Database is already open."));
         return false;
     }
 
+    if (m_engine) {
+        auto schemaVersion = m_engine->getSchemaVersionLocked(m_componentName);
+        if (0 == schemaVersion) {
+            ACSDK_DEBUG0(LX(__func__).m("Component does not exist.").d("component", m_componentName));
+            return false;
+        }
+        if (schemaVersion != m_schemaVersion) {
+            ACSDK_INFO(LX(__func__)
+                           .m("Schema version changed.")
+                           .d("component", m_componentName)
+                           .d("from", schemaVersion)
+                           .d("to", m_schemaVersion));
+            if (!m_engine->setSchemaVersionLocked(m_componentName, m_schemaVersion)) {
+                ACSDK_ERROR(LX(__func__).m("Schema version could not be recorded.").d("component", m_componentName));
+                return false;
+            }
+        }
+        m_dbHandle = m_engine->getHandle();
+        return true;
+    }
+
     if (!avsCommon::utils::file::fileExists(m_storageFilePath)) {
         ACSDK_DEBUG0(LX(__func__).m("File specified does not exist.").d("file path", m_storageFilePath));
         return false;
@@ -98,14 +260,38 @@ bool SQLiteDatabase::open() {
         return false;
     }
 
+    applyConnectionProfile();
     return true;
 }
 
+void SQLiteDatabase::applyConnectionProfile() {
+    std::vector<std::string> pragmas;
+    if (!m_profile.journalMode.empty()) {
+        pragmas.push_back("PRAGMA journal_mode=" + m_profile.journalMode + ";");
+    }
+    if (!m_profile.synchronous.empty()) {
+        pragmas.push_back("PRAGMA synchronous=" + m_profile.synchronous + ";");
+    }
+    if (m_profile.mmapSize >= 0) {
+        pragmas.push_back("PRAGMA mmap_size=" + std::to_string(m_profile.mmapSize) + ";");
+    }
+    if (m_profile.cacheSize != 0) {
+        pragmas.push_back("PRAGMA cache_size=" + std::to_string(m_profile.cacheSize) + ";");
+    }
+
+    for (auto& pragma : pragmas) {
+        if (!performQuery(pragma)) {
+            ACSDK_WARN(LX("applyConnectionProfileFailed").d("pragma", pragma).d("file path", m_storageFilePath));
+        }
+    }
+}
+
 bool SQLiteDatabase::isDatabaseReady() {
     return (m_dbHandle != nullptr);
 }
 
 bool SQLiteDatabase::performQuery(const std::string& sqlString) {
+    auto lock = lockConnection();
     if (!alexaClientSDK::storage::sqliteStorage::performQuery(m_dbHandle, sqlString)) {
         ACSDK_ERROR(LX("performQueryFailed").d("SQL string", sqlString));
         return false;
@@ -115,7 +301,10 @@ bool SQLiteDatabase::performQuery(const std::string& sqlString) {
 }
 
 bool SQLiteDatabase::tableExists(const std::string& tableName) {
-    if (!alexaClientSDK::storage::sqliteStorage::tableExists(m_dbHandle, tableName)) {
+    // Every operation of most storage classes checks its table first, so this uses a statement which can be reused.
+    auto statement = m_dbHandle ? createStatement(TABLE_EXISTS_SQL_STRING) : nullptr;
+    if (!statement || !statement->bindStringParameter(1, tableName) || !statement->step() ||
+        statement->getStepResult() != SQLITE_ROW || statement->getColumnInt(0) != 1) {
         ACSDK_DEBUG0(
             LX(__func__).d("reason", "table doesn't exist or there was an error checking").d("table", tableName));
         return false;
@@ -124,6 +313,7 @@ bool SQLiteDatabase::tableExists(const std::string& tableName) {
 }
 
 bool SQLiteDatabase::clearTable(const std::string& tableName) {
+    auto lock = lockConnection();
     if (!alexaClientSDK::storage::sqliteStorage::clearTable(m_dbHandle, tableName)) {
         ACSDK_ERROR(LX(__func__).d("could not clear table", tableName));
         return false;
@@ -133,7 +323,13 @@ bool SQLiteDatabase::clearTable(const std::string& tableName) {
 }
 
 void SQLiteDatabase::close() {
-    if (m_dbHandle) {
+    auto lock = lockConnection();
+    if (m_dbHandle && m_engine) {
+        // The connection stays open for the other components of the engine.
+        clearStatementCache();
+        m_dbHandle = nullptr;
+    } else if (m_dbHandle) {
+        clearStatementCache();
         closeSQLiteDatabase(m_dbHandle);
         m_dbHandle = nullptr;
     }
@@ -141,8 +337,21 @@ void SQLiteDatabase::close() {
 
 std::unique_ptr<alexaClientSDK::storage::sqliteStorage::SQLiteStatement> SQLiteDatabase::createStatement(
     const std::string& sqlString) {
+    auto lock = lockConnection();
+    auto cachedHandle = acquireCachedStatement(sqlString);
+    if (cachedHandle) {
+        return std::unique_ptr<SQLiteStatement>(
+            new SQLiteStatement(cachedHandle, sqlString, m_sharedThisPlaceholder, std::move(lock)));
+    }
+
+    // Only statements which can be reused are returned to the statement cache when they are finalized.
+    std::weak_ptr<SQLiteDatabase> database;
+    if (m_profile.statementCacheSize > 0) {
+        database = m_sharedThisPlaceholder;
+    }
+
     std::unique_ptr<alexaClientSDK::storage::sqliteStorage::SQLiteStatement> statement(
-        new SQLiteStatement(m_dbHandle, sqlString));
+        new SQLiteStatement(m_dbHandle, sqlString, database, std::move(lock)));
     if (!statement->isValid()) {
         ACSDK_ERROR(LX("createStatementFailed").d("sqlString", sqlString));
         statement = nullptr;
@@ -151,19 +360,73 @@ std::unique_ptr<alexaClientSDK::storage::sqliteStorage::SQLiteStatement> SQLiteD
     return statement;
 }
 
+sqlite3_stmt* SQLiteDatabase::acquireCachedStatement(const std::string& sqlString) {
+    auto it = m_cachedStatementsBySql.find(sqlString);
+    if (it == m_cachedStatementsBySql.end()) {
+        return nullptr;
+    }
+    auto handle = it->second->second;
+    m_cachedStatements.erase(it->second);
+    m_cachedStatementsBySql.erase(it);
+    return handle;
+}
+
+void SQLiteDatabase::releaseStatement(const std::string& sqlString, sqlite3_stmt* handle) {
+    // Resetting ends any read the statement has in progress, and clearing the bindings drops references to strings
+    // which the statement does not own.
+    sqlite3_reset(handle);
+    sqlite3_clear_bindings(handle);
+
+    // A statement of a connection which has since been closed, or for SQL which already has an idle statement, is
+    // not reused.
+    if (!m_dbHandle || sqlite3_db_handle(handle) != m_dbHandle || 0 == m_profile.statementCacheSize ||
+        m_cachedStatementsBySql.count(sqlString)) {
+        sqlite3_finalize(handle);
+        return;
+    }
+
+    m_cachedStatements.emplace_front(sqlString, handle);
+    m_cachedStatementsBySql[sqlString] = m_cachedStatements.begin();
+
+    if (m_cachedStatements.size() > m_profile.statementCacheSize) {
+        auto& leastRecentlyUsed = m_cachedStatements.back();
+        m_cachedStatementsBySql.erase(leastRecentlyUsed.first);
+        sqlite3_finalize(leastRecentlyUsed.second);
+        m_cachedStatements.pop_back();
+    }
+}
+
+std::unique_lock<std::recursive_mutex> SQLiteDatabase::lockConnection() {
+    if (!m_engine) {
+        return std::unique_lock<std::recursive_mutex>();
+    }
+    return m_engine->lockConnection();
+}
+
+void SQLiteDatabase::clearStatementCache() {
+    for (auto& cachedStatement : m_cachedStatements) {
+        sqlite3_finalize(cachedStatement.second);
+    }
+    m_cachedStatements.clear();
+    m_cachedStatementsBySql.clear();
+}
+
 std::unique_ptr<SQLiteDatabase::Transaction> SQLiteDatabase::beginTransaction() {
+    auto lock = lockConnection();
     if (m_transactionIsInProgress) {
         ACSDK_ERROR(LX("beginTransactionFailed").d("reason", "Only one transaction at a time is allowed"));
         return nullptr;
     }
 
-    const std::string sqlString = "BEGIN TRANSACTION;";
+    // The transaction of a component is a savepoint, so that it can be nested in a transaction of the engine.
+    const std::string sqlString = m_engine ? "SAVEPOINT \"" + m_componentName + "\";" : BEGIN_TRANSACTION_SQL_STRING;
     if (!performQuery(sqlString)) {
         ACSDK_ERROR(LX("beginTransactionFailed").d("reason", "Query failed"));
         return nullptr;
     }
 
     m_transactionIsInProgress = true;
+    m_transactionLock = std::move(lock);
     return std::unique_ptr<Transaction>(new Transaction(m_sharedThisPlaceholder));
 }
 
@@ -172,13 +435,17 @@ bool SQLiteDatabase::commitTransaction() {
         ACSDK_ERROR(LX("commitTransactionFailed").d("reason", "No transaction in progress"));
         return false;
     }
-    const std::string sqlString = "COMMIT TRANSACTION;";
+    const std::string sqlString =
+        m_engine ? "RELEASE SAVEPOINT \"" + m_componentName + "\";" : COMMIT_TRANSACTION_SQL_STRING;
     if (!performQuery(sqlString)) {
         ACSDK_ERROR(LX("commitTransactionFailed").d("reason", "Query failed"));
         return false;
     }
 
     m_transactionIsInProgress = false;
+    if (m_transactionLock.owns_lock()) {
+        m_transactionLock.unlock();
+    }
     return true;
 }
 
@@ -187,12 +454,17 @@ bool SQLiteDatabase::rollbackTransaction() {
         ACSDK_ERROR(LX("rollbackTransactionFailed").d("reason", "No transaction in progress"));
         return false;
     }
-    const std::string sqlString = "ROLLBACK TRANSACTION;";
+    const std::string sqlString = m_engine ? "ROLLBACK TO SAVEPOINT \"" + m_componentName + "\"; RELEASE SAVEPOINT \"" +
+                                                 m_componentName + "\";"
+                                           : ROLLBACK_TRANSACTION_SQL_STRING;
     if (!performQuery(sqlString)) {
         ACSDK_ERROR(LX("rollbackTransactionFailed").d("reason", "Query failed"));
         return false;
     }
     m_transactionIsInProgress = false;
+    if (m_transactionLock.owns_lock()) {
+        m_transactionLock.unlock();
+    }
     return true;
 }
 
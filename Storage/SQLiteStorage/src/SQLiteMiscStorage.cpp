@@ -17,9 +17,11 @@
 
 #include <algorithm>
 #include <cctype>
+#include <vector>
 
 #include <AVSCommon/Utils/Logger/Logger.h>
 #include <SQLiteStorage/SQLiteStatement.h>
+#include <SQLiteStorage/SQLiteStorageEngine.h>
 #include <SQLiteStorage/SQLiteUtils.h>
 
 namespace alexaClientSDK {
@@ -47,6 +49,10 @@ static const std::string VALUE_COLUMN_NAME = "value";
 static const std::string MISC_DATABASE_CONFIGURATION_ROOT_KEY = "miscDatabase";
 /// The key in our config file to find the database file path.
 static const std::string MISC_DATABASE_DB_FILE_PATH_KEY = "databaseFilePath";
+/// The name of this database as a component of an @c SQLiteStorageEngine.
+static const std::string MISC_DATABASE_COMPONENT_NAME = "miscDatabase";
+/// The schema version of this database as a component of an @c SQLiteStorageEngine.
+static const int MISC_DATABASE_SCHEMA_VERSION = 1;
 /// Component and table name separator in DB table name.
 static const std::string MISC_DATABASE_DB_COMPONENT_TABLE_NAMES_SEPARATOR = "_";
 
@@ -121,7 +127,30 @@ static std::string getValueTypeString(SQLiteMiscStorage::ValueType valueType);
  */
 static std::string getDBDataType(const std::string& keyValueType);
 
+/**
+ * Helper method that performs a query with its parameters bound, so that its prepared statement can be reused by the
+ * statement cache of the DB.
+ *
+ * @param db The SQLiteDatabase handle for MiscDB
+ * @param sqlString The SQL of the query, with a '?' for each parameter.
+ * @param parameters The parameters, from the left-most.
+ * @return true if successful, false if there is a problem.
+ */
+static bool performQueryWithParameters(
+    SQLiteDatabase& db,
+    const std::string& sqlString,
+    const std::vector<std::string>& parameters);
+
 std::unique_ptr<SQLiteMiscStorage> SQLiteMiscStorage::create(const ConfigurationNode& configurationRoot) {
+    std::shared_ptr<SQLiteStorageEngine> engine;
+    if (!SQLiteStorageEngine::getInstance(configurationRoot, &engine)) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "Could not get storage engine"));
+        return nullptr;
+    }
+    if (engine) {
+        return std::unique_ptr<SQLiteMiscStorage>(new SQLiteMiscStorage(engine));
+    }
+
     auto miscDatabaseConfigurationRoot = configurationRoot[MISC_DATABASE_CONFIGURATION_ROOT_KEY];
     if (!miscDatabaseConfigurationRoot) {
         ACSDK_ERROR(LX("createFailed")
@@ -144,6 +173,10 @@ std::unique_ptr<SQLiteMiscStorage> SQLiteMiscStorage::create(const Configuration
 SQLiteMiscStorage::SQLiteMiscStorage(const std::string& dbFilePath) : m_db{dbFilePath} {
 }
 
+SQLiteMiscStorage::SQLiteMiscStorage(std::shared_ptr<SQLiteStorageEngine> engine) :
+        m_db{std::move(engine), MISC_DATABASE_COMPONENT_NAME, MISC_DATABASE_SCHEMA_VERSION} {
+}
+
 SQLiteMiscStorage::~SQLiteMiscStorage() {
     close();
 }
@@ -257,6 +290,25 @@ std::string getDBDataType(const std::string& keyValueType) {
     return "";
 }
 
+bool performQueryWithParameters(
+    SQLiteDatabase& db,
+    const std::string& sqlString,
+    const std::vector<std::string>& parameters) {
+    auto statement = db.createStatement(sqlString);
+    if (!statement) {
+        return false;
+    }
+
+    int index = 1;
+    for (auto& parameter : parameters) {
+        if (!statement->bindStringParameter(index++, parameter)) {
+            return false;
+        }
+    }
+
+    return statement->step();
+}
+
 bool SQLiteMiscStorage::getKeyValueTypes(
     const std::string& componentName,
     const std::string& tableName,
@@ -549,11 +601,11 @@ bool SQLiteMiscStorage::get(
         return false;
     }
 
-    const std::string sqlString = "SELECT value FROM " + dbTableName + " WHERE " + KEY_COLUMN_NAME + "='" + key + "';";
+    const std::string sqlString = "SELECT value FROM " + dbTableName + " WHERE " + KEY_COLUMN_NAME + "=?;";
 
     auto sqliteStatement = m_db.createStatement(sqlString);
 
-    if ((!sqliteStatement) || (!sqliteStatement->step())) {
+    if ((!sqliteStatement) || (!sqliteStatement->bindStringParameter(1, key)) || (!sqliteStatement->step())) {
         ACSDK_ERROR(LX(errorEvent).d("Could not get value for " + key + " from table", tableName));
         return false;
     }
@@ -662,10 +714,10 @@ bool SQLiteMiscStorage::add(
 
     std::string dbTableName = getDBTableName(componentName, tableName);
 
-    const std::string sqlString = "INSERT INTO " + dbTableName + " (" + KEY_COLUMN_NAME + ", " + VALUE_COLUMN_NAME +
-                                  ") VALUES ('" + key + "', '" + value + "');";
+    const std::string sqlString =
+        "INSERT INTO " + dbTableName + " (" + KEY_COLUMN_NAME + ", " + VALUE_COLUMN_NAME + ") VALUES (?, ?);";
 
-    if (!m_db.performQuery(sqlString)) {
+    if (!performQueryWithParameters(m_db, sqlString, {key, value})) {
         ACSDK_ERROR(LX(errorEvent).d("Could not add entry (" + key + ", " + value + ") to table", tableName));
         return false;
     }
@@ -705,10 +757,10 @@ bool SQLiteMiscStorage::update(
 
     std::string dbTableName = getDBTableName(componentName, tableName);
 
-    const std::string sqlString = "UPDATE " + dbTableName + " SET " + VALUE_COLUMN_NAME + "='" + value + "' WHERE " +
-                                  KEY_COLUMN_NAME + "='" + key + "';";
+    const std::string sqlString =
+        "UPDATE " + dbTableName + " SET " + VALUE_COLUMN_NAME + "=? WHERE " + KEY_COLUMN_NAME + "=?;";
 
-    if (!m_db.performQuery(sqlString)) {
+    if (!performQueryWithParameters(m_db, sqlString, {value, key})) {
         ACSDK_ERROR(LX(errorEvent).d("Could not update entry for " + key + " in table", tableName));
         return false;
     }
@@ -745,19 +797,21 @@ bool SQLiteMiscStorage::put(
     std::string dbTableName = getDBTableName(componentName, tableName);
 
     std::string sqlString;
+    std::vector<std::string> parameters;
     std::string errorValue;
 
     if (!tableEntryExistsValue) {
-        sqlString = "INSERT INTO " + dbTableName + " (" + KEY_COLUMN_NAME + ", " + VALUE_COLUMN_NAME + ") VALUES ('" +
-                    key + "', '" + value + "');";
+        sqlString =
+            "INSERT INTO " + dbTableName + " (" + KEY_COLUMN_NAME + ", " + VALUE_COLUMN_NAME + ") VALUES (?, ?);";
+        parameters = {key, value};
         errorValue = "Could not add entry (" + key + ", " + value + ") to table";
     } else {
-        sqlString = "UPDATE " + dbTableName + " SET " + VALUE_COLUMN_NAME + "='" + value + "' WHERE " +
-                    KEY_COLUMN_NAME + "='" + key + "';";
+        sqlString = "UPDATE " + dbTableName + " SET " + VALUE_COLUMN_NAME + "=? WHERE " + KEY_COLUMN_NAME + "=?;";
+        parameters = {value, key};
         errorValue = "Could not update entry for " + key + " in table";
     }
 
-    if (!m_db.performQuery(sqlString)) {
+    if (!performQueryWithParameters(m_db, sqlString, parameters)) {
         ACSDK_ERROR(LX(errorEvent).d(errorValue, tableName));
         return false;
     }
@@ -792,9 +846,9 @@ bool SQLiteMiscStorage::remove(const std::string& componentName, const std::stri
 
     std::string dbTableName = getDBTableName(componentName, tableName);
 
-    const std::string sqlString = "DELETE FROM " + dbTableName + " WHERE " + KEY_COLUMN_NAME + "='" + key + "';";
+    const std::string sqlString = "DELETE FROM " + dbTableName + " WHERE " + KEY_COLUMN_NAME + "=?;";
 
-    if (!m_db.performQuery(sqlString)) {
+    if (!performQueryWithParameters(m_db, sqlString, {key})) {
         ACSDK_ERROR(LX(errorEvent).d("Could not remove entry for " + key + " in table", tableName));
         return false;
     }
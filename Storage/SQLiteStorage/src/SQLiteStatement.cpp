@@ -14,8 +14,10 @@
  */
 
 #include "SQLiteStorage/SQLiteStatement.h"
+#include "SQLiteStorage/SQLiteDatabase.h"
 
 #include <AVSCommon/Utils/Logger/Logger.h>
+#include <utility>
 
 namespace alexaClientSDK {
 namespace storage {
@@ -37,7 +39,15 @@ static const int SQLITE_BIND_PARAMETER_LEFT_MOST_INDEX = 1;
 static const int SQLITE_RESULT_FIELD_LEFT_MOST_INDEX = 0;
 static const int SQLITE_PARSE_STRING_UNTIL_NUL_CHARACTER = -1;
 
-SQLiteStatement::SQLiteStatement(sqlite3* dbHandle, const std::string& sqlString) : m_stepResult{SQLITE_OK} {
+SQLiteStatement::SQLiteStatement(
+    sqlite3* dbHandle,
+    const std::string& sqlString,
+    std::weak_ptr<SQLiteDatabase> database,
+    std::unique_lock<std::recursive_mutex> connectionLock) :
+        m_stepResult{SQLITE_OK},
+        m_sqlString{database.expired() ? "" : sqlString},
+        m_database{std::move(database)},
+        m_connectionLock{std::move(connectionLock)} {
     int rcode = sqlite3_prepare_v2(
         dbHandle,                                 // the db handle
         sqlString.c_str(),                        // the sql string
@@ -54,6 +64,18 @@ SQLiteStatement::SQLiteStatement(sqlite3* dbHandle, const std::string& sqlString
     }
 }
 
+SQLiteStatement::SQLiteStatement(
+    sqlite3_stmt* handle,
+    const std::string& sqlString,
+    std::weak_ptr<SQLiteDatabase> database,
+    std::unique_lock<std::recursive_mutex> connectionLock) :
+        m_handle{handle},
+        m_stepResult{SQLITE_OK},
+        m_sqlString{sqlString},
+        m_database{std::move(database)},
+        m_connectionLock{std::move(connectionLock)} {
+}
+
 SQLiteStatement::~SQLiteStatement() {
     finalize();
 }
@@ -204,14 +226,25 @@ int64_t SQLiteStatement::getColumnInt64(int index) const {
 
 void SQLiteStatement::finalize() {
     if (m_handle) {
-        int rcode = sqlite3_finalize(m_handle);
-        m_handle = nullptr;
-
-        if (rcode != SQLITE_OK) {
-            ACSDK_ERROR(
-                LX("SQLiteStatement::finalizeFailed").m("Could release the prepared statement.").d("rcode", rcode));
+        auto database = m_database.lock();
+        if (database) {
+            database->releaseStatement(m_sqlString, m_handle);
+            m_handle = nullptr;
+        } else {
+            int rcode = sqlite3_finalize(m_handle);
+            m_handle = nullptr;
+
+            if (rcode != SQLITE_OK) {
+                ACSDK_ERROR(LX("SQLiteStatement::finalizeFailed")
+                                .m("Could release the prepared statement.")
+                                .d("rcode", rcode));
+            }
         }
     }
+
+    if (m_connectionLock.owns_lock()) {
+        m_connectionLock.unlock();
+    }
 }
 
 }  // namespace sqliteStorage
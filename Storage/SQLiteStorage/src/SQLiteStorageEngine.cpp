@@ -0,0 +1,184 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "SQLiteStorage/SQLiteStorageEngine.h"
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <unordered_map>
+
+namespace alexaClientSDK {
+namespace storage {
+namespace sqliteStorage {
+
+using namespace avsCommon::utils::configuration;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("SQLiteStorageEngine");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The root key for the shared database in the configuration.
+static const std::string SQLITE_STORAGE_CONFIGURATION_ROOT_KEY = "sqliteStorage";
+
+/// The key for the shared database file path in the configuration.
+static const std::string DATABASE_FILE_PATH_KEY = "databaseFilePath";
+
+/// The SQL string to create the table of the schema version of each component.
+static const std::string CREATE_SCHEMA_VERSIONS_TABLE_SQL_STRING =
+    "CREATE TABLE IF NOT EXISTS schemaVersions (component TEXT PRIMARY KEY NOT NULL, version INT NOT NULL);";
+
+/// The SQL string to get the schema version of a component.
+static const std::string SELECT_SCHEMA_VERSION_SQL_STRING = "SELECT version FROM schemaVersions WHERE component=?;";
+
+/// The SQL string to record the schema version of a component.
+static const std::string REPLACE_SCHEMA_VERSION_SQL_STRING =
+    "INSERT OR REPLACE INTO schemaVersions (component, version) VALUES (?, ?);";
+
+bool SQLiteStorageEngine::getInstance(
+    const ConfigurationNode& configurationRoot,
+    std::shared_ptr<SQLiteStorageEngine>* engine) {
+    if (!engine) {
+        ACSDK_ERROR(LX("getInstanceFailed").d("reason", "nullEngine"));
+        return false;
+    }
+    *engine = nullptr;
+
+    std::string filePath;
+    configurationRoot[SQLITE_STORAGE_CONFIGURATION_ROOT_KEY].getString(DATABASE_FILE_PATH_KEY, &filePath);
+    if (filePath.empty()) {
+        return true;
+    }
+
+    // Every component configured with the same file shares one engine, which lives as long as any of them does.
+    static std::mutex instancesMutex;
+    static std::unordered_map<std::string, std::weak_ptr<SQLiteStorageEngine>> instances;
+
+    std::lock_guard<std::mutex> lock(instancesMutex);
+    *engine = instances[filePath].lock();
+    if (!*engine) {
+        *engine = create(filePath, SQLiteDatabase::ConnectionProfile::createFromConfiguration());
+        if (!*engine) {
+            ACSDK_ERROR(LX("getInstanceFailed").d("reason", "createFailed").d("file path", filePath));
+            return false;
+        }
+        instances[filePath] = *engine;
+    }
+    return true;
+}
+
+std::shared_ptr<SQLiteStorageEngine> SQLiteStorageEngine::create(
+    const std::string& filePath,
+    const SQLiteDatabase::ConnectionProfile& profile) {
+    std::shared_ptr<SQLiteStorageEngine> engine(new SQLiteStorageEngine(filePath, profile));
+    if (!engine->initialize()) {
+        ACSDK_ERROR(LX("createFailed").d("file path", filePath));
+        return nullptr;
+    }
+    return engine;
+}
+
+SQLiteStorageEngine::SQLiteStorageEngine(
+    const std::string& filePath,
+    const SQLiteDatabase::ConnectionProfile& profile) :
+        m_database{filePath, profile} {
+}
+
+SQLiteStorageEngine::~SQLiteStorageEngine() {
+    m_database.close();
+}
+
+bool SQLiteStorageEngine::initialize() {
+    if (!m_database.open() && !m_database.initialize()) {
+        ACSDK_ERROR(LX("initializeFailed").d("reason", "Database could not be opened or created."));
+        return false;
+    }
+
+    if (!m_database.performQuery(CREATE_SCHEMA_VERSIONS_TABLE_SQL_STRING)) {
+        ACSDK_ERROR(LX("initializeFailed").d("reason", "Schema version table could not be created."));
+        m_database.close();
+        return false;
+    }
+
+    return true;
+}
+
+std::string SQLiteStorageEngine::getFilePath() const {
+    return m_database.m_storageFilePath;
+}
+
+int SQLiteStorageEngine::getSchemaVersion(const std::string& componentName) {
+    auto lock = lockConnection();
+    return getSchemaVersionLocked(componentName);
+}
+
+int SQLiteStorageEngine::getSchemaVersionLocked(const std::string& componentName) {
+    auto statement = m_database.createStatement(SELECT_SCHEMA_VERSION_SQL_STRING);
+    if (!statement || !statement->bindStringParameter(1, componentName) || !statement->step()) {
+        ACSDK_ERROR(LX("getSchemaVersionFailed").d("component", componentName));
+        return 0;
+    }
+
+    const int RESULT_COLUMN_POSITION = 0;
+    return SQLITE_ROW == statement->getStepResult() ? statement->getColumnInt(RESULT_COLUMN_POSITION) : 0;
+}
+
+bool SQLiteStorageEngine::setSchemaVersionLocked(const std::string& componentName, int version) {
+    auto statement = m_database.createStatement(REPLACE_SCHEMA_VERSION_SQL_STRING);
+    if (!statement || !statement->bindStringParameter(1, componentName) || !statement->bindIntParameter(2, version) ||
+        !statement->step()) {
+        ACSDK_ERROR(LX("setSchemaVersionFailed").d("component", componentName).d("version", version));
+        return false;
+    }
+    return true;
+}
+
+bool SQLiteStorageEngine::executeInTransaction(std::function<bool()> task) {
+    if (!task) {
+        ACSDK_ERROR(LX("executeInTransactionFailed").d("reason", "nullTask"));
+        return false;
+    }
+
+    auto lock = lockConnection();
+    auto transaction = m_database.beginTransaction();
+    if (!transaction) {
+        ACSDK_ERROR(LX("executeInTransactionFailed").d("reason", "beginTransactionFailed"));
+        return false;
+    }
+
+    if (!task()) {
+        ACSDK_DEBUG0(LX("executeInTransaction").m("Task failed, rolling back."));
+        transaction->rollback();
+        return false;
+    }
+
+    return transaction->commit();
+}
+
+std::unique_lock<std::recursive_mutex> SQLiteStorageEngine::lockConnection() {
+    return std::unique_lock<std::recursive_mutex>(m_connectionMutex);
+}
+
+sqlite3* SQLiteStorageEngine::getHandle() {
+    return m_database.m_dbHandle;
+}
+
+}  // namespace sqliteStorage
+}  // namespace storage
+}  // namespace alexaClientSDK
@@ -15,6 +15,8 @@
 
 #include <chrono>
 #include <cstdlib>
+#include <iostream>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -33,6 +35,21 @@ static std::string g_workingDirectory;
 static const std::string BAD_PATH =
     "_/_/_/there/is/no/way/this/path/should/exist/,/so/it/should/cause/an/error/when/creating/the/db";
 
+/// The SQL string to create the table of the statement cache tests.
+static const std::string CREATE_TABLE_SQL_STRING = "CREATE TABLE entries (key TEXT, value TEXT);";
+
+/// The SQL string to insert an entry.
+static const std::string INSERT_SQL_STRING = "INSERT INTO entries (key, value) VALUES (?, ?);";
+
+/// The SQL string to get the value of an entry.
+static const std::string SELECT_SQL_STRING = "SELECT value FROM entries WHERE key=?;";
+
+/// The SQL string to delete an entry.
+static const std::string DELETE_SQL_STRING = "DELETE FROM entries WHERE key=?;";
+
+/// The number of entries inserted, read and deleted by the benchmark.
+static const int BENCHMARK_ENTRIES = 200;
+
 /**
  * Helper function that generates a unique filepath using the passed in g_workingDirectory.
  *
@@ -48,6 +65,101 @@ static std::string generateDbFilePath() {
     return filePath;
 }
 
+/**
+ * Helper function that gets the value of a pragma.
+ *
+ * @param db The database.
+ * @param pragma The name of the pragma.
+ * @return The value of the pragma, or an empty string if it could not be read.
+ */
+static std::string getPragma(SQLiteDatabase& db, const std::string& pragma) {
+    auto statement = db.createStatement("PRAGMA " + pragma + ";");
+    if (!statement || !statement->step() || statement->getStepResult() != SQLITE_ROW) {
+        return "";
+    }
+    return statement->getColumnText(0);
+}
+
+/**
+ * Helper function that performs a statement with string parameters.
+ *
+ * @param db The database.
+ * @param sqlString The SQL of the statement.
+ * @param parameters The parameters, from the left-most.
+ * @return Whether the statement was performed successfully.
+ */
+static bool performStatement(
+    SQLiteDatabase& db,
+    const std::string& sqlString,
+    const std::vector<std::string>& parameters) {
+    auto statement = db.createStatement(sqlString);
+    if (!statement) {
+        return false;
+    }
+    for (size_t i = 0; i < parameters.size(); ++i) {
+        if (!statement->bindStringParameter(static_cast<int>(i) + 1, parameters[i])) {
+            return false;
+        }
+    }
+    return statement->step();
+}
+
+/**
+ * Helper function that gets the value of an entry.
+ *
+ * @param db The database.
+ * @param key The key of the entry.
+ * @return The value, or an empty string if there is no entry.
+ */
+static std::string getValue(SQLiteDatabase& db, const std::string& key) {
+    auto statement = db.createStatement(SELECT_SQL_STRING);
+    if (!statement || !statement->bindStringParameter(1, key) || !statement->step() ||
+        statement->getStepResult() != SQLITE_ROW) {
+        return "";
+    }
+    return statement->getColumnText(0);
+}
+
+/**
+ * Helper function that creates a profile like the one the databases were opened with before connection profiles,
+ * without write-ahead logging or a statement cache.
+ *
+ * @return The profile.
+ */
+static SQLiteDatabase::ConnectionProfile createRollbackJournalProfile() {
+    SQLiteDatabase::ConnectionProfile profile;
+    profile.journalMode = "DELETE";
+    profile.synchronous = "FULL";
+    profile.statementCacheSize = 0;
+    return profile;
+}
+
+/**
+ * Helper function that inserts, reads and deletes entries one at a time, each in its own transaction.
+ *
+ * @param profile The connection profile of the database.
+ * @return How long it took.
+ */
+static std::chrono::steady_clock::duration runHotOperations(const SQLiteDatabase::ConnectionProfile& profile) {
+    SQLiteDatabase db(generateDbFilePath(), profile);
+    EXPECT_TRUE(db.initialize());
+    EXPECT_TRUE(db.performQuery(CREATE_TABLE_SQL_STRING));
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCHMARK_ENTRIES; ++i) {
+        auto key = std::to_string(i);
+        EXPECT_TRUE(performStatement(db, INSERT_SQL_STRING, {key, "value" + key}));
+        EXPECT_EQ("value" + key, getValue(db, key));
+    }
+    for (int i = 0; i < BENCHMARK_ENTRIES; ++i) {
+        EXPECT_TRUE(performStatement(db, DELETE_SQL_STRING, {std::to_string(i)}));
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    db.close();
+    return elapsed;
+}
+
 /// Test to close DB then open it.
 TEST(SQLiteDatabaseTest, CloseThenOpen) {
     auto dbFilePath = generateDbFilePath();
@@ -214,6 +326,118 @@ TEST(SQLiteDatabaseTest, AutoRollback) {
     db.close();
 }
 
+/// Test that the connection profile is applied when the DB is created and when it is opened.
+TEST(SQLiteDatabaseTest, ConnectionProfileIsApplied) {
+    auto dbFilePath = generateDbFilePath();
+    SQLiteDatabase::ConnectionProfile profile;
+    profile.synchronous = "NORMAL";
+    profile.cacheSize = 100;
+    SQLiteDatabase db(dbFilePath, profile);
+    ASSERT_TRUE(db.initialize());
+    EXPECT_EQ("wal", getPragma(db, "journal_mode"));
+    EXPECT_EQ("1", getPragma(db, "synchronous"));
+    EXPECT_EQ("100", getPragma(db, "cache_size"));
+    db.close();
+
+    SQLiteDatabase reopened(dbFilePath, createRollbackJournalProfile());
+    ASSERT_TRUE(reopened.open());
+    EXPECT_EQ("delete", getPragma(reopened, "journal_mode"));
+    EXPECT_EQ("2", getPragma(reopened, "synchronous"));
+    reopened.close();
+}
+
+/// Test that a reused statement has been reset and has no parameters bound.
+TEST(SQLiteDatabaseTest, StatementCacheResetsStatements) {
+    SQLiteDatabase db(generateDbFilePath(), SQLiteDatabase::ConnectionProfile());
+    ASSERT_TRUE(db.initialize());
+    ASSERT_TRUE(db.performQuery(CREATE_TABLE_SQL_STRING));
+    ASSERT_TRUE(performStatement(db, INSERT_SQL_STRING, {"key1", "value1"}));
+    ASSERT_TRUE(performStatement(db, INSERT_SQL_STRING, {"key2", "value2"}));
+
+    // Leave a read in progress when the statement is returned.
+    {
+        auto statement = db.createStatement("SELECT key FROM entries ORDER BY key;");
+        ASSERT_TRUE(statement);
+        ASSERT_TRUE(statement->step());
+        ASSERT_TRUE(statement->step());
+        EXPECT_EQ("key2", statement->getColumnText(0));
+    }
+    auto statement = db.createStatement("SELECT key FROM entries ORDER BY key;");
+    ASSERT_TRUE(statement);
+    ASSERT_TRUE(statement->step());
+    EXPECT_EQ("key1", statement->getColumnText(0));
+    statement.reset();
+
+    // A parameter bound the last time the statement was used is not bound any more.
+    statement = db.createStatement(INSERT_SQL_STRING);
+    ASSERT_TRUE(statement);
+    ASSERT_TRUE(statement->bindStringParameter(1, "key3"));
+    ASSERT_TRUE(statement->step());
+    statement.reset();
+    auto countStatement = db.createStatement("SELECT count(*) FROM entries WHERE value IS NULL;");
+    ASSERT_TRUE(countStatement);
+    ASSERT_TRUE(countStatement->step());
+    EXPECT_EQ(1, countStatement->getColumnInt(0));
+    countStatement.reset();
+
+    db.close();
+}
+
+/// Test that statements are correct when the statement cache is smaller than the number of statements used.
+TEST(SQLiteDatabaseTest, StatementCacheEvictsStatements) {
+    auto profile = SQLiteDatabase::ConnectionProfile();
+    profile.statementCacheSize = 1;
+    SQLiteDatabase db(generateDbFilePath(), profile);
+    ASSERT_TRUE(db.initialize());
+    ASSERT_TRUE(db.performQuery(CREATE_TABLE_SQL_STRING));
+
+    for (int i = 0; i < 3; ++i) {
+        auto key = std::to_string(i);
+        ASSERT_TRUE(performStatement(db, INSERT_SQL_STRING, {key, "value" + key}));
+        EXPECT_EQ("value" + key, getValue(db, key));
+        ASSERT_TRUE(performStatement(db, DELETE_SQL_STRING, {key}));
+        EXPECT_TRUE(getValue(db, key).empty());
+    }
+
+    db.close();
+}
+
+/// Test that a statement which outlives its DB can still be finalized.
+TEST(SQLiteDatabaseTest, StatementOutlivesDatabase) {
+    std::unique_ptr<SQLiteStatement> statement;
+    {
+        SQLiteDatabase db(generateDbFilePath(), SQLiteDatabase::ConnectionProfile());
+        ASSERT_TRUE(db.initialize());
+        statement = db.createStatement("SELECT 1;");
+        ASSERT_TRUE(statement);
+    }
+    statement->finalize();
+    EXPECT_FALSE(statement->isValid());
+}
+
+/**
+ * Report how long the hot operations of a storage class take, with the profile the databases were opened with before
+ * against the default profile.  Run the test with its working directory on a flash or loop device to measure the cost
+ * of syncing there.  The times are recorded as test properties, and the test is disabled by default.
+ */
+TEST(SQLiteDatabaseTest, DISABLED_benchmarkConnectionProfiles) {
+    auto rollbackJournalElapsed = runHotOperations(createRollbackJournalProfile());
+    SQLiteDatabase::ConnectionProfile profile;
+    profile.synchronous = "NORMAL";
+    auto defaultElapsed = runHotOperations(SQLiteDatabase::ConnectionProfile());
+    auto normalElapsed = runHotOperations(profile);
+
+    RecordProperty(
+        "rollbackJournalMs",
+        std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(rollbackJournalElapsed).count()));
+    RecordProperty(
+        "defaultProfileMs",
+        std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(defaultElapsed).count()));
+    RecordProperty(
+        "synchronousNormalMs",
+        std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(normalElapsed).count()));
+}
+
 }  // namespace test
 }  // namespace sqliteStorage
 }  // namespace storage
@@ -15,10 +15,13 @@
 
 #include <SQLiteStorage/SQLiteMiscStorage.h>
 
+#include <chrono>
+
 #include <gtest/gtest.h>
 
 #include <AVSCommon/AVS/Initialization/AlexaClientSDKInit.h>
 #include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
+#include <AVSCommon/Utils/File/FileUtils.h>
 #include <SQLiteStorage/SQLiteDatabase.h>
 
 namespace alexaClientSDK {
@@ -43,6 +46,51 @@ static const std::string MISC_DB_CONFIG_JSON =
     "}";
 // clang-format on
 
+/// The file path of the benchmark database.
+static const std::string BENCHMARK_DB_FILE_PATH = "miscDBSQLiteMiscStorageBenchmark.db";
+
+/// JSON text for miscDB config of the benchmark, with a connection profile like the one the database was opened with
+/// before connection profiles.
+// clang-format off
+static const std::string ROLLBACK_JOURNAL_PROFILE_CONFIG_JSON =
+    "{"
+      "\"miscDatabase\":{"
+        "\"databaseFilePath\":\"" + BENCHMARK_DB_FILE_PATH + "\""
+      "},"
+      "\"sqliteStorage\":{"
+        "\"journalMode\":\"DELETE\","
+        "\"synchronous\":\"FULL\","
+        "\"statementCacheSize\":0"
+      "}"
+    "}";
+// clang-format on
+
+/// JSON text for miscDB config of the benchmark, with the default connection profile.
+// clang-format off
+static const std::string DEFAULT_PROFILE_CONFIG_JSON =
+    "{"
+      "\"miscDatabase\":{"
+        "\"databaseFilePath\":\"" + BENCHMARK_DB_FILE_PATH + "\""
+      "}"
+    "}";
+// clang-format on
+
+/// The file path of the database of the storage engine test.
+static const std::string STORAGE_ENGINE_DB_FILE_PATH = "SQLiteMiscStorageEngineTest.db";
+
+/// JSON text for a config which stores MiscDB in a storage engine.
+// clang-format off
+static const std::string STORAGE_ENGINE_CONFIG_JSON =
+    "{"
+      "\"sqliteStorage\":{"
+        "\"databaseFilePath\":\"" + STORAGE_ENGINE_DB_FILE_PATH + "\""
+      "}"
+    "}";
+// clang-format on
+
+/// The number of entries put, read and removed by the benchmark.
+static const int BENCHMARK_ENTRIES = 200;
+
 /**
  * Test harness for @c SQLiteMiscStorage class.
  */
@@ -83,6 +131,15 @@ protected:
      */
     void deleteTestTable(const std::string& tableName);
 
+    /**
+     * Puts, gets and removes entries one at a time in a database opened with the connection profile of a
+     * configuration, as the components storing their settings in MiscDB do.
+     *
+     * @param configJson The configuration of the database.
+     * @return How long it took.
+     */
+    std::chrono::steady_clock::duration putGetAndRemoveWithConfig(const std::string& configJson);
+
     /// The Misc DB storage instance
     std::shared_ptr<SQLiteMiscStorage> m_miscStorage;
 };
@@ -113,6 +170,37 @@ void SQLiteMiscStorageTest::deleteTestTable(const std::string& tableName) {
     }
 }
 
+std::chrono::steady_clock::duration SQLiteMiscStorageTest::putGetAndRemoveWithConfig(const std::string& configJson) {
+    const std::string tableName = "SQLiteMiscStorageBenchmark";
+    avsCommon::utils::file::removeFile(BENCHMARK_DB_FILE_PATH);
+    AlexaClientSDKInit::uninitialize();
+    EXPECT_TRUE(AlexaClientSDKInit::initialize({std::make_shared<std::istringstream>(configJson)}));
+    auto storage = SQLiteMiscStorage::create(ConfigurationNode::getRoot());
+    EXPECT_TRUE(storage && storage->createDatabase());
+    if (!storage) {
+        return std::chrono::steady_clock::duration::zero();
+    }
+    EXPECT_TRUE(storage->createTable(
+        COMPONENT_NAME, tableName, SQLiteMiscStorage::KeyType::STRING_KEY, SQLiteMiscStorage::ValueType::STRING_VALUE));
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCHMARK_ENTRIES; ++i) {
+        auto key = "key" + std::to_string(i);
+        std::string value;
+        EXPECT_TRUE(storage->put(COMPONENT_NAME, tableName, key, "value"));
+        EXPECT_TRUE(storage->get(COMPONENT_NAME, tableName, key, &value));
+        EXPECT_EQ("value", value);
+    }
+    for (int i = 0; i < BENCHMARK_ENTRIES; ++i) {
+        EXPECT_TRUE(storage->remove(COMPONENT_NAME, tableName, "key" + std::to_string(i)));
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    storage->close();
+    avsCommon::utils::file::removeFile(BENCHMARK_DB_FILE_PATH);
+    return elapsed;
+}
+
 SQLiteMiscStorageTest::SQLiteMiscStorageTest() {
     auto inString = std::shared_ptr<std::istringstream>(new std::istringstream(MISC_DB_CONFIG_JSON));
     AlexaClientSDKInit::initialize({inString});
@@ -276,6 +364,73 @@ TEST_F(SQLiteMiscStorageTest, createDeleteTable) {
     ASSERT_FALSE(tableExists);
 }
 
+/// Tests that keys and values are stored as they are, even if they contain quotes.
+TEST_F(SQLiteMiscStorageTest, tableEntriesWithQuotes) {
+    const std::string tableName = "SQLiteMiscStorageQuotesTest";
+    const std::string key = "it's a key";
+    const std::string value = "it's a \"value\"";
+    std::string tableEntryValue;
+    deleteTestTable(tableName);
+
+    createTestTable(tableName, SQLiteMiscStorage::KeyType::STRING_KEY, SQLiteMiscStorage::ValueType::STRING_VALUE);
+
+    ASSERT_TRUE(m_miscStorage->put(COMPONENT_NAME, tableName, key, value));
+    ASSERT_TRUE(m_miscStorage->get(COMPONENT_NAME, tableName, key, &tableEntryValue));
+    ASSERT_EQ(value, tableEntryValue);
+    ASSERT_TRUE(m_miscStorage->update(COMPONENT_NAME, tableName, key, value + value));
+    ASSERT_TRUE(m_miscStorage->get(COMPONENT_NAME, tableName, key, &tableEntryValue));
+    ASSERT_EQ(value + value, tableEntryValue);
+    ASSERT_TRUE(m_miscStorage->remove(COMPONENT_NAME, tableName, key));
+
+    bool tableEntryExists;
+    ASSERT_TRUE(m_miscStorage->tableEntryExists(COMPONENT_NAME, tableName, key, &tableEntryExists));
+    ASSERT_FALSE(tableEntryExists);
+
+    deleteTestTable(tableName);
+}
+
+/// Tests that MiscDB stores its tables in the storage engine when one is configured, and finds them when reopened.
+TEST_F(SQLiteMiscStorageTest, storageEngine) {
+    const std::string tableName = "SQLiteMiscStorageEngineTest";
+    avsCommon::utils::file::removeFile(STORAGE_ENGINE_DB_FILE_PATH);
+    AlexaClientSDKInit::uninitialize();
+    ASSERT_TRUE(AlexaClientSDKInit::initialize({std::make_shared<std::istringstream>(STORAGE_ENGINE_CONFIG_JSON)}));
+
+    auto storage = SQLiteMiscStorage::create(ConfigurationNode::getRoot());
+    ASSERT_TRUE(storage);
+    ASSERT_FALSE(storage->open());
+    ASSERT_TRUE(storage->createDatabase());
+    ASSERT_TRUE(avsCommon::utils::file::fileExists(STORAGE_ENGINE_DB_FILE_PATH));
+    ASSERT_TRUE(storage->createTable(
+        COMPONENT_NAME, tableName, SQLiteMiscStorage::KeyType::STRING_KEY, SQLiteMiscStorage::ValueType::STRING_VALUE));
+    ASSERT_TRUE(storage->put(COMPONENT_NAME, tableName, "key", "value"));
+    storage.reset();
+
+    storage = SQLiteMiscStorage::create(ConfigurationNode::getRoot());
+    ASSERT_TRUE(storage);
+    ASSERT_TRUE(storage->open());
+    std::string value;
+    ASSERT_TRUE(storage->get(COMPONENT_NAME, tableName, "key", &value));
+    ASSERT_EQ("value", value);
+    storage.reset();
+
+    avsCommon::utils::file::removeFile(STORAGE_ENGINE_DB_FILE_PATH);
+}
+
+/// Report how long the hot operations of MiscDB take, with the connection profile it was opened with before against
+/// the default connection profile, as test properties.  Disabled by default.
+TEST_F(SQLiteMiscStorageTest, DISABLED_benchmarkConnectionProfiles) {
+    auto rollbackJournalElapsed = putGetAndRemoveWithConfig(ROLLBACK_JOURNAL_PROFILE_CONFIG_JSON);
+    auto defaultElapsed = putGetAndRemoveWithConfig(DEFAULT_PROFILE_CONFIG_JSON);
+
+    RecordProperty(
+        "rollbackJournalMs",
+        std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(rollbackJournalElapsed).count()));
+    RecordProperty(
+        "defaultProfileMs",
+        std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(defaultElapsed).count()));
+}
+
 }  // namespace test
 }  // namespace sqliteStorage
 }  // namespace storage
@@ -0,0 +1,517 @@
+/*
+ * Copyright 2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
+#include <AVSCommon/Utils/File/FileUtils.h>
+#include <SQLiteStorage/SQLiteStorageEngine.h>
+
+namespace alexaClientSDK {
+namespace storage {
+namespace sqliteStorage {
+namespace test {
+
+using namespace avsCommon::utils::configuration;
+
+/// Variable for storing the working directory.  This is where all of the test databases will be created.
+static std::string g_workingDirectory;
+
+/// The name of the first component of the tests.
+static const std::string FIRST_COMPONENT_NAME = "first";
+
+/// The name of the second component of the tests.
+static const std::string SECOND_COMPONENT_NAME = "second";
+
+/// The SQL string to create the table of the first component.
+static const std::string CREATE_FIRST_TABLE_SQL_STRING = "CREATE TABLE firstEntries (key TEXT, value TEXT);";
+
+/// The SQL string to create the table of the second component.
+static const std::string CREATE_SECOND_TABLE_SQL_STRING = "CREATE TABLE secondEntries (key TEXT, value TEXT);";
+
+/// The number of entries each component writes in the concurrency test.
+static const int CONCURRENT_ENTRIES = 100;
+
+/// The number of components in the benchmark, which is the number of SQLite databases of the SDK.
+static const int BENCHMARK_COMPONENTS = 7;
+
+/// The number of entries each component stores in the benchmark.
+static const int BENCHMARK_ENTRIES = 500;
+
+/// The number of times the benchmark is repeated.
+static const int BENCHMARK_RUNS = 5;
+
+/**
+ * Helper function that generates a unique filepath using the passed in g_workingDirectory.
+ *
+ * @return A unique filepath.
+ */
+static std::string generateDbFilePath() {
+    auto currentTime = std::chrono::high_resolution_clock::now();
+    auto nanosecond = static_cast<int64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(currentTime.time_since_epoch()).count());
+    std::string filePath =
+        g_workingDirectory + "/SQLiteStorageEngineTest-" + std::to_string(nanosecond) + std::to_string(rand());
+    EXPECT_FALSE(avsCommon::utils::file::fileExists(filePath));
+    return filePath;
+}
+
+/**
+ * Helper function that inserts an entry into a table.
+ *
+ * @param db The database.
+ * @param tableName The name of the table.
+ * @param key The key of the entry.
+ * @param value The value of the entry.
+ * @return Whether the entry was inserted.
+ */
+static bool insertEntry(
+    SQLiteDatabase& db,
+    const std::string& tableName,
+    const std::string& key,
+    const std::string& value) {
+    auto statement = db.createStatement("INSERT INTO " + tableName + " (key, value) VALUES (?, ?);");
+    return statement && statement->bindStringParameter(1, key) && statement->bindStringParameter(2, value) &&
+           statement->step();
+}
+
+/**
+ * Helper function that counts the entries of a table.
+ *
+ * @param db The database.
+ * @param tableName The name of the table.
+ * @return The number of entries, or -1 if they could not be counted.
+ */
+static int countEntries(SQLiteDatabase& db, const std::string& tableName) {
+    auto statement = db.createStatement("SELECT count(*) FROM " + tableName + ";");
+    if (!statement || !statement->step() || statement->getStepResult() != SQLITE_ROW) {
+        return -1;
+    }
+    return statement->getColumnInt(0);
+}
+
+/**
+ * Helper function that reads every value of a table, as a component loading its state would.
+ *
+ * @param db The database.
+ * @param tableName The name of the table.
+ * @return The number of values read.
+ */
+static int readEntries(SQLiteDatabase& db, const std::string& tableName) {
+    auto statement = db.createStatement("SELECT key, value FROM " + tableName + ";");
+    int count = 0;
+    while (statement && statement->step() && statement->getStepResult() == SQLITE_ROW) {
+        count += statement->getColumnText(1).empty() ? 0 : 1;
+    }
+    return count;
+}
+
+/**
+ * Helper function that gets the resident set size of this process.
+ *
+ * @return The resident set size in bytes, or 0 if it could not be read.
+ */
+static long getResidentSetSize() {
+    std::ifstream statm("/proc/self/statm");
+    long size = 0;
+    long residentPages = 0;
+    if (!(statm >> size >> residentPages)) {
+        return 0;
+    }
+    return residentPages * sysconf(_SC_PAGESIZE);
+}
+
+/// The resources used by one storage layout in the benchmark.
+struct BenchmarkResult {
+    /// The time to open every component and load its entries.
+    std::chrono::steady_clock::duration coldStart;
+
+    /// The memory allocated by SQLite once every component is loaded.
+    long sqliteMemory;
+
+    /// The growth of the resident set size while every component is loaded.
+    long residentSetGrowth;
+
+    /// The time to clear the tables of every component.
+    std::chrono::steady_clock::duration clear;
+};
+
+/**
+ * Helper function that gets the name of the table of a component in the benchmark.
+ *
+ * @param component The index of the component.
+ * @return The name of the table.
+ */
+static std::string getBenchmarkTableName(int component) {
+    return "component" + std::to_string(component);
+}
+
+/**
+ * Helper function that creates the table of a component in the benchmark, and fills it.
+ *
+ * @param db The database of the component.
+ * @param component The index of the component.
+ */
+static void fillBenchmarkComponent(SQLiteDatabase& db, int component) {
+    auto tableName = getBenchmarkTableName(component);
+    ASSERT_TRUE(db.performQuery("CREATE TABLE " + tableName + " (key TEXT PRIMARY KEY, value TEXT);"));
+    auto transaction = db.beginTransaction();
+    ASSERT_TRUE(transaction);
+    for (int i = 0; i < BENCHMARK_ENTRIES; ++i) {
+        ASSERT_TRUE(insertEntry(db, tableName, std::to_string(i), std::string(100, 'a' + component)));
+    }
+    ASSERT_TRUE(transaction->commit());
+}
+
+/**
+ * Helper function that adds the result of one run of the benchmark to a total.
+ *
+ * @param run The result of the run.
+ * @param[in,out] total The total.
+ */
+static void addBenchmarkResult(const BenchmarkResult& run, BenchmarkResult* total) {
+    total->coldStart += run.coldStart;
+    total->sqliteMemory += run.sqliteMemory;
+    total->residentSetGrowth += run.residentSetGrowth;
+    total->clear += run.clear;
+}
+
+/**
+ * Runs the benchmark with a database file per component, as the SDK stores them by default.
+ *
+ * @return The resources used.
+ */
+static BenchmarkResult runSeparateFilesBenchmark() {
+    std::vector<std::string> filePaths;
+    for (int i = 0; i < BENCHMARK_COMPONENTS; ++i) {
+        filePaths.push_back(generateDbFilePath());
+        SQLiteDatabase db(filePaths.back());
+        EXPECT_TRUE(db.initialize());
+        fillBenchmarkComponent(db, i);
+        db.close();
+    }
+
+    BenchmarkResult result;
+    auto memoryBefore = sqlite3_memory_used();
+    auto residentSetBefore = getResidentSetSize();
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::unique_ptr<SQLiteDatabase>> databases;
+    for (int i = 0; i < BENCHMARK_COMPONENTS; ++i) {
+        databases.emplace_back(new SQLiteDatabase(filePaths[i]));
+        EXPECT_TRUE(databases.back()->open());
+        EXPECT_EQ(BENCHMARK_ENTRIES, readEntries(*databases.back(), getBenchmarkTableName(i)));
+    }
+    result.coldStart = std::chrono::steady_clock::now() - start;
+    result.sqliteMemory = static_cast<long>(sqlite3_memory_used() - memoryBefore);
+    result.residentSetGrowth = getResidentSetSize() - residentSetBefore;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCHMARK_COMPONENTS; ++i) {
+        EXPECT_TRUE(databases[i]->clearTable(getBenchmarkTableName(i)));
+    }
+    result.clear = std::chrono::steady_clock::now() - start;
+
+    for (auto& database : databases) {
+        database->close();
+    }
+    return result;
+}
+
+/**
+ * Runs the benchmark with every component hosted by an @c SQLiteStorageEngine.
+ *
+ * @return The resources used.
+ */
+static BenchmarkResult runEngineBenchmark() {
+    auto filePath = generateDbFilePath();
+    {
+        auto engine = SQLiteStorageEngine::create(filePath, SQLiteDatabase::ConnectionProfile());
+        EXPECT_TRUE(engine);
+        for (int i = 0; engine && i < BENCHMARK_COMPONENTS; ++i) {
+            SQLiteDatabase db(engine, getBenchmarkTableName(i), 1);
+            EXPECT_TRUE(db.initialize());
+            fillBenchmarkComponent(db, i);
+            db.close();
+        }
+    }
+
+    BenchmarkResult result;
+    auto memoryBefore = sqlite3_memory_used();
+    auto residentSetBefore = getResidentSetSize();
+    auto start = std::chrono::steady_clock::now();
+    auto engine = SQLiteStorageEngine::create(filePath, SQLiteDatabase::ConnectionProfile());
+    EXPECT_TRUE(engine);
+    std::vector<std::unique_ptr<SQLiteDatabase>> databases;
+    for (int i = 0; engine && i < BENCHMARK_COMPONENTS; ++i) {
+        databases.emplace_back(new SQLiteDatabase(engine, getBenchmarkTableName(i), 1));
+        EXPECT_TRUE(databases.back()->open());
+        EXPECT_EQ(BENCHMARK_ENTRIES, readEntries(*databases.back(), getBenchmarkTableName(i)));
+    }
+    result.coldStart = std::chrono::steady_clock::now() - start;
+    result.sqliteMemory = static_cast<long>(sqlite3_memory_used() - memoryBefore);
+    result.residentSetGrowth = getResidentSetSize() - residentSetBefore;
+
+    start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(engine && engine->executeInTransaction([&databases]() {
+        for (int i = 0; i < BENCHMARK_COMPONENTS; ++i) {
+            if (!databases[i]->clearTable(getBenchmarkTableName(i))) {
+                return false;
+            }
+        }
+        return true;
+    }));
+    result.clear = std::chrono::steady_clock::now() - start;
+
+    for (auto& database : databases) {
+        database->close();
+    }
+    return result;
+}
+
+/// Test that components of an engine share its file, and find their tables when it is reopened.
+TEST(SQLiteStorageEngineTest, componentsShareFile) {
+    auto filePath = generateDbFilePath();
+    {
+        auto engine = SQLiteStorageEngine::create(filePath, SQLiteDatabase::ConnectionProfile());
+        ASSERT_TRUE(engine);
+        SQLiteDatabase first(engine, FIRST_COMPONENT_NAME, 1);
+        SQLiteDatabase second(engine, SECOND_COMPONENT_NAME, 1);
+        ASSERT_TRUE(first.initialize());
+        ASSERT_TRUE(second.initialize());
+        ASSERT_TRUE(first.performQuery(CREATE_FIRST_TABLE_SQL_STRING));
+        ASSERT_TRUE(second.performQuery(CREATE_SECOND_TABLE_SQL_STRING));
+        ASSERT_TRUE(insertEntry(first, "firstEntries", "key", "first"));
+        ASSERT_TRUE(insertEntry(second, "secondEntries", "key", "second"));
+        first.close();
+        second.close();
+    }
+
+    auto engine = SQLiteStorageEngine::create(filePath, SQLiteDatabase::ConnectionProfile());
+    ASSERT_TRUE(engine);
+    SQLiteDatabase first(engine, FIRST_COMPONENT_NAME, 1);
+    SQLiteDatabase second(engine, SECOND_COMPONENT_NAME, 1);
+    ASSERT_TRUE(first.open());
+    ASSERT_TRUE(second.open());
+    EXPECT_EQ(1, countEntries(first, "firstEntries"));
+    EXPECT_EQ(1, countEntries(second, "secondEntries"));
+    first.close();
+    second.close();
+}
+
+/// Test that a component must be created before it can be opened, and can only be created once.
+TEST(SQLiteStorageEngineTest, componentIsCreatedOnce) {
+    auto engine = SQLiteStorageEngine::create(generateDbFilePath(), SQLiteDatabase::ConnectionProfile());
+    ASSERT_TRUE(engine);
+    EXPECT_EQ(0, engine->getSchemaVersion(FIRST_COMPONENT_NAME));
+
+    SQLiteDatabase first(engine, FIRST_COMPONENT_NAME, 1);
+    EXPECT_FALSE(first.open());
+    EXPECT_TRUE(first.initialize());
+    EXPECT_EQ(1, engine->getSchemaVersion(FIRST_COMPONENT_NAME));
+    first.close();
+
+    SQLiteDatabase again(engine, FIRST_COMPONENT_NAME, 1);
+    EXPECT_FALSE(again.initialize());
+    EXPECT_TRUE(again.open());
+    again.close();
+
+    // Closing a component leaves the connection open for the others.
+    SQLiteDatabase second(engine, SECOND_COMPONENT_NAME, 1);
+    EXPECT_TRUE(second.initialize());
+    EXPECT_TRUE(second.isDatabaseReady());
+    second.close();
+}
+
+/// Test that opening a component with a new schema version records it.
+TEST(SQLiteStorageEngineTest, schemaVersionIsUpdated) {
+    auto engine = SQLiteStorageEngine::create(generateDbFilePath(), SQLiteDatabase::ConnectionProfile());
+    ASSERT_TRUE(engine);
+    SQLiteDatabase first(engine, FIRST_COMPONENT_NAME, 1);
+    ASSERT_TRUE(first.initialize());
+    first.close();
+
+    SQLiteDatabase upgraded(engine, FIRST_COMPONENT_NAME, 2);
+    ASSERT_TRUE(upgraded.open());
+    EXPECT_EQ(2, engine->getSchemaVersion(FIRST_COMPONENT_NAME));
+    upgraded.close();
+}
+
+/// Test that the writes of several components in a transaction of the engine are committed or rolled back together.
+TEST(SQLiteStorageEngineTest, transactionSpansComponents) {
+    auto engine = SQLiteStorageEngine::create(generateDbFilePath(), SQLiteDatabase::ConnectionProfile());
+    ASSERT_TRUE(engine);
+    SQLiteDatabase first(engine, FIRST_COMPONENT_NAME, 1);
+    SQLiteDatabase second(engine, SECOND_COMPONENT_NAME, 1);
+    ASSERT_TRUE(first.initialize());
+    ASSERT_TRUE(second.initialize());
+    ASSERT_TRUE(first.performQuery(CREATE_FIRST_TABLE_SQL_STRING));
+    ASSERT_TRUE(second.performQuery(CREATE_SECOND_TABLE_SQL_STRING));
+
+    auto writeBoth = [&first, &second]() {
+        if (!insertEntry(first, "firstEntries", "key", "first")) {
+            return false;
+        }
+        // The transaction of a component is nested in the transaction of the engine.
+        auto transaction = second.beginTransaction();
+        return transaction && insertEntry(second, "secondEntries", "key", "second") && transaction->commit();
+    };
+
+    EXPECT_FALSE(engine->executeInTransaction([&writeBoth]() { return writeBoth() && false; }));
+    EXPECT_EQ(0, countEntries(first, "firstEntries"));
+    EXPECT_EQ(0, countEntries(second, "secondEntries"));
+
+    EXPECT_TRUE(engine->executeInTransaction(writeBoth));
+    EXPECT_EQ(1, countEntries(first, "firstEntries"));
+    EXPECT_EQ(1, countEntries(second, "secondEntries"));
+
+    first.close();
+    second.close();
+}
+
+/// Test that the rollback of a component's transaction does not discard the writes of another component.
+TEST(SQLiteStorageEngineTest, componentRollbackIsIsolated) {
+    auto engine = SQLiteStorageEngine::create(generateDbFilePath(), SQLiteDatabase::ConnectionProfile());
+    ASSERT_TRUE(engine);
+    SQLiteDatabase first(engine, FIRST_COMPONENT_NAME, 1);
+    SQLiteDatabase second(engine, SECOND_COMPONENT_NAME, 1);
+    ASSERT_TRUE(first.initialize());
+    ASSERT_TRUE(second.initialize());
+    ASSERT_TRUE(first.performQuery(CREATE_FIRST_TABLE_SQL_STRING));
+    ASSERT_TRUE(second.performQuery(CREATE_SECOND_TABLE_SQL_STRING));
+
+    ASSERT_TRUE(insertEntry(first, "firstEntries", "key", "first"));
+    {
+        auto transaction = second.beginTransaction();
+        ASSERT_TRUE(transaction);
+        ASSERT_TRUE(insertEntry(second, "secondEntries", "key", "second"));
+        ASSERT_TRUE(transaction->rollback());
+    }
+    EXPECT_EQ(1, countEntries(first, "firstEntries"));
+    EXPECT_EQ(0, countEntries(second, "secondEntries"));
+
+    first.close();
+    second.close();
+}
+
+/// Test that components written by several threads at once store every entry.
+TEST(SQLiteStorageEngineTest, concurrentWritersAreSerialized) {
+    auto engine = SQLiteStorageEngine::create(generateDbFilePath(), SQLiteDatabase::ConnectionProfile());
+    ASSERT_TRUE(engine);
+    SQLiteDatabase first(engine, FIRST_COMPONENT_NAME, 1);
+    SQLiteDatabase second(engine, SECOND_COMPONENT_NAME, 1);
+    ASSERT_TRUE(first.initialize());
+    ASSERT_TRUE(second.initialize());
+    ASSERT_TRUE(first.performQuery(CREATE_FIRST_TABLE_SQL_STRING));
+    ASSERT_TRUE(second.performQuery(CREATE_SECOND_TABLE_SQL_STRING));
+
+    auto write = [](SQLiteDatabase* db, std::string tableName, bool* succeeded) {
+        *succeeded = true;
+        for (int i = 0; i < CONCURRENT_ENTRIES; ++i) {
+            auto transaction = db->beginTransaction();
+            *succeeded = *succeeded && transaction && insertEntry(*db, tableName, std::to_string(i), "value") &&
+                         transaction->commit();
+        }
+    };
+    bool firstSucceeded = false;
+    bool secondSucceeded = false;
+    std::thread firstWriter(write, &first, "firstEntries", &firstSucceeded);
+    std::thread secondWriter(write, &second, "secondEntries", &secondSucceeded);
+    firstWriter.join();
+    secondWriter.join();
+
+    EXPECT_TRUE(firstSucceeded);
+    EXPECT_TRUE(secondSucceeded);
+    EXPECT_EQ(CONCURRENT_ENTRIES, countEntries(first, "firstEntries"));
+    EXPECT_EQ(CONCURRENT_ENTRIES, countEntries(second, "secondEntries"));
+
+    first.close();
+    second.close();
+}
+
+/// Test that every component configured with the same file gets the same engine.
+TEST(SQLiteStorageEngineTest, getInstanceFromConfiguration) {
+    std::shared_ptr<SQLiteStorageEngine> engine;
+    ASSERT_TRUE(ConfigurationNode::initialize({std::make_shared<std::stringstream>("{}")}));
+    EXPECT_TRUE(SQLiteStorageEngine::getInstance(ConfigurationNode::getRoot(), &engine));
+    EXPECT_FALSE(engine);
+    ConfigurationNode::uninitialize();
+
+    auto filePath = generateDbFilePath();
+    ASSERT_TRUE(ConfigurationNode::initialize({std::make_shared<std::stringstream>(
+        "{\"sqliteStorage\":{\"databaseFilePath\":\"" + filePath + "\"}}")}));
+    std::shared_ptr<SQLiteStorageEngine> other;
+    EXPECT_TRUE(SQLiteStorageEngine::getInstance(ConfigurationNode::getRoot(), &engine));
+    EXPECT_TRUE(SQLiteStorageEngine::getInstance(ConfigurationNode::getRoot(), &other));
+    ConfigurationNode::uninitialize();
+
+    ASSERT_TRUE(engine);
+    EXPECT_EQ(engine, other);
+    EXPECT_EQ(filePath, engine->getFilePath());
+    EXPECT_TRUE(avsCommon::utils::file::fileExists(filePath));
+}
+
+/**
+ * Benchmark of the cold start time, memory and clear time of the SDK's databases stored in a file each, and hosted
+ * by an engine.  The engine clears every component in one @c executeInTransaction call.  The averages over the runs
+ * are recorded as test properties.  Disabled by default.
+ */
+TEST(SQLiteStorageEngineTest, DISABLED_benchmarkStorageLayouts) {
+    BenchmarkResult separateFiles = {};
+    BenchmarkResult engine = {};
+    for (int i = 0; i < BENCHMARK_RUNS; ++i) {
+        addBenchmarkResult(runSeparateFilesBenchmark(), &separateFiles);
+        addBenchmarkResult(runEngineBenchmark(), &engine);
+    }
+
+    auto record = [](const std::string& label, const BenchmarkResult& total) {
+        auto microseconds = [](std::chrono::steady_clock::duration elapsed) {
+            return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+        };
+        RecordProperty(label + "ColdStartUs", std::to_string(microseconds(total.coldStart) / BENCHMARK_RUNS));
+        RecordProperty(label + "SqliteMemoryKiB", std::to_string(total.sqliteMemory / BENCHMARK_RUNS / 1024));
+        RecordProperty(label + "RssGrowthKiB", std::to_string(total.residentSetGrowth / BENCHMARK_RUNS / 1024));
+        RecordProperty(label + "ClearUs", std::to_string(microseconds(total.clear) / BENCHMARK_RUNS));
+    };
+    record("filePerComponent", separateFiles);
+    record("storageEngine", engine);
+}
+
+}  // namespace test
+}  // namespace sqliteStorage
+}  // namespace storage
+}  // namespace alexaClientSDK
+
+int main(int argc, char** argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc < 2) {
+        std::cerr << "Usage: " << std::string(argv[0]) << " <path to folder for test>" << std::endl;
+        return -1;
+    } else {
+        alexaClientSDK::storage::sqliteStorage::test::g_workingDirectory = std::string(argv[1]);
+        return RUN_ALL_TESTS();
+    }
+}
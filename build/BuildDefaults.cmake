@@ -39,6 +39,9 @@ include(Platforms)
 # Setup ESP variables.
 include(ESP)
 
+# Setup SharedMemorySDS variables.
+include(SharedMemorySDS)
+
 # Setup Comms variables.
 include(Comms)
 
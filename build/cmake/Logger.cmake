@@ -5,6 +5,14 @@
 #     -DACSDK_EMIT_SENSITIVE_LOGS=ON
 # Note that this option is only honored in DEBUG builds.
 #
+# To compile out all logs below a severity level, include the following option on the cmake command line:
+#     -DACSDK_MIN_COMPILED_LOG_LEVEL=<level>
+# where <level> is one of DEBUG9 to DEBUG0, INFO, WARN, ERROR or CRITICAL.  (DEBUG logs are only compiled into DEBUG
+# builds in any case.)
+#
+# To write logs from a background thread (see AsyncLogger), include the following option on the cmake command line:
+#     -DACSDK_ASYNC_LOG_SINK=ON
+#
 
 option(ACSDK_EMIT_SENSITIVE_LOGS "Enable Logging of sensitive information." OFF)
 
@@ -17,3 +25,24 @@ if (ACSDK_EMIT_SENSITIVE_LOGS)
         message(FATAL_ERROR "FATAL_ERROR: ACSDK_EMIT_SENSITIVE_LOGS=ON in non-DEBUG build.")
     endif()
 endif()
+
+option(ACSDK_ASYNC_LOG_SINK "Use AsyncLogger as the log sink." OFF)
+
+if (ACSDK_ASYNC_LOG_SINK)
+    message("Logging with AsyncLogger.")
+    add_definitions(-DACSDK_LOG_SINK=Async)
+    add_definitions(-DACSDK_ASYNC_LOG_SINK)
+endif()
+
+set(ACSDK_MIN_COMPILED_LOG_LEVEL "" CACHE STRING "Lowest severity level of logs to compile in.")
+
+if (ACSDK_MIN_COMPILED_LOG_LEVEL)
+    set(ACSDK_COMPILED_LOG_LEVELS
+        DEBUG9 DEBUG8 DEBUG7 DEBUG6 DEBUG5 DEBUG4 DEBUG3 DEBUG2 DEBUG1 DEBUG0 INFO WARN ERROR CRITICAL)
+    list(FIND ACSDK_COMPILED_LOG_LEVELS ${ACSDK_MIN_COMPILED_LOG_LEVEL} ACSDK_MIN_COMPILED_LOG_LEVEL_INDEX)
+    if (ACSDK_MIN_COMPILED_LOG_LEVEL_INDEX EQUAL -1)
+        message(FATAL_ERROR "FATAL_ERROR: Invalid ACSDK_MIN_COMPILED_LOG_LEVEL=${ACSDK_MIN_COMPILED_LOG_LEVEL}.")
+    endif()
+    message("Compiling out logs below ${ACSDK_MIN_COMPILED_LOG_LEVEL}.")
+    add_definitions(-DACSDK_MIN_COMPILED_LOG_LEVEL=${ACSDK_MIN_COMPILED_LOG_LEVEL})
+endif()
@@ -0,0 +1,24 @@
+#
+# Setup the SharedMemorySDS options.
+#
+# SharedMemorySDS streams are backed by POSIX shared memory so that they can be shared between processes.  They are
+# only supported on Linux.  To use SharedMemorySDS as the AudioInputStream type, so that audio read by the
+# AudioInputProcessor and keyword detectors can be written by another process, include the following option on the
+# cmake command line:
+#     cmake <path-to-source> -DSHARED_MEMORY_AUDIO_INPUT_STREAM=ON
+#
+
+if(CMAKE_SYSTEM_NAME STREQUAL "Linux")
+    set(SHARED_MEMORY_SDS_SUPPORTED ON)
+    add_definitions(-DSHARED_MEMORY_SDS_SUPPORTED)
+endif()
+
+option(SHARED_MEMORY_AUDIO_INPUT_STREAM "Use SharedMemorySDS as the AudioInputStream type." OFF)
+
+if(SHARED_MEMORY_AUDIO_INPUT_STREAM)
+    if(NOT SHARED_MEMORY_SDS_SUPPORTED)
+        message(FATAL_ERROR "SHARED_MEMORY_AUDIO_INPUT_STREAM is only supported on Linux.")
+    endif()
+    message("Creating ${PROJECT_NAME} with a SharedMemorySDS AudioInputStream")
+    add_definitions(-DSHARED_MEMORY_AUDIO_INPUT_STREAM)
+endif()